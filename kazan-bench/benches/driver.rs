@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! submitting work to the driver and waiting for it to finish
+
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use kazan_bench::{read_spirv_files, TRANSLATE_SPIRV_TO_IR_TEST_DATA};
+use kazan_driver::benchmark::BenchmarkDevice;
+
+const DISPATCH_SHADER: &str = "trivial_test";
+
+const DISPATCH_WORKGROUP_COUNTS: &[u32] = &[1, 64, 4096];
+
+const COPY_SIZES: &[u64] = &[4 << 10, 1 << 20, 64 << 20];
+
+const PRESENT_EXTENTS: &[(u32, u32)] = &[(640, 480), (1920, 1080)];
+
+fn dispatch(c: &mut Criterion, device: &BenchmarkDevice) {
+    let files = read_spirv_files(TRANSLATE_SPIRV_TO_IR_TEST_DATA);
+    let file = files
+        .iter()
+        .find(|file| file.name == DISPATCH_SHADER)
+        .unwrap();
+    let mut group = c.benchmark_group("vkCmdDispatch");
+    for &workgroup_count in DISPATCH_WORKGROUP_COUNTS {
+        let workload = match device.create_dispatch(&file.words, "main", workgroup_count) {
+            Some(workload) => workload,
+            None => {
+                eprintln!("skipping {}: pipeline creation failed", file.name);
+                break;
+            }
+        };
+        group.throughput(Throughput::Elements(workgroup_count.into()));
+        group.bench_function(BenchmarkId::from_parameter(workgroup_count), |b| {
+            b.iter(|| workload.run())
+        });
+    }
+    group.finish();
+}
+
+fn copy(c: &mut Criterion, device: &BenchmarkDevice) {
+    let mut group = c.benchmark_group("vkCmdCopyBuffer");
+    for &size in COPY_SIZES {
+        let workload = device.create_copy(size);
+        group.throughput(Throughput::Bytes(size));
+        group.bench_function(BenchmarkId::from_parameter(size), |b| {
+            b.iter(|| workload.run())
+        });
+    }
+    group.finish();
+}
+
+fn present(c: &mut Criterion, device: &BenchmarkDevice) {
+    let mut group = c.benchmark_group("vkQueuePresentKHR");
+    for &(width, height) in PRESENT_EXTENTS {
+        let swapchain = device.create_swapchain(width, height);
+        group.throughput(Throughput::Elements(1));
+        group.bench_function(
+            BenchmarkId::from_parameter(format!("{}x{}", width, height)),
+            |b| b.iter(|| swapchain.present()),
+        );
+    }
+    group.finish();
+}
+
+/// all on one device, since creating one starts the worker threads
+fn driver(c: &mut Criterion) {
+    let device = BenchmarkDevice::new();
+    dispatch(c, &device);
+    copy(c, &device);
+    present(c, &device);
+}
+
+criterion_group!(benches, driver);
+criterion_main!(benches);
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! creating compute pipelines from SPIR-V, from parsing to the JIT-compiled code being loaded
+
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion};
+use kazan_bench::{read_spirv_files, TRANSLATE_SPIRV_TO_IR_TEST_DATA};
+use shader_compiler::{
+    ComputePipeline, ComputePipelineOptions, GenericPipelineOptions, PipelineLayout,
+    ShaderStageCreateInfo,
+};
+use shader_compiler_backend::OptimizationMode;
+use shader_compiler_backend_llvm_7::LLVM_7_SHADER_COMPILER;
+use std::panic::{self, AssertUnwindSafe};
+
+const OPTIMIZATION_MODES: &[OptimizationMode] =
+    &[OptimizationMode::NoOptimizations, OptimizationMode::Normal];
+
+fn create(code: &[u32], optimization_mode: OptimizationMode) -> ComputePipeline {
+    ComputePipeline::new(
+        &ComputePipelineOptions {
+            generic_options: GenericPipelineOptions {
+                optimization_mode,
+                // scalar, so the results don't depend on the host's vector width
+                lane_count: 1,
+            },
+        },
+        ShaderStageCreateInfo {
+            code,
+            entry_point_name: "main",
+            specializations: &[],
+        },
+        PipelineLayout {
+            push_constants_size: 0,
+            descriptor_sets: Vec::new(),
+        },
+        LLVM_7_SHADER_COMPILER,
+    )
+}
+
+fn create_compute_pipeline(c: &mut Criterion) {
+    let mut group = c.benchmark_group("pipeline_creation");
+    // these are slow enough that Criterion's default of 100 samples takes minutes
+    group.sample_size(20);
+    for file in read_spirv_files(TRANSLATE_SPIRV_TO_IR_TEST_DATA) {
+        // not everything can be compiled yet, and the shader compiler panics on what it can't;
+        // those are benchmarked once they can be
+        let created = panic::catch_unwind(AssertUnwindSafe(|| {
+            create(&file.words, OptimizationMode::NoOptimizations)
+        }));
+        if created.is_err() {
+            eprintln!("skipping {}: pipeline creation failed", file.name);
+            continue;
+        }
+        for &optimization_mode in OPTIMIZATION_MODES {
+            group.bench_with_input(
+                BenchmarkId::new(format!("{:?}", optimization_mode), &file.name),
+                &*file.words,
+                |b, code| b.iter(|| black_box(create(code, optimization_mode))),
+            );
+        }
+    }
+    group.finish();
+}
+
+criterion_group!(benches, create_compute_pipeline);
+criterion_main!(benches);
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use kazan_bench::{read_spirv_files, SPIRV_PARSER_TEST_INPUTS};
+use std::mem;
+
+fn parse(c: &mut Criterion) {
+    let mut group = c.benchmark_group("spirv_parser");
+    for file in read_spirv_files(SPIRV_PARSER_TEST_INPUTS) {
+        group.throughput(Throughput::Bytes(
+            (file.words.len() * mem::size_of::<u32>()) as u64,
+        ));
+        group.bench_with_input(
+            BenchmarkId::from_parameter(&file.name),
+            &*file.words,
+            |b, words| {
+                b.iter(|| {
+                    for instruction in spirv_parser::Parser::start(words).unwrap() {
+                        black_box(instruction.unwrap());
+                    }
+                })
+            },
+        );
+    }
+    group.finish();
+}
+
+/// the same as `parse`, but borrows strings and operand lists from the words instead of copying them
+fn parse_ref(c: &mut Criterion) {
+    let mut group = c.benchmark_group("spirv_parser_ref");
+    for file in read_spirv_files(SPIRV_PARSER_TEST_INPUTS) {
+        group.throughput(Throughput::Bytes(
+            (file.words.len() * mem::size_of::<u32>()) as u64,
+        ));
+        group.bench_with_input(
+            BenchmarkId::from_parameter(&file.name),
+            &*file.words,
+            |b, words| {
+                b.iter(|| {
+                    for instruction in spirv_parser::Parser::start(words).unwrap().into_refs() {
+                        black_box(instruction.unwrap());
+                    }
+                })
+            },
+        );
+    }
+    group.finish();
+}
+
+criterion_group!(benches, parse, parse_ref);
+criterion_main!(benches);
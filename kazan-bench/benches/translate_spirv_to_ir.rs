@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion};
+use kazan_bench::{read_spirv_files, TRANSLATE_SPIRV_TO_IR_TEST_DATA};
+use shader_compiler_ir::{GlobalState, TargetProperties};
+use shader_compiler_translate_spirv_to_ir::{
+    DefaultSpecializationResolver, TranslatedSPIRVShader, TranslationError,
+};
+use spirv_parser::{ExecutionModel, Instruction, OpEntryPoint};
+use std::fmt;
+
+const ENTRY_POINT_NAME: &str = "main";
+
+struct DiscardOutput;
+
+impl fmt::Write for DiscardOutput {
+    fn write_str(&mut self, _s: &str) -> fmt::Result {
+        Ok(())
+    }
+}
+
+fn get_execution_model(spirv_code: &[u32]) -> Option<ExecutionModel> {
+    spirv_parser::Parser::start(spirv_code)
+        .ok()?
+        .filter_map(Result::ok)
+        .find_map(|instruction| match instruction.instruction {
+            Instruction::EntryPoint(OpEntryPoint {
+                execution_model,
+                name,
+                ..
+            }) if name == ENTRY_POINT_NAME => Some(execution_model),
+            _ => None,
+        })
+}
+
+fn translate(spirv_code: &[u32], execution_model: ExecutionModel) -> Result<(), TranslationError> {
+    let global_state = GlobalState::new();
+    let translated_shader = TranslatedSPIRVShader::new(
+        &global_state,
+        TargetProperties::default(),
+        &mut DefaultSpecializationResolver,
+        &mut DiscardOutput,
+        ENTRY_POINT_NAME,
+        execution_model,
+        spirv_code,
+    )?;
+    black_box(translated_shader);
+    Ok(())
+}
+
+fn translate_spirv_to_ir(c: &mut Criterion) {
+    let mut group = c.benchmark_group("translate_spirv_to_ir");
+    for file in read_spirv_files(TRANSLATE_SPIRV_TO_IR_TEST_DATA) {
+        let execution_model = get_execution_model(&file.words)
+            .unwrap_or_else(|| panic!("{}: no entry point named {}", file.name, ENTRY_POINT_NAME));
+        // not everything can be translated yet; those are benchmarked once they can be
+        if let Err(error) = translate(&file.words, execution_model) {
+            eprintln!("skipping {}: translation failed: {}", file.name, error);
+            continue;
+        }
+        group.bench_with_input(
+            BenchmarkId::from_parameter(&file.name),
+            &*file.words,
+            |b, spirv_code| b.iter(|| translate(spirv_code, execution_model).unwrap()),
+        );
+    }
+    group.finish();
+}
+
+criterion_group!(benches, translate_spirv_to_ir);
+criterion_main!(benches);
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! prints the results of the last benchmark run and how they changed from the baseline,
+//! appends them to a history file, and fails if any got slower than allowed.
+//!
+//! usage: `kazan-bench-report [--max-regression <percent>] [--history <file>]
+//! [--revision <revision>] <criterion-directory>`
+
+use kazan_bench::{format_time, read_criterion_results, write_history, HISTORY_HEADER};
+use std::env;
+use std::fs::OpenOptions;
+use std::io::{self, Write};
+use std::path::{Path, PathBuf};
+use std::process;
+use std::time::{SystemTime, UNIX_EPOCH};
+
+const USAGE: &str = "usage: kazan-bench-report [--max-regression <percent>] [--history <file>] \
+                     [--revision <revision>] <criterion-directory>";
+
+/// in percent
+const DEFAULT_MAX_REGRESSION: f64 = 5.0;
+
+fn fail(message: &str) -> ! {
+    eprintln!("kazan-bench-report: {}", message);
+    process::exit(1)
+}
+
+fn append_history(
+    path: &Path,
+    revision: &str,
+    results: &[kazan_bench::BenchmarkResult],
+) -> io::Result<()> {
+    let mut file = OpenOptions::new().append(true).create(true).open(path)?;
+    if file.metadata()?.len() == 0 {
+        writeln!(file, "{}", HISTORY_HEADER)?;
+    }
+    let time = SystemTime::now()
+        .duration_since(UNIX_EPOCH)
+        .map_or(0, |v| v.as_secs());
+    write_history(&mut file, time, revision, results)
+}
+
+fn main() {
+    let mut max_regression = DEFAULT_MAX_REGRESSION;
+    let mut history_file = None;
+    let mut revision = String::new();
+    let mut criterion_directory = None;
+    let mut args = env::args_os().skip(1);
+    while let Some(arg) = args.next() {
+        let mut get_value = || {
+            args.next()
+                .and_then(|v| v.into_string().ok())
+                .unwrap_or_else(|| fail(USAGE))
+        };
+        if arg == "--max-regression" {
+            max_regression = get_value().parse().unwrap_or_else(|_| fail(USAGE));
+        } else if arg == "--history" {
+            history_file = Some(PathBuf::from(get_value()));
+        } else if arg == "--revision" {
+            revision = get_value();
+        } else if criterion_directory.is_none() {
+            criterion_directory = Some(PathBuf::from(arg));
+        } else {
+            fail(USAGE);
+        }
+    }
+    let criterion_directory = criterion_directory.unwrap_or_else(|| fail(USAGE));
+    let results = read_criterion_results(&criterion_directory).unwrap_or_else(|e| fail(&e));
+    if results.is_empty() {
+        fail(&format!(
+            "no benchmark results in {}",
+            criterion_directory.display()
+        ));
+    }
+    let mut regression_count = 0;
+    for result in &results {
+        print!("{}: {}", result.name, format_time(result.mean));
+        if let Some(change) = result.change {
+            print!(" ({:+.2}%)", change.mean * 100.0);
+        }
+        if result.is_regression(max_regression / 100.0) {
+            regression_count += 1;
+            print!(" REGRESSED");
+        }
+        println!();
+    }
+    if let Some(history_file) = history_file {
+        if let Err(error) = append_history(&history_file, &revision, &results) {
+            fail(&format!("{}: {}", history_file.display(), error));
+        }
+    }
+    if regression_count != 0 {
+        fail(&format!(
+            "{} benchmarks got more than {}% slower than the baseline",
+            regression_count, max_regression
+        ));
+    }
+}
@@ -0,0 +1,284 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! Kazan's benchmarks, which use Criterion, and the code `kazan-bench-report` uses to compare
+//! their results to a saved baseline and keep a history of them.
+
+use serde_json::Value;
+use std::fs;
+use std::io::{self, Write};
+use std::path::Path;
+
+pub const SPIRV_PARSER_TEST_INPUTS: &str =
+    concat!(env!("CARGO_MANIFEST_DIR"), "/../spirv-parser/test_inputs");
+
+pub const TRANSLATE_SPIRV_TO_IR_TEST_DATA: &str = concat!(
+    env!("CARGO_MANIFEST_DIR"),
+    "/../shader-compiler-translate-spirv-to-ir/test_data"
+);
+
+pub struct SpirvFile {
+    /// the file name without the `.spv`
+    pub name: String,
+    pub words: Vec<u32>,
+}
+
+/// reads the `.spv` files in `directory`, sorted by name, so new test inputs are benchmarked
+/// without changing the benchmarks
+pub fn read_spirv_files(directory: &str) -> Vec<SpirvFile> {
+    let mut paths: Vec<_> = fs::read_dir(directory)
+        .unwrap_or_else(|error| panic!("{}: {}", directory, error))
+        .map(|entry| entry.unwrap().path())
+        .filter(|path| {
+            path.extension()
+                .map_or(false, |extension| extension == "spv")
+        })
+        .collect();
+    paths.sort();
+    paths
+        .iter()
+        .map(|path| {
+            let bytes = fs::read(path).unwrap_or_else(|error| panic!("{:?}: {}", path, error));
+            assert_eq!(bytes.len() % 4, 0, "{:?}: not SPIR-V", path);
+            SpirvFile {
+                name: path.file_stem().unwrap().to_string_lossy().into_owned(),
+                words: bytes
+                    .chunks(4)
+                    .map(|word| u32::from_le_bytes([word[0], word[1], word[2], word[3]]))
+                    .collect(),
+            }
+        })
+        .collect()
+}
+
+/// how much the mean time changed from the baseline, as a fraction of the baseline's
+#[derive(Copy, Clone, Debug, PartialEq)]
+pub struct Change {
+    pub mean: f64,
+    /// of the 95% confidence interval
+    pub lower_bound: f64,
+    pub upper_bound: f64,
+}
+
+#[derive(Clone, Debug, PartialEq)]
+pub struct BenchmarkResult {
+    /// Criterion's id, like `group/function/parameter`
+    pub name: String,
+    /// in nanoseconds
+    pub mean: f64,
+    /// `None` if there was no baseline to compare to
+    pub change: Option<Change>,
+}
+
+impl BenchmarkResult {
+    /// only counts changes that Criterion is confident are bigger than `max_regression`, so
+    /// noise doesn't fail runs
+    pub fn is_regression(&self, max_regression: f64) -> bool {
+        self.change
+            .map_or(false, |change| change.lower_bound > max_regression)
+    }
+}
+
+fn get_f64(value: &Value, path: &[&str]) -> Result<f64, String> {
+    path.iter()
+        .try_fold(value, |value, &key| value.get(key))
+        .and_then(Value::as_f64)
+        .ok_or_else(|| format!("missing {}", path.join(".")))
+}
+
+fn parse_json(json: &str) -> Result<Value, String> {
+    serde_json::from_str(json).map_err(|error| error.to_string())
+}
+
+/// parses the `benchmark.json` and `estimates.json` Criterion writes to a benchmark's `new`
+/// directory, and the `estimates.json` in its `change` directory, if any
+pub fn parse_benchmark_result(
+    benchmark_json: &str,
+    estimates_json: &str,
+    change_estimates_json: Option<&str>,
+) -> Result<BenchmarkResult, String> {
+    let benchmark = parse_json(benchmark_json)?;
+    let name = benchmark
+        .get("full_id")
+        .and_then(Value::as_str)
+        .ok_or_else(|| String::from("missing full_id"))?
+        .into();
+    let mean = get_f64(&parse_json(estimates_json)?, &["mean", "point_estimate"])?;
+    let change = match change_estimates_json {
+        Some(change_estimates_json) => {
+            let change_estimates = parse_json(change_estimates_json)?;
+            let get = |key| get_f64(&change_estimates, &["mean", "confidence_interval", key]);
+            Some(Change {
+                mean: get_f64(&change_estimates, &["mean", "point_estimate"])?,
+                lower_bound: get("lower_bound")?,
+                upper_bound: get("upper_bound")?,
+            })
+        }
+        None => None,
+    };
+    Ok(BenchmarkResult { name, mean, change })
+}
+
+fn read_benchmark_result(directory: &Path) -> Result<BenchmarkResult, String> {
+    let read = |path: &Path| {
+        fs::read_to_string(path).map_err(|error| format!("{}: {}", path.display(), error))
+    };
+    let change_estimates_path = directory.join("change/estimates.json");
+    let change_estimates_json = if change_estimates_path.exists() {
+        Some(read(&change_estimates_path)?)
+    } else {
+        None
+    };
+    parse_benchmark_result(
+        &read(&directory.join("new/benchmark.json"))?,
+        &read(&directory.join("new/estimates.json"))?,
+        change_estimates_json.as_ref().map(|v| &**v),
+    )
+    .map_err(|error| format!("{}: {}", directory.display(), error))
+}
+
+/// finds the results of every benchmark under Criterion's output directory, sorted by name
+pub fn read_criterion_results(criterion_directory: &Path) -> Result<Vec<BenchmarkResult>, String> {
+    fn find(directory: &Path, results: &mut Vec<BenchmarkResult>) -> Result<(), String> {
+        if directory.join("new/benchmark.json").exists() {
+            results.push(read_benchmark_result(directory)?);
+            return Ok(());
+        }
+        let entries = fs::read_dir(directory)
+            .map_err(|error| format!("{}: {}", directory.display(), error))?;
+        for entry in entries {
+            let entry = entry.map_err(|error| format!("{}: {}", directory.display(), error))?;
+            if entry.file_type().map_or(false, |v| v.is_dir()) {
+                find(&entry.path(), results)?;
+            }
+        }
+        Ok(())
+    }
+    let mut results = Vec::new();
+    find(criterion_directory, &mut results)?;
+    results.sort_by(|a, b| a.name.cmp(&b.name));
+    Ok(results)
+}
+
+pub const HISTORY_HEADER: &str = "time,revision,benchmark,mean_ns,change_percent";
+
+fn write_csv_string(writer: &mut impl Write, value: &str) -> io::Result<()> {
+    write!(writer, "\"{}\"", value.replace('"', "\"\""))
+}
+
+/// appends a line per benchmark to a CSV history; `time` is in seconds since the Unix epoch
+pub fn write_history(
+    writer: &mut impl Write,
+    time: u64,
+    revision: &str,
+    results: &[BenchmarkResult],
+) -> io::Result<()> {
+    for result in results {
+        write!(writer, "{},", time)?;
+        write_csv_string(writer, revision)?;
+        write!(writer, ",")?;
+        write_csv_string(writer, &result.name)?;
+        write!(writer, ",{:.1},", result.mean)?;
+        if let Some(change) = result.change {
+            write!(writer, "{:.2}", change.mean * 100.0)?;
+        }
+        writeln!(writer)?;
+    }
+    Ok(())
+}
+
+/// formats a time in nanoseconds like Criterion does
+pub fn format_time(nanoseconds: f64) -> String {
+    if nanoseconds < 1e3 {
+        format!("{:.2} ns", nanoseconds)
+    } else if nanoseconds < 1e6 {
+        format!("{:.2} us", nanoseconds / 1e3)
+    } else if nanoseconds < 1e9 {
+        format!("{:.2} ms", nanoseconds / 1e6)
+    } else {
+        format!("{:.2} s", nanoseconds / 1e9)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    const BENCHMARK_JSON: &str = r#"{"group_id":"spirv_parser","function_id":null,
+        "value_str":"test","throughput":{"Bytes":916},"full_id":"spirv_parser/test",
+        "directory_name":"spirv_parser/test"}"#;
+
+    fn estimates_json(mean: f64, lower_bound: f64, upper_bound: f64) -> String {
+        format!(
+            r#"{{"mean":{{"confidence_interval":{{"confidence_level":0.95,
+                "lower_bound":{},"upper_bound":{}}},"point_estimate":{},
+                "standard_error":1.0}}}}"#,
+            lower_bound, upper_bound, mean
+        )
+    }
+
+    #[test]
+    fn test_parse_benchmark_result() {
+        let result = parse_benchmark_result(
+            BENCHMARK_JSON,
+            &estimates_json(1500.0, 1400.0, 1600.0),
+            None,
+        )
+        .unwrap();
+        assert_eq!(
+            result,
+            BenchmarkResult {
+                name: "spirv_parser/test".into(),
+                mean: 1500.0,
+                change: None,
+            }
+        );
+        assert!(!result.is_regression(0.05));
+        let result = parse_benchmark_result(
+            BENCHMARK_JSON,
+            &estimates_json(1500.0, 1400.0, 1600.0),
+            Some(&estimates_json(0.1, 0.08, 0.12)),
+        )
+        .unwrap();
+        assert_eq!(
+            result.change,
+            Some(Change {
+                mean: 0.1,
+                lower_bound: 0.08,
+                upper_bound: 0.12,
+            })
+        );
+        assert!(result.is_regression(0.05));
+        assert!(!result.is_regression(0.1));
+        assert!(parse_benchmark_result(BENCHMARK_JSON, "{}", None).is_err());
+    }
+
+    #[test]
+    fn test_write_history() {
+        let results = [
+            BenchmarkResult {
+                name: "driver/\"copy\"".into(),
+                mean: 1234.56,
+                change: Some(Change {
+                    mean: -0.0125,
+                    lower_bound: -0.02,
+                    upper_bound: -0.005,
+                }),
+            },
+            BenchmarkResult {
+                name: "spirv_parser/test".into(),
+                mean: 10.0,
+                change: None,
+            },
+        ];
+        let mut output = Vec::new();
+        write_history(&mut output, 1_570_000_000, "abc123", &results).unwrap();
+        assert_eq!(
+            String::from_utf8(output).unwrap(),
+            concat!(
+                "1570000000,\"abc123\",\"driver/\"\"copy\"\"\",1234.6,-1.25\n",
+                "1570000000,\"abc123\",\"spirv_parser/test\",10.0,\n",
+            )
+        );
+    }
+}
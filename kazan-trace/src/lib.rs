@@ -0,0 +1,346 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! scoped trace events for finding where time goes in Kazan, written as a Chrome trace, which
+//! both `chrome://tracing` and <https://ui.perfetto.dev> open.
+//!
+//! Scopes only record anything when the `enabled` feature is on, and compile to nothing
+//! otherwise. Even then, nothing is recorded unless `KAZAN_TRACE_FILE` is set. Each thread
+//! records into its own ring buffer, which no other thread locks until the trace is written,
+//! so an event costs two clock reads and an uncontended lock. Once a thread's buffer is full,
+//! its oldest events are overwritten.
+
+use std::io::{self, Write};
+
+pub const TRACE_FILE_ENV_VAR: &str = "KAZAN_TRACE_FILE";
+
+/// per thread
+#[cfg_attr(not(feature = "enabled"), allow(dead_code))]
+const RING_BUFFER_CAPACITY: usize = 1 << 16;
+
+/// records the time from here to the end of the enclosing block as an event named `$name`,
+/// which must be a `&'static str`
+#[macro_export]
+macro_rules! trace_scope {
+    ($name:expr) => {
+        let _trace_scope = $crate::Scope::new($name);
+    };
+}
+
+#[derive(Copy, Clone, Debug, Eq, PartialEq)]
+pub struct Event {
+    pub name: &'static str,
+    /// in nanoseconds since tracing started
+    pub start: u64,
+    /// in nanoseconds
+    pub duration: u64,
+}
+
+/// keeps the last `capacity` events pushed
+#[derive(Debug)]
+pub struct RingBuffer {
+    events: Vec<Event>,
+    capacity: usize,
+    /// where the next event goes once `events` is full
+    next: usize,
+}
+
+impl RingBuffer {
+    pub fn new(capacity: usize) -> Self {
+        assert_ne!(capacity, 0);
+        Self {
+            events: Vec::new(),
+            capacity,
+            next: 0,
+        }
+    }
+    pub fn push(&mut self, event: Event) {
+        if self.events.len() < self.capacity {
+            self.events.push(event);
+        } else {
+            self.events[self.next] = event;
+            self.next = (self.next + 1) % self.capacity;
+        }
+    }
+    /// oldest first
+    pub fn iter(&self) -> impl Iterator<Item = &Event> {
+        let (newest, oldest) = self.events.split_at(self.next);
+        oldest.iter().chain(newest)
+    }
+}
+
+#[derive(Clone, Debug)]
+pub struct ThreadEvents {
+    pub thread_id: usize,
+    pub thread_name: String,
+    pub events: Vec<Event>,
+}
+
+fn write_json_string(writer: &mut impl Write, value: &str) -> io::Result<()> {
+    write!(writer, "\"")?;
+    for c in value.chars() {
+        match c {
+            '"' => write!(writer, "\\\"")?,
+            '\\' => write!(writer, "\\\\")?,
+            '\u{0}'..='\u{1F}' => write!(writer, "\\u{:04x}", c as u32)?,
+            _ => write!(writer, "{}", c)?,
+        }
+    }
+    write!(writer, "\"")
+}
+
+/// Chrome traces are in microseconds
+fn write_microseconds(writer: &mut impl Write, nanoseconds: u64) -> io::Result<()> {
+    write!(writer, "{}.{:03}", nanoseconds / 1000, nanoseconds % 1000)
+}
+
+/// writes the events of `threads` in the Chrome trace event format, as complete events
+pub fn write_chrome_trace(
+    writer: &mut impl Write,
+    process_id: u32,
+    threads: &[ThreadEvents],
+) -> io::Result<()> {
+    write!(writer, "{{\"displayTimeUnit\":\"ns\",\"traceEvents\":[")?;
+    let mut first = true;
+    for thread in threads {
+        if !first {
+            write!(writer, ",")?;
+        }
+        first = false;
+        write!(
+            writer,
+            "\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":{},\"tid\":{},\"args\":{{\"name\":",
+            process_id, thread.thread_id
+        )?;
+        write_json_string(writer, &thread.thread_name)?;
+        write!(writer, "}}}}")?;
+        for event in &thread.events {
+            write!(writer, ",\n{{\"name\":")?;
+            write_json_string(writer, event.name)?;
+            write!(
+                writer,
+                ",\"ph\":\"X\",\"pid\":{},\"tid\":{},\"ts\":",
+                process_id, thread.thread_id
+            )?;
+            write_microseconds(writer, event.start)?;
+            write!(writer, ",\"dur\":")?;
+            write_microseconds(writer, event.duration)?;
+            write!(writer, "}}")?;
+        }
+    }
+    writeln!(writer, "\n]}}")
+}
+
+#[cfg(feature = "enabled")]
+mod enabled {
+    use super::*;
+    use once_cell::sync::Lazy;
+    use std::env;
+    use std::fs::File;
+    use std::io::BufWriter;
+    use std::path::PathBuf;
+    use std::process;
+    use std::sync::atomic::{AtomicUsize, Ordering};
+    use std::sync::{Arc, Mutex};
+    use std::thread;
+    use std::time::{Duration, Instant};
+
+    fn to_nanoseconds(duration: Duration) -> u64 {
+        duration.as_secs() * 1_000_000_000 + u64::from(duration.subsec_nanos())
+    }
+
+    struct ThreadTrace {
+        thread_id: usize,
+        thread_name: String,
+        events: Mutex<RingBuffer>,
+    }
+
+    struct Tracer {
+        path: PathBuf,
+        start: Instant,
+        next_thread_id: AtomicUsize,
+        /// threads that exited are kept, so their events are still written
+        threads: Mutex<Vec<Arc<ThreadTrace>>>,
+    }
+
+    impl Tracer {
+        fn add_current_thread(&self) -> Arc<ThreadTrace> {
+            let thread_id = self.next_thread_id.fetch_add(1, Ordering::Relaxed);
+            let thread_name = match thread::current().name() {
+                Some(name) => name.into(),
+                None => format!("thread {}", thread_id),
+            };
+            let thread_trace = Arc::new(ThreadTrace {
+                thread_id,
+                thread_name,
+                events: Mutex::new(RingBuffer::new(RING_BUFFER_CAPACITY)),
+            });
+            self.threads.lock().unwrap().push(thread_trace.clone());
+            thread_trace
+        }
+        fn nanoseconds_since_start(&self, time: Instant) -> u64 {
+            to_nanoseconds(time.duration_since(self.start))
+        }
+    }
+
+    static TRACER: Lazy<Option<Tracer>> = Lazy::new(|| {
+        Some(Tracer {
+            path: env::var_os(TRACE_FILE_ENV_VAR)?.into(),
+            start: Instant::now(),
+            next_thread_id: AtomicUsize::new(1),
+            threads: Mutex::new(Vec::new()),
+        })
+    });
+
+    thread_local! {
+        static THREAD_TRACE: Option<Arc<ThreadTrace>> =
+            TRACER.as_ref().map(Tracer::add_current_thread);
+    }
+
+    pub struct Scope {
+        name: &'static str,
+        /// `None` when not tracing
+        start: Option<Instant>,
+    }
+
+    impl Scope {
+        #[inline]
+        pub fn new(name: &'static str) -> Self {
+            Self {
+                name,
+                start: TRACER.as_ref().map(|_| Instant::now()),
+            }
+        }
+    }
+
+    impl Drop for Scope {
+        fn drop(&mut self) {
+            let (tracer, start) = match (&*TRACER, self.start) {
+                (Some(tracer), Some(start)) => (tracer, start),
+                _ => return,
+            };
+            let event = Event {
+                name: self.name,
+                start: tracer.nanoseconds_since_start(start),
+                duration: to_nanoseconds(start.elapsed()),
+            };
+            // the thread-local is gone when a scope ends in a thread-local's destructor
+            let _ = THREAD_TRACE.try_with(|thread_trace| {
+                if let Some(thread_trace) = thread_trace {
+                    thread_trace.events.lock().unwrap().push(event);
+                }
+            });
+        }
+    }
+
+    pub fn write_trace() -> io::Result<()> {
+        let tracer = match &*TRACER {
+            Some(tracer) => tracer,
+            None => return Ok(()),
+        };
+        let threads: Vec<ThreadEvents> = tracer
+            .threads
+            .lock()
+            .unwrap()
+            .iter()
+            .map(|thread_trace| ThreadEvents {
+                thread_id: thread_trace.thread_id,
+                thread_name: thread_trace.thread_name.clone(),
+                events: thread_trace
+                    .events
+                    .lock()
+                    .unwrap()
+                    .iter()
+                    .cloned()
+                    .collect(),
+            })
+            .collect();
+        let mut writer = BufWriter::new(File::create(&tracer.path)?);
+        write_chrome_trace(&mut writer, process::id(), &threads)?;
+        writer.flush()
+    }
+}
+
+#[cfg(not(feature = "enabled"))]
+mod disabled {
+    use super::*;
+
+    pub struct Scope;
+
+    impl Scope {
+        #[inline(always)]
+        pub fn new(_name: &'static str) -> Self {
+            Scope
+        }
+    }
+
+    pub fn write_trace() -> io::Result<()> {
+        Ok(())
+    }
+}
+
+#[cfg(feature = "enabled")]
+pub use self::enabled::{write_trace, Scope};
+
+#[cfg(not(feature = "enabled"))]
+pub use self::disabled::{write_trace, Scope};
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn event(name: &'static str, start: u64) -> Event {
+        Event {
+            name,
+            start,
+            duration: 1,
+        }
+    }
+
+    #[test]
+    fn test_ring_buffer() {
+        let mut ring_buffer = RingBuffer::new(3);
+        for start in 0..2 {
+            ring_buffer.push(event("a", start));
+        }
+        let starts = |ring_buffer: &RingBuffer| -> Vec<u64> {
+            ring_buffer.iter().map(|event| event.start).collect()
+        };
+        assert_eq!(starts(&ring_buffer), [0, 1]);
+        for start in 2..7 {
+            ring_buffer.push(event("a", start));
+        }
+        assert_eq!(starts(&ring_buffer), [4, 5, 6]);
+    }
+
+    #[test]
+    fn test_write_chrome_trace() {
+        let threads = [ThreadEvents {
+            thread_id: 1,
+            thread_name: "kazan \"queue\"".into(),
+            events: vec![
+                Event {
+                    name: "Draw",
+                    start: 1_234_567,
+                    duration: 89,
+                },
+                event("Dispatch", 2_000_000),
+            ],
+        }];
+        let mut output = Vec::new();
+        write_chrome_trace(&mut output, 7, &threads).unwrap();
+        assert_eq!(
+            String::from_utf8(output).unwrap(),
+            concat!(
+                "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n",
+                "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":7,\"tid\":1,",
+                "\"args\":{\"name\":\"kazan \\\"queue\\\"\"}},\n",
+                "{\"name\":\"Draw\",\"ph\":\"X\",\"pid\":7,\"tid\":1,\"ts\":1234.567,",
+                "\"dur\":0.089},\n",
+                "{\"name\":\"Dispatch\",\"ph\":\"X\",\"pid\":7,\"tid\":1,\"ts\":2000.000,",
+                "\"dur\":0.001}\n",
+                "]}\n",
+            )
+        );
+    }
+}
@@ -0,0 +1,34 @@
+#!/bin/bash
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# See Notices.txt for copyright information
+
+set -e
+
+cd "$(dirname "$0")"
+# kazan-bench isn't a workspace member, so keep its output where the workspace's goes
+export CARGO_TARGET_DIR="$PWD/target"
+
+baseline=main
+save_baseline=0
+if [[ "$*" == '--save-baseline' ]]; then
+    save_baseline=1
+elif [[ "$*" != '' ]]; then
+    printf "unknown arguments\nusage: %s [--save-baseline]\n" "$0" >&2
+    exit 1
+fi
+
+criterion_dir="target/criterion"
+if ((save_baseline)); then
+    criterion_args=(--save-baseline "$baseline")
+elif [[ -d "$criterion_dir" ]] && [[ -n "$(find "$criterion_dir" -type d -name "$baseline" -print -quit)" ]]; then
+    criterion_args=(--baseline "$baseline")
+else
+    echo "no saved baseline: run with --save-baseline first" >&2
+    exit 1
+fi
+if [[ -d "$criterion_dir" ]]; then
+    # left over from earlier comparisons, so they'd be reported as if they were new
+    find "$criterion_dir" -type d -name change -prune -exec rm -rf {} +
+fi
+cargo bench --manifest-path kazan-bench/Cargo.toml -- "${criterion_args[@]}"
+exec cargo run --release --manifest-path kazan-bench/Cargo.toml --bin kazan-bench-report -- --history "$criterion_dir/history.csv" --revision "$(git rev-parse --short HEAD 2>/dev/null || true)" "$criterion_dir"
@@ -3,7 +3,12 @@
 # See Notices.txt for copyright information
 
 set -e
-cargo build
+if [ -n "$KAZAN_TRACE_FILE" ]; then
+    cargo build --features kazan-trace/enabled
+    export KAZAN_TRACE_FILE="$(realpath "$KAZAN_TRACE_FILE")"
+else
+    cargo build
+fi
 export VK_ICD_FILENAMES="$(realpath "$(ls --sort=time target/debug/build/vulkan-driver-*/out/kazan_driver.json | head -n 1)")"
 export RUST_BACKTRACE=1
 exec "$@"
@@ -220,6 +220,7 @@ fn main() {
 #include "llvm-c/Core.h"
 #include "llvm-c/OrcBindings.h"
 #include "llvm-c/Target.h"
+#include "llvm-c/TargetMachine.h"
 #include "llvm-c/Analysis.h"
 #include <stdbool.h>
 
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 // See Notices.txt for copyright information
 use crate::llvm;
+use once_cell::sync::OnceCell;
 use shader_compiler_backend as backend;
 use std::cell::RefCell;
 use std::collections::HashMap;
@@ -14,10 +15,15 @@ use std::ops::Deref;
 use std::os::raw::{c_char, c_uint};
 use std::ptr::null_mut;
 use std::ptr::NonNull;
-use std::sync::Once;
+use std::slice;
+use std::sync::{Mutex, Once};
 
 const EMPTY_C_STR: &[c_char] = &[b'0' as c_char];
 
+/// an `LLVMContext` never frees the types and constants created in it, so it is only reused for
+/// this many compiles
+const MAX_CONTEXT_USE_COUNT: u32 = 64;
+
 fn to_bool(v: llvm::LLVMBool) -> bool {
     v != 0
 }
@@ -272,6 +278,8 @@ impl<'a> backend::Function<'a> for LLVM7Function {
 
 pub struct LLVM7Context {
     context: Option<ManuallyDrop<OwnedContext>>,
+    /// how many compiles `context` has been used for, including this one
+    context_use_count: u32,
     modules: ManuallyDrop<RefCell<Vec<OwnedModule>>>,
     config: LLVM7CompilerConfig,
 }
@@ -288,8 +296,8 @@ impl Drop for LLVM7Context {
     fn drop(&mut self) {
         unsafe {
             ManuallyDrop::drop(&mut self.modules);
-            if let Some(context) = &mut self.context {
-                ManuallyDrop::drop(context);
+            if let Some(context) = self.context.take() {
+                release_thread_context(ManuallyDrop::into_inner(context), self.context_use_count);
             }
         }
     }
@@ -520,19 +528,41 @@ impl LLVM7TargetMachine {
 
 struct LLVM7OrcJITStack(llvm::LLVMOrcJITStackRef);
 
+/// only used with `JITService::session` locked
+unsafe impl Send for LLVM7OrcJITStack {}
+
 impl Drop for LLVM7OrcJITStack {
     fn drop(&mut self) {
         unsafe {
             match llvm::LLVMOrcDisposeInstance(self.0) {
                 llvm::LLVMOrcErrSuccess => {}
-                _ => {
-                    panic!("LLVMOrcDisposeInstance failed");
-                }
+                // panicking here could abort while already unwinding, so whatever wasn't
+                // disposed of is leaked instead
+                _ => eprintln!("kazan: LLVMOrcDisposeInstance failed; leaking the JIT stack"),
             }
         }
     }
 }
 
+struct OwnedMemoryBuffer(llvm::LLVMMemoryBufferRef);
+
+impl Drop for OwnedMemoryBuffer {
+    fn drop(&mut self) {
+        unsafe {
+            llvm::LLVMDisposeMemoryBuffer(self.0);
+        }
+    }
+}
+
+impl OwnedMemoryBuffer {
+    unsafe fn as_bytes(&self) -> &[u8] {
+        slice::from_raw_parts(
+            llvm::LLVMGetBufferStart(self.0) as *const u8,
+            llvm::LLVMGetBufferSize(self.0),
+        )
+    }
+}
+
 fn initialize_native_target() {
     static ONCE: Once = Once::new();
     ONCE.call_once(|| unsafe {
@@ -547,6 +577,242 @@ extern "C" fn symbol_resolver_fn<Void>(name: *const c_char, _lookup_context: *mu
     panic!("symbol_resolver_fn is unimplemented: name = {:?}", name)
 }
 
+/// returns the target machine along with the description stored in `ObjectCode::target`.
+/// the code generation level only affects `LLVM7Compiler::run`, since loaded object code is
+/// already compiled
+unsafe fn create_target_machine(
+    optimization_mode: backend::OptimizationMode,
+) -> Result<(LLVM7TargetMachine, String), String> {
+    let target_triple = LLVM7String::from_ptr(llvm::LLVMGetDefaultTargetTriple()).unwrap();
+    let mut target = null_mut();
+    let mut error = null_mut();
+    let success = !to_bool(llvm::LLVMGetTargetFromTriple(
+        target_triple.as_ptr(),
+        &mut target,
+        &mut error,
+    ));
+    if !success {
+        let error = LLVM7String::from_ptr(error).unwrap();
+        return Err(error.to_string_lossy().into());
+    }
+    if !to_bool(llvm::LLVMTargetHasJIT(target)) {
+        return Err(format!("target {:?} doesn't support JIT", target_triple));
+    }
+    let host_cpu_name = LLVM7String::from_ptr(llvm::LLVMGetHostCPUName()).unwrap();
+    let host_cpu_features = LLVM7String::from_ptr(llvm::LLVMGetHostCPUFeatures()).unwrap();
+    let target_machine = LLVM7TargetMachine(llvm::LLVMCreateTargetMachine(
+        target,
+        target_triple.as_ptr(),
+        host_cpu_name.as_ptr(),
+        host_cpu_features.as_ptr(),
+        match optimization_mode {
+            backend::OptimizationMode::NoOptimizations => llvm::LLVMCodeGenLevelNone,
+            backend::OptimizationMode::Normal => llvm::LLVMCodeGenLevelDefault,
+        },
+        llvm::LLVMRelocDefault,
+        llvm::LLVMCodeModelJITDefault,
+    ));
+    assert!(!target_machine.0.is_null());
+    let target_description = format!(
+        "{};{};{}",
+        target_triple.to_string_lossy(),
+        host_cpu_name.to_string_lossy(),
+        host_cpu_features.to_string_lossy()
+    );
+    Ok((target_machine, target_description))
+}
+
+struct ThreadState {
+    /// along with how many compiles it's been used for
+    context: Option<(OwnedContext, u32)>,
+    target_machines: Vec<(backend::OptimizationMode, LLVM7TargetMachine)>,
+}
+
+thread_local! {
+    static THREAD_STATE: RefCell<ThreadState> = RefCell::new(ThreadState {
+        context: None,
+        target_machines: Vec::new(),
+    });
+}
+
+/// returns the context along with how many compiles it'll have been used for
+unsafe fn acquire_thread_context() -> (OwnedContext, u32) {
+    let (context, use_count) = THREAD_STATE
+        .with(|thread_state| thread_state.borrow_mut().context.take())
+        .unwrap_or_else(|| (OwnedContext(llvm::LLVMContextCreate()), 0));
+    (context, use_count + 1)
+}
+
+/// keeps `context` for the next compile on this thread, unless it's been used too much or
+/// another context is already kept
+fn release_thread_context(context: OwnedContext, use_count: u32) {
+    if use_count >= MAX_CONTEXT_USE_COUNT {
+        return;
+    }
+    // the thread state is already gone if this thread is exiting
+    let _ = THREAD_STATE.try_with(|thread_state| {
+        let mut thread_state = thread_state.borrow_mut();
+        if thread_state.context.is_none() {
+            thread_state.context = Some((context, use_count));
+        }
+    });
+}
+
+/// target machines can't be used by several threads at once, so each thread creates its own
+unsafe fn with_thread_target_machine<R>(
+    optimization_mode: backend::OptimizationMode,
+    f: impl FnOnce(&LLVM7TargetMachine) -> R,
+) -> Result<R, String> {
+    THREAD_STATE.with(|thread_state| {
+        let mut thread_state = thread_state.borrow_mut();
+        let target_machines = &mut thread_state.target_machines;
+        let index = match target_machines
+            .iter()
+            .position(|(mode, _)| *mode == optimization_mode)
+        {
+            Some(index) => index,
+            None => {
+                let (target_machine, _) = create_target_machine(optimization_mode)?;
+                target_machines.push((optimization_mode, target_machine));
+                target_machines.len() - 1
+            }
+        };
+        Ok(f(&target_machines[index].1))
+    })
+}
+
+/// the JIT session shared by all compiled code, so setting up the native target and the JIT is
+/// only done once per process
+struct JITService {
+    /// the description stored in `ObjectCode::target`
+    target: String,
+    /// the ORC C API isn't thread-safe
+    session: Mutex<LLVM7OrcJITStack>,
+}
+
+impl JITService {
+    fn get() -> Result<&'static JITService, String> {
+        static JIT_SERVICE: OnceCell<JITService> = OnceCell::new();
+        JIT_SERVICE.get_or_try_init(|| unsafe {
+            initialize_native_target();
+            let (target_machine, target) =
+                create_target_machine(backend::OptimizationMode::default())?;
+            Ok(JITService {
+                target,
+                session: Mutex::new(LLVM7OrcJITStack(llvm::LLVMOrcCreateInstance(
+                    target_machine.take(),
+                ))),
+            })
+        })
+    }
+}
+
+struct CompiledCode<K: Hash + Eq + Send + Sync + 'static> {
+    /// keyed by symbol name
+    functions: HashMap<String, unsafe extern "C" fn()>,
+    /// the loaded module is linked in place in `object_code.bytes`, so it's removed before
+    /// they're freed
+    object_code: backend::ObjectCode<K>,
+    jit_service: &'static JITService,
+    module_handle: llvm::LLVMOrcModuleHandle,
+}
+
+/// if removing fails, the module's code and data are leaked, since nothing else refers to them
+unsafe fn remove_module(session: &LLVM7OrcJITStack, module_handle: llvm::LLVMOrcModuleHandle) {
+    match llvm::LLVMOrcRemoveModule(session.0, module_handle) {
+        llvm::LLVMOrcErrSuccess => {}
+        _ => {
+            let message = llvm::LLVMOrcGetErrorMsg(session.0);
+            let message = if message.is_null() {
+                "unknown error".into()
+            } else {
+                CStr::from_ptr(message).to_string_lossy()
+            };
+            eprintln!(
+                "kazan: LLVMOrcRemoveModule failed; leaking the module: {}",
+                message
+            );
+        }
+    }
+}
+
+impl<K: Hash + Eq + Send + Sync + 'static> Drop for CompiledCode<K> {
+    fn drop(&mut self) {
+        let session = self.jit_service.session.lock().unwrap();
+        unsafe { remove_module(&session, self.module_handle) }
+    }
+}
+
+unsafe impl<K: Hash + Eq + Send + Sync + 'static> Send for CompiledCode<K> {}
+unsafe impl<K: Hash + Eq + Send + Sync + 'static> Sync for CompiledCode<K> {}
+
+impl<K: Hash + Eq + Send + Sync + 'static> backend::CompiledCode<K> for CompiledCode<K> {
+    fn get(&self, key: &K) -> Option<unsafe extern "C" fn()> {
+        Some(*self.functions.get(self.object_code.symbols.get(key)?)?)
+    }
+    fn object_code(&self) -> Option<&backend::ObjectCode<K>> {
+        Some(&self.object_code)
+    }
+}
+
+/// both freshly compiled and cached code are loaded through here, so they are linked the same way
+unsafe fn load_object_code<K: Hash + Eq + Send + Sync + 'static>(
+    jit_service: &'static JITService,
+    object_code: backend::ObjectCode<K>,
+) -> Result<CompiledCode<K>, String> {
+    kazan_trace::trace_scope!("LLVM7 JIT load");
+    let session = jit_service.session.lock().unwrap();
+    // LLVMOrcAddObjectFile takes ownership of the buffer, which doesn't copy the bytes
+    let object_buffer = llvm::LLVMCreateMemoryBufferWithMemoryRange(
+        object_code.bytes.as_ptr() as *const c_char,
+        object_code.bytes.len(),
+        EMPTY_C_STR.as_ptr(),
+        0,
+    );
+    let mut module_handle = 0;
+    if llvm::LLVMOrcErrSuccess
+        != llvm::LLVMOrcAddObjectFile(
+            session.0,
+            &mut module_handle,
+            object_buffer,
+            Some(symbol_resolver_fn),
+            null_mut(),
+        )
+    {
+        return Err("loading object code failed".into());
+    }
+    let mut functions = HashMap::new();
+    let mut get_function = |name: &String| -> Result<(), String> {
+        let c_name = CString::new(&**name).map_err(|_| format!("invalid symbol: {:?}", name))?;
+        let mut address: llvm::LLVMOrcTargetAddress = mem::zeroed();
+        if llvm::LLVMOrcErrSuccess
+            != llvm::LLVMOrcGetSymbolAddressIn(
+                session.0,
+                &mut address,
+                module_handle,
+                c_name.as_ptr(),
+            )
+        {
+            return Err(format!("function not found in compiled module: {:?}", name));
+        }
+        let address: Option<unsafe extern "C" fn()> = mem::transmute(address as usize);
+        let address =
+            address.ok_or_else(|| format!("function not found in compiled module: {:?}", name))?;
+        functions.insert(name.clone(), address);
+        Ok(())
+    };
+    if let Err(error) = object_code.symbols.values().try_for_each(&mut get_function) {
+        remove_module(&session, module_handle);
+        return Err(error);
+    }
+    Ok(CompiledCode {
+        functions,
+        object_code,
+        jit_service,
+        module_handle,
+    })
+}
+
 #[derive(Copy, Clone)]
 pub struct LLVM7Compiler;
 
@@ -560,12 +826,14 @@ impl backend::Compiler for LLVM7Compiler {
         user: U,
         config: LLVM7CompilerConfig,
     ) -> Result<Box<dyn backend::CompiledCode<U::FunctionKey>>, U::Error> {
+        kazan_trace::trace_scope!("LLVM7Compiler::run");
         unsafe {
-            initialize_native_target();
-            let context = OwnedContext(llvm::LLVMContextCreate());
+            let jit_service = JITService::get().map_err(U::create_error)?;
+            let (context, context_use_count) = acquire_thread_context();
             let modules = Vec::new();
             let mut context = LLVM7Context {
                 context: Some(ManuallyDrop::new(context)),
+                context_use_count,
                 modules: ManuallyDrop::new(RefCell::new(modules)),
                 config: config.clone(),
             };
@@ -592,99 +860,60 @@ impl backend::Compiler for LLVM7Compiler {
                 .drain(..)
                 .find(|v| v.0 == module.module)
                 .unwrap();
-            let target_triple = LLVM7String::from_ptr(llvm::LLVMGetDefaultTargetTriple()).unwrap();
-            let mut target = null_mut();
             let mut error = null_mut();
-            let success = !to_bool(llvm::LLVMGetTargetFromTriple(
-                target_triple.as_ptr(),
-                &mut target,
-                &mut error,
-            ));
-            if !success {
+            let mut object_buffer = null_mut();
+            let failed = with_thread_target_machine(config.optimization_mode, |target_machine| {
+                kazan_trace::trace_scope!("LLVMTargetMachineEmitToMemoryBuffer");
+                to_bool(llvm::LLVMTargetMachineEmitToMemoryBuffer(
+                    target_machine.0,
+                    module.0,
+                    llvm::LLVMObjectFile,
+                    &mut error,
+                    &mut object_buffer,
+                ))
+            })
+            .map_err(U::create_error)?;
+            if failed {
                 let error = LLVM7String::from_ptr(error).unwrap();
                 return Err(U::create_error(error.to_string_lossy().into()));
             }
-            if !to_bool(llvm::LLVMTargetHasJIT(target)) {
-                return Err(U::create_error(format!(
-                    "target {:?} doesn't support JIT",
-                    target_triple
-                )));
-            }
-            let host_cpu_name = LLVM7String::from_ptr(llvm::LLVMGetHostCPUName()).unwrap();
-            let host_cpu_features = LLVM7String::from_ptr(llvm::LLVMGetHostCPUFeatures()).unwrap();
-            let target_machine = LLVM7TargetMachine(llvm::LLVMCreateTargetMachine(
-                target,
-                target_triple.as_ptr(),
-                host_cpu_name.as_ptr(),
-                host_cpu_features.as_ptr(),
-                match config.optimization_mode {
-                    backend::OptimizationMode::NoOptimizations => llvm::LLVMCodeGenLevelNone,
-                    backend::OptimizationMode::Normal => llvm::LLVMCodeGenLevelDefault,
-                },
-                llvm::LLVMRelocDefault,
-                llvm::LLVMCodeModelJITDefault,
-            ));
-            assert!(!target_machine.0.is_null());
-            let orc_jit_stack =
-                LLVM7OrcJITStack(llvm::LLVMOrcCreateInstance(target_machine.take()));
-            let mut module_handle = 0;
-            if llvm::LLVMOrcErrSuccess
-                != llvm::LLVMOrcAddEagerlyCompiledIR(
-                    orc_jit_stack.0,
-                    &mut module_handle,
-                    module.take(),
-                    Some(symbol_resolver_fn),
-                    null_mut(),
-                )
-            {
-                return Err(U::create_error("compilation failed".into()));
-            }
-            let mut functions: HashMap<_, _> = HashMap::new();
+            let object_buffer = OwnedMemoryBuffer(object_buffer);
+            drop(module);
+            let mut symbols = HashMap::new();
             for (key, name) in callable_functions {
-                let mut address: llvm::LLVMOrcTargetAddress = mem::zeroed();
-                if llvm::LLVMOrcErrSuccess
-                    != llvm::LLVMOrcGetSymbolAddressIn(
-                        orc_jit_stack.0,
-                        &mut address,
-                        module_handle,
-                        name.as_ptr(),
-                    )
-                {
-                    return Err(U::create_error(format!(
-                        "function not found in compiled module: {:?}",
-                        name
-                    )));
-                }
-                let address: Option<unsafe extern "C" fn()> = mem::transmute(address as usize);
-                if functions.insert(key, address.unwrap()).is_some() {
-                    return Err(U::create_error(format!("duplicate function: {:?}", name)));
-                }
-            }
-            struct CompiledCode<K: Hash + Eq + Send + Sync + 'static> {
-                functions: HashMap<K, unsafe extern "C" fn()>,
-                orc_jit_stack: ManuallyDrop<LLVM7OrcJITStack>,
-                context: ManuallyDrop<OwnedContext>,
+                let name = name
+                    .into_string()
+                    .map_err(|v| U::create_error(format!("invalid function name: {:?}", v)))?;
+                symbols.insert(key, name);
             }
-            unsafe impl<K: Hash + Eq + Send + Sync + 'static> Send for CompiledCode<K> {}
-            unsafe impl<K: Hash + Eq + Send + Sync + 'static> Sync for CompiledCode<K> {}
-            impl<K: Hash + Eq + Send + Sync + 'static> Drop for CompiledCode<K> {
-                fn drop(&mut self) {
-                    unsafe {
-                        ManuallyDrop::drop(&mut self.orc_jit_stack);
-                        ManuallyDrop::drop(&mut self.context);
-                    }
-                }
-            }
-            impl<K: Hash + Eq + Send + Sync + 'static> backend::CompiledCode<K> for CompiledCode<K> {
-                fn get(&self, key: &K) -> Option<unsafe extern "C" fn()> {
-                    Some(*self.functions.get(key)?)
-                }
+            let object_code = backend::ObjectCode {
+                bytes: object_buffer.as_bytes().into(),
+                symbols,
+                target: jit_service.target.clone(),
+            };
+            // the object code doesn't reference `context`, so it can be released now
+            drop(context);
+            Ok(Box::new(
+                load_object_code(jit_service, object_code).map_err(U::create_error)?,
+            ))
+        }
+    }
+    fn load<K: Hash + Eq + Send + Sync + 'static>(
+        self,
+        object_code: backend::ObjectCode<K>,
+    ) -> Result<Box<dyn backend::CompiledCode<K>>, backend::LoadError> {
+        unsafe {
+            let jit_service = JITService::get().map_err(|v| backend::LoadError::new(&v))?;
+            if object_code.target != jit_service.target {
+                return Err(backend::LoadError::new(&format!(
+                    "object code was compiled for a different target: {:?}",
+                    object_code.target
+                )));
             }
-            Ok(Box::new(CompiledCode {
-                functions,
-                orc_jit_stack: ManuallyDrop::new(orc_jit_stack),
-                context: context.context.take().unwrap(),
-            }))
+            Ok(Box::new(
+                load_object_code(jit_service, object_code)
+                    .map_err(|v| backend::LoadError::new(&v))?,
+            ))
         }
     }
 }
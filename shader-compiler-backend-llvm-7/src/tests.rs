@@ -97,4 +97,55 @@ mod tests {
             function(0);
         }
     }
+
+    #[test]
+    fn test_load_object_code() {
+        type GeneratedFunctionType = unsafe extern "C" fn(u32);
+        #[derive(Copy, Clone, Hash, Eq, PartialEq, Debug)]
+        enum FunctionKey {
+            Function,
+        }
+        struct Test;
+        impl CompilerUser for Test {
+            type FunctionKey = FunctionKey;
+            type Error = String;
+            fn create_error(message: String) -> String {
+                message
+            }
+            fn run<'a, C: Context<'a>>(
+                self,
+                context: &'a C,
+            ) -> Result<CompileInputs<'a, C, FunctionKey>, String> {
+                let type_builder = context.create_type_builder();
+                let mut module = context.create_module("test_module");
+                let mut function = module.add_function(
+                    "test_function",
+                    type_builder.build::<GeneratedFunctionType>(),
+                );
+                let builder = context.create_builder();
+                let builder = builder.attach(function.append_new_basic_block(None));
+                builder.build_return(None);
+                let module = module.verify().unwrap();
+                Ok(CompileInputs {
+                    module,
+                    callable_functions: vec![(FunctionKey::Function, function)]
+                        .into_iter()
+                        .collect(),
+                })
+            }
+        }
+        let object_code = make_compiler()
+            .run(Test, Default::default())
+            .unwrap()
+            .object_code()
+            .unwrap()
+            .clone();
+        assert!(!object_code.bytes.is_empty());
+        let compiled_code = make_compiler().load(object_code).unwrap();
+        let function = compiled_code.get(&FunctionKey::Function).unwrap();
+        unsafe {
+            let function: GeneratedFunctionType = mem::transmute(function);
+            function(0);
+        }
+    }
 }
@@ -202,6 +202,53 @@ pub trait CompiledCode<K: Hash + Eq + Send + Sync + 'static>: Send + Sync {
     /// the returned function needs to be cast to the correct type and
     /// `Self` needs to still exist while the returned function exists
     fn get(&self, which: &K) -> Option<unsafe extern "C" fn()>;
+    /// get the machine code that `Self` was loaded from, if the `Compiler` supports
+    /// loading it again with `Compiler::load`
+    fn object_code(&self) -> Option<&ObjectCode<K>> {
+        None
+    }
+}
+
+/// relocatable machine code that can be saved and later passed to `Compiler::load`,
+/// skipping compilation
+#[derive(Clone, Debug)]
+pub struct ObjectCode<K: Hash + Eq + Send + Sync + 'static> {
+    /// the contents of the object file
+    pub bytes: Vec<u8>,
+    /// the symbol name of each function that can be called from the loaded `CompiledCode`
+    pub symbols: HashMap<K, String>,
+    /// identifies the target machine the code was compiled for;
+    /// `Compiler::load` rejects code compiled for a different target machine
+    pub target: String,
+}
+
+/// error returned by `Compiler::load`
+#[derive(Clone, Debug)]
+pub struct LoadError {
+    message: String,
+}
+
+impl LoadError {
+    /// create a new `LoadError`
+    pub fn new<T: ToString + ?Sized>(message: &T) -> Self {
+        LoadError {
+            message: message.to_string(),
+        }
+    }
+}
+
+impl fmt::Display for LoadError {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        write!(f, "loading object code failed: {}", self.message)
+    }
+}
+
+impl Error for LoadError {}
+
+impl From<LoadError> for io::Error {
+    fn from(v: LoadError) -> Self {
+        io::Error::new(io::ErrorKind::Other, format!("{}", v))
+    }
 }
 
 /// trait that the user of `Compiler` implements
@@ -254,6 +301,17 @@ pub trait Compiler: Copy + Send + Sync + 'static {
         user: U,
         config: Self::Config,
     ) -> Result<Box<dyn CompiledCode<U::FunctionKey>>, U::Error>;
+    /// load `ObjectCode` previously returned by `CompiledCode::object_code`.
+    /// `object_code` must have been produced by the same version of the same compiler
+    fn load<K: Hash + Eq + Send + Sync + 'static>(
+        self,
+        _object_code: ObjectCode<K>,
+    ) -> Result<Box<dyn CompiledCode<K>>, LoadError> {
+        Err(LoadError::new(&format!(
+            "{} doesn't support loading object code",
+            self.name()
+        )))
+    }
 }
 
 #[cfg(test)]
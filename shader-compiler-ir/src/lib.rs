@@ -27,13 +27,14 @@ mod global_state;
 mod instructions_impl;
 mod interface;
 mod module;
+mod passes;
 mod target_properties;
 mod types;
 mod values;
 
 pub use crate::{
     block::*, consts::*, debug_info::*, function::*, global_state::*, instructions_impl::*,
-    interface::*, module::*, target_properties::*, types::*, values::*,
+    interface::*, module::*, passes::*, target_properties::*, types::*, values::*,
 };
 
 /// code structure input/output
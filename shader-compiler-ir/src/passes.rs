@@ -0,0 +1,342 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! optimization passes, run on the IR before it's lowered to a backend, so the backend has less
+//! code to compile
+
+mod common_subexpression_elimination;
+mod constant_folding;
+mod copy_propagation;
+mod dead_code_elimination;
+
+pub use self::{
+    common_subexpression_elimination::*, constant_folding::*, copy_propagation::*,
+    dead_code_elimination::*,
+};
+
+use crate::{prelude::*, BlockData, IdRef, InstructionData};
+use alloc::{boxed::Box, vec::Vec};
+use hashbrown::HashMap;
+
+/// a transformation of a `Function`
+pub trait FunctionPass<'g> {
+    /// the name of the pass
+    fn name(&self) -> &'static str;
+    /// run the pass on `function`, returning `true` if `function` was changed
+    fn run(&mut self, function: &FunctionData<'g>, global_state: &'g GlobalState<'g>) -> bool;
+}
+
+/// runs a sequence of `FunctionPass`es on functions
+pub struct PassManager<'g> {
+    passes: Vec<Box<dyn FunctionPass<'g> + 'g>>,
+    /// the sequence of passes is run again until nothing changes, up to this many times
+    pub max_iteration_count: usize,
+}
+
+impl<'g> Default for PassManager<'g> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl<'g> PassManager<'g> {
+    /// create a new `PassManager` without any passes
+    pub fn new() -> Self {
+        Self {
+            passes: Vec::new(),
+            max_iteration_count: 8,
+        }
+    }
+    /// create a new `PassManager` with constant folding, copy propagation, common subexpression
+    /// elimination and dead code elimination, in that order
+    pub fn with_default_passes() -> Self {
+        let mut retval = Self::new();
+        retval.add_pass(ConstantFolding);
+        retval.add_pass(CopyPropagation);
+        retval.add_pass(CommonSubexpressionElimination);
+        retval.add_pass(DeadCodeElimination);
+        retval
+    }
+    /// add `pass` to the end of the sequence of passes
+    pub fn add_pass(&mut self, pass: impl FunctionPass<'g> + 'g) {
+        self.passes.push(Box::new(pass));
+    }
+    /// the names of the passes, in the order they're run
+    pub fn pass_names(&self) -> Vec<&'static str> {
+        self.passes.iter().map(|pass| pass.name()).collect()
+    }
+    /// run the passes on `function`, returning `true` if `function` was changed
+    pub fn run_on_function(
+        &mut self,
+        function: &FunctionData<'g>,
+        global_state: &'g GlobalState<'g>,
+    ) -> bool {
+        let mut changed = false;
+        for _ in 0..self.max_iteration_count {
+            let mut changed_this_iteration = false;
+            for pass in &mut self.passes {
+                changed_this_iteration |= pass.run(function, global_state);
+            }
+            if !changed_this_iteration {
+                break;
+            }
+            changed = true;
+        }
+        changed
+    }
+    /// run the passes on every function in `module`, returning `true` if anything was changed
+    pub fn run_on_module(
+        &mut self,
+        module: &Module<'g>,
+        global_state: &'g GlobalState<'g>,
+    ) -> bool {
+        let mut changed = false;
+        for function in &module.functions {
+            changed |= self.run_on_function(function, global_state);
+        }
+        changed
+    }
+}
+
+/// the body of the block or loop that `instruction` is, if any
+fn get_nested_block<'g>(instruction: &InstructionData<'g>) -> Option<IdRef<'g, BlockData<'g>>> {
+    match instruction {
+        InstructionData::Block(block) => Some(block.value()),
+        InstructionData::Loop(loop_) => Some(loop_.value().body.value()),
+        _ => None,
+    }
+}
+
+/// calls `f` on every value used by `instruction`, not including instructions nested in it
+fn for_each_value_use<'g>(instruction: &InstructionData<'g>, f: &mut impl FnMut(&ValueUse<'g>)) {
+    match instruction {
+        InstructionData::Branch(branch) => {
+            f(&branch.variable);
+            for target in &branch.targets {
+                target.break_block.block_results.iter().for_each(&mut *f);
+            }
+        }
+        _ => instruction.arguments().iter().for_each(f),
+    }
+}
+
+/// calls `f` on every value used by `instruction` that can be changed, not including
+/// instructions nested in it. The arguments of a `Loop` can't be changed.
+fn for_each_value_use_mut<'g>(
+    instruction: &mut InstructionData<'g>,
+    f: &mut impl FnMut(&mut ValueUse<'g>),
+) {
+    match instruction {
+        InstructionData::Add(add) => add.arguments.iter_mut().for_each(f),
+        InstructionData::Load(load) => load.arguments.iter_mut().for_each(f),
+        InstructionData::BreakBlock(break_block) => {
+            break_block.block_results.iter_mut().for_each(f)
+        }
+        InstructionData::Branch(branch) => {
+            f(&mut branch.variable);
+            for target in &mut branch.targets {
+                target
+                    .break_block
+                    .block_results
+                    .iter_mut()
+                    .for_each(&mut *f);
+            }
+        }
+        InstructionData::ContinueLoop(continue_loop) => {
+            continue_loop.loop_arguments.iter_mut().for_each(f)
+        }
+        InstructionData::Block(_) | InstructionData::Loop(_) => {}
+    }
+}
+
+/// the values to replace, and what to replace them with
+#[derive(Default)]
+struct ValueReplacements<'g> {
+    replacements: HashMap<IdRef<'g, Value<'g>>, IdRef<'g, Value<'g>>>,
+}
+
+impl<'g> ValueReplacements<'g> {
+    fn is_empty(&self) -> bool {
+        self.replacements.is_empty()
+    }
+    fn insert(&mut self, value: IdRef<'g, Value<'g>>, replacement: IdRef<'g, Value<'g>>) {
+        let replacement = self.get(replacement);
+        if value != replacement {
+            self.replacements.insert(value, replacement);
+        }
+    }
+    /// what `value` is replaced with, following replacements that are themselves replaced
+    fn get(&self, mut value: IdRef<'g, Value<'g>>) -> IdRef<'g, Value<'g>> {
+        while let Some(&replacement) = self.replacements.get(&value) {
+            value = replacement;
+        }
+        value
+    }
+    /// replace the uses in `block` and the blocks nested in it, returning `true` if any were
+    /// replaced
+    fn apply(&self, block: &BlockData<'g>) -> bool {
+        let mut changed = false;
+        let mut body = block.body.borrow_mut();
+        for instruction in body.iter_mut().flatten() {
+            for_each_value_use_mut(&mut instruction.data, &mut |value_use| {
+                let replacement = self.get(value_use.value());
+                if replacement != value_use.value() {
+                    *value_use = ValueUse::new(replacement);
+                    changed = true;
+                }
+            });
+            if let Some(nested_block) = get_nested_block(&instruction.data) {
+                changed |= self.apply(&nested_block);
+            }
+        }
+        changed
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use alloc::string::ToString;
+
+    macro_rules! test_passes {
+        ($text:expr, $optimized_text:expr) => {{
+            let global_state = GlobalState::new();
+            let global_state = &global_state;
+            let function = Function::parse("", $text, global_state).unwrap();
+            let mut pass_manager = PassManager::with_default_passes();
+            pass_manager.run_on_function(&function, global_state);
+            assert_eq!($optimized_text, function.display().to_string());
+            // running the passes again shouldn't change anything
+            assert!(!pass_manager.run_on_function(&function, global_state));
+        }};
+    }
+
+    #[test]
+    fn test_constant_folding() {
+        test_passes!(
+            concat!(
+                "fn function1[] -> [i32] {\n",
+                "    hints {\n",
+                "        inlining_hint: none,\n",
+                "        side_effects: normal,\n",
+                "    }\n",
+                "    {\n",
+                "    }\n",
+                "    block1 {\n",
+                "        add [\"\"0: 0x1i32, \"\"1: 0x2i32] -> [a: i32];\n",
+                "        add [a, \"\"2: 0x3i32] -> [b: i32];\n",
+                "        break block1[b];\n",
+                "    }\n",
+                "}"
+            ),
+            concat!(
+                "fn function1[] -> [i32] {\n",
+                "    hints {\n",
+                "        inlining_hint: none,\n",
+                "        side_effects: normal,\n",
+                "    }\n",
+                "    {\n",
+                "    }\n",
+                "    block1 {\n",
+                "        break block1[b: 0x6i32];\n",
+                "    }\n",
+                "}"
+            )
+        );
+    }
+
+    #[test]
+    fn test_common_subexpression_elimination() {
+        test_passes!(
+            concat!(
+                "fn function1[x: i32, y: i32] -> [i32] {\n",
+                "    hints {\n",
+                "        inlining_hint: none,\n",
+                "        side_effects: normal,\n",
+                "    }\n",
+                "    {\n",
+                "    }\n",
+                "    block1 {\n",
+                "        add [x, y] -> [a: i32];\n",
+                "        add [y, x] -> [b: i32];\n",
+                "        add [a, b] -> [c: i32];\n",
+                "        break block1[c];\n",
+                "    }\n",
+                "}"
+            ),
+            concat!(
+                "fn function1[x: i32, y: i32] -> [i32] {\n",
+                "    hints {\n",
+                "        inlining_hint: none,\n",
+                "        side_effects: normal,\n",
+                "    }\n",
+                "    {\n",
+                "    }\n",
+                "    block1 {\n",
+                "        add [x, y] -> [a: i32];\n",
+                "        add [a, a] -> [c: i32];\n",
+                "        break block1[c];\n",
+                "    }\n",
+                "}"
+            )
+        );
+    }
+
+    #[test]
+    fn test_copy_propagation() {
+        test_passes!(
+            concat!(
+                "fn function1[x: i32, y: i32] -> [i32] {\n",
+                "    hints {\n",
+                "        inlining_hint: none,\n",
+                "        side_effects: normal,\n",
+                "    }\n",
+                "    {\n",
+                "    }\n",
+                "    block1 {\n",
+                "        block block2 -> [a: i32] {\n",
+                "            break block2[x];\n",
+                "        };\n",
+                "        loop loop1[y] -> [b: i32] {\n",
+                "            -> [c: i32];\n",
+                "            block3 {\n",
+                "                add [a, c] -> [d: i32];\n",
+                "                branch [d], {\n",
+                "                    0x0i32 -> break block3[c];\n",
+                "                } -> [];\n",
+                "                continue loop1[c];\n",
+                "            }\n",
+                "        };\n",
+                "        break block1[b];\n",
+                "    }\n",
+                "}"
+            ),
+            concat!(
+                "fn function1[x: i32, y: i32] -> [i32] {\n",
+                "    hints {\n",
+                "        inlining_hint: none,\n",
+                "        side_effects: normal,\n",
+                "    }\n",
+                "    {\n",
+                "    }\n",
+                "    block1 {\n",
+                "        block block2 -> [a: i32] {\n",
+                "            break block2[x];\n",
+                "        };\n",
+                "        loop loop1[y] -> [b: i32] {\n",
+                "            -> [c: i32];\n",
+                "            block3 {\n",
+                "                add [x, y] -> [d: i32];\n",
+                "                branch [d], {\n",
+                "                    0x0i32 -> break block3[y];\n",
+                "                } -> [];\n",
+                "                continue loop1[y];\n",
+                "            }\n",
+                "        };\n",
+                "        break block1[y];\n",
+                "    }\n",
+                "}"
+            )
+        );
+    }
+}
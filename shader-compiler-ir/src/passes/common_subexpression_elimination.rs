@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+use super::{get_nested_block, FunctionPass, ValueReplacements};
+use crate::{prelude::*, BlockData, IdRef, InstructionData};
+use alloc::vec::Vec;
+use hashbrown::HashMap;
+
+/// replaces the results of instructions that compute the same thing as an earlier instruction
+/// with the earlier instruction's results. the later instructions are left for
+/// `DeadCodeElimination` to remove.
+///
+/// `Load`s aren't replaced, since memory may be written in between.
+#[derive(Copy, Clone, Default, Debug)]
+pub struct CommonSubexpressionElimination;
+
+type AddKey<'g> = (
+    IdRef<'g, Value<'g>>,
+    IdRef<'g, Value<'g>>,
+    Interned<'g, Type<'g>>,
+);
+
+#[derive(Default)]
+struct State<'g> {
+    /// the results of the `Add`s that are visible in the current block
+    adds: HashMap<AddKey<'g>, IdRef<'g, Value<'g>>>,
+    replacements: ValueReplacements<'g>,
+}
+
+impl<'g> State<'g> {
+    fn visit_block(&mut self, block: &BlockData<'g>) {
+        // values defined in a block aren't visible after the block
+        let mut added_keys = Vec::new();
+        for instruction in block.body.borrow().iter().flatten() {
+            if let InstructionData::Add(add) = &instruction.data {
+                let [lhs, rhs] = &add.arguments;
+                let [result] = &add.results;
+                let lhs = self.replacements.get(lhs.value());
+                let rhs = self.replacements.get(rhs.value());
+                let value_type = result.value_type;
+                // `Add` is commutative
+                let existing = self
+                    .adds
+                    .get(&(lhs, rhs, value_type))
+                    .or_else(|| self.adds.get(&(rhs, lhs, value_type)))
+                    .copied();
+                match existing {
+                    Some(existing) => self.replacements.insert(result.value(), existing),
+                    None => {
+                        self.adds.insert((lhs, rhs, value_type), result.value());
+                        added_keys.push((lhs, rhs, value_type));
+                    }
+                }
+            }
+            if let Some(nested_block) = get_nested_block(&instruction.data) {
+                self.visit_block(&nested_block);
+            }
+        }
+        for key in added_keys {
+            self.adds.remove(&key);
+        }
+    }
+}
+
+impl<'g> FunctionPass<'g> for CommonSubexpressionElimination {
+    fn name(&self) -> &'static str {
+        "common_subexpression_elimination"
+    }
+    fn run(&mut self, function: &FunctionData<'g>, _global_state: &'g GlobalState<'g>) -> bool {
+        let mut state = State::default();
+        state.visit_block(&function.body);
+        !state.replacements.is_empty() && state.replacements.apply(&function.body)
+    }
+}
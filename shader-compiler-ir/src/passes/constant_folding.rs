@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+use super::{get_nested_block, FunctionPass, ValueReplacements};
+use crate::{prelude::*, BlockData, ConstInteger, InstructionData, RelaxedInt32};
+
+/// replaces the results of instructions that only have constant arguments with constants.
+/// the instructions are left for `DeadCodeElimination` to remove.
+#[derive(Copy, Clone, Default, Debug)]
+pub struct ConstantFolding;
+
+fn fold_add<'g>(lhs: &Const<'g>, rhs: &Const<'g>) -> Option<Const<'g>> {
+    let (lhs, rhs) = match (lhs, rhs) {
+        (Const::Integer(lhs), Const::Integer(rhs)) => (*lhs, *rhs),
+        // floats aren't folded, since the target's rounding and denormal modes aren't known
+        _ => return None,
+    };
+    let sum = match (lhs, rhs) {
+        (ConstInteger::Int8(lhs), ConstInteger::Int8(rhs)) => {
+            ConstInteger::Int8(lhs.wrapping_add(rhs))
+        }
+        (ConstInteger::Int16(lhs), ConstInteger::Int16(rhs)) => {
+            ConstInteger::Int16(lhs.wrapping_add(rhs))
+        }
+        (ConstInteger::Int32(lhs), ConstInteger::Int32(rhs)) => {
+            ConstInteger::Int32(lhs.wrapping_add(rhs))
+        }
+        (ConstInteger::RelaxedInt32(lhs), ConstInteger::RelaxedInt32(rhs)) => {
+            // computing all 32 bits is a valid implementation of a relaxed precision add
+            ConstInteger::RelaxedInt32(RelaxedInt32(lhs.0.wrapping_add(rhs.0)))
+        }
+        (ConstInteger::Int64(lhs), ConstInteger::Int64(rhs)) => {
+            ConstInteger::Int64(lhs.wrapping_add(rhs))
+        }
+        _ => return None,
+    };
+    Some(Const::Integer(sum))
+}
+
+fn fold_block<'g>(
+    block: &BlockData<'g>,
+    replacements: &mut ValueReplacements<'g>,
+    global_state: &'g GlobalState<'g>,
+) {
+    for instruction in block.body.borrow().iter().flatten() {
+        if let InstructionData::Add(add) = &instruction.data {
+            let [lhs, rhs] = &add.arguments;
+            let [result] = &add.results;
+            let sum = match (
+                replacements.get(lhs.value()).const_value(),
+                replacements.get(rhs.value()).const_value(),
+            ) {
+                (Some(lhs), Some(rhs)) => fold_add(&lhs, &rhs),
+                _ => None,
+            };
+            if let Some(sum) = sum {
+                let sum = sum.intern(global_state);
+                if sum.get().get_type(global_state) == result.value_type {
+                    let sum = Value::from_const(sum, result.name, global_state);
+                    replacements.insert(result.value(), sum);
+                }
+            }
+        }
+        if let Some(nested_block) = get_nested_block(&instruction.data) {
+            fold_block(&nested_block, replacements, global_state);
+        }
+    }
+}
+
+impl<'g> FunctionPass<'g> for ConstantFolding {
+    fn name(&self) -> &'static str {
+        "constant_folding"
+    }
+    fn run(&mut self, function: &FunctionData<'g>, global_state: &'g GlobalState<'g>) -> bool {
+        let mut replacements = ValueReplacements::default();
+        fold_block(&function.body, &mut replacements, global_state);
+        !replacements.is_empty() && replacements.apply(&function.body)
+    }
+}
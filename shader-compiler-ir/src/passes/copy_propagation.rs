@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+use super::{FunctionPass, ValueReplacements};
+use crate::{prelude::*, BlockData, BreakBlock, IdRef, InstructionData, LoopData};
+use alloc::vec::Vec;
+use hashbrown::HashMap;
+
+/// replaces values that are always copies of another value with that value:
+///
+/// * the results of a block that's only broken out of in one place are copies of the values
+///   passed there, if those are visible after the block.
+/// * the arguments of a loop that every `ContinueLoop` passes back unchanged are copies of the
+///   values the loop was started with.
+#[derive(Copy, Clone, Default, Debug)]
+pub struct CopyPropagation;
+
+#[derive(Default)]
+struct State<'g> {
+    /// how many blocks each value's definition is nested in; function arguments and the
+    /// values defined outside of functions aren't included
+    definition_depths: HashMap<IdRef<'g, Value<'g>>, usize>,
+    /// the blocks that can be broken out of, and loop bodies, along with how many blocks the
+    /// block or loop is nested in
+    blocks: Vec<(IdRef<'g, BlockData<'g>>, usize)>,
+    loops: Vec<IdRef<'g, LoopData<'g>>>,
+    /// the values passed by every `BreakBlock`, grouped by the block they break out of
+    breaks: HashMap<IdRef<'g, BlockData<'g>>, Vec<Vec<IdRef<'g, Value<'g>>>>>,
+    /// the values passed by every `ContinueLoop`, grouped by the loop they continue
+    continues: HashMap<IdRef<'g, LoopData<'g>>, Vec<Vec<IdRef<'g, Value<'g>>>>>,
+}
+
+fn get_values<'g>(value_uses: &[ValueUse<'g>]) -> Vec<IdRef<'g, Value<'g>>> {
+    value_uses
+        .iter()
+        .map(|value_use| value_use.value())
+        .collect()
+}
+
+impl<'g> State<'g> {
+    fn add_definitions(&mut self, definitions: &[ValueDefinition<'g>], depth: usize) {
+        for definition in definitions {
+            self.definition_depths.insert(definition.value(), depth);
+        }
+    }
+    fn add_break(&mut self, break_block: &BreakBlock<'g>) {
+        self.breaks
+            .entry(break_block.block.value())
+            .or_insert_with(Vec::new)
+            .push(get_values(&break_block.block_results));
+    }
+    fn visit_block(&mut self, block: &BlockData<'g>, depth: usize) {
+        for instruction in block.body.borrow().iter().flatten() {
+            match &instruction.data {
+                InstructionData::Add(add) => self.add_definitions(&add.results, depth),
+                InstructionData::Load(load) => self.add_definitions(&load.results, depth),
+                InstructionData::BreakBlock(break_block) => self.add_break(break_block),
+                InstructionData::Branch(branch) => {
+                    for target in &branch.targets {
+                        self.add_break(&target.break_block);
+                    }
+                }
+                InstructionData::ContinueLoop(continue_loop) => self
+                    .continues
+                    .entry(continue_loop.target_loop.value())
+                    .or_insert_with(Vec::new)
+                    .push(get_values(&continue_loop.loop_arguments)),
+                InstructionData::Block(block) => {
+                    if let Inhabited(results) = block.results() {
+                        self.add_definitions(results, depth);
+                    }
+                    self.blocks.push((block.value(), depth));
+                    self.visit_block(block, depth + 1);
+                }
+                InstructionData::Loop(loop_) => {
+                    if let Inhabited(results) = loop_.results() {
+                        self.add_definitions(results, depth);
+                    }
+                    self.add_definitions(&loop_.header.argument_definitions, depth + 1);
+                    self.blocks.push((loop_.body.value(), depth));
+                    self.loops.push(loop_.value());
+                    self.visit_block(&loop_.body, depth + 1);
+                }
+            }
+        }
+    }
+    /// if `value` can be used after a block nested in `depth` blocks
+    fn is_visible_outside(&self, value: IdRef<'g, Value<'g>>, depth: usize) -> bool {
+        value.const_value().is_some()
+            || self
+                .definition_depths
+                .get(&value)
+                .map_or(true, |&definition_depth| definition_depth <= depth)
+    }
+    fn get_replacements(&self) -> ValueReplacements<'g> {
+        let mut replacements = ValueReplacements::default();
+        for &(block, depth) in &self.blocks {
+            let results = match block.results() {
+                Inhabited(results) => results,
+                Uninhabited => continue,
+            };
+            if let Some([block_results]) = self.breaks.get(&block).map(|v| &**v) {
+                for (result, &value) in results.iter().zip(block_results) {
+                    let value = replacements.get(value);
+                    if self.is_visible_outside(value, depth) {
+                        replacements.insert(result.value(), value);
+                    }
+                }
+            }
+        }
+        for &loop_ in &self.loops {
+            let continues = self.continues.get(&loop_).map_or(&[][..], |v| &**v);
+            for (index, (definition, initial_value)) in loop_
+                .header
+                .argument_definitions
+                .iter()
+                .zip(&loop_.arguments)
+                .enumerate()
+            {
+                let argument = definition.value();
+                let initial_value = replacements.get(initial_value.value());
+                let is_copy = continues.iter().all(|loop_arguments| {
+                    let value = replacements.get(loop_arguments[index]);
+                    value == argument || value == initial_value
+                });
+                if is_copy {
+                    replacements.insert(argument, initial_value);
+                }
+            }
+        }
+        replacements
+    }
+}
+
+impl<'g> FunctionPass<'g> for CopyPropagation {
+    fn name(&self) -> &'static str {
+        "copy_propagation"
+    }
+    fn run(&mut self, function: &FunctionData<'g>, _global_state: &'g GlobalState<'g>) -> bool {
+        let mut state = State::default();
+        state.visit_block(&function.body, 0);
+        let replacements = state.get_replacements();
+        !replacements.is_empty() && replacements.apply(&function.body)
+    }
+}
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+use super::{for_each_value_use, get_nested_block, FunctionPass};
+use crate::{prelude::*, BlockData, IdRef, InstructionData};
+use hashbrown::HashSet;
+
+/// removes instructions without side effects whose results aren't used
+#[derive(Copy, Clone, Default, Debug)]
+pub struct DeadCodeElimination;
+
+fn find_used_values<'g>(block: &BlockData<'g>, used_values: &mut HashSet<IdRef<'g, Value<'g>>>) {
+    for instruction in block.body.borrow().iter().flatten() {
+        for_each_value_use(&instruction.data, &mut |value_use| {
+            used_values.insert(value_use.value());
+        });
+        if let Some(nested_block) = get_nested_block(&instruction.data) {
+            find_used_values(&nested_block, used_values);
+        }
+    }
+}
+
+fn is_dead<'g>(
+    instruction: &InstructionData<'g>,
+    used_values: &HashSet<IdRef<'g, Value<'g>>>,
+) -> bool {
+    let results = match instruction {
+        InstructionData::Add(add) => &add.results[..],
+        InstructionData::Load(load) => &load.results[..],
+        // control flow is never removed
+        _ => return false,
+    };
+    results
+        .iter()
+        .all(|result| !used_values.contains(&result.value()))
+}
+
+fn remove_dead_instructions<'g>(
+    block: &BlockData<'g>,
+    used_values: &HashSet<IdRef<'g, Value<'g>>>,
+) -> bool {
+    let mut changed = false;
+    if let Some(body) = &mut *block.body.borrow_mut() {
+        for instruction in body.iter() {
+            if let Some(nested_block) = get_nested_block(&instruction.data) {
+                changed |= remove_dead_instructions(&nested_block, used_values);
+            }
+        }
+        let old_len = body.len();
+        body.retain(|instruction| !is_dead(&instruction.data, used_values));
+        changed |= body.len() != old_len;
+    }
+    changed
+}
+
+impl<'g> FunctionPass<'g> for DeadCodeElimination {
+    fn name(&self) -> &'static str {
+        "dead_code_elimination"
+    }
+    fn run(&mut self, function: &FunctionData<'g>, _global_state: &'g GlobalState<'g>) -> bool {
+        let mut changed = false;
+        // removing an instruction can make the instructions it uses dead too, so repeat until
+        // nothing else is removed
+        loop {
+            let mut used_values = HashSet::new();
+            find_used_values(&function.body, &mut used_values);
+            if !remove_dead_instructions(&function.body, &used_values) {
+                break;
+            }
+            changed = true;
+        }
+        changed
+    }
+}
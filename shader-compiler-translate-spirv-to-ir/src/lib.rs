@@ -35,7 +35,7 @@ macro_rules! decl_specialization_resolver {
     (
         $(
             $(#[doc = $doc:expr])+
-            $fn_name:ident -> $ty:ty;
+            $fn_name:ident -> $ty:ty = |$bytes:ident: [u8; $size:expr]| $from_bytes:expr;
         )+
     ) => {
         pub trait SpecializationResolver {
@@ -60,39 +60,87 @@ macro_rules! decl_specialization_resolver {
                 }
             )+
         }
+
+        impl SpecializationResolver for SpecializationMapResolver<'_> {
+            $(
+                fn $fn_name(
+                    &mut self,
+                    unresolved_specialization: UnresolvedSpecialization,
+                    default: $ty,
+                ) -> Result<$ty, SpecializationResolutionFailed> {
+                    let bytes = match self.get(unresolved_specialization) {
+                        Some(bytes) => bytes,
+                        None => return Ok(default),
+                    };
+                    let mut $bytes = [0u8; $size];
+                    if bytes.len() != $bytes.len() {
+                        return Err(SpecializationResolutionFailed);
+                    }
+                    $bytes.copy_from_slice(bytes);
+                    Ok($from_bytes)
+                }
+            )+
+        }
     };
 }
 
 decl_specialization_resolver! {
     /// resolve a boolean specialization constant
-    resolve_bool -> bool;
+    resolve_bool -> bool = |bytes: [u8; 4]| u32::from_le_bytes(bytes) != 0;
     /// resolve an unsigned 8-bit integer specialization constant
-    resolve_u8 -> u8;
+    resolve_u8 -> u8 = |bytes: [u8; 1]| u8::from_le_bytes(bytes);
     /// resolve a signed 8-bit integer specialization constant
-    resolve_i8 -> i8;
+    resolve_i8 -> i8 = |bytes: [u8; 1]| i8::from_le_bytes(bytes);
     /// resolve an unsigned 16-bit integer specialization constant
-    resolve_u16 -> u16;
+    resolve_u16 -> u16 = |bytes: [u8; 2]| u16::from_le_bytes(bytes);
     /// resolve a signed 16-bit integer specialization constant
-    resolve_i16 -> i16;
+    resolve_i16 -> i16 = |bytes: [u8; 2]| i16::from_le_bytes(bytes);
     /// resolve an unsigned 32-bit integer specialization constant
-    resolve_u32 -> u32;
+    resolve_u32 -> u32 = |bytes: [u8; 4]| u32::from_le_bytes(bytes);
     /// resolve a signed 32-bit integer specialization constant
-    resolve_i32 -> i32;
+    resolve_i32 -> i32 = |bytes: [u8; 4]| i32::from_le_bytes(bytes);
     /// resolve an unsigned 64-bit integer specialization constant
-    resolve_u64 -> u64;
+    resolve_u64 -> u64 = |bytes: [u8; 8]| u64::from_le_bytes(bytes);
     /// resolve a signed 64-bit integer specialization constant
-    resolve_i64 -> i64;
+    resolve_i64 -> i64 = |bytes: [u8; 8]| i64::from_le_bytes(bytes);
     /// resolve a 16-bit float specialization constant
-    resolve_f16 -> shader_compiler_ir::Float16;
+    resolve_f16 -> shader_compiler_ir::Float16 =
+        |bytes: [u8; 2]| shader_compiler_ir::Float16(u16::from_le_bytes(bytes));
     /// resolve a 32-bit float specialization constant
-    resolve_f32 -> shader_compiler_ir::Float32;
+    resolve_f32 -> shader_compiler_ir::Float32 =
+        |bytes: [u8; 4]| shader_compiler_ir::Float32(u32::from_le_bytes(bytes));
     /// resolve a 64-bit float specialization constant
-    resolve_f64 -> shader_compiler_ir::Float64;
+    resolve_f64 -> shader_compiler_ir::Float64 =
+        |bytes: [u8; 8]| shader_compiler_ir::Float64(u64::from_le_bytes(bytes));
 }
 
 #[derive(Default)]
 pub struct DefaultSpecializationResolver;
 
+/// the value of one specialization constant, like `VkSpecializationMapEntry`
+#[derive(Copy, Clone, Debug)]
+pub struct SpecializationMapEntry<'a> {
+    pub constant_id: u32,
+    /// little-endian; booleans are 4 bytes, like `VkBool32`
+    pub bytes: &'a [u8],
+}
+
+/// resolves specialization constants to the values in `entries`, so they are folded into the
+/// translated code; constants without an entry keep their default values
+#[derive(Copy, Clone, Debug, Default)]
+pub struct SpecializationMapResolver<'a> {
+    pub entries: &'a [SpecializationMapEntry<'a>],
+}
+
+impl<'a> SpecializationMapResolver<'a> {
+    fn get(&self, unresolved_specialization: UnresolvedSpecialization) -> Option<&'a [u8]> {
+        self.entries
+            .iter()
+            .find(|entry| entry.constant_id == unresolved_specialization.constant_id)
+            .map(|entry| entry.bytes)
+    }
+}
+
 #[derive(Clone)]
 struct SPIRVInstructionLocation<'i> {
     instruction_index: usize,
@@ -229,6 +277,27 @@ mod tests {
         }
     }
 
+    #[test]
+    fn specialization_map_resolver_test() {
+        use crate::{SpecializationResolver, UnresolvedSpecialization};
+        let entries = [
+            crate::SpecializationMapEntry {
+                constant_id: 1,
+                bytes: &[1, 0, 0, 0],
+            },
+            crate::SpecializationMapEntry {
+                constant_id: 2,
+                bytes: &[0xFE, 0xFF],
+            },
+        ];
+        let mut resolver = crate::SpecializationMapResolver { entries: &entries };
+        let constant = |constant_id| UnresolvedSpecialization { constant_id };
+        assert!(resolver.resolve_bool(constant(1), false).unwrap());
+        assert_eq!(resolver.resolve_i16(constant(2), 0).unwrap(), -2);
+        assert_eq!(resolver.resolve_u32(constant(3), 5).unwrap(), 5);
+        assert!(resolver.resolve_u32(constant(2), 0).is_err());
+    }
+
     #[test]
     fn trivial_test() {
         let spirv_code = convert_bytes_to_words(include_bytes!(concat!(
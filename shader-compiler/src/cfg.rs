@@ -9,6 +9,7 @@ use petgraph::{algo::dominators, graph::IndexType, prelude::*};
 use spirv_parser::{IdRef, Instruction};
 use std::collections::{HashMap, HashSet};
 use std::fmt;
+use std::mem;
 use std::ops;
 
 pub struct CFGNodeIndexDisplay<'a> {
@@ -286,39 +287,66 @@ impl CFG {
         &self[self.get_node_index_by_label(label_id)]
     }
     pub fn new(function_instructions: &[Instruction]) -> CFG {
-        assert!(!function_instructions.is_empty());
-        let mut graph = CFGGraph::default();
-        let mut current_label = None;
-        let mut current_instructions = Vec::new();
-        let mut label_to_node_index_map = HashMap::new();
+        let mut builder = CFGBuilder::default();
         for instruction in function_instructions {
-            if current_label.is_none() {
-                if let Instruction::Label { id_result } = instruction {
-                    current_label = Some(id_result.0);
-                } else {
-                    assert!(
-                        InstructionProperties::new(instruction).is_debug_line(),
-                        "invalid instruction before OpLabel"
-                    );
-                }
-                current_instructions.push(instruction.clone());
+            builder.push(instruction.clone());
+        }
+        builder.finish()
+    }
+}
+
+/// builds a `CFG` from the instructions of a function body as they are parsed, so the body
+/// doesn't have to be collected into a list first
+#[derive(Default)]
+pub struct CFGBuilder {
+    graph: CFGGraph,
+    current_label: Option<IdRef>,
+    current_instructions: Vec<Instruction>,
+    label_to_node_index_map: HashMap<IdRef, CFGNodeIndex>,
+}
+
+impl CFGBuilder {
+    pub fn is_empty(&self) -> bool {
+        self.graph.node_count() == 0 && self.current_instructions.is_empty()
+    }
+    pub fn push(&mut self, instruction: Instruction) {
+        if self.current_label.is_none() {
+            if let Instruction::Label { id_result } = &instruction {
+                self.current_label = Some(id_result.0);
             } else {
-                current_instructions.push(instruction.clone());
-                if InstructionProperties::new(instruction).is_block_terminator() {
-                    let label = current_label.take().unwrap();
-                    label_to_node_index_map.insert(
-                        label,
-                        graph.add_node(BasicBlock {
-                            label,
-                            instructions: Instructions::new(current_instructions),
-                            parent_structure_tree_node_and_index: Default::default(),
-                        }),
-                    );
-                    current_instructions = Vec::new();
-                }
+                assert!(
+                    InstructionProperties::new(&instruction).is_debug_line(),
+                    "invalid instruction before OpLabel"
+                );
+            }
+            self.current_instructions.push(instruction);
+        } else {
+            let is_block_terminator =
+                InstructionProperties::new(&instruction).is_block_terminator();
+            self.current_instructions.push(instruction);
+            if is_block_terminator {
+                let label = self.current_label.take().unwrap();
+                let node_index = self.graph.add_node(BasicBlock {
+                    label,
+                    instructions: Instructions::new(mem::replace(
+                        &mut self.current_instructions,
+                        Vec::new(),
+                    )),
+                    parent_structure_tree_node_and_index: Default::default(),
+                });
+                self.label_to_node_index_map.insert(label, node_index);
             }
         }
-        assert!(current_instructions.is_empty());
+    }
+    pub fn finish(self) -> CFG {
+        let CFGBuilder {
+            mut graph,
+            current_label: _,
+            current_instructions,
+            label_to_node_index_map,
+        } = self;
+        assert!(graph.node_count() != 0, "function has no blocks");
+        assert!(current_instructions.is_empty(), "missing block terminator");
         let entry_node_index = graph.node_indices().next().unwrap();
         let mut successors_set = HashSet::new();
         for node_index in graph.node_indices() {
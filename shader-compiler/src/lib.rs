@@ -15,9 +15,11 @@ use shader_compiler_backend::Module;
 use spirv_parser::{BuiltIn, Decoration, ExecutionMode, ExecutionModel, IdRef, Instruction};
 use std::cell::RefCell;
 use std::collections::HashSet;
+use std::ffi::c_void;
 use std::fmt;
 use std::hash::{Hash, Hasher};
 use std::iter;
+use std::mem;
 use std::ops::{Index, IndexMut};
 use std::rc::Rc;
 
@@ -295,6 +297,59 @@ impl FrontendType {
             unreachable!("not a vector type")
         }
     }
+    /// the size and alignment in bytes of variables without an explicit layout, such as
+    /// `Workgroup` variables
+    pub fn get_size_and_alignment(&self) -> (usize, usize) {
+        fn align(offset: usize, alignment: usize) -> usize {
+            (offset + alignment - 1) / alignment * alignment
+        }
+        fn get_scalar_size(scalar: &ScalarType) -> usize {
+            match scalar {
+                ScalarType::Bool | ScalarType::I8 | ScalarType::U8 => 1,
+                ScalarType::I16 | ScalarType::U16 | ScalarType::F16 => 2,
+                ScalarType::I32 | ScalarType::U32 | ScalarType::F32 => 4,
+                ScalarType::I64 | ScalarType::U64 | ScalarType::F64 => 8,
+                ScalarType::Pointer(_) => mem::size_of::<usize>(),
+            }
+        }
+        match self {
+            FrontendType::Scalar(scalar) => {
+                let size = get_scalar_size(scalar);
+                (size, size)
+            }
+            FrontendType::Vector(VectorType {
+                element,
+                element_count,
+            }) => {
+                // vec3 is padded to the size of vec4
+                let size = get_scalar_size(element) * element_count.next_power_of_two();
+                (size, size)
+            }
+            FrontendType::Array(ArrayType {
+                element,
+                element_count,
+                ..
+            }) => {
+                let element_count = element_count.expect("runtime array has no size");
+                let (element_size, element_alignment) = element.get_size_and_alignment();
+                (
+                    align(element_size, element_alignment) * element_count,
+                    element_alignment,
+                )
+            }
+            FrontendType::Struct(StructType { members, .. }) => {
+                let mut size = 0;
+                let mut alignment = 1;
+                for member in members {
+                    let (member_size, member_alignment) =
+                        member.member_type.get_size_and_alignment();
+                    size = align(size, member_alignment) + member_size;
+                    alignment = alignment.max(member_alignment);
+                }
+                (align(size, alignment), alignment)
+            }
+        }
+    }
 }
 
 /// value that can be either defined or undefined
@@ -519,6 +574,14 @@ struct UniformVariable {
     variable_type: Rc<FrontendType>,
 }
 
+#[derive(Debug, Clone)]
+struct WorkgroupVariable {
+    /// offset in `ComputeDispatchInfo::workgroup_memory_size` bytes of memory shared by the
+    /// invocations in a workgroup
+    offset: usize,
+    variable_type: Rc<FrontendType>,
+}
+
 #[derive(Copy, Clone, Eq, PartialEq, Hash, Debug)]
 enum CrossLaneBehavior {
     Uniform,
@@ -546,6 +609,7 @@ enum IdKind<'a, C: shader_compiler_backend::Context<'a>> {
     BuiltInVariable(BuiltInVariable),
     Constant(Rc<Constant>),
     UniformVariable(UniformVariable),
+    WorkgroupVariable(WorkgroupVariable),
     Function(Option<ParsedShaderFunction>),
     BasicBlock {
         basic_block: C::BasicBlock,
@@ -659,17 +723,26 @@ impl<'a, C: shader_compiler_backend::Context<'a>> IndexMut<IdRef> for Ids<'a, C>
     }
 }
 
+/// the body is split into basic blocks while it's parsed, so it's not kept as a separate list
 struct ParsedShaderFunction {
-    instructions: Vec<Instruction>,
+    function_instruction: Instruction,
+    parameter_instructions: Vec<Instruction>,
+    cfg: cfg::CFG,
     decorations: Vec<Decoration>,
 }
 
 impl fmt::Debug for ParsedShaderFunction {
     fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
         writeln!(f, "ParsedShaderFunction:")?;
-        for instruction in &self.instructions {
+        write!(f, "{}", self.function_instruction)?;
+        for instruction in &self.parameter_instructions {
             write!(f, "{}", instruction)?;
         }
+        for node_index in self.cfg.node_indices() {
+            for instruction in self.cfg[node_index].instructions().iter() {
+                write!(f, "{}", instruction)?;
+            }
+        }
         Ok(())
     }
 }
@@ -681,6 +754,8 @@ struct ParsedShader<'a, C: shader_compiler_backend::Context<'a>> {
     interface_variables: Vec<IdRef>,
     execution_modes: Vec<ExecutionMode>,
     workgroup_size: Option<(u32, u32, u32)>,
+    workgroup_memory_size: usize,
+    has_control_barriers: bool,
 }
 
 struct ShaderEntryPoint {
@@ -689,21 +764,46 @@ struct ShaderEntryPoint {
 }
 
 impl<'a, C: shader_compiler_backend::Context<'a>> ParsedShader<'a, C> {
+    /// the instructions are taken from `unspecialized_module` instead of decoding
+    /// `stage_info.code` if it's given
     fn create(
         context: &mut Context,
         stage_info: ShaderStageCreateInfo,
+        unspecialized_module: Option<&UnspecializedShaderModule>,
         execution_model: ExecutionModel,
     ) -> Self {
-        parsed_shader_create::create(context, stage_info, execution_model)
+        parsed_shader_create::create(context, stage_info, unspecialized_module, execution_model)
     }
 }
 
-#[derive(Clone, Debug)]
+/// a SPIR-V module decoded once, with its specialization constants left unresolved, so
+/// pipelines created with other specializations of it don't decode it again
+#[derive(Debug)]
+pub struct UnspecializedShaderModule {
+    header: spirv_parser::Header,
+    instructions: Vec<Instruction>,
+}
+
+impl UnspecializedShaderModule {
+    pub fn new(code: &[u32]) -> Self {
+        kazan_trace::trace_scope!("UnspecializedShaderModule::new");
+        let parser = spirv_parser::Parser::start(code).unwrap();
+        Self {
+            header: *parser.header(),
+            instructions: parser.map(Result::unwrap).collect(),
+        }
+    }
+}
+
+#[derive(Clone, Eq, PartialEq, Hash, Debug)]
 pub struct GenericPipelineOptions {
     pub optimization_mode: shader_compiler_backend::OptimizationMode,
+    /// the number of invocations run by each call of a compiled shader, one per SIMD lane;
+    /// 1 compiles scalar code
+    pub lane_count: u32,
 }
 
-#[derive(Clone, Debug)]
+#[derive(Clone, Eq, PartialEq, Hash, Debug)]
 pub enum DescriptorLayout {
     Sampler { count: usize },
     CombinedImageSampler { count: usize },
@@ -718,32 +818,99 @@ pub enum DescriptorLayout {
     InputAttachment { count: usize },
 }
 
-#[derive(Clone, Debug)]
+#[derive(Clone, Eq, PartialEq, Hash, Debug)]
 pub struct DescriptorSetLayout {
     pub bindings: Vec<Option<DescriptorLayout>>,
 }
 
-#[derive(Clone, Debug)]
+#[derive(Clone, Eq, PartialEq, Hash, Debug)]
 pub struct PipelineLayout {
     pub push_constants_size: usize,
     pub descriptor_sets: Vec<DescriptorSetLayout>,
 }
 
+/// what's needed to dispatch a compiled compute shader; it has to be saved along with the
+/// `ObjectCode` and passed to `ComputePipeline::load`
+#[derive(Copy, Clone, Eq, PartialEq, Hash, Debug)]
+pub struct ComputeDispatchInfo {
+    pub workgroup_size: [u32; 3],
+    /// the number of invocations run by each call of the entry point
+    pub lane_count: u32,
+    /// the size of the memory shared by the invocations in a workgroup
+    pub workgroup_memory_size: usize,
+    /// if false, the calls of the entry point for a workgroup can run one after the other
+    pub has_control_barriers: bool,
+}
+
+impl ComputeDispatchInfo {
+    pub fn get_invocation_count(&self) -> usize {
+        self.workgroup_size.iter().map(|&v| v as usize).product()
+    }
+    /// the number of calls of the entry point needed to run a workgroup
+    pub fn get_call_count(&self) -> usize {
+        let lane_count = self.lane_count as usize;
+        (self.get_invocation_count() + lane_count - 1) / lane_count
+    }
+}
+
+/// a bound descriptor set as compiled shaders read it
+#[repr(C)]
+#[derive(Copy, Clone, Debug)]
+pub struct ShaderDescriptorSet {
+    /// the set's descriptors in the driver's layout, in binding order with the array elements
+    /// of each binding next to each other; null for sets that aren't bound
+    pub descriptors: *const c_void,
+    /// one per dynamic buffer descriptor, in the same order, to be added to the descriptor's
+    /// pointer when it's read; null if the set has no dynamic buffers
+    pub dynamic_offsets: *const u32,
+}
+
+/// the argument to the entry point of a compute shader, which runs `lane_count` invocations from
+/// `first_local_invocation_index` on, skipping any past the end of the workgroup
+#[repr(C)]
 #[derive(Debug)]
-pub struct ComputePipeline {}
+pub struct ComputeShaderInvocation {
+    pub workgroup_id: [u32; 3],
+    pub first_local_invocation_index: u32,
+    /// `workgroup_memory_size` bytes, aligned to at least 64 bytes
+    pub workgroup_memory: *mut u8,
+    /// one per descriptor set bound when the dispatch was recorded
+    pub descriptor_sets: *const ShaderDescriptorSet,
+    /// at least `push_constants_size` bytes from the pipeline layout, aligned to 4 bytes
+    pub push_constants: *const u8,
+    /// called with `barrier_context` for every `OpControlBarrier` executed, returning once every
+    /// other call for the same workgroup has reached the barrier
+    pub barrier: unsafe extern "C" fn(barrier_context: *mut c_void),
+    pub barrier_context: *mut c_void,
+}
 
-#[derive(Clone, Debug)]
+pub type ComputeShaderEntrypoint = unsafe extern "C" fn(invocation: &ComputeShaderInvocation);
+
+pub struct ComputePipeline {
+    compiled_code: Box<dyn shader_compiler_backend::CompiledCode<CompiledFunctionKey>>,
+    dispatch_info: ComputeDispatchInfo,
+}
+
+impl fmt::Debug for ComputePipeline {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_struct("ComputePipeline")
+            .field("dispatch_info", &self.dispatch_info)
+            .finish()
+    }
+}
+
+#[derive(Clone, Eq, PartialEq, Hash, Debug)]
 pub struct ComputePipelineOptions {
     pub generic_options: GenericPipelineOptions,
 }
 
-#[derive(Copy, Clone, Debug)]
+#[derive(Copy, Clone, Eq, PartialEq, Hash, Debug)]
 pub struct Specialization<'a> {
     pub id: u32,
     pub bytes: &'a [u8],
 }
 
-#[derive(Copy, Clone, Debug)]
+#[derive(Copy, Clone, Eq, PartialEq, Hash, Debug)]
 pub struct ShaderStageCreateInfo<'a> {
     pub code: &'a [u32],
     pub entry_point_name: &'a str,
@@ -757,10 +924,46 @@ impl ComputePipeline {
         pipeline_layout: PipelineLayout,
         backend_compiler: C,
     ) -> ComputePipeline {
+        Self::compile(
+            options,
+            compute_shader_stage,
+            None,
+            pipeline_layout,
+            backend_compiler,
+        )
+    }
+    /// like `new`, but takes the instructions from `unspecialized_module`, which must have been
+    /// created from `compute_shader_stage.code`
+    pub fn new_from_unspecialized_module<C: shader_compiler_backend::Compiler>(
+        options: &ComputePipelineOptions,
+        compute_shader_stage: ShaderStageCreateInfo,
+        unspecialized_module: &UnspecializedShaderModule,
+        pipeline_layout: PipelineLayout,
+        backend_compiler: C,
+    ) -> ComputePipeline {
+        Self::compile(
+            options,
+            compute_shader_stage,
+            Some(unspecialized_module),
+            pipeline_layout,
+            backend_compiler,
+        )
+    }
+    fn compile<C: shader_compiler_backend::Compiler>(
+        options: &ComputePipelineOptions,
+        compute_shader_stage: ShaderStageCreateInfo,
+        unspecialized_module: Option<&UnspecializedShaderModule>,
+        pipeline_layout: PipelineLayout,
+        backend_compiler: C,
+    ) -> ComputePipeline {
+        kazan_trace::trace_scope!("ComputePipeline::new");
         let mut frontend_context = Context::default();
         struct CompilerUser<'a> {
             frontend_context: Context,
             compute_shader_stage: ShaderStageCreateInfo<'a>,
+            unspecialized_module: Option<&'a UnspecializedShaderModule>,
+            lane_count: u32,
+            dispatch_info: &'a mut Option<ComputeDispatchInfo>,
         }
         #[derive(Debug)]
         enum CompileError {}
@@ -781,18 +984,45 @@ impl ComputePipeline {
                 let CompilerUser {
                     mut frontend_context,
                     compute_shader_stage,
+                    unspecialized_module,
+                    lane_count,
+                    dispatch_info,
                 } = self;
                 let parsed_shader = ParsedShader::create(
                     &mut frontend_context,
                     compute_shader_stage,
+                    unspecialized_module,
                     ExecutionModel::GLCompute,
                 );
+                let workgroup_size = parsed_shader
+                    .workgroup_size
+                    .or_else(|| {
+                        parsed_shader
+                            .execution_modes
+                            .iter()
+                            .find_map(|execution_mode| match *execution_mode {
+                                ExecutionMode::LocalSize {
+                                    x_size,
+                                    y_size,
+                                    z_size,
+                                } => Some((x_size, y_size, z_size)),
+                                _ => None,
+                            })
+                    })
+                    .expect("compute shader is missing LocalSize execution mode");
+                *dispatch_info = Some(ComputeDispatchInfo {
+                    workgroup_size: [workgroup_size.0, workgroup_size.1, workgroup_size.2],
+                    lane_count,
+                    workgroup_memory_size: parsed_shader.workgroup_memory_size,
+                    has_control_barriers: parsed_shader.has_control_barriers,
+                });
                 let mut module = backend_context.create_module("");
                 let function = parsed_shader.compile(
                     &mut frontend_context,
                     backend_context,
                     &mut module,
                     "fn_",
+                    lane_count,
                 );
                 Ok(shader_compiler_backend::CompileInputs {
                     module: module.verify().unwrap(),
@@ -804,11 +1034,15 @@ impl ComputePipeline {
                 })
             }
         }
+        let mut dispatch_info = None;
         let compile_results = backend_compiler
             .run(
                 CompilerUser {
                     frontend_context,
                     compute_shader_stage,
+                    unspecialized_module,
+                    lane_count: options.generic_options.lane_count,
+                    dispatch_info: &mut dispatch_info,
                 },
                 shader_compiler_backend::CompilerIndependentConfig {
                     optimization_mode: options.generic_options.optimization_mode,
@@ -816,6 +1050,34 @@ impl ComputePipeline {
                 .into(),
             )
             .unwrap();
-        unimplemented!()
+        ComputePipeline {
+            compiled_code: compile_results,
+            dispatch_info: dispatch_info.unwrap(),
+        }
+    }
+    /// load a `ComputePipeline` from `ObjectCode` returned by `object_code`, skipping compilation
+    pub fn load<C: shader_compiler_backend::Compiler>(
+        object_code: shader_compiler_backend::ObjectCode<CompiledFunctionKey>,
+        dispatch_info: ComputeDispatchInfo,
+        backend_compiler: C,
+    ) -> Result<ComputePipeline, shader_compiler_backend::LoadError> {
+        Ok(ComputePipeline {
+            compiled_code: backend_compiler.load(object_code)?,
+            dispatch_info,
+        })
+    }
+    pub fn object_code(&self) -> Option<&shader_compiler_backend::ObjectCode<CompiledFunctionKey>> {
+        self.compiled_code.object_code()
+    }
+    pub fn dispatch_info(&self) -> &ComputeDispatchInfo {
+        &self.dispatch_info
+    }
+    /// only valid while `self` exists
+    pub fn get_entrypoint(&self) -> ComputeShaderEntrypoint {
+        let entrypoint = self
+            .compiled_code
+            .get(&CompiledFunctionKey::ComputeShaderEntrypoint)
+            .unwrap();
+        unsafe { mem::transmute::<unsafe extern "C" fn(), ComputeShaderEntrypoint>(entrypoint) }
     }
 }
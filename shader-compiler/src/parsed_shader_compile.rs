@@ -8,7 +8,8 @@ use crate::{
 };
 use petgraph::visit::{depth_first_search, DfsEvent};
 use shader_compiler_backend::{
-    types::TypeBuilder, AttachedBuilder, BuildableBasicBlock, DetachedBuilder, Function, Module,
+    types::{TypeBuilder, VectorLength},
+    AttachedBuilder, BuildableBasicBlock, DetachedBuilder, Function, Module,
 };
 use spirv_parser::Decoration;
 use spirv_parser::{FunctionControl, IdRef, IdResult, IdResultType, Instruction};
@@ -26,6 +27,7 @@ pub(crate) trait ParsedShaderCompile<'ctx, C: shader_compiler_backend::Context<'
         backend_context: &'ctx C,
         module: &mut C::Module,
         function_name_prefix: &str,
+        lane_count: u32,
     ) -> C::Function;
 }
 
@@ -66,7 +68,7 @@ struct FunctionInstruction {
 
 struct FunctionState<'ctx, C: shader_compiler_backend::Context<'ctx>> {
     function_instruction: FunctionInstruction,
-    instructions: Vec<Instruction>,
+    cfg: CFG,
     decorations: Vec<Decoration>,
     backend_function: Cell<Option<C::Function>>,
     backend_function_value: C::Value,
@@ -96,22 +98,24 @@ impl<'ctx, 'tb, 'fnp, C: shader_compiler_backend::Context<'ctx>>
             hash_map::Entry::Vacant(v) => {
                 reachable_functions_worklist.push(function_id);
                 let ParsedShaderFunction {
-                    instructions,
+                    function_instruction,
+                    parameter_instructions: _,
+                    cfg,
                     decorations,
                 } = match &mut ids[function_id].kind {
                     IdKind::Function(function) => function.take().unwrap(),
                     _ => unreachable!("id is not a function"),
                 };
-                let function_instruction = match instructions.get(0) {
-                    Some(&Instruction::Function {
+                let function_instruction = match function_instruction {
+                    Instruction::Function {
                         id_result_type,
                         id_result,
-                        ref function_control,
+                        function_control,
                         function_type,
-                    }) => FunctionInstruction {
+                    } => FunctionInstruction {
                         id_result_type,
                         id_result,
-                        function_control: function_control.clone(),
+                        function_control,
                         function_type,
                     },
                     _ => unreachable!("missing OpFunction"),
@@ -149,7 +153,7 @@ impl<'ctx, 'tb, 'fnp, C: shader_compiler_backend::Context<'ctx>>
                 let backend_function_value = backend_function.as_value();
                 v.insert(Rc::new(FunctionState {
                     function_instruction,
-                    instructions,
+                    cfg,
                     decorations,
                     backend_function: Cell::new(Some(backend_function)),
                     backend_function_value,
@@ -166,6 +170,8 @@ where
 {
     table: HashMap<(Rc<FrontendType>, CrossLaneBehavior), Option<C::Type>>,
     type_builder: &'tb C::TypeBuilder,
+    /// nonuniform values are vectors with an element per lane when more than 1
+    lane_count: u32,
 }
 
 impl<'ctx, 'tb, C: shader_compiler_backend::Context<'ctx>> TypeCache<'ctx, 'tb, C> {
@@ -202,6 +208,15 @@ impl<'ctx, 'tb, C: shader_compiler_backend::Context<'ctx>> TypeCache<'ctx, 'tb,
             FrontendType::Scalar(ScalarType::F64) => self.type_builder.build_f64(),
             _ => unimplemented!("unimplemented type translation: {:?}", frontend_type),
         };
+        let retval = match cross_lane_behavior {
+            CrossLaneBehavior::Nonuniform if self.lane_count > 1 => self.type_builder.build_vector(
+                retval,
+                VectorLength::Fixed {
+                    length: self.lane_count,
+                },
+            ),
+            _ => retval,
+        };
         *self
             .table
             .get_mut(&(frontend_type, cross_lane_behavior))
@@ -219,18 +234,23 @@ impl<'ctx, C: shader_compiler_backend::Context<'ctx>> ParsedShaderCompile<'ctx,
         backend_context: &'ctx C,
         module: &mut C::Module,
         function_name_prefix: &str,
+        lane_count: u32,
     ) -> C::Function {
+        kazan_trace::trace_scope!("parsed_shader_compile");
         let ParsedShader {
             mut ids,
             main_function_id,
             interface_variables,
             execution_modes,
             workgroup_size,
+            workgroup_memory_size,
+            has_control_barriers,
         } = self;
         let type_builder = backend_context.create_type_builder();
         let mut type_cache = TypeCache::<'ctx, '_, C> {
             table: HashMap::new(),
             type_builder: &type_builder,
+            lane_count,
         };
         let mut reachable_functions_worklist = Vec::new();
         let mut get_or_add_function_state = GetOrAddFunctionState {
@@ -281,35 +301,12 @@ impl<'ctx, C: shader_compiler_backend::Context<'ctx>> ParsedShaderCompile<'ctx,
                     current_label: IdRef,
                 },
             }
-            let (function_instruction, instructions) = function_state
-                .instructions
-                .split_first()
-                .expect("missing OpFunction");
-            match function_instruction {
-                Instruction::Function { .. } => {}
-                _ => unreachable!("missing OpFunction"),
-            }
-            let (function_parameter_instructions, instructions) = instructions.split_at(
-                instructions
-                    .iter()
-                    .position(|v| match v {
-                        Instruction::FunctionParameter { .. } => false,
-                        _ => true,
-                    })
-                    .expect("missing OpFunctionEnd"),
-            );
-            let (function_end_instruction, instructions) =
-                instructions.split_last().expect("missing OpFunctionEnd");
-            match function_end_instruction {
-                Instruction::FunctionEnd {} => {}
-                _ => unreachable!("missing OpFunctionEnd"),
-            }
-            let cfg = CFG::new(instructions);
+            let cfg = &function_state.cfg;
             let dominators = cfg.dominators();
             let mut visit_events_queue: Vec<Vec<_>> = Vec::new();
             let mut visit_events_stack: Vec<usize> = Vec::new();
             depth_first_search(
-                &*cfg,
+                &**cfg,
                 iter::once(cfg.entry_node_index()),
                 |event| match event {
                     DfsEvent::TreeEdge(..)
@@ -1,33 +1,218 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 // See Notices.txt for copyright information
 
+use crate::cfg::CFGBuilder;
 use crate::{
     ArrayType, BuiltInVariable, Constant, Context, FrontendType, IdKind, IdProperties, Ids,
     MemberDecoration, ParsedShader, ParsedShaderFunction, PointerType, ScalarConstant, ScalarType,
-    ShaderEntryPoint, ShaderStageCreateInfo, StructId, StructMember, StructType, Undefable,
-    UniformVariable, VectorConstant, VectorType,
+    ShaderEntryPoint, ShaderStageCreateInfo, Specialization, StructId, StructMember, StructType,
+    Undefable, UniformVariable, UnspecializedShaderModule, VectorConstant, VectorType,
+    WorkgroupVariable,
+};
+use spirv_parser::{
+    BuiltIn, Decoration, ExecutionModel, IdRef, IdResultType, Instruction, StorageClass,
 };
-use spirv_parser::{BuiltIn, Decoration, ExecutionModel, IdRef, Instruction, StorageClass};
 use std::mem;
 use std::rc::Rc;
 
+/// removes the `SpecId` decoration from `id`, returning the bytes the constant is specialized
+/// to, if any
+fn take_specialization<'a, 'b, C: shader_compiler_backend::Context<'a>>(
+    ids: &mut Ids<'a, C>,
+    id: IdRef,
+    specializations: &[Specialization<'b>],
+) -> Option<&'b [u8]> {
+    let decorations = &mut ids[id].decorations;
+    // without a SpecId the constant can't be specialized, so it keeps its default value
+    let index = decorations.iter().position(|decoration| match decoration {
+        Decoration::SpecId { .. } => true,
+        _ => false,
+    })?;
+    let specialization_constant_id = match decorations.remove(index) {
+        Decoration::SpecId {
+            specialization_constant_id,
+        } => specialization_constant_id,
+        _ => unreachable!(),
+    };
+    specializations
+        .iter()
+        .find(|specialization| specialization.id == specialization_constant_id)
+        .map(|specialization| specialization.bytes)
+}
+
+/// the little-endian value in `bytes`, sign-extended if `is_signed`, the same as SPIR-V literals
+/// narrower than a word. Like `SpecializationMapResolver` in translate-spirv-to-ir, `bytes` has
+/// to be exactly `size` bytes, the width of the constant's type.
+fn get_specialization_value(bytes: &[u8], size: usize, is_signed: bool) -> u64 {
+    assert_eq!(
+        bytes.len(),
+        size,
+        "specialization size doesn't match the constant's type"
+    );
+    let mut value_bytes = [0; 8];
+    value_bytes[..bytes.len()].copy_from_slice(bytes);
+    let value = u64::from_le_bytes(value_bytes);
+    let unused_bits = 64 - 8 * bytes.len() as u32;
+    if is_signed && unused_bits != 0 {
+        ((value << unused_bits) as i64 >> unused_bits) as u64
+    } else {
+        value
+    }
+}
+
+/// replaces specialization constants with ordinary constants that have the specialized values,
+/// so they are folded into the generated code
+fn specialize_constant<'a, C: shader_compiler_backend::Context<'a>>(
+    instruction: Instruction,
+    ids: &mut Ids<'a, C>,
+    specializations: &[Specialization],
+) -> Instruction {
+    // the width in bytes, and whether the value is sign-extended
+    let get_layout = |ids: &Ids<'a, C>, id_result_type: IdResultType| match **ids[id_result_type.0]
+        .get_nonvoid_type()
+    {
+        FrontendType::Scalar(ScalarType::I8) => (1, true),
+        FrontendType::Scalar(ScalarType::U8) => (1, false),
+        FrontendType::Scalar(ScalarType::I16) => (2, true),
+        FrontendType::Scalar(ScalarType::U16) | FrontendType::Scalar(ScalarType::F16) => (2, false),
+        FrontendType::Scalar(ScalarType::I32) => (4, true),
+        FrontendType::Scalar(ScalarType::U32) | FrontendType::Scalar(ScalarType::F32) => (4, false),
+        FrontendType::Scalar(ScalarType::I64) => (8, true),
+        FrontendType::Scalar(ScalarType::U64) | FrontendType::Scalar(ScalarType::F64) => (8, false),
+        _ => unreachable!("specialization constants are integers or floats"),
+    };
+    match instruction {
+        Instruction::SpecConstant32 {
+            id_result_type,
+            id_result,
+            value,
+        } => {
+            let value = match take_specialization(ids, id_result.0, specializations) {
+                Some(bytes) => {
+                    let (size, is_signed) = get_layout(ids, id_result_type);
+                    get_specialization_value(bytes, size, is_signed) as u32
+                }
+                None => value,
+            };
+            Instruction::Constant32 {
+                id_result_type,
+                id_result,
+                value,
+            }
+        }
+        Instruction::SpecConstant64 {
+            id_result_type,
+            id_result,
+            value,
+        } => {
+            let value = match take_specialization(ids, id_result.0, specializations) {
+                Some(bytes) => {
+                    let (size, is_signed) = get_layout(ids, id_result_type);
+                    get_specialization_value(bytes, size, is_signed)
+                }
+                None => value,
+            };
+            Instruction::Constant64 {
+                id_result_type,
+                id_result,
+                value,
+            }
+        }
+        Instruction::SpecConstantTrue {
+            id_result_type,
+            id_result,
+        }
+        | Instruction::SpecConstantFalse {
+            id_result_type,
+            id_result,
+        } => {
+            let default = match instruction {
+                Instruction::SpecConstantTrue { .. } => true,
+                _ => false,
+            };
+            // boolean specializations are `VkBool32`
+            let value = take_specialization(ids, id_result.0, specializations)
+                .map(|bytes| get_specialization_value(bytes, 4, false) != 0)
+                .unwrap_or(default);
+            if value {
+                Instruction::ConstantTrue {
+                    id_result_type,
+                    id_result,
+                }
+            } else {
+                Instruction::ConstantFalse {
+                    id_result_type,
+                    id_result,
+                }
+            }
+        }
+        Instruction::SpecConstantComposite {
+            id_result_type,
+            id_result,
+            constituents,
+        } => Instruction::ConstantComposite {
+            id_result_type,
+            id_result,
+            constituents,
+        },
+        instruction => instruction,
+    }
+}
+
+/// a function whose instructions are still being parsed
+struct FunctionBuilder {
+    id: IdRef,
+    function_instruction: Instruction,
+    parameter_instructions: Vec<Instruction>,
+    cfg_builder: CFGBuilder,
+    decorations: Vec<Decoration>,
+}
+
+impl FunctionBuilder {
+    fn push(&mut self, instruction: Instruction) {
+        match instruction {
+            instruction @ Instruction::FunctionParameter { .. } => {
+                assert!(
+                    self.cfg_builder.is_empty(),
+                    "OpFunctionParameter after start of function body"
+                );
+                self.parameter_instructions.push(instruction);
+            }
+            instruction => self.cfg_builder.push(instruction),
+        }
+    }
+    fn finish(self) -> ParsedShaderFunction {
+        ParsedShaderFunction {
+            function_instruction: self.function_instruction,
+            parameter_instructions: self.parameter_instructions,
+            cfg: self.cfg_builder.finish(),
+            decorations: self.decorations,
+        }
+    }
+}
+
 #[allow(clippy::cognitive_complexity)]
 pub(super) fn create<'a, C: shader_compiler_backend::Context<'a>>(
     context: &mut Context,
     stage_info: ShaderStageCreateInfo,
+    unspecialized_module: Option<&UnspecializedShaderModule>,
     execution_model: ExecutionModel,
 ) -> ParsedShader<'a, C> {
-    let parser = spirv_parser::Parser::start(stage_info.code).unwrap();
-    let header = *parser.header();
+    kazan_trace::trace_scope!("ParsedShader::create");
+    // instructions are handled as they're decoded, rather than collecting the whole module first
+    let (header, instructions): (_, Box<dyn Iterator<Item = Instruction>>) =
+        match unspecialized_module {
+            Some(module) => (module.header, Box::new(module.instructions.iter().cloned())),
+            None => {
+                let parser = spirv_parser::Parser::start(stage_info.code).unwrap();
+                (*parser.header(), Box::new(parser.map(Result::unwrap)))
+            }
+        };
     assert_eq!(header.instruction_schema, 0);
     assert_eq!(header.version.0, 1);
     assert!(header.version.1 <= 3);
-    let instructions: Vec<_> = parser.map(Result::unwrap).collect();
     println!("Parsing Shader:");
     print!("{}", header);
-    for instruction in instructions.iter() {
-        print!("{}", instruction);
-    }
     let mut ids = Ids((0..header.bound)
         .map(|_| IdProperties {
             kind: IdKind::Undefined,
@@ -36,20 +221,26 @@ pub(super) fn create<'a, C: shader_compiler_backend::Context<'a>>(
         })
         .collect());
     let mut entry_point = None;
-    let mut current_function: Option<(IdRef, ParsedShaderFunction)> = None;
+    let mut current_function: Option<FunctionBuilder> = None;
     let mut execution_modes = Vec::new();
     let mut workgroup_size = None;
+    let mut workgroup_memory_size = 0;
+    let mut has_control_barriers = false;
     for instruction in instructions {
+        print!("{}", instruction);
         match current_function {
             Some(mut function) => {
+                if let Instruction::ControlBarrier { .. } = instruction {
+                    has_control_barriers = true;
+                }
                 current_function = match instruction {
-                    instruction @ Instruction::FunctionEnd {} => {
-                        function.1.instructions.push(instruction);
-                        ids[function.0].set_kind(IdKind::Function(Some(function.1)));
+                    Instruction::FunctionEnd {} => {
+                        let id = function.id;
+                        ids[id].set_kind(IdKind::Function(Some(function.finish())));
                         None
                     }
                     instruction => {
-                        function.1.instructions.push(instruction);
+                        function.push(instruction);
                         Some(function)
                     }
                 };
@@ -57,6 +248,7 @@ pub(super) fn create<'a, C: shader_compiler_backend::Context<'a>>(
             }
             None => current_function = None,
         }
+        let instruction = specialize_constant(instruction, &mut ids, stage_info.specializations);
         match instruction {
             Instruction::Function {
                 id_result_type,
@@ -66,18 +258,18 @@ pub(super) fn create<'a, C: shader_compiler_backend::Context<'a>>(
             } => {
                 ids[id_result.0].assert_no_member_decorations(id_result.0);
                 let decorations = ids[id_result.0].decorations.clone();
-                current_function = Some((
-                    id_result.0,
-                    ParsedShaderFunction {
-                        instructions: vec![Instruction::Function {
-                            id_result_type,
-                            id_result,
-                            function_control,
-                            function_type,
-                        }],
-                        decorations,
+                current_function = Some(FunctionBuilder {
+                    id: id_result.0,
+                    function_instruction: Instruction::Function {
+                        id_result_type,
+                        id_result,
+                        function_control,
+                        function_type,
                     },
-                ));
+                    parameter_instructions: Vec::new(),
+                    cfg_builder: CFGBuilder::default(),
+                    decorations,
+                });
             }
             Instruction::EntryPoint {
                 execution_model: current_execution_model,
@@ -368,6 +560,26 @@ pub(super) fn create<'a, C: shader_compiler_backend::Context<'a>>(
                                 variable_type,
                             }));
                         }
+                        StorageClass::Workgroup => {
+                            if let Some(decoration) = ids[id_result.0].decorations.first() {
+                                unimplemented!(
+                                    "unimplemented decoration on workgroup variable: {:?}",
+                                    decoration
+                                );
+                            }
+                            assert!(initializer.is_none());
+                            let (size, alignment) =
+                                variable_type.get_nonvoid_pointee().get_size_and_alignment();
+                            let offset =
+                                (workgroup_memory_size + alignment - 1) / alignment * alignment;
+                            workgroup_memory_size = offset + size;
+                            ids[id_result.0].set_kind(IdKind::WorkgroupVariable(
+                                WorkgroupVariable {
+                                    offset,
+                                    variable_type,
+                                },
+                            ));
+                        }
                         StorageClass::Input => unimplemented!(),
                         _ => unimplemented!(
                             "unimplemented OpVariable StorageClass: {:?}",
@@ -568,10 +780,6 @@ pub(super) fn create<'a, C: shader_compiler_backend::Context<'a>>(
             | Instruction::SourceExtension { .. }
             | Instruction::Name { .. }
             | Instruction::MemberName { .. } => {}
-            Instruction::SpecConstant32 { .. } => unimplemented!(),
-            Instruction::SpecConstant64 { .. } => unimplemented!(),
-            Instruction::SpecConstantTrue { .. } => unimplemented!(),
-            Instruction::SpecConstantFalse { .. } => unimplemented!(),
             Instruction::SpecConstantOp { .. } => unimplemented!(),
             instruction => unimplemented!("unimplemented instruction:\n{}", instruction),
         }
@@ -590,5 +798,41 @@ pub(super) fn create<'a, C: shader_compiler_backend::Context<'a>>(
         interface_variables,
         execution_modes,
         workgroup_size,
+        workgroup_memory_size,
+        has_control_barriers,
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_get_specialization_value() {
+        assert_eq!(get_specialization_value(&[0xFE], 1, false), 0xFE);
+        assert_eq!(get_specialization_value(&[0xFE], 1, true), !1);
+        assert_eq!(
+            get_specialization_value(&[0x34, 0x82], 2, true),
+            0xFFFF_FFFF_FFFF_8234
+        );
+        assert_eq!(get_specialization_value(&[1, 0, 0, 0], 4, false), 1);
+        assert_eq!(get_specialization_value(&[0xFF; 4], 4, true), !0);
+        assert_eq!(
+            get_specialization_value(&[1, 2, 3, 4, 5, 6, 7, 0x88], 8, true),
+            0x8807_0605_0403_0201
+        );
+    }
+
+    #[test]
+    #[should_panic]
+    fn test_get_specialization_value_too_small() {
+        // a `VkBool32` specialization has to be all 4 bytes
+        get_specialization_value(&[1], 4, false);
+    }
+
+    #[test]
+    #[should_panic]
+    fn test_get_specialization_value_too_big() {
+        get_specialization_value(&[1, 0, 0, 0, 0, 0, 0, 0], 4, false);
     }
 }
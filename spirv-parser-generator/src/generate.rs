@@ -134,6 +134,25 @@ where
     )
 }
 
+/// the type `InstructionRef` uses for `operand`, if it borrows from the parsed words instead of
+/// being the same type `Instruction` uses
+fn get_borrowed_operand_kind(
+    operand: &ast::InstructionOperand,
+) -> Option<proc_macro2::TokenStream> {
+    let kind = new_id(&operand.kind, CamelCase);
+    let borrowed_kind = match (&operand.kind, operand.quantifier) {
+        (ast::Kind::Literal(ast::LiteralKind::LiteralString), _) => quote! {Cow<'a, str>},
+        (ast::Kind::IdRef, Some(ast::Quantifier::Variadic))
+        | (ast::Kind::Literal(_), Some(ast::Quantifier::Variadic)) => quote! {&'a [#kind]},
+        (_, Some(ast::Quantifier::Variadic)) => quote! {OperandList<'a, #kind>},
+        _ => return None,
+    };
+    match operand.quantifier {
+        Some(ast::Quantifier::Optional) => Some(quote! {Option<#borrowed_kind>}),
+        _ => Some(borrowed_kind),
+    }
+}
+
 struct ParsedExtensionInstructionSet {
     ast: ast::ExtensionInstructionSet,
     enumerant_name: proc_macro2::Ident,
@@ -212,7 +231,16 @@ pub(crate) fn generate(
                 string::{FromUtf8Error, String},
                 vec::Vec,
             };
-            use core::{convert::TryInto, fmt, mem, ops::Deref, result, str::Utf8Error};
+            use core::{
+                convert::TryInto,
+                fmt,
+                marker::PhantomData,
+                mem,
+                ops::Deref,
+                result,
+                slice,
+                str::{self, Utf8Error},
+            };
 
             macro_rules! split_fn {
                 ($body:expr) => {
@@ -443,6 +471,239 @@ pub(crate) fn generate(
                 }
             }
 
+            /// like `SPIRVParse`, but borrows from `words` instead of copying, for `InstructionRef`
+            trait SPIRVParseRef<'a>: Sized {
+                fn spirv_parse_ref(words: &'a [u32], parse_state: &mut ParseState)
+                    -> Result<(Self, &'a [u32])>;
+            }
+
+            impl<'a, T: SPIRVParseRef<'a>> SPIRVParseRef<'a> for Option<T> {
+                fn spirv_parse_ref(
+                    words: &'a [u32],
+                    parse_state: &mut ParseState,
+                ) -> Result<(Self, &'a [u32])> {
+                    if words.is_empty() {
+                        Ok((None, words))
+                    } else {
+                        let (value, words) = T::spirv_parse_ref(words, parse_state)?;
+                        Ok((Some(value), words))
+                    }
+                }
+            }
+
+            impl<'a> SPIRVParseRef<'a> for Cow<'a, str> {
+                fn spirv_parse_ref(
+                    words: &'a [u32],
+                    parse_state: &mut ParseState,
+                ) -> Result<(Self, &'a [u32])> {
+                    if cfg!(target_endian = "big") {
+                        // the bytes are in the wrong order in each word, so they can't be borrowed
+                        let (value, words) = String::spirv_parse(words, parse_state)?;
+                        return Ok((Cow::Owned(value), words));
+                    }
+                    let bytes = unsafe {
+                        slice::from_raw_parts(words.as_ptr() as *const u8, words.len() * BYTES_PER_WORD)
+                    };
+                    let byte_count_excluding_null_terminator = bytes
+                        .iter()
+                        .position(|&byte| byte == 0)
+                        .ok_or(Error::InstructionPrematurelyEnded)?;
+                    let word_count = byte_count_excluding_null_terminator / BYTES_PER_WORD + 1;
+                    if bytes[byte_count_excluding_null_terminator..word_count * BYTES_PER_WORD]
+                        .iter()
+                        .any(|&byte| byte != 0)
+                    {
+                        return Err(Error::InvalidStringTermination);
+                    }
+                    let value = str::from_utf8(&bytes[..byte_count_excluding_null_terminator])?;
+                    Ok((Cow::Borrowed(value), &words[word_count..]))
+                }
+            }
+
+            impl<'a> SPIRVParseRef<'a> for &'a [u32] {
+                fn spirv_parse_ref(
+                    words: &'a [u32],
+                    _parse_state: &mut ParseState,
+                ) -> Result<(Self, &'a [u32])> {
+                    Ok((words, &[]))
+                }
+            }
+
+            impl<'a> SPIRVParseRef<'a> for &'a [IdRef] {
+                fn spirv_parse_ref(
+                    words: &'a [u32],
+                    parse_state: &mut ParseState,
+                ) -> Result<(Self, &'a [u32])> {
+                    let (ids, words) = OperandList::<IdRef>::spirv_parse_ref(words, parse_state)?;
+                    // IdRef is repr(transparent)
+                    let ids = unsafe { slice::from_raw_parts(ids.words.as_ptr() as *const IdRef, ids.words.len()) };
+                    Ok((ids, words))
+                }
+            }
+
+            /// an operand that is always the same number of words, so it can be decoded from a
+            /// `OperandList` without checking it again
+            pub trait FixedSizeOperand: Copy {
+                const WORD_COUNT: usize;
+                /// `words` is `WORD_COUNT` words long
+                fn decode(words: &[u32]) -> Self;
+            }
+
+            impl FixedSizeOperand for u32 {
+                const WORD_COUNT: usize = 1;
+                fn decode(words: &[u32]) -> Self {
+                    words[0]
+                }
+            }
+
+            impl FixedSizeOperand for u64 {
+                const WORD_COUNT: usize = 2;
+                fn decode(words: &[u32]) -> Self {
+                    (u64::from(words[1]) << 32) | u64::from(words[0])
+                }
+            }
+
+            impl FixedSizeOperand for IdRef {
+                const WORD_COUNT: usize = 1;
+                fn decode(words: &[u32]) -> Self {
+                    IdRef(words[0])
+                }
+            }
+
+            impl<A: FixedSizeOperand, B: FixedSizeOperand> FixedSizeOperand for (A, B) {
+                const WORD_COUNT: usize = A::WORD_COUNT + B::WORD_COUNT;
+                fn decode(words: &[u32]) -> Self {
+                    let (a, b) = words.split_at(A::WORD_COUNT);
+                    (A::decode(a), B::decode(b))
+                }
+            }
+
+            /// a list of operands that borrows the words they're in and decodes each operand when
+            /// it's accessed, used by `InstructionRef` where the operands can't be borrowed as a
+            /// slice
+            #[derive(Copy, Clone, Eq, PartialEq, Hash)]
+            pub struct OperandList<'a, T> {
+                words: &'a [u32],
+                _phantom: PhantomData<T>,
+            }
+
+            impl<'a, T: FixedSizeOperand> OperandList<'a, T> {
+                pub fn len(&self) -> usize {
+                    self.words.len() / T::WORD_COUNT
+                }
+                pub fn is_empty(&self) -> bool {
+                    self.words.is_empty()
+                }
+                pub fn get(&self, index: usize) -> Option<T> {
+                    if index < self.len() {
+                        Some(T::decode(&self.words[index * T::WORD_COUNT..][..T::WORD_COUNT]))
+                    } else {
+                        None
+                    }
+                }
+                pub fn iter(&self) -> OperandListIter<'a, T> {
+                    OperandListIter {
+                        chunks: self.words.chunks_exact(T::WORD_COUNT),
+                        _phantom: PhantomData,
+                    }
+                }
+                pub fn to_vec(&self) -> Vec<T> {
+                    self.iter().collect()
+                }
+            }
+
+            impl<'a, T: FixedSizeOperand> IntoIterator for OperandList<'a, T> {
+                type Item = T;
+                type IntoIter = OperandListIter<'a, T>;
+                fn into_iter(self) -> OperandListIter<'a, T> {
+                    self.iter()
+                }
+            }
+
+            impl<'a, T: FixedSizeOperand + fmt::Debug> fmt::Debug for OperandList<'a, T> {
+                fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+                    f.debug_list().entries(self.iter()).finish()
+                }
+            }
+
+            impl<'a, T: SPIRVParse + FixedSizeOperand> SPIRVParseRef<'a> for OperandList<'a, T> {
+                fn spirv_parse_ref(
+                    words: &'a [u32],
+                    parse_state: &mut ParseState,
+                ) -> Result<(Self, &'a [u32])> {
+                    // check every operand now, so decoding them later can't fail
+                    let mut unchecked_words = words;
+                    while !unchecked_words.is_empty() {
+                        unchecked_words = T::spirv_parse(unchecked_words, parse_state)?.1;
+                    }
+                    Ok((
+                        OperandList {
+                            words,
+                            _phantom: PhantomData,
+                        },
+                        unchecked_words,
+                    ))
+                }
+            }
+
+            #[derive(Clone, Debug)]
+            pub struct OperandListIter<'a, T> {
+                chunks: slice::ChunksExact<'a, u32>,
+                _phantom: PhantomData<T>,
+            }
+
+            impl<'a, T: FixedSizeOperand> Iterator for OperandListIter<'a, T> {
+                type Item = T;
+                fn next(&mut self) -> Option<T> {
+                    self.chunks.next().map(T::decode)
+                }
+                fn size_hint(&self) -> (usize, Option<usize>) {
+                    self.chunks.size_hint()
+                }
+            }
+
+            impl<'a, T: FixedSizeOperand> DoubleEndedIterator for OperandListIter<'a, T> {
+                fn next_back(&mut self) -> Option<T> {
+                    self.chunks.next_back().map(T::decode)
+                }
+            }
+
+            impl<'a, T: FixedSizeOperand> ExactSizeIterator for OperandListIter<'a, T> {}
+
+            /// converts the operands of an `InstructionRef` to the operands of an `Instruction`
+            trait IntoOwnedOperand {
+                type Owned;
+                fn into_owned_operand(self) -> Self::Owned;
+            }
+
+            impl<T: IntoOwnedOperand> IntoOwnedOperand for Option<T> {
+                type Owned = Option<T::Owned>;
+                fn into_owned_operand(self) -> Self::Owned {
+                    self.map(T::into_owned_operand)
+                }
+            }
+
+            impl<'a> IntoOwnedOperand for Cow<'a, str> {
+                type Owned = String;
+                fn into_owned_operand(self) -> String {
+                    self.into_owned()
+                }
+            }
+
+            impl<'a, T: Clone> IntoOwnedOperand for &'a [T] {
+                type Owned = Vec<T>;
+                fn into_owned_operand(self) -> Vec<T> {
+                    self.to_vec()
+                }
+            }
+
+            impl<'a, T: FixedSizeOperand> IntoOwnedOperand for OperandList<'a, T> {
+                type Owned = Vec<T>;
+                fn into_owned_operand(self) -> Vec<T> {
+                    self.to_vec()
+                }
+            }
+
             pub const MAGIC_NUMBER: u32 = #magic_number;
             pub const MAJOR_VERSION: u32 = #major_version;
             pub const MINOR_VERSION: u32 = #minor_version;
@@ -810,6 +1071,18 @@ pub(crate) fn generate(
         let mut instruction_extension_enumerants = Vec::new();
         let mut instruction_extension_parse_cases = Vec::new();
         let mut instruction_extension_display_cases = Vec::new();
+        let mut instruction_ref_structs = Vec::new();
+        let mut instruction_ref_enumerants = Vec::new();
+        let mut instruction_ref_parse_cases = Vec::new();
+        let mut instruction_ref_into_owned_cases = Vec::new();
+        let mut instruction_ref_from_owned_cases = Vec::new();
+        let mut instructions_with_borrowed_operands = Vec::new();
+        let mut instruction_extension_ref_structs = Vec::new();
+        let mut instruction_extension_ref_enumerants = Vec::new();
+        let mut instruction_extension_ref_into_owned_cases = Vec::new();
+        let mut instruction_extension_ref_from_owned_cases = Vec::new();
+        let mut extension_instructions_with_borrowed_operands = Vec::new();
+        let mut instruction_extension_ref_parse_cases = Vec::new();
         for parsed_extension_instruction_set in &parsed_extension_instruction_sets {
             let extension_instruction_set = &parsed_extension_instruction_set.enumerant_name;
             for instruction in &parsed_extension_instruction_set.ast.instructions {
@@ -862,8 +1135,12 @@ pub(crate) fn generate(
                 };
                 instruction_extension_enumerants.push(instruction_extension_enumerant);
                 let mut parse_operations = Vec::new();
+                let mut ref_parse_operations = Vec::new();
                 let mut display_operations = Vec::new();
                 let mut operand_names = Vec::new();
+                let mut ref_fields = Vec::new();
+                let mut into_owned_fields = Vec::new();
+                let mut has_borrowed_operands = false;
                 for operand in &instruction.operands {
                     let kind = new_id(&operand.kind, CamelCase);
                     let name = new_id(operand.name.as_ref().unwrap(), SnakeCase);
@@ -875,12 +1152,102 @@ pub(crate) fn generate(
                     parse_operations.push(quote! {
                         let (#name, words) = #kind::spirv_parse(words, parse_state)?;
                     });
+                    if let Some(borrowed_kind) = get_borrowed_operand_kind(operand) {
+                        has_borrowed_operands = true;
+                        ref_parse_operations.push(quote! {
+                            let (#name, words) = <#borrowed_kind>::spirv_parse_ref(words, parse_state)?;
+                        });
+                        ref_fields.push(quote! {pub #name: #borrowed_kind});
+                        into_owned_fields.push(quote! {#name: v.#name.into_owned_operand()});
+                    } else {
+                        ref_parse_operations.push(quote! {
+                            let (#name, words) = #kind::spirv_parse(words, parse_state)?;
+                        });
+                        ref_fields.push(fields[operand_names.len()].clone());
+                        into_owned_fields.push(quote! {#name: v.#name});
+                    }
                     display_operations.push(quote! {
                         #name.spirv_display(f)?;
                     });
                     operand_names.push(name);
                 }
                 let operand_names = &operand_names;
+                if has_borrowed_operands {
+                    let instruction_ref_name = new_combined_id(
+                        &[
+                            "Op",
+                            parsed_extension_instruction_set.spirv_instruction_set_name,
+                            instruction.opname.as_ref(),
+                            "Ref",
+                        ],
+                        CamelCase,
+                    );
+                    instruction_extension_ref_structs.push(quote! {
+                        #[derive(Clone, Debug)]
+                        pub struct #instruction_ref_name<'a> {
+                            pub id_result_type: IdResultType,
+                            pub id_result: IdResult,
+                            pub set: IdRef,
+                            #(#ref_fields,)*
+                        }
+
+                        impl<'a> From<#instruction_ref_name<'a>> for #instruction_enumerant_name_with_op {
+                            fn from(v: #instruction_ref_name<'a>) -> Self {
+                                Self {
+                                    id_result_type: v.id_result_type,
+                                    id_result: v.id_result,
+                                    set: v.set,
+                                    #(#into_owned_fields,)*
+                                }
+                            }
+                        }
+
+                        impl<'a> From<#instruction_ref_name<'a>> for InstructionRef<'a> {
+                            fn from(v: #instruction_ref_name<'a>) -> Self {
+                                Self::#instruction_enumerant_name_without_op(v)
+                            }
+                        }
+                    });
+                    instruction_extension_ref_enumerants.push(quote! {
+                        #instruction_enumerant_name_without_op(#instruction_ref_name<'a>)
+                    });
+                    instruction_extension_ref_into_owned_cases.push(quote! {
+                        InstructionRef::#instruction_enumerant_name_without_op(v) =>
+                            Instruction::#instruction_enumerant_name_without_op(v.into())
+                    });
+                    extension_instructions_with_borrowed_operands.push(quote! {
+                        Instruction::#instruction_enumerant_name_without_op(_)
+                    });
+                    instruction_extension_ref_parse_cases.push(quote! {
+                        (ExtensionInstructionSet::#extension_instruction_set, #opcode) => split_fn!({
+                            #(#ref_parse_operations)*
+                            if words.is_empty() {
+                                Ok(InstructionRef::#instruction_enumerant_name_without_op(
+                                    #instruction_ref_name {
+                                        id_result_type,
+                                        id_result,
+                                        set,
+                                        #(#operand_names,)*
+                                    }
+                                ))
+                            } else {
+                                Err(Error::InstructionTooLong)
+                            }
+                        }),
+                    });
+                } else {
+                    instruction_extension_ref_enumerants.push(quote! {
+                        #instruction_enumerant_name_without_op(#instruction_enumerant_name_with_op)
+                    });
+                    instruction_extension_ref_into_owned_cases.push(quote! {
+                        InstructionRef::#instruction_enumerant_name_without_op(v) =>
+                            Instruction::#instruction_enumerant_name_without_op(v)
+                    });
+                    instruction_extension_ref_from_owned_cases.push(quote! {
+                        Instruction::#instruction_enumerant_name_without_op(v) =>
+                            InstructionRef::#instruction_enumerant_name_without_op(v)
+                    });
+                }
                 let body = quote! {
                     #(#parse_operations)*
                     if words.is_empty() {
@@ -927,7 +1294,7 @@ pub(crate) fn generate(
                 instruction_extension_display_cases.push(instruction_extension_display_case);
             }
         }
-        let instruction_extension_parse_cases = &instruction_extension_parse_cases;
+        let instruction_extension_ref_parse_cases = &instruction_extension_ref_parse_cases;
         for instruction in core_instructions.iter() {
             let opcode = instruction.opcode;
             let opname_without_op =
@@ -937,6 +1304,7 @@ pub(crate) fn generate(
             let display_opname_without_initial_op = remove_initial_op(display_opname);
             let instruction_parse_case;
             let instruction_display_case;
+            let mut instruction_ref_parse_case = quote! {};
             match &instruction.opname {
                 ast::InstructionName::OpExtInstImport => {
                     let body = quote! {
@@ -955,6 +1323,19 @@ pub(crate) fn generate(
                         let (name, words) = LiteralString::spirv_parse(words, parse_state)?;
                         #body
                     }),};
+                    instruction_ref_parse_case = quote! {#opcode => split_fn!({
+                        let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+                        let (name, words) = <Cow<str>>::spirv_parse_ref(words, parse_state)?;
+                        parse_state.define_id(
+                            id_result,
+                            IdState::ExtensionInstructionSet(ExtensionInstructionSet::from(&*name)),
+                        )?;
+                        if words.is_empty() {
+                            Ok(InstructionRef::ExtInstImport(OpExtInstImportRef { id_result, name }))
+                        } else {
+                            Err(Error::InstructionTooLong)
+                        }
+                    }),};
                     instruction_display_case = quote! {
                         Instruction::ExtInstImport(OpExtInstImport { id_result, name }) => split_fn!({
                             write!(f, "{}{} {:?}", InstructionIndentAndResult(Some(*id_result)), #display_opname, name)
@@ -984,21 +1365,60 @@ pub(crate) fn generate(
                             }
                             _ => return Err(Error::IdIsNotExtInstImport(set)),
                         };
-                        match (extension_instruction_set, instruction) {
-                            #(#instruction_extension_parse_cases)*
-                            (extension_instruction_set, instruction) => Err(Error::UnknownExtensionOpcode(extension_instruction_set, instruction)),
-                        }
+                        parse_extension_instruction(
+                            extension_instruction_set,
+                            instruction,
+                            id_result_type,
+                            id_result,
+                            set,
+                            words,
+                            parse_state,
+                        )
+                    };
+                    let parse_header = quote! {
+                        let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+                        let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+                        parse_state.define_value(id_result_type, id_result)?;
+                        let (set, words) = IdRef::spirv_parse(words, parse_state)?;
+                        let (instruction, words) = LiteralExtInstInteger::spirv_parse(words, parse_state)?;
                     };
                     instruction_parse_case = quote! {
                         #opcode => split_fn!({
-                            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-                            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-                            parse_state.define_value(id_result_type, id_result)?;
-                            let (set, words) = IdRef::spirv_parse(words, parse_state)?;
-                            let (instruction, words) = LiteralExtInstInteger::spirv_parse(words, parse_state)?;
+                            #parse_header
                             #body
                         }),
                     };
+                    instruction_ref_parse_case = quote! {
+                        #opcode => split_fn!({
+                            #parse_header
+                            let extension_instruction_set = match &parse_state.id_states[set.0 as usize] {
+                                IdState::ExtensionInstructionSet(ExtensionInstructionSet::Other(_)) => {
+                                    return Ok(InstructionRef::ExtInst(OpExtInstRef {
+                                        id_result_type,
+                                        id_result,
+                                        set,
+                                        instruction,
+                                        operands: words,
+                                    }));
+                                }
+                                IdState::ExtensionInstructionSet(v) => v.clone(),
+                                _ => return Err(Error::IdIsNotExtInstImport(set)),
+                            };
+                            match (extension_instruction_set, instruction) {
+                                #(#instruction_extension_ref_parse_cases)*
+                                (extension_instruction_set, instruction) => parse_extension_instruction(
+                                    extension_instruction_set,
+                                    instruction,
+                                    id_result_type,
+                                    id_result,
+                                    set,
+                                    words,
+                                    parse_state,
+                                )
+                                .map(InstructionRef::from_instruction_without_borrowed_operands),
+                            }
+                        }),
+                    };
                     instruction_display_case = quote! {
                         Instruction::ExtInst(OpExtInst {
                             id_result_type,
@@ -1131,6 +1551,41 @@ pub(crate) fn generate(
                             }
                         }),
                     };
+                    instruction_ref_parse_case = quote! {
+                        #opcode => split_fn!({
+                            let (selector, words) = IdRef::spirv_parse(words, parse_state)?;
+                            let (default, words) = IdRef::spirv_parse(words, parse_state)?;
+                            match &parse_state.id_states[selector.0 as usize] {
+                                IdState::Value(IdStateValue(BitWidth::Width32OrLess)) => {
+                                    let (target, words) =
+                                        OperandList::<PairLiteralInteger32IdRef>::spirv_parse_ref(words, parse_state)?;
+                                    if words.is_empty() {
+                                        Ok(InstructionRef::Switch32(OpSwitch32Ref {
+                                            selector,
+                                            default,
+                                            target,
+                                        }))
+                                    } else {
+                                        Err(Error::InstructionTooLong)
+                                    }
+                                }
+                                IdState::Value(IdStateValue(BitWidth::Width64)) => {
+                                    let (target, words) =
+                                        OperandList::<PairLiteralInteger64IdRef>::spirv_parse_ref(words, parse_state)?;
+                                    if words.is_empty() {
+                                        Ok(InstructionRef::Switch64(OpSwitch64Ref {
+                                            selector,
+                                            default,
+                                            target,
+                                        }))
+                                    } else {
+                                        Err(Error::InstructionTooLong)
+                                    }
+                                }
+                                _ => Err(Error::SwitchSelectorIsInvalid(selector)),
+                            }
+                        }),
+                    };
                     instruction_display_case = quote! {
                         Instruction::Switch32(OpSwitch32 {
                             selector,
@@ -1333,6 +1788,7 @@ pub(crate) fn generate(
                 }
                 _ => {
                     let mut parse_operations = Vec::new();
+                    let mut ref_parse_operations = Vec::new();
                     let mut display_operations = Vec::new();
                     let mut operand_names = Vec::new();
                     let mut result_name = None;
@@ -1347,6 +1803,14 @@ pub(crate) fn generate(
                         parse_operations.push(quote! {
                             let (#name, words) = #kind::spirv_parse(words, parse_state)?;
                         });
+                        ref_parse_operations.push(match get_borrowed_operand_kind(operand) {
+                            Some(borrowed_kind) => quote! {
+                                let (#name, words) = <#borrowed_kind>::spirv_parse_ref(words, parse_state)?;
+                            },
+                            None => quote! {
+                                let (#name, words) = #kind::spirv_parse(words, parse_state)?;
+                            },
+                        });
                         operand_names.push(name.clone());
                         if operand.kind == ast::Kind::IdResult {
                             assert_eq!(result_name, None);
@@ -1363,9 +1827,11 @@ pub(crate) fn generate(
                         {
                             let operand1_name = new_id(operand1.name.as_ref().unwrap(), SnakeCase);
                             let operand2_name = new_id(operand2.name.as_ref().unwrap(), SnakeCase);
-                            parse_operations.push(quote! {
+                            let define_value = quote! {
                                 parse_state.define_value(#operand1_name, #operand2_name)?;
-                            });
+                            };
+                            parse_operations.push(define_value.clone());
+                            ref_parse_operations.push(define_value);
                         }
                     }
                     let operand_names = &operand_names;
@@ -1379,6 +1845,24 @@ pub(crate) fn generate(
                             Err(Error::InstructionTooLong)
                         }
                     }),};
+                    if instruction
+                        .operands
+                        .iter()
+                        .any(|operand| get_borrowed_operand_kind(operand).is_some())
+                    {
+                        let opname_ref =
+                            new_combined_id(&[instruction.opname.as_ref(), "Ref"], CamelCase);
+                        instruction_ref_parse_case = quote! {#opcode => split_fn!({
+                            #(#ref_parse_operations)*
+                            if words.is_empty() {
+                                Ok(InstructionRef::#opname_without_op(#opname_ref {
+                                    #(#operand_names,)*
+                                }))
+                            } else {
+                                Err(Error::InstructionTooLong)
+                            }
+                        }),};
+                    }
                     let result_value = match result_name {
                         None => quote! {None},
                         Some(result_name) => quote! {Some(*#result_name)},
@@ -1396,6 +1880,70 @@ pub(crate) fn generate(
             }
             instruction_parse_cases.push(instruction_parse_case);
             instruction_display_cases.push(instruction_display_case);
+            let mut ref_fields = Vec::new();
+            let mut into_owned_fields = Vec::new();
+            let mut has_borrowed_operands = false;
+            for operand in instruction.operands.iter() {
+                let name = new_id(operand.name.as_ref().unwrap(), SnakeCase);
+                if let Some(borrowed_kind) = get_borrowed_operand_kind(operand) {
+                    has_borrowed_operands = true;
+                    ref_fields.push(quote! {pub #name: #borrowed_kind});
+                    into_owned_fields.push(quote! {#name: v.#name.into_owned_operand()});
+                } else {
+                    let kind = new_id(&operand.kind, CamelCase);
+                    let kind = match &operand.quantifier {
+                        None => quote! {#kind},
+                        Some(ast::Quantifier::Optional) => quote! {Option<#kind>},
+                        Some(ast::Quantifier::Variadic) => quote! {Vec<#kind>},
+                    };
+                    ref_fields.push(quote! {pub #name: #kind});
+                    into_owned_fields.push(quote! {#name: v.#name});
+                }
+            }
+            if has_borrowed_operands {
+                assert!(
+                    !instruction_ref_parse_case.is_empty()
+                        || instruction.opname == ast::InstructionName::OpSwitch64,
+                    "parsing {} into an InstructionRef is not implemented",
+                    display_opname
+                );
+                let opname_ref = new_combined_id(&[instruction.opname.as_ref(), "Ref"], CamelCase);
+                instruction_ref_structs.push(quote! {
+                    #[derive(Clone, Debug)]
+                    pub struct #opname_ref<'a> {
+                        #(#ref_fields,)*
+                    }
+
+                    impl<'a> From<#opname_ref<'a>> for #opname_with_op {
+                        fn from(v: #opname_ref<'a>) -> Self {
+                            Self {
+                                #(#into_owned_fields,)*
+                            }
+                        }
+                    }
+
+                    impl<'a> From<#opname_ref<'a>> for InstructionRef<'a> {
+                        fn from(v: #opname_ref<'a>) -> Self {
+                            Self::#opname_without_op(v)
+                        }
+                    }
+                });
+                instruction_ref_enumerants.push(quote! {#opname_without_op(#opname_ref<'a>)});
+                instruction_ref_into_owned_cases.push(quote! {
+                    InstructionRef::#opname_without_op(v) => Instruction::#opname_without_op(v.into())
+                });
+                instructions_with_borrowed_operands
+                    .push(quote! {Instruction::#opname_without_op(_)});
+                instruction_ref_parse_cases.push(instruction_ref_parse_case);
+            } else {
+                instruction_ref_enumerants.push(quote! {#opname_without_op(#opname_with_op)});
+                instruction_ref_into_owned_cases.push(quote! {
+                    InstructionRef::#opname_without_op(v) => Instruction::#opname_without_op(v)
+                });
+                instruction_ref_from_owned_cases.push(quote! {
+                    Instruction::#opname_without_op(v) => InstructionRef::#opname_without_op(v)
+                });
+            }
             let instruction_enumerant = quote! {#opname_without_op(#opname_with_op)};
             let instruction_enumerant_struct =
                 if instruction.opname == ast::InstructionName::OpSpecConstantOp {
@@ -1501,6 +2049,7 @@ pub(crate) fn generate(
             instruction_enumerant_structs.push(instruction_enumerant_struct);
             instruction_enumerants.push(instruction_enumerant);
         }
+        instructions_with_borrowed_operands.extend(extension_instructions_with_borrowed_operands);
         writeln!(
             &mut out,
             "{}",
@@ -1527,6 +2076,44 @@ pub(crate) fn generate(
                     #(#instruction_extension_enumerants,)*
                 }
 
+                #(#instruction_ref_structs)*
+                #(#instruction_extension_ref_structs)*
+
+                /// an `Instruction` that borrows its strings and lists of operands from the words
+                /// it was parsed from instead of copying them, returned by `Parser::next_ref`
+                #[derive(Clone, Debug)]
+                pub enum InstructionRef<'a> {
+                    #(#instruction_ref_enumerants,)*
+                    #(#instruction_extension_ref_enumerants,)*
+                }
+
+                impl<'a> From<InstructionRef<'a>> for Instruction {
+                    fn from(v: InstructionRef<'a>) -> Self {
+                        match v {
+                            #(#instruction_ref_into_owned_cases,)*
+                            #(#instruction_extension_ref_into_owned_cases,)*
+                        }
+                    }
+                }
+
+                impl<'a> InstructionRef<'a> {
+                    /// for the instructions `parse_instruction_ref` has `parse_instruction` parse
+                    fn from_instruction_without_borrowed_operands(v: Instruction) -> Self {
+                        match v {
+                            #(#instruction_ref_from_owned_cases,)*
+                            #(#instruction_extension_ref_from_owned_cases,)*
+                            #(#instructions_with_borrowed_operands)|* => unreachable!(),
+                        }
+                    }
+                }
+
+                impl<'a> fmt::Display for InstructionRef<'a> {
+                    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+                        // only used for dumping, so copying the operands is fine
+                        fmt::Display::fmt(&Instruction::from(self.clone()), f)
+                    }
+                }
+
                 #[derive(Copy, Clone, Debug)]
                 pub struct Header {
                     pub version: (u32, u32),
@@ -1713,6 +2300,33 @@ pub(crate) fn generate(
                     }
                 }
 
+                #[derive(Clone, Debug)]
+                pub struct InstructionRefAndLocation<'a> {
+                    pub instruction: InstructionRef<'a>,
+                    pub word_index: usize,
+                }
+
+                impl<'a> InstructionRefAndLocation<'a> {
+                    pub fn byte_index(&self) -> usize {
+                        self.word_index * mem::size_of::<u32>()
+                    }
+                }
+
+                impl<'a> From<InstructionRefAndLocation<'a>> for InstructionAndLocation {
+                    fn from(v: InstructionRefAndLocation<'a>) -> Self {
+                        Self {
+                            instruction: v.instruction.into(),
+                            word_index: v.word_index,
+                        }
+                    }
+                }
+
+                impl<'a> fmt::Display for InstructionRefAndLocation<'a> {
+                    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+                        write!(f, "{} ; 0x{:08x}", self.instruction, self.byte_index())
+                    }
+                }
+
                 #[derive(Clone, Debug)]
                 pub struct Parser<'a> {
                     words: &'a [u32],
@@ -1772,7 +2386,8 @@ pub(crate) fn generate(
                             })
                         }
                     }
-                    fn next_helper(&mut self, length_and_opcode: u32) -> Result<InstructionAndLocation> {
+                    /// returns the opcode, the operand words, and the word index of the next instruction
+                    fn next_instruction_words(&mut self, length_and_opcode: u32) -> Result<(u16, &'a [u32], usize)> {
                         let length = (length_and_opcode >> 16) as usize;
                         let opcode = length_and_opcode as u16;
                         if length == 0 {
@@ -1782,9 +2397,29 @@ pub(crate) fn generate(
                         self.words = &self.words[length..];
                         let word_index = self.next_word_index;
                         self.next_word_index += length;
+                        Ok((opcode, instruction_words, word_index))
+                    }
+                    fn next_helper(&mut self, length_and_opcode: u32) -> Result<InstructionAndLocation> {
+                        let (opcode, instruction_words, word_index) = self.next_instruction_words(length_and_opcode)?;
                         let instruction = parse_instruction(opcode, instruction_words, &mut self.parse_state)?;
                         Ok(InstructionAndLocation { instruction, word_index })
                     }
+                    fn next_ref_helper(&mut self, length_and_opcode: u32) -> Result<InstructionRefAndLocation<'a>> {
+                        let (opcode, instruction_words, word_index) = self.next_instruction_words(length_and_opcode)?;
+                        let instruction = parse_instruction_ref(opcode, instruction_words, &mut self.parse_state)?;
+                        Ok(InstructionRefAndLocation { instruction, word_index })
+                    }
+                    /// parse the next instruction like `self.next()`, except that strings and
+                    /// lists of operands are borrowed from the words being parsed instead of
+                    /// copied.
+                    pub fn next_ref(&mut self) -> Option<Result<InstructionRefAndLocation<'a>>> {
+                        let length_and_opcode = self.words.get(0)?;
+                        Some(self.next_ref_helper(*length_and_opcode))
+                    }
+                    /// convert to an iterator that parses using `next_ref`.
+                    pub fn into_refs(self) -> RefParser<'a> {
+                        RefParser { parser: self }
+                    }
                 }
 
                 impl<'a> Iterator for Parser<'a> {
@@ -1795,6 +2430,30 @@ pub(crate) fn generate(
                     }
                 }
 
+                /// a `Parser` that returns `InstructionRef`s, created by `Parser::into_refs`
+                #[derive(Clone, Debug)]
+                pub struct RefParser<'a> {
+                    parser: Parser<'a>,
+                }
+
+                impl<'a> RefParser<'a> {
+                    /// get the parsed SPIR-V header.
+                    pub fn header(&self) -> &Header {
+                        self.parser.header()
+                    }
+                    /// get the word index of the result of the next call to `self.next()`.
+                    pub fn next_word_index(&self) -> usize {
+                        self.parser.next_word_index()
+                    }
+                }
+
+                impl<'a> Iterator for RefParser<'a> {
+                    type Item = Result<InstructionRefAndLocation<'a>>;
+                    fn next(&mut self) -> Option<Result<InstructionRefAndLocation<'a>>> {
+                        self.parser.next_ref()
+                    }
+                }
+
                 fn parse_instruction(opcode: u16, words: &[u32], parse_state: &mut ParseState) -> Result<Instruction> {
                     match opcode {
                         #(#instruction_parse_cases)*
@@ -1802,6 +2461,35 @@ pub(crate) fn generate(
                     }
                 }
 
+                fn parse_extension_instruction(
+                    extension_instruction_set: ExtensionInstructionSet,
+                    instruction: LiteralExtInstInteger,
+                    id_result_type: IdResultType,
+                    id_result: IdResult,
+                    set: IdRef,
+                    words: &[u32],
+                    parse_state: &mut ParseState,
+                ) -> Result<Instruction> {
+                    match (extension_instruction_set, instruction) {
+                        #(#instruction_extension_parse_cases)*
+                        (extension_instruction_set, instruction) => Err(Error::UnknownExtensionOpcode(extension_instruction_set, instruction)),
+                    }
+                }
+
+                /// only the instructions with borrowed operands are parsed here, the rest are
+                /// the same as in `parse_instruction`
+                fn parse_instruction_ref<'a>(
+                    opcode: u16,
+                    words: &'a [u32],
+                    parse_state: &mut ParseState,
+                ) -> Result<InstructionRef<'a>> {
+                    match opcode {
+                        #(#instruction_ref_parse_cases)*
+                        opcode => parse_instruction(opcode, words, parse_state)
+                            .map(InstructionRef::from_instruction_without_borrowed_operands),
+                    }
+                }
+
                 impl fmt::Display for Instruction {
                     fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
                         match self {
@@ -29,9 +29,17 @@ use alloc::{
     string::{FromUtf8Error, String},
     vec::Vec,
 };
-use core::{convert::TryInto, fmt, mem, ops::Deref, result, str::Utf8Error};
+use core::{
+    convert::TryInto,
+    fmt,
+    marker::PhantomData,
+    mem,
+    ops::Deref,
+    result, slice,
+    str::{self, Utf8Error},
+};
 macro_rules! split_fn {
-    ( $ body : expr ) => {
+    ($ body : expr) => {
         (|| $body)()
     };
 }
@@ -237,6 +245,215 @@ impl SPIRVDisplay for IdRef {
         write!(f, " {}", self)
     }
 }
+#[doc = r" like `SPIRVParse`, but borrows from `words` instead of copying, for `InstructionRef`"]
+trait SPIRVParseRef<'a>: Sized {
+    fn spirv_parse_ref(words: &'a [u32], parse_state: &mut ParseState)
+        -> Result<(Self, &'a [u32])>;
+}
+impl<'a, T: SPIRVParseRef<'a>> SPIRVParseRef<'a> for Option<T> {
+    fn spirv_parse_ref(
+        words: &'a [u32],
+        parse_state: &mut ParseState,
+    ) -> Result<(Self, &'a [u32])> {
+        if words.is_empty() {
+            Ok((None, words))
+        } else {
+            let (value, words) = T::spirv_parse_ref(words, parse_state)?;
+            Ok((Some(value), words))
+        }
+    }
+}
+impl<'a> SPIRVParseRef<'a> for Cow<'a, str> {
+    fn spirv_parse_ref(
+        words: &'a [u32],
+        parse_state: &mut ParseState,
+    ) -> Result<(Self, &'a [u32])> {
+        if cfg!(target_endian = "big") {
+            let (value, words) = String::spirv_parse(words, parse_state)?;
+            return Ok((Cow::Owned(value), words));
+        }
+        let bytes = unsafe {
+            slice::from_raw_parts(words.as_ptr() as *const u8, words.len() * BYTES_PER_WORD)
+        };
+        let byte_count_excluding_null_terminator = bytes
+            .iter()
+            .position(|&byte| byte == 0)
+            .ok_or(Error::InstructionPrematurelyEnded)?;
+        let word_count = byte_count_excluding_null_terminator / BYTES_PER_WORD + 1;
+        if bytes[byte_count_excluding_null_terminator..word_count * BYTES_PER_WORD]
+            .iter()
+            .any(|&byte| byte != 0)
+        {
+            return Err(Error::InvalidStringTermination);
+        }
+        let value = str::from_utf8(&bytes[..byte_count_excluding_null_terminator])?;
+        Ok((Cow::Borrowed(value), &words[word_count..]))
+    }
+}
+impl<'a> SPIRVParseRef<'a> for &'a [u32] {
+    fn spirv_parse_ref(
+        words: &'a [u32],
+        _parse_state: &mut ParseState,
+    ) -> Result<(Self, &'a [u32])> {
+        Ok((words, &[]))
+    }
+}
+impl<'a> SPIRVParseRef<'a> for &'a [IdRef] {
+    fn spirv_parse_ref(
+        words: &'a [u32],
+        parse_state: &mut ParseState,
+    ) -> Result<(Self, &'a [u32])> {
+        let (ids, words) = OperandList::<IdRef>::spirv_parse_ref(words, parse_state)?;
+        let ids =
+            unsafe { slice::from_raw_parts(ids.words.as_ptr() as *const IdRef, ids.words.len()) };
+        Ok((ids, words))
+    }
+}
+#[doc = r" an operand that is always the same number of words, so it can be decoded from a"]
+#[doc = r" `OperandList` without checking it again"]
+pub trait FixedSizeOperand: Copy {
+    const WORD_COUNT: usize;
+    #[doc = r" `words` is `WORD_COUNT` words long"]
+    fn decode(words: &[u32]) -> Self;
+}
+impl FixedSizeOperand for u32 {
+    const WORD_COUNT: usize = 1;
+    fn decode(words: &[u32]) -> Self {
+        words[0]
+    }
+}
+impl FixedSizeOperand for u64 {
+    const WORD_COUNT: usize = 2;
+    fn decode(words: &[u32]) -> Self {
+        (u64::from(words[1]) << 32) | u64::from(words[0])
+    }
+}
+impl FixedSizeOperand for IdRef {
+    const WORD_COUNT: usize = 1;
+    fn decode(words: &[u32]) -> Self {
+        IdRef(words[0])
+    }
+}
+impl<A: FixedSizeOperand, B: FixedSizeOperand> FixedSizeOperand for (A, B) {
+    const WORD_COUNT: usize = A::WORD_COUNT + B::WORD_COUNT;
+    fn decode(words: &[u32]) -> Self {
+        let (a, b) = words.split_at(A::WORD_COUNT);
+        (A::decode(a), B::decode(b))
+    }
+}
+#[doc = r" a list of operands that borrows the words they're in and decodes each operand when"]
+#[doc = r" it's accessed, used by `InstructionRef` where the operands can't be borrowed as a"]
+#[doc = r" slice"]
+#[derive(Copy, Clone, Eq, PartialEq, Hash)]
+pub struct OperandList<'a, T> {
+    words: &'a [u32],
+    _phantom: PhantomData<T>,
+}
+impl<'a, T: FixedSizeOperand> OperandList<'a, T> {
+    pub fn len(&self) -> usize {
+        self.words.len() / T::WORD_COUNT
+    }
+    pub fn is_empty(&self) -> bool {
+        self.words.is_empty()
+    }
+    pub fn get(&self, index: usize) -> Option<T> {
+        if index < self.len() {
+            Some(T::decode(
+                &self.words[index * T::WORD_COUNT..][..T::WORD_COUNT],
+            ))
+        } else {
+            None
+        }
+    }
+    pub fn iter(&self) -> OperandListIter<'a, T> {
+        OperandListIter {
+            chunks: self.words.chunks_exact(T::WORD_COUNT),
+            _phantom: PhantomData,
+        }
+    }
+    pub fn to_vec(&self) -> Vec<T> {
+        self.iter().collect()
+    }
+}
+impl<'a, T: FixedSizeOperand> IntoIterator for OperandList<'a, T> {
+    type Item = T;
+    type IntoIter = OperandListIter<'a, T>;
+    fn into_iter(self) -> OperandListIter<'a, T> {
+        self.iter()
+    }
+}
+impl<'a, T: FixedSizeOperand + fmt::Debug> fmt::Debug for OperandList<'a, T> {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_list().entries(self.iter()).finish()
+    }
+}
+impl<'a, T: SPIRVParse + FixedSizeOperand> SPIRVParseRef<'a> for OperandList<'a, T> {
+    fn spirv_parse_ref(
+        words: &'a [u32],
+        parse_state: &mut ParseState,
+    ) -> Result<(Self, &'a [u32])> {
+        let mut unchecked_words = words;
+        while !unchecked_words.is_empty() {
+            unchecked_words = T::spirv_parse(unchecked_words, parse_state)?.1;
+        }
+        Ok((
+            OperandList {
+                words,
+                _phantom: PhantomData,
+            },
+            unchecked_words,
+        ))
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OperandListIter<'a, T> {
+    chunks: slice::ChunksExact<'a, u32>,
+    _phantom: PhantomData<T>,
+}
+impl<'a, T: FixedSizeOperand> Iterator for OperandListIter<'a, T> {
+    type Item = T;
+    fn next(&mut self) -> Option<T> {
+        self.chunks.next().map(T::decode)
+    }
+    fn size_hint(&self) -> (usize, Option<usize>) {
+        self.chunks.size_hint()
+    }
+}
+impl<'a, T: FixedSizeOperand> DoubleEndedIterator for OperandListIter<'a, T> {
+    fn next_back(&mut self) -> Option<T> {
+        self.chunks.next_back().map(T::decode)
+    }
+}
+impl<'a, T: FixedSizeOperand> ExactSizeIterator for OperandListIter<'a, T> {}
+#[doc = r" converts the operands of an `InstructionRef` to the operands of an `Instruction`"]
+trait IntoOwnedOperand {
+    type Owned;
+    fn into_owned_operand(self) -> Self::Owned;
+}
+impl<T: IntoOwnedOperand> IntoOwnedOperand for Option<T> {
+    type Owned = Option<T::Owned>;
+    fn into_owned_operand(self) -> Self::Owned {
+        self.map(T::into_owned_operand)
+    }
+}
+impl<'a> IntoOwnedOperand for Cow<'a, str> {
+    type Owned = String;
+    fn into_owned_operand(self) -> String {
+        self.into_owned()
+    }
+}
+impl<'a, T: Clone> IntoOwnedOperand for &'a [T] {
+    type Owned = Vec<T>;
+    fn into_owned_operand(self) -> Vec<T> {
+        self.to_vec()
+    }
+}
+impl<'a, T: FixedSizeOperand> IntoOwnedOperand for OperandList<'a, T> {
+    type Owned = Vec<T>;
+    fn into_owned_operand(self) -> Vec<T> {
+        self.to_vec()
+    }
+}
 pub const MAGIC_NUMBER: u32 = 119734787u32;
 pub const MAJOR_VERSION: u32 = 1u32;
 pub const MINOR_VERSION: u32 = 5u32;
@@ -15986,6139 +16203,9808 @@ pub enum Instruction {
     GLSLStd450NMax(OpGLSLStd450NMax),
     GLSLStd450NClamp(OpGLSLStd450NClamp),
 }
-#[derive(Copy, Clone, Debug)]
-pub struct Header {
-    pub version: (u32, u32),
-    pub generator: u32,
-    pub bound: u32,
-    pub instruction_schema: u32,
+#[derive(Clone, Debug)]
+pub struct OpSourceContinuedRef<'a> {
+    pub continued_source: Cow<'a, str>,
 }
-impl fmt::Display for Header {
-    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
-        writeln!(f, "; SPIR-V")?;
-        writeln!(f, "; Version: {}.{}", self.version.0, self.version.1)?;
-        writeln!(f, "; Generator: {:#X}", self.generator)?;
-        writeln!(f, "; Bound: {}", self.bound)?;
-        write!(f, "; Schema: {}", self.instruction_schema)
+impl<'a> From<OpSourceContinuedRef<'a>> for OpSourceContinued {
+    fn from(v: OpSourceContinuedRef<'a>) -> Self {
+        Self {
+            continued_source: v.continued_source.into_owned_operand(),
+        }
     }
 }
-struct InstructionIndentAndResult(Option<IdResult>);
-impl fmt::Display for InstructionIndentAndResult {
-    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
-        write!(
-            f,
-            "{:>15}",
-            self.0.map(|v| format!("{} = ", v.0)).unwrap_or_default()
-        )
+impl<'a> From<OpSourceContinuedRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpSourceContinuedRef<'a>) -> Self {
+        Self::SourceContinued(v)
     }
 }
-impl fmt::Display for IdRef {
-    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
-        write!(f, "%{}", self.0)
+#[derive(Clone, Debug)]
+pub struct OpSourceRef<'a> {
+    pub source_language: SourceLanguage,
+    pub version: LiteralInteger32,
+    pub file: Option<IdRef>,
+    pub source: Option<Cow<'a, str>>,
+}
+impl<'a> From<OpSourceRef<'a>> for OpSource {
+    fn from(v: OpSourceRef<'a>) -> Self {
+        Self {
+            source_language: v.source_language,
+            version: v.version,
+            file: v.file,
+            source: v.source.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpSourceRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpSourceRef<'a>) -> Self {
+        Self::Source(v)
     }
 }
 #[derive(Clone, Debug)]
-pub enum Error {
-    MissingHeader,
-    InvalidHeader,
-    BoundTooBig(u32),
-    UnsupportedVersion(u32, u32),
-    ZeroInstructionLength,
-    SourcePrematurelyEnded,
-    UnknownOpcode(u16),
-    UnknownSpecConstantOpcode(u32),
-    UnknownExtensionOpcode(ExtensionInstructionSet, u32),
-    Utf8Error(Utf8Error),
-    InstructionPrematurelyEnded,
-    InvalidStringTermination,
-    InstructionTooLong,
-    InvalidEnumValue,
-    IdOutOfBounds(u32),
-    IdAlreadyDefined(IdResult),
-    UnsupportedFloatSize,
-    UnsupportedIntSize,
-    UndefinedType(IdRef),
-    SwitchSelectorIsInvalid(IdRef),
-    IdIsNotExtInstImport(IdRef),
-    InvalidByteCount,
+pub struct OpSourceExtensionRef<'a> {
+    pub extension: Cow<'a, str>,
 }
-impl From<Utf8Error> for Error {
-    fn from(v: Utf8Error) -> Self {
-        Error::Utf8Error(v)
+impl<'a> From<OpSourceExtensionRef<'a>> for OpSourceExtension {
+    fn from(v: OpSourceExtensionRef<'a>) -> Self {
+        Self {
+            extension: v.extension.into_owned_operand(),
+        }
     }
 }
-impl From<FromUtf8Error> for Error {
-    fn from(v: FromUtf8Error) -> Self {
-        Error::Utf8Error(v.utf8_error())
+impl<'a> From<OpSourceExtensionRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpSourceExtensionRef<'a>) -> Self {
+        Self::SourceExtension(v)
     }
 }
-impl fmt::Display for Error {
-    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
-        match *self {
-            Error::MissingHeader => write!(f, "SPIR-V source is missing the file header"),
-            Error::InvalidHeader => write!(f, "SPIR-V source has an invalid file header"),
-            Error::BoundTooBig(bound) => write!(
-                f,
-                concat!(
-                    "SPIR-V source has an invalid file header; ",
-                    "the id bound is way bigger than needed: {}",
-                ),
-                bound,
-            ),
-            Error::UnsupportedVersion(major, minor) => write!(
-                f,
-                "SPIR-V source has an unsupported version: {}.{}",
-                major, minor
-            ),
-            Error::ZeroInstructionLength => write!(f, "SPIR-V instruction has a length of zero"),
-            Error::SourcePrematurelyEnded => write!(f, "SPIR-V source prematurely ended"),
-            Error::UnknownOpcode(opcode) => {
-                write!(f, "SPIR-V instruction has an unknown opcode: {}", opcode)
-            }
-            Error::UnknownSpecConstantOpcode(opcode) => write!(
-                f,
-                "SPIR-V OpSpecConstantOp instruction has an unknown opcode: {}",
-                opcode
-            ),
-            Error::UnknownExtensionOpcode(ref extension_instruction_set, opcode) => write!(
-                f,
-                "SPIR-V OpExtInst instruction has an unknown opcode: {} in {}",
-                opcode, extension_instruction_set
-            ),
-            Error::Utf8Error(error) => fmt::Display::fmt(&error, f),
-            Error::InstructionPrematurelyEnded => write!(f, "SPIR-V instruction prematurely ended"),
-            Error::InvalidStringTermination => {
-                write!(f, "SPIR-V LiteralString has an invalid termination word")
-            }
-            Error::InstructionTooLong => write!(f, "SPIR-V instruction is too long"),
-            Error::InvalidEnumValue => write!(f, "enum has invalid value"),
-            Error::IdOutOfBounds(id) => write!(f, "id is out of bounds: {}", id),
-            Error::IdAlreadyDefined(id) => write!(f, "id is already defined: {}", id),
-            Error::UnsupportedFloatSize => write!(f, "unsupported float size"),
-            Error::UnsupportedIntSize => write!(f, "unsupported int size"),
-            Error::UndefinedType(id) => write!(f, "undefined type {}", id),
-            Error::SwitchSelectorIsInvalid(id) => write!(f, "Switch selector is invalid: {}", id),
-            Error::IdIsNotExtInstImport(id) => write!(
-                f,
-                "id is not the result of an OpExtInstImport instruction: {}",
-                id
-            ),
-            Error::InvalidByteCount => write!(f, "byte count is not a multiple of 4"),
+#[derive(Clone, Debug)]
+pub struct OpNameRef<'a> {
+    pub target: IdRef,
+    pub name: Cow<'a, str>,
+}
+impl<'a> From<OpNameRef<'a>> for OpName {
+    fn from(v: OpNameRef<'a>) -> Self {
+        Self {
+            target: v.target,
+            name: v.name.into_owned_operand(),
         }
     }
 }
-pub(crate) type Result<T> = result::Result<T, Error>;
-#[derive(Copy, Clone, Debug, Eq, PartialEq, Hash)]
-enum BitWidth {
-    Width32OrLess,
-    Width64,
+impl<'a> From<OpNameRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpNameRef<'a>) -> Self {
+        Self::Name(v)
+    }
 }
-#[derive(Copy, Clone, Debug, Eq, PartialEq, Hash)]
-struct IdStateType(BitWidth);
-#[derive(Copy, Clone, Debug, Eq, PartialEq, Hash)]
-struct IdStateValue(BitWidth);
-#[derive(Clone, Debug, Eq, PartialEq, Hash)]
-enum IdState {
-    Unknown,
-    Type(IdStateType),
-    Value(IdStateValue),
-    ExtensionInstructionSet(ExtensionInstructionSet),
+#[derive(Clone, Debug)]
+pub struct OpMemberNameRef<'a> {
+    pub type_: IdRef,
+    pub member: LiteralInteger32,
+    pub name: Cow<'a, str>,
+}
+impl<'a> From<OpMemberNameRef<'a>> for OpMemberName {
+    fn from(v: OpMemberNameRef<'a>) -> Self {
+        Self {
+            type_: v.type_,
+            member: v.member,
+            name: v.name.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpMemberNameRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpMemberNameRef<'a>) -> Self {
+        Self::MemberName(v)
+    }
 }
 #[derive(Clone, Debug)]
-struct ParseState {
-    id_states: Vec<IdState>,
+pub struct OpStringRef<'a> {
+    pub id_result: IdResult,
+    pub string: Cow<'a, str>,
 }
-impl ParseState {
-    fn define_id(&mut self, id_result: IdResult, new_id_state: IdState) -> Result<()> {
-        let id_state = &mut self.id_states[(id_result.0).0 as usize];
-        if *id_state != IdState::Unknown {
-            return Err(Error::IdAlreadyDefined(id_result));
+impl<'a> From<OpStringRef<'a>> for OpString {
+    fn from(v: OpStringRef<'a>) -> Self {
+        Self {
+            id_result: v.id_result,
+            string: v.string.into_owned_operand(),
         }
-        *id_state = new_id_state;
-        Ok(())
     }
-    fn get_type(&self, id: IdRef) -> Result<IdStateType> {
-        if let IdState::Type(retval) = self.id_states[id.0 as usize] {
-            Ok(retval)
-        } else {
-            Err(Error::UndefinedType(id))
+}
+impl<'a> From<OpStringRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpStringRef<'a>) -> Self {
+        Self::String(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpExtensionRef<'a> {
+    pub name: Cow<'a, str>,
+}
+impl<'a> From<OpExtensionRef<'a>> for OpExtension {
+    fn from(v: OpExtensionRef<'a>) -> Self {
+        Self {
+            name: v.name.into_owned_operand(),
         }
     }
-    fn define_value(&mut self, id_result_type: IdResultType, id_result: IdResult) -> Result<()> {
-        if let IdState::Type(IdStateType(bit_width)) = self.id_states[(id_result_type.0).0 as usize]
-        {
-            self.define_id(id_result, IdState::Value(IdStateValue(bit_width)))?;
+}
+impl<'a> From<OpExtensionRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpExtensionRef<'a>) -> Self {
+        Self::Extension(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpExtInstImportRef<'a> {
+    pub id_result: IdResult,
+    pub name: Cow<'a, str>,
+}
+impl<'a> From<OpExtInstImportRef<'a>> for OpExtInstImport {
+    fn from(v: OpExtInstImportRef<'a>) -> Self {
+        Self {
+            id_result: v.id_result,
+            name: v.name.into_owned_operand(),
         }
-        Ok(())
+    }
+}
+impl<'a> From<OpExtInstImportRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpExtInstImportRef<'a>) -> Self {
+        Self::ExtInstImport(v)
     }
 }
 #[derive(Clone, Debug)]
-pub struct InstructionAndLocation {
-    pub instruction: Instruction,
-    pub word_index: usize,
+pub struct OpExtInstRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub set: IdRef,
+    pub instruction: LiteralExtInstInteger,
+    pub operands: &'a [LiteralInteger32],
 }
-impl InstructionAndLocation {
-    pub fn byte_index(&self) -> usize {
-        self.word_index * mem::size_of::<u32>()
+impl<'a> From<OpExtInstRef<'a>> for OpExtInst {
+    fn from(v: OpExtInstRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            set: v.set,
+            instruction: v.instruction,
+            operands: v.operands.into_owned_operand(),
+        }
     }
 }
-impl fmt::Display for InstructionAndLocation {
-    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
-        write!(f, "{} ; 0x{:08x}", self.instruction, self.byte_index())
+impl<'a> From<OpExtInstRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpExtInstRef<'a>) -> Self {
+        Self::ExtInst(v)
     }
 }
 #[derive(Clone, Debug)]
-pub struct Parser<'a> {
-    words: &'a [u32],
-    next_word_index: usize,
-    header: Header,
-    parse_state: ParseState,
+pub struct OpEntryPointRef<'a> {
+    pub execution_model: ExecutionModel,
+    pub entry_point: IdRef,
+    pub name: Cow<'a, str>,
+    pub interface: &'a [IdRef],
 }
-fn parse_version(v: u32) -> Result<(u32, u32)> {
-    if (v & 0xFF0000FF) != 0 {
-        return Err(Error::InvalidHeader);
+impl<'a> From<OpEntryPointRef<'a>> for OpEntryPoint {
+    fn from(v: OpEntryPointRef<'a>) -> Self {
+        Self {
+            execution_model: v.execution_model,
+            entry_point: v.entry_point,
+            name: v.name.into_owned_operand(),
+            interface: v.interface.into_owned_operand(),
+        }
     }
-    let major = (v >> 16) & 0xFF;
-    let minor = (v >> 8) & 0xFF;
-    Ok((major, minor))
 }
-impl<'a> Parser<'a> {
-    #[doc = r" get the parsed SPIR-V header."]
-    pub fn header(&self) -> &Header {
-        &self.header
+impl<'a> From<OpEntryPointRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpEntryPointRef<'a>) -> Self {
+        Self::EntryPoint(v)
     }
-    #[doc = r" get the word index of the result of the next call to `self.next()`."]
-    pub fn next_word_index(&self) -> usize {
-        self.next_word_index
+}
+#[derive(Clone, Debug)]
+pub struct OpTypeStructRef<'a> {
+    pub id_result: IdResult,
+    pub member_types: &'a [IdRef],
+}
+impl<'a> From<OpTypeStructRef<'a>> for OpTypeStruct {
+    fn from(v: OpTypeStructRef<'a>) -> Self {
+        Self {
+            id_result: v.id_result,
+            member_types: v.member_types.into_owned_operand(),
+        }
     }
-    #[doc = r" create a new `Parser` and parse the SPIR-V header."]
-    pub fn start(mut words: &'a [u32]) -> Result<Self> {
-        const HEADER_LEN: usize = 5;
-        let header = words.get(0..HEADER_LEN).ok_or(Error::MissingHeader)?;
-        words = &words[HEADER_LEN..];
-        let header = match *header {
-            [MAGIC_NUMBER, version, generator, bound, instruction_schema @ 0] if bound >= 1 => {
-                let version = parse_version(version)?;
-                if version.0 != MAJOR_VERSION || version.1 > MINOR_VERSION {
-                    return Err(Error::UnsupportedVersion(version.0, version.1));
-                }
-                Header {
-                    version,
-                    generator,
-                    bound,
-                    instruction_schema,
-                }
-            }
-            _ => return Err(Error::InvalidHeader),
-        };
-        if header.bound as usize > words.len() && header.bound > 0x10000 {
-            Err(Error::BoundTooBig(header.bound))
-        } else {
-            Ok(Self {
-                words,
-                next_word_index: HEADER_LEN,
-                header,
-                parse_state: ParseState {
-                    id_states: vec![IdState::Unknown; header.bound as usize],
-                },
-            })
+}
+impl<'a> From<OpTypeStructRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpTypeStructRef<'a>) -> Self {
+        Self::TypeStruct(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpTypeOpaqueRef<'a> {
+    pub id_result: IdResult,
+    pub the_name_of_the_opaque_type: Cow<'a, str>,
+}
+impl<'a> From<OpTypeOpaqueRef<'a>> for OpTypeOpaque {
+    fn from(v: OpTypeOpaqueRef<'a>) -> Self {
+        Self {
+            id_result: v.id_result,
+            the_name_of_the_opaque_type: v.the_name_of_the_opaque_type.into_owned_operand(),
         }
     }
-    fn next_helper(&mut self, length_and_opcode: u32) -> Result<InstructionAndLocation> {
-        let length = (length_and_opcode >> 16) as usize;
-        let opcode = length_and_opcode as u16;
-        if length == 0 {
-            return Err(Error::ZeroInstructionLength);
+}
+impl<'a> From<OpTypeOpaqueRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpTypeOpaqueRef<'a>) -> Self {
+        Self::TypeOpaque(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpTypeFunctionRef<'a> {
+    pub id_result: IdResult,
+    pub return_type: IdRef,
+    pub parameter_types: &'a [IdRef],
+}
+impl<'a> From<OpTypeFunctionRef<'a>> for OpTypeFunction {
+    fn from(v: OpTypeFunctionRef<'a>) -> Self {
+        Self {
+            id_result: v.id_result,
+            return_type: v.return_type,
+            parameter_types: v.parameter_types.into_owned_operand(),
         }
-        let instruction_words = self
-            .words
-            .get(1..length)
-            .ok_or(Error::SourcePrematurelyEnded)?;
-        self.words = &self.words[length..];
-        let word_index = self.next_word_index;
-        self.next_word_index += length;
-        let instruction = parse_instruction(opcode, instruction_words, &mut self.parse_state)?;
-        Ok(InstructionAndLocation {
-            instruction,
-            word_index,
-        })
     }
 }
-impl<'a> Iterator for Parser<'a> {
-    type Item = Result<InstructionAndLocation>;
-    fn next(&mut self) -> Option<Result<InstructionAndLocation>> {
-        let length_and_opcode = self.words.get(0)?;
-        Some(self.next_helper(*length_and_opcode))
+impl<'a> From<OpTypeFunctionRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpTypeFunctionRef<'a>) -> Self {
+        Self::TypeFunction(v)
     }
 }
-fn parse_instruction(
-    opcode: u16,
-    words: &[u32],
-    parse_state: &mut ParseState,
-) -> Result<Instruction> {
-    match opcode {
-        0u16 => split_fn!({
-            if words.is_empty() {
-                Ok(Instruction::Nop(OpNop {}))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        1u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
-            if words.is_empty() {
-                Ok(Instruction::Undef(OpUndef {
-                    id_result_type,
-                    id_result,
-                }))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        2u16 => split_fn!({
-            let (continued_source, words) = LiteralString::spirv_parse(words, parse_state)?;
-            if words.is_empty() {
-                Ok(Instruction::SourceContinued(OpSourceContinued {
-                    continued_source,
-                }))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        3u16 => split_fn!({
-            let (source_language, words) = SourceLanguage::spirv_parse(words, parse_state)?;
-            let (version, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let (file, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
-            let (source, words) = Option::<LiteralString>::spirv_parse(words, parse_state)?;
-            if words.is_empty() {
-                Ok(Instruction::Source(OpSource {
-                    source_language,
-                    version,
-                    file,
-                    source,
-                }))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        4u16 => split_fn!({
-            let (extension, words) = LiteralString::spirv_parse(words, parse_state)?;
-            if words.is_empty() {
-                Ok(Instruction::SourceExtension(OpSourceExtension {
-                    extension,
-                }))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        5u16 => split_fn!({
-            let (target, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (name, words) = LiteralString::spirv_parse(words, parse_state)?;
-            if words.is_empty() {
-                Ok(Instruction::Name(OpName { target, name }))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        6u16 => split_fn!({
-            let (type_, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (member, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let (name, words) = LiteralString::spirv_parse(words, parse_state)?;
-            if words.is_empty() {
-                Ok(Instruction::MemberName(OpMemberName {
-                    type_,
-                    member,
-                    name,
-                }))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        7u16 => split_fn!({
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (string, words) = LiteralString::spirv_parse(words, parse_state)?;
-            if words.is_empty() {
-                Ok(Instruction::String(OpString { id_result, string }))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        8u16 => split_fn!({
-            let (file, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (line, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let (column, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            if words.is_empty() {
-                Ok(Instruction::Line(OpLine { file, line, column }))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        10u16 => split_fn!({
-            let (name, words) = LiteralString::spirv_parse(words, parse_state)?;
-            if words.is_empty() {
-                Ok(Instruction::Extension(OpExtension { name }))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        11u16 => split_fn!({
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (name, words) = LiteralString::spirv_parse(words, parse_state)?;
-            parse_state.define_id(
-                id_result,
-                IdState::ExtensionInstructionSet(ExtensionInstructionSet::from(&*name)),
-            )?;
-            if words.is_empty() {
-                Ok(Instruction::ExtInstImport(OpExtInstImport {
-                    id_result,
-                    name,
-                }))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        12u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
-            let (set, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (instruction, words) = LiteralExtInstInteger::spirv_parse(words, parse_state)?;
-            let extension_instruction_set;
-            match parse_state.id_states[set.0 as usize].clone() {
-                IdState::ExtensionInstructionSet(ExtensionInstructionSet::Other(_)) => {
-                    let (operands, words) =
-                        Vec::<LiteralInteger32>::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        return Ok(Instruction::ExtInst(OpExtInst {
-                            id_result_type,
-                            id_result,
-                            set,
-                            instruction,
-                            operands,
-                        }));
-                    } else {
-                        return Err(Error::InstructionTooLong);
-                    }
-                }
-                IdState::ExtensionInstructionSet(v) => {
-                    extension_instruction_set = v;
-                }
-                _ => return Err(Error::IdIsNotExtInstImport(set)),
-            };
-            match (extension_instruction_set, instruction) {
-                (ExtensionInstructionSet::OpenCLStd, 0u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdAcos(OpOpenCLStdAcos {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 1u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdAcosh(OpOpenCLStdAcosh {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 2u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdAcospi(OpOpenCLStdAcospi {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 3u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdAsin(OpOpenCLStdAsin {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 4u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdAsinh(OpOpenCLStdAsinh {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 5u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdAsinpi(OpOpenCLStdAsinpi {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 6u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdAtan(OpOpenCLStdAtan {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 7u32) => split_fn!({
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdAtan2(OpOpenCLStdAtan2 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            y,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 8u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdAtanh(OpOpenCLStdAtanh {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 9u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdAtanpi(OpOpenCLStdAtanpi {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 10u32) => split_fn!({
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdAtan2pi(OpOpenCLStdAtan2pi {
-                            id_result_type,
-                            id_result,
-                            set,
-                            y,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 11u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdCbrt(OpOpenCLStdCbrt {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 12u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdCeil(OpOpenCLStdCeil {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 13u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdCopysign(OpOpenCLStdCopysign {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 14u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdCos(OpOpenCLStdCos {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 15u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdCosh(OpOpenCLStdCosh {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 16u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdCospi(OpOpenCLStdCospi {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 17u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdErfc(OpOpenCLStdErfc {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 18u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdErf(OpOpenCLStdErf {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 19u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdExp(OpOpenCLStdExp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 20u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdExp2(OpOpenCLStdExp2 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 21u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdExp10(OpOpenCLStdExp10 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 22u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdExpm1(OpOpenCLStdExpm1 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 23u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFabs(OpOpenCLStdFabs {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 24u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFdim(OpOpenCLStdFdim {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 25u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFloor(OpOpenCLStdFloor {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 26u32) => split_fn!({
-                    let (a, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (b, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (c, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFma(OpOpenCLStdFma {
-                            id_result_type,
-                            id_result,
-                            set,
-                            a,
-                            b,
-                            c,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 27u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFmax(OpOpenCLStdFmax {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 28u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFmin(OpOpenCLStdFmin {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 29u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFmod(OpOpenCLStdFmod {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 30u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (ptr, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFract(OpOpenCLStdFract {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            ptr,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 31u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (exp, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFrexp(OpOpenCLStdFrexp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            exp,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 32u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHypot(OpOpenCLStdHypot {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 33u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdIlogb(OpOpenCLStdIlogb {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 34u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (k, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdLdexp(OpOpenCLStdLdexp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            k,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 35u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdLgamma(OpOpenCLStdLgamma {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 36u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (signp, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdLgammaR(OpOpenCLStdLgammaR {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            signp,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 37u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdLog(OpOpenCLStdLog {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 38u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdLog2(OpOpenCLStdLog2 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 39u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdLog10(OpOpenCLStdLog10 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 40u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdLog1p(OpOpenCLStdLog1p {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 41u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdLogb(OpOpenCLStdLogb {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 42u32) => split_fn!({
-                    let (a, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (b, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (c, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdMad(OpOpenCLStdMad {
-                            id_result_type,
-                            id_result,
-                            set,
-                            a,
-                            b,
-                            c,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 43u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdMaxmag(OpOpenCLStdMaxmag {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 44u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdMinmag(OpOpenCLStdMinmag {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 45u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (iptr, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdModf(OpOpenCLStdModf {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            iptr,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 46u32) => split_fn!({
-                    let (nancode, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNan(OpOpenCLStdNan {
-                            id_result_type,
-                            id_result,
-                            set,
-                            nancode,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 47u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNextafter(OpOpenCLStdNextafter {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 48u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdPow(OpOpenCLStdPow {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 49u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdPown(OpOpenCLStdPown {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 50u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdPowr(OpOpenCLStdPowr {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 51u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdRemainder(OpOpenCLStdRemainder {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 52u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (quo, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdRemquo(OpOpenCLStdRemquo {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                            quo,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 53u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdRint(OpOpenCLStdRint {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 54u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdRootn(OpOpenCLStdRootn {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 55u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdRound(OpOpenCLStdRound {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 56u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdRsqrt(OpOpenCLStdRsqrt {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 57u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSin(OpOpenCLStdSin {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 58u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (cosval, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSincos(OpOpenCLStdSincos {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            cosval,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 59u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSinh(OpOpenCLStdSinh {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 60u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSinpi(OpOpenCLStdSinpi {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 61u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSqrt(OpOpenCLStdSqrt {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 62u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdTan(OpOpenCLStdTan {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 63u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdTanh(OpOpenCLStdTanh {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 64u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdTanpi(OpOpenCLStdTanpi {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 65u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdTgamma(OpOpenCLStdTgamma {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 66u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdTrunc(OpOpenCLStdTrunc {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 67u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHalfCos(OpOpenCLStdHalfCos {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 68u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHalfDivide(OpOpenCLStdHalfDivide {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 69u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHalfExp(OpOpenCLStdHalfExp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 70u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHalfExp2(OpOpenCLStdHalfExp2 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 71u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHalfExp10(OpOpenCLStdHalfExp10 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 72u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHalfLog(OpOpenCLStdHalfLog {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 73u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHalfLog2(OpOpenCLStdHalfLog2 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 74u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHalfLog10(OpOpenCLStdHalfLog10 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 75u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHalfPowr(OpOpenCLStdHalfPowr {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 76u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHalfRecip(OpOpenCLStdHalfRecip {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 77u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHalfRsqrt(OpOpenCLStdHalfRsqrt {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 78u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHalfSin(OpOpenCLStdHalfSin {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 79u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHalfSqrt(OpOpenCLStdHalfSqrt {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 80u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdHalfTan(OpOpenCLStdHalfTan {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 81u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNativeCos(OpOpenCLStdNativeCos {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 82u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNativeDivide(
-                            OpOpenCLStdNativeDivide {
-                                id_result_type,
-                                id_result,
-                                set,
-                                x,
-                                y,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 83u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNativeExp(OpOpenCLStdNativeExp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 84u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNativeExp2(OpOpenCLStdNativeExp2 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 85u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNativeExp10(OpOpenCLStdNativeExp10 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 86u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNativeLog(OpOpenCLStdNativeLog {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 87u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNativeLog2(OpOpenCLStdNativeLog2 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 88u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNativeLog10(OpOpenCLStdNativeLog10 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 89u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNativePowr(OpOpenCLStdNativePowr {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 90u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNativeRecip(OpOpenCLStdNativeRecip {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 91u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNativeRsqrt(OpOpenCLStdNativeRsqrt {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 92u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNativeSin(OpOpenCLStdNativeSin {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 93u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNativeSqrt(OpOpenCLStdNativeSqrt {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 94u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNativeTan(OpOpenCLStdNativeTan {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 141u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSAbs(OpOpenCLStdSAbs {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 142u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSAbsDiff(OpOpenCLStdSAbsDiff {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 143u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSAddSat(OpOpenCLStdSAddSat {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 144u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdUAddSat(OpOpenCLStdUAddSat {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 145u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSHadd(OpOpenCLStdSHadd {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 146u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdUHadd(OpOpenCLStdUHadd {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 147u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSRhadd(OpOpenCLStdSRhadd {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 148u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdURhadd(OpOpenCLStdURhadd {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 149u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (minval, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (maxval, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSClamp(OpOpenCLStdSClamp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            minval,
-                            maxval,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 150u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (minval, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (maxval, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdUClamp(OpOpenCLStdUClamp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            minval,
-                            maxval,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 151u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdClz(OpOpenCLStdClz {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 152u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdCtz(OpOpenCLStdCtz {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 153u32) => split_fn!({
-                    let (a, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (b, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (c, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSMadHi(OpOpenCLStdSMadHi {
-                            id_result_type,
-                            id_result,
-                            set,
-                            a,
-                            b,
-                            c,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 154u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (z, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdUMadSat(OpOpenCLStdUMadSat {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                            z,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 155u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (z, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSMadSat(OpOpenCLStdSMadSat {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                            z,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 156u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSMax(OpOpenCLStdSMax {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 157u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdUMax(OpOpenCLStdUMax {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 158u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSMin(OpOpenCLStdSMin {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 159u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdUMin(OpOpenCLStdUMin {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 160u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSMulHi(OpOpenCLStdSMulHi {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 161u32) => split_fn!({
-                    let (v, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (i, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdRotate(OpOpenCLStdRotate {
-                            id_result_type,
-                            id_result,
-                            set,
-                            v,
-                            i,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 162u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSSubSat(OpOpenCLStdSSubSat {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 163u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdUSubSat(OpOpenCLStdUSubSat {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 164u32) => split_fn!({
-                    let (hi, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (lo, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdUUpsample(OpOpenCLStdUUpsample {
-                            id_result_type,
-                            id_result,
-                            set,
-                            hi,
-                            lo,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 165u32) => split_fn!({
-                    let (hi, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (lo, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSUpsample(OpOpenCLStdSUpsample {
-                            id_result_type,
-                            id_result,
-                            set,
-                            hi,
-                            lo,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 166u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdPopcount(OpOpenCLStdPopcount {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 167u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (z, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSMad24(OpOpenCLStdSMad24 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                            z,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 168u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (z, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdUMad24(OpOpenCLStdUMad24 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                            z,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 169u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSMul24(OpOpenCLStdSMul24 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 170u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdUMul24(OpOpenCLStdUMul24 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 201u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdUAbs(OpOpenCLStdUAbs {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 202u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdUAbsDiff(OpOpenCLStdUAbsDiff {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 203u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdUMulHi(OpOpenCLStdUMulHi {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 204u32) => split_fn!({
-                    let (a, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (b, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (c, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdUMadHi(OpOpenCLStdUMadHi {
-                            id_result_type,
-                            id_result,
-                            set,
-                            a,
-                            b,
-                            c,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 95u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (minval, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (maxval, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFclamp(OpOpenCLStdFclamp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            minval,
-                            maxval,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 96u32) => split_fn!({
-                    let (radians, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdDegrees(OpOpenCLStdDegrees {
-                            id_result_type,
-                            id_result,
-                            set,
-                            radians,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 97u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFmaxCommon(OpOpenCLStdFmaxCommon {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 98u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFminCommon(OpOpenCLStdFminCommon {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 99u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (a, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdMix(OpOpenCLStdMix {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                            a,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 100u32) => split_fn!({
-                    let (degrees, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdRadians(OpOpenCLStdRadians {
-                            id_result_type,
-                            id_result,
-                            set,
-                            degrees,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 101u32) => split_fn!({
-                    let (edge, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdStep(OpOpenCLStdStep {
-                            id_result_type,
-                            id_result,
-                            set,
-                            edge,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 102u32) => split_fn!({
-                    let (edge0, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (edge1, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSmoothstep(OpOpenCLStdSmoothstep {
-                            id_result_type,
-                            id_result,
-                            set,
-                            edge0,
-                            edge1,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 103u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSign(OpOpenCLStdSign {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 104u32) => split_fn!({
-                    let (p0, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p1, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdCross(OpOpenCLStdCross {
-                            id_result_type,
-                            id_result,
-                            set,
-                            p0,
-                            p1,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 105u32) => split_fn!({
-                    let (p0, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p1, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdDistance(OpOpenCLStdDistance {
-                            id_result_type,
-                            id_result,
-                            set,
-                            p0,
-                            p1,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 106u32) => split_fn!({
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdLength(OpOpenCLStdLength {
-                            id_result_type,
-                            id_result,
-                            set,
-                            p,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 107u32) => split_fn!({
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdNormalize(OpOpenCLStdNormalize {
-                            id_result_type,
-                            id_result,
-                            set,
-                            p,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 108u32) => split_fn!({
-                    let (p0, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p1, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFastDistance(
-                            OpOpenCLStdFastDistance {
-                                id_result_type,
-                                id_result,
-                                set,
-                                p0,
-                                p1,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 109u32) => split_fn!({
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFastLength(OpOpenCLStdFastLength {
-                            id_result_type,
-                            id_result,
-                            set,
-                            p,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 110u32) => split_fn!({
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdFastNormalize(
-                            OpOpenCLStdFastNormalize {
-                                id_result_type,
-                                id_result,
-                                set,
-                                p,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 186u32) => split_fn!({
-                    let (a, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (b, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (c, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdBitselect(OpOpenCLStdBitselect {
-                            id_result_type,
-                            id_result,
-                            set,
-                            a,
-                            b,
-                            c,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 187u32) => split_fn!({
-                    let (a, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (b, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (c, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdSelect(OpOpenCLStdSelect {
-                            id_result_type,
-                            id_result,
-                            set,
-                            a,
-                            b,
-                            c,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 171u32) => split_fn!({
-                    let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (n, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdVloadn(OpOpenCLStdVloadn {
-                            id_result_type,
-                            id_result,
-                            set,
-                            offset,
-                            p,
-                            n,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 172u32) => split_fn!({
-                    let (data, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdVstoren(OpOpenCLStdVstoren {
-                            id_result_type,
-                            id_result,
-                            set,
-                            data,
-                            offset,
-                            p,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 173u32) => split_fn!({
-                    let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdVloadHalf(OpOpenCLStdVloadHalf {
-                            id_result_type,
-                            id_result,
-                            set,
-                            offset,
-                            p,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 174u32) => split_fn!({
-                    let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (n, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdVloadHalfn(OpOpenCLStdVloadHalfn {
-                            id_result_type,
-                            id_result,
-                            set,
-                            offset,
-                            p,
-                            n,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 175u32) => split_fn!({
-                    let (data, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdVstoreHalf(OpOpenCLStdVstoreHalf {
-                            id_result_type,
-                            id_result,
-                            set,
-                            data,
-                            offset,
-                            p,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 176u32) => split_fn!({
-                    let (data, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (mode, words) = FPRoundingMode::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdVstoreHalfR(OpOpenCLStdVstoreHalfR {
-                            id_result_type,
-                            id_result,
-                            set,
-                            data,
-                            offset,
-                            p,
-                            mode,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 177u32) => split_fn!({
-                    let (data, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdVstoreHalfn(OpOpenCLStdVstoreHalfn {
-                            id_result_type,
-                            id_result,
-                            set,
-                            data,
-                            offset,
-                            p,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 178u32) => split_fn!({
-                    let (data, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (mode, words) = FPRoundingMode::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdVstoreHalfnR(
-                            OpOpenCLStdVstoreHalfnR {
-                                id_result_type,
-                                id_result,
-                                set,
-                                data,
-                                offset,
-                                p,
-                                mode,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 179u32) => split_fn!({
-                    let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (n, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdVloadaHalfn(OpOpenCLStdVloadaHalfn {
-                            id_result_type,
-                            id_result,
-                            set,
-                            offset,
-                            p,
-                            n,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 180u32) => split_fn!({
-                    let (data, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdVstoreaHalfn(
-                            OpOpenCLStdVstoreaHalfn {
-                                id_result_type,
-                                id_result,
-                                set,
-                                data,
-                                offset,
-                                p,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 181u32) => split_fn!({
-                    let (data, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (mode, words) = FPRoundingMode::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdVstoreaHalfnR(
-                            OpOpenCLStdVstoreaHalfnR {
-                                id_result_type,
-                                id_result,
-                                set,
-                                data,
-                                offset,
-                                p,
-                                mode,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 182u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (shuffle_mask, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdShuffle(OpOpenCLStdShuffle {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            shuffle_mask,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 183u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (shuffle_mask, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdShuffle2(OpOpenCLStdShuffle2 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                            shuffle_mask,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 184u32) => split_fn!({
-                    let (format, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (additional_arguments, words) =
-                        Vec::<IdRef>::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdPrintf(OpOpenCLStdPrintf {
-                            id_result_type,
-                            id_result,
-                            set,
-                            format,
-                            additional_arguments,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::OpenCLStd, 185u32) => split_fn!({
-                    let (ptr, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (num_elements, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::OpenCLStdPrefetch(OpOpenCLStdPrefetch {
-                            id_result_type,
-                            id_result,
-                            set,
-                            ptr,
-                            num_elements,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 1u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Round(OpGLSLStd450Round {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 2u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450RoundEven(OpGLSLStd450RoundEven {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 3u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Trunc(OpGLSLStd450Trunc {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 4u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450FAbs(OpGLSLStd450FAbs {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 5u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450SAbs(OpGLSLStd450SAbs {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 6u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450FSign(OpGLSLStd450FSign {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 7u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450SSign(OpGLSLStd450SSign {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 8u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Floor(OpGLSLStd450Floor {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 9u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Ceil(OpGLSLStd450Ceil {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 10u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Fract(OpGLSLStd450Fract {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 11u32) => split_fn!({
-                    let (degrees, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Radians(OpGLSLStd450Radians {
-                            id_result_type,
-                            id_result,
-                            set,
-                            degrees,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 12u32) => split_fn!({
-                    let (radians, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Degrees(OpGLSLStd450Degrees {
-                            id_result_type,
-                            id_result,
-                            set,
-                            radians,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 13u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Sin(OpGLSLStd450Sin {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 14u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Cos(OpGLSLStd450Cos {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 15u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Tan(OpGLSLStd450Tan {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 16u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Asin(OpGLSLStd450Asin {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 17u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Acos(OpGLSLStd450Acos {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 18u32) => split_fn!({
-                    let (y_over_x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Atan(OpGLSLStd450Atan {
-                            id_result_type,
-                            id_result,
-                            set,
-                            y_over_x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 19u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Sinh(OpGLSLStd450Sinh {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 20u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Cosh(OpGLSLStd450Cosh {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 21u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Tanh(OpGLSLStd450Tanh {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 22u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Asinh(OpGLSLStd450Asinh {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 23u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Acosh(OpGLSLStd450Acosh {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 24u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Atanh(OpGLSLStd450Atanh {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 25u32) => split_fn!({
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Atan2(OpGLSLStd450Atan2 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            y,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 26u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Pow(OpGLSLStd450Pow {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 27u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Exp(OpGLSLStd450Exp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 28u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Log(OpGLSLStd450Log {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 29u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Exp2(OpGLSLStd450Exp2 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 30u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Log2(OpGLSLStd450Log2 {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 31u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Sqrt(OpGLSLStd450Sqrt {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 32u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450InverseSqrt(
-                            OpGLSLStd450InverseSqrt {
-                                id_result_type,
-                                id_result,
-                                set,
-                                x,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 33u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Determinant(
-                            OpGLSLStd450Determinant {
-                                id_result_type,
-                                id_result,
-                                set,
-                                x,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 34u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450MatrixInverse(
-                            OpGLSLStd450MatrixInverse {
-                                id_result_type,
-                                id_result,
-                                set,
-                                x,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 35u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (i, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Modf(OpGLSLStd450Modf {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            i,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 36u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450ModfStruct(OpGLSLStd450ModfStruct {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 37u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450FMin(OpGLSLStd450FMin {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 38u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450UMin(OpGLSLStd450UMin {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 39u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450SMin(OpGLSLStd450SMin {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 40u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450FMax(OpGLSLStd450FMax {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 41u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450UMax(OpGLSLStd450UMax {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 42u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450SMax(OpGLSLStd450SMax {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 43u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (min_val, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (max_val, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450FClamp(OpGLSLStd450FClamp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            min_val,
-                            max_val,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 44u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (min_val, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (max_val, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450UClamp(OpGLSLStd450UClamp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            min_val,
-                            max_val,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 45u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (min_val, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (max_val, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450SClamp(OpGLSLStd450SClamp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            min_val,
-                            max_val,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 46u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (a, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450FMix(OpGLSLStd450FMix {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                            a,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 47u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (a, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450IMix(OpGLSLStd450IMix {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                            a,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 48u32) => split_fn!({
-                    let (edge, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Step(OpGLSLStd450Step {
-                            id_result_type,
-                            id_result,
-                            set,
-                            edge,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 49u32) => split_fn!({
-                    let (edge0, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (edge1, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450SmoothStep(OpGLSLStd450SmoothStep {
-                            id_result_type,
-                            id_result,
-                            set,
-                            edge0,
-                            edge1,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 50u32) => split_fn!({
-                    let (a, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (b, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (c, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Fma(OpGLSLStd450Fma {
-                            id_result_type,
-                            id_result,
-                            set,
-                            a,
-                            b,
-                            c,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 51u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (exp, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Frexp(OpGLSLStd450Frexp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            exp,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 52u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450FrexpStruct(
-                            OpGLSLStd450FrexpStruct {
-                                id_result_type,
-                                id_result,
-                                set,
-                                x,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 53u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (exp, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Ldexp(OpGLSLStd450Ldexp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            exp,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 54u32) => split_fn!({
-                    let (v, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450PackSnorm4x8(
-                            OpGLSLStd450PackSnorm4x8 {
-                                id_result_type,
-                                id_result,
-                                set,
-                                v,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 55u32) => split_fn!({
-                    let (v, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450PackUnorm4x8(
-                            OpGLSLStd450PackUnorm4x8 {
-                                id_result_type,
-                                id_result,
-                                set,
-                                v,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 56u32) => split_fn!({
-                    let (v, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450PackSnorm2x16(
-                            OpGLSLStd450PackSnorm2x16 {
-                                id_result_type,
-                                id_result,
-                                set,
-                                v,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 57u32) => split_fn!({
-                    let (v, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450PackUnorm2x16(
-                            OpGLSLStd450PackUnorm2x16 {
-                                id_result_type,
-                                id_result,
-                                set,
-                                v,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 58u32) => split_fn!({
-                    let (v, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450PackHalf2x16(
-                            OpGLSLStd450PackHalf2x16 {
-                                id_result_type,
-                                id_result,
-                                set,
-                                v,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 59u32) => split_fn!({
-                    let (v, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450PackDouble2x32(
-                            OpGLSLStd450PackDouble2x32 {
-                                id_result_type,
-                                id_result,
-                                set,
-                                v,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 60u32) => split_fn!({
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450UnpackSnorm2x16(
-                            OpGLSLStd450UnpackSnorm2x16 {
-                                id_result_type,
-                                id_result,
-                                set,
-                                p,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 61u32) => split_fn!({
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450UnpackUnorm2x16(
-                            OpGLSLStd450UnpackUnorm2x16 {
-                                id_result_type,
-                                id_result,
-                                set,
-                                p,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 62u32) => split_fn!({
-                    let (v, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450UnpackHalf2x16(
-                            OpGLSLStd450UnpackHalf2x16 {
-                                id_result_type,
-                                id_result,
-                                set,
-                                v,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 63u32) => split_fn!({
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450UnpackSnorm4x8(
-                            OpGLSLStd450UnpackSnorm4x8 {
-                                id_result_type,
-                                id_result,
-                                set,
-                                p,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 64u32) => split_fn!({
-                    let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450UnpackUnorm4x8(
-                            OpGLSLStd450UnpackUnorm4x8 {
-                                id_result_type,
-                                id_result,
-                                set,
-                                p,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 65u32) => split_fn!({
-                    let (v, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450UnpackDouble2x32(
-                            OpGLSLStd450UnpackDouble2x32 {
-                                id_result_type,
-                                id_result,
-                                set,
-                                v,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 66u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Length(OpGLSLStd450Length {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 67u32) => split_fn!({
-                    let (p0, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (p1, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Distance(OpGLSLStd450Distance {
-                            id_result_type,
-                            id_result,
-                            set,
-                            p0,
-                            p1,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 68u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Cross(OpGLSLStd450Cross {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 69u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Normalize(OpGLSLStd450Normalize {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 70u32) => split_fn!({
-                    let (n, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (i, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (nref, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450FaceForward(
-                            OpGLSLStd450FaceForward {
-                                id_result_type,
-                                id_result,
-                                set,
-                                n,
-                                i,
-                                nref,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 71u32) => split_fn!({
-                    let (i, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (n, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Reflect(OpGLSLStd450Reflect {
-                            id_result_type,
-                            id_result,
-                            set,
-                            i,
-                            n,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 72u32) => split_fn!({
-                    let (i, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (n, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (eta, words) = IdRef::spirv_parse(words, parse_state)?;
+#[derive(Clone, Debug)]
+pub struct OpConstantCompositeRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub constituents: &'a [IdRef],
+}
+impl<'a> From<OpConstantCompositeRef<'a>> for OpConstantComposite {
+    fn from(v: OpConstantCompositeRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            constituents: v.constituents.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpConstantCompositeRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpConstantCompositeRef<'a>) -> Self {
+        Self::ConstantComposite(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpSpecConstantCompositeRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub constituents: &'a [IdRef],
+}
+impl<'a> From<OpSpecConstantCompositeRef<'a>> for OpSpecConstantComposite {
+    fn from(v: OpSpecConstantCompositeRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            constituents: v.constituents.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpSpecConstantCompositeRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpSpecConstantCompositeRef<'a>) -> Self {
+        Self::SpecConstantComposite(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpFunctionCallRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub function: IdRef,
+    pub arguments: &'a [IdRef],
+}
+impl<'a> From<OpFunctionCallRef<'a>> for OpFunctionCall {
+    fn from(v: OpFunctionCallRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            function: v.function,
+            arguments: v.arguments.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpFunctionCallRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpFunctionCallRef<'a>) -> Self {
+        Self::FunctionCall(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpAccessChainRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub base: IdRef,
+    pub indexes: &'a [IdRef],
+}
+impl<'a> From<OpAccessChainRef<'a>> for OpAccessChain {
+    fn from(v: OpAccessChainRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            base: v.base,
+            indexes: v.indexes.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpAccessChainRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpAccessChainRef<'a>) -> Self {
+        Self::AccessChain(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpInBoundsAccessChainRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub base: IdRef,
+    pub indexes: &'a [IdRef],
+}
+impl<'a> From<OpInBoundsAccessChainRef<'a>> for OpInBoundsAccessChain {
+    fn from(v: OpInBoundsAccessChainRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            base: v.base,
+            indexes: v.indexes.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpInBoundsAccessChainRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpInBoundsAccessChainRef<'a>) -> Self {
+        Self::InBoundsAccessChain(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpPtrAccessChainRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub base: IdRef,
+    pub element: IdRef,
+    pub indexes: &'a [IdRef],
+}
+impl<'a> From<OpPtrAccessChainRef<'a>> for OpPtrAccessChain {
+    fn from(v: OpPtrAccessChainRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            base: v.base,
+            element: v.element,
+            indexes: v.indexes.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpPtrAccessChainRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpPtrAccessChainRef<'a>) -> Self {
+        Self::PtrAccessChain(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpInBoundsPtrAccessChainRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub base: IdRef,
+    pub element: IdRef,
+    pub indexes: &'a [IdRef],
+}
+impl<'a> From<OpInBoundsPtrAccessChainRef<'a>> for OpInBoundsPtrAccessChain {
+    fn from(v: OpInBoundsPtrAccessChainRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            base: v.base,
+            element: v.element,
+            indexes: v.indexes.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpInBoundsPtrAccessChainRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpInBoundsPtrAccessChainRef<'a>) -> Self {
+        Self::InBoundsPtrAccessChain(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpGroupDecorateRef<'a> {
+    pub decoration_group: IdRef,
+    pub targets: &'a [IdRef],
+}
+impl<'a> From<OpGroupDecorateRef<'a>> for OpGroupDecorate {
+    fn from(v: OpGroupDecorateRef<'a>) -> Self {
+        Self {
+            decoration_group: v.decoration_group,
+            targets: v.targets.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpGroupDecorateRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpGroupDecorateRef<'a>) -> Self {
+        Self::GroupDecorate(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpGroupMemberDecorateRef<'a> {
+    pub decoration_group: IdRef,
+    pub targets: OperandList<'a, PairIdRefLiteralInteger>,
+}
+impl<'a> From<OpGroupMemberDecorateRef<'a>> for OpGroupMemberDecorate {
+    fn from(v: OpGroupMemberDecorateRef<'a>) -> Self {
+        Self {
+            decoration_group: v.decoration_group,
+            targets: v.targets.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpGroupMemberDecorateRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpGroupMemberDecorateRef<'a>) -> Self {
+        Self::GroupMemberDecorate(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpVectorShuffleRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub vector_1: IdRef,
+    pub vector_2: IdRef,
+    pub components: &'a [LiteralInteger32],
+}
+impl<'a> From<OpVectorShuffleRef<'a>> for OpVectorShuffle {
+    fn from(v: OpVectorShuffleRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            vector_1: v.vector_1,
+            vector_2: v.vector_2,
+            components: v.components.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpVectorShuffleRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpVectorShuffleRef<'a>) -> Self {
+        Self::VectorShuffle(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpCompositeConstructRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub constituents: &'a [IdRef],
+}
+impl<'a> From<OpCompositeConstructRef<'a>> for OpCompositeConstruct {
+    fn from(v: OpCompositeConstructRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            constituents: v.constituents.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpCompositeConstructRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpCompositeConstructRef<'a>) -> Self {
+        Self::CompositeConstruct(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpCompositeExtractRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub composite: IdRef,
+    pub indexes: &'a [LiteralInteger32],
+}
+impl<'a> From<OpCompositeExtractRef<'a>> for OpCompositeExtract {
+    fn from(v: OpCompositeExtractRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            composite: v.composite,
+            indexes: v.indexes.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpCompositeExtractRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpCompositeExtractRef<'a>) -> Self {
+        Self::CompositeExtract(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpCompositeInsertRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub object: IdRef,
+    pub composite: IdRef,
+    pub indexes: &'a [LiteralInteger32],
+}
+impl<'a> From<OpCompositeInsertRef<'a>> for OpCompositeInsert {
+    fn from(v: OpCompositeInsertRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            object: v.object,
+            composite: v.composite,
+            indexes: v.indexes.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpCompositeInsertRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpCompositeInsertRef<'a>) -> Self {
+        Self::CompositeInsert(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpPhiRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub variable_parent: OperandList<'a, PairIdRefIdRef>,
+}
+impl<'a> From<OpPhiRef<'a>> for OpPhi {
+    fn from(v: OpPhiRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            variable_parent: v.variable_parent.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpPhiRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpPhiRef<'a>) -> Self {
+        Self::Phi(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpBranchConditionalRef<'a> {
+    pub condition: IdRef,
+    pub true_label: IdRef,
+    pub false_label: IdRef,
+    pub branch_weights: &'a [LiteralInteger32],
+}
+impl<'a> From<OpBranchConditionalRef<'a>> for OpBranchConditional {
+    fn from(v: OpBranchConditionalRef<'a>) -> Self {
+        Self {
+            condition: v.condition,
+            true_label: v.true_label,
+            false_label: v.false_label,
+            branch_weights: v.branch_weights.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpBranchConditionalRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpBranchConditionalRef<'a>) -> Self {
+        Self::BranchConditional(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpSwitch32Ref<'a> {
+    pub selector: IdRef,
+    pub default: IdRef,
+    pub target: OperandList<'a, PairLiteralInteger32IdRef>,
+}
+impl<'a> From<OpSwitch32Ref<'a>> for OpSwitch32 {
+    fn from(v: OpSwitch32Ref<'a>) -> Self {
+        Self {
+            selector: v.selector,
+            default: v.default,
+            target: v.target.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpSwitch32Ref<'a>> for InstructionRef<'a> {
+    fn from(v: OpSwitch32Ref<'a>) -> Self {
+        Self::Switch32(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpSwitch64Ref<'a> {
+    pub selector: IdRef,
+    pub default: IdRef,
+    pub target: OperandList<'a, PairLiteralInteger64IdRef>,
+}
+impl<'a> From<OpSwitch64Ref<'a>> for OpSwitch64 {
+    fn from(v: OpSwitch64Ref<'a>) -> Self {
+        Self {
+            selector: v.selector,
+            default: v.default,
+            target: v.target.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpSwitch64Ref<'a>> for InstructionRef<'a> {
+    fn from(v: OpSwitch64Ref<'a>) -> Self {
+        Self::Switch64(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpEnqueueKernelRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub queue: IdRef,
+    pub flags: IdRef,
+    pub nd_range: IdRef,
+    pub num_events: IdRef,
+    pub wait_events: IdRef,
+    pub ret_event: IdRef,
+    pub invoke: IdRef,
+    pub param: IdRef,
+    pub param_size: IdRef,
+    pub param_align: IdRef,
+    pub local_size: &'a [IdRef],
+}
+impl<'a> From<OpEnqueueKernelRef<'a>> for OpEnqueueKernel {
+    fn from(v: OpEnqueueKernelRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            queue: v.queue,
+            flags: v.flags,
+            nd_range: v.nd_range,
+            num_events: v.num_events,
+            wait_events: v.wait_events,
+            ret_event: v.ret_event,
+            invoke: v.invoke,
+            param: v.param,
+            param_size: v.param_size,
+            param_align: v.param_align,
+            local_size: v.local_size.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpEnqueueKernelRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpEnqueueKernelRef<'a>) -> Self {
+        Self::EnqueueKernel(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpModuleProcessedRef<'a> {
+    pub process: Cow<'a, str>,
+}
+impl<'a> From<OpModuleProcessedRef<'a>> for OpModuleProcessed {
+    fn from(v: OpModuleProcessedRef<'a>) -> Self {
+        Self {
+            process: v.process.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpModuleProcessedRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpModuleProcessedRef<'a>) -> Self {
+        Self::ModuleProcessed(v)
+    }
+}
+#[derive(Clone, Debug)]
+pub struct OpOpenCLStdPrintfRef<'a> {
+    pub id_result_type: IdResultType,
+    pub id_result: IdResult,
+    pub set: IdRef,
+    pub format: IdRef,
+    pub additional_arguments: &'a [IdRef],
+}
+impl<'a> From<OpOpenCLStdPrintfRef<'a>> for OpOpenCLStdPrintf {
+    fn from(v: OpOpenCLStdPrintfRef<'a>) -> Self {
+        Self {
+            id_result_type: v.id_result_type,
+            id_result: v.id_result,
+            set: v.set,
+            format: v.format,
+            additional_arguments: v.additional_arguments.into_owned_operand(),
+        }
+    }
+}
+impl<'a> From<OpOpenCLStdPrintfRef<'a>> for InstructionRef<'a> {
+    fn from(v: OpOpenCLStdPrintfRef<'a>) -> Self {
+        Self::OpenCLStdPrintf(v)
+    }
+}
+#[doc = r" an `Instruction` that borrows its strings and lists of operands from the words"]
+#[doc = r" it was parsed from instead of copying them, returned by `Parser::next_ref`"]
+#[derive(Clone, Debug)]
+pub enum InstructionRef<'a> {
+    Nop(OpNop),
+    Undef(OpUndef),
+    SourceContinued(OpSourceContinuedRef<'a>),
+    Source(OpSourceRef<'a>),
+    SourceExtension(OpSourceExtensionRef<'a>),
+    Name(OpNameRef<'a>),
+    MemberName(OpMemberNameRef<'a>),
+    String(OpStringRef<'a>),
+    Line(OpLine),
+    Extension(OpExtensionRef<'a>),
+    ExtInstImport(OpExtInstImportRef<'a>),
+    ExtInst(OpExtInstRef<'a>),
+    MemoryModel(OpMemoryModel),
+    EntryPoint(OpEntryPointRef<'a>),
+    ExecutionMode(OpExecutionMode),
+    Capability(OpCapability),
+    TypeVoid(OpTypeVoid),
+    TypeBool(OpTypeBool),
+    TypeInt(OpTypeInt),
+    TypeFloat(OpTypeFloat),
+    TypeVector(OpTypeVector),
+    TypeMatrix(OpTypeMatrix),
+    TypeImage(OpTypeImage),
+    TypeSampler(OpTypeSampler),
+    TypeSampledImage(OpTypeSampledImage),
+    TypeArray(OpTypeArray),
+    TypeRuntimeArray(OpTypeRuntimeArray),
+    TypeStruct(OpTypeStructRef<'a>),
+    TypeOpaque(OpTypeOpaqueRef<'a>),
+    TypePointer(OpTypePointer),
+    TypeFunction(OpTypeFunctionRef<'a>),
+    TypeEvent(OpTypeEvent),
+    TypeDeviceEvent(OpTypeDeviceEvent),
+    TypeReserveId(OpTypeReserveId),
+    TypeQueue(OpTypeQueue),
+    TypePipe(OpTypePipe),
+    TypeForwardPointer(OpTypeForwardPointer),
+    ConstantTrue(OpConstantTrue),
+    ConstantFalse(OpConstantFalse),
+    Constant32(OpConstant32),
+    Constant64(OpConstant64),
+    ConstantComposite(OpConstantCompositeRef<'a>),
+    ConstantSampler(OpConstantSampler),
+    ConstantNull(OpConstantNull),
+    SpecConstantTrue(OpSpecConstantTrue),
+    SpecConstantFalse(OpSpecConstantFalse),
+    SpecConstant32(OpSpecConstant32),
+    SpecConstant64(OpSpecConstant64),
+    SpecConstantComposite(OpSpecConstantCompositeRef<'a>),
+    SpecConstantOp(OpSpecConstantOp),
+    Function(OpFunction),
+    FunctionParameter(OpFunctionParameter),
+    FunctionEnd(OpFunctionEnd),
+    FunctionCall(OpFunctionCallRef<'a>),
+    Variable(OpVariable),
+    ImageTexelPointer(OpImageTexelPointer),
+    Load(OpLoad),
+    Store(OpStore),
+    CopyMemory(OpCopyMemory),
+    CopyMemorySized(OpCopyMemorySized),
+    AccessChain(OpAccessChainRef<'a>),
+    InBoundsAccessChain(OpInBoundsAccessChainRef<'a>),
+    PtrAccessChain(OpPtrAccessChainRef<'a>),
+    ArrayLength(OpArrayLength),
+    GenericPtrMemSemantics(OpGenericPtrMemSemantics),
+    InBoundsPtrAccessChain(OpInBoundsPtrAccessChainRef<'a>),
+    Decorate(OpDecorate),
+    MemberDecorate(OpMemberDecorate),
+    DecorationGroup(OpDecorationGroup),
+    GroupDecorate(OpGroupDecorateRef<'a>),
+    GroupMemberDecorate(OpGroupMemberDecorateRef<'a>),
+    VectorExtractDynamic(OpVectorExtractDynamic),
+    VectorInsertDynamic(OpVectorInsertDynamic),
+    VectorShuffle(OpVectorShuffleRef<'a>),
+    CompositeConstruct(OpCompositeConstructRef<'a>),
+    CompositeExtract(OpCompositeExtractRef<'a>),
+    CompositeInsert(OpCompositeInsertRef<'a>),
+    CopyObject(OpCopyObject),
+    Transpose(OpTranspose),
+    SampledImage(OpSampledImage),
+    ImageSampleImplicitLod(OpImageSampleImplicitLod),
+    ImageSampleExplicitLod(OpImageSampleExplicitLod),
+    ImageSampleDrefImplicitLod(OpImageSampleDrefImplicitLod),
+    ImageSampleDrefExplicitLod(OpImageSampleDrefExplicitLod),
+    ImageSampleProjImplicitLod(OpImageSampleProjImplicitLod),
+    ImageSampleProjExplicitLod(OpImageSampleProjExplicitLod),
+    ImageSampleProjDrefImplicitLod(OpImageSampleProjDrefImplicitLod),
+    ImageSampleProjDrefExplicitLod(OpImageSampleProjDrefExplicitLod),
+    ImageFetch(OpImageFetch),
+    ImageGather(OpImageGather),
+    ImageDrefGather(OpImageDrefGather),
+    ImageRead(OpImageRead),
+    ImageWrite(OpImageWrite),
+    Image(OpImage),
+    ImageQueryFormat(OpImageQueryFormat),
+    ImageQueryOrder(OpImageQueryOrder),
+    ImageQuerySizeLod(OpImageQuerySizeLod),
+    ImageQuerySize(OpImageQuerySize),
+    ImageQueryLod(OpImageQueryLod),
+    ImageQueryLevels(OpImageQueryLevels),
+    ImageQuerySamples(OpImageQuerySamples),
+    ConvertFToU(OpConvertFToU),
+    ConvertFToS(OpConvertFToS),
+    ConvertSToF(OpConvertSToF),
+    ConvertUToF(OpConvertUToF),
+    UConvert(OpUConvert),
+    SConvert(OpSConvert),
+    FConvert(OpFConvert),
+    QuantizeToF16(OpQuantizeToF16),
+    ConvertPtrToU(OpConvertPtrToU),
+    SatConvertSToU(OpSatConvertSToU),
+    SatConvertUToS(OpSatConvertUToS),
+    ConvertUToPtr(OpConvertUToPtr),
+    PtrCastToGeneric(OpPtrCastToGeneric),
+    GenericCastToPtr(OpGenericCastToPtr),
+    GenericCastToPtrExplicit(OpGenericCastToPtrExplicit),
+    Bitcast(OpBitcast),
+    SNegate(OpSNegate),
+    FNegate(OpFNegate),
+    IAdd(OpIAdd),
+    FAdd(OpFAdd),
+    ISub(OpISub),
+    FSub(OpFSub),
+    IMul(OpIMul),
+    FMul(OpFMul),
+    UDiv(OpUDiv),
+    SDiv(OpSDiv),
+    FDiv(OpFDiv),
+    UMod(OpUMod),
+    SRem(OpSRem),
+    SMod(OpSMod),
+    FRem(OpFRem),
+    FMod(OpFMod),
+    VectorTimesScalar(OpVectorTimesScalar),
+    MatrixTimesScalar(OpMatrixTimesScalar),
+    VectorTimesMatrix(OpVectorTimesMatrix),
+    MatrixTimesVector(OpMatrixTimesVector),
+    MatrixTimesMatrix(OpMatrixTimesMatrix),
+    OuterProduct(OpOuterProduct),
+    Dot(OpDot),
+    IAddCarry(OpIAddCarry),
+    ISubBorrow(OpISubBorrow),
+    UMulExtended(OpUMulExtended),
+    SMulExtended(OpSMulExtended),
+    Any(OpAny),
+    All(OpAll),
+    IsNan(OpIsNan),
+    IsInf(OpIsInf),
+    IsFinite(OpIsFinite),
+    IsNormal(OpIsNormal),
+    SignBitSet(OpSignBitSet),
+    LessOrGreater(OpLessOrGreater),
+    Ordered(OpOrdered),
+    Unordered(OpUnordered),
+    LogicalEqual(OpLogicalEqual),
+    LogicalNotEqual(OpLogicalNotEqual),
+    LogicalOr(OpLogicalOr),
+    LogicalAnd(OpLogicalAnd),
+    LogicalNot(OpLogicalNot),
+    Select(OpSelect),
+    IEqual(OpIEqual),
+    INotEqual(OpINotEqual),
+    UGreaterThan(OpUGreaterThan),
+    SGreaterThan(OpSGreaterThan),
+    UGreaterThanEqual(OpUGreaterThanEqual),
+    SGreaterThanEqual(OpSGreaterThanEqual),
+    ULessThan(OpULessThan),
+    SLessThan(OpSLessThan),
+    ULessThanEqual(OpULessThanEqual),
+    SLessThanEqual(OpSLessThanEqual),
+    FOrdEqual(OpFOrdEqual),
+    FUnordEqual(OpFUnordEqual),
+    FOrdNotEqual(OpFOrdNotEqual),
+    FUnordNotEqual(OpFUnordNotEqual),
+    FOrdLessThan(OpFOrdLessThan),
+    FUnordLessThan(OpFUnordLessThan),
+    FOrdGreaterThan(OpFOrdGreaterThan),
+    FUnordGreaterThan(OpFUnordGreaterThan),
+    FOrdLessThanEqual(OpFOrdLessThanEqual),
+    FUnordLessThanEqual(OpFUnordLessThanEqual),
+    FOrdGreaterThanEqual(OpFOrdGreaterThanEqual),
+    FUnordGreaterThanEqual(OpFUnordGreaterThanEqual),
+    ShiftRightLogical(OpShiftRightLogical),
+    ShiftRightArithmetic(OpShiftRightArithmetic),
+    ShiftLeftLogical(OpShiftLeftLogical),
+    BitwiseOr(OpBitwiseOr),
+    BitwiseXor(OpBitwiseXor),
+    BitwiseAnd(OpBitwiseAnd),
+    Not(OpNot),
+    BitFieldInsert(OpBitFieldInsert),
+    BitFieldSExtract(OpBitFieldSExtract),
+    BitFieldUExtract(OpBitFieldUExtract),
+    BitReverse(OpBitReverse),
+    BitCount(OpBitCount),
+    DPdx(OpDPdx),
+    DPdy(OpDPdy),
+    Fwidth(OpFwidth),
+    DPdxFine(OpDPdxFine),
+    DPdyFine(OpDPdyFine),
+    FwidthFine(OpFwidthFine),
+    DPdxCoarse(OpDPdxCoarse),
+    DPdyCoarse(OpDPdyCoarse),
+    FwidthCoarse(OpFwidthCoarse),
+    EmitVertex(OpEmitVertex),
+    EndPrimitive(OpEndPrimitive),
+    EmitStreamVertex(OpEmitStreamVertex),
+    EndStreamPrimitive(OpEndStreamPrimitive),
+    ControlBarrier(OpControlBarrier),
+    MemoryBarrier(OpMemoryBarrier),
+    AtomicLoad(OpAtomicLoad),
+    AtomicStore(OpAtomicStore),
+    AtomicExchange(OpAtomicExchange),
+    AtomicCompareExchange(OpAtomicCompareExchange),
+    AtomicCompareExchangeWeak(OpAtomicCompareExchangeWeak),
+    AtomicIIncrement(OpAtomicIIncrement),
+    AtomicIDecrement(OpAtomicIDecrement),
+    AtomicIAdd(OpAtomicIAdd),
+    AtomicISub(OpAtomicISub),
+    AtomicSMin(OpAtomicSMin),
+    AtomicUMin(OpAtomicUMin),
+    AtomicSMax(OpAtomicSMax),
+    AtomicUMax(OpAtomicUMax),
+    AtomicAnd(OpAtomicAnd),
+    AtomicOr(OpAtomicOr),
+    AtomicXor(OpAtomicXor),
+    Phi(OpPhiRef<'a>),
+    LoopMerge(OpLoopMerge),
+    SelectionMerge(OpSelectionMerge),
+    Label(OpLabel),
+    Branch(OpBranch),
+    BranchConditional(OpBranchConditionalRef<'a>),
+    Switch32(OpSwitch32Ref<'a>),
+    Switch64(OpSwitch64Ref<'a>),
+    Kill(OpKill),
+    Return(OpReturn),
+    ReturnValue(OpReturnValue),
+    Unreachable(OpUnreachable),
+    LifetimeStart(OpLifetimeStart),
+    LifetimeStop(OpLifetimeStop),
+    GroupAsyncCopy(OpGroupAsyncCopy),
+    GroupWaitEvents(OpGroupWaitEvents),
+    GroupAll(OpGroupAll),
+    GroupAny(OpGroupAny),
+    GroupBroadcast(OpGroupBroadcast),
+    GroupIAdd(OpGroupIAdd),
+    GroupFAdd(OpGroupFAdd),
+    GroupFMin(OpGroupFMin),
+    GroupUMin(OpGroupUMin),
+    GroupSMin(OpGroupSMin),
+    GroupFMax(OpGroupFMax),
+    GroupUMax(OpGroupUMax),
+    GroupSMax(OpGroupSMax),
+    ReadPipe(OpReadPipe),
+    WritePipe(OpWritePipe),
+    ReservedReadPipe(OpReservedReadPipe),
+    ReservedWritePipe(OpReservedWritePipe),
+    ReserveReadPipePackets(OpReserveReadPipePackets),
+    ReserveWritePipePackets(OpReserveWritePipePackets),
+    CommitReadPipe(OpCommitReadPipe),
+    CommitWritePipe(OpCommitWritePipe),
+    IsValidReserveId(OpIsValidReserveId),
+    GetNumPipePackets(OpGetNumPipePackets),
+    GetMaxPipePackets(OpGetMaxPipePackets),
+    GroupReserveReadPipePackets(OpGroupReserveReadPipePackets),
+    GroupReserveWritePipePackets(OpGroupReserveWritePipePackets),
+    GroupCommitReadPipe(OpGroupCommitReadPipe),
+    GroupCommitWritePipe(OpGroupCommitWritePipe),
+    EnqueueMarker(OpEnqueueMarker),
+    EnqueueKernel(OpEnqueueKernelRef<'a>),
+    GetKernelNDrangeSubGroupCount(OpGetKernelNDrangeSubGroupCount),
+    GetKernelNDrangeMaxSubGroupSize(OpGetKernelNDrangeMaxSubGroupSize),
+    GetKernelWorkGroupSize(OpGetKernelWorkGroupSize),
+    GetKernelPreferredWorkGroupSizeMultiple(OpGetKernelPreferredWorkGroupSizeMultiple),
+    RetainEvent(OpRetainEvent),
+    ReleaseEvent(OpReleaseEvent),
+    CreateUserEvent(OpCreateUserEvent),
+    IsValidEvent(OpIsValidEvent),
+    SetUserEventStatus(OpSetUserEventStatus),
+    CaptureEventProfilingInfo(OpCaptureEventProfilingInfo),
+    GetDefaultQueue(OpGetDefaultQueue),
+    BuildNDRange(OpBuildNDRange),
+    ImageSparseSampleImplicitLod(OpImageSparseSampleImplicitLod),
+    ImageSparseSampleExplicitLod(OpImageSparseSampleExplicitLod),
+    ImageSparseSampleDrefImplicitLod(OpImageSparseSampleDrefImplicitLod),
+    ImageSparseSampleDrefExplicitLod(OpImageSparseSampleDrefExplicitLod),
+    ImageSparseFetch(OpImageSparseFetch),
+    ImageSparseGather(OpImageSparseGather),
+    ImageSparseDrefGather(OpImageSparseDrefGather),
+    ImageSparseTexelsResident(OpImageSparseTexelsResident),
+    NoLine(OpNoLine),
+    AtomicFlagTestAndSet(OpAtomicFlagTestAndSet),
+    AtomicFlagClear(OpAtomicFlagClear),
+    ImageSparseRead(OpImageSparseRead),
+    SizeOf(OpSizeOf),
+    TypePipeStorage(OpTypePipeStorage),
+    ConstantPipeStorage(OpConstantPipeStorage),
+    CreatePipeFromPipeStorage(OpCreatePipeFromPipeStorage),
+    GetKernelLocalSizeForSubgroupCount(OpGetKernelLocalSizeForSubgroupCount),
+    GetKernelMaxNumSubgroups(OpGetKernelMaxNumSubgroups),
+    TypeNamedBarrier(OpTypeNamedBarrier),
+    NamedBarrierInitialize(OpNamedBarrierInitialize),
+    MemoryNamedBarrier(OpMemoryNamedBarrier),
+    ModuleProcessed(OpModuleProcessedRef<'a>),
+    ExecutionModeId(OpExecutionModeId),
+    DecorateId(OpDecorateId),
+    GroupNonUniformElect(OpGroupNonUniformElect),
+    GroupNonUniformAll(OpGroupNonUniformAll),
+    GroupNonUniformAny(OpGroupNonUniformAny),
+    GroupNonUniformAllEqual(OpGroupNonUniformAllEqual),
+    GroupNonUniformBroadcast(OpGroupNonUniformBroadcast),
+    GroupNonUniformBroadcastFirst(OpGroupNonUniformBroadcastFirst),
+    GroupNonUniformBallot(OpGroupNonUniformBallot),
+    GroupNonUniformInverseBallot(OpGroupNonUniformInverseBallot),
+    GroupNonUniformBallotBitExtract(OpGroupNonUniformBallotBitExtract),
+    GroupNonUniformBallotBitCount(OpGroupNonUniformBallotBitCount),
+    GroupNonUniformBallotFindLSB(OpGroupNonUniformBallotFindLSB),
+    GroupNonUniformBallotFindMSB(OpGroupNonUniformBallotFindMSB),
+    GroupNonUniformShuffle(OpGroupNonUniformShuffle),
+    GroupNonUniformShuffleXor(OpGroupNonUniformShuffleXor),
+    GroupNonUniformShuffleUp(OpGroupNonUniformShuffleUp),
+    GroupNonUniformShuffleDown(OpGroupNonUniformShuffleDown),
+    GroupNonUniformIAdd(OpGroupNonUniformIAdd),
+    GroupNonUniformFAdd(OpGroupNonUniformFAdd),
+    GroupNonUniformIMul(OpGroupNonUniformIMul),
+    GroupNonUniformFMul(OpGroupNonUniformFMul),
+    GroupNonUniformSMin(OpGroupNonUniformSMin),
+    GroupNonUniformUMin(OpGroupNonUniformUMin),
+    GroupNonUniformFMin(OpGroupNonUniformFMin),
+    GroupNonUniformSMax(OpGroupNonUniformSMax),
+    GroupNonUniformUMax(OpGroupNonUniformUMax),
+    GroupNonUniformFMax(OpGroupNonUniformFMax),
+    GroupNonUniformBitwiseAnd(OpGroupNonUniformBitwiseAnd),
+    GroupNonUniformBitwiseOr(OpGroupNonUniformBitwiseOr),
+    GroupNonUniformBitwiseXor(OpGroupNonUniformBitwiseXor),
+    GroupNonUniformLogicalAnd(OpGroupNonUniformLogicalAnd),
+    GroupNonUniformLogicalOr(OpGroupNonUniformLogicalOr),
+    GroupNonUniformLogicalXor(OpGroupNonUniformLogicalXor),
+    GroupNonUniformQuadBroadcast(OpGroupNonUniformQuadBroadcast),
+    GroupNonUniformQuadSwap(OpGroupNonUniformQuadSwap),
+    CopyLogical(OpCopyLogical),
+    PtrEqual(OpPtrEqual),
+    PtrNotEqual(OpPtrNotEqual),
+    PtrDiff(OpPtrDiff),
+    DecorateString(OpDecorateString),
+    MemberDecorateString(OpMemberDecorateString),
+    OpenCLStdAcos(OpOpenCLStdAcos),
+    OpenCLStdAcosh(OpOpenCLStdAcosh),
+    OpenCLStdAcospi(OpOpenCLStdAcospi),
+    OpenCLStdAsin(OpOpenCLStdAsin),
+    OpenCLStdAsinh(OpOpenCLStdAsinh),
+    OpenCLStdAsinpi(OpOpenCLStdAsinpi),
+    OpenCLStdAtan(OpOpenCLStdAtan),
+    OpenCLStdAtan2(OpOpenCLStdAtan2),
+    OpenCLStdAtanh(OpOpenCLStdAtanh),
+    OpenCLStdAtanpi(OpOpenCLStdAtanpi),
+    OpenCLStdAtan2pi(OpOpenCLStdAtan2pi),
+    OpenCLStdCbrt(OpOpenCLStdCbrt),
+    OpenCLStdCeil(OpOpenCLStdCeil),
+    OpenCLStdCopysign(OpOpenCLStdCopysign),
+    OpenCLStdCos(OpOpenCLStdCos),
+    OpenCLStdCosh(OpOpenCLStdCosh),
+    OpenCLStdCospi(OpOpenCLStdCospi),
+    OpenCLStdErfc(OpOpenCLStdErfc),
+    OpenCLStdErf(OpOpenCLStdErf),
+    OpenCLStdExp(OpOpenCLStdExp),
+    OpenCLStdExp2(OpOpenCLStdExp2),
+    OpenCLStdExp10(OpOpenCLStdExp10),
+    OpenCLStdExpm1(OpOpenCLStdExpm1),
+    OpenCLStdFabs(OpOpenCLStdFabs),
+    OpenCLStdFdim(OpOpenCLStdFdim),
+    OpenCLStdFloor(OpOpenCLStdFloor),
+    OpenCLStdFma(OpOpenCLStdFma),
+    OpenCLStdFmax(OpOpenCLStdFmax),
+    OpenCLStdFmin(OpOpenCLStdFmin),
+    OpenCLStdFmod(OpOpenCLStdFmod),
+    OpenCLStdFract(OpOpenCLStdFract),
+    OpenCLStdFrexp(OpOpenCLStdFrexp),
+    OpenCLStdHypot(OpOpenCLStdHypot),
+    OpenCLStdIlogb(OpOpenCLStdIlogb),
+    OpenCLStdLdexp(OpOpenCLStdLdexp),
+    OpenCLStdLgamma(OpOpenCLStdLgamma),
+    OpenCLStdLgammaR(OpOpenCLStdLgammaR),
+    OpenCLStdLog(OpOpenCLStdLog),
+    OpenCLStdLog2(OpOpenCLStdLog2),
+    OpenCLStdLog10(OpOpenCLStdLog10),
+    OpenCLStdLog1p(OpOpenCLStdLog1p),
+    OpenCLStdLogb(OpOpenCLStdLogb),
+    OpenCLStdMad(OpOpenCLStdMad),
+    OpenCLStdMaxmag(OpOpenCLStdMaxmag),
+    OpenCLStdMinmag(OpOpenCLStdMinmag),
+    OpenCLStdModf(OpOpenCLStdModf),
+    OpenCLStdNan(OpOpenCLStdNan),
+    OpenCLStdNextafter(OpOpenCLStdNextafter),
+    OpenCLStdPow(OpOpenCLStdPow),
+    OpenCLStdPown(OpOpenCLStdPown),
+    OpenCLStdPowr(OpOpenCLStdPowr),
+    OpenCLStdRemainder(OpOpenCLStdRemainder),
+    OpenCLStdRemquo(OpOpenCLStdRemquo),
+    OpenCLStdRint(OpOpenCLStdRint),
+    OpenCLStdRootn(OpOpenCLStdRootn),
+    OpenCLStdRound(OpOpenCLStdRound),
+    OpenCLStdRsqrt(OpOpenCLStdRsqrt),
+    OpenCLStdSin(OpOpenCLStdSin),
+    OpenCLStdSincos(OpOpenCLStdSincos),
+    OpenCLStdSinh(OpOpenCLStdSinh),
+    OpenCLStdSinpi(OpOpenCLStdSinpi),
+    OpenCLStdSqrt(OpOpenCLStdSqrt),
+    OpenCLStdTan(OpOpenCLStdTan),
+    OpenCLStdTanh(OpOpenCLStdTanh),
+    OpenCLStdTanpi(OpOpenCLStdTanpi),
+    OpenCLStdTgamma(OpOpenCLStdTgamma),
+    OpenCLStdTrunc(OpOpenCLStdTrunc),
+    OpenCLStdHalfCos(OpOpenCLStdHalfCos),
+    OpenCLStdHalfDivide(OpOpenCLStdHalfDivide),
+    OpenCLStdHalfExp(OpOpenCLStdHalfExp),
+    OpenCLStdHalfExp2(OpOpenCLStdHalfExp2),
+    OpenCLStdHalfExp10(OpOpenCLStdHalfExp10),
+    OpenCLStdHalfLog(OpOpenCLStdHalfLog),
+    OpenCLStdHalfLog2(OpOpenCLStdHalfLog2),
+    OpenCLStdHalfLog10(OpOpenCLStdHalfLog10),
+    OpenCLStdHalfPowr(OpOpenCLStdHalfPowr),
+    OpenCLStdHalfRecip(OpOpenCLStdHalfRecip),
+    OpenCLStdHalfRsqrt(OpOpenCLStdHalfRsqrt),
+    OpenCLStdHalfSin(OpOpenCLStdHalfSin),
+    OpenCLStdHalfSqrt(OpOpenCLStdHalfSqrt),
+    OpenCLStdHalfTan(OpOpenCLStdHalfTan),
+    OpenCLStdNativeCos(OpOpenCLStdNativeCos),
+    OpenCLStdNativeDivide(OpOpenCLStdNativeDivide),
+    OpenCLStdNativeExp(OpOpenCLStdNativeExp),
+    OpenCLStdNativeExp2(OpOpenCLStdNativeExp2),
+    OpenCLStdNativeExp10(OpOpenCLStdNativeExp10),
+    OpenCLStdNativeLog(OpOpenCLStdNativeLog),
+    OpenCLStdNativeLog2(OpOpenCLStdNativeLog2),
+    OpenCLStdNativeLog10(OpOpenCLStdNativeLog10),
+    OpenCLStdNativePowr(OpOpenCLStdNativePowr),
+    OpenCLStdNativeRecip(OpOpenCLStdNativeRecip),
+    OpenCLStdNativeRsqrt(OpOpenCLStdNativeRsqrt),
+    OpenCLStdNativeSin(OpOpenCLStdNativeSin),
+    OpenCLStdNativeSqrt(OpOpenCLStdNativeSqrt),
+    OpenCLStdNativeTan(OpOpenCLStdNativeTan),
+    OpenCLStdSAbs(OpOpenCLStdSAbs),
+    OpenCLStdSAbsDiff(OpOpenCLStdSAbsDiff),
+    OpenCLStdSAddSat(OpOpenCLStdSAddSat),
+    OpenCLStdUAddSat(OpOpenCLStdUAddSat),
+    OpenCLStdSHadd(OpOpenCLStdSHadd),
+    OpenCLStdUHadd(OpOpenCLStdUHadd),
+    OpenCLStdSRhadd(OpOpenCLStdSRhadd),
+    OpenCLStdURhadd(OpOpenCLStdURhadd),
+    OpenCLStdSClamp(OpOpenCLStdSClamp),
+    OpenCLStdUClamp(OpOpenCLStdUClamp),
+    OpenCLStdClz(OpOpenCLStdClz),
+    OpenCLStdCtz(OpOpenCLStdCtz),
+    OpenCLStdSMadHi(OpOpenCLStdSMadHi),
+    OpenCLStdUMadSat(OpOpenCLStdUMadSat),
+    OpenCLStdSMadSat(OpOpenCLStdSMadSat),
+    OpenCLStdSMax(OpOpenCLStdSMax),
+    OpenCLStdUMax(OpOpenCLStdUMax),
+    OpenCLStdSMin(OpOpenCLStdSMin),
+    OpenCLStdUMin(OpOpenCLStdUMin),
+    OpenCLStdSMulHi(OpOpenCLStdSMulHi),
+    OpenCLStdRotate(OpOpenCLStdRotate),
+    OpenCLStdSSubSat(OpOpenCLStdSSubSat),
+    OpenCLStdUSubSat(OpOpenCLStdUSubSat),
+    OpenCLStdUUpsample(OpOpenCLStdUUpsample),
+    OpenCLStdSUpsample(OpOpenCLStdSUpsample),
+    OpenCLStdPopcount(OpOpenCLStdPopcount),
+    OpenCLStdSMad24(OpOpenCLStdSMad24),
+    OpenCLStdUMad24(OpOpenCLStdUMad24),
+    OpenCLStdSMul24(OpOpenCLStdSMul24),
+    OpenCLStdUMul24(OpOpenCLStdUMul24),
+    OpenCLStdUAbs(OpOpenCLStdUAbs),
+    OpenCLStdUAbsDiff(OpOpenCLStdUAbsDiff),
+    OpenCLStdUMulHi(OpOpenCLStdUMulHi),
+    OpenCLStdUMadHi(OpOpenCLStdUMadHi),
+    OpenCLStdFclamp(OpOpenCLStdFclamp),
+    OpenCLStdDegrees(OpOpenCLStdDegrees),
+    OpenCLStdFmaxCommon(OpOpenCLStdFmaxCommon),
+    OpenCLStdFminCommon(OpOpenCLStdFminCommon),
+    OpenCLStdMix(OpOpenCLStdMix),
+    OpenCLStdRadians(OpOpenCLStdRadians),
+    OpenCLStdStep(OpOpenCLStdStep),
+    OpenCLStdSmoothstep(OpOpenCLStdSmoothstep),
+    OpenCLStdSign(OpOpenCLStdSign),
+    OpenCLStdCross(OpOpenCLStdCross),
+    OpenCLStdDistance(OpOpenCLStdDistance),
+    OpenCLStdLength(OpOpenCLStdLength),
+    OpenCLStdNormalize(OpOpenCLStdNormalize),
+    OpenCLStdFastDistance(OpOpenCLStdFastDistance),
+    OpenCLStdFastLength(OpOpenCLStdFastLength),
+    OpenCLStdFastNormalize(OpOpenCLStdFastNormalize),
+    OpenCLStdBitselect(OpOpenCLStdBitselect),
+    OpenCLStdSelect(OpOpenCLStdSelect),
+    OpenCLStdVloadn(OpOpenCLStdVloadn),
+    OpenCLStdVstoren(OpOpenCLStdVstoren),
+    OpenCLStdVloadHalf(OpOpenCLStdVloadHalf),
+    OpenCLStdVloadHalfn(OpOpenCLStdVloadHalfn),
+    OpenCLStdVstoreHalf(OpOpenCLStdVstoreHalf),
+    OpenCLStdVstoreHalfR(OpOpenCLStdVstoreHalfR),
+    OpenCLStdVstoreHalfn(OpOpenCLStdVstoreHalfn),
+    OpenCLStdVstoreHalfnR(OpOpenCLStdVstoreHalfnR),
+    OpenCLStdVloadaHalfn(OpOpenCLStdVloadaHalfn),
+    OpenCLStdVstoreaHalfn(OpOpenCLStdVstoreaHalfn),
+    OpenCLStdVstoreaHalfnR(OpOpenCLStdVstoreaHalfnR),
+    OpenCLStdShuffle(OpOpenCLStdShuffle),
+    OpenCLStdShuffle2(OpOpenCLStdShuffle2),
+    OpenCLStdPrintf(OpOpenCLStdPrintfRef<'a>),
+    OpenCLStdPrefetch(OpOpenCLStdPrefetch),
+    GLSLStd450Round(OpGLSLStd450Round),
+    GLSLStd450RoundEven(OpGLSLStd450RoundEven),
+    GLSLStd450Trunc(OpGLSLStd450Trunc),
+    GLSLStd450FAbs(OpGLSLStd450FAbs),
+    GLSLStd450SAbs(OpGLSLStd450SAbs),
+    GLSLStd450FSign(OpGLSLStd450FSign),
+    GLSLStd450SSign(OpGLSLStd450SSign),
+    GLSLStd450Floor(OpGLSLStd450Floor),
+    GLSLStd450Ceil(OpGLSLStd450Ceil),
+    GLSLStd450Fract(OpGLSLStd450Fract),
+    GLSLStd450Radians(OpGLSLStd450Radians),
+    GLSLStd450Degrees(OpGLSLStd450Degrees),
+    GLSLStd450Sin(OpGLSLStd450Sin),
+    GLSLStd450Cos(OpGLSLStd450Cos),
+    GLSLStd450Tan(OpGLSLStd450Tan),
+    GLSLStd450Asin(OpGLSLStd450Asin),
+    GLSLStd450Acos(OpGLSLStd450Acos),
+    GLSLStd450Atan(OpGLSLStd450Atan),
+    GLSLStd450Sinh(OpGLSLStd450Sinh),
+    GLSLStd450Cosh(OpGLSLStd450Cosh),
+    GLSLStd450Tanh(OpGLSLStd450Tanh),
+    GLSLStd450Asinh(OpGLSLStd450Asinh),
+    GLSLStd450Acosh(OpGLSLStd450Acosh),
+    GLSLStd450Atanh(OpGLSLStd450Atanh),
+    GLSLStd450Atan2(OpGLSLStd450Atan2),
+    GLSLStd450Pow(OpGLSLStd450Pow),
+    GLSLStd450Exp(OpGLSLStd450Exp),
+    GLSLStd450Log(OpGLSLStd450Log),
+    GLSLStd450Exp2(OpGLSLStd450Exp2),
+    GLSLStd450Log2(OpGLSLStd450Log2),
+    GLSLStd450Sqrt(OpGLSLStd450Sqrt),
+    GLSLStd450InverseSqrt(OpGLSLStd450InverseSqrt),
+    GLSLStd450Determinant(OpGLSLStd450Determinant),
+    GLSLStd450MatrixInverse(OpGLSLStd450MatrixInverse),
+    GLSLStd450Modf(OpGLSLStd450Modf),
+    GLSLStd450ModfStruct(OpGLSLStd450ModfStruct),
+    GLSLStd450FMin(OpGLSLStd450FMin),
+    GLSLStd450UMin(OpGLSLStd450UMin),
+    GLSLStd450SMin(OpGLSLStd450SMin),
+    GLSLStd450FMax(OpGLSLStd450FMax),
+    GLSLStd450UMax(OpGLSLStd450UMax),
+    GLSLStd450SMax(OpGLSLStd450SMax),
+    GLSLStd450FClamp(OpGLSLStd450FClamp),
+    GLSLStd450UClamp(OpGLSLStd450UClamp),
+    GLSLStd450SClamp(OpGLSLStd450SClamp),
+    GLSLStd450FMix(OpGLSLStd450FMix),
+    GLSLStd450IMix(OpGLSLStd450IMix),
+    GLSLStd450Step(OpGLSLStd450Step),
+    GLSLStd450SmoothStep(OpGLSLStd450SmoothStep),
+    GLSLStd450Fma(OpGLSLStd450Fma),
+    GLSLStd450Frexp(OpGLSLStd450Frexp),
+    GLSLStd450FrexpStruct(OpGLSLStd450FrexpStruct),
+    GLSLStd450Ldexp(OpGLSLStd450Ldexp),
+    GLSLStd450PackSnorm4x8(OpGLSLStd450PackSnorm4x8),
+    GLSLStd450PackUnorm4x8(OpGLSLStd450PackUnorm4x8),
+    GLSLStd450PackSnorm2x16(OpGLSLStd450PackSnorm2x16),
+    GLSLStd450PackUnorm2x16(OpGLSLStd450PackUnorm2x16),
+    GLSLStd450PackHalf2x16(OpGLSLStd450PackHalf2x16),
+    GLSLStd450PackDouble2x32(OpGLSLStd450PackDouble2x32),
+    GLSLStd450UnpackSnorm2x16(OpGLSLStd450UnpackSnorm2x16),
+    GLSLStd450UnpackUnorm2x16(OpGLSLStd450UnpackUnorm2x16),
+    GLSLStd450UnpackHalf2x16(OpGLSLStd450UnpackHalf2x16),
+    GLSLStd450UnpackSnorm4x8(OpGLSLStd450UnpackSnorm4x8),
+    GLSLStd450UnpackUnorm4x8(OpGLSLStd450UnpackUnorm4x8),
+    GLSLStd450UnpackDouble2x32(OpGLSLStd450UnpackDouble2x32),
+    GLSLStd450Length(OpGLSLStd450Length),
+    GLSLStd450Distance(OpGLSLStd450Distance),
+    GLSLStd450Cross(OpGLSLStd450Cross),
+    GLSLStd450Normalize(OpGLSLStd450Normalize),
+    GLSLStd450FaceForward(OpGLSLStd450FaceForward),
+    GLSLStd450Reflect(OpGLSLStd450Reflect),
+    GLSLStd450Refract(OpGLSLStd450Refract),
+    GLSLStd450FindILsb(OpGLSLStd450FindILsb),
+    GLSLStd450FindSMsb(OpGLSLStd450FindSMsb),
+    GLSLStd450FindUMsb(OpGLSLStd450FindUMsb),
+    GLSLStd450InterpolateAtCentroid(OpGLSLStd450InterpolateAtCentroid),
+    GLSLStd450InterpolateAtSample(OpGLSLStd450InterpolateAtSample),
+    GLSLStd450InterpolateAtOffset(OpGLSLStd450InterpolateAtOffset),
+    GLSLStd450NMin(OpGLSLStd450NMin),
+    GLSLStd450NMax(OpGLSLStd450NMax),
+    GLSLStd450NClamp(OpGLSLStd450NClamp),
+}
+impl<'a> From<InstructionRef<'a>> for Instruction {
+    fn from(v: InstructionRef<'a>) -> Self {
+        match v {
+            InstructionRef::Nop(v) => Instruction::Nop(v),
+            InstructionRef::Undef(v) => Instruction::Undef(v),
+            InstructionRef::SourceContinued(v) => Instruction::SourceContinued(v.into()),
+            InstructionRef::Source(v) => Instruction::Source(v.into()),
+            InstructionRef::SourceExtension(v) => Instruction::SourceExtension(v.into()),
+            InstructionRef::Name(v) => Instruction::Name(v.into()),
+            InstructionRef::MemberName(v) => Instruction::MemberName(v.into()),
+            InstructionRef::String(v) => Instruction::String(v.into()),
+            InstructionRef::Line(v) => Instruction::Line(v),
+            InstructionRef::Extension(v) => Instruction::Extension(v.into()),
+            InstructionRef::ExtInstImport(v) => Instruction::ExtInstImport(v.into()),
+            InstructionRef::ExtInst(v) => Instruction::ExtInst(v.into()),
+            InstructionRef::MemoryModel(v) => Instruction::MemoryModel(v),
+            InstructionRef::EntryPoint(v) => Instruction::EntryPoint(v.into()),
+            InstructionRef::ExecutionMode(v) => Instruction::ExecutionMode(v),
+            InstructionRef::Capability(v) => Instruction::Capability(v),
+            InstructionRef::TypeVoid(v) => Instruction::TypeVoid(v),
+            InstructionRef::TypeBool(v) => Instruction::TypeBool(v),
+            InstructionRef::TypeInt(v) => Instruction::TypeInt(v),
+            InstructionRef::TypeFloat(v) => Instruction::TypeFloat(v),
+            InstructionRef::TypeVector(v) => Instruction::TypeVector(v),
+            InstructionRef::TypeMatrix(v) => Instruction::TypeMatrix(v),
+            InstructionRef::TypeImage(v) => Instruction::TypeImage(v),
+            InstructionRef::TypeSampler(v) => Instruction::TypeSampler(v),
+            InstructionRef::TypeSampledImage(v) => Instruction::TypeSampledImage(v),
+            InstructionRef::TypeArray(v) => Instruction::TypeArray(v),
+            InstructionRef::TypeRuntimeArray(v) => Instruction::TypeRuntimeArray(v),
+            InstructionRef::TypeStruct(v) => Instruction::TypeStruct(v.into()),
+            InstructionRef::TypeOpaque(v) => Instruction::TypeOpaque(v.into()),
+            InstructionRef::TypePointer(v) => Instruction::TypePointer(v),
+            InstructionRef::TypeFunction(v) => Instruction::TypeFunction(v.into()),
+            InstructionRef::TypeEvent(v) => Instruction::TypeEvent(v),
+            InstructionRef::TypeDeviceEvent(v) => Instruction::TypeDeviceEvent(v),
+            InstructionRef::TypeReserveId(v) => Instruction::TypeReserveId(v),
+            InstructionRef::TypeQueue(v) => Instruction::TypeQueue(v),
+            InstructionRef::TypePipe(v) => Instruction::TypePipe(v),
+            InstructionRef::TypeForwardPointer(v) => Instruction::TypeForwardPointer(v),
+            InstructionRef::ConstantTrue(v) => Instruction::ConstantTrue(v),
+            InstructionRef::ConstantFalse(v) => Instruction::ConstantFalse(v),
+            InstructionRef::Constant32(v) => Instruction::Constant32(v),
+            InstructionRef::Constant64(v) => Instruction::Constant64(v),
+            InstructionRef::ConstantComposite(v) => Instruction::ConstantComposite(v.into()),
+            InstructionRef::ConstantSampler(v) => Instruction::ConstantSampler(v),
+            InstructionRef::ConstantNull(v) => Instruction::ConstantNull(v),
+            InstructionRef::SpecConstantTrue(v) => Instruction::SpecConstantTrue(v),
+            InstructionRef::SpecConstantFalse(v) => Instruction::SpecConstantFalse(v),
+            InstructionRef::SpecConstant32(v) => Instruction::SpecConstant32(v),
+            InstructionRef::SpecConstant64(v) => Instruction::SpecConstant64(v),
+            InstructionRef::SpecConstantComposite(v) => {
+                Instruction::SpecConstantComposite(v.into())
+            }
+            InstructionRef::SpecConstantOp(v) => Instruction::SpecConstantOp(v),
+            InstructionRef::Function(v) => Instruction::Function(v),
+            InstructionRef::FunctionParameter(v) => Instruction::FunctionParameter(v),
+            InstructionRef::FunctionEnd(v) => Instruction::FunctionEnd(v),
+            InstructionRef::FunctionCall(v) => Instruction::FunctionCall(v.into()),
+            InstructionRef::Variable(v) => Instruction::Variable(v),
+            InstructionRef::ImageTexelPointer(v) => Instruction::ImageTexelPointer(v),
+            InstructionRef::Load(v) => Instruction::Load(v),
+            InstructionRef::Store(v) => Instruction::Store(v),
+            InstructionRef::CopyMemory(v) => Instruction::CopyMemory(v),
+            InstructionRef::CopyMemorySized(v) => Instruction::CopyMemorySized(v),
+            InstructionRef::AccessChain(v) => Instruction::AccessChain(v.into()),
+            InstructionRef::InBoundsAccessChain(v) => Instruction::InBoundsAccessChain(v.into()),
+            InstructionRef::PtrAccessChain(v) => Instruction::PtrAccessChain(v.into()),
+            InstructionRef::ArrayLength(v) => Instruction::ArrayLength(v),
+            InstructionRef::GenericPtrMemSemantics(v) => Instruction::GenericPtrMemSemantics(v),
+            InstructionRef::InBoundsPtrAccessChain(v) => {
+                Instruction::InBoundsPtrAccessChain(v.into())
+            }
+            InstructionRef::Decorate(v) => Instruction::Decorate(v),
+            InstructionRef::MemberDecorate(v) => Instruction::MemberDecorate(v),
+            InstructionRef::DecorationGroup(v) => Instruction::DecorationGroup(v),
+            InstructionRef::GroupDecorate(v) => Instruction::GroupDecorate(v.into()),
+            InstructionRef::GroupMemberDecorate(v) => Instruction::GroupMemberDecorate(v.into()),
+            InstructionRef::VectorExtractDynamic(v) => Instruction::VectorExtractDynamic(v),
+            InstructionRef::VectorInsertDynamic(v) => Instruction::VectorInsertDynamic(v),
+            InstructionRef::VectorShuffle(v) => Instruction::VectorShuffle(v.into()),
+            InstructionRef::CompositeConstruct(v) => Instruction::CompositeConstruct(v.into()),
+            InstructionRef::CompositeExtract(v) => Instruction::CompositeExtract(v.into()),
+            InstructionRef::CompositeInsert(v) => Instruction::CompositeInsert(v.into()),
+            InstructionRef::CopyObject(v) => Instruction::CopyObject(v),
+            InstructionRef::Transpose(v) => Instruction::Transpose(v),
+            InstructionRef::SampledImage(v) => Instruction::SampledImage(v),
+            InstructionRef::ImageSampleImplicitLod(v) => Instruction::ImageSampleImplicitLod(v),
+            InstructionRef::ImageSampleExplicitLod(v) => Instruction::ImageSampleExplicitLod(v),
+            InstructionRef::ImageSampleDrefImplicitLod(v) => {
+                Instruction::ImageSampleDrefImplicitLod(v)
+            }
+            InstructionRef::ImageSampleDrefExplicitLod(v) => {
+                Instruction::ImageSampleDrefExplicitLod(v)
+            }
+            InstructionRef::ImageSampleProjImplicitLod(v) => {
+                Instruction::ImageSampleProjImplicitLod(v)
+            }
+            InstructionRef::ImageSampleProjExplicitLod(v) => {
+                Instruction::ImageSampleProjExplicitLod(v)
+            }
+            InstructionRef::ImageSampleProjDrefImplicitLod(v) => {
+                Instruction::ImageSampleProjDrefImplicitLod(v)
+            }
+            InstructionRef::ImageSampleProjDrefExplicitLod(v) => {
+                Instruction::ImageSampleProjDrefExplicitLod(v)
+            }
+            InstructionRef::ImageFetch(v) => Instruction::ImageFetch(v),
+            InstructionRef::ImageGather(v) => Instruction::ImageGather(v),
+            InstructionRef::ImageDrefGather(v) => Instruction::ImageDrefGather(v),
+            InstructionRef::ImageRead(v) => Instruction::ImageRead(v),
+            InstructionRef::ImageWrite(v) => Instruction::ImageWrite(v),
+            InstructionRef::Image(v) => Instruction::Image(v),
+            InstructionRef::ImageQueryFormat(v) => Instruction::ImageQueryFormat(v),
+            InstructionRef::ImageQueryOrder(v) => Instruction::ImageQueryOrder(v),
+            InstructionRef::ImageQuerySizeLod(v) => Instruction::ImageQuerySizeLod(v),
+            InstructionRef::ImageQuerySize(v) => Instruction::ImageQuerySize(v),
+            InstructionRef::ImageQueryLod(v) => Instruction::ImageQueryLod(v),
+            InstructionRef::ImageQueryLevels(v) => Instruction::ImageQueryLevels(v),
+            InstructionRef::ImageQuerySamples(v) => Instruction::ImageQuerySamples(v),
+            InstructionRef::ConvertFToU(v) => Instruction::ConvertFToU(v),
+            InstructionRef::ConvertFToS(v) => Instruction::ConvertFToS(v),
+            InstructionRef::ConvertSToF(v) => Instruction::ConvertSToF(v),
+            InstructionRef::ConvertUToF(v) => Instruction::ConvertUToF(v),
+            InstructionRef::UConvert(v) => Instruction::UConvert(v),
+            InstructionRef::SConvert(v) => Instruction::SConvert(v),
+            InstructionRef::FConvert(v) => Instruction::FConvert(v),
+            InstructionRef::QuantizeToF16(v) => Instruction::QuantizeToF16(v),
+            InstructionRef::ConvertPtrToU(v) => Instruction::ConvertPtrToU(v),
+            InstructionRef::SatConvertSToU(v) => Instruction::SatConvertSToU(v),
+            InstructionRef::SatConvertUToS(v) => Instruction::SatConvertUToS(v),
+            InstructionRef::ConvertUToPtr(v) => Instruction::ConvertUToPtr(v),
+            InstructionRef::PtrCastToGeneric(v) => Instruction::PtrCastToGeneric(v),
+            InstructionRef::GenericCastToPtr(v) => Instruction::GenericCastToPtr(v),
+            InstructionRef::GenericCastToPtrExplicit(v) => Instruction::GenericCastToPtrExplicit(v),
+            InstructionRef::Bitcast(v) => Instruction::Bitcast(v),
+            InstructionRef::SNegate(v) => Instruction::SNegate(v),
+            InstructionRef::FNegate(v) => Instruction::FNegate(v),
+            InstructionRef::IAdd(v) => Instruction::IAdd(v),
+            InstructionRef::FAdd(v) => Instruction::FAdd(v),
+            InstructionRef::ISub(v) => Instruction::ISub(v),
+            InstructionRef::FSub(v) => Instruction::FSub(v),
+            InstructionRef::IMul(v) => Instruction::IMul(v),
+            InstructionRef::FMul(v) => Instruction::FMul(v),
+            InstructionRef::UDiv(v) => Instruction::UDiv(v),
+            InstructionRef::SDiv(v) => Instruction::SDiv(v),
+            InstructionRef::FDiv(v) => Instruction::FDiv(v),
+            InstructionRef::UMod(v) => Instruction::UMod(v),
+            InstructionRef::SRem(v) => Instruction::SRem(v),
+            InstructionRef::SMod(v) => Instruction::SMod(v),
+            InstructionRef::FRem(v) => Instruction::FRem(v),
+            InstructionRef::FMod(v) => Instruction::FMod(v),
+            InstructionRef::VectorTimesScalar(v) => Instruction::VectorTimesScalar(v),
+            InstructionRef::MatrixTimesScalar(v) => Instruction::MatrixTimesScalar(v),
+            InstructionRef::VectorTimesMatrix(v) => Instruction::VectorTimesMatrix(v),
+            InstructionRef::MatrixTimesVector(v) => Instruction::MatrixTimesVector(v),
+            InstructionRef::MatrixTimesMatrix(v) => Instruction::MatrixTimesMatrix(v),
+            InstructionRef::OuterProduct(v) => Instruction::OuterProduct(v),
+            InstructionRef::Dot(v) => Instruction::Dot(v),
+            InstructionRef::IAddCarry(v) => Instruction::IAddCarry(v),
+            InstructionRef::ISubBorrow(v) => Instruction::ISubBorrow(v),
+            InstructionRef::UMulExtended(v) => Instruction::UMulExtended(v),
+            InstructionRef::SMulExtended(v) => Instruction::SMulExtended(v),
+            InstructionRef::Any(v) => Instruction::Any(v),
+            InstructionRef::All(v) => Instruction::All(v),
+            InstructionRef::IsNan(v) => Instruction::IsNan(v),
+            InstructionRef::IsInf(v) => Instruction::IsInf(v),
+            InstructionRef::IsFinite(v) => Instruction::IsFinite(v),
+            InstructionRef::IsNormal(v) => Instruction::IsNormal(v),
+            InstructionRef::SignBitSet(v) => Instruction::SignBitSet(v),
+            InstructionRef::LessOrGreater(v) => Instruction::LessOrGreater(v),
+            InstructionRef::Ordered(v) => Instruction::Ordered(v),
+            InstructionRef::Unordered(v) => Instruction::Unordered(v),
+            InstructionRef::LogicalEqual(v) => Instruction::LogicalEqual(v),
+            InstructionRef::LogicalNotEqual(v) => Instruction::LogicalNotEqual(v),
+            InstructionRef::LogicalOr(v) => Instruction::LogicalOr(v),
+            InstructionRef::LogicalAnd(v) => Instruction::LogicalAnd(v),
+            InstructionRef::LogicalNot(v) => Instruction::LogicalNot(v),
+            InstructionRef::Select(v) => Instruction::Select(v),
+            InstructionRef::IEqual(v) => Instruction::IEqual(v),
+            InstructionRef::INotEqual(v) => Instruction::INotEqual(v),
+            InstructionRef::UGreaterThan(v) => Instruction::UGreaterThan(v),
+            InstructionRef::SGreaterThan(v) => Instruction::SGreaterThan(v),
+            InstructionRef::UGreaterThanEqual(v) => Instruction::UGreaterThanEqual(v),
+            InstructionRef::SGreaterThanEqual(v) => Instruction::SGreaterThanEqual(v),
+            InstructionRef::ULessThan(v) => Instruction::ULessThan(v),
+            InstructionRef::SLessThan(v) => Instruction::SLessThan(v),
+            InstructionRef::ULessThanEqual(v) => Instruction::ULessThanEqual(v),
+            InstructionRef::SLessThanEqual(v) => Instruction::SLessThanEqual(v),
+            InstructionRef::FOrdEqual(v) => Instruction::FOrdEqual(v),
+            InstructionRef::FUnordEqual(v) => Instruction::FUnordEqual(v),
+            InstructionRef::FOrdNotEqual(v) => Instruction::FOrdNotEqual(v),
+            InstructionRef::FUnordNotEqual(v) => Instruction::FUnordNotEqual(v),
+            InstructionRef::FOrdLessThan(v) => Instruction::FOrdLessThan(v),
+            InstructionRef::FUnordLessThan(v) => Instruction::FUnordLessThan(v),
+            InstructionRef::FOrdGreaterThan(v) => Instruction::FOrdGreaterThan(v),
+            InstructionRef::FUnordGreaterThan(v) => Instruction::FUnordGreaterThan(v),
+            InstructionRef::FOrdLessThanEqual(v) => Instruction::FOrdLessThanEqual(v),
+            InstructionRef::FUnordLessThanEqual(v) => Instruction::FUnordLessThanEqual(v),
+            InstructionRef::FOrdGreaterThanEqual(v) => Instruction::FOrdGreaterThanEqual(v),
+            InstructionRef::FUnordGreaterThanEqual(v) => Instruction::FUnordGreaterThanEqual(v),
+            InstructionRef::ShiftRightLogical(v) => Instruction::ShiftRightLogical(v),
+            InstructionRef::ShiftRightArithmetic(v) => Instruction::ShiftRightArithmetic(v),
+            InstructionRef::ShiftLeftLogical(v) => Instruction::ShiftLeftLogical(v),
+            InstructionRef::BitwiseOr(v) => Instruction::BitwiseOr(v),
+            InstructionRef::BitwiseXor(v) => Instruction::BitwiseXor(v),
+            InstructionRef::BitwiseAnd(v) => Instruction::BitwiseAnd(v),
+            InstructionRef::Not(v) => Instruction::Not(v),
+            InstructionRef::BitFieldInsert(v) => Instruction::BitFieldInsert(v),
+            InstructionRef::BitFieldSExtract(v) => Instruction::BitFieldSExtract(v),
+            InstructionRef::BitFieldUExtract(v) => Instruction::BitFieldUExtract(v),
+            InstructionRef::BitReverse(v) => Instruction::BitReverse(v),
+            InstructionRef::BitCount(v) => Instruction::BitCount(v),
+            InstructionRef::DPdx(v) => Instruction::DPdx(v),
+            InstructionRef::DPdy(v) => Instruction::DPdy(v),
+            InstructionRef::Fwidth(v) => Instruction::Fwidth(v),
+            InstructionRef::DPdxFine(v) => Instruction::DPdxFine(v),
+            InstructionRef::DPdyFine(v) => Instruction::DPdyFine(v),
+            InstructionRef::FwidthFine(v) => Instruction::FwidthFine(v),
+            InstructionRef::DPdxCoarse(v) => Instruction::DPdxCoarse(v),
+            InstructionRef::DPdyCoarse(v) => Instruction::DPdyCoarse(v),
+            InstructionRef::FwidthCoarse(v) => Instruction::FwidthCoarse(v),
+            InstructionRef::EmitVertex(v) => Instruction::EmitVertex(v),
+            InstructionRef::EndPrimitive(v) => Instruction::EndPrimitive(v),
+            InstructionRef::EmitStreamVertex(v) => Instruction::EmitStreamVertex(v),
+            InstructionRef::EndStreamPrimitive(v) => Instruction::EndStreamPrimitive(v),
+            InstructionRef::ControlBarrier(v) => Instruction::ControlBarrier(v),
+            InstructionRef::MemoryBarrier(v) => Instruction::MemoryBarrier(v),
+            InstructionRef::AtomicLoad(v) => Instruction::AtomicLoad(v),
+            InstructionRef::AtomicStore(v) => Instruction::AtomicStore(v),
+            InstructionRef::AtomicExchange(v) => Instruction::AtomicExchange(v),
+            InstructionRef::AtomicCompareExchange(v) => Instruction::AtomicCompareExchange(v),
+            InstructionRef::AtomicCompareExchangeWeak(v) => {
+                Instruction::AtomicCompareExchangeWeak(v)
+            }
+            InstructionRef::AtomicIIncrement(v) => Instruction::AtomicIIncrement(v),
+            InstructionRef::AtomicIDecrement(v) => Instruction::AtomicIDecrement(v),
+            InstructionRef::AtomicIAdd(v) => Instruction::AtomicIAdd(v),
+            InstructionRef::AtomicISub(v) => Instruction::AtomicISub(v),
+            InstructionRef::AtomicSMin(v) => Instruction::AtomicSMin(v),
+            InstructionRef::AtomicUMin(v) => Instruction::AtomicUMin(v),
+            InstructionRef::AtomicSMax(v) => Instruction::AtomicSMax(v),
+            InstructionRef::AtomicUMax(v) => Instruction::AtomicUMax(v),
+            InstructionRef::AtomicAnd(v) => Instruction::AtomicAnd(v),
+            InstructionRef::AtomicOr(v) => Instruction::AtomicOr(v),
+            InstructionRef::AtomicXor(v) => Instruction::AtomicXor(v),
+            InstructionRef::Phi(v) => Instruction::Phi(v.into()),
+            InstructionRef::LoopMerge(v) => Instruction::LoopMerge(v),
+            InstructionRef::SelectionMerge(v) => Instruction::SelectionMerge(v),
+            InstructionRef::Label(v) => Instruction::Label(v),
+            InstructionRef::Branch(v) => Instruction::Branch(v),
+            InstructionRef::BranchConditional(v) => Instruction::BranchConditional(v.into()),
+            InstructionRef::Switch32(v) => Instruction::Switch32(v.into()),
+            InstructionRef::Switch64(v) => Instruction::Switch64(v.into()),
+            InstructionRef::Kill(v) => Instruction::Kill(v),
+            InstructionRef::Return(v) => Instruction::Return(v),
+            InstructionRef::ReturnValue(v) => Instruction::ReturnValue(v),
+            InstructionRef::Unreachable(v) => Instruction::Unreachable(v),
+            InstructionRef::LifetimeStart(v) => Instruction::LifetimeStart(v),
+            InstructionRef::LifetimeStop(v) => Instruction::LifetimeStop(v),
+            InstructionRef::GroupAsyncCopy(v) => Instruction::GroupAsyncCopy(v),
+            InstructionRef::GroupWaitEvents(v) => Instruction::GroupWaitEvents(v),
+            InstructionRef::GroupAll(v) => Instruction::GroupAll(v),
+            InstructionRef::GroupAny(v) => Instruction::GroupAny(v),
+            InstructionRef::GroupBroadcast(v) => Instruction::GroupBroadcast(v),
+            InstructionRef::GroupIAdd(v) => Instruction::GroupIAdd(v),
+            InstructionRef::GroupFAdd(v) => Instruction::GroupFAdd(v),
+            InstructionRef::GroupFMin(v) => Instruction::GroupFMin(v),
+            InstructionRef::GroupUMin(v) => Instruction::GroupUMin(v),
+            InstructionRef::GroupSMin(v) => Instruction::GroupSMin(v),
+            InstructionRef::GroupFMax(v) => Instruction::GroupFMax(v),
+            InstructionRef::GroupUMax(v) => Instruction::GroupUMax(v),
+            InstructionRef::GroupSMax(v) => Instruction::GroupSMax(v),
+            InstructionRef::ReadPipe(v) => Instruction::ReadPipe(v),
+            InstructionRef::WritePipe(v) => Instruction::WritePipe(v),
+            InstructionRef::ReservedReadPipe(v) => Instruction::ReservedReadPipe(v),
+            InstructionRef::ReservedWritePipe(v) => Instruction::ReservedWritePipe(v),
+            InstructionRef::ReserveReadPipePackets(v) => Instruction::ReserveReadPipePackets(v),
+            InstructionRef::ReserveWritePipePackets(v) => Instruction::ReserveWritePipePackets(v),
+            InstructionRef::CommitReadPipe(v) => Instruction::CommitReadPipe(v),
+            InstructionRef::CommitWritePipe(v) => Instruction::CommitWritePipe(v),
+            InstructionRef::IsValidReserveId(v) => Instruction::IsValidReserveId(v),
+            InstructionRef::GetNumPipePackets(v) => Instruction::GetNumPipePackets(v),
+            InstructionRef::GetMaxPipePackets(v) => Instruction::GetMaxPipePackets(v),
+            InstructionRef::GroupReserveReadPipePackets(v) => {
+                Instruction::GroupReserveReadPipePackets(v)
+            }
+            InstructionRef::GroupReserveWritePipePackets(v) => {
+                Instruction::GroupReserveWritePipePackets(v)
+            }
+            InstructionRef::GroupCommitReadPipe(v) => Instruction::GroupCommitReadPipe(v),
+            InstructionRef::GroupCommitWritePipe(v) => Instruction::GroupCommitWritePipe(v),
+            InstructionRef::EnqueueMarker(v) => Instruction::EnqueueMarker(v),
+            InstructionRef::EnqueueKernel(v) => Instruction::EnqueueKernel(v.into()),
+            InstructionRef::GetKernelNDrangeSubGroupCount(v) => {
+                Instruction::GetKernelNDrangeSubGroupCount(v)
+            }
+            InstructionRef::GetKernelNDrangeMaxSubGroupSize(v) => {
+                Instruction::GetKernelNDrangeMaxSubGroupSize(v)
+            }
+            InstructionRef::GetKernelWorkGroupSize(v) => Instruction::GetKernelWorkGroupSize(v),
+            InstructionRef::GetKernelPreferredWorkGroupSizeMultiple(v) => {
+                Instruction::GetKernelPreferredWorkGroupSizeMultiple(v)
+            }
+            InstructionRef::RetainEvent(v) => Instruction::RetainEvent(v),
+            InstructionRef::ReleaseEvent(v) => Instruction::ReleaseEvent(v),
+            InstructionRef::CreateUserEvent(v) => Instruction::CreateUserEvent(v),
+            InstructionRef::IsValidEvent(v) => Instruction::IsValidEvent(v),
+            InstructionRef::SetUserEventStatus(v) => Instruction::SetUserEventStatus(v),
+            InstructionRef::CaptureEventProfilingInfo(v) => {
+                Instruction::CaptureEventProfilingInfo(v)
+            }
+            InstructionRef::GetDefaultQueue(v) => Instruction::GetDefaultQueue(v),
+            InstructionRef::BuildNDRange(v) => Instruction::BuildNDRange(v),
+            InstructionRef::ImageSparseSampleImplicitLod(v) => {
+                Instruction::ImageSparseSampleImplicitLod(v)
+            }
+            InstructionRef::ImageSparseSampleExplicitLod(v) => {
+                Instruction::ImageSparseSampleExplicitLod(v)
+            }
+            InstructionRef::ImageSparseSampleDrefImplicitLod(v) => {
+                Instruction::ImageSparseSampleDrefImplicitLod(v)
+            }
+            InstructionRef::ImageSparseSampleDrefExplicitLod(v) => {
+                Instruction::ImageSparseSampleDrefExplicitLod(v)
+            }
+            InstructionRef::ImageSparseFetch(v) => Instruction::ImageSparseFetch(v),
+            InstructionRef::ImageSparseGather(v) => Instruction::ImageSparseGather(v),
+            InstructionRef::ImageSparseDrefGather(v) => Instruction::ImageSparseDrefGather(v),
+            InstructionRef::ImageSparseTexelsResident(v) => {
+                Instruction::ImageSparseTexelsResident(v)
+            }
+            InstructionRef::NoLine(v) => Instruction::NoLine(v),
+            InstructionRef::AtomicFlagTestAndSet(v) => Instruction::AtomicFlagTestAndSet(v),
+            InstructionRef::AtomicFlagClear(v) => Instruction::AtomicFlagClear(v),
+            InstructionRef::ImageSparseRead(v) => Instruction::ImageSparseRead(v),
+            InstructionRef::SizeOf(v) => Instruction::SizeOf(v),
+            InstructionRef::TypePipeStorage(v) => Instruction::TypePipeStorage(v),
+            InstructionRef::ConstantPipeStorage(v) => Instruction::ConstantPipeStorage(v),
+            InstructionRef::CreatePipeFromPipeStorage(v) => {
+                Instruction::CreatePipeFromPipeStorage(v)
+            }
+            InstructionRef::GetKernelLocalSizeForSubgroupCount(v) => {
+                Instruction::GetKernelLocalSizeForSubgroupCount(v)
+            }
+            InstructionRef::GetKernelMaxNumSubgroups(v) => Instruction::GetKernelMaxNumSubgroups(v),
+            InstructionRef::TypeNamedBarrier(v) => Instruction::TypeNamedBarrier(v),
+            InstructionRef::NamedBarrierInitialize(v) => Instruction::NamedBarrierInitialize(v),
+            InstructionRef::MemoryNamedBarrier(v) => Instruction::MemoryNamedBarrier(v),
+            InstructionRef::ModuleProcessed(v) => Instruction::ModuleProcessed(v.into()),
+            InstructionRef::ExecutionModeId(v) => Instruction::ExecutionModeId(v),
+            InstructionRef::DecorateId(v) => Instruction::DecorateId(v),
+            InstructionRef::GroupNonUniformElect(v) => Instruction::GroupNonUniformElect(v),
+            InstructionRef::GroupNonUniformAll(v) => Instruction::GroupNonUniformAll(v),
+            InstructionRef::GroupNonUniformAny(v) => Instruction::GroupNonUniformAny(v),
+            InstructionRef::GroupNonUniformAllEqual(v) => Instruction::GroupNonUniformAllEqual(v),
+            InstructionRef::GroupNonUniformBroadcast(v) => Instruction::GroupNonUniformBroadcast(v),
+            InstructionRef::GroupNonUniformBroadcastFirst(v) => {
+                Instruction::GroupNonUniformBroadcastFirst(v)
+            }
+            InstructionRef::GroupNonUniformBallot(v) => Instruction::GroupNonUniformBallot(v),
+            InstructionRef::GroupNonUniformInverseBallot(v) => {
+                Instruction::GroupNonUniformInverseBallot(v)
+            }
+            InstructionRef::GroupNonUniformBallotBitExtract(v) => {
+                Instruction::GroupNonUniformBallotBitExtract(v)
+            }
+            InstructionRef::GroupNonUniformBallotBitCount(v) => {
+                Instruction::GroupNonUniformBallotBitCount(v)
+            }
+            InstructionRef::GroupNonUniformBallotFindLSB(v) => {
+                Instruction::GroupNonUniformBallotFindLSB(v)
+            }
+            InstructionRef::GroupNonUniformBallotFindMSB(v) => {
+                Instruction::GroupNonUniformBallotFindMSB(v)
+            }
+            InstructionRef::GroupNonUniformShuffle(v) => Instruction::GroupNonUniformShuffle(v),
+            InstructionRef::GroupNonUniformShuffleXor(v) => {
+                Instruction::GroupNonUniformShuffleXor(v)
+            }
+            InstructionRef::GroupNonUniformShuffleUp(v) => Instruction::GroupNonUniformShuffleUp(v),
+            InstructionRef::GroupNonUniformShuffleDown(v) => {
+                Instruction::GroupNonUniformShuffleDown(v)
+            }
+            InstructionRef::GroupNonUniformIAdd(v) => Instruction::GroupNonUniformIAdd(v),
+            InstructionRef::GroupNonUniformFAdd(v) => Instruction::GroupNonUniformFAdd(v),
+            InstructionRef::GroupNonUniformIMul(v) => Instruction::GroupNonUniformIMul(v),
+            InstructionRef::GroupNonUniformFMul(v) => Instruction::GroupNonUniformFMul(v),
+            InstructionRef::GroupNonUniformSMin(v) => Instruction::GroupNonUniformSMin(v),
+            InstructionRef::GroupNonUniformUMin(v) => Instruction::GroupNonUniformUMin(v),
+            InstructionRef::GroupNonUniformFMin(v) => Instruction::GroupNonUniformFMin(v),
+            InstructionRef::GroupNonUniformSMax(v) => Instruction::GroupNonUniformSMax(v),
+            InstructionRef::GroupNonUniformUMax(v) => Instruction::GroupNonUniformUMax(v),
+            InstructionRef::GroupNonUniformFMax(v) => Instruction::GroupNonUniformFMax(v),
+            InstructionRef::GroupNonUniformBitwiseAnd(v) => {
+                Instruction::GroupNonUniformBitwiseAnd(v)
+            }
+            InstructionRef::GroupNonUniformBitwiseOr(v) => Instruction::GroupNonUniformBitwiseOr(v),
+            InstructionRef::GroupNonUniformBitwiseXor(v) => {
+                Instruction::GroupNonUniformBitwiseXor(v)
+            }
+            InstructionRef::GroupNonUniformLogicalAnd(v) => {
+                Instruction::GroupNonUniformLogicalAnd(v)
+            }
+            InstructionRef::GroupNonUniformLogicalOr(v) => Instruction::GroupNonUniformLogicalOr(v),
+            InstructionRef::GroupNonUniformLogicalXor(v) => {
+                Instruction::GroupNonUniformLogicalXor(v)
+            }
+            InstructionRef::GroupNonUniformQuadBroadcast(v) => {
+                Instruction::GroupNonUniformQuadBroadcast(v)
+            }
+            InstructionRef::GroupNonUniformQuadSwap(v) => Instruction::GroupNonUniformQuadSwap(v),
+            InstructionRef::CopyLogical(v) => Instruction::CopyLogical(v),
+            InstructionRef::PtrEqual(v) => Instruction::PtrEqual(v),
+            InstructionRef::PtrNotEqual(v) => Instruction::PtrNotEqual(v),
+            InstructionRef::PtrDiff(v) => Instruction::PtrDiff(v),
+            InstructionRef::DecorateString(v) => Instruction::DecorateString(v),
+            InstructionRef::MemberDecorateString(v) => Instruction::MemberDecorateString(v),
+            InstructionRef::OpenCLStdAcos(v) => Instruction::OpenCLStdAcos(v),
+            InstructionRef::OpenCLStdAcosh(v) => Instruction::OpenCLStdAcosh(v),
+            InstructionRef::OpenCLStdAcospi(v) => Instruction::OpenCLStdAcospi(v),
+            InstructionRef::OpenCLStdAsin(v) => Instruction::OpenCLStdAsin(v),
+            InstructionRef::OpenCLStdAsinh(v) => Instruction::OpenCLStdAsinh(v),
+            InstructionRef::OpenCLStdAsinpi(v) => Instruction::OpenCLStdAsinpi(v),
+            InstructionRef::OpenCLStdAtan(v) => Instruction::OpenCLStdAtan(v),
+            InstructionRef::OpenCLStdAtan2(v) => Instruction::OpenCLStdAtan2(v),
+            InstructionRef::OpenCLStdAtanh(v) => Instruction::OpenCLStdAtanh(v),
+            InstructionRef::OpenCLStdAtanpi(v) => Instruction::OpenCLStdAtanpi(v),
+            InstructionRef::OpenCLStdAtan2pi(v) => Instruction::OpenCLStdAtan2pi(v),
+            InstructionRef::OpenCLStdCbrt(v) => Instruction::OpenCLStdCbrt(v),
+            InstructionRef::OpenCLStdCeil(v) => Instruction::OpenCLStdCeil(v),
+            InstructionRef::OpenCLStdCopysign(v) => Instruction::OpenCLStdCopysign(v),
+            InstructionRef::OpenCLStdCos(v) => Instruction::OpenCLStdCos(v),
+            InstructionRef::OpenCLStdCosh(v) => Instruction::OpenCLStdCosh(v),
+            InstructionRef::OpenCLStdCospi(v) => Instruction::OpenCLStdCospi(v),
+            InstructionRef::OpenCLStdErfc(v) => Instruction::OpenCLStdErfc(v),
+            InstructionRef::OpenCLStdErf(v) => Instruction::OpenCLStdErf(v),
+            InstructionRef::OpenCLStdExp(v) => Instruction::OpenCLStdExp(v),
+            InstructionRef::OpenCLStdExp2(v) => Instruction::OpenCLStdExp2(v),
+            InstructionRef::OpenCLStdExp10(v) => Instruction::OpenCLStdExp10(v),
+            InstructionRef::OpenCLStdExpm1(v) => Instruction::OpenCLStdExpm1(v),
+            InstructionRef::OpenCLStdFabs(v) => Instruction::OpenCLStdFabs(v),
+            InstructionRef::OpenCLStdFdim(v) => Instruction::OpenCLStdFdim(v),
+            InstructionRef::OpenCLStdFloor(v) => Instruction::OpenCLStdFloor(v),
+            InstructionRef::OpenCLStdFma(v) => Instruction::OpenCLStdFma(v),
+            InstructionRef::OpenCLStdFmax(v) => Instruction::OpenCLStdFmax(v),
+            InstructionRef::OpenCLStdFmin(v) => Instruction::OpenCLStdFmin(v),
+            InstructionRef::OpenCLStdFmod(v) => Instruction::OpenCLStdFmod(v),
+            InstructionRef::OpenCLStdFract(v) => Instruction::OpenCLStdFract(v),
+            InstructionRef::OpenCLStdFrexp(v) => Instruction::OpenCLStdFrexp(v),
+            InstructionRef::OpenCLStdHypot(v) => Instruction::OpenCLStdHypot(v),
+            InstructionRef::OpenCLStdIlogb(v) => Instruction::OpenCLStdIlogb(v),
+            InstructionRef::OpenCLStdLdexp(v) => Instruction::OpenCLStdLdexp(v),
+            InstructionRef::OpenCLStdLgamma(v) => Instruction::OpenCLStdLgamma(v),
+            InstructionRef::OpenCLStdLgammaR(v) => Instruction::OpenCLStdLgammaR(v),
+            InstructionRef::OpenCLStdLog(v) => Instruction::OpenCLStdLog(v),
+            InstructionRef::OpenCLStdLog2(v) => Instruction::OpenCLStdLog2(v),
+            InstructionRef::OpenCLStdLog10(v) => Instruction::OpenCLStdLog10(v),
+            InstructionRef::OpenCLStdLog1p(v) => Instruction::OpenCLStdLog1p(v),
+            InstructionRef::OpenCLStdLogb(v) => Instruction::OpenCLStdLogb(v),
+            InstructionRef::OpenCLStdMad(v) => Instruction::OpenCLStdMad(v),
+            InstructionRef::OpenCLStdMaxmag(v) => Instruction::OpenCLStdMaxmag(v),
+            InstructionRef::OpenCLStdMinmag(v) => Instruction::OpenCLStdMinmag(v),
+            InstructionRef::OpenCLStdModf(v) => Instruction::OpenCLStdModf(v),
+            InstructionRef::OpenCLStdNan(v) => Instruction::OpenCLStdNan(v),
+            InstructionRef::OpenCLStdNextafter(v) => Instruction::OpenCLStdNextafter(v),
+            InstructionRef::OpenCLStdPow(v) => Instruction::OpenCLStdPow(v),
+            InstructionRef::OpenCLStdPown(v) => Instruction::OpenCLStdPown(v),
+            InstructionRef::OpenCLStdPowr(v) => Instruction::OpenCLStdPowr(v),
+            InstructionRef::OpenCLStdRemainder(v) => Instruction::OpenCLStdRemainder(v),
+            InstructionRef::OpenCLStdRemquo(v) => Instruction::OpenCLStdRemquo(v),
+            InstructionRef::OpenCLStdRint(v) => Instruction::OpenCLStdRint(v),
+            InstructionRef::OpenCLStdRootn(v) => Instruction::OpenCLStdRootn(v),
+            InstructionRef::OpenCLStdRound(v) => Instruction::OpenCLStdRound(v),
+            InstructionRef::OpenCLStdRsqrt(v) => Instruction::OpenCLStdRsqrt(v),
+            InstructionRef::OpenCLStdSin(v) => Instruction::OpenCLStdSin(v),
+            InstructionRef::OpenCLStdSincos(v) => Instruction::OpenCLStdSincos(v),
+            InstructionRef::OpenCLStdSinh(v) => Instruction::OpenCLStdSinh(v),
+            InstructionRef::OpenCLStdSinpi(v) => Instruction::OpenCLStdSinpi(v),
+            InstructionRef::OpenCLStdSqrt(v) => Instruction::OpenCLStdSqrt(v),
+            InstructionRef::OpenCLStdTan(v) => Instruction::OpenCLStdTan(v),
+            InstructionRef::OpenCLStdTanh(v) => Instruction::OpenCLStdTanh(v),
+            InstructionRef::OpenCLStdTanpi(v) => Instruction::OpenCLStdTanpi(v),
+            InstructionRef::OpenCLStdTgamma(v) => Instruction::OpenCLStdTgamma(v),
+            InstructionRef::OpenCLStdTrunc(v) => Instruction::OpenCLStdTrunc(v),
+            InstructionRef::OpenCLStdHalfCos(v) => Instruction::OpenCLStdHalfCos(v),
+            InstructionRef::OpenCLStdHalfDivide(v) => Instruction::OpenCLStdHalfDivide(v),
+            InstructionRef::OpenCLStdHalfExp(v) => Instruction::OpenCLStdHalfExp(v),
+            InstructionRef::OpenCLStdHalfExp2(v) => Instruction::OpenCLStdHalfExp2(v),
+            InstructionRef::OpenCLStdHalfExp10(v) => Instruction::OpenCLStdHalfExp10(v),
+            InstructionRef::OpenCLStdHalfLog(v) => Instruction::OpenCLStdHalfLog(v),
+            InstructionRef::OpenCLStdHalfLog2(v) => Instruction::OpenCLStdHalfLog2(v),
+            InstructionRef::OpenCLStdHalfLog10(v) => Instruction::OpenCLStdHalfLog10(v),
+            InstructionRef::OpenCLStdHalfPowr(v) => Instruction::OpenCLStdHalfPowr(v),
+            InstructionRef::OpenCLStdHalfRecip(v) => Instruction::OpenCLStdHalfRecip(v),
+            InstructionRef::OpenCLStdHalfRsqrt(v) => Instruction::OpenCLStdHalfRsqrt(v),
+            InstructionRef::OpenCLStdHalfSin(v) => Instruction::OpenCLStdHalfSin(v),
+            InstructionRef::OpenCLStdHalfSqrt(v) => Instruction::OpenCLStdHalfSqrt(v),
+            InstructionRef::OpenCLStdHalfTan(v) => Instruction::OpenCLStdHalfTan(v),
+            InstructionRef::OpenCLStdNativeCos(v) => Instruction::OpenCLStdNativeCos(v),
+            InstructionRef::OpenCLStdNativeDivide(v) => Instruction::OpenCLStdNativeDivide(v),
+            InstructionRef::OpenCLStdNativeExp(v) => Instruction::OpenCLStdNativeExp(v),
+            InstructionRef::OpenCLStdNativeExp2(v) => Instruction::OpenCLStdNativeExp2(v),
+            InstructionRef::OpenCLStdNativeExp10(v) => Instruction::OpenCLStdNativeExp10(v),
+            InstructionRef::OpenCLStdNativeLog(v) => Instruction::OpenCLStdNativeLog(v),
+            InstructionRef::OpenCLStdNativeLog2(v) => Instruction::OpenCLStdNativeLog2(v),
+            InstructionRef::OpenCLStdNativeLog10(v) => Instruction::OpenCLStdNativeLog10(v),
+            InstructionRef::OpenCLStdNativePowr(v) => Instruction::OpenCLStdNativePowr(v),
+            InstructionRef::OpenCLStdNativeRecip(v) => Instruction::OpenCLStdNativeRecip(v),
+            InstructionRef::OpenCLStdNativeRsqrt(v) => Instruction::OpenCLStdNativeRsqrt(v),
+            InstructionRef::OpenCLStdNativeSin(v) => Instruction::OpenCLStdNativeSin(v),
+            InstructionRef::OpenCLStdNativeSqrt(v) => Instruction::OpenCLStdNativeSqrt(v),
+            InstructionRef::OpenCLStdNativeTan(v) => Instruction::OpenCLStdNativeTan(v),
+            InstructionRef::OpenCLStdSAbs(v) => Instruction::OpenCLStdSAbs(v),
+            InstructionRef::OpenCLStdSAbsDiff(v) => Instruction::OpenCLStdSAbsDiff(v),
+            InstructionRef::OpenCLStdSAddSat(v) => Instruction::OpenCLStdSAddSat(v),
+            InstructionRef::OpenCLStdUAddSat(v) => Instruction::OpenCLStdUAddSat(v),
+            InstructionRef::OpenCLStdSHadd(v) => Instruction::OpenCLStdSHadd(v),
+            InstructionRef::OpenCLStdUHadd(v) => Instruction::OpenCLStdUHadd(v),
+            InstructionRef::OpenCLStdSRhadd(v) => Instruction::OpenCLStdSRhadd(v),
+            InstructionRef::OpenCLStdURhadd(v) => Instruction::OpenCLStdURhadd(v),
+            InstructionRef::OpenCLStdSClamp(v) => Instruction::OpenCLStdSClamp(v),
+            InstructionRef::OpenCLStdUClamp(v) => Instruction::OpenCLStdUClamp(v),
+            InstructionRef::OpenCLStdClz(v) => Instruction::OpenCLStdClz(v),
+            InstructionRef::OpenCLStdCtz(v) => Instruction::OpenCLStdCtz(v),
+            InstructionRef::OpenCLStdSMadHi(v) => Instruction::OpenCLStdSMadHi(v),
+            InstructionRef::OpenCLStdUMadSat(v) => Instruction::OpenCLStdUMadSat(v),
+            InstructionRef::OpenCLStdSMadSat(v) => Instruction::OpenCLStdSMadSat(v),
+            InstructionRef::OpenCLStdSMax(v) => Instruction::OpenCLStdSMax(v),
+            InstructionRef::OpenCLStdUMax(v) => Instruction::OpenCLStdUMax(v),
+            InstructionRef::OpenCLStdSMin(v) => Instruction::OpenCLStdSMin(v),
+            InstructionRef::OpenCLStdUMin(v) => Instruction::OpenCLStdUMin(v),
+            InstructionRef::OpenCLStdSMulHi(v) => Instruction::OpenCLStdSMulHi(v),
+            InstructionRef::OpenCLStdRotate(v) => Instruction::OpenCLStdRotate(v),
+            InstructionRef::OpenCLStdSSubSat(v) => Instruction::OpenCLStdSSubSat(v),
+            InstructionRef::OpenCLStdUSubSat(v) => Instruction::OpenCLStdUSubSat(v),
+            InstructionRef::OpenCLStdUUpsample(v) => Instruction::OpenCLStdUUpsample(v),
+            InstructionRef::OpenCLStdSUpsample(v) => Instruction::OpenCLStdSUpsample(v),
+            InstructionRef::OpenCLStdPopcount(v) => Instruction::OpenCLStdPopcount(v),
+            InstructionRef::OpenCLStdSMad24(v) => Instruction::OpenCLStdSMad24(v),
+            InstructionRef::OpenCLStdUMad24(v) => Instruction::OpenCLStdUMad24(v),
+            InstructionRef::OpenCLStdSMul24(v) => Instruction::OpenCLStdSMul24(v),
+            InstructionRef::OpenCLStdUMul24(v) => Instruction::OpenCLStdUMul24(v),
+            InstructionRef::OpenCLStdUAbs(v) => Instruction::OpenCLStdUAbs(v),
+            InstructionRef::OpenCLStdUAbsDiff(v) => Instruction::OpenCLStdUAbsDiff(v),
+            InstructionRef::OpenCLStdUMulHi(v) => Instruction::OpenCLStdUMulHi(v),
+            InstructionRef::OpenCLStdUMadHi(v) => Instruction::OpenCLStdUMadHi(v),
+            InstructionRef::OpenCLStdFclamp(v) => Instruction::OpenCLStdFclamp(v),
+            InstructionRef::OpenCLStdDegrees(v) => Instruction::OpenCLStdDegrees(v),
+            InstructionRef::OpenCLStdFmaxCommon(v) => Instruction::OpenCLStdFmaxCommon(v),
+            InstructionRef::OpenCLStdFminCommon(v) => Instruction::OpenCLStdFminCommon(v),
+            InstructionRef::OpenCLStdMix(v) => Instruction::OpenCLStdMix(v),
+            InstructionRef::OpenCLStdRadians(v) => Instruction::OpenCLStdRadians(v),
+            InstructionRef::OpenCLStdStep(v) => Instruction::OpenCLStdStep(v),
+            InstructionRef::OpenCLStdSmoothstep(v) => Instruction::OpenCLStdSmoothstep(v),
+            InstructionRef::OpenCLStdSign(v) => Instruction::OpenCLStdSign(v),
+            InstructionRef::OpenCLStdCross(v) => Instruction::OpenCLStdCross(v),
+            InstructionRef::OpenCLStdDistance(v) => Instruction::OpenCLStdDistance(v),
+            InstructionRef::OpenCLStdLength(v) => Instruction::OpenCLStdLength(v),
+            InstructionRef::OpenCLStdNormalize(v) => Instruction::OpenCLStdNormalize(v),
+            InstructionRef::OpenCLStdFastDistance(v) => Instruction::OpenCLStdFastDistance(v),
+            InstructionRef::OpenCLStdFastLength(v) => Instruction::OpenCLStdFastLength(v),
+            InstructionRef::OpenCLStdFastNormalize(v) => Instruction::OpenCLStdFastNormalize(v),
+            InstructionRef::OpenCLStdBitselect(v) => Instruction::OpenCLStdBitselect(v),
+            InstructionRef::OpenCLStdSelect(v) => Instruction::OpenCLStdSelect(v),
+            InstructionRef::OpenCLStdVloadn(v) => Instruction::OpenCLStdVloadn(v),
+            InstructionRef::OpenCLStdVstoren(v) => Instruction::OpenCLStdVstoren(v),
+            InstructionRef::OpenCLStdVloadHalf(v) => Instruction::OpenCLStdVloadHalf(v),
+            InstructionRef::OpenCLStdVloadHalfn(v) => Instruction::OpenCLStdVloadHalfn(v),
+            InstructionRef::OpenCLStdVstoreHalf(v) => Instruction::OpenCLStdVstoreHalf(v),
+            InstructionRef::OpenCLStdVstoreHalfR(v) => Instruction::OpenCLStdVstoreHalfR(v),
+            InstructionRef::OpenCLStdVstoreHalfn(v) => Instruction::OpenCLStdVstoreHalfn(v),
+            InstructionRef::OpenCLStdVstoreHalfnR(v) => Instruction::OpenCLStdVstoreHalfnR(v),
+            InstructionRef::OpenCLStdVloadaHalfn(v) => Instruction::OpenCLStdVloadaHalfn(v),
+            InstructionRef::OpenCLStdVstoreaHalfn(v) => Instruction::OpenCLStdVstoreaHalfn(v),
+            InstructionRef::OpenCLStdVstoreaHalfnR(v) => Instruction::OpenCLStdVstoreaHalfnR(v),
+            InstructionRef::OpenCLStdShuffle(v) => Instruction::OpenCLStdShuffle(v),
+            InstructionRef::OpenCLStdShuffle2(v) => Instruction::OpenCLStdShuffle2(v),
+            InstructionRef::OpenCLStdPrintf(v) => Instruction::OpenCLStdPrintf(v.into()),
+            InstructionRef::OpenCLStdPrefetch(v) => Instruction::OpenCLStdPrefetch(v),
+            InstructionRef::GLSLStd450Round(v) => Instruction::GLSLStd450Round(v),
+            InstructionRef::GLSLStd450RoundEven(v) => Instruction::GLSLStd450RoundEven(v),
+            InstructionRef::GLSLStd450Trunc(v) => Instruction::GLSLStd450Trunc(v),
+            InstructionRef::GLSLStd450FAbs(v) => Instruction::GLSLStd450FAbs(v),
+            InstructionRef::GLSLStd450SAbs(v) => Instruction::GLSLStd450SAbs(v),
+            InstructionRef::GLSLStd450FSign(v) => Instruction::GLSLStd450FSign(v),
+            InstructionRef::GLSLStd450SSign(v) => Instruction::GLSLStd450SSign(v),
+            InstructionRef::GLSLStd450Floor(v) => Instruction::GLSLStd450Floor(v),
+            InstructionRef::GLSLStd450Ceil(v) => Instruction::GLSLStd450Ceil(v),
+            InstructionRef::GLSLStd450Fract(v) => Instruction::GLSLStd450Fract(v),
+            InstructionRef::GLSLStd450Radians(v) => Instruction::GLSLStd450Radians(v),
+            InstructionRef::GLSLStd450Degrees(v) => Instruction::GLSLStd450Degrees(v),
+            InstructionRef::GLSLStd450Sin(v) => Instruction::GLSLStd450Sin(v),
+            InstructionRef::GLSLStd450Cos(v) => Instruction::GLSLStd450Cos(v),
+            InstructionRef::GLSLStd450Tan(v) => Instruction::GLSLStd450Tan(v),
+            InstructionRef::GLSLStd450Asin(v) => Instruction::GLSLStd450Asin(v),
+            InstructionRef::GLSLStd450Acos(v) => Instruction::GLSLStd450Acos(v),
+            InstructionRef::GLSLStd450Atan(v) => Instruction::GLSLStd450Atan(v),
+            InstructionRef::GLSLStd450Sinh(v) => Instruction::GLSLStd450Sinh(v),
+            InstructionRef::GLSLStd450Cosh(v) => Instruction::GLSLStd450Cosh(v),
+            InstructionRef::GLSLStd450Tanh(v) => Instruction::GLSLStd450Tanh(v),
+            InstructionRef::GLSLStd450Asinh(v) => Instruction::GLSLStd450Asinh(v),
+            InstructionRef::GLSLStd450Acosh(v) => Instruction::GLSLStd450Acosh(v),
+            InstructionRef::GLSLStd450Atanh(v) => Instruction::GLSLStd450Atanh(v),
+            InstructionRef::GLSLStd450Atan2(v) => Instruction::GLSLStd450Atan2(v),
+            InstructionRef::GLSLStd450Pow(v) => Instruction::GLSLStd450Pow(v),
+            InstructionRef::GLSLStd450Exp(v) => Instruction::GLSLStd450Exp(v),
+            InstructionRef::GLSLStd450Log(v) => Instruction::GLSLStd450Log(v),
+            InstructionRef::GLSLStd450Exp2(v) => Instruction::GLSLStd450Exp2(v),
+            InstructionRef::GLSLStd450Log2(v) => Instruction::GLSLStd450Log2(v),
+            InstructionRef::GLSLStd450Sqrt(v) => Instruction::GLSLStd450Sqrt(v),
+            InstructionRef::GLSLStd450InverseSqrt(v) => Instruction::GLSLStd450InverseSqrt(v),
+            InstructionRef::GLSLStd450Determinant(v) => Instruction::GLSLStd450Determinant(v),
+            InstructionRef::GLSLStd450MatrixInverse(v) => Instruction::GLSLStd450MatrixInverse(v),
+            InstructionRef::GLSLStd450Modf(v) => Instruction::GLSLStd450Modf(v),
+            InstructionRef::GLSLStd450ModfStruct(v) => Instruction::GLSLStd450ModfStruct(v),
+            InstructionRef::GLSLStd450FMin(v) => Instruction::GLSLStd450FMin(v),
+            InstructionRef::GLSLStd450UMin(v) => Instruction::GLSLStd450UMin(v),
+            InstructionRef::GLSLStd450SMin(v) => Instruction::GLSLStd450SMin(v),
+            InstructionRef::GLSLStd450FMax(v) => Instruction::GLSLStd450FMax(v),
+            InstructionRef::GLSLStd450UMax(v) => Instruction::GLSLStd450UMax(v),
+            InstructionRef::GLSLStd450SMax(v) => Instruction::GLSLStd450SMax(v),
+            InstructionRef::GLSLStd450FClamp(v) => Instruction::GLSLStd450FClamp(v),
+            InstructionRef::GLSLStd450UClamp(v) => Instruction::GLSLStd450UClamp(v),
+            InstructionRef::GLSLStd450SClamp(v) => Instruction::GLSLStd450SClamp(v),
+            InstructionRef::GLSLStd450FMix(v) => Instruction::GLSLStd450FMix(v),
+            InstructionRef::GLSLStd450IMix(v) => Instruction::GLSLStd450IMix(v),
+            InstructionRef::GLSLStd450Step(v) => Instruction::GLSLStd450Step(v),
+            InstructionRef::GLSLStd450SmoothStep(v) => Instruction::GLSLStd450SmoothStep(v),
+            InstructionRef::GLSLStd450Fma(v) => Instruction::GLSLStd450Fma(v),
+            InstructionRef::GLSLStd450Frexp(v) => Instruction::GLSLStd450Frexp(v),
+            InstructionRef::GLSLStd450FrexpStruct(v) => Instruction::GLSLStd450FrexpStruct(v),
+            InstructionRef::GLSLStd450Ldexp(v) => Instruction::GLSLStd450Ldexp(v),
+            InstructionRef::GLSLStd450PackSnorm4x8(v) => Instruction::GLSLStd450PackSnorm4x8(v),
+            InstructionRef::GLSLStd450PackUnorm4x8(v) => Instruction::GLSLStd450PackUnorm4x8(v),
+            InstructionRef::GLSLStd450PackSnorm2x16(v) => Instruction::GLSLStd450PackSnorm2x16(v),
+            InstructionRef::GLSLStd450PackUnorm2x16(v) => Instruction::GLSLStd450PackUnorm2x16(v),
+            InstructionRef::GLSLStd450PackHalf2x16(v) => Instruction::GLSLStd450PackHalf2x16(v),
+            InstructionRef::GLSLStd450PackDouble2x32(v) => Instruction::GLSLStd450PackDouble2x32(v),
+            InstructionRef::GLSLStd450UnpackSnorm2x16(v) => {
+                Instruction::GLSLStd450UnpackSnorm2x16(v)
+            }
+            InstructionRef::GLSLStd450UnpackUnorm2x16(v) => {
+                Instruction::GLSLStd450UnpackUnorm2x16(v)
+            }
+            InstructionRef::GLSLStd450UnpackHalf2x16(v) => Instruction::GLSLStd450UnpackHalf2x16(v),
+            InstructionRef::GLSLStd450UnpackSnorm4x8(v) => Instruction::GLSLStd450UnpackSnorm4x8(v),
+            InstructionRef::GLSLStd450UnpackUnorm4x8(v) => Instruction::GLSLStd450UnpackUnorm4x8(v),
+            InstructionRef::GLSLStd450UnpackDouble2x32(v) => {
+                Instruction::GLSLStd450UnpackDouble2x32(v)
+            }
+            InstructionRef::GLSLStd450Length(v) => Instruction::GLSLStd450Length(v),
+            InstructionRef::GLSLStd450Distance(v) => Instruction::GLSLStd450Distance(v),
+            InstructionRef::GLSLStd450Cross(v) => Instruction::GLSLStd450Cross(v),
+            InstructionRef::GLSLStd450Normalize(v) => Instruction::GLSLStd450Normalize(v),
+            InstructionRef::GLSLStd450FaceForward(v) => Instruction::GLSLStd450FaceForward(v),
+            InstructionRef::GLSLStd450Reflect(v) => Instruction::GLSLStd450Reflect(v),
+            InstructionRef::GLSLStd450Refract(v) => Instruction::GLSLStd450Refract(v),
+            InstructionRef::GLSLStd450FindILsb(v) => Instruction::GLSLStd450FindILsb(v),
+            InstructionRef::GLSLStd450FindSMsb(v) => Instruction::GLSLStd450FindSMsb(v),
+            InstructionRef::GLSLStd450FindUMsb(v) => Instruction::GLSLStd450FindUMsb(v),
+            InstructionRef::GLSLStd450InterpolateAtCentroid(v) => {
+                Instruction::GLSLStd450InterpolateAtCentroid(v)
+            }
+            InstructionRef::GLSLStd450InterpolateAtSample(v) => {
+                Instruction::GLSLStd450InterpolateAtSample(v)
+            }
+            InstructionRef::GLSLStd450InterpolateAtOffset(v) => {
+                Instruction::GLSLStd450InterpolateAtOffset(v)
+            }
+            InstructionRef::GLSLStd450NMin(v) => Instruction::GLSLStd450NMin(v),
+            InstructionRef::GLSLStd450NMax(v) => Instruction::GLSLStd450NMax(v),
+            InstructionRef::GLSLStd450NClamp(v) => Instruction::GLSLStd450NClamp(v),
+        }
+    }
+}
+impl<'a> InstructionRef<'a> {
+    #[doc = r" for the instructions `parse_instruction_ref` has `parse_instruction` parse"]
+    fn from_instruction_without_borrowed_operands(v: Instruction) -> Self {
+        match v {
+            Instruction::Nop(v) => InstructionRef::Nop(v),
+            Instruction::Undef(v) => InstructionRef::Undef(v),
+            Instruction::Line(v) => InstructionRef::Line(v),
+            Instruction::MemoryModel(v) => InstructionRef::MemoryModel(v),
+            Instruction::ExecutionMode(v) => InstructionRef::ExecutionMode(v),
+            Instruction::Capability(v) => InstructionRef::Capability(v),
+            Instruction::TypeVoid(v) => InstructionRef::TypeVoid(v),
+            Instruction::TypeBool(v) => InstructionRef::TypeBool(v),
+            Instruction::TypeInt(v) => InstructionRef::TypeInt(v),
+            Instruction::TypeFloat(v) => InstructionRef::TypeFloat(v),
+            Instruction::TypeVector(v) => InstructionRef::TypeVector(v),
+            Instruction::TypeMatrix(v) => InstructionRef::TypeMatrix(v),
+            Instruction::TypeImage(v) => InstructionRef::TypeImage(v),
+            Instruction::TypeSampler(v) => InstructionRef::TypeSampler(v),
+            Instruction::TypeSampledImage(v) => InstructionRef::TypeSampledImage(v),
+            Instruction::TypeArray(v) => InstructionRef::TypeArray(v),
+            Instruction::TypeRuntimeArray(v) => InstructionRef::TypeRuntimeArray(v),
+            Instruction::TypePointer(v) => InstructionRef::TypePointer(v),
+            Instruction::TypeEvent(v) => InstructionRef::TypeEvent(v),
+            Instruction::TypeDeviceEvent(v) => InstructionRef::TypeDeviceEvent(v),
+            Instruction::TypeReserveId(v) => InstructionRef::TypeReserveId(v),
+            Instruction::TypeQueue(v) => InstructionRef::TypeQueue(v),
+            Instruction::TypePipe(v) => InstructionRef::TypePipe(v),
+            Instruction::TypeForwardPointer(v) => InstructionRef::TypeForwardPointer(v),
+            Instruction::ConstantTrue(v) => InstructionRef::ConstantTrue(v),
+            Instruction::ConstantFalse(v) => InstructionRef::ConstantFalse(v),
+            Instruction::Constant32(v) => InstructionRef::Constant32(v),
+            Instruction::Constant64(v) => InstructionRef::Constant64(v),
+            Instruction::ConstantSampler(v) => InstructionRef::ConstantSampler(v),
+            Instruction::ConstantNull(v) => InstructionRef::ConstantNull(v),
+            Instruction::SpecConstantTrue(v) => InstructionRef::SpecConstantTrue(v),
+            Instruction::SpecConstantFalse(v) => InstructionRef::SpecConstantFalse(v),
+            Instruction::SpecConstant32(v) => InstructionRef::SpecConstant32(v),
+            Instruction::SpecConstant64(v) => InstructionRef::SpecConstant64(v),
+            Instruction::SpecConstantOp(v) => InstructionRef::SpecConstantOp(v),
+            Instruction::Function(v) => InstructionRef::Function(v),
+            Instruction::FunctionParameter(v) => InstructionRef::FunctionParameter(v),
+            Instruction::FunctionEnd(v) => InstructionRef::FunctionEnd(v),
+            Instruction::Variable(v) => InstructionRef::Variable(v),
+            Instruction::ImageTexelPointer(v) => InstructionRef::ImageTexelPointer(v),
+            Instruction::Load(v) => InstructionRef::Load(v),
+            Instruction::Store(v) => InstructionRef::Store(v),
+            Instruction::CopyMemory(v) => InstructionRef::CopyMemory(v),
+            Instruction::CopyMemorySized(v) => InstructionRef::CopyMemorySized(v),
+            Instruction::ArrayLength(v) => InstructionRef::ArrayLength(v),
+            Instruction::GenericPtrMemSemantics(v) => InstructionRef::GenericPtrMemSemantics(v),
+            Instruction::Decorate(v) => InstructionRef::Decorate(v),
+            Instruction::MemberDecorate(v) => InstructionRef::MemberDecorate(v),
+            Instruction::DecorationGroup(v) => InstructionRef::DecorationGroup(v),
+            Instruction::VectorExtractDynamic(v) => InstructionRef::VectorExtractDynamic(v),
+            Instruction::VectorInsertDynamic(v) => InstructionRef::VectorInsertDynamic(v),
+            Instruction::CopyObject(v) => InstructionRef::CopyObject(v),
+            Instruction::Transpose(v) => InstructionRef::Transpose(v),
+            Instruction::SampledImage(v) => InstructionRef::SampledImage(v),
+            Instruction::ImageSampleImplicitLod(v) => InstructionRef::ImageSampleImplicitLod(v),
+            Instruction::ImageSampleExplicitLod(v) => InstructionRef::ImageSampleExplicitLod(v),
+            Instruction::ImageSampleDrefImplicitLod(v) => {
+                InstructionRef::ImageSampleDrefImplicitLod(v)
+            }
+            Instruction::ImageSampleDrefExplicitLod(v) => {
+                InstructionRef::ImageSampleDrefExplicitLod(v)
+            }
+            Instruction::ImageSampleProjImplicitLod(v) => {
+                InstructionRef::ImageSampleProjImplicitLod(v)
+            }
+            Instruction::ImageSampleProjExplicitLod(v) => {
+                InstructionRef::ImageSampleProjExplicitLod(v)
+            }
+            Instruction::ImageSampleProjDrefImplicitLod(v) => {
+                InstructionRef::ImageSampleProjDrefImplicitLod(v)
+            }
+            Instruction::ImageSampleProjDrefExplicitLod(v) => {
+                InstructionRef::ImageSampleProjDrefExplicitLod(v)
+            }
+            Instruction::ImageFetch(v) => InstructionRef::ImageFetch(v),
+            Instruction::ImageGather(v) => InstructionRef::ImageGather(v),
+            Instruction::ImageDrefGather(v) => InstructionRef::ImageDrefGather(v),
+            Instruction::ImageRead(v) => InstructionRef::ImageRead(v),
+            Instruction::ImageWrite(v) => InstructionRef::ImageWrite(v),
+            Instruction::Image(v) => InstructionRef::Image(v),
+            Instruction::ImageQueryFormat(v) => InstructionRef::ImageQueryFormat(v),
+            Instruction::ImageQueryOrder(v) => InstructionRef::ImageQueryOrder(v),
+            Instruction::ImageQuerySizeLod(v) => InstructionRef::ImageQuerySizeLod(v),
+            Instruction::ImageQuerySize(v) => InstructionRef::ImageQuerySize(v),
+            Instruction::ImageQueryLod(v) => InstructionRef::ImageQueryLod(v),
+            Instruction::ImageQueryLevels(v) => InstructionRef::ImageQueryLevels(v),
+            Instruction::ImageQuerySamples(v) => InstructionRef::ImageQuerySamples(v),
+            Instruction::ConvertFToU(v) => InstructionRef::ConvertFToU(v),
+            Instruction::ConvertFToS(v) => InstructionRef::ConvertFToS(v),
+            Instruction::ConvertSToF(v) => InstructionRef::ConvertSToF(v),
+            Instruction::ConvertUToF(v) => InstructionRef::ConvertUToF(v),
+            Instruction::UConvert(v) => InstructionRef::UConvert(v),
+            Instruction::SConvert(v) => InstructionRef::SConvert(v),
+            Instruction::FConvert(v) => InstructionRef::FConvert(v),
+            Instruction::QuantizeToF16(v) => InstructionRef::QuantizeToF16(v),
+            Instruction::ConvertPtrToU(v) => InstructionRef::ConvertPtrToU(v),
+            Instruction::SatConvertSToU(v) => InstructionRef::SatConvertSToU(v),
+            Instruction::SatConvertUToS(v) => InstructionRef::SatConvertUToS(v),
+            Instruction::ConvertUToPtr(v) => InstructionRef::ConvertUToPtr(v),
+            Instruction::PtrCastToGeneric(v) => InstructionRef::PtrCastToGeneric(v),
+            Instruction::GenericCastToPtr(v) => InstructionRef::GenericCastToPtr(v),
+            Instruction::GenericCastToPtrExplicit(v) => InstructionRef::GenericCastToPtrExplicit(v),
+            Instruction::Bitcast(v) => InstructionRef::Bitcast(v),
+            Instruction::SNegate(v) => InstructionRef::SNegate(v),
+            Instruction::FNegate(v) => InstructionRef::FNegate(v),
+            Instruction::IAdd(v) => InstructionRef::IAdd(v),
+            Instruction::FAdd(v) => InstructionRef::FAdd(v),
+            Instruction::ISub(v) => InstructionRef::ISub(v),
+            Instruction::FSub(v) => InstructionRef::FSub(v),
+            Instruction::IMul(v) => InstructionRef::IMul(v),
+            Instruction::FMul(v) => InstructionRef::FMul(v),
+            Instruction::UDiv(v) => InstructionRef::UDiv(v),
+            Instruction::SDiv(v) => InstructionRef::SDiv(v),
+            Instruction::FDiv(v) => InstructionRef::FDiv(v),
+            Instruction::UMod(v) => InstructionRef::UMod(v),
+            Instruction::SRem(v) => InstructionRef::SRem(v),
+            Instruction::SMod(v) => InstructionRef::SMod(v),
+            Instruction::FRem(v) => InstructionRef::FRem(v),
+            Instruction::FMod(v) => InstructionRef::FMod(v),
+            Instruction::VectorTimesScalar(v) => InstructionRef::VectorTimesScalar(v),
+            Instruction::MatrixTimesScalar(v) => InstructionRef::MatrixTimesScalar(v),
+            Instruction::VectorTimesMatrix(v) => InstructionRef::VectorTimesMatrix(v),
+            Instruction::MatrixTimesVector(v) => InstructionRef::MatrixTimesVector(v),
+            Instruction::MatrixTimesMatrix(v) => InstructionRef::MatrixTimesMatrix(v),
+            Instruction::OuterProduct(v) => InstructionRef::OuterProduct(v),
+            Instruction::Dot(v) => InstructionRef::Dot(v),
+            Instruction::IAddCarry(v) => InstructionRef::IAddCarry(v),
+            Instruction::ISubBorrow(v) => InstructionRef::ISubBorrow(v),
+            Instruction::UMulExtended(v) => InstructionRef::UMulExtended(v),
+            Instruction::SMulExtended(v) => InstructionRef::SMulExtended(v),
+            Instruction::Any(v) => InstructionRef::Any(v),
+            Instruction::All(v) => InstructionRef::All(v),
+            Instruction::IsNan(v) => InstructionRef::IsNan(v),
+            Instruction::IsInf(v) => InstructionRef::IsInf(v),
+            Instruction::IsFinite(v) => InstructionRef::IsFinite(v),
+            Instruction::IsNormal(v) => InstructionRef::IsNormal(v),
+            Instruction::SignBitSet(v) => InstructionRef::SignBitSet(v),
+            Instruction::LessOrGreater(v) => InstructionRef::LessOrGreater(v),
+            Instruction::Ordered(v) => InstructionRef::Ordered(v),
+            Instruction::Unordered(v) => InstructionRef::Unordered(v),
+            Instruction::LogicalEqual(v) => InstructionRef::LogicalEqual(v),
+            Instruction::LogicalNotEqual(v) => InstructionRef::LogicalNotEqual(v),
+            Instruction::LogicalOr(v) => InstructionRef::LogicalOr(v),
+            Instruction::LogicalAnd(v) => InstructionRef::LogicalAnd(v),
+            Instruction::LogicalNot(v) => InstructionRef::LogicalNot(v),
+            Instruction::Select(v) => InstructionRef::Select(v),
+            Instruction::IEqual(v) => InstructionRef::IEqual(v),
+            Instruction::INotEqual(v) => InstructionRef::INotEqual(v),
+            Instruction::UGreaterThan(v) => InstructionRef::UGreaterThan(v),
+            Instruction::SGreaterThan(v) => InstructionRef::SGreaterThan(v),
+            Instruction::UGreaterThanEqual(v) => InstructionRef::UGreaterThanEqual(v),
+            Instruction::SGreaterThanEqual(v) => InstructionRef::SGreaterThanEqual(v),
+            Instruction::ULessThan(v) => InstructionRef::ULessThan(v),
+            Instruction::SLessThan(v) => InstructionRef::SLessThan(v),
+            Instruction::ULessThanEqual(v) => InstructionRef::ULessThanEqual(v),
+            Instruction::SLessThanEqual(v) => InstructionRef::SLessThanEqual(v),
+            Instruction::FOrdEqual(v) => InstructionRef::FOrdEqual(v),
+            Instruction::FUnordEqual(v) => InstructionRef::FUnordEqual(v),
+            Instruction::FOrdNotEqual(v) => InstructionRef::FOrdNotEqual(v),
+            Instruction::FUnordNotEqual(v) => InstructionRef::FUnordNotEqual(v),
+            Instruction::FOrdLessThan(v) => InstructionRef::FOrdLessThan(v),
+            Instruction::FUnordLessThan(v) => InstructionRef::FUnordLessThan(v),
+            Instruction::FOrdGreaterThan(v) => InstructionRef::FOrdGreaterThan(v),
+            Instruction::FUnordGreaterThan(v) => InstructionRef::FUnordGreaterThan(v),
+            Instruction::FOrdLessThanEqual(v) => InstructionRef::FOrdLessThanEqual(v),
+            Instruction::FUnordLessThanEqual(v) => InstructionRef::FUnordLessThanEqual(v),
+            Instruction::FOrdGreaterThanEqual(v) => InstructionRef::FOrdGreaterThanEqual(v),
+            Instruction::FUnordGreaterThanEqual(v) => InstructionRef::FUnordGreaterThanEqual(v),
+            Instruction::ShiftRightLogical(v) => InstructionRef::ShiftRightLogical(v),
+            Instruction::ShiftRightArithmetic(v) => InstructionRef::ShiftRightArithmetic(v),
+            Instruction::ShiftLeftLogical(v) => InstructionRef::ShiftLeftLogical(v),
+            Instruction::BitwiseOr(v) => InstructionRef::BitwiseOr(v),
+            Instruction::BitwiseXor(v) => InstructionRef::BitwiseXor(v),
+            Instruction::BitwiseAnd(v) => InstructionRef::BitwiseAnd(v),
+            Instruction::Not(v) => InstructionRef::Not(v),
+            Instruction::BitFieldInsert(v) => InstructionRef::BitFieldInsert(v),
+            Instruction::BitFieldSExtract(v) => InstructionRef::BitFieldSExtract(v),
+            Instruction::BitFieldUExtract(v) => InstructionRef::BitFieldUExtract(v),
+            Instruction::BitReverse(v) => InstructionRef::BitReverse(v),
+            Instruction::BitCount(v) => InstructionRef::BitCount(v),
+            Instruction::DPdx(v) => InstructionRef::DPdx(v),
+            Instruction::DPdy(v) => InstructionRef::DPdy(v),
+            Instruction::Fwidth(v) => InstructionRef::Fwidth(v),
+            Instruction::DPdxFine(v) => InstructionRef::DPdxFine(v),
+            Instruction::DPdyFine(v) => InstructionRef::DPdyFine(v),
+            Instruction::FwidthFine(v) => InstructionRef::FwidthFine(v),
+            Instruction::DPdxCoarse(v) => InstructionRef::DPdxCoarse(v),
+            Instruction::DPdyCoarse(v) => InstructionRef::DPdyCoarse(v),
+            Instruction::FwidthCoarse(v) => InstructionRef::FwidthCoarse(v),
+            Instruction::EmitVertex(v) => InstructionRef::EmitVertex(v),
+            Instruction::EndPrimitive(v) => InstructionRef::EndPrimitive(v),
+            Instruction::EmitStreamVertex(v) => InstructionRef::EmitStreamVertex(v),
+            Instruction::EndStreamPrimitive(v) => InstructionRef::EndStreamPrimitive(v),
+            Instruction::ControlBarrier(v) => InstructionRef::ControlBarrier(v),
+            Instruction::MemoryBarrier(v) => InstructionRef::MemoryBarrier(v),
+            Instruction::AtomicLoad(v) => InstructionRef::AtomicLoad(v),
+            Instruction::AtomicStore(v) => InstructionRef::AtomicStore(v),
+            Instruction::AtomicExchange(v) => InstructionRef::AtomicExchange(v),
+            Instruction::AtomicCompareExchange(v) => InstructionRef::AtomicCompareExchange(v),
+            Instruction::AtomicCompareExchangeWeak(v) => {
+                InstructionRef::AtomicCompareExchangeWeak(v)
+            }
+            Instruction::AtomicIIncrement(v) => InstructionRef::AtomicIIncrement(v),
+            Instruction::AtomicIDecrement(v) => InstructionRef::AtomicIDecrement(v),
+            Instruction::AtomicIAdd(v) => InstructionRef::AtomicIAdd(v),
+            Instruction::AtomicISub(v) => InstructionRef::AtomicISub(v),
+            Instruction::AtomicSMin(v) => InstructionRef::AtomicSMin(v),
+            Instruction::AtomicUMin(v) => InstructionRef::AtomicUMin(v),
+            Instruction::AtomicSMax(v) => InstructionRef::AtomicSMax(v),
+            Instruction::AtomicUMax(v) => InstructionRef::AtomicUMax(v),
+            Instruction::AtomicAnd(v) => InstructionRef::AtomicAnd(v),
+            Instruction::AtomicOr(v) => InstructionRef::AtomicOr(v),
+            Instruction::AtomicXor(v) => InstructionRef::AtomicXor(v),
+            Instruction::LoopMerge(v) => InstructionRef::LoopMerge(v),
+            Instruction::SelectionMerge(v) => InstructionRef::SelectionMerge(v),
+            Instruction::Label(v) => InstructionRef::Label(v),
+            Instruction::Branch(v) => InstructionRef::Branch(v),
+            Instruction::Kill(v) => InstructionRef::Kill(v),
+            Instruction::Return(v) => InstructionRef::Return(v),
+            Instruction::ReturnValue(v) => InstructionRef::ReturnValue(v),
+            Instruction::Unreachable(v) => InstructionRef::Unreachable(v),
+            Instruction::LifetimeStart(v) => InstructionRef::LifetimeStart(v),
+            Instruction::LifetimeStop(v) => InstructionRef::LifetimeStop(v),
+            Instruction::GroupAsyncCopy(v) => InstructionRef::GroupAsyncCopy(v),
+            Instruction::GroupWaitEvents(v) => InstructionRef::GroupWaitEvents(v),
+            Instruction::GroupAll(v) => InstructionRef::GroupAll(v),
+            Instruction::GroupAny(v) => InstructionRef::GroupAny(v),
+            Instruction::GroupBroadcast(v) => InstructionRef::GroupBroadcast(v),
+            Instruction::GroupIAdd(v) => InstructionRef::GroupIAdd(v),
+            Instruction::GroupFAdd(v) => InstructionRef::GroupFAdd(v),
+            Instruction::GroupFMin(v) => InstructionRef::GroupFMin(v),
+            Instruction::GroupUMin(v) => InstructionRef::GroupUMin(v),
+            Instruction::GroupSMin(v) => InstructionRef::GroupSMin(v),
+            Instruction::GroupFMax(v) => InstructionRef::GroupFMax(v),
+            Instruction::GroupUMax(v) => InstructionRef::GroupUMax(v),
+            Instruction::GroupSMax(v) => InstructionRef::GroupSMax(v),
+            Instruction::ReadPipe(v) => InstructionRef::ReadPipe(v),
+            Instruction::WritePipe(v) => InstructionRef::WritePipe(v),
+            Instruction::ReservedReadPipe(v) => InstructionRef::ReservedReadPipe(v),
+            Instruction::ReservedWritePipe(v) => InstructionRef::ReservedWritePipe(v),
+            Instruction::ReserveReadPipePackets(v) => InstructionRef::ReserveReadPipePackets(v),
+            Instruction::ReserveWritePipePackets(v) => InstructionRef::ReserveWritePipePackets(v),
+            Instruction::CommitReadPipe(v) => InstructionRef::CommitReadPipe(v),
+            Instruction::CommitWritePipe(v) => InstructionRef::CommitWritePipe(v),
+            Instruction::IsValidReserveId(v) => InstructionRef::IsValidReserveId(v),
+            Instruction::GetNumPipePackets(v) => InstructionRef::GetNumPipePackets(v),
+            Instruction::GetMaxPipePackets(v) => InstructionRef::GetMaxPipePackets(v),
+            Instruction::GroupReserveReadPipePackets(v) => {
+                InstructionRef::GroupReserveReadPipePackets(v)
+            }
+            Instruction::GroupReserveWritePipePackets(v) => {
+                InstructionRef::GroupReserveWritePipePackets(v)
+            }
+            Instruction::GroupCommitReadPipe(v) => InstructionRef::GroupCommitReadPipe(v),
+            Instruction::GroupCommitWritePipe(v) => InstructionRef::GroupCommitWritePipe(v),
+            Instruction::EnqueueMarker(v) => InstructionRef::EnqueueMarker(v),
+            Instruction::GetKernelNDrangeSubGroupCount(v) => {
+                InstructionRef::GetKernelNDrangeSubGroupCount(v)
+            }
+            Instruction::GetKernelNDrangeMaxSubGroupSize(v) => {
+                InstructionRef::GetKernelNDrangeMaxSubGroupSize(v)
+            }
+            Instruction::GetKernelWorkGroupSize(v) => InstructionRef::GetKernelWorkGroupSize(v),
+            Instruction::GetKernelPreferredWorkGroupSizeMultiple(v) => {
+                InstructionRef::GetKernelPreferredWorkGroupSizeMultiple(v)
+            }
+            Instruction::RetainEvent(v) => InstructionRef::RetainEvent(v),
+            Instruction::ReleaseEvent(v) => InstructionRef::ReleaseEvent(v),
+            Instruction::CreateUserEvent(v) => InstructionRef::CreateUserEvent(v),
+            Instruction::IsValidEvent(v) => InstructionRef::IsValidEvent(v),
+            Instruction::SetUserEventStatus(v) => InstructionRef::SetUserEventStatus(v),
+            Instruction::CaptureEventProfilingInfo(v) => {
+                InstructionRef::CaptureEventProfilingInfo(v)
+            }
+            Instruction::GetDefaultQueue(v) => InstructionRef::GetDefaultQueue(v),
+            Instruction::BuildNDRange(v) => InstructionRef::BuildNDRange(v),
+            Instruction::ImageSparseSampleImplicitLod(v) => {
+                InstructionRef::ImageSparseSampleImplicitLod(v)
+            }
+            Instruction::ImageSparseSampleExplicitLod(v) => {
+                InstructionRef::ImageSparseSampleExplicitLod(v)
+            }
+            Instruction::ImageSparseSampleDrefImplicitLod(v) => {
+                InstructionRef::ImageSparseSampleDrefImplicitLod(v)
+            }
+            Instruction::ImageSparseSampleDrefExplicitLod(v) => {
+                InstructionRef::ImageSparseSampleDrefExplicitLod(v)
+            }
+            Instruction::ImageSparseFetch(v) => InstructionRef::ImageSparseFetch(v),
+            Instruction::ImageSparseGather(v) => InstructionRef::ImageSparseGather(v),
+            Instruction::ImageSparseDrefGather(v) => InstructionRef::ImageSparseDrefGather(v),
+            Instruction::ImageSparseTexelsResident(v) => {
+                InstructionRef::ImageSparseTexelsResident(v)
+            }
+            Instruction::NoLine(v) => InstructionRef::NoLine(v),
+            Instruction::AtomicFlagTestAndSet(v) => InstructionRef::AtomicFlagTestAndSet(v),
+            Instruction::AtomicFlagClear(v) => InstructionRef::AtomicFlagClear(v),
+            Instruction::ImageSparseRead(v) => InstructionRef::ImageSparseRead(v),
+            Instruction::SizeOf(v) => InstructionRef::SizeOf(v),
+            Instruction::TypePipeStorage(v) => InstructionRef::TypePipeStorage(v),
+            Instruction::ConstantPipeStorage(v) => InstructionRef::ConstantPipeStorage(v),
+            Instruction::CreatePipeFromPipeStorage(v) => {
+                InstructionRef::CreatePipeFromPipeStorage(v)
+            }
+            Instruction::GetKernelLocalSizeForSubgroupCount(v) => {
+                InstructionRef::GetKernelLocalSizeForSubgroupCount(v)
+            }
+            Instruction::GetKernelMaxNumSubgroups(v) => InstructionRef::GetKernelMaxNumSubgroups(v),
+            Instruction::TypeNamedBarrier(v) => InstructionRef::TypeNamedBarrier(v),
+            Instruction::NamedBarrierInitialize(v) => InstructionRef::NamedBarrierInitialize(v),
+            Instruction::MemoryNamedBarrier(v) => InstructionRef::MemoryNamedBarrier(v),
+            Instruction::ExecutionModeId(v) => InstructionRef::ExecutionModeId(v),
+            Instruction::DecorateId(v) => InstructionRef::DecorateId(v),
+            Instruction::GroupNonUniformElect(v) => InstructionRef::GroupNonUniformElect(v),
+            Instruction::GroupNonUniformAll(v) => InstructionRef::GroupNonUniformAll(v),
+            Instruction::GroupNonUniformAny(v) => InstructionRef::GroupNonUniformAny(v),
+            Instruction::GroupNonUniformAllEqual(v) => InstructionRef::GroupNonUniformAllEqual(v),
+            Instruction::GroupNonUniformBroadcast(v) => InstructionRef::GroupNonUniformBroadcast(v),
+            Instruction::GroupNonUniformBroadcastFirst(v) => {
+                InstructionRef::GroupNonUniformBroadcastFirst(v)
+            }
+            Instruction::GroupNonUniformBallot(v) => InstructionRef::GroupNonUniformBallot(v),
+            Instruction::GroupNonUniformInverseBallot(v) => {
+                InstructionRef::GroupNonUniformInverseBallot(v)
+            }
+            Instruction::GroupNonUniformBallotBitExtract(v) => {
+                InstructionRef::GroupNonUniformBallotBitExtract(v)
+            }
+            Instruction::GroupNonUniformBallotBitCount(v) => {
+                InstructionRef::GroupNonUniformBallotBitCount(v)
+            }
+            Instruction::GroupNonUniformBallotFindLSB(v) => {
+                InstructionRef::GroupNonUniformBallotFindLSB(v)
+            }
+            Instruction::GroupNonUniformBallotFindMSB(v) => {
+                InstructionRef::GroupNonUniformBallotFindMSB(v)
+            }
+            Instruction::GroupNonUniformShuffle(v) => InstructionRef::GroupNonUniformShuffle(v),
+            Instruction::GroupNonUniformShuffleXor(v) => {
+                InstructionRef::GroupNonUniformShuffleXor(v)
+            }
+            Instruction::GroupNonUniformShuffleUp(v) => InstructionRef::GroupNonUniformShuffleUp(v),
+            Instruction::GroupNonUniformShuffleDown(v) => {
+                InstructionRef::GroupNonUniformShuffleDown(v)
+            }
+            Instruction::GroupNonUniformIAdd(v) => InstructionRef::GroupNonUniformIAdd(v),
+            Instruction::GroupNonUniformFAdd(v) => InstructionRef::GroupNonUniformFAdd(v),
+            Instruction::GroupNonUniformIMul(v) => InstructionRef::GroupNonUniformIMul(v),
+            Instruction::GroupNonUniformFMul(v) => InstructionRef::GroupNonUniformFMul(v),
+            Instruction::GroupNonUniformSMin(v) => InstructionRef::GroupNonUniformSMin(v),
+            Instruction::GroupNonUniformUMin(v) => InstructionRef::GroupNonUniformUMin(v),
+            Instruction::GroupNonUniformFMin(v) => InstructionRef::GroupNonUniformFMin(v),
+            Instruction::GroupNonUniformSMax(v) => InstructionRef::GroupNonUniformSMax(v),
+            Instruction::GroupNonUniformUMax(v) => InstructionRef::GroupNonUniformUMax(v),
+            Instruction::GroupNonUniformFMax(v) => InstructionRef::GroupNonUniformFMax(v),
+            Instruction::GroupNonUniformBitwiseAnd(v) => {
+                InstructionRef::GroupNonUniformBitwiseAnd(v)
+            }
+            Instruction::GroupNonUniformBitwiseOr(v) => InstructionRef::GroupNonUniformBitwiseOr(v),
+            Instruction::GroupNonUniformBitwiseXor(v) => {
+                InstructionRef::GroupNonUniformBitwiseXor(v)
+            }
+            Instruction::GroupNonUniformLogicalAnd(v) => {
+                InstructionRef::GroupNonUniformLogicalAnd(v)
+            }
+            Instruction::GroupNonUniformLogicalOr(v) => InstructionRef::GroupNonUniformLogicalOr(v),
+            Instruction::GroupNonUniformLogicalXor(v) => {
+                InstructionRef::GroupNonUniformLogicalXor(v)
+            }
+            Instruction::GroupNonUniformQuadBroadcast(v) => {
+                InstructionRef::GroupNonUniformQuadBroadcast(v)
+            }
+            Instruction::GroupNonUniformQuadSwap(v) => InstructionRef::GroupNonUniformQuadSwap(v),
+            Instruction::CopyLogical(v) => InstructionRef::CopyLogical(v),
+            Instruction::PtrEqual(v) => InstructionRef::PtrEqual(v),
+            Instruction::PtrNotEqual(v) => InstructionRef::PtrNotEqual(v),
+            Instruction::PtrDiff(v) => InstructionRef::PtrDiff(v),
+            Instruction::DecorateString(v) => InstructionRef::DecorateString(v),
+            Instruction::MemberDecorateString(v) => InstructionRef::MemberDecorateString(v),
+            Instruction::OpenCLStdAcos(v) => InstructionRef::OpenCLStdAcos(v),
+            Instruction::OpenCLStdAcosh(v) => InstructionRef::OpenCLStdAcosh(v),
+            Instruction::OpenCLStdAcospi(v) => InstructionRef::OpenCLStdAcospi(v),
+            Instruction::OpenCLStdAsin(v) => InstructionRef::OpenCLStdAsin(v),
+            Instruction::OpenCLStdAsinh(v) => InstructionRef::OpenCLStdAsinh(v),
+            Instruction::OpenCLStdAsinpi(v) => InstructionRef::OpenCLStdAsinpi(v),
+            Instruction::OpenCLStdAtan(v) => InstructionRef::OpenCLStdAtan(v),
+            Instruction::OpenCLStdAtan2(v) => InstructionRef::OpenCLStdAtan2(v),
+            Instruction::OpenCLStdAtanh(v) => InstructionRef::OpenCLStdAtanh(v),
+            Instruction::OpenCLStdAtanpi(v) => InstructionRef::OpenCLStdAtanpi(v),
+            Instruction::OpenCLStdAtan2pi(v) => InstructionRef::OpenCLStdAtan2pi(v),
+            Instruction::OpenCLStdCbrt(v) => InstructionRef::OpenCLStdCbrt(v),
+            Instruction::OpenCLStdCeil(v) => InstructionRef::OpenCLStdCeil(v),
+            Instruction::OpenCLStdCopysign(v) => InstructionRef::OpenCLStdCopysign(v),
+            Instruction::OpenCLStdCos(v) => InstructionRef::OpenCLStdCos(v),
+            Instruction::OpenCLStdCosh(v) => InstructionRef::OpenCLStdCosh(v),
+            Instruction::OpenCLStdCospi(v) => InstructionRef::OpenCLStdCospi(v),
+            Instruction::OpenCLStdErfc(v) => InstructionRef::OpenCLStdErfc(v),
+            Instruction::OpenCLStdErf(v) => InstructionRef::OpenCLStdErf(v),
+            Instruction::OpenCLStdExp(v) => InstructionRef::OpenCLStdExp(v),
+            Instruction::OpenCLStdExp2(v) => InstructionRef::OpenCLStdExp2(v),
+            Instruction::OpenCLStdExp10(v) => InstructionRef::OpenCLStdExp10(v),
+            Instruction::OpenCLStdExpm1(v) => InstructionRef::OpenCLStdExpm1(v),
+            Instruction::OpenCLStdFabs(v) => InstructionRef::OpenCLStdFabs(v),
+            Instruction::OpenCLStdFdim(v) => InstructionRef::OpenCLStdFdim(v),
+            Instruction::OpenCLStdFloor(v) => InstructionRef::OpenCLStdFloor(v),
+            Instruction::OpenCLStdFma(v) => InstructionRef::OpenCLStdFma(v),
+            Instruction::OpenCLStdFmax(v) => InstructionRef::OpenCLStdFmax(v),
+            Instruction::OpenCLStdFmin(v) => InstructionRef::OpenCLStdFmin(v),
+            Instruction::OpenCLStdFmod(v) => InstructionRef::OpenCLStdFmod(v),
+            Instruction::OpenCLStdFract(v) => InstructionRef::OpenCLStdFract(v),
+            Instruction::OpenCLStdFrexp(v) => InstructionRef::OpenCLStdFrexp(v),
+            Instruction::OpenCLStdHypot(v) => InstructionRef::OpenCLStdHypot(v),
+            Instruction::OpenCLStdIlogb(v) => InstructionRef::OpenCLStdIlogb(v),
+            Instruction::OpenCLStdLdexp(v) => InstructionRef::OpenCLStdLdexp(v),
+            Instruction::OpenCLStdLgamma(v) => InstructionRef::OpenCLStdLgamma(v),
+            Instruction::OpenCLStdLgammaR(v) => InstructionRef::OpenCLStdLgammaR(v),
+            Instruction::OpenCLStdLog(v) => InstructionRef::OpenCLStdLog(v),
+            Instruction::OpenCLStdLog2(v) => InstructionRef::OpenCLStdLog2(v),
+            Instruction::OpenCLStdLog10(v) => InstructionRef::OpenCLStdLog10(v),
+            Instruction::OpenCLStdLog1p(v) => InstructionRef::OpenCLStdLog1p(v),
+            Instruction::OpenCLStdLogb(v) => InstructionRef::OpenCLStdLogb(v),
+            Instruction::OpenCLStdMad(v) => InstructionRef::OpenCLStdMad(v),
+            Instruction::OpenCLStdMaxmag(v) => InstructionRef::OpenCLStdMaxmag(v),
+            Instruction::OpenCLStdMinmag(v) => InstructionRef::OpenCLStdMinmag(v),
+            Instruction::OpenCLStdModf(v) => InstructionRef::OpenCLStdModf(v),
+            Instruction::OpenCLStdNan(v) => InstructionRef::OpenCLStdNan(v),
+            Instruction::OpenCLStdNextafter(v) => InstructionRef::OpenCLStdNextafter(v),
+            Instruction::OpenCLStdPow(v) => InstructionRef::OpenCLStdPow(v),
+            Instruction::OpenCLStdPown(v) => InstructionRef::OpenCLStdPown(v),
+            Instruction::OpenCLStdPowr(v) => InstructionRef::OpenCLStdPowr(v),
+            Instruction::OpenCLStdRemainder(v) => InstructionRef::OpenCLStdRemainder(v),
+            Instruction::OpenCLStdRemquo(v) => InstructionRef::OpenCLStdRemquo(v),
+            Instruction::OpenCLStdRint(v) => InstructionRef::OpenCLStdRint(v),
+            Instruction::OpenCLStdRootn(v) => InstructionRef::OpenCLStdRootn(v),
+            Instruction::OpenCLStdRound(v) => InstructionRef::OpenCLStdRound(v),
+            Instruction::OpenCLStdRsqrt(v) => InstructionRef::OpenCLStdRsqrt(v),
+            Instruction::OpenCLStdSin(v) => InstructionRef::OpenCLStdSin(v),
+            Instruction::OpenCLStdSincos(v) => InstructionRef::OpenCLStdSincos(v),
+            Instruction::OpenCLStdSinh(v) => InstructionRef::OpenCLStdSinh(v),
+            Instruction::OpenCLStdSinpi(v) => InstructionRef::OpenCLStdSinpi(v),
+            Instruction::OpenCLStdSqrt(v) => InstructionRef::OpenCLStdSqrt(v),
+            Instruction::OpenCLStdTan(v) => InstructionRef::OpenCLStdTan(v),
+            Instruction::OpenCLStdTanh(v) => InstructionRef::OpenCLStdTanh(v),
+            Instruction::OpenCLStdTanpi(v) => InstructionRef::OpenCLStdTanpi(v),
+            Instruction::OpenCLStdTgamma(v) => InstructionRef::OpenCLStdTgamma(v),
+            Instruction::OpenCLStdTrunc(v) => InstructionRef::OpenCLStdTrunc(v),
+            Instruction::OpenCLStdHalfCos(v) => InstructionRef::OpenCLStdHalfCos(v),
+            Instruction::OpenCLStdHalfDivide(v) => InstructionRef::OpenCLStdHalfDivide(v),
+            Instruction::OpenCLStdHalfExp(v) => InstructionRef::OpenCLStdHalfExp(v),
+            Instruction::OpenCLStdHalfExp2(v) => InstructionRef::OpenCLStdHalfExp2(v),
+            Instruction::OpenCLStdHalfExp10(v) => InstructionRef::OpenCLStdHalfExp10(v),
+            Instruction::OpenCLStdHalfLog(v) => InstructionRef::OpenCLStdHalfLog(v),
+            Instruction::OpenCLStdHalfLog2(v) => InstructionRef::OpenCLStdHalfLog2(v),
+            Instruction::OpenCLStdHalfLog10(v) => InstructionRef::OpenCLStdHalfLog10(v),
+            Instruction::OpenCLStdHalfPowr(v) => InstructionRef::OpenCLStdHalfPowr(v),
+            Instruction::OpenCLStdHalfRecip(v) => InstructionRef::OpenCLStdHalfRecip(v),
+            Instruction::OpenCLStdHalfRsqrt(v) => InstructionRef::OpenCLStdHalfRsqrt(v),
+            Instruction::OpenCLStdHalfSin(v) => InstructionRef::OpenCLStdHalfSin(v),
+            Instruction::OpenCLStdHalfSqrt(v) => InstructionRef::OpenCLStdHalfSqrt(v),
+            Instruction::OpenCLStdHalfTan(v) => InstructionRef::OpenCLStdHalfTan(v),
+            Instruction::OpenCLStdNativeCos(v) => InstructionRef::OpenCLStdNativeCos(v),
+            Instruction::OpenCLStdNativeDivide(v) => InstructionRef::OpenCLStdNativeDivide(v),
+            Instruction::OpenCLStdNativeExp(v) => InstructionRef::OpenCLStdNativeExp(v),
+            Instruction::OpenCLStdNativeExp2(v) => InstructionRef::OpenCLStdNativeExp2(v),
+            Instruction::OpenCLStdNativeExp10(v) => InstructionRef::OpenCLStdNativeExp10(v),
+            Instruction::OpenCLStdNativeLog(v) => InstructionRef::OpenCLStdNativeLog(v),
+            Instruction::OpenCLStdNativeLog2(v) => InstructionRef::OpenCLStdNativeLog2(v),
+            Instruction::OpenCLStdNativeLog10(v) => InstructionRef::OpenCLStdNativeLog10(v),
+            Instruction::OpenCLStdNativePowr(v) => InstructionRef::OpenCLStdNativePowr(v),
+            Instruction::OpenCLStdNativeRecip(v) => InstructionRef::OpenCLStdNativeRecip(v),
+            Instruction::OpenCLStdNativeRsqrt(v) => InstructionRef::OpenCLStdNativeRsqrt(v),
+            Instruction::OpenCLStdNativeSin(v) => InstructionRef::OpenCLStdNativeSin(v),
+            Instruction::OpenCLStdNativeSqrt(v) => InstructionRef::OpenCLStdNativeSqrt(v),
+            Instruction::OpenCLStdNativeTan(v) => InstructionRef::OpenCLStdNativeTan(v),
+            Instruction::OpenCLStdSAbs(v) => InstructionRef::OpenCLStdSAbs(v),
+            Instruction::OpenCLStdSAbsDiff(v) => InstructionRef::OpenCLStdSAbsDiff(v),
+            Instruction::OpenCLStdSAddSat(v) => InstructionRef::OpenCLStdSAddSat(v),
+            Instruction::OpenCLStdUAddSat(v) => InstructionRef::OpenCLStdUAddSat(v),
+            Instruction::OpenCLStdSHadd(v) => InstructionRef::OpenCLStdSHadd(v),
+            Instruction::OpenCLStdUHadd(v) => InstructionRef::OpenCLStdUHadd(v),
+            Instruction::OpenCLStdSRhadd(v) => InstructionRef::OpenCLStdSRhadd(v),
+            Instruction::OpenCLStdURhadd(v) => InstructionRef::OpenCLStdURhadd(v),
+            Instruction::OpenCLStdSClamp(v) => InstructionRef::OpenCLStdSClamp(v),
+            Instruction::OpenCLStdUClamp(v) => InstructionRef::OpenCLStdUClamp(v),
+            Instruction::OpenCLStdClz(v) => InstructionRef::OpenCLStdClz(v),
+            Instruction::OpenCLStdCtz(v) => InstructionRef::OpenCLStdCtz(v),
+            Instruction::OpenCLStdSMadHi(v) => InstructionRef::OpenCLStdSMadHi(v),
+            Instruction::OpenCLStdUMadSat(v) => InstructionRef::OpenCLStdUMadSat(v),
+            Instruction::OpenCLStdSMadSat(v) => InstructionRef::OpenCLStdSMadSat(v),
+            Instruction::OpenCLStdSMax(v) => InstructionRef::OpenCLStdSMax(v),
+            Instruction::OpenCLStdUMax(v) => InstructionRef::OpenCLStdUMax(v),
+            Instruction::OpenCLStdSMin(v) => InstructionRef::OpenCLStdSMin(v),
+            Instruction::OpenCLStdUMin(v) => InstructionRef::OpenCLStdUMin(v),
+            Instruction::OpenCLStdSMulHi(v) => InstructionRef::OpenCLStdSMulHi(v),
+            Instruction::OpenCLStdRotate(v) => InstructionRef::OpenCLStdRotate(v),
+            Instruction::OpenCLStdSSubSat(v) => InstructionRef::OpenCLStdSSubSat(v),
+            Instruction::OpenCLStdUSubSat(v) => InstructionRef::OpenCLStdUSubSat(v),
+            Instruction::OpenCLStdUUpsample(v) => InstructionRef::OpenCLStdUUpsample(v),
+            Instruction::OpenCLStdSUpsample(v) => InstructionRef::OpenCLStdSUpsample(v),
+            Instruction::OpenCLStdPopcount(v) => InstructionRef::OpenCLStdPopcount(v),
+            Instruction::OpenCLStdSMad24(v) => InstructionRef::OpenCLStdSMad24(v),
+            Instruction::OpenCLStdUMad24(v) => InstructionRef::OpenCLStdUMad24(v),
+            Instruction::OpenCLStdSMul24(v) => InstructionRef::OpenCLStdSMul24(v),
+            Instruction::OpenCLStdUMul24(v) => InstructionRef::OpenCLStdUMul24(v),
+            Instruction::OpenCLStdUAbs(v) => InstructionRef::OpenCLStdUAbs(v),
+            Instruction::OpenCLStdUAbsDiff(v) => InstructionRef::OpenCLStdUAbsDiff(v),
+            Instruction::OpenCLStdUMulHi(v) => InstructionRef::OpenCLStdUMulHi(v),
+            Instruction::OpenCLStdUMadHi(v) => InstructionRef::OpenCLStdUMadHi(v),
+            Instruction::OpenCLStdFclamp(v) => InstructionRef::OpenCLStdFclamp(v),
+            Instruction::OpenCLStdDegrees(v) => InstructionRef::OpenCLStdDegrees(v),
+            Instruction::OpenCLStdFmaxCommon(v) => InstructionRef::OpenCLStdFmaxCommon(v),
+            Instruction::OpenCLStdFminCommon(v) => InstructionRef::OpenCLStdFminCommon(v),
+            Instruction::OpenCLStdMix(v) => InstructionRef::OpenCLStdMix(v),
+            Instruction::OpenCLStdRadians(v) => InstructionRef::OpenCLStdRadians(v),
+            Instruction::OpenCLStdStep(v) => InstructionRef::OpenCLStdStep(v),
+            Instruction::OpenCLStdSmoothstep(v) => InstructionRef::OpenCLStdSmoothstep(v),
+            Instruction::OpenCLStdSign(v) => InstructionRef::OpenCLStdSign(v),
+            Instruction::OpenCLStdCross(v) => InstructionRef::OpenCLStdCross(v),
+            Instruction::OpenCLStdDistance(v) => InstructionRef::OpenCLStdDistance(v),
+            Instruction::OpenCLStdLength(v) => InstructionRef::OpenCLStdLength(v),
+            Instruction::OpenCLStdNormalize(v) => InstructionRef::OpenCLStdNormalize(v),
+            Instruction::OpenCLStdFastDistance(v) => InstructionRef::OpenCLStdFastDistance(v),
+            Instruction::OpenCLStdFastLength(v) => InstructionRef::OpenCLStdFastLength(v),
+            Instruction::OpenCLStdFastNormalize(v) => InstructionRef::OpenCLStdFastNormalize(v),
+            Instruction::OpenCLStdBitselect(v) => InstructionRef::OpenCLStdBitselect(v),
+            Instruction::OpenCLStdSelect(v) => InstructionRef::OpenCLStdSelect(v),
+            Instruction::OpenCLStdVloadn(v) => InstructionRef::OpenCLStdVloadn(v),
+            Instruction::OpenCLStdVstoren(v) => InstructionRef::OpenCLStdVstoren(v),
+            Instruction::OpenCLStdVloadHalf(v) => InstructionRef::OpenCLStdVloadHalf(v),
+            Instruction::OpenCLStdVloadHalfn(v) => InstructionRef::OpenCLStdVloadHalfn(v),
+            Instruction::OpenCLStdVstoreHalf(v) => InstructionRef::OpenCLStdVstoreHalf(v),
+            Instruction::OpenCLStdVstoreHalfR(v) => InstructionRef::OpenCLStdVstoreHalfR(v),
+            Instruction::OpenCLStdVstoreHalfn(v) => InstructionRef::OpenCLStdVstoreHalfn(v),
+            Instruction::OpenCLStdVstoreHalfnR(v) => InstructionRef::OpenCLStdVstoreHalfnR(v),
+            Instruction::OpenCLStdVloadaHalfn(v) => InstructionRef::OpenCLStdVloadaHalfn(v),
+            Instruction::OpenCLStdVstoreaHalfn(v) => InstructionRef::OpenCLStdVstoreaHalfn(v),
+            Instruction::OpenCLStdVstoreaHalfnR(v) => InstructionRef::OpenCLStdVstoreaHalfnR(v),
+            Instruction::OpenCLStdShuffle(v) => InstructionRef::OpenCLStdShuffle(v),
+            Instruction::OpenCLStdShuffle2(v) => InstructionRef::OpenCLStdShuffle2(v),
+            Instruction::OpenCLStdPrefetch(v) => InstructionRef::OpenCLStdPrefetch(v),
+            Instruction::GLSLStd450Round(v) => InstructionRef::GLSLStd450Round(v),
+            Instruction::GLSLStd450RoundEven(v) => InstructionRef::GLSLStd450RoundEven(v),
+            Instruction::GLSLStd450Trunc(v) => InstructionRef::GLSLStd450Trunc(v),
+            Instruction::GLSLStd450FAbs(v) => InstructionRef::GLSLStd450FAbs(v),
+            Instruction::GLSLStd450SAbs(v) => InstructionRef::GLSLStd450SAbs(v),
+            Instruction::GLSLStd450FSign(v) => InstructionRef::GLSLStd450FSign(v),
+            Instruction::GLSLStd450SSign(v) => InstructionRef::GLSLStd450SSign(v),
+            Instruction::GLSLStd450Floor(v) => InstructionRef::GLSLStd450Floor(v),
+            Instruction::GLSLStd450Ceil(v) => InstructionRef::GLSLStd450Ceil(v),
+            Instruction::GLSLStd450Fract(v) => InstructionRef::GLSLStd450Fract(v),
+            Instruction::GLSLStd450Radians(v) => InstructionRef::GLSLStd450Radians(v),
+            Instruction::GLSLStd450Degrees(v) => InstructionRef::GLSLStd450Degrees(v),
+            Instruction::GLSLStd450Sin(v) => InstructionRef::GLSLStd450Sin(v),
+            Instruction::GLSLStd450Cos(v) => InstructionRef::GLSLStd450Cos(v),
+            Instruction::GLSLStd450Tan(v) => InstructionRef::GLSLStd450Tan(v),
+            Instruction::GLSLStd450Asin(v) => InstructionRef::GLSLStd450Asin(v),
+            Instruction::GLSLStd450Acos(v) => InstructionRef::GLSLStd450Acos(v),
+            Instruction::GLSLStd450Atan(v) => InstructionRef::GLSLStd450Atan(v),
+            Instruction::GLSLStd450Sinh(v) => InstructionRef::GLSLStd450Sinh(v),
+            Instruction::GLSLStd450Cosh(v) => InstructionRef::GLSLStd450Cosh(v),
+            Instruction::GLSLStd450Tanh(v) => InstructionRef::GLSLStd450Tanh(v),
+            Instruction::GLSLStd450Asinh(v) => InstructionRef::GLSLStd450Asinh(v),
+            Instruction::GLSLStd450Acosh(v) => InstructionRef::GLSLStd450Acosh(v),
+            Instruction::GLSLStd450Atanh(v) => InstructionRef::GLSLStd450Atanh(v),
+            Instruction::GLSLStd450Atan2(v) => InstructionRef::GLSLStd450Atan2(v),
+            Instruction::GLSLStd450Pow(v) => InstructionRef::GLSLStd450Pow(v),
+            Instruction::GLSLStd450Exp(v) => InstructionRef::GLSLStd450Exp(v),
+            Instruction::GLSLStd450Log(v) => InstructionRef::GLSLStd450Log(v),
+            Instruction::GLSLStd450Exp2(v) => InstructionRef::GLSLStd450Exp2(v),
+            Instruction::GLSLStd450Log2(v) => InstructionRef::GLSLStd450Log2(v),
+            Instruction::GLSLStd450Sqrt(v) => InstructionRef::GLSLStd450Sqrt(v),
+            Instruction::GLSLStd450InverseSqrt(v) => InstructionRef::GLSLStd450InverseSqrt(v),
+            Instruction::GLSLStd450Determinant(v) => InstructionRef::GLSLStd450Determinant(v),
+            Instruction::GLSLStd450MatrixInverse(v) => InstructionRef::GLSLStd450MatrixInverse(v),
+            Instruction::GLSLStd450Modf(v) => InstructionRef::GLSLStd450Modf(v),
+            Instruction::GLSLStd450ModfStruct(v) => InstructionRef::GLSLStd450ModfStruct(v),
+            Instruction::GLSLStd450FMin(v) => InstructionRef::GLSLStd450FMin(v),
+            Instruction::GLSLStd450UMin(v) => InstructionRef::GLSLStd450UMin(v),
+            Instruction::GLSLStd450SMin(v) => InstructionRef::GLSLStd450SMin(v),
+            Instruction::GLSLStd450FMax(v) => InstructionRef::GLSLStd450FMax(v),
+            Instruction::GLSLStd450UMax(v) => InstructionRef::GLSLStd450UMax(v),
+            Instruction::GLSLStd450SMax(v) => InstructionRef::GLSLStd450SMax(v),
+            Instruction::GLSLStd450FClamp(v) => InstructionRef::GLSLStd450FClamp(v),
+            Instruction::GLSLStd450UClamp(v) => InstructionRef::GLSLStd450UClamp(v),
+            Instruction::GLSLStd450SClamp(v) => InstructionRef::GLSLStd450SClamp(v),
+            Instruction::GLSLStd450FMix(v) => InstructionRef::GLSLStd450FMix(v),
+            Instruction::GLSLStd450IMix(v) => InstructionRef::GLSLStd450IMix(v),
+            Instruction::GLSLStd450Step(v) => InstructionRef::GLSLStd450Step(v),
+            Instruction::GLSLStd450SmoothStep(v) => InstructionRef::GLSLStd450SmoothStep(v),
+            Instruction::GLSLStd450Fma(v) => InstructionRef::GLSLStd450Fma(v),
+            Instruction::GLSLStd450Frexp(v) => InstructionRef::GLSLStd450Frexp(v),
+            Instruction::GLSLStd450FrexpStruct(v) => InstructionRef::GLSLStd450FrexpStruct(v),
+            Instruction::GLSLStd450Ldexp(v) => InstructionRef::GLSLStd450Ldexp(v),
+            Instruction::GLSLStd450PackSnorm4x8(v) => InstructionRef::GLSLStd450PackSnorm4x8(v),
+            Instruction::GLSLStd450PackUnorm4x8(v) => InstructionRef::GLSLStd450PackUnorm4x8(v),
+            Instruction::GLSLStd450PackSnorm2x16(v) => InstructionRef::GLSLStd450PackSnorm2x16(v),
+            Instruction::GLSLStd450PackUnorm2x16(v) => InstructionRef::GLSLStd450PackUnorm2x16(v),
+            Instruction::GLSLStd450PackHalf2x16(v) => InstructionRef::GLSLStd450PackHalf2x16(v),
+            Instruction::GLSLStd450PackDouble2x32(v) => InstructionRef::GLSLStd450PackDouble2x32(v),
+            Instruction::GLSLStd450UnpackSnorm2x16(v) => {
+                InstructionRef::GLSLStd450UnpackSnorm2x16(v)
+            }
+            Instruction::GLSLStd450UnpackUnorm2x16(v) => {
+                InstructionRef::GLSLStd450UnpackUnorm2x16(v)
+            }
+            Instruction::GLSLStd450UnpackHalf2x16(v) => InstructionRef::GLSLStd450UnpackHalf2x16(v),
+            Instruction::GLSLStd450UnpackSnorm4x8(v) => InstructionRef::GLSLStd450UnpackSnorm4x8(v),
+            Instruction::GLSLStd450UnpackUnorm4x8(v) => InstructionRef::GLSLStd450UnpackUnorm4x8(v),
+            Instruction::GLSLStd450UnpackDouble2x32(v) => {
+                InstructionRef::GLSLStd450UnpackDouble2x32(v)
+            }
+            Instruction::GLSLStd450Length(v) => InstructionRef::GLSLStd450Length(v),
+            Instruction::GLSLStd450Distance(v) => InstructionRef::GLSLStd450Distance(v),
+            Instruction::GLSLStd450Cross(v) => InstructionRef::GLSLStd450Cross(v),
+            Instruction::GLSLStd450Normalize(v) => InstructionRef::GLSLStd450Normalize(v),
+            Instruction::GLSLStd450FaceForward(v) => InstructionRef::GLSLStd450FaceForward(v),
+            Instruction::GLSLStd450Reflect(v) => InstructionRef::GLSLStd450Reflect(v),
+            Instruction::GLSLStd450Refract(v) => InstructionRef::GLSLStd450Refract(v),
+            Instruction::GLSLStd450FindILsb(v) => InstructionRef::GLSLStd450FindILsb(v),
+            Instruction::GLSLStd450FindSMsb(v) => InstructionRef::GLSLStd450FindSMsb(v),
+            Instruction::GLSLStd450FindUMsb(v) => InstructionRef::GLSLStd450FindUMsb(v),
+            Instruction::GLSLStd450InterpolateAtCentroid(v) => {
+                InstructionRef::GLSLStd450InterpolateAtCentroid(v)
+            }
+            Instruction::GLSLStd450InterpolateAtSample(v) => {
+                InstructionRef::GLSLStd450InterpolateAtSample(v)
+            }
+            Instruction::GLSLStd450InterpolateAtOffset(v) => {
+                InstructionRef::GLSLStd450InterpolateAtOffset(v)
+            }
+            Instruction::GLSLStd450NMin(v) => InstructionRef::GLSLStd450NMin(v),
+            Instruction::GLSLStd450NMax(v) => InstructionRef::GLSLStd450NMax(v),
+            Instruction::GLSLStd450NClamp(v) => InstructionRef::GLSLStd450NClamp(v),
+            Instruction::SourceContinued(_)
+            | Instruction::Source(_)
+            | Instruction::SourceExtension(_)
+            | Instruction::Name(_)
+            | Instruction::MemberName(_)
+            | Instruction::String(_)
+            | Instruction::Extension(_)
+            | Instruction::ExtInstImport(_)
+            | Instruction::ExtInst(_)
+            | Instruction::EntryPoint(_)
+            | Instruction::TypeStruct(_)
+            | Instruction::TypeOpaque(_)
+            | Instruction::TypeFunction(_)
+            | Instruction::ConstantComposite(_)
+            | Instruction::SpecConstantComposite(_)
+            | Instruction::FunctionCall(_)
+            | Instruction::AccessChain(_)
+            | Instruction::InBoundsAccessChain(_)
+            | Instruction::PtrAccessChain(_)
+            | Instruction::InBoundsPtrAccessChain(_)
+            | Instruction::GroupDecorate(_)
+            | Instruction::GroupMemberDecorate(_)
+            | Instruction::VectorShuffle(_)
+            | Instruction::CompositeConstruct(_)
+            | Instruction::CompositeExtract(_)
+            | Instruction::CompositeInsert(_)
+            | Instruction::Phi(_)
+            | Instruction::BranchConditional(_)
+            | Instruction::Switch32(_)
+            | Instruction::Switch64(_)
+            | Instruction::EnqueueKernel(_)
+            | Instruction::ModuleProcessed(_)
+            | Instruction::OpenCLStdPrintf(_) => unreachable!(),
+        }
+    }
+}
+impl<'a> fmt::Display for InstructionRef<'a> {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        fmt::Display::fmt(&Instruction::from(self.clone()), f)
+    }
+}
+#[derive(Copy, Clone, Debug)]
+pub struct Header {
+    pub version: (u32, u32),
+    pub generator: u32,
+    pub bound: u32,
+    pub instruction_schema: u32,
+}
+impl fmt::Display for Header {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        writeln!(f, "; SPIR-V")?;
+        writeln!(f, "; Version: {}.{}", self.version.0, self.version.1)?;
+        writeln!(f, "; Generator: {:#X}", self.generator)?;
+        writeln!(f, "; Bound: {}", self.bound)?;
+        write!(f, "; Schema: {}", self.instruction_schema)
+    }
+}
+struct InstructionIndentAndResult(Option<IdResult>);
+impl fmt::Display for InstructionIndentAndResult {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        write!(
+            f,
+            "{:>15}",
+            self.0.map(|v| format!("{} = ", v.0)).unwrap_or_default()
+        )
+    }
+}
+impl fmt::Display for IdRef {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        write!(f, "%{}", self.0)
+    }
+}
+#[derive(Clone, Debug)]
+pub enum Error {
+    MissingHeader,
+    InvalidHeader,
+    BoundTooBig(u32),
+    UnsupportedVersion(u32, u32),
+    ZeroInstructionLength,
+    SourcePrematurelyEnded,
+    UnknownOpcode(u16),
+    UnknownSpecConstantOpcode(u32),
+    UnknownExtensionOpcode(ExtensionInstructionSet, u32),
+    Utf8Error(Utf8Error),
+    InstructionPrematurelyEnded,
+    InvalidStringTermination,
+    InstructionTooLong,
+    InvalidEnumValue,
+    IdOutOfBounds(u32),
+    IdAlreadyDefined(IdResult),
+    UnsupportedFloatSize,
+    UnsupportedIntSize,
+    UndefinedType(IdRef),
+    SwitchSelectorIsInvalid(IdRef),
+    IdIsNotExtInstImport(IdRef),
+    InvalidByteCount,
+}
+impl From<Utf8Error> for Error {
+    fn from(v: Utf8Error) -> Self {
+        Error::Utf8Error(v)
+    }
+}
+impl From<FromUtf8Error> for Error {
+    fn from(v: FromUtf8Error) -> Self {
+        Error::Utf8Error(v.utf8_error())
+    }
+}
+impl fmt::Display for Error {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        match *self {
+            Error::MissingHeader => write!(f, "SPIR-V source is missing the file header"),
+            Error::InvalidHeader => write!(f, "SPIR-V source has an invalid file header"),
+            Error::BoundTooBig(bound) => write!(
+                f,
+                concat!(
+                    "SPIR-V source has an invalid file header; ",
+                    "the id bound is way bigger than needed: {}",
+                ),
+                bound,
+            ),
+            Error::UnsupportedVersion(major, minor) => write!(
+                f,
+                "SPIR-V source has an unsupported version: {}.{}",
+                major, minor
+            ),
+            Error::ZeroInstructionLength => write!(f, "SPIR-V instruction has a length of zero"),
+            Error::SourcePrematurelyEnded => write!(f, "SPIR-V source prematurely ended"),
+            Error::UnknownOpcode(opcode) => {
+                write!(f, "SPIR-V instruction has an unknown opcode: {}", opcode)
+            }
+            Error::UnknownSpecConstantOpcode(opcode) => {
+                write!(
+                    f,
+                    "SPIR-V OpSpecConstantOp instruction has an unknown opcode: {}",
+                    opcode
+                )
+            }
+            Error::UnknownExtensionOpcode(ref extension_instruction_set, opcode) => {
+                write!(
+                    f,
+                    "SPIR-V OpExtInst instruction has an unknown opcode: {} in {}",
+                    opcode, extension_instruction_set
+                )
+            }
+            Error::Utf8Error(error) => fmt::Display::fmt(&error, f),
+            Error::InstructionPrematurelyEnded => write!(f, "SPIR-V instruction prematurely ended"),
+            Error::InvalidStringTermination => {
+                write!(f, "SPIR-V LiteralString has an invalid termination word")
+            }
+            Error::InstructionTooLong => write!(f, "SPIR-V instruction is too long"),
+            Error::InvalidEnumValue => write!(f, "enum has invalid value"),
+            Error::IdOutOfBounds(id) => write!(f, "id is out of bounds: {}", id),
+            Error::IdAlreadyDefined(id) => write!(f, "id is already defined: {}", id),
+            Error::UnsupportedFloatSize => write!(f, "unsupported float size"),
+            Error::UnsupportedIntSize => write!(f, "unsupported int size"),
+            Error::UndefinedType(id) => write!(f, "undefined type {}", id),
+            Error::SwitchSelectorIsInvalid(id) => write!(f, "Switch selector is invalid: {}", id),
+            Error::IdIsNotExtInstImport(id) => write!(
+                f,
+                "id is not the result of an OpExtInstImport instruction: {}",
+                id
+            ),
+            Error::InvalidByteCount => write!(f, "byte count is not a multiple of 4"),
+        }
+    }
+}
+pub(crate) type Result<T> = result::Result<T, Error>;
+#[derive(Copy, Clone, Debug, Eq, PartialEq, Hash)]
+enum BitWidth {
+    Width32OrLess,
+    Width64,
+}
+#[derive(Copy, Clone, Debug, Eq, PartialEq, Hash)]
+struct IdStateType(BitWidth);
+#[derive(Copy, Clone, Debug, Eq, PartialEq, Hash)]
+struct IdStateValue(BitWidth);
+#[derive(Clone, Debug, Eq, PartialEq, Hash)]
+enum IdState {
+    Unknown,
+    Type(IdStateType),
+    Value(IdStateValue),
+    ExtensionInstructionSet(ExtensionInstructionSet),
+}
+#[derive(Clone, Debug)]
+struct ParseState {
+    id_states: Vec<IdState>,
+}
+impl ParseState {
+    fn define_id(&mut self, id_result: IdResult, new_id_state: IdState) -> Result<()> {
+        let id_state = &mut self.id_states[(id_result.0).0 as usize];
+        if *id_state != IdState::Unknown {
+            return Err(Error::IdAlreadyDefined(id_result));
+        }
+        *id_state = new_id_state;
+        Ok(())
+    }
+    fn get_type(&self, id: IdRef) -> Result<IdStateType> {
+        if let IdState::Type(retval) = self.id_states[id.0 as usize] {
+            Ok(retval)
+        } else {
+            Err(Error::UndefinedType(id))
+        }
+    }
+    fn define_value(&mut self, id_result_type: IdResultType, id_result: IdResult) -> Result<()> {
+        if let IdState::Type(IdStateType(bit_width)) = self.id_states[(id_result_type.0).0 as usize]
+        {
+            self.define_id(id_result, IdState::Value(IdStateValue(bit_width)))?;
+        }
+        Ok(())
+    }
+}
+#[derive(Clone, Debug)]
+pub struct InstructionAndLocation {
+    pub instruction: Instruction,
+    pub word_index: usize,
+}
+impl InstructionAndLocation {
+    pub fn byte_index(&self) -> usize {
+        self.word_index * mem::size_of::<u32>()
+    }
+}
+impl fmt::Display for InstructionAndLocation {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        write!(f, "{} ; 0x{:08x}", self.instruction, self.byte_index())
+    }
+}
+#[derive(Clone, Debug)]
+pub struct InstructionRefAndLocation<'a> {
+    pub instruction: InstructionRef<'a>,
+    pub word_index: usize,
+}
+impl<'a> InstructionRefAndLocation<'a> {
+    pub fn byte_index(&self) -> usize {
+        self.word_index * mem::size_of::<u32>()
+    }
+}
+impl<'a> From<InstructionRefAndLocation<'a>> for InstructionAndLocation {
+    fn from(v: InstructionRefAndLocation<'a>) -> Self {
+        Self {
+            instruction: v.instruction.into(),
+            word_index: v.word_index,
+        }
+    }
+}
+impl<'a> fmt::Display for InstructionRefAndLocation<'a> {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        write!(f, "{} ; 0x{:08x}", self.instruction, self.byte_index())
+    }
+}
+#[derive(Clone, Debug)]
+pub struct Parser<'a> {
+    words: &'a [u32],
+    next_word_index: usize,
+    header: Header,
+    parse_state: ParseState,
+}
+fn parse_version(v: u32) -> Result<(u32, u32)> {
+    if (v & 0xFF0000FF) != 0 {
+        return Err(Error::InvalidHeader);
+    }
+    let major = (v >> 16) & 0xFF;
+    let minor = (v >> 8) & 0xFF;
+    Ok((major, minor))
+}
+impl<'a> Parser<'a> {
+    #[doc = r" get the parsed SPIR-V header."]
+    pub fn header(&self) -> &Header {
+        &self.header
+    }
+    #[doc = r" get the word index of the result of the next call to `self.next()`."]
+    pub fn next_word_index(&self) -> usize {
+        self.next_word_index
+    }
+    #[doc = r" create a new `Parser` and parse the SPIR-V header."]
+    pub fn start(mut words: &'a [u32]) -> Result<Self> {
+        const HEADER_LEN: usize = 5;
+        let header = words.get(0..HEADER_LEN).ok_or(Error::MissingHeader)?;
+        words = &words[HEADER_LEN..];
+        let header = match *header {
+            [MAGIC_NUMBER, version, generator, bound, instruction_schema @ 0] if bound >= 1 => {
+                let version = parse_version(version)?;
+                if version.0 != MAJOR_VERSION || version.1 > MINOR_VERSION {
+                    return Err(Error::UnsupportedVersion(version.0, version.1));
+                }
+                Header {
+                    version,
+                    generator,
+                    bound,
+                    instruction_schema,
+                }
+            }
+            _ => return Err(Error::InvalidHeader),
+        };
+        if header.bound as usize > words.len() && header.bound > 0x10000 {
+            Err(Error::BoundTooBig(header.bound))
+        } else {
+            Ok(Self {
+                words,
+                next_word_index: HEADER_LEN,
+                header,
+                parse_state: ParseState {
+                    id_states: vec![IdState::Unknown; header.bound as usize],
+                },
+            })
+        }
+    }
+    #[doc = r" returns the opcode, the operand words, and the word index of the next instruction"]
+    fn next_instruction_words(
+        &mut self,
+        length_and_opcode: u32,
+    ) -> Result<(u16, &'a [u32], usize)> {
+        let length = (length_and_opcode >> 16) as usize;
+        let opcode = length_and_opcode as u16;
+        if length == 0 {
+            return Err(Error::ZeroInstructionLength);
+        }
+        let instruction_words = self
+            .words
+            .get(1..length)
+            .ok_or(Error::SourcePrematurelyEnded)?;
+        self.words = &self.words[length..];
+        let word_index = self.next_word_index;
+        self.next_word_index += length;
+        Ok((opcode, instruction_words, word_index))
+    }
+    fn next_helper(&mut self, length_and_opcode: u32) -> Result<InstructionAndLocation> {
+        let (opcode, instruction_words, word_index) =
+            self.next_instruction_words(length_and_opcode)?;
+        let instruction = parse_instruction(opcode, instruction_words, &mut self.parse_state)?;
+        Ok(InstructionAndLocation {
+            instruction,
+            word_index,
+        })
+    }
+    fn next_ref_helper(&mut self, length_and_opcode: u32) -> Result<InstructionRefAndLocation<'a>> {
+        let (opcode, instruction_words, word_index) =
+            self.next_instruction_words(length_and_opcode)?;
+        let instruction = parse_instruction_ref(opcode, instruction_words, &mut self.parse_state)?;
+        Ok(InstructionRefAndLocation {
+            instruction,
+            word_index,
+        })
+    }
+    #[doc = r" parse the next instruction like `self.next()`, except that strings and"]
+    #[doc = r" lists of operands are borrowed from the words being parsed instead of"]
+    #[doc = r" copied."]
+    pub fn next_ref(&mut self) -> Option<Result<InstructionRefAndLocation<'a>>> {
+        let length_and_opcode = self.words.get(0)?;
+        Some(self.next_ref_helper(*length_and_opcode))
+    }
+    #[doc = r" convert to an iterator that parses using `next_ref`."]
+    pub fn into_refs(self) -> RefParser<'a> {
+        RefParser { parser: self }
+    }
+}
+impl<'a> Iterator for Parser<'a> {
+    type Item = Result<InstructionAndLocation>;
+    fn next(&mut self) -> Option<Result<InstructionAndLocation>> {
+        let length_and_opcode = self.words.get(0)?;
+        Some(self.next_helper(*length_and_opcode))
+    }
+}
+#[doc = r" a `Parser` that returns `InstructionRef`s, created by `Parser::into_refs`"]
+#[derive(Clone, Debug)]
+pub struct RefParser<'a> {
+    parser: Parser<'a>,
+}
+impl<'a> RefParser<'a> {
+    #[doc = r" get the parsed SPIR-V header."]
+    pub fn header(&self) -> &Header {
+        self.parser.header()
+    }
+    #[doc = r" get the word index of the result of the next call to `self.next()`."]
+    pub fn next_word_index(&self) -> usize {
+        self.parser.next_word_index()
+    }
+}
+impl<'a> Iterator for RefParser<'a> {
+    type Item = Result<InstructionRefAndLocation<'a>>;
+    fn next(&mut self) -> Option<Result<InstructionRefAndLocation<'a>>> {
+        self.parser.next_ref()
+    }
+}
+fn parse_instruction(
+    opcode: u16,
+    words: &[u32],
+    parse_state: &mut ParseState,
+) -> Result<Instruction> {
+    match opcode {
+        0u16 => split_fn!({
+            if words.is_empty() {
+                Ok(Instruction::Nop(OpNop {}))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        1u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Undef(OpUndef {
+                    id_result_type,
+                    id_result,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        2u16 => split_fn!({
+            let (continued_source, words) = LiteralString::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::SourceContinued(OpSourceContinued {
+                    continued_source,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        3u16 => split_fn!({
+            let (source_language, words) = SourceLanguage::spirv_parse(words, parse_state)?;
+            let (version, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (file, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            let (source, words) = Option::<LiteralString>::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::Source(OpSource {
+                    source_language,
+                    version,
+                    file,
+                    source,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        4u16 => split_fn!({
+            let (extension, words) = LiteralString::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::SourceExtension(OpSourceExtension {
+                    extension,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        5u16 => split_fn!({
+            let (target, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (name, words) = LiteralString::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::Name(OpName { target, name }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        6u16 => split_fn!({
+            let (type_, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (member, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (name, words) = LiteralString::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::MemberName(OpMemberName {
+                    type_,
+                    member,
+                    name,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        7u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (string, words) = LiteralString::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::String(OpString { id_result, string }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        8u16 => split_fn!({
+            let (file, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (line, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (column, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::Line(OpLine { file, line, column }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        10u16 => split_fn!({
+            let (name, words) = LiteralString::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::Extension(OpExtension { name }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        11u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (name, words) = LiteralString::spirv_parse(words, parse_state)?;
+            parse_state.define_id(
+                id_result,
+                IdState::ExtensionInstructionSet(ExtensionInstructionSet::from(&*name)),
+            )?;
+            if words.is_empty() {
+                Ok(Instruction::ExtInstImport(OpExtInstImport {
+                    id_result,
+                    name,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        12u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            let (set, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (instruction, words) = LiteralExtInstInteger::spirv_parse(words, parse_state)?;
+            let extension_instruction_set;
+            match parse_state.id_states[set.0 as usize].clone() {
+                IdState::ExtensionInstructionSet(ExtensionInstructionSet::Other(_)) => {
+                    let (operands, words) =
+                        Vec::<LiteralInteger32>::spirv_parse(words, parse_state)?;
                     if words.is_empty() {
-                        Ok(Instruction::GLSLStd450Refract(OpGLSLStd450Refract {
+                        return Ok(Instruction::ExtInst(OpExtInst {
                             id_result_type,
                             id_result,
                             set,
-                            i,
-                            n,
-                            eta,
-                        }))
+                            instruction,
+                            operands,
+                        }));
                     } else {
-                        Err(Error::InstructionTooLong)
+                        return Err(Error::InstructionTooLong);
                     }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 73u32) => split_fn!({
-                    let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+                }
+                IdState::ExtensionInstructionSet(v) => {
+                    extension_instruction_set = v;
+                }
+                _ => return Err(Error::IdIsNotExtInstImport(set)),
+            };
+            parse_extension_instruction(
+                extension_instruction_set,
+                instruction,
+                id_result_type,
+                id_result,
+                set,
+                words,
+                parse_state,
+            )
+        }),
+        14u16 => split_fn!({
+            let (addressing_model, words) = AddressingModel::spirv_parse(words, parse_state)?;
+            let (memory_model, words) = MemoryModel::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::MemoryModel(OpMemoryModel {
+                    addressing_model,
+                    memory_model,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        15u16 => split_fn!({
+            let (execution_model, words) = ExecutionModel::spirv_parse(words, parse_state)?;
+            let (entry_point, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (name, words) = LiteralString::spirv_parse(words, parse_state)?;
+            let (interface, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::EntryPoint(OpEntryPoint {
+                    execution_model,
+                    entry_point,
+                    name,
+                    interface,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        16u16 => split_fn!({
+            let (entry_point, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (mode, words) = ExecutionMode::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::ExecutionMode(OpExecutionMode {
+                    entry_point,
+                    mode,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        17u16 => split_fn!({
+            let (capability, words) = Capability::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::Capability(OpCapability { capability }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        19u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeVoid(OpTypeVoid { id_result }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        20u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeBool(OpTypeBool { id_result }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        21u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (width, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (signedness, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let id_state = match width {
+                8 | 16 | 32 => IdState::Type(IdStateType(BitWidth::Width32OrLess)),
+                64 => IdState::Type(IdStateType(BitWidth::Width64)),
+                _ => return Err(Error::UnsupportedIntSize),
+            };
+            parse_state.define_id(id_result, id_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeInt(OpTypeInt {
+                    id_result,
+                    width,
+                    signedness,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        22u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (width, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let id_state = match width {
+                16 | 32 => IdState::Type(IdStateType(BitWidth::Width32OrLess)),
+                64 => IdState::Type(IdStateType(BitWidth::Width64)),
+                _ => return Err(Error::UnsupportedFloatSize),
+            };
+            parse_state.define_id(id_result, id_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeFloat(OpTypeFloat { id_result, width }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        23u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (component_type, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (component_count, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeVector(OpTypeVector {
+                    id_result,
+                    component_type,
+                    component_count,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        24u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (column_type, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (column_count, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeMatrix(OpTypeMatrix {
+                    id_result,
+                    column_type,
+                    column_count,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        25u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_type, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (dim, words) = Dim::spirv_parse(words, parse_state)?;
+            let (depth, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (arrayed, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (ms, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (sampled, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (image_format, words) = ImageFormat::spirv_parse(words, parse_state)?;
+            let (access_qualifier, words) =
+                Option::<AccessQualifier>::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeImage(OpTypeImage {
+                    id_result,
+                    sampled_type,
+                    dim,
+                    depth,
+                    arrayed,
+                    ms,
+                    sampled,
+                    image_format,
+                    access_qualifier,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        26u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeSampler(OpTypeSampler { id_result }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        27u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (image_type, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeSampledImage(OpTypeSampledImage {
+                    id_result,
+                    image_type,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        28u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (element_type, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (length, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeArray(OpTypeArray {
+                    id_result,
+                    element_type,
+                    length,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        29u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (element_type, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeRuntimeArray(OpTypeRuntimeArray {
+                    id_result,
+                    element_type,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        30u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (member_types, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeStruct(OpTypeStruct {
+                    id_result,
+                    member_types,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        31u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (the_name_of_the_opaque_type, words) =
+                LiteralString::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeOpaque(OpTypeOpaque {
+                    id_result,
+                    the_name_of_the_opaque_type,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        32u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (storage_class, words) = StorageClass::spirv_parse(words, parse_state)?;
+            let (type_, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypePointer(OpTypePointer {
+                    id_result,
+                    storage_class,
+                    type_,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        33u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (return_type, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (parameter_types, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeFunction(OpTypeFunction {
+                    id_result,
+                    return_type,
+                    parameter_types,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        34u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeEvent(OpTypeEvent { id_result }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        35u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeDeviceEvent(OpTypeDeviceEvent {
+                    id_result,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        36u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeReserveId(OpTypeReserveId { id_result }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        37u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeQueue(OpTypeQueue { id_result }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        38u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (qualifier, words) = AccessQualifier::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypePipe(OpTypePipe {
+                    id_result,
+                    qualifier,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        39u16 => split_fn!({
+            let (pointer_type, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (storage_class, words) = StorageClass::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::TypeForwardPointer(OpTypeForwardPointer {
+                    pointer_type,
+                    storage_class,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        41u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ConstantTrue(OpConstantTrue {
+                    id_result_type,
+                    id_result,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        42u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ConstantFalse(OpConstantFalse {
+                    id_result_type,
+                    id_result,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        43u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            match parse_state.get_type(id_result_type.0)? {
+                IdStateType(BitWidth::Width32OrLess) => {
+                    let (value, words) =
+                        LiteralContextDependentNumber32::spirv_parse(words, parse_state)?;
                     if words.is_empty() {
-                        Ok(Instruction::GLSLStd450FindILsb(OpGLSLStd450FindILsb {
+                        Ok(Instruction::Constant32(OpConstant32 {
                             id_result_type,
                             id_result,
-                            set,
                             value,
                         }))
                     } else {
                         Err(Error::InstructionTooLong)
                     }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 74u32) => split_fn!({
-                    let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+                }
+                IdStateType(BitWidth::Width64) => {
+                    let (value, words) =
+                        LiteralContextDependentNumber64::spirv_parse(words, parse_state)?;
                     if words.is_empty() {
-                        Ok(Instruction::GLSLStd450FindSMsb(OpGLSLStd450FindSMsb {
+                        Ok(Instruction::Constant64(OpConstant64 {
                             id_result_type,
                             id_result,
-                            set,
                             value,
                         }))
                     } else {
                         Err(Error::InstructionTooLong)
                     }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 75u32) => split_fn!({
-                    let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+                }
+            }
+        }),
+        44u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (constituents, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ConstantComposite(OpConstantComposite {
+                    id_result_type,
+                    id_result,
+                    constituents,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        45u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampler_addressing_mode, words) =
+                SamplerAddressingMode::spirv_parse(words, parse_state)?;
+            let (param, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (sampler_filter_mode, words) = SamplerFilterMode::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ConstantSampler(OpConstantSampler {
+                    id_result_type,
+                    id_result,
+                    sampler_addressing_mode,
+                    param,
+                    sampler_filter_mode,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        46u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ConstantNull(OpConstantNull {
+                    id_result_type,
+                    id_result,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        48u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SpecConstantTrue(OpSpecConstantTrue {
+                    id_result_type,
+                    id_result,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        49u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SpecConstantFalse(OpSpecConstantFalse {
+                    id_result_type,
+                    id_result,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        50u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            match parse_state.get_type(id_result_type.0)? {
+                IdStateType(BitWidth::Width32OrLess) => {
+                    let (value, words) =
+                        LiteralContextDependentNumber32::spirv_parse(words, parse_state)?;
                     if words.is_empty() {
-                        Ok(Instruction::GLSLStd450FindUMsb(OpGLSLStd450FindUMsb {
+                        Ok(Instruction::SpecConstant32(OpSpecConstant32 {
                             id_result_type,
                             id_result,
-                            set,
                             value,
                         }))
                     } else {
                         Err(Error::InstructionTooLong)
                     }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 76u32) => split_fn!({
-                    let (interpolant, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450InterpolateAtCentroid(
-                            OpGLSLStd450InterpolateAtCentroid {
-                                id_result_type,
-                                id_result,
-                                set,
-                                interpolant,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 77u32) => split_fn!({
-                    let (interpolant, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (sample, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450InterpolateAtSample(
-                            OpGLSLStd450InterpolateAtSample {
-                                id_result_type,
-                                id_result,
-                                set,
-                                interpolant,
-                                sample,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 78u32) => split_fn!({
-                    let (interpolant, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::GLSLStd450InterpolateAtOffset(
-                            OpGLSLStd450InterpolateAtOffset {
-                                id_result_type,
-                                id_result,
-                                set,
-                                interpolant,
-                                offset,
-                            },
-                        ))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 79u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+                }
+                IdStateType(BitWidth::Width64) => {
+                    let (value, words) =
+                        LiteralContextDependentNumber64::spirv_parse(words, parse_state)?;
                     if words.is_empty() {
-                        Ok(Instruction::GLSLStd450NMin(OpGLSLStd450NMin {
+                        Ok(Instruction::SpecConstant64(OpSpecConstant64 {
                             id_result_type,
                             id_result,
-                            set,
-                            x,
-                            y,
+                            value,
                         }))
                     } else {
                         Err(Error::InstructionTooLong)
                     }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 80u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+                }
+            }
+        }),
+        51u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (constituents, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SpecConstantComposite(
+                    OpSpecConstantComposite {
+                        id_result_type,
+                        id_result,
+                        constituents,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        52u16 => split_fn!({
+            let (operation, words) = OpSpecConstantOp::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::SpecConstantOp(operation))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        54u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (function_control, words) = FunctionControl::spirv_parse(words, parse_state)?;
+            let (function_type, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Function(OpFunction {
+                    id_result_type,
+                    id_result,
+                    function_control,
+                    function_type,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        55u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FunctionParameter(OpFunctionParameter {
+                    id_result_type,
+                    id_result,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        56u16 => split_fn!({
+            if words.is_empty() {
+                Ok(Instruction::FunctionEnd(OpFunctionEnd {}))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        57u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (function, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (arguments, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FunctionCall(OpFunctionCall {
+                    id_result_type,
+                    id_result,
+                    function,
+                    arguments,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        59u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (storage_class, words) = StorageClass::spirv_parse(words, parse_state)?;
+            let (initializer, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Variable(OpVariable {
+                    id_result_type,
+                    id_result,
+                    storage_class,
+                    initializer,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        60u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (sample, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageTexelPointer(OpImageTexelPointer {
+                    id_result_type,
+                    id_result,
+                    image,
+                    coordinate,
+                    sample,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        61u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory_access, words) = Option::<MemoryAccess>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Load(OpLoad {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                    memory_access,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        62u16 => split_fn!({
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (object, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory_access, words) = Option::<MemoryAccess>::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::Store(OpStore {
+                    pointer,
+                    object,
+                    memory_access,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        63u16 => split_fn!({
+            let (target, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (source, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory_access, words) = Option::<MemoryAccess>::spirv_parse(words, parse_state)?;
+            let (source_memory_access, words) =
+                Option::<MemoryAccess>::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::CopyMemory(OpCopyMemory {
+                    target,
+                    source,
+                    memory_access,
+                    source_memory_access,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        64u16 => split_fn!({
+            let (target, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (source, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory_access, words) = Option::<MemoryAccess>::spirv_parse(words, parse_state)?;
+            let (source_memory_access, words) =
+                Option::<MemoryAccess>::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::CopyMemorySized(OpCopyMemorySized {
+                    target,
+                    source,
+                    size,
+                    memory_access,
+                    source_memory_access,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        65u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (indexes, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AccessChain(OpAccessChain {
+                    id_result_type,
+                    id_result,
+                    base,
+                    indexes,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        66u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (indexes, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::InBoundsAccessChain(OpInBoundsAccessChain {
+                    id_result_type,
+                    id_result,
+                    base,
+                    indexes,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        67u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (element, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (indexes, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::PtrAccessChain(OpPtrAccessChain {
+                    id_result_type,
+                    id_result,
+                    base,
+                    element,
+                    indexes,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        68u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (structure, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (array_member, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ArrayLength(OpArrayLength {
+                    id_result_type,
+                    id_result,
+                    structure,
+                    array_member,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        69u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GenericPtrMemSemantics(
+                    OpGenericPtrMemSemantics {
+                        id_result_type,
+                        id_result,
+                        pointer,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        70u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (element, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (indexes, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::InBoundsPtrAccessChain(
+                    OpInBoundsPtrAccessChain {
+                        id_result_type,
+                        id_result,
+                        base,
+                        element,
+                        indexes,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        71u16 => split_fn!({
+            let (target, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (decoration, words) = Decoration::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::Decorate(OpDecorate { target, decoration }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        72u16 => split_fn!({
+            let (structure_type, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (member, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (decoration, words) = Decoration::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::MemberDecorate(OpMemberDecorate {
+                    structure_type,
+                    member,
+                    decoration,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        73u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::DecorationGroup(OpDecorationGroup {
+                    id_result,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        74u16 => split_fn!({
+            let (decoration_group, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (targets, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupDecorate(OpGroupDecorate {
+                    decoration_group,
+                    targets,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        75u16 => split_fn!({
+            let (decoration_group, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (targets, words) = Vec::<PairIdRefLiteralInteger>::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupMemberDecorate(OpGroupMemberDecorate {
+                    decoration_group,
+                    targets,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        77u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (vector, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (index, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::VectorExtractDynamic(OpVectorExtractDynamic {
+                    id_result_type,
+                    id_result,
+                    vector,
+                    index,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        78u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (vector, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (component, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (index, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::VectorInsertDynamic(OpVectorInsertDynamic {
+                    id_result_type,
+                    id_result,
+                    vector,
+                    component,
+                    index,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        79u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (vector_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (vector_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (components, words) = Vec::<LiteralInteger32>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::VectorShuffle(OpVectorShuffle {
+                    id_result_type,
+                    id_result,
+                    vector_1,
+                    vector_2,
+                    components,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        80u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (constituents, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::CompositeConstruct(OpCompositeConstruct {
+                    id_result_type,
+                    id_result,
+                    constituents,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        81u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (composite, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (indexes, words) = Vec::<LiteralInteger32>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::CompositeExtract(OpCompositeExtract {
+                    id_result_type,
+                    id_result,
+                    composite,
+                    indexes,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        82u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (object, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (composite, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (indexes, words) = Vec::<LiteralInteger32>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::CompositeInsert(OpCompositeInsert {
+                    id_result_type,
+                    id_result,
+                    object,
+                    composite,
+                    indexes,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        83u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::CopyObject(OpCopyObject {
+                    id_result_type,
+                    id_result,
+                    operand,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        84u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (matrix, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Transpose(OpTranspose {
+                    id_result_type,
+                    id_result,
+                    matrix,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        86u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (sampler, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SampledImage(OpSampledImage {
+                    id_result_type,
+                    id_result,
+                    image,
+                    sampler,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        87u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageSampleImplicitLod(
+                    OpImageSampleImplicitLod {
+                        id_result_type,
+                        id_result,
+                        sampled_image,
+                        coordinate,
+                        image_operands,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        88u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = ImageOperands::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageSampleExplicitLod(
+                    OpImageSampleExplicitLod {
+                        id_result_type,
+                        id_result,
+                        sampled_image,
+                        coordinate,
+                        image_operands,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        89u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageSampleDrefImplicitLod(
+                    OpImageSampleDrefImplicitLod {
+                        id_result_type,
+                        id_result,
+                        sampled_image,
+                        coordinate,
+                        d_ref,
+                        image_operands,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        90u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = ImageOperands::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageSampleDrefExplicitLod(
+                    OpImageSampleDrefExplicitLod {
+                        id_result_type,
+                        id_result,
+                        sampled_image,
+                        coordinate,
+                        d_ref,
+                        image_operands,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        91u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageSampleProjImplicitLod(
+                    OpImageSampleProjImplicitLod {
+                        id_result_type,
+                        id_result,
+                        sampled_image,
+                        coordinate,
+                        image_operands,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        92u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = ImageOperands::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageSampleProjExplicitLod(
+                    OpImageSampleProjExplicitLod {
+                        id_result_type,
+                        id_result,
+                        sampled_image,
+                        coordinate,
+                        image_operands,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        93u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageSampleProjDrefImplicitLod(
+                    OpImageSampleProjDrefImplicitLod {
+                        id_result_type,
+                        id_result,
+                        sampled_image,
+                        coordinate,
+                        d_ref,
+                        image_operands,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        94u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = ImageOperands::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageSampleProjDrefExplicitLod(
+                    OpImageSampleProjDrefExplicitLod {
+                        id_result_type,
+                        id_result,
+                        sampled_image,
+                        coordinate,
+                        d_ref,
+                        image_operands,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        95u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageFetch(OpImageFetch {
+                    id_result_type,
+                    id_result,
+                    image,
+                    coordinate,
+                    image_operands,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        96u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (component, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageGather(OpImageGather {
+                    id_result_type,
+                    id_result,
+                    sampled_image,
+                    coordinate,
+                    component,
+                    image_operands,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        97u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageDrefGather(OpImageDrefGather {
+                    id_result_type,
+                    id_result,
+                    sampled_image,
+                    coordinate,
+                    d_ref,
+                    image_operands,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        98u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageRead(OpImageRead {
+                    id_result_type,
+                    id_result,
+                    image,
+                    coordinate,
+                    image_operands,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        99u16 => split_fn!({
+            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (texel, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageWrite(OpImageWrite {
+                    image,
+                    coordinate,
+                    texel,
+                    image_operands,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        100u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Image(OpImage {
+                    id_result_type,
+                    id_result,
+                    sampled_image,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        101u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageQueryFormat(OpImageQueryFormat {
+                    id_result_type,
+                    id_result,
+                    image,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        102u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageQueryOrder(OpImageQueryOrder {
+                    id_result_type,
+                    id_result,
+                    image,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        103u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (level_of_detail, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageQuerySizeLod(OpImageQuerySizeLod {
+                    id_result_type,
+                    id_result,
+                    image,
+                    level_of_detail,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        104u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageQuerySize(OpImageQuerySize {
+                    id_result_type,
+                    id_result,
+                    image,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        105u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageQueryLod(OpImageQueryLod {
+                    id_result_type,
+                    id_result,
+                    sampled_image,
+                    coordinate,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        106u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageQueryLevels(OpImageQueryLevels {
+                    id_result_type,
+                    id_result,
+                    image,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        107u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageQuerySamples(OpImageQuerySamples {
+                    id_result_type,
+                    id_result,
+                    image,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        109u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (float_value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ConvertFToU(OpConvertFToU {
+                    id_result_type,
+                    id_result,
+                    float_value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        110u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (float_value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ConvertFToS(OpConvertFToS {
+                    id_result_type,
+                    id_result,
+                    float_value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        111u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (signed_value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ConvertSToF(OpConvertSToF {
+                    id_result_type,
+                    id_result,
+                    signed_value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        112u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (unsigned_value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ConvertUToF(OpConvertUToF {
+                    id_result_type,
+                    id_result,
+                    unsigned_value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        113u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (unsigned_value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::UConvert(OpUConvert {
+                    id_result_type,
+                    id_result,
+                    unsigned_value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        114u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (signed_value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SConvert(OpSConvert {
+                    id_result_type,
+                    id_result,
+                    signed_value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        115u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (float_value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FConvert(OpFConvert {
+                    id_result_type,
+                    id_result,
+                    float_value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        116u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::QuantizeToF16(OpQuantizeToF16 {
+                    id_result_type,
+                    id_result,
+                    value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        117u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ConvertPtrToU(OpConvertPtrToU {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        118u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (signed_value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SatConvertSToU(OpSatConvertSToU {
+                    id_result_type,
+                    id_result,
+                    signed_value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        119u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (unsigned_value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SatConvertUToS(OpSatConvertUToS {
+                    id_result_type,
+                    id_result,
+                    unsigned_value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        120u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (integer_value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ConvertUToPtr(OpConvertUToPtr {
+                    id_result_type,
+                    id_result,
+                    integer_value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        121u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::PtrCastToGeneric(OpPtrCastToGeneric {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        122u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GenericCastToPtr(OpGenericCastToPtr {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        123u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (storage, words) = StorageClass::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GenericCastToPtrExplicit(
+                    OpGenericCastToPtrExplicit {
+                        id_result_type,
+                        id_result,
+                        pointer,
+                        storage,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        124u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Bitcast(OpBitcast {
+                    id_result_type,
+                    id_result,
+                    operand,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        126u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SNegate(OpSNegate {
+                    id_result_type,
+                    id_result,
+                    operand,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        127u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FNegate(OpFNegate {
+                    id_result_type,
+                    id_result,
+                    operand,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        128u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::IAdd(OpIAdd {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        129u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FAdd(OpFAdd {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        130u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ISub(OpISub {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        131u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FSub(OpFSub {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        132u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::IMul(OpIMul {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        133u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FMul(OpFMul {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        134u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::UDiv(OpUDiv {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        135u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SDiv(OpSDiv {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        136u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FDiv(OpFDiv {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        137u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::UMod(OpUMod {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        138u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SRem(OpSRem {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        139u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SMod(OpSMod {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        140u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FRem(OpFRem {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        141u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FMod(OpFMod {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        142u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (vector, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (scalar, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::VectorTimesScalar(OpVectorTimesScalar {
+                    id_result_type,
+                    id_result,
+                    vector,
+                    scalar,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        143u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (matrix, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (scalar, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::MatrixTimesScalar(OpMatrixTimesScalar {
+                    id_result_type,
+                    id_result,
+                    matrix,
+                    scalar,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        144u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (vector, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (matrix, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::VectorTimesMatrix(OpVectorTimesMatrix {
+                    id_result_type,
+                    id_result,
+                    vector,
+                    matrix,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        145u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (matrix, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (vector, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::MatrixTimesVector(OpMatrixTimesVector {
+                    id_result_type,
+                    id_result,
+                    matrix,
+                    vector,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        146u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (left_matrix, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (right_matrix, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::MatrixTimesMatrix(OpMatrixTimesMatrix {
+                    id_result_type,
+                    id_result,
+                    left_matrix,
+                    right_matrix,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        147u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (vector_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (vector_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::OuterProduct(OpOuterProduct {
+                    id_result_type,
+                    id_result,
+                    vector_1,
+                    vector_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        148u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (vector_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (vector_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Dot(OpDot {
+                    id_result_type,
+                    id_result,
+                    vector_1,
+                    vector_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        149u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::IAddCarry(OpIAddCarry {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        150u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ISubBorrow(OpISubBorrow {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        151u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::UMulExtended(OpUMulExtended {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        152u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SMulExtended(OpSMulExtended {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        154u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (vector, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Any(OpAny {
+                    id_result_type,
+                    id_result,
+                    vector,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        155u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (vector, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::All(OpAll {
+                    id_result_type,
+                    id_result,
+                    vector,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        156u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::IsNan(OpIsNan {
+                    id_result_type,
+                    id_result,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        157u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::IsInf(OpIsInf {
+                    id_result_type,
+                    id_result,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        158u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::IsFinite(OpIsFinite {
+                    id_result_type,
+                    id_result,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        159u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::IsNormal(OpIsNormal {
+                    id_result_type,
+                    id_result,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        160u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SignBitSet(OpSignBitSet {
+                    id_result_type,
+                    id_result,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        161u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::LessOrGreater(OpLessOrGreater {
+                    id_result_type,
+                    id_result,
+                    x,
+                    y,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        162u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Ordered(OpOrdered {
+                    id_result_type,
+                    id_result,
+                    x,
+                    y,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        163u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Unordered(OpUnordered {
+                    id_result_type,
+                    id_result,
+                    x,
+                    y,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        164u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::LogicalEqual(OpLogicalEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        165u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::LogicalNotEqual(OpLogicalNotEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        166u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::LogicalOr(OpLogicalOr {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        167u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::LogicalAnd(OpLogicalAnd {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        168u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::LogicalNot(OpLogicalNot {
+                    id_result_type,
+                    id_result,
+                    operand,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        169u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (condition, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (object_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (object_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Select(OpSelect {
+                    id_result_type,
+                    id_result,
+                    condition,
+                    object_1,
+                    object_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        170u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::IEqual(OpIEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        171u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::INotEqual(OpINotEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        172u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::UGreaterThan(OpUGreaterThan {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        173u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SGreaterThan(OpSGreaterThan {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        174u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::UGreaterThanEqual(OpUGreaterThanEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        175u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SGreaterThanEqual(OpSGreaterThanEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        176u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ULessThan(OpULessThan {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        177u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SLessThan(OpSLessThan {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        178u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ULessThanEqual(OpULessThanEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        179u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::SLessThanEqual(OpSLessThanEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        180u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FOrdEqual(OpFOrdEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        181u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FUnordEqual(OpFUnordEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        182u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FOrdNotEqual(OpFOrdNotEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        183u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FUnordNotEqual(OpFUnordNotEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        184u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FOrdLessThan(OpFOrdLessThan {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        185u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FUnordLessThan(OpFUnordLessThan {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        186u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FOrdGreaterThan(OpFOrdGreaterThan {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        187u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FUnordGreaterThan(OpFUnordGreaterThan {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        188u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FOrdLessThanEqual(OpFOrdLessThanEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        189u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FUnordLessThanEqual(OpFUnordLessThanEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        190u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FOrdGreaterThanEqual(OpFOrdGreaterThanEqual {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        191u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FUnordGreaterThanEqual(
+                    OpFUnordGreaterThanEqual {
+                        id_result_type,
+                        id_result,
+                        operand_1,
+                        operand_2,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        194u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (shift, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ShiftRightLogical(OpShiftRightLogical {
+                    id_result_type,
+                    id_result,
+                    base,
+                    shift,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        195u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (shift, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ShiftRightArithmetic(OpShiftRightArithmetic {
+                    id_result_type,
+                    id_result,
+                    base,
+                    shift,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        196u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (shift, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ShiftLeftLogical(OpShiftLeftLogical {
+                    id_result_type,
+                    id_result,
+                    base,
+                    shift,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        197u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::BitwiseOr(OpBitwiseOr {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        198u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::BitwiseXor(OpBitwiseXor {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        199u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::BitwiseAnd(OpBitwiseAnd {
+                    id_result_type,
+                    id_result,
+                    operand_1,
+                    operand_2,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        200u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Not(OpNot {
+                    id_result_type,
+                    id_result,
+                    operand,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        201u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (insert, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (count, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::BitFieldInsert(OpBitFieldInsert {
+                    id_result_type,
+                    id_result,
+                    base,
+                    insert,
+                    offset,
+                    count,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        202u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (count, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::BitFieldSExtract(OpBitFieldSExtract {
+                    id_result_type,
+                    id_result,
+                    base,
+                    offset,
+                    count,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        203u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (count, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::BitFieldUExtract(OpBitFieldUExtract {
+                    id_result_type,
+                    id_result,
+                    base,
+                    offset,
+                    count,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        204u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::BitReverse(OpBitReverse {
+                    id_result_type,
+                    id_result,
+                    base,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        205u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::BitCount(OpBitCount {
+                    id_result_type,
+                    id_result,
+                    base,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        207u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::DPdx(OpDPdx {
+                    id_result_type,
+                    id_result,
+                    p,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        208u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::DPdy(OpDPdy {
+                    id_result_type,
+                    id_result,
+                    p,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        209u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Fwidth(OpFwidth {
+                    id_result_type,
+                    id_result,
+                    p,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        210u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::DPdxFine(OpDPdxFine {
+                    id_result_type,
+                    id_result,
+                    p,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        211u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::DPdyFine(OpDPdyFine {
+                    id_result_type,
+                    id_result,
+                    p,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        212u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FwidthFine(OpFwidthFine {
+                    id_result_type,
+                    id_result,
+                    p,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        213u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::DPdxCoarse(OpDPdxCoarse {
+                    id_result_type,
+                    id_result,
+                    p,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        214u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::DPdyCoarse(OpDPdyCoarse {
+                    id_result_type,
+                    id_result,
+                    p,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        215u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::FwidthCoarse(OpFwidthCoarse {
+                    id_result_type,
+                    id_result,
+                    p,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        218u16 => split_fn!({
+            if words.is_empty() {
+                Ok(Instruction::EmitVertex(OpEmitVertex {}))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        219u16 => split_fn!({
+            if words.is_empty() {
+                Ok(Instruction::EndPrimitive(OpEndPrimitive {}))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        220u16 => split_fn!({
+            let (stream, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::EmitStreamVertex(OpEmitStreamVertex { stream }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        221u16 => split_fn!({
+            let (stream, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::EndStreamPrimitive(OpEndStreamPrimitive {
+                    stream,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        224u16 => split_fn!({
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::ControlBarrier(OpControlBarrier {
+                    execution,
+                    memory,
+                    semantics,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        225u16 => split_fn!({
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::MemoryBarrier(OpMemoryBarrier {
+                    memory,
+                    semantics,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        227u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicLoad(OpAtomicLoad {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                    memory,
+                    semantics,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        228u16 => split_fn!({
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicStore(OpAtomicStore {
+                    pointer,
+                    memory,
+                    semantics,
+                    value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        229u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicExchange(OpAtomicExchange {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                    memory,
+                    semantics,
+                    value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        230u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (equal, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (unequal, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (comparator, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicCompareExchange(
+                    OpAtomicCompareExchange {
+                        id_result_type,
+                        id_result,
+                        pointer,
+                        memory,
+                        equal,
+                        unequal,
+                        value,
+                        comparator,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        231u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (equal, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (unequal, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (comparator, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicCompareExchangeWeak(
+                    OpAtomicCompareExchangeWeak {
+                        id_result_type,
+                        id_result,
+                        pointer,
+                        memory,
+                        equal,
+                        unequal,
+                        value,
+                        comparator,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        232u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicIIncrement(OpAtomicIIncrement {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                    memory,
+                    semantics,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        233u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicIDecrement(OpAtomicIDecrement {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                    memory,
+                    semantics,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        234u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicIAdd(OpAtomicIAdd {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                    memory,
+                    semantics,
+                    value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        235u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicISub(OpAtomicISub {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                    memory,
+                    semantics,
+                    value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        236u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicSMin(OpAtomicSMin {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                    memory,
+                    semantics,
+                    value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        237u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicUMin(OpAtomicUMin {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                    memory,
+                    semantics,
+                    value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        238u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicSMax(OpAtomicSMax {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                    memory,
+                    semantics,
+                    value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        239u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicUMax(OpAtomicUMax {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                    memory,
+                    semantics,
+                    value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        240u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicAnd(OpAtomicAnd {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                    memory,
+                    semantics,
+                    value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        241u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicOr(OpAtomicOr {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                    memory,
+                    semantics,
+                    value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        242u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicXor(OpAtomicXor {
+                    id_result_type,
+                    id_result,
+                    pointer,
+                    memory,
+                    semantics,
+                    value,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        245u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (variable_parent, words) = Vec::<PairIdRefIdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::Phi(OpPhi {
+                    id_result_type,
+                    id_result,
+                    variable_parent,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        246u16 => split_fn!({
+            let (merge_block, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (continue_target, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (loop_control, words) = LoopControl::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::LoopMerge(OpLoopMerge {
+                    merge_block,
+                    continue_target,
+                    loop_control,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        247u16 => split_fn!({
+            let (merge_block, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (selection_control, words) = SelectionControl::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::SelectionMerge(OpSelectionMerge {
+                    merge_block,
+                    selection_control,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        248u16 => split_fn!({
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::Label(OpLabel { id_result }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        249u16 => split_fn!({
+            let (target_label, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::Branch(OpBranch { target_label }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        250u16 => split_fn!({
+            let (condition, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (true_label, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (false_label, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (branch_weights, words) = Vec::<LiteralInteger32>::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::BranchConditional(OpBranchConditional {
+                    condition,
+                    true_label,
+                    false_label,
+                    branch_weights,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        251u16 => split_fn!({
+            let (selector, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (default, words) = IdRef::spirv_parse(words, parse_state)?;
+            match &parse_state.id_states[selector.0 as usize] {
+                IdState::Value(IdStateValue(BitWidth::Width32OrLess)) => {
+                    let (target, words) =
+                        Vec::<PairLiteralInteger32IdRef>::spirv_parse(words, parse_state)?;
                     if words.is_empty() {
-                        Ok(Instruction::GLSLStd450NMax(OpGLSLStd450NMax {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            y,
+                        Ok(Instruction::Switch32(OpSwitch32 {
+                            selector,
+                            default,
+                            target,
                         }))
                     } else {
                         Err(Error::InstructionTooLong)
                     }
-                }),
-                (ExtensionInstructionSet::GLSLStd450, 81u32) => split_fn!({
-                    let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (min_val, words) = IdRef::spirv_parse(words, parse_state)?;
-                    let (max_val, words) = IdRef::spirv_parse(words, parse_state)?;
+                }
+                IdState::Value(IdStateValue(BitWidth::Width64)) => {
+                    let (target, words) =
+                        Vec::<PairLiteralInteger64IdRef>::spirv_parse(words, parse_state)?;
                     if words.is_empty() {
-                        Ok(Instruction::GLSLStd450NClamp(OpGLSLStd450NClamp {
-                            id_result_type,
-                            id_result,
-                            set,
-                            x,
-                            min_val,
-                            max_val,
+                        Ok(Instruction::Switch64(OpSwitch64 {
+                            selector,
+                            default,
+                            target,
                         }))
                     } else {
                         Err(Error::InstructionTooLong)
                     }
-                }),
-                (extension_instruction_set, instruction) => Err(Error::UnknownExtensionOpcode(
-                    extension_instruction_set,
-                    instruction,
-                )),
+                }
+                _ => Err(Error::SwitchSelectorIsInvalid(selector)),
+            }
+        }),
+        252u16 => split_fn!({
+            if words.is_empty() {
+                Ok(Instruction::Kill(OpKill {}))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        253u16 => split_fn!({
+            if words.is_empty() {
+                Ok(Instruction::Return(OpReturn {}))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        254u16 => split_fn!({
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::ReturnValue(OpReturnValue { value }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        255u16 => split_fn!({
+            if words.is_empty() {
+                Ok(Instruction::Unreachable(OpUnreachable {}))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        256u16 => split_fn!({
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (size, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::LifetimeStart(OpLifetimeStart {
+                    pointer,
+                    size,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        257u16 => split_fn!({
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (size, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::LifetimeStop(OpLifetimeStop { pointer, size }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        259u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (destination, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (source, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (num_elements, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (stride, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (event, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupAsyncCopy(OpGroupAsyncCopy {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    destination,
+                    source,
+                    num_elements,
+                    stride,
+                    event,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        260u16 => split_fn!({
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (num_events, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (events_list, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupWaitEvents(OpGroupWaitEvents {
+                    execution,
+                    num_events,
+                    events_list,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        261u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (predicate, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupAll(OpGroupAll {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    predicate,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        262u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (predicate, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupAny(OpGroupAny {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    predicate,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        263u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (local_id, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupBroadcast(OpGroupBroadcast {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    value,
+                    local_id,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        264u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupIAdd(OpGroupIAdd {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    operation,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        265u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupFAdd(OpGroupFAdd {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    operation,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        266u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupFMin(OpGroupFMin {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    operation,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        267u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupUMin(OpGroupUMin {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    operation,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        268u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupSMin(OpGroupSMin {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    operation,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        269u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupFMax(OpGroupFMax {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    operation,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        270u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupUMax(OpGroupUMax {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    operation,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        271u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupSMax(OpGroupSMax {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    operation,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        274u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ReadPipe(OpReadPipe {
+                    id_result_type,
+                    id_result,
+                    pipe,
+                    pointer,
+                    packet_size,
+                    packet_alignment,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        275u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::WritePipe(OpWritePipe {
+                    id_result_type,
+                    id_result,
+                    pipe,
+                    pointer,
+                    packet_size,
+                    packet_alignment,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        276u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (reserve_id, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (index, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ReservedReadPipe(OpReservedReadPipe {
+                    id_result_type,
+                    id_result,
+                    pipe,
+                    reserve_id,
+                    index,
+                    pointer,
+                    packet_size,
+                    packet_alignment,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        277u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (reserve_id, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (index, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ReservedWritePipe(OpReservedWritePipe {
+                    id_result_type,
+                    id_result,
+                    pipe,
+                    reserve_id,
+                    index,
+                    pointer,
+                    packet_size,
+                    packet_alignment,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        278u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (num_packets, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ReserveReadPipePackets(
+                    OpReserveReadPipePackets {
+                        id_result_type,
+                        id_result,
+                        pipe,
+                        num_packets,
+                        packet_size,
+                        packet_alignment,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        279u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (num_packets, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ReserveWritePipePackets(
+                    OpReserveWritePipePackets {
+                        id_result_type,
+                        id_result,
+                        pipe,
+                        num_packets,
+                        packet_size,
+                        packet_alignment,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        280u16 => split_fn!({
+            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (reserve_id, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::CommitReadPipe(OpCommitReadPipe {
+                    pipe,
+                    reserve_id,
+                    packet_size,
+                    packet_alignment,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        281u16 => split_fn!({
+            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (reserve_id, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::CommitWritePipe(OpCommitWritePipe {
+                    pipe,
+                    reserve_id,
+                    packet_size,
+                    packet_alignment,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        282u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (reserve_id, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::IsValidReserveId(OpIsValidReserveId {
+                    id_result_type,
+                    id_result,
+                    reserve_id,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        283u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GetNumPipePackets(OpGetNumPipePackets {
+                    id_result_type,
+                    id_result,
+                    pipe,
+                    packet_size,
+                    packet_alignment,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        284u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GetMaxPipePackets(OpGetMaxPipePackets {
+                    id_result_type,
+                    id_result,
+                    pipe,
+                    packet_size,
+                    packet_alignment,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        285u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (num_packets, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupReserveReadPipePackets(
+                    OpGroupReserveReadPipePackets {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        pipe,
+                        num_packets,
+                        packet_size,
+                        packet_alignment,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        286u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (num_packets, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupReserveWritePipePackets(
+                    OpGroupReserveWritePipePackets {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        pipe,
+                        num_packets,
+                        packet_size,
+                        packet_alignment,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        287u16 => split_fn!({
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (reserve_id, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupCommitReadPipe(OpGroupCommitReadPipe {
+                    execution,
+                    pipe,
+                    reserve_id,
+                    packet_size,
+                    packet_alignment,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        288u16 => split_fn!({
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (reserve_id, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::GroupCommitWritePipe(OpGroupCommitWritePipe {
+                    execution,
+                    pipe,
+                    reserve_id,
+                    packet_size,
+                    packet_alignment,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        291u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (queue, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (num_events, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (wait_events, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (ret_event, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::EnqueueMarker(OpEnqueueMarker {
+                    id_result_type,
+                    id_result,
+                    queue,
+                    num_events,
+                    wait_events,
+                    ret_event,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        292u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (queue, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (flags, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (nd_range, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (num_events, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (wait_events, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (ret_event, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (local_size, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::EnqueueKernel(OpEnqueueKernel {
+                    id_result_type,
+                    id_result,
+                    queue,
+                    flags,
+                    nd_range,
+                    num_events,
+                    wait_events,
+                    ret_event,
+                    invoke,
+                    param,
+                    param_size,
+                    param_align,
+                    local_size,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        293u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (nd_range, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GetKernelNDrangeSubGroupCount(
+                    OpGetKernelNDrangeSubGroupCount {
+                        id_result_type,
+                        id_result,
+                        nd_range,
+                        invoke,
+                        param,
+                        param_size,
+                        param_align,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        294u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (nd_range, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GetKernelNDrangeMaxSubGroupSize(
+                    OpGetKernelNDrangeMaxSubGroupSize {
+                        id_result_type,
+                        id_result,
+                        nd_range,
+                        invoke,
+                        param,
+                        param_size,
+                        param_align,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        295u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GetKernelWorkGroupSize(
+                    OpGetKernelWorkGroupSize {
+                        id_result_type,
+                        id_result,
+                        invoke,
+                        param,
+                        param_size,
+                        param_align,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        296u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GetKernelPreferredWorkGroupSizeMultiple(
+                    OpGetKernelPreferredWorkGroupSizeMultiple {
+                        id_result_type,
+                        id_result,
+                        invoke,
+                        param,
+                        param_size,
+                        param_align,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        297u16 => split_fn!({
+            let (event, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::RetainEvent(OpRetainEvent { event }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        298u16 => split_fn!({
+            let (event, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::ReleaseEvent(OpReleaseEvent { event }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        299u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::CreateUserEvent(OpCreateUserEvent {
+                    id_result_type,
+                    id_result,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        300u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (event, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::IsValidEvent(OpIsValidEvent {
+                    id_result_type,
+                    id_result,
+                    event,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        301u16 => split_fn!({
+            let (event, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (status, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::SetUserEventStatus(OpSetUserEventStatus {
+                    event,
+                    status,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        302u16 => split_fn!({
+            let (event, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (profiling_info, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::CaptureEventProfilingInfo(
+                    OpCaptureEventProfilingInfo {
+                        event,
+                        profiling_info,
+                        value,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        303u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::GetDefaultQueue(OpGetDefaultQueue {
+                    id_result_type,
+                    id_result,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        304u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (global_work_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (local_work_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (global_work_offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::BuildNDRange(OpBuildNDRange {
+                    id_result_type,
+                    id_result,
+                    global_work_size,
+                    local_work_size,
+                    global_work_offset,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        305u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageSparseSampleImplicitLod(
+                    OpImageSparseSampleImplicitLod {
+                        id_result_type,
+                        id_result,
+                        sampled_image,
+                        coordinate,
+                        image_operands,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        306u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = ImageOperands::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
+            if words.is_empty() {
+                Ok(Instruction::ImageSparseSampleExplicitLod(
+                    OpImageSparseSampleExplicitLod {
+                        id_result_type,
+                        id_result,
+                        sampled_image,
+                        coordinate,
+                        image_operands,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
             }
         }),
-        14u16 => split_fn!({
-            let (addressing_model, words) = AddressingModel::spirv_parse(words, parse_state)?;
-            let (memory_model, words) = MemoryModel::spirv_parse(words, parse_state)?;
+        307u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::MemoryModel(OpMemoryModel {
-                    addressing_model,
-                    memory_model,
-                }))
+                Ok(Instruction::ImageSparseSampleDrefImplicitLod(
+                    OpImageSparseSampleDrefImplicitLod {
+                        id_result_type,
+                        id_result,
+                        sampled_image,
+                        coordinate,
+                        d_ref,
+                        image_operands,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        15u16 => split_fn!({
-            let (execution_model, words) = ExecutionModel::spirv_parse(words, parse_state)?;
-            let (entry_point, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (name, words) = LiteralString::spirv_parse(words, parse_state)?;
-            let (interface, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+        308u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = ImageOperands::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::EntryPoint(OpEntryPoint {
-                    execution_model,
-                    entry_point,
-                    name,
-                    interface,
-                }))
+                Ok(Instruction::ImageSparseSampleDrefExplicitLod(
+                    OpImageSparseSampleDrefExplicitLod {
+                        id_result_type,
+                        id_result,
+                        sampled_image,
+                        coordinate,
+                        d_ref,
+                        image_operands,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        16u16 => split_fn!({
-            let (entry_point, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (mode, words) = ExecutionMode::spirv_parse(words, parse_state)?;
+        313u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::ExecutionMode(OpExecutionMode {
-                    entry_point,
-                    mode,
+                Ok(Instruction::ImageSparseFetch(OpImageSparseFetch {
+                    id_result_type,
+                    id_result,
+                    image,
+                    coordinate,
+                    image_operands,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        17u16 => split_fn!({
-            let (capability, words) = Capability::spirv_parse(words, parse_state)?;
+        314u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (component, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::Capability(OpCapability { capability }))
+                Ok(Instruction::ImageSparseGather(OpImageSparseGather {
+                    id_result_type,
+                    id_result,
+                    sampled_image,
+                    coordinate,
+                    component,
+                    image_operands,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        19u16 => split_fn!({
+        315u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeVoid(OpTypeVoid { id_result }))
+                Ok(Instruction::ImageSparseDrefGather(
+                    OpImageSparseDrefGather {
+                        id_result_type,
+                        id_result,
+                        sampled_image,
+                        coordinate,
+                        d_ref,
+                        image_operands,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        20u16 => split_fn!({
+        316u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (resident_code, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeBool(OpTypeBool { id_result }))
+                Ok(Instruction::ImageSparseTexelsResident(
+                    OpImageSparseTexelsResident {
+                        id_result_type,
+                        id_result,
+                        resident_code,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        21u16 => split_fn!({
+        317u16 => split_fn!({
+            if words.is_empty() {
+                Ok(Instruction::NoLine(OpNoLine {}))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        318u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (width, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let (signedness, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let id_state = match width {
-                8 | 16 | 32 => IdState::Type(IdStateType(BitWidth::Width32OrLess)),
-                64 => IdState::Type(IdStateType(BitWidth::Width64)),
-                _ => return Err(Error::UnsupportedIntSize),
-            };
-            parse_state.define_id(id_result, id_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeInt(OpTypeInt {
+                Ok(Instruction::AtomicFlagTestAndSet(OpAtomicFlagTestAndSet {
+                    id_result_type,
                     id_result,
-                    width,
-                    signedness,
+                    pointer,
+                    memory,
+                    semantics,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        22u16 => split_fn!({
+        319u16 => split_fn!({
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::AtomicFlagClear(OpAtomicFlagClear {
+                    pointer,
+                    memory,
+                    semantics,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        320u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (width, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let id_state = match width {
-                16 | 32 => IdState::Type(IdStateType(BitWidth::Width32OrLess)),
-                64 => IdState::Type(IdStateType(BitWidth::Width64)),
-                _ => return Err(Error::UnsupportedFloatSize),
-            };
-            parse_state.define_id(id_result, id_state)?;
+            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeFloat(OpTypeFloat { id_result, width }))
+                Ok(Instruction::ImageSparseRead(OpImageSparseRead {
+                    id_result_type,
+                    id_result,
+                    image,
+                    coordinate,
+                    image_operands,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        23u16 => split_fn!({
+        321u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (component_type, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (component_count, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeVector(OpTypeVector {
+                Ok(Instruction::SizeOf(OpSizeOf {
+                    id_result_type,
                     id_result,
-                    component_type,
-                    component_count,
+                    pointer,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        24u16 => split_fn!({
+        322u16 => split_fn!({
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (column_type, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (column_count, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::TypeMatrix(OpTypeMatrix {
+                Ok(Instruction::TypePipeStorage(OpTypePipeStorage {
                     id_result,
-                    column_type,
-                    column_count,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        25u16 => split_fn!({
+        323u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_type, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (dim, words) = Dim::spirv_parse(words, parse_state)?;
-            let (depth, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let (arrayed, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let (ms, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let (sampled, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let (image_format, words) = ImageFormat::spirv_parse(words, parse_state)?;
-            let (access_qualifier, words) =
-                Option::<AccessQualifier>::spirv_parse(words, parse_state)?;
+            let (packet_size, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (packet_alignment, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (capacity, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeImage(OpTypeImage {
+                Ok(Instruction::ConstantPipeStorage(OpConstantPipeStorage {
+                    id_result_type,
                     id_result,
-                    sampled_type,
-                    dim,
-                    depth,
-                    arrayed,
-                    ms,
-                    sampled,
-                    image_format,
-                    access_qualifier,
+                    packet_size,
+                    packet_alignment,
+                    capacity,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        26u16 => split_fn!({
+        324u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (pipe_storage, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeSampler(OpTypeSampler { id_result }))
+                Ok(Instruction::CreatePipeFromPipeStorage(
+                    OpCreatePipeFromPipeStorage {
+                        id_result_type,
+                        id_result,
+                        pipe_storage,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        27u16 => split_fn!({
+        325u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (image_type, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (subgroup_count, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeSampledImage(OpTypeSampledImage {
-                    id_result,
-                    image_type,
-                }))
+                Ok(Instruction::GetKernelLocalSizeForSubgroupCount(
+                    OpGetKernelLocalSizeForSubgroupCount {
+                        id_result_type,
+                        id_result,
+                        subgroup_count,
+                        invoke,
+                        param,
+                        param_size,
+                        param_align,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        28u16 => split_fn!({
+        326u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (element_type, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (length, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeArray(OpTypeArray {
-                    id_result,
-                    element_type,
-                    length,
-                }))
+                Ok(Instruction::GetKernelMaxNumSubgroups(
+                    OpGetKernelMaxNumSubgroups {
+                        id_result_type,
+                        id_result,
+                        invoke,
+                        param,
+                        param_size,
+                        param_align,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        29u16 => split_fn!({
+        327u16 => split_fn!({
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (element_type, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::TypeRuntimeArray(OpTypeRuntimeArray {
+                Ok(Instruction::TypeNamedBarrier(OpTypeNamedBarrier {
                     id_result,
-                    element_type,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        30u16 => split_fn!({
+        328u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (member_types, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            let (subgroup_count, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeStruct(OpTypeStruct {
-                    id_result,
-                    member_types,
+                Ok(Instruction::NamedBarrierInitialize(
+                    OpNamedBarrierInitialize {
+                        id_result_type,
+                        id_result,
+                        subgroup_count,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        329u16 => split_fn!({
+            let (named_barrier, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::MemoryNamedBarrier(OpMemoryNamedBarrier {
+                    named_barrier,
+                    memory,
+                    semantics,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        31u16 => split_fn!({
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (the_name_of_the_opaque_type, words) =
-                LiteralString::spirv_parse(words, parse_state)?;
+        330u16 => split_fn!({
+            let (process, words) = LiteralString::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::TypeOpaque(OpTypeOpaque {
-                    id_result,
-                    the_name_of_the_opaque_type,
+                Ok(Instruction::ModuleProcessed(OpModuleProcessed { process }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        331u16 => split_fn!({
+            let (entry_point, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (mode, words) = ExecutionMode::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::ExecutionModeId(OpExecutionModeId {
+                    entry_point,
+                    mode,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        32u16 => split_fn!({
+        332u16 => split_fn!({
+            let (target, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (decoration, words) = Decoration::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::DecorateId(OpDecorateId { target, decoration }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        333u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (storage_class, words) = StorageClass::spirv_parse(words, parse_state)?;
-            let (type_, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypePointer(OpTypePointer {
+                Ok(Instruction::GroupNonUniformElect(OpGroupNonUniformElect {
+                    id_result_type,
                     id_result,
-                    storage_class,
-                    type_,
+                    execution,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        33u16 => split_fn!({
+        334u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (return_type, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (parameter_types, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (predicate, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeFunction(OpTypeFunction {
+                Ok(Instruction::GroupNonUniformAll(OpGroupNonUniformAll {
+                    id_result_type,
                     id_result,
-                    return_type,
-                    parameter_types,
+                    execution,
+                    predicate,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        34u16 => split_fn!({
+        335u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (predicate, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeEvent(OpTypeEvent { id_result }))
+                Ok(Instruction::GroupNonUniformAny(OpGroupNonUniformAny {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    predicate,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        35u16 => split_fn!({
+        336u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeDeviceEvent(OpTypeDeviceEvent {
-                    id_result,
-                }))
+                Ok(Instruction::GroupNonUniformAllEqual(
+                    OpGroupNonUniformAllEqual {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        value,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        36u16 => split_fn!({
+        337u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (id, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeReserveId(OpTypeReserveId { id_result }))
+                Ok(Instruction::GroupNonUniformBroadcast(
+                    OpGroupNonUniformBroadcast {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        value,
+                        id,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        37u16 => split_fn!({
+        338u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeQueue(OpTypeQueue { id_result }))
+                Ok(Instruction::GroupNonUniformBroadcastFirst(
+                    OpGroupNonUniformBroadcastFirst {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        value,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        38u16 => split_fn!({
+        339u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (qualifier, words) = AccessQualifier::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (predicate, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypePipe(OpTypePipe {
-                    id_result,
-                    qualifier,
-                }))
+                Ok(Instruction::GroupNonUniformBallot(
+                    OpGroupNonUniformBallot {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        predicate,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        39u16 => split_fn!({
-            let (pointer_type, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (storage_class, words) = StorageClass::spirv_parse(words, parse_state)?;
+        340u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::TypeForwardPointer(OpTypeForwardPointer {
-                    pointer_type,
-                    storage_class,
-                }))
+                Ok(Instruction::GroupNonUniformInverseBallot(
+                    OpGroupNonUniformInverseBallot {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        value,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        41u16 => split_fn!({
+        341u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (index, words) = IdRef::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::ConstantTrue(OpConstantTrue {
-                    id_result_type,
-                    id_result,
-                }))
+                Ok(Instruction::GroupNonUniformBallotBitExtract(
+                    OpGroupNonUniformBallotBitExtract {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        value,
+                        index,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        42u16 => split_fn!({
+        342u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::ConstantFalse(OpConstantFalse {
-                    id_result_type,
-                    id_result,
-                }))
+                Ok(Instruction::GroupNonUniformBallotBitCount(
+                    OpGroupNonUniformBallotBitCount {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        operation,
+                        value,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        43u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
-            match parse_state.get_type(id_result_type.0)? {
-                IdStateType(BitWidth::Width32OrLess) => {
-                    let (value, words) =
-                        LiteralContextDependentNumber32::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::Constant32(OpConstant32 {
-                            id_result_type,
-                            id_result,
-                            value,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }
-                IdStateType(BitWidth::Width64) => {
-                    let (value, words) =
-                        LiteralContextDependentNumber64::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::Constant64(OpConstant64 {
-                            id_result_type,
-                            id_result,
-                            value,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }
-            }
-        }),
-        44u16 => split_fn!({
+        343u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (constituents, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::ConstantComposite(OpConstantComposite {
-                    id_result_type,
-                    id_result,
-                    constituents,
-                }))
+                Ok(Instruction::GroupNonUniformBallotFindLSB(
+                    OpGroupNonUniformBallotFindLSB {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        value,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        45u16 => split_fn!({
+        344u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampler_addressing_mode, words) =
-                SamplerAddressingMode::spirv_parse(words, parse_state)?;
-            let (param, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let (sampler_filter_mode, words) = SamplerFilterMode::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::ConstantSampler(OpConstantSampler {
-                    id_result_type,
-                    id_result,
-                    sampler_addressing_mode,
-                    param,
-                    sampler_filter_mode,
-                }))
+                Ok(Instruction::GroupNonUniformBallotFindMSB(
+                    OpGroupNonUniformBallotFindMSB {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        value,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        46u16 => split_fn!({
+        345u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (id, words) = IdRef::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::ConstantNull(OpConstantNull {
-                    id_result_type,
-                    id_result,
-                }))
+                Ok(Instruction::GroupNonUniformShuffle(
+                    OpGroupNonUniformShuffle {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        value,
+                        id,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        48u16 => split_fn!({
+        346u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (mask, words) = IdRef::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::SpecConstantTrue(OpSpecConstantTrue {
-                    id_result_type,
-                    id_result,
-                }))
+                Ok(Instruction::GroupNonUniformShuffleXor(
+                    OpGroupNonUniformShuffleXor {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        value,
+                        mask,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        49u16 => split_fn!({
+        347u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (delta, words) = IdRef::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::SpecConstantFalse(OpSpecConstantFalse {
-                    id_result_type,
-                    id_result,
-                }))
+                Ok(Instruction::GroupNonUniformShuffleUp(
+                    OpGroupNonUniformShuffleUp {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        value,
+                        delta,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        50u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
-            match parse_state.get_type(id_result_type.0)? {
-                IdStateType(BitWidth::Width32OrLess) => {
-                    let (value, words) =
-                        LiteralContextDependentNumber32::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::SpecConstant32(OpSpecConstant32 {
-                            id_result_type,
-                            id_result,
-                            value,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }
-                IdStateType(BitWidth::Width64) => {
-                    let (value, words) =
-                        LiteralContextDependentNumber64::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::SpecConstant64(OpSpecConstant64 {
-                            id_result_type,
-                            id_result,
-                            value,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }
-            }
-        }),
-        51u16 => split_fn!({
+        348u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (constituents, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (delta, words) = IdRef::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::SpecConstantComposite(
-                    OpSpecConstantComposite {
+                Ok(Instruction::GroupNonUniformShuffleDown(
+                    OpGroupNonUniformShuffleDown {
                         id_result_type,
                         id_result,
-                        constituents,
+                        execution,
+                        value,
+                        delta,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        52u16 => split_fn!({
-            let (operation, words) = OpSpecConstantOp::spirv_parse(words, parse_state)?;
+        349u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::SpecConstantOp(operation))
+                Ok(Instruction::GroupNonUniformIAdd(OpGroupNonUniformIAdd {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    operation,
+                    value,
+                    cluster_size,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        54u16 => split_fn!({
+        350u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (function_control, words) = FunctionControl::spirv_parse(words, parse_state)?;
-            let (function_type, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::Function(OpFunction {
+                Ok(Instruction::GroupNonUniformFAdd(OpGroupNonUniformFAdd {
                     id_result_type,
                     id_result,
-                    function_control,
-                    function_type,
+                    execution,
+                    operation,
+                    value,
+                    cluster_size,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        55u16 => split_fn!({
+        351u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::FunctionParameter(OpFunctionParameter {
+                Ok(Instruction::GroupNonUniformIMul(OpGroupNonUniformIMul {
                     id_result_type,
                     id_result,
+                    execution,
+                    operation,
+                    value,
+                    cluster_size,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        56u16 => split_fn!({
+        352u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::FunctionEnd(OpFunctionEnd {}))
+                Ok(Instruction::GroupNonUniformFMul(OpGroupNonUniformFMul {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    operation,
+                    value,
+                    cluster_size,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        57u16 => split_fn!({
+        353u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (function, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (arguments, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::FunctionCall(OpFunctionCall {
+                Ok(Instruction::GroupNonUniformSMin(OpGroupNonUniformSMin {
                     id_result_type,
                     id_result,
-                    function,
-                    arguments,
+                    execution,
+                    operation,
+                    value,
+                    cluster_size,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        59u16 => split_fn!({
+        354u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (storage_class, words) = StorageClass::spirv_parse(words, parse_state)?;
-            let (initializer, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::Variable(OpVariable {
+                Ok(Instruction::GroupNonUniformUMin(OpGroupNonUniformUMin {
                     id_result_type,
                     id_result,
-                    storage_class,
-                    initializer,
+                    execution,
+                    operation,
+                    value,
+                    cluster_size,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        60u16 => split_fn!({
+        355u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (sample, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::ImageTexelPointer(OpImageTexelPointer {
+                Ok(Instruction::GroupNonUniformFMin(OpGroupNonUniformFMin {
                     id_result_type,
                     id_result,
-                    image,
-                    coordinate,
-                    sample,
+                    execution,
+                    operation,
+                    value,
+                    cluster_size,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        61u16 => split_fn!({
+        356u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory_access, words) = Option::<MemoryAccess>::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::Load(OpLoad {
+                Ok(Instruction::GroupNonUniformSMax(OpGroupNonUniformSMax {
                     id_result_type,
                     id_result,
-                    pointer,
-                    memory_access,
+                    execution,
+                    operation,
+                    value,
+                    cluster_size,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        62u16 => split_fn!({
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (object, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory_access, words) = Option::<MemoryAccess>::spirv_parse(words, parse_state)?;
+        357u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::Store(OpStore {
-                    pointer,
-                    object,
-                    memory_access,
+                Ok(Instruction::GroupNonUniformUMax(OpGroupNonUniformUMax {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    operation,
+                    value,
+                    cluster_size,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        63u16 => split_fn!({
-            let (target, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (source, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory_access, words) = Option::<MemoryAccess>::spirv_parse(words, parse_state)?;
-            let (source_memory_access, words) =
-                Option::<MemoryAccess>::spirv_parse(words, parse_state)?;
+        358u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::CopyMemory(OpCopyMemory {
-                    target,
-                    source,
-                    memory_access,
-                    source_memory_access,
+                Ok(Instruction::GroupNonUniformFMax(OpGroupNonUniformFMax {
+                    id_result_type,
+                    id_result,
+                    execution,
+                    operation,
+                    value,
+                    cluster_size,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        64u16 => split_fn!({
-            let (target, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (source, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory_access, words) = Option::<MemoryAccess>::spirv_parse(words, parse_state)?;
-            let (source_memory_access, words) =
-                Option::<MemoryAccess>::spirv_parse(words, parse_state)?;
+        359u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::CopyMemorySized(OpCopyMemorySized {
-                    target,
-                    source,
-                    size,
-                    memory_access,
-                    source_memory_access,
-                }))
+                Ok(Instruction::GroupNonUniformBitwiseAnd(
+                    OpGroupNonUniformBitwiseAnd {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        operation,
+                        value,
+                        cluster_size,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        65u16 => split_fn!({
+        360u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (indexes, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::AccessChain(OpAccessChain {
-                    id_result_type,
-                    id_result,
-                    base,
-                    indexes,
-                }))
+                Ok(Instruction::GroupNonUniformBitwiseOr(
+                    OpGroupNonUniformBitwiseOr {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        operation,
+                        value,
+                        cluster_size,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        66u16 => split_fn!({
+        361u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (indexes, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::InBoundsAccessChain(OpInBoundsAccessChain {
-                    id_result_type,
-                    id_result,
-                    base,
-                    indexes,
-                }))
+                Ok(Instruction::GroupNonUniformBitwiseXor(
+                    OpGroupNonUniformBitwiseXor {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        operation,
+                        value,
+                        cluster_size,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        67u16 => split_fn!({
+        362u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (element, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (indexes, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::PtrAccessChain(OpPtrAccessChain {
-                    id_result_type,
-                    id_result,
-                    base,
-                    element,
-                    indexes,
-                }))
+                Ok(Instruction::GroupNonUniformLogicalAnd(
+                    OpGroupNonUniformLogicalAnd {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        operation,
+                        value,
+                        cluster_size,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        68u16 => split_fn!({
+        363u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (structure, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (array_member, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::ArrayLength(OpArrayLength {
-                    id_result_type,
-                    id_result,
-                    structure,
-                    array_member,
-                }))
+                Ok(Instruction::GroupNonUniformLogicalOr(
+                    OpGroupNonUniformLogicalOr {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        operation,
+                        value,
+                        cluster_size,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        69u16 => split_fn!({
+        364u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GenericPtrMemSemantics(
-                    OpGenericPtrMemSemantics {
+                Ok(Instruction::GroupNonUniformLogicalXor(
+                    OpGroupNonUniformLogicalXor {
                         id_result_type,
                         id_result,
-                        pointer,
+                        execution,
+                        operation,
+                        value,
+                        cluster_size,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        70u16 => split_fn!({
+        365u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (element, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (indexes, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (index, words) = IdRef::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::InBoundsPtrAccessChain(
-                    OpInBoundsPtrAccessChain {
+                Ok(Instruction::GroupNonUniformQuadBroadcast(
+                    OpGroupNonUniformQuadBroadcast {
                         id_result_type,
                         id_result,
-                        base,
-                        element,
-                        indexes,
+                        execution,
+                        value,
+                        index,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        71u16 => split_fn!({
-            let (target, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (decoration, words) = Decoration::spirv_parse(words, parse_state)?;
-            if words.is_empty() {
-                Ok(Instruction::Decorate(OpDecorate { target, decoration }))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        72u16 => split_fn!({
-            let (structure_type, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (member, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let (decoration, words) = Decoration::spirv_parse(words, parse_state)?;
+        366u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (direction, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::MemberDecorate(OpMemberDecorate {
-                    structure_type,
-                    member,
-                    decoration,
-                }))
+                Ok(Instruction::GroupNonUniformQuadSwap(
+                    OpGroupNonUniformQuadSwap {
+                        id_result_type,
+                        id_result,
+                        execution,
+                        value,
+                        direction,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        73u16 => split_fn!({
+        400u16 => split_fn!({
+            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+            let (operand, words) = IdRef::spirv_parse(words, parse_state)?;
+            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::DecorationGroup(OpDecorationGroup {
+                Ok(Instruction::CopyLogical(OpCopyLogical {
+                    id_result_type,
                     id_result,
+                    operand,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        74u16 => split_fn!({
-            let (decoration_group, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (targets, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
-            if words.is_empty() {
-                Ok(Instruction::GroupDecorate(OpGroupDecorate {
-                    decoration_group,
-                    targets,
-                }))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        75u16 => split_fn!({
-            let (decoration_group, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (targets, words) = Vec::<PairIdRefLiteralInteger>::spirv_parse(words, parse_state)?;
-            if words.is_empty() {
-                Ok(Instruction::GroupMemberDecorate(OpGroupMemberDecorate {
-                    decoration_group,
-                    targets,
-                }))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        77u16 => split_fn!({
+        401u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (vector, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (index, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::VectorExtractDynamic(OpVectorExtractDynamic {
+                Ok(Instruction::PtrEqual(OpPtrEqual {
                     id_result_type,
                     id_result,
-                    vector,
-                    index,
+                    operand_1,
+                    operand_2,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        78u16 => split_fn!({
+        402u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (vector, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (component, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (index, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::VectorInsertDynamic(OpVectorInsertDynamic {
+                Ok(Instruction::PtrNotEqual(OpPtrNotEqual {
                     id_result_type,
                     id_result,
-                    vector,
-                    component,
-                    index,
+                    operand_1,
+                    operand_2,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        79u16 => split_fn!({
+        403u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (vector_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (vector_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (components, words) = Vec::<LiteralInteger32>::spirv_parse(words, parse_state)?;
+            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::VectorShuffle(OpVectorShuffle {
+                Ok(Instruction::PtrDiff(OpPtrDiff {
                     id_result_type,
                     id_result,
-                    vector_1,
-                    vector_2,
-                    components,
+                    operand_1,
+                    operand_2,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        80u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (constituents, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        5632u16 => split_fn!({
+            let (target, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (decoration, words) = Decoration::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::CompositeConstruct(OpCompositeConstruct {
-                    id_result_type,
-                    id_result,
-                    constituents,
+                Ok(Instruction::DecorateString(OpDecorateString {
+                    target,
+                    decoration,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        81u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (composite, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (indexes, words) = Vec::<LiteralInteger32>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        5633u16 => split_fn!({
+            let (struct_type, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (member, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (decoration, words) = Decoration::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::CompositeExtract(OpCompositeExtract {
-                    id_result_type,
-                    id_result,
-                    composite,
-                    indexes,
+                Ok(Instruction::MemberDecorateString(OpMemberDecorateString {
+                    struct_type,
+                    member,
+                    decoration,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        82u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (object, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (composite, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (indexes, words) = Vec::<LiteralInteger32>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        opcode => Err(Error::UnknownOpcode(opcode)),
+    }
+}
+fn parse_extension_instruction(
+    extension_instruction_set: ExtensionInstructionSet,
+    instruction: LiteralExtInstInteger,
+    id_result_type: IdResultType,
+    id_result: IdResult,
+    set: IdRef,
+    words: &[u32],
+    parse_state: &mut ParseState,
+) -> Result<Instruction> {
+    match (extension_instruction_set, instruction) {
+        (ExtensionInstructionSet::OpenCLStd, 0u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::CompositeInsert(OpCompositeInsert {
+                Ok(Instruction::OpenCLStdAcos(OpOpenCLStdAcos {
                     id_result_type,
                     id_result,
-                    object,
-                    composite,
-                    indexes,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        83u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 1u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::CopyObject(OpCopyObject {
+                Ok(Instruction::OpenCLStdAcosh(OpOpenCLStdAcosh {
                     id_result_type,
                     id_result,
-                    operand,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        84u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (matrix, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 2u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::Transpose(OpTranspose {
+                Ok(Instruction::OpenCLStdAcospi(OpOpenCLStdAcospi {
                     id_result_type,
                     id_result,
-                    matrix,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        86u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (sampler, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 3u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SampledImage(OpSampledImage {
+                Ok(Instruction::OpenCLStdAsin(OpOpenCLStdAsin {
                     id_result_type,
                     id_result,
-                    image,
-                    sampler,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        87u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 4u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSampleImplicitLod(
-                    OpImageSampleImplicitLod {
-                        id_result_type,
-                        id_result,
-                        sampled_image,
-                        coordinate,
-                        image_operands,
-                    },
-                ))
+                Ok(Instruction::OpenCLStdAsinh(OpOpenCLStdAsinh {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        88u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = ImageOperands::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 5u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSampleExplicitLod(
-                    OpImageSampleExplicitLod {
-                        id_result_type,
-                        id_result,
-                        sampled_image,
-                        coordinate,
-                        image_operands,
-                    },
-                ))
+                Ok(Instruction::OpenCLStdAsinpi(OpOpenCLStdAsinpi {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        89u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 6u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSampleDrefImplicitLod(
-                    OpImageSampleDrefImplicitLod {
-                        id_result_type,
-                        id_result,
-                        sampled_image,
-                        coordinate,
-                        d_ref,
-                        image_operands,
-                    },
-                ))
+                Ok(Instruction::OpenCLStdAtan(OpOpenCLStdAtan {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        90u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = ImageOperands::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 7u32) => split_fn!({
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSampleDrefExplicitLod(
-                    OpImageSampleDrefExplicitLod {
-                        id_result_type,
-                        id_result,
-                        sampled_image,
-                        coordinate,
-                        d_ref,
-                        image_operands,
-                    },
-                ))
+                Ok(Instruction::OpenCLStdAtan2(OpOpenCLStdAtan2 {
+                    id_result_type,
+                    id_result,
+                    set,
+                    y,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        91u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 8u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSampleProjImplicitLod(
-                    OpImageSampleProjImplicitLod {
-                        id_result_type,
-                        id_result,
-                        sampled_image,
-                        coordinate,
-                        image_operands,
-                    },
-                ))
+                Ok(Instruction::OpenCLStdAtanh(OpOpenCLStdAtanh {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        92u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = ImageOperands::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 9u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSampleProjExplicitLod(
-                    OpImageSampleProjExplicitLod {
-                        id_result_type,
-                        id_result,
-                        sampled_image,
-                        coordinate,
-                        image_operands,
-                    },
-                ))
+                Ok(Instruction::OpenCLStdAtanpi(OpOpenCLStdAtanpi {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        93u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 10u32) => split_fn!({
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSampleProjDrefImplicitLod(
-                    OpImageSampleProjDrefImplicitLod {
-                        id_result_type,
-                        id_result,
-                        sampled_image,
-                        coordinate,
-                        d_ref,
-                        image_operands,
-                    },
-                ))
+                Ok(Instruction::OpenCLStdAtan2pi(OpOpenCLStdAtan2pi {
+                    id_result_type,
+                    id_result,
+                    set,
+                    y,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        94u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = ImageOperands::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 11u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSampleProjDrefExplicitLod(
-                    OpImageSampleProjDrefExplicitLod {
-                        id_result_type,
-                        id_result,
-                        sampled_image,
-                        coordinate,
-                        d_ref,
-                        image_operands,
-                    },
-                ))
+                Ok(Instruction::OpenCLStdCbrt(OpOpenCLStdCbrt {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        95u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 12u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageFetch(OpImageFetch {
+                Ok(Instruction::OpenCLStdCeil(OpOpenCLStdCeil {
                     id_result_type,
                     id_result,
-                    image,
-                    coordinate,
-                    image_operands,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        96u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (component, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 13u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageGather(OpImageGather {
+                Ok(Instruction::OpenCLStdCopysign(OpOpenCLStdCopysign {
                     id_result_type,
                     id_result,
-                    sampled_image,
-                    coordinate,
-                    component,
-                    image_operands,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        97u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 14u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageDrefGather(OpImageDrefGather {
+                Ok(Instruction::OpenCLStdCos(OpOpenCLStdCos {
                     id_result_type,
                     id_result,
-                    sampled_image,
-                    coordinate,
-                    d_ref,
-                    image_operands,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        98u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 15u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageRead(OpImageRead {
+                Ok(Instruction::OpenCLStdCosh(OpOpenCLStdCosh {
                     id_result_type,
                     id_result,
-                    image,
-                    coordinate,
-                    image_operands,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        99u16 => split_fn!({
-            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (texel, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 16u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageWrite(OpImageWrite {
-                    image,
-                    coordinate,
-                    texel,
-                    image_operands,
+                Ok(Instruction::OpenCLStdCospi(OpOpenCLStdCospi {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        100u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 17u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::Image(OpImage {
+                Ok(Instruction::OpenCLStdErfc(OpOpenCLStdErfc {
                     id_result_type,
                     id_result,
-                    sampled_image,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        101u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 18u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageQueryFormat(OpImageQueryFormat {
+                Ok(Instruction::OpenCLStdErf(OpOpenCLStdErf {
                     id_result_type,
                     id_result,
-                    image,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        102u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 19u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageQueryOrder(OpImageQueryOrder {
+                Ok(Instruction::OpenCLStdExp(OpOpenCLStdExp {
                     id_result_type,
                     id_result,
-                    image,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        103u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (level_of_detail, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 20u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageQuerySizeLod(OpImageQuerySizeLod {
+                Ok(Instruction::OpenCLStdExp2(OpOpenCLStdExp2 {
                     id_result_type,
                     id_result,
-                    image,
-                    level_of_detail,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        104u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 21u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageQuerySize(OpImageQuerySize {
+                Ok(Instruction::OpenCLStdExp10(OpOpenCLStdExp10 {
                     id_result_type,
                     id_result,
-                    image,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        105u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 22u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageQueryLod(OpImageQueryLod {
+                Ok(Instruction::OpenCLStdExpm1(OpOpenCLStdExpm1 {
                     id_result_type,
                     id_result,
-                    sampled_image,
-                    coordinate,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        106u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 23u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageQueryLevels(OpImageQueryLevels {
+                Ok(Instruction::OpenCLStdFabs(OpOpenCLStdFabs {
                     id_result_type,
                     id_result,
-                    image,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        107u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 24u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageQuerySamples(OpImageQuerySamples {
+                Ok(Instruction::OpenCLStdFdim(OpOpenCLStdFdim {
                     id_result_type,
                     id_result,
-                    image,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        109u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (float_value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 25u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ConvertFToU(OpConvertFToU {
+                Ok(Instruction::OpenCLStdFloor(OpOpenCLStdFloor {
                     id_result_type,
                     id_result,
-                    float_value,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        110u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (float_value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 26u32) => split_fn!({
+            let (a, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (b, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (c, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ConvertFToS(OpConvertFToS {
+                Ok(Instruction::OpenCLStdFma(OpOpenCLStdFma {
                     id_result_type,
                     id_result,
-                    float_value,
+                    set,
+                    a,
+                    b,
+                    c,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        111u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (signed_value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 27u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ConvertSToF(OpConvertSToF {
+                Ok(Instruction::OpenCLStdFmax(OpOpenCLStdFmax {
                     id_result_type,
                     id_result,
-                    signed_value,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        112u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (unsigned_value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 28u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ConvertUToF(OpConvertUToF {
+                Ok(Instruction::OpenCLStdFmin(OpOpenCLStdFmin {
                     id_result_type,
                     id_result,
-                    unsigned_value,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        113u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (unsigned_value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 29u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::UConvert(OpUConvert {
+                Ok(Instruction::OpenCLStdFmod(OpOpenCLStdFmod {
                     id_result_type,
                     id_result,
-                    unsigned_value,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        114u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (signed_value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 30u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (ptr, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SConvert(OpSConvert {
+                Ok(Instruction::OpenCLStdFract(OpOpenCLStdFract {
                     id_result_type,
                     id_result,
-                    signed_value,
+                    set,
+                    x,
+                    ptr,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        115u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (float_value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 31u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (exp, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FConvert(OpFConvert {
+                Ok(Instruction::OpenCLStdFrexp(OpOpenCLStdFrexp {
                     id_result_type,
                     id_result,
-                    float_value,
+                    set,
+                    x,
+                    exp,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        116u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 32u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::QuantizeToF16(OpQuantizeToF16 {
+                Ok(Instruction::OpenCLStdHypot(OpOpenCLStdHypot {
                     id_result_type,
                     id_result,
-                    value,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        117u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 33u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ConvertPtrToU(OpConvertPtrToU {
+                Ok(Instruction::OpenCLStdIlogb(OpOpenCLStdIlogb {
                     id_result_type,
                     id_result,
-                    pointer,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        118u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (signed_value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 34u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (k, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SatConvertSToU(OpSatConvertSToU {
+                Ok(Instruction::OpenCLStdLdexp(OpOpenCLStdLdexp {
                     id_result_type,
                     id_result,
-                    signed_value,
+                    set,
+                    x,
+                    k,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        119u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (unsigned_value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 35u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SatConvertUToS(OpSatConvertUToS {
+                Ok(Instruction::OpenCLStdLgamma(OpOpenCLStdLgamma {
                     id_result_type,
                     id_result,
-                    unsigned_value,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        120u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (integer_value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 36u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (signp, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ConvertUToPtr(OpConvertUToPtr {
+                Ok(Instruction::OpenCLStdLgammaR(OpOpenCLStdLgammaR {
                     id_result_type,
                     id_result,
-                    integer_value,
+                    set,
+                    x,
+                    signp,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        121u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 37u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::PtrCastToGeneric(OpPtrCastToGeneric {
+                Ok(Instruction::OpenCLStdLog(OpOpenCLStdLog {
                     id_result_type,
                     id_result,
-                    pointer,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        122u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 38u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GenericCastToPtr(OpGenericCastToPtr {
+                Ok(Instruction::OpenCLStdLog2(OpOpenCLStdLog2 {
                     id_result_type,
                     id_result,
-                    pointer,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        123u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (storage, words) = StorageClass::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 39u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GenericCastToPtrExplicit(
-                    OpGenericCastToPtrExplicit {
-                        id_result_type,
-                        id_result,
-                        pointer,
-                        storage,
-                    },
-                ))
+                Ok(Instruction::OpenCLStdLog10(OpOpenCLStdLog10 {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        124u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 40u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::Bitcast(OpBitcast {
+                Ok(Instruction::OpenCLStdLog1p(OpOpenCLStdLog1p {
                     id_result_type,
                     id_result,
-                    operand,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        126u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 41u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SNegate(OpSNegate {
+                Ok(Instruction::OpenCLStdLogb(OpOpenCLStdLogb {
                     id_result_type,
                     id_result,
-                    operand,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        127u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 42u32) => split_fn!({
+            let (a, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (b, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (c, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FNegate(OpFNegate {
+                Ok(Instruction::OpenCLStdMad(OpOpenCLStdMad {
                     id_result_type,
                     id_result,
-                    operand,
+                    set,
+                    a,
+                    b,
+                    c,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        128u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 43u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::IAdd(OpIAdd {
+                Ok(Instruction::OpenCLStdMaxmag(OpOpenCLStdMaxmag {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        129u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 44u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FAdd(OpFAdd {
+                Ok(Instruction::OpenCLStdMinmag(OpOpenCLStdMinmag {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        130u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 45u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (iptr, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ISub(OpISub {
+                Ok(Instruction::OpenCLStdModf(OpOpenCLStdModf {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    iptr,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        131u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 46u32) => split_fn!({
+            let (nancode, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FSub(OpFSub {
+                Ok(Instruction::OpenCLStdNan(OpOpenCLStdNan {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    nancode,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        132u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 47u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::IMul(OpIMul {
+                Ok(Instruction::OpenCLStdNextafter(OpOpenCLStdNextafter {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        133u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 48u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FMul(OpFMul {
+                Ok(Instruction::OpenCLStdPow(OpOpenCLStdPow {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        134u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 49u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::UDiv(OpUDiv {
+                Ok(Instruction::OpenCLStdPown(OpOpenCLStdPown {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        135u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 50u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SDiv(OpSDiv {
+                Ok(Instruction::OpenCLStdPowr(OpOpenCLStdPowr {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        136u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 51u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FDiv(OpFDiv {
+                Ok(Instruction::OpenCLStdRemainder(OpOpenCLStdRemainder {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        137u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 52u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (quo, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::UMod(OpUMod {
+                Ok(Instruction::OpenCLStdRemquo(OpOpenCLStdRemquo {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
+                    quo,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        138u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 53u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SRem(OpSRem {
+                Ok(Instruction::OpenCLStdRint(OpOpenCLStdRint {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        139u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 54u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SMod(OpSMod {
+                Ok(Instruction::OpenCLStdRootn(OpOpenCLStdRootn {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        140u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 55u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FRem(OpFRem {
+                Ok(Instruction::OpenCLStdRound(OpOpenCLStdRound {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        141u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 56u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FMod(OpFMod {
+                Ok(Instruction::OpenCLStdRsqrt(OpOpenCLStdRsqrt {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        142u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (vector, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (scalar, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 57u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::VectorTimesScalar(OpVectorTimesScalar {
+                Ok(Instruction::OpenCLStdSin(OpOpenCLStdSin {
                     id_result_type,
                     id_result,
-                    vector,
-                    scalar,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        143u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (matrix, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (scalar, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 58u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (cosval, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::MatrixTimesScalar(OpMatrixTimesScalar {
+                Ok(Instruction::OpenCLStdSincos(OpOpenCLStdSincos {
                     id_result_type,
                     id_result,
-                    matrix,
-                    scalar,
+                    set,
+                    x,
+                    cosval,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        144u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (vector, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (matrix, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 59u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::VectorTimesMatrix(OpVectorTimesMatrix {
+                Ok(Instruction::OpenCLStdSinh(OpOpenCLStdSinh {
                     id_result_type,
                     id_result,
-                    vector,
-                    matrix,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        145u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (matrix, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (vector, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 60u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::MatrixTimesVector(OpMatrixTimesVector {
+                Ok(Instruction::OpenCLStdSinpi(OpOpenCLStdSinpi {
                     id_result_type,
                     id_result,
-                    matrix,
-                    vector,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        146u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (left_matrix, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (right_matrix, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 61u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::MatrixTimesMatrix(OpMatrixTimesMatrix {
+                Ok(Instruction::OpenCLStdSqrt(OpOpenCLStdSqrt {
                     id_result_type,
                     id_result,
-                    left_matrix,
-                    right_matrix,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        147u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (vector_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (vector_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 62u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::OuterProduct(OpOuterProduct {
+                Ok(Instruction::OpenCLStdTan(OpOpenCLStdTan {
                     id_result_type,
                     id_result,
-                    vector_1,
-                    vector_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        148u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (vector_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (vector_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 63u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::Dot(OpDot {
+                Ok(Instruction::OpenCLStdTanh(OpOpenCLStdTanh {
                     id_result_type,
                     id_result,
-                    vector_1,
-                    vector_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        149u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 64u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::IAddCarry(OpIAddCarry {
+                Ok(Instruction::OpenCLStdTanpi(OpOpenCLStdTanpi {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        150u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 65u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ISubBorrow(OpISubBorrow {
+                Ok(Instruction::OpenCLStdTgamma(OpOpenCLStdTgamma {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        151u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 66u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::UMulExtended(OpUMulExtended {
+                Ok(Instruction::OpenCLStdTrunc(OpOpenCLStdTrunc {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        152u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 67u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SMulExtended(OpSMulExtended {
+                Ok(Instruction::OpenCLStdHalfCos(OpOpenCLStdHalfCos {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        154u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (vector, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 68u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::Any(OpAny {
+                Ok(Instruction::OpenCLStdHalfDivide(OpOpenCLStdHalfDivide {
                     id_result_type,
                     id_result,
-                    vector,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        155u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (vector, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 69u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::All(OpAll {
+                Ok(Instruction::OpenCLStdHalfExp(OpOpenCLStdHalfExp {
                     id_result_type,
                     id_result,
-                    vector,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        156u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 70u32) => split_fn!({
             let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::IsNan(OpIsNan {
+                Ok(Instruction::OpenCLStdHalfExp2(OpOpenCLStdHalfExp2 {
                     id_result_type,
                     id_result,
+                    set,
                     x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        157u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 71u32) => split_fn!({
             let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::IsInf(OpIsInf {
+                Ok(Instruction::OpenCLStdHalfExp10(OpOpenCLStdHalfExp10 {
                     id_result_type,
                     id_result,
+                    set,
                     x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        158u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 72u32) => split_fn!({
             let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::IsFinite(OpIsFinite {
+                Ok(Instruction::OpenCLStdHalfLog(OpOpenCLStdHalfLog {
                     id_result_type,
                     id_result,
+                    set,
                     x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        159u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 73u32) => split_fn!({
             let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::IsNormal(OpIsNormal {
+                Ok(Instruction::OpenCLStdHalfLog2(OpOpenCLStdHalfLog2 {
                     id_result_type,
                     id_result,
+                    set,
                     x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        160u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 74u32) => split_fn!({
             let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::SignBitSet(OpSignBitSet {
+                Ok(Instruction::OpenCLStdHalfLog10(OpOpenCLStdHalfLog10 {
                     id_result_type,
                     id_result,
+                    set,
                     x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        161u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 75u32) => split_fn!({
             let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::LessOrGreater(OpLessOrGreater {
+                Ok(Instruction::OpenCLStdHalfPowr(OpOpenCLStdHalfPowr {
                     id_result_type,
                     id_result,
+                    set,
                     x,
                     y,
                 }))
@@ -22126,3418 +26012,3028 @@ fn parse_instruction(
                 Err(Error::InstructionTooLong)
             }
         }),
-        162u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 76u32) => split_fn!({
             let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::Ordered(OpOrdered {
+                Ok(Instruction::OpenCLStdHalfRecip(OpOpenCLStdHalfRecip {
                     id_result_type,
                     id_result,
+                    set,
                     x,
-                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        163u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 77u32) => split_fn!({
             let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::Unordered(OpUnordered {
+                Ok(Instruction::OpenCLStdHalfRsqrt(OpOpenCLStdHalfRsqrt {
                     id_result_type,
                     id_result,
+                    set,
                     x,
-                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        164u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 78u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::LogicalEqual(OpLogicalEqual {
+                Ok(Instruction::OpenCLStdHalfSin(OpOpenCLStdHalfSin {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        165u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 79u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::LogicalNotEqual(OpLogicalNotEqual {
+                Ok(Instruction::OpenCLStdHalfSqrt(OpOpenCLStdHalfSqrt {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        166u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 80u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::LogicalOr(OpLogicalOr {
+                Ok(Instruction::OpenCLStdHalfTan(OpOpenCLStdHalfTan {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        167u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 81u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::LogicalAnd(OpLogicalAnd {
+                Ok(Instruction::OpenCLStdNativeCos(OpOpenCLStdNativeCos {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        168u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 82u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::LogicalNot(OpLogicalNot {
-                    id_result_type,
-                    id_result,
-                    operand,
-                }))
+                Ok(Instruction::OpenCLStdNativeDivide(
+                    OpOpenCLStdNativeDivide {
+                        id_result_type,
+                        id_result,
+                        set,
+                        x,
+                        y,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        169u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (condition, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (object_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (object_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 83u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::Select(OpSelect {
+                Ok(Instruction::OpenCLStdNativeExp(OpOpenCLStdNativeExp {
                     id_result_type,
                     id_result,
-                    condition,
-                    object_1,
-                    object_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        170u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 84u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::IEqual(OpIEqual {
+                Ok(Instruction::OpenCLStdNativeExp2(OpOpenCLStdNativeExp2 {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        171u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 85u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::INotEqual(OpINotEqual {
+                Ok(Instruction::OpenCLStdNativeExp10(OpOpenCLStdNativeExp10 {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        172u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 86u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::UGreaterThan(OpUGreaterThan {
+                Ok(Instruction::OpenCLStdNativeLog(OpOpenCLStdNativeLog {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        173u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 87u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SGreaterThan(OpSGreaterThan {
+                Ok(Instruction::OpenCLStdNativeLog2(OpOpenCLStdNativeLog2 {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        174u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 88u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::UGreaterThanEqual(OpUGreaterThanEqual {
+                Ok(Instruction::OpenCLStdNativeLog10(OpOpenCLStdNativeLog10 {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        175u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 89u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SGreaterThanEqual(OpSGreaterThanEqual {
+                Ok(Instruction::OpenCLStdNativePowr(OpOpenCLStdNativePowr {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        176u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 90u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ULessThan(OpULessThan {
+                Ok(Instruction::OpenCLStdNativeRecip(OpOpenCLStdNativeRecip {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        177u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 91u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SLessThan(OpSLessThan {
+                Ok(Instruction::OpenCLStdNativeRsqrt(OpOpenCLStdNativeRsqrt {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        178u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 92u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ULessThanEqual(OpULessThanEqual {
+                Ok(Instruction::OpenCLStdNativeSin(OpOpenCLStdNativeSin {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        179u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 93u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SLessThanEqual(OpSLessThanEqual {
+                Ok(Instruction::OpenCLStdNativeSqrt(OpOpenCLStdNativeSqrt {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        180u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 94u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FOrdEqual(OpFOrdEqual {
+                Ok(Instruction::OpenCLStdNativeTan(OpOpenCLStdNativeTan {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        181u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 141u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FUnordEqual(OpFUnordEqual {
+                Ok(Instruction::OpenCLStdSAbs(OpOpenCLStdSAbs {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        182u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 142u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FOrdNotEqual(OpFOrdNotEqual {
+                Ok(Instruction::OpenCLStdSAbsDiff(OpOpenCLStdSAbsDiff {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        183u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 143u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FUnordNotEqual(OpFUnordNotEqual {
+                Ok(Instruction::OpenCLStdSAddSat(OpOpenCLStdSAddSat {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        184u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 144u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FOrdLessThan(OpFOrdLessThan {
+                Ok(Instruction::OpenCLStdUAddSat(OpOpenCLStdUAddSat {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        185u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 145u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FUnordLessThan(OpFUnordLessThan {
+                Ok(Instruction::OpenCLStdSHadd(OpOpenCLStdSHadd {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        186u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 146u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FOrdGreaterThan(OpFOrdGreaterThan {
+                Ok(Instruction::OpenCLStdUHadd(OpOpenCLStdUHadd {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        187u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 147u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FUnordGreaterThan(OpFUnordGreaterThan {
+                Ok(Instruction::OpenCLStdSRhadd(OpOpenCLStdSRhadd {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        188u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 148u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FOrdLessThanEqual(OpFOrdLessThanEqual {
+                Ok(Instruction::OpenCLStdURhadd(OpOpenCLStdURhadd {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        189u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 149u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (minval, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (maxval, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FUnordLessThanEqual(OpFUnordLessThanEqual {
+                Ok(Instruction::OpenCLStdSClamp(OpOpenCLStdSClamp {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    minval,
+                    maxval,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        190u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 150u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (minval, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (maxval, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FOrdGreaterThanEqual(OpFOrdGreaterThanEqual {
+                Ok(Instruction::OpenCLStdUClamp(OpOpenCLStdUClamp {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    minval,
+                    maxval,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        191u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 151u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FUnordGreaterThanEqual(
-                    OpFUnordGreaterThanEqual {
-                        id_result_type,
-                        id_result,
-                        operand_1,
-                        operand_2,
-                    },
-                ))
+                Ok(Instruction::OpenCLStdClz(OpOpenCLStdClz {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        194u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (shift, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 152u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ShiftRightLogical(OpShiftRightLogical {
+                Ok(Instruction::OpenCLStdCtz(OpOpenCLStdCtz {
                     id_result_type,
                     id_result,
-                    base,
-                    shift,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        195u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (shift, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 153u32) => split_fn!({
+            let (a, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (b, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (c, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ShiftRightArithmetic(OpShiftRightArithmetic {
+                Ok(Instruction::OpenCLStdSMadHi(OpOpenCLStdSMadHi {
                     id_result_type,
                     id_result,
-                    base,
-                    shift,
+                    set,
+                    a,
+                    b,
+                    c,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        196u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (shift, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 154u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (z, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ShiftLeftLogical(OpShiftLeftLogical {
+                Ok(Instruction::OpenCLStdUMadSat(OpOpenCLStdUMadSat {
                     id_result_type,
                     id_result,
-                    base,
-                    shift,
+                    set,
+                    x,
+                    y,
+                    z,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        197u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 155u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (z, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::BitwiseOr(OpBitwiseOr {
+                Ok(Instruction::OpenCLStdSMadSat(OpOpenCLStdSMadSat {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
+                    z,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        198u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 156u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::BitwiseXor(OpBitwiseXor {
+                Ok(Instruction::OpenCLStdSMax(OpOpenCLStdSMax {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        199u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 157u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::BitwiseAnd(OpBitwiseAnd {
+                Ok(Instruction::OpenCLStdUMax(OpOpenCLStdUMax {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        200u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 158u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::Not(OpNot {
+                Ok(Instruction::OpenCLStdSMin(OpOpenCLStdSMin {
                     id_result_type,
                     id_result,
-                    operand,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        201u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (insert, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (count, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 159u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::BitFieldInsert(OpBitFieldInsert {
+                Ok(Instruction::OpenCLStdUMin(OpOpenCLStdUMin {
                     id_result_type,
                     id_result,
-                    base,
-                    insert,
-                    offset,
-                    count,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        202u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (count, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 160u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::BitFieldSExtract(OpBitFieldSExtract {
+                Ok(Instruction::OpenCLStdSMulHi(OpOpenCLStdSMulHi {
                     id_result_type,
                     id_result,
-                    base,
-                    offset,
-                    count,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        203u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (count, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 161u32) => split_fn!({
+            let (v, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (i, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::BitFieldUExtract(OpBitFieldUExtract {
+                Ok(Instruction::OpenCLStdRotate(OpOpenCLStdRotate {
                     id_result_type,
                     id_result,
-                    base,
-                    offset,
-                    count,
+                    set,
+                    v,
+                    i,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        204u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 162u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::BitReverse(OpBitReverse {
+                Ok(Instruction::OpenCLStdSSubSat(OpOpenCLStdSSubSat {
                     id_result_type,
                     id_result,
-                    base,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        205u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 163u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::BitCount(OpBitCount {
+                Ok(Instruction::OpenCLStdUSubSat(OpOpenCLStdUSubSat {
                     id_result_type,
                     id_result,
-                    base,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        207u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 164u32) => split_fn!({
+            let (hi, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (lo, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::DPdx(OpDPdx {
+                Ok(Instruction::OpenCLStdUUpsample(OpOpenCLStdUUpsample {
                     id_result_type,
                     id_result,
-                    p,
+                    set,
+                    hi,
+                    lo,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        208u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 165u32) => split_fn!({
+            let (hi, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (lo, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::DPdy(OpDPdy {
+                Ok(Instruction::OpenCLStdSUpsample(OpOpenCLStdSUpsample {
                     id_result_type,
                     id_result,
-                    p,
+                    set,
+                    hi,
+                    lo,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        209u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 166u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::Fwidth(OpFwidth {
+                Ok(Instruction::OpenCLStdPopcount(OpOpenCLStdPopcount {
                     id_result_type,
                     id_result,
-                    p,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        210u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 167u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (z, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::DPdxFine(OpDPdxFine {
+                Ok(Instruction::OpenCLStdSMad24(OpOpenCLStdSMad24 {
                     id_result_type,
                     id_result,
-                    p,
+                    set,
+                    x,
+                    y,
+                    z,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        211u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 168u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (z, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::DPdyFine(OpDPdyFine {
+                Ok(Instruction::OpenCLStdUMad24(OpOpenCLStdUMad24 {
                     id_result_type,
                     id_result,
-                    p,
+                    set,
+                    x,
+                    y,
+                    z,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        212u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 169u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FwidthFine(OpFwidthFine {
+                Ok(Instruction::OpenCLStdSMul24(OpOpenCLStdSMul24 {
                     id_result_type,
                     id_result,
-                    p,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        213u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 170u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::DPdxCoarse(OpDPdxCoarse {
+                Ok(Instruction::OpenCLStdUMul24(OpOpenCLStdUMul24 {
                     id_result_type,
                     id_result,
-                    p,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        214u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 201u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::DPdyCoarse(OpDPdyCoarse {
+                Ok(Instruction::OpenCLStdUAbs(OpOpenCLStdUAbs {
                     id_result_type,
                     id_result,
-                    p,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        215u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 202u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::FwidthCoarse(OpFwidthCoarse {
+                Ok(Instruction::OpenCLStdUAbsDiff(OpOpenCLStdUAbsDiff {
                     id_result_type,
                     id_result,
-                    p,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        218u16 => split_fn!({
+        (ExtensionInstructionSet::OpenCLStd, 203u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::EmitVertex(OpEmitVertex {}))
+                Ok(Instruction::OpenCLStdUMulHi(OpOpenCLStdUMulHi {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    y,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        219u16 => split_fn!({
+        (ExtensionInstructionSet::OpenCLStd, 204u32) => split_fn!({
+            let (a, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (b, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (c, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::EndPrimitive(OpEndPrimitive {}))
+                Ok(Instruction::OpenCLStdUMadHi(OpOpenCLStdUMadHi {
+                    id_result_type,
+                    id_result,
+                    set,
+                    a,
+                    b,
+                    c,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        220u16 => split_fn!({
-            let (stream, words) = IdRef::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 95u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (minval, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (maxval, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::EmitStreamVertex(OpEmitStreamVertex { stream }))
+                Ok(Instruction::OpenCLStdFclamp(OpOpenCLStdFclamp {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    minval,
+                    maxval,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        221u16 => split_fn!({
-            let (stream, words) = IdRef::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 96u32) => split_fn!({
+            let (radians, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::EndStreamPrimitive(OpEndStreamPrimitive {
-                    stream,
+                Ok(Instruction::OpenCLStdDegrees(OpOpenCLStdDegrees {
+                    id_result_type,
+                    id_result,
+                    set,
+                    radians,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        224u16 => split_fn!({
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 97u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ControlBarrier(OpControlBarrier {
-                    execution,
-                    memory,
-                    semantics,
+                Ok(Instruction::OpenCLStdFmaxCommon(OpOpenCLStdFmaxCommon {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        225u16 => split_fn!({
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 98u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::MemoryBarrier(OpMemoryBarrier {
-                    memory,
-                    semantics,
+                Ok(Instruction::OpenCLStdFminCommon(OpOpenCLStdFminCommon {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        227u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 99u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (a, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicLoad(OpAtomicLoad {
+                Ok(Instruction::OpenCLStdMix(OpOpenCLStdMix {
                     id_result_type,
                     id_result,
-                    pointer,
-                    memory,
-                    semantics,
+                    set,
+                    x,
+                    y,
+                    a,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        228u16 => split_fn!({
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 100u32) => split_fn!({
+            let (degrees, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicStore(OpAtomicStore {
-                    pointer,
-                    memory,
-                    semantics,
-                    value,
+                Ok(Instruction::OpenCLStdRadians(OpOpenCLStdRadians {
+                    id_result_type,
+                    id_result,
+                    set,
+                    degrees,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        229u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 101u32) => split_fn!({
+            let (edge, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicExchange(OpAtomicExchange {
+                Ok(Instruction::OpenCLStdStep(OpOpenCLStdStep {
                     id_result_type,
                     id_result,
-                    pointer,
-                    memory,
-                    semantics,
-                    value,
+                    set,
+                    edge,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        230u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (equal, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (unequal, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (comparator, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 102u32) => split_fn!({
+            let (edge0, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (edge1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicCompareExchange(
-                    OpAtomicCompareExchange {
-                        id_result_type,
-                        id_result,
-                        pointer,
-                        memory,
-                        equal,
-                        unequal,
-                        value,
-                        comparator,
-                    },
-                ))
+                Ok(Instruction::OpenCLStdSmoothstep(OpOpenCLStdSmoothstep {
+                    id_result_type,
+                    id_result,
+                    set,
+                    edge0,
+                    edge1,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        231u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (equal, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (unequal, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (comparator, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 103u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicCompareExchangeWeak(
-                    OpAtomicCompareExchangeWeak {
-                        id_result_type,
-                        id_result,
-                        pointer,
-                        memory,
-                        equal,
-                        unequal,
-                        value,
-                        comparator,
-                    },
-                ))
+                Ok(Instruction::OpenCLStdSign(OpOpenCLStdSign {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        232u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 104u32) => split_fn!({
+            let (p0, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p1, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicIIncrement(OpAtomicIIncrement {
+                Ok(Instruction::OpenCLStdCross(OpOpenCLStdCross {
                     id_result_type,
                     id_result,
-                    pointer,
-                    memory,
-                    semantics,
+                    set,
+                    p0,
+                    p1,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        233u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 105u32) => split_fn!({
+            let (p0, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p1, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicIDecrement(OpAtomicIDecrement {
+                Ok(Instruction::OpenCLStdDistance(OpOpenCLStdDistance {
                     id_result_type,
                     id_result,
-                    pointer,
-                    memory,
-                    semantics,
+                    set,
+                    p0,
+                    p1,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        234u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 106u32) => split_fn!({
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicIAdd(OpAtomicIAdd {
+                Ok(Instruction::OpenCLStdLength(OpOpenCLStdLength {
                     id_result_type,
                     id_result,
-                    pointer,
-                    memory,
-                    semantics,
-                    value,
+                    set,
+                    p,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        235u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 107u32) => split_fn!({
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicISub(OpAtomicISub {
+                Ok(Instruction::OpenCLStdNormalize(OpOpenCLStdNormalize {
                     id_result_type,
                     id_result,
-                    pointer,
-                    memory,
-                    semantics,
-                    value,
+                    set,
+                    p,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        236u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 108u32) => split_fn!({
+            let (p0, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p1, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicSMin(OpAtomicSMin {
+                Ok(Instruction::OpenCLStdFastDistance(
+                    OpOpenCLStdFastDistance {
+                        id_result_type,
+                        id_result,
+                        set,
+                        p0,
+                        p1,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        (ExtensionInstructionSet::OpenCLStd, 109u32) => split_fn!({
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::OpenCLStdFastLength(OpOpenCLStdFastLength {
                     id_result_type,
                     id_result,
-                    pointer,
-                    memory,
-                    semantics,
-                    value,
+                    set,
+                    p,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        237u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 110u32) => split_fn!({
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::OpenCLStdFastNormalize(
+                    OpOpenCLStdFastNormalize {
+                        id_result_type,
+                        id_result,
+                        set,
+                        p,
+                    },
+                ))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        (ExtensionInstructionSet::OpenCLStd, 186u32) => split_fn!({
+            let (a, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (b, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (c, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicUMin(OpAtomicUMin {
+                Ok(Instruction::OpenCLStdBitselect(OpOpenCLStdBitselect {
                     id_result_type,
                     id_result,
-                    pointer,
-                    memory,
-                    semantics,
-                    value,
+                    set,
+                    a,
+                    b,
+                    c,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        238u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 187u32) => split_fn!({
+            let (a, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (b, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (c, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicSMax(OpAtomicSMax {
+                Ok(Instruction::OpenCLStdSelect(OpOpenCLStdSelect {
                     id_result_type,
                     id_result,
-                    pointer,
-                    memory,
-                    semantics,
-                    value,
+                    set,
+                    a,
+                    b,
+                    c,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        239u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 171u32) => split_fn!({
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (n, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicUMax(OpAtomicUMax {
+                Ok(Instruction::OpenCLStdVloadn(OpOpenCLStdVloadn {
                     id_result_type,
                     id_result,
-                    pointer,
-                    memory,
-                    semantics,
-                    value,
+                    set,
+                    offset,
+                    p,
+                    n,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        240u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 172u32) => split_fn!({
+            let (data, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicAnd(OpAtomicAnd {
+                Ok(Instruction::OpenCLStdVstoren(OpOpenCLStdVstoren {
                     id_result_type,
                     id_result,
-                    pointer,
-                    memory,
-                    semantics,
-                    value,
+                    set,
+                    data,
+                    offset,
+                    p,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        241u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 173u32) => split_fn!({
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicOr(OpAtomicOr {
+                Ok(Instruction::OpenCLStdVloadHalf(OpOpenCLStdVloadHalf {
                     id_result_type,
                     id_result,
-                    pointer,
-                    memory,
-                    semantics,
-                    value,
+                    set,
+                    offset,
+                    p,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        242u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 174u32) => split_fn!({
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (n, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicXor(OpAtomicXor {
+                Ok(Instruction::OpenCLStdVloadHalfn(OpOpenCLStdVloadHalfn {
                     id_result_type,
                     id_result,
-                    pointer,
-                    memory,
-                    semantics,
-                    value,
+                    set,
+                    offset,
+                    p,
+                    n,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        245u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (variable_parent, words) = Vec::<PairIdRefIdRef>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::OpenCLStd, 175u32) => split_fn!({
+            let (data, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::Phi(OpPhi {
+                Ok(Instruction::OpenCLStdVstoreHalf(OpOpenCLStdVstoreHalf {
                     id_result_type,
                     id_result,
-                    variable_parent,
+                    set,
+                    data,
+                    offset,
+                    p,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        246u16 => split_fn!({
-            let (merge_block, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (continue_target, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (loop_control, words) = LoopControl::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 176u32) => split_fn!({
+            let (data, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (mode, words) = FPRoundingMode::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::LoopMerge(OpLoopMerge {
-                    merge_block,
-                    continue_target,
-                    loop_control,
+                Ok(Instruction::OpenCLStdVstoreHalfR(OpOpenCLStdVstoreHalfR {
+                    id_result_type,
+                    id_result,
+                    set,
+                    data,
+                    offset,
+                    p,
+                    mode,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        247u16 => split_fn!({
-            let (merge_block, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (selection_control, words) = SelectionControl::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 177u32) => split_fn!({
+            let (data, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SelectionMerge(OpSelectionMerge {
-                    merge_block,
-                    selection_control,
+                Ok(Instruction::OpenCLStdVstoreHalfn(OpOpenCLStdVstoreHalfn {
+                    id_result_type,
+                    id_result,
+                    set,
+                    data,
+                    offset,
+                    p,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        248u16 => split_fn!({
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 178u32) => split_fn!({
+            let (data, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (mode, words) = FPRoundingMode::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::Label(OpLabel { id_result }))
+                Ok(Instruction::OpenCLStdVstoreHalfnR(
+                    OpOpenCLStdVstoreHalfnR {
+                        id_result_type,
+                        id_result,
+                        set,
+                        data,
+                        offset,
+                        p,
+                        mode,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        249u16 => split_fn!({
-            let (target_label, words) = IdRef::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 179u32) => split_fn!({
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (n, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::Branch(OpBranch { target_label }))
+                Ok(Instruction::OpenCLStdVloadaHalfn(OpOpenCLStdVloadaHalfn {
+                    id_result_type,
+                    id_result,
+                    set,
+                    offset,
+                    p,
+                    n,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        250u16 => split_fn!({
-            let (condition, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (true_label, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (false_label, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (branch_weights, words) = Vec::<LiteralInteger32>::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 180u32) => split_fn!({
+            let (data, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::BranchConditional(OpBranchConditional {
-                    condition,
-                    true_label,
-                    false_label,
-                    branch_weights,
-                }))
+                Ok(Instruction::OpenCLStdVstoreaHalfn(
+                    OpOpenCLStdVstoreaHalfn {
+                        id_result_type,
+                        id_result,
+                        set,
+                        data,
+                        offset,
+                        p,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        251u16 => split_fn!({
-            let (selector, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (default, words) = IdRef::spirv_parse(words, parse_state)?;
-            match &parse_state.id_states[selector.0 as usize] {
-                IdState::Value(IdStateValue(BitWidth::Width32OrLess)) => {
-                    let (target, words) =
-                        Vec::<PairLiteralInteger32IdRef>::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::Switch32(OpSwitch32 {
-                            selector,
-                            default,
-                            target,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }
-                IdState::Value(IdStateValue(BitWidth::Width64)) => {
-                    let (target, words) =
-                        Vec::<PairLiteralInteger64IdRef>::spirv_parse(words, parse_state)?;
-                    if words.is_empty() {
-                        Ok(Instruction::Switch64(OpSwitch64 {
-                            selector,
-                            default,
-                            target,
-                        }))
-                    } else {
-                        Err(Error::InstructionTooLong)
-                    }
-                }
-                _ => Err(Error::SwitchSelectorIsInvalid(selector)),
-            }
-        }),
-        252u16 => split_fn!({
+        (ExtensionInstructionSet::OpenCLStd, 181u32) => split_fn!({
+            let (data, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (mode, words) = FPRoundingMode::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::Kill(OpKill {}))
+                Ok(Instruction::OpenCLStdVstoreaHalfnR(
+                    OpOpenCLStdVstoreaHalfnR {
+                        id_result_type,
+                        id_result,
+                        set,
+                        data,
+                        offset,
+                        p,
+                        mode,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        253u16 => split_fn!({
+        (ExtensionInstructionSet::OpenCLStd, 182u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (shuffle_mask, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::Return(OpReturn {}))
+                Ok(Instruction::OpenCLStdShuffle(OpOpenCLStdShuffle {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    shuffle_mask,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        254u16 => split_fn!({
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 183u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (shuffle_mask, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ReturnValue(OpReturnValue { value }))
+                Ok(Instruction::OpenCLStdShuffle2(OpOpenCLStdShuffle2 {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    y,
+                    shuffle_mask,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        255u16 => split_fn!({
+        (ExtensionInstructionSet::OpenCLStd, 184u32) => split_fn!({
+            let (format, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (additional_arguments, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::Unreachable(OpUnreachable {}))
+                Ok(Instruction::OpenCLStdPrintf(OpOpenCLStdPrintf {
+                    id_result_type,
+                    id_result,
+                    set,
+                    format,
+                    additional_arguments,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        256u16 => split_fn!({
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (size, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::OpenCLStd, 185u32) => split_fn!({
+            let (ptr, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (num_elements, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::LifetimeStart(OpLifetimeStart {
-                    pointer,
-                    size,
+                Ok(Instruction::OpenCLStdPrefetch(OpOpenCLStdPrefetch {
+                    id_result_type,
+                    id_result,
+                    set,
+                    ptr,
+                    num_elements,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        257u16 => split_fn!({
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (size, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 1u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::LifetimeStop(OpLifetimeStop { pointer, size }))
+                Ok(Instruction::GLSLStd450Round(OpGLSLStd450Round {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        259u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (destination, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (source, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (num_elements, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (stride, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (event, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 2u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupAsyncCopy(OpGroupAsyncCopy {
+                Ok(Instruction::GLSLStd450RoundEven(OpGLSLStd450RoundEven {
                     id_result_type,
                     id_result,
-                    execution,
-                    destination,
-                    source,
-                    num_elements,
-                    stride,
-                    event,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        260u16 => split_fn!({
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (num_events, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (events_list, words) = IdRef::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 3u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupWaitEvents(OpGroupWaitEvents {
-                    execution,
-                    num_events,
-                    events_list,
+                Ok(Instruction::GLSLStd450Trunc(OpGLSLStd450Trunc {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        261u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (predicate, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 4u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupAll(OpGroupAll {
+                Ok(Instruction::GLSLStd450FAbs(OpGLSLStd450FAbs {
                     id_result_type,
                     id_result,
-                    execution,
-                    predicate,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        262u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (predicate, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 5u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupAny(OpGroupAny {
+                Ok(Instruction::GLSLStd450SAbs(OpGLSLStd450SAbs {
                     id_result_type,
                     id_result,
-                    execution,
-                    predicate,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        263u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (local_id, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 6u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupBroadcast(OpGroupBroadcast {
+                Ok(Instruction::GLSLStd450FSign(OpGLSLStd450FSign {
                     id_result_type,
                     id_result,
-                    execution,
-                    value,
-                    local_id,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        264u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 7u32) => split_fn!({
             let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupIAdd(OpGroupIAdd {
+                Ok(Instruction::GLSLStd450SSign(OpGLSLStd450SSign {
                     id_result_type,
                     id_result,
-                    execution,
-                    operation,
+                    set,
                     x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        265u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 8u32) => split_fn!({
             let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupFAdd(OpGroupFAdd {
+                Ok(Instruction::GLSLStd450Floor(OpGLSLStd450Floor {
                     id_result_type,
                     id_result,
-                    execution,
-                    operation,
+                    set,
                     x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        266u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 9u32) => split_fn!({
             let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupFMin(OpGroupFMin {
+                Ok(Instruction::GLSLStd450Ceil(OpGLSLStd450Ceil {
                     id_result_type,
                     id_result,
-                    execution,
-                    operation,
+                    set,
                     x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        267u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 10u32) => split_fn!({
             let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupUMin(OpGroupUMin {
+                Ok(Instruction::GLSLStd450Fract(OpGLSLStd450Fract {
                     id_result_type,
                     id_result,
-                    execution,
-                    operation,
+                    set,
                     x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        268u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 11u32) => split_fn!({
+            let (degrees, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupSMin(OpGroupSMin {
+                Ok(Instruction::GLSLStd450Radians(OpGLSLStd450Radians {
                     id_result_type,
                     id_result,
-                    execution,
-                    operation,
-                    x,
+                    set,
+                    degrees,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        269u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 12u32) => split_fn!({
+            let (radians, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupFMax(OpGroupFMax {
+                Ok(Instruction::GLSLStd450Degrees(OpGLSLStd450Degrees {
                     id_result_type,
                     id_result,
-                    execution,
-                    operation,
-                    x,
+                    set,
+                    radians,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        270u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 13u32) => split_fn!({
             let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupUMax(OpGroupUMax {
+                Ok(Instruction::GLSLStd450Sin(OpGLSLStd450Sin {
                     id_result_type,
                     id_result,
-                    execution,
-                    operation,
+                    set,
                     x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        271u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 14u32) => split_fn!({
             let (x, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupSMax(OpGroupSMax {
+                Ok(Instruction::GLSLStd450Cos(OpGLSLStd450Cos {
                     id_result_type,
                     id_result,
-                    execution,
-                    operation,
+                    set,
                     x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        274u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 15u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ReadPipe(OpReadPipe {
+                Ok(Instruction::GLSLStd450Tan(OpGLSLStd450Tan {
                     id_result_type,
                     id_result,
-                    pipe,
-                    pointer,
-                    packet_size,
-                    packet_alignment,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        275u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 16u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::WritePipe(OpWritePipe {
+                Ok(Instruction::GLSLStd450Asin(OpGLSLStd450Asin {
                     id_result_type,
                     id_result,
-                    pipe,
-                    pointer,
-                    packet_size,
-                    packet_alignment,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        276u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (reserve_id, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (index, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 17u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ReservedReadPipe(OpReservedReadPipe {
+                Ok(Instruction::GLSLStd450Acos(OpGLSLStd450Acos {
                     id_result_type,
                     id_result,
-                    pipe,
-                    reserve_id,
-                    index,
-                    pointer,
-                    packet_size,
-                    packet_alignment,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        277u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (reserve_id, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (index, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 18u32) => split_fn!({
+            let (y_over_x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ReservedWritePipe(OpReservedWritePipe {
+                Ok(Instruction::GLSLStd450Atan(OpGLSLStd450Atan {
                     id_result_type,
                     id_result,
-                    pipe,
-                    reserve_id,
-                    index,
-                    pointer,
-                    packet_size,
-                    packet_alignment,
+                    set,
+                    y_over_x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        278u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (num_packets, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 19u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ReserveReadPipePackets(
-                    OpReserveReadPipePackets {
-                        id_result_type,
-                        id_result,
-                        pipe,
-                        num_packets,
-                        packet_size,
-                        packet_alignment,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450Sinh(OpGLSLStd450Sinh {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        279u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (num_packets, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 20u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ReserveWritePipePackets(
-                    OpReserveWritePipePackets {
-                        id_result_type,
-                        id_result,
-                        pipe,
-                        num_packets,
-                        packet_size,
-                        packet_alignment,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450Cosh(OpGLSLStd450Cosh {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        280u16 => split_fn!({
-            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (reserve_id, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 21u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::CommitReadPipe(OpCommitReadPipe {
-                    pipe,
-                    reserve_id,
-                    packet_size,
-                    packet_alignment,
+                Ok(Instruction::GLSLStd450Tanh(OpGLSLStd450Tanh {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        281u16 => split_fn!({
-            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (reserve_id, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 22u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::CommitWritePipe(OpCommitWritePipe {
-                    pipe,
-                    reserve_id,
-                    packet_size,
-                    packet_alignment,
+                Ok(Instruction::GLSLStd450Asinh(OpGLSLStd450Asinh {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        282u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (reserve_id, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 23u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::IsValidReserveId(OpIsValidReserveId {
+                Ok(Instruction::GLSLStd450Acosh(OpGLSLStd450Acosh {
                     id_result_type,
                     id_result,
-                    reserve_id,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        283u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 24u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GetNumPipePackets(OpGetNumPipePackets {
+                Ok(Instruction::GLSLStd450Atanh(OpGLSLStd450Atanh {
                     id_result_type,
                     id_result,
-                    pipe,
-                    packet_size,
-                    packet_alignment,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        284u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 25u32) => split_fn!({
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GetMaxPipePackets(OpGetMaxPipePackets {
+                Ok(Instruction::GLSLStd450Atan2(OpGLSLStd450Atan2 {
                     id_result_type,
                     id_result,
-                    pipe,
-                    packet_size,
-                    packet_alignment,
+                    set,
+                    y,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        285u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (num_packets, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 26u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupReserveReadPipePackets(
-                    OpGroupReserveReadPipePackets {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        pipe,
-                        num_packets,
-                        packet_size,
-                        packet_alignment,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450Pow(OpGLSLStd450Pow {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    y,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        286u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (num_packets, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 27u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupReserveWritePipePackets(
-                    OpGroupReserveWritePipePackets {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        pipe,
-                        num_packets,
-                        packet_size,
-                        packet_alignment,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450Exp(OpGLSLStd450Exp {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        287u16 => split_fn!({
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (reserve_id, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 28u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupCommitReadPipe(OpGroupCommitReadPipe {
-                    execution,
-                    pipe,
-                    reserve_id,
-                    packet_size,
-                    packet_alignment,
+                Ok(Instruction::GLSLStd450Log(OpGLSLStd450Log {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        288u16 => split_fn!({
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (pipe, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (reserve_id, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = IdRef::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 29u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupCommitWritePipe(OpGroupCommitWritePipe {
-                    execution,
-                    pipe,
-                    reserve_id,
-                    packet_size,
-                    packet_alignment,
+                Ok(Instruction::GLSLStd450Exp2(OpGLSLStd450Exp2 {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        291u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (queue, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (num_events, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (wait_events, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (ret_event, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 30u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::EnqueueMarker(OpEnqueueMarker {
+                Ok(Instruction::GLSLStd450Log2(OpGLSLStd450Log2 {
                     id_result_type,
                     id_result,
-                    queue,
-                    num_events,
-                    wait_events,
-                    ret_event,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        292u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (queue, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (flags, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (nd_range, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (num_events, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (wait_events, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (ret_event, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (local_size, words) = Vec::<IdRef>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 31u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::EnqueueKernel(OpEnqueueKernel {
+                Ok(Instruction::GLSLStd450Sqrt(OpGLSLStd450Sqrt {
                     id_result_type,
                     id_result,
-                    queue,
-                    flags,
-                    nd_range,
-                    num_events,
-                    wait_events,
-                    ret_event,
-                    invoke,
-                    param,
-                    param_size,
-                    param_align,
-                    local_size,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        293u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (nd_range, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 32u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GetKernelNDrangeSubGroupCount(
-                    OpGetKernelNDrangeSubGroupCount {
+                Ok(Instruction::GLSLStd450InverseSqrt(
+                    OpGLSLStd450InverseSqrt {
                         id_result_type,
                         id_result,
-                        nd_range,
-                        invoke,
-                        param,
-                        param_size,
-                        param_align,
+                        set,
+                        x,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        294u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (nd_range, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 33u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GetKernelNDrangeMaxSubGroupSize(
-                    OpGetKernelNDrangeMaxSubGroupSize {
+                Ok(Instruction::GLSLStd450Determinant(
+                    OpGLSLStd450Determinant {
                         id_result_type,
                         id_result,
-                        nd_range,
-                        invoke,
-                        param,
-                        param_size,
-                        param_align,
+                        set,
+                        x,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        295u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 34u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GetKernelWorkGroupSize(
-                    OpGetKernelWorkGroupSize {
+                Ok(Instruction::GLSLStd450MatrixInverse(
+                    OpGLSLStd450MatrixInverse {
                         id_result_type,
                         id_result,
-                        invoke,
-                        param,
-                        param_size,
-                        param_align,
+                        set,
+                        x,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        296u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 35u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (i, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GetKernelPreferredWorkGroupSizeMultiple(
-                    OpGetKernelPreferredWorkGroupSizeMultiple {
-                        id_result_type,
-                        id_result,
-                        invoke,
-                        param,
-                        param_size,
-                        param_align,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450Modf(OpGLSLStd450Modf {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    i,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        297u16 => split_fn!({
-            let (event, words) = IdRef::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 36u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::RetainEvent(OpRetainEvent { event }))
+                Ok(Instruction::GLSLStd450ModfStruct(OpGLSLStd450ModfStruct {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        298u16 => split_fn!({
-            let (event, words) = IdRef::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 37u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ReleaseEvent(OpReleaseEvent { event }))
+                Ok(Instruction::GLSLStd450FMin(OpGLSLStd450FMin {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    y,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        299u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 38u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::CreateUserEvent(OpCreateUserEvent {
+                Ok(Instruction::GLSLStd450UMin(OpGLSLStd450UMin {
                     id_result_type,
                     id_result,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        300u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (event, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 39u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::IsValidEvent(OpIsValidEvent {
+                Ok(Instruction::GLSLStd450SMin(OpGLSLStd450SMin {
                     id_result_type,
                     id_result,
-                    event,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        301u16 => split_fn!({
-            let (event, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (status, words) = IdRef::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 40u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SetUserEventStatus(OpSetUserEventStatus {
-                    event,
-                    status,
+                Ok(Instruction::GLSLStd450FMax(OpGLSLStd450FMax {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        302u16 => split_fn!({
-            let (event, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (profiling_info, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 41u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::CaptureEventProfilingInfo(
-                    OpCaptureEventProfilingInfo {
-                        event,
-                        profiling_info,
-                        value,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450UMax(OpGLSLStd450UMax {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    y,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        303u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 42u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GetDefaultQueue(OpGetDefaultQueue {
+                Ok(Instruction::GLSLStd450SMax(OpGLSLStd450SMax {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    y,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        (ExtensionInstructionSet::GLSLStd450, 43u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (min_val, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (max_val, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::GLSLStd450FClamp(OpGLSLStd450FClamp {
                     id_result_type,
                     id_result,
+                    set,
+                    x,
+                    min_val,
+                    max_val,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        304u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (global_work_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (local_work_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (global_work_offset, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 44u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (min_val, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (max_val, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::BuildNDRange(OpBuildNDRange {
+                Ok(Instruction::GLSLStd450UClamp(OpGLSLStd450UClamp {
                     id_result_type,
                     id_result,
-                    global_work_size,
-                    local_work_size,
-                    global_work_offset,
+                    set,
+                    x,
+                    min_val,
+                    max_val,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        305u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 45u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (min_val, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (max_val, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSparseSampleImplicitLod(
-                    OpImageSparseSampleImplicitLod {
-                        id_result_type,
-                        id_result,
-                        sampled_image,
-                        coordinate,
-                        image_operands,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450SClamp(OpGLSLStd450SClamp {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    min_val,
+                    max_val,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        306u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = ImageOperands::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 46u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (a, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSparseSampleExplicitLod(
-                    OpImageSparseSampleExplicitLod {
-                        id_result_type,
-                        id_result,
-                        sampled_image,
-                        coordinate,
-                        image_operands,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450FMix(OpGLSLStd450FMix {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    y,
+                    a,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        307u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 47u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (a, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSparseSampleDrefImplicitLod(
-                    OpImageSparseSampleDrefImplicitLod {
-                        id_result_type,
-                        id_result,
-                        sampled_image,
-                        coordinate,
-                        d_ref,
-                        image_operands,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450IMix(OpGLSLStd450IMix {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    y,
+                    a,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        (ExtensionInstructionSet::GLSLStd450, 48u32) => split_fn!({
+            let (edge, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::GLSLStd450Step(OpGLSLStd450Step {
+                    id_result_type,
+                    id_result,
+                    set,
+                    edge,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        (ExtensionInstructionSet::GLSLStd450, 49u32) => split_fn!({
+            let (edge0, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (edge1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::GLSLStd450SmoothStep(OpGLSLStd450SmoothStep {
+                    id_result_type,
+                    id_result,
+                    set,
+                    edge0,
+                    edge1,
+                    x,
+                }))
+            } else {
+                Err(Error::InstructionTooLong)
+            }
+        }),
+        (ExtensionInstructionSet::GLSLStd450, 50u32) => split_fn!({
+            let (a, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (b, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (c, words) = IdRef::spirv_parse(words, parse_state)?;
+            if words.is_empty() {
+                Ok(Instruction::GLSLStd450Fma(OpGLSLStd450Fma {
+                    id_result_type,
+                    id_result,
+                    set,
+                    a,
+                    b,
+                    c,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        308u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = ImageOperands::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 51u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (exp, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSparseSampleDrefExplicitLod(
-                    OpImageSparseSampleDrefExplicitLod {
-                        id_result_type,
-                        id_result,
-                        sampled_image,
-                        coordinate,
-                        d_ref,
-                        image_operands,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450Frexp(OpGLSLStd450Frexp {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    exp,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        313u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 52u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSparseFetch(OpImageSparseFetch {
-                    id_result_type,
-                    id_result,
-                    image,
-                    coordinate,
-                    image_operands,
-                }))
+                Ok(Instruction::GLSLStd450FrexpStruct(
+                    OpGLSLStd450FrexpStruct {
+                        id_result_type,
+                        id_result,
+                        set,
+                        x,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        314u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (component, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 53u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (exp, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSparseGather(OpImageSparseGather {
+                Ok(Instruction::GLSLStd450Ldexp(OpGLSLStd450Ldexp {
                     id_result_type,
                     id_result,
-                    sampled_image,
-                    coordinate,
-                    component,
-                    image_operands,
+                    set,
+                    x,
+                    exp,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        315u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (sampled_image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (d_ref, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 54u32) => split_fn!({
+            let (v, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSparseDrefGather(
-                    OpImageSparseDrefGather {
+                Ok(Instruction::GLSLStd450PackSnorm4x8(
+                    OpGLSLStd450PackSnorm4x8 {
                         id_result_type,
                         id_result,
-                        sampled_image,
-                        coordinate,
-                        d_ref,
-                        image_operands,
+                        set,
+                        v,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        316u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (resident_code, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 55u32) => split_fn!({
+            let (v, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSparseTexelsResident(
-                    OpImageSparseTexelsResident {
+                Ok(Instruction::GLSLStd450PackUnorm4x8(
+                    OpGLSLStd450PackUnorm4x8 {
                         id_result_type,
                         id_result,
-                        resident_code,
+                        set,
+                        v,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        317u16 => split_fn!({
+        (ExtensionInstructionSet::GLSLStd450, 56u32) => split_fn!({
+            let (v, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::NoLine(OpNoLine {}))
+                Ok(Instruction::GLSLStd450PackSnorm2x16(
+                    OpGLSLStd450PackSnorm2x16 {
+                        id_result_type,
+                        id_result,
+                        set,
+                        v,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        318u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 57u32) => split_fn!({
+            let (v, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicFlagTestAndSet(OpAtomicFlagTestAndSet {
-                    id_result_type,
-                    id_result,
-                    pointer,
-                    memory,
-                    semantics,
-                }))
+                Ok(Instruction::GLSLStd450PackUnorm2x16(
+                    OpGLSLStd450PackUnorm2x16 {
+                        id_result_type,
+                        id_result,
+                        set,
+                        v,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        319u16 => split_fn!({
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 58u32) => split_fn!({
+            let (v, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::AtomicFlagClear(OpAtomicFlagClear {
-                    pointer,
-                    memory,
-                    semantics,
-                }))
+                Ok(Instruction::GLSLStd450PackHalf2x16(
+                    OpGLSLStd450PackHalf2x16 {
+                        id_result_type,
+                        id_result,
+                        set,
+                        v,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        320u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (image, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (coordinate, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (image_operands, words) = Option::<ImageOperands>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 59u32) => split_fn!({
+            let (v, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ImageSparseRead(OpImageSparseRead {
-                    id_result_type,
-                    id_result,
-                    image,
-                    coordinate,
-                    image_operands,
-                }))
+                Ok(Instruction::GLSLStd450PackDouble2x32(
+                    OpGLSLStd450PackDouble2x32 {
+                        id_result_type,
+                        id_result,
+                        set,
+                        v,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        321u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pointer, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 60u32) => split_fn!({
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::SizeOf(OpSizeOf {
-                    id_result_type,
-                    id_result,
-                    pointer,
-                }))
+                Ok(Instruction::GLSLStd450UnpackSnorm2x16(
+                    OpGLSLStd450UnpackSnorm2x16 {
+                        id_result_type,
+                        id_result,
+                        set,
+                        p,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        322u16 => split_fn!({
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 61u32) => split_fn!({
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::TypePipeStorage(OpTypePipeStorage {
-                    id_result,
-                }))
+                Ok(Instruction::GLSLStd450UnpackUnorm2x16(
+                    OpGLSLStd450UnpackUnorm2x16 {
+                        id_result_type,
+                        id_result,
+                        set,
+                        p,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        323u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (packet_size, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let (packet_alignment, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let (capacity, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 62u32) => split_fn!({
+            let (v, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ConstantPipeStorage(OpConstantPipeStorage {
-                    id_result_type,
-                    id_result,
-                    packet_size,
-                    packet_alignment,
-                    capacity,
-                }))
+                Ok(Instruction::GLSLStd450UnpackHalf2x16(
+                    OpGLSLStd450UnpackHalf2x16 {
+                        id_result_type,
+                        id_result,
+                        set,
+                        v,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        324u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (pipe_storage, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 63u32) => split_fn!({
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::CreatePipeFromPipeStorage(
-                    OpCreatePipeFromPipeStorage {
+                Ok(Instruction::GLSLStd450UnpackSnorm4x8(
+                    OpGLSLStd450UnpackSnorm4x8 {
                         id_result_type,
                         id_result,
-                        pipe_storage,
+                        set,
+                        p,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        325u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (subgroup_count, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 64u32) => split_fn!({
+            let (p, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GetKernelLocalSizeForSubgroupCount(
-                    OpGetKernelLocalSizeForSubgroupCount {
+                Ok(Instruction::GLSLStd450UnpackUnorm4x8(
+                    OpGLSLStd450UnpackUnorm4x8 {
                         id_result_type,
                         id_result,
-                        subgroup_count,
-                        invoke,
-                        param,
-                        param_size,
-                        param_align,
+                        set,
+                        p,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        326u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 65u32) => split_fn!({
+            let (v, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GetKernelMaxNumSubgroups(
-                    OpGetKernelMaxNumSubgroups {
+                Ok(Instruction::GLSLStd450UnpackDouble2x32(
+                    OpGLSLStd450UnpackDouble2x32 {
                         id_result_type,
                         id_result,
-                        invoke,
-                        param,
-                        param_size,
-                        param_align,
+                        set,
+                        v,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        327u16 => split_fn!({
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 66u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::TypeNamedBarrier(OpTypeNamedBarrier {
+                Ok(Instruction::GLSLStd450Length(OpGLSLStd450Length {
+                    id_result_type,
                     id_result,
+                    set,
+                    x,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        328u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (subgroup_count, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 67u32) => split_fn!({
+            let (p0, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (p1, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::NamedBarrierInitialize(
-                    OpNamedBarrierInitialize {
-                        id_result_type,
-                        id_result,
-                        subgroup_count,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450Distance(OpGLSLStd450Distance {
+                    id_result_type,
+                    id_result,
+                    set,
+                    p0,
+                    p1,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        329u16 => split_fn!({
-            let (named_barrier, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (memory, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (semantics, words) = IdMemorySemantics::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 68u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::MemoryNamedBarrier(OpMemoryNamedBarrier {
-                    named_barrier,
-                    memory,
-                    semantics,
+                Ok(Instruction::GLSLStd450Cross(OpGLSLStd450Cross {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    y,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        330u16 => split_fn!({
-            let (process, words) = LiteralString::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 69u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ModuleProcessed(OpModuleProcessed { process }))
+                Ok(Instruction::GLSLStd450Normalize(OpGLSLStd450Normalize {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        331u16 => split_fn!({
-            let (entry_point, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (mode, words) = ExecutionMode::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 70u32) => split_fn!({
+            let (n, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (i, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (nref, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::ExecutionModeId(OpExecutionModeId {
-                    entry_point,
-                    mode,
-                }))
+                Ok(Instruction::GLSLStd450FaceForward(
+                    OpGLSLStd450FaceForward {
+                        id_result_type,
+                        id_result,
+                        set,
+                        n,
+                        i,
+                        nref,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        332u16 => split_fn!({
-            let (target, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (decoration, words) = Decoration::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 71u32) => split_fn!({
+            let (i, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (n, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::DecorateId(OpDecorateId { target, decoration }))
+                Ok(Instruction::GLSLStd450Reflect(OpGLSLStd450Reflect {
+                    id_result_type,
+                    id_result,
+                    set,
+                    i,
+                    n,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        333u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 72u32) => split_fn!({
+            let (i, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (n, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (eta, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformElect(OpGroupNonUniformElect {
+                Ok(Instruction::GLSLStd450Refract(OpGLSLStd450Refract {
                     id_result_type,
                     id_result,
-                    execution,
+                    set,
+                    i,
+                    n,
+                    eta,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        334u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (predicate, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 73u32) => split_fn!({
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformAll(OpGroupNonUniformAll {
+                Ok(Instruction::GLSLStd450FindILsb(OpGLSLStd450FindILsb {
                     id_result_type,
                     id_result,
-                    execution,
-                    predicate,
+                    set,
+                    value,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        335u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (predicate, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 74u32) => split_fn!({
+            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformAny(OpGroupNonUniformAny {
+                Ok(Instruction::GLSLStd450FindSMsb(OpGLSLStd450FindSMsb {
                     id_result_type,
                     id_result,
-                    execution,
-                    predicate,
+                    set,
+                    value,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        336u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
+        (ExtensionInstructionSet::GLSLStd450, 75u32) => split_fn!({
             let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformAllEqual(
-                    OpGroupNonUniformAllEqual {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        value,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450FindUMsb(OpGLSLStd450FindUMsb {
+                    id_result_type,
+                    id_result,
+                    set,
+                    value,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        337u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (id, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 76u32) => split_fn!({
+            let (interpolant, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformBroadcast(
-                    OpGroupNonUniformBroadcast {
+                Ok(Instruction::GLSLStd450InterpolateAtCentroid(
+                    OpGLSLStd450InterpolateAtCentroid {
                         id_result_type,
                         id_result,
-                        execution,
-                        value,
-                        id,
+                        set,
+                        interpolant,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        338u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 77u32) => split_fn!({
+            let (interpolant, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (sample, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformBroadcastFirst(
-                    OpGroupNonUniformBroadcastFirst {
+                Ok(Instruction::GLSLStd450InterpolateAtSample(
+                    OpGLSLStd450InterpolateAtSample {
                         id_result_type,
                         id_result,
-                        execution,
-                        value,
+                        set,
+                        interpolant,
+                        sample,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        339u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (predicate, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 78u32) => split_fn!({
+            let (interpolant, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (offset, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformBallot(
-                    OpGroupNonUniformBallot {
+                Ok(Instruction::GLSLStd450InterpolateAtOffset(
+                    OpGLSLStd450InterpolateAtOffset {
                         id_result_type,
                         id_result,
-                        execution,
-                        predicate,
+                        set,
+                        interpolant,
+                        offset,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        340u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 79u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformInverseBallot(
-                    OpGroupNonUniformInverseBallot {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        value,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450NMin(OpGLSLStd450NMin {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    y,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        341u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (index, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 80u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (y, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformBallotBitExtract(
-                    OpGroupNonUniformBallotBitExtract {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        value,
-                        index,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450NMax(OpGLSLStd450NMax {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    y,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        342u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (ExtensionInstructionSet::GLSLStd450, 81u32) => split_fn!({
+            let (x, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (min_val, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (max_val, words) = IdRef::spirv_parse(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformBallotBitCount(
-                    OpGroupNonUniformBallotBitCount {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        operation,
-                        value,
-                    },
-                ))
+                Ok(Instruction::GLSLStd450NClamp(OpGLSLStd450NClamp {
+                    id_result_type,
+                    id_result,
+                    set,
+                    x,
+                    min_val,
+                    max_val,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        343u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        (extension_instruction_set, instruction) => Err(Error::UnknownExtensionOpcode(
+            extension_instruction_set,
+            instruction,
+        )),
+    }
+}
+#[doc = r" only the instructions with borrowed operands are parsed here, the rest are"]
+#[doc = r" the same as in `parse_instruction`"]
+fn parse_instruction_ref<'a>(
+    opcode: u16,
+    words: &'a [u32],
+    parse_state: &mut ParseState,
+) -> Result<InstructionRef<'a>> {
+    match opcode {
+        2u16 => split_fn!({
+            let (continued_source, words) = <Cow<'a, str>>::spirv_parse_ref(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformBallotFindLSB(
-                    OpGroupNonUniformBallotFindLSB {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        value,
-                    },
-                ))
+                Ok(InstructionRef::SourceContinued(OpSourceContinuedRef {
+                    continued_source,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        344u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        3u16 => split_fn!({
+            let (source_language, words) = SourceLanguage::spirv_parse(words, parse_state)?;
+            let (version, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (file, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            let (source, words) = <Option<Cow<'a, str>>>::spirv_parse_ref(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformBallotFindMSB(
-                    OpGroupNonUniformBallotFindMSB {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        value,
-                    },
-                ))
+                Ok(InstructionRef::Source(OpSourceRef {
+                    source_language,
+                    version,
+                    file,
+                    source,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        345u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (id, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        4u16 => split_fn!({
+            let (extension, words) = <Cow<'a, str>>::spirv_parse_ref(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformShuffle(
-                    OpGroupNonUniformShuffle {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        value,
-                        id,
-                    },
-                ))
+                Ok(InstructionRef::SourceExtension(OpSourceExtensionRef {
+                    extension,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        346u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (mask, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        5u16 => split_fn!({
+            let (target, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (name, words) = <Cow<'a, str>>::spirv_parse_ref(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformShuffleXor(
-                    OpGroupNonUniformShuffleXor {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        value,
-                        mask,
-                    },
-                ))
+                Ok(InstructionRef::Name(OpNameRef { target, name }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        347u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (delta, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        6u16 => split_fn!({
+            let (type_, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (member, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
+            let (name, words) = <Cow<'a, str>>::spirv_parse_ref(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformShuffleUp(
-                    OpGroupNonUniformShuffleUp {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        value,
-                        delta,
-                    },
-                ))
+                Ok(InstructionRef::MemberName(OpMemberNameRef {
+                    type_,
+                    member,
+                    name,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        348u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+        7u16 => split_fn!({
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (delta, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+            let (string, words) = <Cow<'a, str>>::spirv_parse_ref(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformShuffleDown(
-                    OpGroupNonUniformShuffleDown {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        value,
-                        delta,
-                    },
-                ))
+                Ok(InstructionRef::String(OpStringRef { id_result, string }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        349u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        10u16 => split_fn!({
+            let (name, words) = <Cow<'a, str>>::spirv_parse_ref(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformIAdd(OpGroupNonUniformIAdd {
-                    id_result_type,
-                    id_result,
-                    execution,
-                    operation,
-                    value,
-                    cluster_size,
-                }))
+                Ok(InstructionRef::Extension(OpExtensionRef { name }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        350u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+        11u16 => split_fn!({
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+            let (name, words) = <Cow<str>>::spirv_parse_ref(words, parse_state)?;
+            parse_state.define_id(
+                id_result,
+                IdState::ExtensionInstructionSet(ExtensionInstructionSet::from(&*name)),
+            )?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformFAdd(OpGroupNonUniformFAdd {
-                    id_result_type,
+                Ok(InstructionRef::ExtInstImport(OpExtInstImportRef {
                     id_result,
-                    execution,
-                    operation,
-                    value,
-                    cluster_size,
+                    name,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        351u16 => split_fn!({
+        12u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
-            if words.is_empty() {
-                Ok(Instruction::GroupNonUniformIMul(OpGroupNonUniformIMul {
+            let (set, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (instruction, words) = LiteralExtInstInteger::spirv_parse(words, parse_state)?;
+            let extension_instruction_set = match &parse_state.id_states[set.0 as usize] {
+                IdState::ExtensionInstructionSet(ExtensionInstructionSet::Other(_)) => {
+                    return Ok(InstructionRef::ExtInst(OpExtInstRef {
+                        id_result_type,
+                        id_result,
+                        set,
+                        instruction,
+                        operands: words,
+                    }));
+                }
+                IdState::ExtensionInstructionSet(v) => v.clone(),
+                _ => return Err(Error::IdIsNotExtInstImport(set)),
+            };
+            match (extension_instruction_set, instruction) {
+                (ExtensionInstructionSet::OpenCLStd, 184u32) => split_fn!({
+                    let (format, words) = IdRef::spirv_parse(words, parse_state)?;
+                    let (additional_arguments, words) =
+                        <&'a [IdRef]>::spirv_parse_ref(words, parse_state)?;
+                    if words.is_empty() {
+                        Ok(InstructionRef::OpenCLStdPrintf(OpOpenCLStdPrintfRef {
+                            id_result_type,
+                            id_result,
+                            set,
+                            format,
+                            additional_arguments,
+                        }))
+                    } else {
+                        Err(Error::InstructionTooLong)
+                    }
+                }),
+                (extension_instruction_set, instruction) => parse_extension_instruction(
+                    extension_instruction_set,
+                    instruction,
                     id_result_type,
                     id_result,
-                    execution,
-                    operation,
-                    value,
-                    cluster_size,
+                    set,
+                    words,
+                    parse_state,
+                )
+                .map(InstructionRef::from_instruction_without_borrowed_operands),
+            }
+        }),
+        15u16 => split_fn!({
+            let (execution_model, words) = ExecutionModel::spirv_parse(words, parse_state)?;
+            let (entry_point, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (name, words) = <Cow<'a, str>>::spirv_parse_ref(words, parse_state)?;
+            let (interface, words) = <&'a [IdRef]>::spirv_parse_ref(words, parse_state)?;
+            if words.is_empty() {
+                Ok(InstructionRef::EntryPoint(OpEntryPointRef {
+                    execution_model,
+                    entry_point,
+                    name,
+                    interface,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        352u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+        30u16 => split_fn!({
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+            let (member_types, words) = <&'a [IdRef]>::spirv_parse_ref(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformFMul(OpGroupNonUniformFMul {
-                    id_result_type,
+                Ok(InstructionRef::TypeStruct(OpTypeStructRef {
                     id_result,
-                    execution,
-                    operation,
-                    value,
-                    cluster_size,
+                    member_types,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        353u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+        31u16 => split_fn!({
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+            let (the_name_of_the_opaque_type, words) =
+                <Cow<'a, str>>::spirv_parse_ref(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformSMin(OpGroupNonUniformSMin {
-                    id_result_type,
+                Ok(InstructionRef::TypeOpaque(OpTypeOpaqueRef {
                     id_result,
-                    execution,
-                    operation,
-                    value,
-                    cluster_size,
+                    the_name_of_the_opaque_type,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        354u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
+        33u16 => split_fn!({
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+            let (return_type, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (parameter_types, words) = <&'a [IdRef]>::spirv_parse_ref(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformUMin(OpGroupNonUniformUMin {
-                    id_result_type,
+                Ok(InstructionRef::TypeFunction(OpTypeFunctionRef {
                     id_result,
-                    execution,
-                    operation,
-                    value,
-                    cluster_size,
+                    return_type,
+                    parameter_types,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        355u16 => split_fn!({
+        44u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            let (constituents, words) = <&'a [IdRef]>::spirv_parse_ref(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformFMin(OpGroupNonUniformFMin {
+                Ok(InstructionRef::ConstantComposite(OpConstantCompositeRef {
                     id_result_type,
                     id_result,
-                    execution,
-                    operation,
-                    value,
-                    cluster_size,
+                    constituents,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        356u16 => split_fn!({
+        51u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            let (constituents, words) = <&'a [IdRef]>::spirv_parse_ref(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformSMax(OpGroupNonUniformSMax {
-                    id_result_type,
-                    id_result,
-                    execution,
-                    operation,
-                    value,
-                    cluster_size,
-                }))
+                Ok(InstructionRef::SpecConstantComposite(
+                    OpSpecConstantCompositeRef {
+                        id_result_type,
+                        id_result,
+                        constituents,
+                    },
+                ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        357u16 => split_fn!({
+        57u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            let (function, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (arguments, words) = <&'a [IdRef]>::spirv_parse_ref(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformUMax(OpGroupNonUniformUMax {
+                Ok(InstructionRef::FunctionCall(OpFunctionCallRef {
                     id_result_type,
                     id_result,
-                    execution,
-                    operation,
-                    value,
-                    cluster_size,
+                    function,
+                    arguments,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        358u16 => split_fn!({
+        65u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (indexes, words) = <&'a [IdRef]>::spirv_parse_ref(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformFMax(OpGroupNonUniformFMax {
+                Ok(InstructionRef::AccessChain(OpAccessChainRef {
                     id_result_type,
                     id_result,
-                    execution,
-                    operation,
-                    value,
-                    cluster_size,
+                    base,
+                    indexes,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        359u16 => split_fn!({
+        66u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (indexes, words) = <&'a [IdRef]>::spirv_parse_ref(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformBitwiseAnd(
-                    OpGroupNonUniformBitwiseAnd {
+                Ok(InstructionRef::InBoundsAccessChain(
+                    OpInBoundsAccessChainRef {
                         id_result_type,
                         id_result,
-                        execution,
-                        operation,
-                        value,
-                        cluster_size,
+                        base,
+                        indexes,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        360u16 => split_fn!({
+        67u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (element, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (indexes, words) = <&'a [IdRef]>::spirv_parse_ref(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformBitwiseOr(
-                    OpGroupNonUniformBitwiseOr {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        operation,
-                        value,
-                        cluster_size,
-                    },
-                ))
+                Ok(InstructionRef::PtrAccessChain(OpPtrAccessChainRef {
+                    id_result_type,
+                    id_result,
+                    base,
+                    element,
+                    indexes,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        361u16 => split_fn!({
+        70u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            let (base, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (element, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (indexes, words) = <&'a [IdRef]>::spirv_parse_ref(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformBitwiseXor(
-                    OpGroupNonUniformBitwiseXor {
+                Ok(InstructionRef::InBoundsPtrAccessChain(
+                    OpInBoundsPtrAccessChainRef {
                         id_result_type,
                         id_result,
-                        execution,
-                        operation,
-                        value,
-                        cluster_size,
+                        base,
+                        element,
+                        indexes,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        362u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        74u16 => split_fn!({
+            let (decoration_group, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (targets, words) = <&'a [IdRef]>::spirv_parse_ref(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformLogicalAnd(
-                    OpGroupNonUniformLogicalAnd {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        operation,
-                        value,
-                        cluster_size,
-                    },
-                ))
+                Ok(InstructionRef::GroupDecorate(OpGroupDecorateRef {
+                    decoration_group,
+                    targets,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        363u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        75u16 => split_fn!({
+            let (decoration_group, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (targets, words) =
+                <OperandList<'a, PairIdRefLiteralInteger>>::spirv_parse_ref(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformLogicalOr(
-                    OpGroupNonUniformLogicalOr {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        operation,
-                        value,
-                        cluster_size,
+                Ok(InstructionRef::GroupMemberDecorate(
+                    OpGroupMemberDecorateRef {
+                        decoration_group,
+                        targets,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        364u16 => split_fn!({
+        79u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (operation, words) = GroupOperation::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (cluster_size, words) = Option::<IdRef>::spirv_parse(words, parse_state)?;
+            let (vector_1, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (vector_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (components, words) =
+                <&'a [LiteralInteger32]>::spirv_parse_ref(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformLogicalXor(
-                    OpGroupNonUniformLogicalXor {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        operation,
-                        value,
-                        cluster_size,
-                    },
-                ))
+                Ok(InstructionRef::VectorShuffle(OpVectorShuffleRef {
+                    id_result_type,
+                    id_result,
+                    vector_1,
+                    vector_2,
+                    components,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        365u16 => split_fn!({
+        80u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (index, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (constituents, words) = <&'a [IdRef]>::spirv_parse_ref(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformQuadBroadcast(
-                    OpGroupNonUniformQuadBroadcast {
+                Ok(InstructionRef::CompositeConstruct(
+                    OpCompositeConstructRef {
                         id_result_type,
                         id_result,
-                        execution,
-                        value,
-                        index,
+                        constituents,
                     },
                 ))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        366u16 => split_fn!({
+        81u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (execution, words) = IdScope::spirv_parse(words, parse_state)?;
-            let (value, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (direction, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (composite, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (indexes, words) = <&'a [LiteralInteger32]>::spirv_parse_ref(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::GroupNonUniformQuadSwap(
-                    OpGroupNonUniformQuadSwap {
-                        id_result_type,
-                        id_result,
-                        execution,
-                        value,
-                        direction,
-                    },
-                ))
+                Ok(InstructionRef::CompositeExtract(OpCompositeExtractRef {
+                    id_result_type,
+                    id_result,
+                    composite,
+                    indexes,
+                }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        400u16 => split_fn!({
+        82u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (object, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (composite, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (indexes, words) = <&'a [LiteralInteger32]>::spirv_parse_ref(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::CopyLogical(OpCopyLogical {
+                Ok(InstructionRef::CompositeInsert(OpCompositeInsertRef {
                     id_result_type,
                     id_result,
-                    operand,
+                    object,
+                    composite,
+                    indexes,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        401u16 => split_fn!({
+        245u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (variable_parent, words) =
+                <OperandList<'a, PairIdRefIdRef>>::spirv_parse_ref(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::PtrEqual(OpPtrEqual {
+                Ok(InstructionRef::Phi(OpPhiRef {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
+                    variable_parent,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        402u16 => split_fn!({
-            let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
-            let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
-            parse_state.define_value(id_result_type, id_result)?;
+        250u16 => split_fn!({
+            let (condition, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (true_label, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (false_label, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (branch_weights, words) =
+                <&'a [LiteralInteger32]>::spirv_parse_ref(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::PtrNotEqual(OpPtrNotEqual {
-                    id_result_type,
-                    id_result,
-                    operand_1,
-                    operand_2,
+                Ok(InstructionRef::BranchConditional(OpBranchConditionalRef {
+                    condition,
+                    true_label,
+                    false_label,
+                    branch_weights,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        403u16 => split_fn!({
+        251u16 => split_fn!({
+            let (selector, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (default, words) = IdRef::spirv_parse(words, parse_state)?;
+            match &parse_state.id_states[selector.0 as usize] {
+                IdState::Value(IdStateValue(BitWidth::Width32OrLess)) => {
+                    let (target, words) =
+                        OperandList::<PairLiteralInteger32IdRef>::spirv_parse_ref(
+                            words,
+                            parse_state,
+                        )?;
+                    if words.is_empty() {
+                        Ok(InstructionRef::Switch32(OpSwitch32Ref {
+                            selector,
+                            default,
+                            target,
+                        }))
+                    } else {
+                        Err(Error::InstructionTooLong)
+                    }
+                }
+                IdState::Value(IdStateValue(BitWidth::Width64)) => {
+                    let (target, words) =
+                        OperandList::<PairLiteralInteger64IdRef>::spirv_parse_ref(
+                            words,
+                            parse_state,
+                        )?;
+                    if words.is_empty() {
+                        Ok(InstructionRef::Switch64(OpSwitch64Ref {
+                            selector,
+                            default,
+                            target,
+                        }))
+                    } else {
+                        Err(Error::InstructionTooLong)
+                    }
+                }
+                _ => Err(Error::SwitchSelectorIsInvalid(selector)),
+            }
+        }),
+        292u16 => split_fn!({
             let (id_result_type, words) = IdResultType::spirv_parse(words, parse_state)?;
             let (id_result, words) = IdResult::spirv_parse(words, parse_state)?;
-            let (operand_1, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (operand_2, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (queue, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (flags, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (nd_range, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (num_events, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (wait_events, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (ret_event, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (invoke, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_size, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (param_align, words) = IdRef::spirv_parse(words, parse_state)?;
+            let (local_size, words) = <&'a [IdRef]>::spirv_parse_ref(words, parse_state)?;
             parse_state.define_value(id_result_type, id_result)?;
             if words.is_empty() {
-                Ok(Instruction::PtrDiff(OpPtrDiff {
+                Ok(InstructionRef::EnqueueKernel(OpEnqueueKernelRef {
                     id_result_type,
                     id_result,
-                    operand_1,
-                    operand_2,
-                }))
-            } else {
-                Err(Error::InstructionTooLong)
-            }
-        }),
-        5632u16 => split_fn!({
-            let (target, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (decoration, words) = Decoration::spirv_parse(words, parse_state)?;
-            if words.is_empty() {
-                Ok(Instruction::DecorateString(OpDecorateString {
-                    target,
-                    decoration,
+                    queue,
+                    flags,
+                    nd_range,
+                    num_events,
+                    wait_events,
+                    ret_event,
+                    invoke,
+                    param,
+                    param_size,
+                    param_align,
+                    local_size,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        5633u16 => split_fn!({
-            let (struct_type, words) = IdRef::spirv_parse(words, parse_state)?;
-            let (member, words) = LiteralInteger32::spirv_parse(words, parse_state)?;
-            let (decoration, words) = Decoration::spirv_parse(words, parse_state)?;
+        330u16 => split_fn!({
+            let (process, words) = <Cow<'a, str>>::spirv_parse_ref(words, parse_state)?;
             if words.is_empty() {
-                Ok(Instruction::MemberDecorateString(OpMemberDecorateString {
-                    struct_type,
-                    member,
-                    decoration,
+                Ok(InstructionRef::ModuleProcessed(OpModuleProcessedRef {
+                    process,
                 }))
             } else {
                 Err(Error::InstructionTooLong)
             }
         }),
-        opcode => Err(Error::UnknownOpcode(opcode)),
+        opcode => parse_instruction(opcode, words, parse_state)
+            .map(InstructionRef::from_instruction_without_borrowed_operands),
     }
 }
 impl fmt::Display for Instruction {
@@ -36689,19 +40185,16 @@ mod input_file_tests {
     fn input_file_tests() {
         println!("checking that generated code is up to date -- update by running:");
         println!("cargo build --features=spirv-parser-generator");
-        input_file_test ( "../spirv-parser-generator/src/ast.rs" , b"^\xEA\x97\xA1\x06\x07\x18\xF5\xE3/|z]s\x0C\xF7\xE5(W\xFC\x84\x0B\xAE\x08q{MxjO\x8F\xF8" ) ;
-        input_file_test(
-            "../spirv-parser-generator/src/generate.rs",
-            b"\xE7n\x8C\x87RV\0\xF5\xD9\xA34A\x845\x8F\x0F\xE9)\x7F\x8Fgr0\xBB\xCFko\nEClv",
-        );
-        input_file_test ( "../spirv-parser-generator/src/lib.rs" , b"\xED\xEA6\x8E\x83=*W\xCF3jN\xFC\xD6t\x8E(\xA5V\xFF#\x0F\xE4R\xE2\x8B~s\x15\x1C\xE6\xA5" ) ;
-        input_file_test ( "../spirv-parser-generator/src/util.rs" , b"\xA5\x0C;C\x02\x06o9*\x1B\x0B\xDB+\x11\xEA\xB9\xB5\xC3\x91\x954\xD2\xF9\xD8B\x97\xBF\xA4?F\x8F\xDD" ) ;
-        input_file_test ( "../spirv-parser-generator/Cargo.toml" , b"\xB2\xBB?\xE5\xB5\xB3\xED\x96]\x8Cj\xDDM+\xB0\xFB\xC9\xBB\xAB\xF8\tH\x02\xFF\xA7\x05\xD3\x0E\xDE\x98\r\x02" ) ;
-        input_file_test ( "../external/SPIRV-Headers/include/spirv/unified1/spirv.core.grammar.json" , b"\xA0\xE8!\x91\xFBV\x81\x041Ra\xCB\xCE\r6\xBC\xCCD\xAE34\xECT\x82\xC0\x150S\x97\xEF\x06\xA5" ) ;
+        input_file_test ("../spirv-parser-generator/src/ast.rs" , b"^\xEA\x97\xA1\x06\x07\x18\xF5\xE3/|z]s\x0C\xF7\xE5(W\xFC\x84\x0B\xAE\x08q{MxjO\x8F\xF8") ;
+        input_file_test ("../spirv-parser-generator/src/generate.rs" , b"o\xFA\xCD\x9D\xDE\xA2\n\xD9\x80}=\x1FZX\x08\xAF\xB3\xE3|\xFB\xFE\x07s_<E\x81\xC2\x97\x91\xC3\xA6") ;
+        input_file_test ("../spirv-parser-generator/src/lib.rs" , b"\xED\xEA6\x8E\x83=*W\xCF3jN\xFC\xD6t\x8E(\xA5V\xFF#\x0F\xE4R\xE2\x8B~s\x15\x1C\xE6\xA5") ;
+        input_file_test ("../spirv-parser-generator/src/util.rs" , b"\xA5\x0C;C\x02\x06o9*\x1B\x0B\xDB+\x11\xEA\xB9\xB5\xC3\x91\x954\xD2\xF9\xD8B\x97\xBF\xA4?F\x8F\xDD") ;
+        input_file_test ("../spirv-parser-generator/Cargo.toml" , b"\xB2\xBB?\xE5\xB5\xB3\xED\x96]\x8Cj\xDDM+\xB0\xFB\xC9\xBB\xAB\xF8\tH\x02\xFF\xA7\x05\xD3\x0E\xDE\x98\r\x02") ;
+        input_file_test ("../external/SPIRV-Headers/include/spirv/unified1/spirv.core.grammar.json" , b"\xA0\xE8!\x91\xFBV\x81\x041Ra\xCB\xCE\r6\xBC\xCCD\xAE34\xECT\x82\xC0\x150S\x97\xEF\x06\xA5") ;
         input_file_test(
             "../external/SPIRV-Headers/include/spirv/unified1/extinst.opencl.std.100.grammar.json",
             b"\xB6\xBE2H\xAF\x8EaP3.\xC5\xD9\xDF.W\x8B6MX\x8Cv%3\x83\x1BuP\xF6\x07\xA7?\xF8",
         );
-        input_file_test ( "../external/SPIRV-Headers/include/spirv/unified1/extinst.glsl.std.450.grammar.json" , b";\xCFx\xC1;q\xA9\xEB\xBAQ\xE8\x90\xC5_A\xA5\xE0\xF4{\xA2\x83\xBC|\x08\xFD~\x13D\xEA_G\xA6" ) ;
+        input_file_test ("../external/SPIRV-Headers/include/spirv/unified1/extinst.glsl.std.450.grammar.json" , b";\xCFx\xC1;q\xA9\xEB\xBAQ\xE8\x90\xC5_A\xA5\xE0\xF4{\xA2\x83\xBC|\x08\xFD~\x13D\xEA_G\xA6") ;
     }
 }
@@ -15,6 +15,7 @@ pub use generated_parser::*;
 #[cfg(test)]
 mod tests {
     use super::*;
+    use std::borrow::Cow;
     use std::io::Write;
 
     /// produce dump output using:
@@ -213,4 +214,39 @@ mod tests {
         }
         assert!(output == expected);
     }
+
+    #[test]
+    fn parse_ref_test() {
+        let inputs: [&[u8]; 3] = [
+            include_bytes!("../test_inputs/test.spv"),
+            include_bytes!("../test_inputs/test2.spv"),
+            include_bytes!("../test_inputs/test3.spv"),
+        ];
+        for bytes in inputs.iter() {
+            let words = convert_bytes_to_words(bytes).unwrap();
+            let words_range = words.as_ptr() as usize..(words.as_ptr() as usize + bytes.len());
+            let expected: Vec<String> = Parser::start(&words)
+                .unwrap()
+                .map(|instruction| instruction.unwrap().to_string())
+                .collect();
+            let mut output = Vec::new();
+            for instruction in Parser::start(&words).unwrap().into_refs() {
+                let instruction = instruction.unwrap();
+                match &instruction.instruction {
+                    InstructionRef::Name(OpNameRef { name, .. }) => {
+                        // strings can only be borrowed on little-endian targets
+                        if let (Cow::Owned(_), true) = (name, cfg!(target_endian = "little")) {
+                            panic!("name was copied: {}", instruction);
+                        }
+                    }
+                    InstructionRef::EntryPoint(OpEntryPointRef { interface, .. }) => {
+                        assert!(words_range.contains(&(interface.as_ptr() as usize)));
+                    }
+                    _ => {}
+                }
+                output.push(instruction.to_string());
+            }
+            assert_eq!(output, expected);
+        }
+    }
 }
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! ahead-of-time compilation of compute shaders, used by `kazan-aot`.
+//!
+//! The output is pipeline cache data, so it can be given to `vkCreatePipelineCache` or mapped
+//! through `KAZAN_PIPELINE_CACHE_FILE`. It's only valid for the same version of kazan on the
+//! same kind of CPU; pipelines compiled for anything else are compiled again when created.
+//!
+//! A shader that makes the compiler panic is reported and left out of the output, and the
+//! other shaders are still compiled. That needs panics to unwind: with `panic = "abort"`, as
+//! in the release profile, the first failure still aborts.
+
+use crate::pipeline::{
+    compile_compute_pipeline, get_compute_pipeline_key, get_generic_pipeline_options,
+};
+use crate::pipeline_cache::PipelineCache;
+use crate::worker_pool::WorkerPool;
+use std::any::Any;
+use std::panic::{self, AssertUnwindSafe};
+use std::sync::Mutex;
+
+const SPIRV_MAGIC_NUMBER: u32 = 0x0723_0203;
+
+/// a compute shader to compile without specializations. `pipeline_layout` has to be the same as
+/// the layout the application creates the pipeline with, since it's part of the cache key.
+#[derive(Clone, Debug)]
+pub struct ComputeShader {
+    pub code: Vec<u32>,
+    pub entry_point_name: String,
+    pub pipeline_layout: shader_compiler::PipelineLayout,
+}
+
+/// parses the bindings of a descriptor set layout, separated by commas. Each binding is the
+/// descriptor type, like `uniform-buffer`, optionally followed by `*<count>`; it's empty for
+/// bindings that aren't used.
+pub fn parse_descriptor_set_layout(
+    text: &str,
+) -> Result<shader_compiler::DescriptorSetLayout, String> {
+    use shader_compiler::DescriptorLayout;
+    let bindings = text
+        .split(',')
+        .map(|binding| {
+            let binding = binding.trim();
+            if binding.is_empty() {
+                return Ok(None);
+            }
+            let (descriptor_type, count) = match binding.find('*') {
+                Some(index) => (
+                    &binding[..index],
+                    binding[index + 1..]
+                        .parse()
+                        .map_err(|_| format!("invalid descriptor count: {}", binding))?,
+                ),
+                None => (binding, 1),
+            };
+            Ok(Some(match descriptor_type {
+                "sampler" => DescriptorLayout::Sampler { count },
+                "combined-image-sampler" => DescriptorLayout::CombinedImageSampler { count },
+                "sampled-image" => DescriptorLayout::SampledImage { count },
+                "storage-image" => DescriptorLayout::StorageImage { count },
+                "uniform-texel-buffer" => DescriptorLayout::UniformTexelBuffer { count },
+                "storage-texel-buffer" => DescriptorLayout::StorageTexelBuffer { count },
+                "uniform-buffer" => DescriptorLayout::UniformBuffer { count },
+                "storage-buffer" => DescriptorLayout::StorageBuffer { count },
+                "uniform-buffer-dynamic" => DescriptorLayout::UniformBufferDynamic { count },
+                "storage-buffer-dynamic" => DescriptorLayout::StorageBufferDynamic { count },
+                "input-attachment" => DescriptorLayout::InputAttachment { count },
+                _ => return Err(format!("unknown descriptor type: {}", descriptor_type)),
+            }))
+        })
+        .collect::<Result<_, String>>()?;
+    Ok(shader_compiler::DescriptorSetLayout { bindings })
+}
+
+/// converts the contents of a `.spv` file, which can be in either byte order
+pub fn get_spirv_words(bytes: &[u8]) -> Result<Vec<u32>, String> {
+    if bytes.len() % 4 != 0 {
+        return Err("SPIR-V size isn't a multiple of 4 bytes".into());
+    }
+    let mut words: Vec<u32> = bytes
+        .chunks(4)
+        .map(|word| u32::from_le_bytes([word[0], word[1], word[2], word[3]]))
+        .collect();
+    match words.first() {
+        Some(&SPIRV_MAGIC_NUMBER) => {}
+        Some(&magic_number) if magic_number.swap_bytes() == SPIRV_MAGIC_NUMBER => {
+            for word in &mut words {
+                *word = word.swap_bytes();
+            }
+        }
+        _ => return Err("not SPIR-V: invalid magic number".into()),
+    }
+    Ok(words)
+}
+
+fn get_panic_message(payload: &(dyn Any + Send)) -> String {
+    if let Some(message) = payload.downcast_ref::<&str>() {
+        (*message).into()
+    } else if let Some(message) = payload.downcast_ref::<String>() {
+        message.clone()
+    } else {
+        "the shader compiler panicked".into()
+    }
+}
+
+/// compiles `shaders` in parallel, with the options pipelines get when created without flags.
+/// returns the pipeline cache data, along with the index and error of each shader that failed
+/// to compile, sorted by index.
+pub fn compile_compute_shaders(shaders: &[ComputeShader]) -> (Vec<u8>, Vec<(usize, String)>) {
+    let pipeline_cache = PipelineCache::new(&[]);
+    let options = shader_compiler::ComputePipelineOptions {
+        generic_options: get_generic_pipeline_options(0),
+    };
+    let failures = Mutex::new(Vec::new());
+    WorkerPool::with_default_worker_count().parallel_for(shaders.len(), 1, &|shaders_range| {
+        for index in shaders_range {
+            let shader = &shaders[index];
+            let result = panic::catch_unwind(AssertUnwindSafe(|| {
+                let compute_stage = shader_compiler::ShaderStageCreateInfo {
+                    code: &shader.code,
+                    entry_point_name: &shader.entry_point_name,
+                    specializations: &[],
+                };
+                let key =
+                    get_compute_pipeline_key(&compute_stage, &shader.pipeline_layout, &options);
+                compile_compute_pipeline(
+                    &options,
+                    compute_stage,
+                    shader.pipeline_layout.clone(),
+                    key,
+                    Some(&pipeline_cache),
+                );
+            }));
+            if let Err(payload) = result {
+                failures
+                    .lock()
+                    .unwrap()
+                    .push((index, get_panic_message(&*payload)));
+            }
+        }
+    });
+    let mut failures = failures.into_inner().unwrap();
+    failures.sort_by_key(|&(index, _)| index);
+    (pipeline_cache.get_data(usize::max_value()).0, failures)
+}
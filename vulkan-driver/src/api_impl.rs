@@ -5,11 +5,13 @@
 #![allow(clippy::unneeded_field_pattern)]
 
 use crate::api;
+use crate::background_compiler::{self, BackgroundCompiler};
 use crate::buffer::{Buffer, BufferMemory};
+use crate::command_buffer::{Command, CommandPool};
 use crate::constants::*;
 use crate::descriptor_set::{
-    Descriptor, DescriptorLayout, DescriptorPool, DescriptorSet, DescriptorSetLayout,
-    DescriptorWriteArg,
+    DescriptorLayout, DescriptorPool, DescriptorSetLayout, DescriptorUpdateTemplate,
+    DescriptorWriteArg, PushDescriptorWrites,
 };
 use crate::device_memory::{
     DeviceMemory, DeviceMemoryAllocation, DeviceMemoryHeap, DeviceMemoryHeaps, DeviceMemoryLayout,
@@ -18,15 +20,22 @@ use crate::device_memory::{
 use crate::handle::{Handle, MutHandle, OwnedHandle, SharedHandle};
 use crate::image::{
     ComponentMapping, Image, ImageMemory, ImageMultisampleCount, ImageProperties, ImageView,
-    ImageViewType, SupportedTilings,
+    ImageViewType, SupportedTilings, Tiling,
 };
 use crate::pipeline::{self, PipelineLayout};
-use crate::render_pass::RenderPass;
+use crate::pipeline_cache::{self, PipelineCache};
+use crate::query::QueryPool;
+use crate::queue::{Queue, Submission};
+use crate::render_pass::{Framebuffer, RenderPass};
 use crate::sampler;
 use crate::sampler::Sampler;
 use crate::shader_module::ShaderModule;
-use crate::swapchain::SurfacePlatform;
+use crate::suballocator::Suballocator;
+use crate::swapchain::{QueuedPresent, SurfacePlatform};
+use crate::sync::{self, Event, Fence, Semaphore};
+use crate::timestamp;
 use crate::util;
+use crate::worker_pool::WorkerPool;
 use enum_map::{enum_map, Enum, EnumMap};
 use std::ffi::CStr;
 use std::iter;
@@ -39,6 +48,7 @@ use std::ptr::null_mut;
 #[cfg(target_os = "linux")]
 use std::ptr::NonNull;
 use std::str::FromStr;
+use std::sync::Arc;
 use sys_info;
 use uuid;
 #[cfg(target_os = "linux")]
@@ -72,7 +82,11 @@ pub enum Extension {
     VK_KHR_relaxed_block_layout,
     VK_KHR_shader_draw_parameters,
     VK_KHR_variable_pointers,
+    VK_KHR_push_descriptor,
+    VK_KHR_timeline_semaphore,
     VK_KHR_swapchain,
+    VK_EXT_headless_surface,
+    VK_EXT_calibrated_timestamps,
     #[cfg(target_os = "linux")]
     VK_KHR_xcb_surface,
     #[cfg(target_os = "linux")]
@@ -107,7 +121,8 @@ impl Extension {
             | Extension::VK_KHR_maintenance2
             | Extension::VK_KHR_storage_buffer_storage_class
             | Extension::VK_KHR_relaxed_block_layout
-            | Extension::VK_KHR_shader_draw_parameters => extensions![],
+            | Extension::VK_KHR_shader_draw_parameters
+            | Extension::VK_EXT_calibrated_timestamps => extensions![],
             Extension::VK_KHR_device_group => extensions![Extension::VK_KHR_device_group_creation],
             Extension::VK_KHR_sampler_ycbcr_conversion => extensions![
                 Extension::VK_KHR_maintenance1,
@@ -119,7 +134,9 @@ impl Extension {
             | Extension::VK_KHR_external_memory_capabilities
             | Extension::VK_KHR_external_fence_capabilities
             | Extension::VK_KHR_external_semaphore_capabilities
-            | Extension::VK_KHR_multiview => {
+            | Extension::VK_KHR_multiview
+            | Extension::VK_KHR_push_descriptor
+            | Extension::VK_KHR_timeline_semaphore => {
                 extensions![Extension::VK_KHR_get_physical_device_properties2]
             }
             Extension::VK_KHR_16bit_storage | Extension::VK_KHR_variable_pointers => extensions![
@@ -138,7 +155,9 @@ impl Extension {
             Extension::VK_KHR_external_semaphore => {
                 extensions![Extension::VK_KHR_external_semaphore_capabilities]
             }
-            Extension::VK_KHR_swapchain => extensions![Extension::VK_KHR_surface],
+            Extension::VK_KHR_swapchain | Extension::VK_EXT_headless_surface => {
+                extensions![Extension::VK_KHR_surface]
+            }
             #[cfg(target_os = "linux")]
             Extension::VK_KHR_xcb_surface => extensions![Extension::VK_KHR_surface],
             #[cfg(target_os = "linux")]
@@ -196,7 +215,11 @@ impl Extension {
             VK_KHR_relaxed_block_layout,
             VK_KHR_shader_draw_parameters,
             VK_KHR_variable_pointers,
+            VK_KHR_push_descriptor,
+            VK_KHR_timeline_semaphore,
             VK_KHR_swapchain,
+            VK_EXT_headless_surface,
+            VK_EXT_calibrated_timestamps,
             #[cfg(target_os = "linux")]
             VK_KHR_xcb_surface,
             #[cfg(target_os = "linux")]
@@ -249,7 +272,13 @@ impl Extension {
                 api::VK_KHR_SHADER_DRAW_PARAMETERS_SPEC_VERSION
             }
             Extension::VK_KHR_variable_pointers => api::VK_KHR_VARIABLE_POINTERS_SPEC_VERSION,
+            Extension::VK_KHR_push_descriptor => api::VK_KHR_PUSH_DESCRIPTOR_SPEC_VERSION,
+            Extension::VK_KHR_timeline_semaphore => api::VK_KHR_TIMELINE_SEMAPHORE_SPEC_VERSION,
             Extension::VK_KHR_swapchain => api::VK_KHR_SWAPCHAIN_SPEC_VERSION,
+            Extension::VK_EXT_headless_surface => api::VK_EXT_HEADLESS_SURFACE_SPEC_VERSION,
+            Extension::VK_EXT_calibrated_timestamps => {
+                api::VK_EXT_CALIBRATED_TIMESTAMPS_SPEC_VERSION
+            }
             #[cfg(target_os = "linux")]
             Extension::VK_KHR_xcb_surface => api::VK_KHR_XCB_SURFACE_SPEC_VERSION,
             #[cfg(target_os = "linux")]
@@ -271,7 +300,8 @@ impl Extension {
             | Extension::VK_KHR_get_physical_device_properties2
             | Extension::VK_KHR_external_memory_capabilities
             | Extension::VK_KHR_external_fence_capabilities
-            | Extension::VK_KHR_external_semaphore_capabilities => ExtensionScope::Instance,
+            | Extension::VK_KHR_external_semaphore_capabilities
+            | Extension::VK_EXT_headless_surface => ExtensionScope::Instance,
             Extension::VK_KHR_bind_memory2
             | Extension::VK_KHR_device_group
             | Extension::VK_KHR_descriptor_update_template
@@ -290,7 +320,10 @@ impl Extension {
             | Extension::VK_KHR_relaxed_block_layout
             | Extension::VK_KHR_shader_draw_parameters
             | Extension::VK_KHR_variable_pointers
-            | Extension::VK_KHR_swapchain => ExtensionScope::Device,
+            | Extension::VK_KHR_push_descriptor
+            | Extension::VK_KHR_timeline_semaphore
+            | Extension::VK_KHR_swapchain
+            | Extension::VK_EXT_calibrated_timestamps => ExtensionScope::Device,
             #[cfg(target_os = "linux")]
             Extension::VK_KHR_xcb_surface
             | Extension::VK_KHR_xlib_surface  => ExtensionScope::Instance,
@@ -759,6 +792,15 @@ fn get_proc_address(
         proc_address!(vkGetPhysicalDevicePresentRectanglesKHR, PFN_vkGetPhysicalDevicePresentRectanglesKHR, device, extensions[Extension::VK_KHR_swapchain]);
         proc_address!(vkAcquireNextImage2KHR, PFN_vkAcquireNextImage2KHR, device, extensions[Extension::VK_KHR_swapchain]);
 
+        proc_address!(vkCreateHeadlessSurfaceEXT, PFN_vkCreateHeadlessSurfaceEXT, device, extensions[Extension::VK_EXT_headless_surface]);
+        proc_address!(vkCmdPushDescriptorSetKHR, PFN_vkCmdPushDescriptorSetKHR, device, extensions[Extension::VK_KHR_push_descriptor]);
+        proc_address!(vkCmdPushDescriptorSetWithTemplateKHR, PFN_vkCmdPushDescriptorSetWithTemplateKHR, device, extensions[Extension::VK_KHR_push_descriptor]);
+        proc_address!(vkGetSemaphoreCounterValueKHR, PFN_vkGetSemaphoreCounterValueKHR, device, extensions[Extension::VK_KHR_timeline_semaphore]);
+        proc_address!(vkWaitSemaphoresKHR, PFN_vkWaitSemaphoresKHR, device, extensions[Extension::VK_KHR_timeline_semaphore]);
+        proc_address!(vkSignalSemaphoreKHR, PFN_vkSignalSemaphoreKHR, device, extensions[Extension::VK_KHR_timeline_semaphore]);
+        proc_address!(vkGetPhysicalDeviceCalibrateableTimeDomainsEXT, PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT, device, extensions[Extension::VK_EXT_calibrated_timestamps]);
+        proc_address!(vkGetCalibratedTimestampsEXT, PFN_vkGetCalibratedTimestampsEXT, device, extensions[Extension::VK_EXT_calibrated_timestamps]);
+
         #[cfg(target_os = "linux")]
         proc_address!(vkCreateXcbSurfaceKHR, PFN_vkCreateXcbSurfaceKHR, device, extensions[Extension::VK_KHR_xcb_surface]);
         #[cfg(target_os = "linux")]
@@ -787,8 +829,6 @@ fn get_proc_address(
         proc_address!(vkCmdEndRenderPass2KHR, PFN_vkCmdEndRenderPass2KHR, device, unknown);
         proc_address!(vkCmdInsertDebugUtilsLabelEXT, PFN_vkCmdInsertDebugUtilsLabelEXT, device, unknown);
         proc_address!(vkCmdNextSubpass2KHR, PFN_vkCmdNextSubpass2KHR, device, unknown);
-        proc_address!(vkCmdPushDescriptorSetKHR, PFN_vkCmdPushDescriptorSetKHR, device, unknown);
-        proc_address!(vkCmdPushDescriptorSetWithTemplateKHR, PFN_vkCmdPushDescriptorSetWithTemplateKHR, device, unknown);
         proc_address!(vkCmdSetCheckpointNV, PFN_vkCmdSetCheckpointNV, device, unknown);
         proc_address!(vkCmdSetCoarseSampleOrderNV, PFN_vkCmdSetCoarseSampleOrderNV, device, unknown);
         proc_address!(vkCmdSetDiscardRectangleEXT, PFN_vkCmdSetDiscardRectangleEXT, device, unknown);
@@ -867,6 +907,7 @@ pub struct Features {
     shader_draw_parameter_features: api::VkPhysicalDeviceShaderDrawParameterFeatures,
     protected_memory_features: api::VkPhysicalDeviceProtectedMemoryFeatures,
     multiview_features: api::VkPhysicalDeviceMultiviewFeatures,
+    timeline_semaphore_features: api::VkPhysicalDeviceTimelineSemaphoreFeaturesKHR,
 }
 
 impl Features {
@@ -896,8 +937,8 @@ impl Features {
                 textureCompressionETC2: api::VK_FALSE, // FIXME: enable texture compression
                 textureCompressionASTC_LDR: api::VK_FALSE, // FIXME: enable texture compression
                 textureCompressionBC: api::VK_FALSE,   // FIXME: enable texture compression
-                occlusionQueryPrecise: api::VK_FALSE,
-                pipelineStatisticsQuery: api::VK_FALSE,
+                occlusionQueryPrecise: api::VK_TRUE,
+                pipelineStatisticsQuery: api::VK_TRUE,
                 vertexPipelineStoresAndAtomics: api::VK_TRUE,
                 fragmentStoresAndAtomics: api::VK_TRUE,
                 shaderTessellationAndGeometryPointSize: api::VK_FALSE,
@@ -966,6 +1007,11 @@ impl Features {
                 multiviewGeometryShader: api::VK_FALSE,
                 multiviewTessellationShader: api::VK_FALSE,
             },
+            timeline_semaphore_features: api::VkPhysicalDeviceTimelineSemaphoreFeaturesKHR {
+                sType: api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR,
+                pNext: null_mut(),
+                timelineSemaphore: api::VK_TRUE,
+            },
         }
     }
     fn splat(value: bool) -> Self {
@@ -1065,6 +1111,11 @@ impl Features {
                 multiviewGeometryShader: value32,
                 multiviewTessellationShader: value32,
             },
+            timeline_semaphore_features: api::VkPhysicalDeviceTimelineSemaphoreFeaturesKHR {
+                sType: api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR,
+                pNext: null_mut(),
+                timelineSemaphore: value32,
+            },
         }
     }
     fn visit2_mut<F: FnMut(&mut bool, &mut bool)>(&mut self, rhs: &mut Self, f: F) {
@@ -1162,6 +1213,7 @@ impl Features {
         visit!(multiview_features.multiview);
         visit!(multiview_features.multiviewGeometryShader);
         visit!(multiview_features.multiviewTessellationShader);
+        visit!(timeline_semaphore_features.timelineSemaphore);
     }
     fn visit2<F: FnMut(bool, bool)>(mut self, mut rhs: Self, mut f: F) {
         self.visit2_mut(&mut rhs, |v1, v2| f(*v1, *v2));
@@ -1247,6 +1299,11 @@ impl_import_export_feature_set!(
 
 impl_import_export_feature_set!(VkPhysicalDeviceMultiviewFeatures, multiview_features);
 
+impl_import_export_feature_set!(
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR,
+    timeline_semaphore_features
+);
+
 impl Eq for Features {}
 
 impl PartialEq for Features {
@@ -1307,8 +1364,6 @@ impl Not for Features {
     }
 }
 
-pub struct Queue {}
-
 pub struct Device {
     #[allow(dead_code)]
     physical_device: SharedHandle<api::VkPhysicalDevice>,
@@ -1316,6 +1371,10 @@ pub struct Device {
     #[allow(dead_code)]
     features: Features,
     queues: Vec<Vec<OwnedHandle<api::VkQueue>>>,
+    pub worker_pool: Arc<WorkerPool>,
+    pub suballocator: Arc<Suballocator>,
+    /// only present when tiered compilation is enabled
+    pub background_compiler: Option<BackgroundCompiler>,
 }
 
 impl Device {
@@ -1334,6 +1393,7 @@ impl Device {
             physical_device_sampler_ycbcr_conversion_features: api::VkPhysicalDeviceSamplerYcbcrConversionFeatures = api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES,
             physical_device_shader_draw_parameter_features: api::VkPhysicalDeviceShaderDrawParameterFeatures = api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETER_FEATURES,
             physical_device_variable_pointer_features: api::VkPhysicalDeviceVariablePointerFeatures = api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTER_FEATURES,
+            physical_device_timeline_semaphore_features: api::VkPhysicalDeviceTimelineSemaphoreFeaturesKHR = api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR,
         }
         let create_info = &*create_info;
         if create_info.enabledLayerCount != 0 {
@@ -1414,6 +1474,9 @@ impl Device {
         if !physical_device_variable_pointer_features.is_null() {
             selected_features.import_feature_set(&*physical_device_variable_pointer_features);
         }
+        if !physical_device_timeline_semaphore_features.is_null() {
+            selected_features.import_feature_set(&*physical_device_timeline_semaphore_features);
+        }
         if (selected_features & !physical_device.features) != Features::splat(false) {
             return Err(api::VK_ERROR_FEATURE_NOT_PRESENT);
         }
@@ -1454,11 +1517,14 @@ impl Device {
             total_queue_count += queue_count as usize;
         }
         assert!(total_queue_count <= TOTAL_QUEUE_COUNT);
+        let worker_pool = Arc::new(WorkerPool::with_default_worker_count());
         let mut queues = Vec::new();
         for queue_count in queue_counts {
             let mut queue_family_queues = Vec::new();
             for _queue_index in 0..queue_count {
-                queue_family_queues.push(OwnedHandle::<api::VkQueue>::new(Queue {}));
+                queue_family_queues.push(OwnedHandle::<api::VkQueue>::new(Queue::new(
+                    worker_pool.clone(),
+                )));
             }
             queues.push(queue_family_queues);
         }
@@ -1467,6 +1533,13 @@ impl Device {
             extensions: enabled_extensions,
             features: selected_features,
             queues,
+            worker_pool,
+            suballocator: Arc::new(Suballocator::new()),
+            background_compiler: if background_compiler::is_tiered_compilation_enabled() {
+                Some(BackgroundCompiler::new())
+            } else {
+                None
+            },
         }))
     }
 }
@@ -1483,12 +1556,21 @@ pub struct PhysicalDevice {
     maintenance_3_properties: api::VkPhysicalDeviceMaintenance3Properties,
     protected_memory_properties: api::VkPhysicalDeviceProtectedMemoryProperties,
     subgroup_properties: api::VkPhysicalDeviceSubgroupProperties,
+    push_descriptor_properties: api::VkPhysicalDevicePushDescriptorPropertiesKHR,
+    timeline_semaphore_properties: api::VkPhysicalDeviceTimelineSemaphorePropertiesKHR,
 }
 
 impl PhysicalDevice {
     pub fn get_pipeline_cache_uuid() -> uuid::Uuid {
-        // FIXME: return real uuid
-        uuid::Uuid::nil()
+        uuid::Uuid::new_v5(
+            &uuid::Uuid::NAMESPACE_OID,
+            format!(
+                "kazan pipeline cache {} format {}",
+                env!("CARGO_PKG_VERSION"),
+                pipeline_cache::PIPELINE_CACHE_FORMAT_VERSION
+            )
+            .as_bytes(),
+        )
     }
     pub fn get_device_uuid() -> uuid::Uuid {
         // FIXME: return real uuid
@@ -1556,7 +1638,7 @@ impl PhysicalDevice {
             maxComputeWorkGroupCount: [!0; 3],
             maxComputeWorkGroupInvocations: !0,
             maxComputeWorkGroupSize: [!0; 3],
-            subPixelPrecisionBits: 4, // FIXME: update to correct value
+            subPixelPrecisionBits: 8, // the rasterizer snaps to 1/256 pixel
             subTexelPrecisionBits: 4, // FIXME: update to correct value
             mipmapPrecisionBits: 4,   // FIXME: update to correct value
             maxDrawIndexedIndexValue: !0,
@@ -1595,8 +1677,8 @@ impl PhysicalDevice {
                 | api::VK_SAMPLE_COUNT_4_BIT, // FIXME: update to correct value
             storageImageSampleCounts: api::VK_SAMPLE_COUNT_1_BIT, // FIXME: update to correct value
             maxSampleMaskWords: 1,
-            timestampComputeAndGraphics: api::VK_FALSE,
-            timestampPeriod: 0.0,
+            timestampComputeAndGraphics: api::VK_TRUE,
+            timestampPeriod: timestamp::get_period(),
             maxClipDistances: 0,
             maxCullDistances: 0,
             maxCombinedClipAndCullDistances: 0,
@@ -3001,7 +3083,7 @@ impl Instance {
                         env!("CARGO_PKG_VERSION_PATCH").parse().unwrap(),
                     ),
                     vendorID: api::VK_VENDOR_ID_KAZAN,
-                    deviceID: 1,
+                    deviceID: KAZAN_DEVICE_ID,
                     deviceType: api::VK_PHYSICAL_DEVICE_TYPE_CPU,
                     deviceName: device_name,
                     pipelineCacheUUID: *PhysicalDevice::get_pipeline_cache_uuid().as_bytes(),
@@ -3057,6 +3139,18 @@ impl Instance {
                     supportedOperations: api::VK_SUBGROUP_FEATURE_BASIC_BIT,
                     quadOperationsInAllStages: api::VK_FALSE,
                 },
+                push_descriptor_properties: api::VkPhysicalDevicePushDescriptorPropertiesKHR {
+                    sType: api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR,
+                    pNext: null_mut(),
+                    maxPushDescriptors: !0,
+                },
+                timeline_semaphore_properties:
+                    api::VkPhysicalDeviceTimelineSemaphorePropertiesKHR {
+                        sType:
+                            api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES_KHR,
+                        pNext: null_mut(),
+                        maxTimelineSemaphoreValueDifference: !0,
+                    },
             }),
         });
         Ok(retval.take())
@@ -3173,6 +3267,9 @@ pub unsafe extern "system" fn vkDestroyInstance(
     _allocator: *const api::VkAllocationCallbacks,
 ) {
     OwnedHandle::from(instance);
+    if let Err(error) = kazan_trace::write_trace() {
+        eprintln!("kazan: writing the trace failed: {}", error);
+    }
 }
 
 #[allow(non_snake_case)]
@@ -3255,7 +3352,7 @@ unsafe fn get_physical_device_queue_family_properties(
             | api::VK_QUEUE_COMPUTE_BIT
             | api::VK_QUEUE_TRANSFER_BIT,
         queueCount: queue_count,
-        timestampValidBits: 0,
+        timestampValidBits: 64,
         minImageTransferGranularity: api::VkExtent3D {
             width: 1,
             height: 1,
@@ -3412,27 +3509,130 @@ pub unsafe extern "system" fn vkGetDeviceQueue(
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkQueueSubmit(
-    _queue: api::VkQueue,
-    _submitCount: u32,
-    _pSubmits: *const api::VkSubmitInfo,
-    _fence: api::VkFence,
+    queue: api::VkQueue,
+    submit_count: u32,
+    submits: *const api::VkSubmitInfo,
+    fence: api::VkFence,
 ) -> api::VkResult {
-    unimplemented!()
+    let queue = SharedHandle::from(queue).unwrap();
+    let submits = util::to_slice(submits, submit_count as usize);
+    let mut submissions = Vec::with_capacity(submits.len());
+    for submit in submits {
+        parse_next_chain_const! {
+            submit,
+            root = api::VK_STRUCTURE_TYPE_SUBMIT_INFO,
+            device_group_submit_info: api::VkDeviceGroupSubmitInfo = api::VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO,
+            protected_submit_info: api::VkProtectedSubmitInfo = api::VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO,
+            timeline_semaphore_submit_info: api::VkTimelineSemaphoreSubmitInfoKHR = api::VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR,
+        }
+        if !device_group_submit_info.is_null() {
+            let device_group_submit_info = &*device_group_submit_info;
+            for &device_mask in util::to_slice(
+                device_group_submit_info.pCommandBufferDeviceMasks,
+                device_group_submit_info.commandBufferCount as usize,
+            ) {
+                assert_eq!(device_mask, 1);
+            }
+        }
+        if !protected_submit_info.is_null() {
+            assert_eq!((*protected_submit_info).protectedSubmit, api::VK_FALSE);
+        }
+        let api::VkSubmitInfo {
+            sType: _,
+            pNext: _,
+            waitSemaphoreCount: wait_semaphore_count,
+            pWaitSemaphores: wait_semaphores,
+            pWaitDstStageMask: _,
+            commandBufferCount: command_buffer_count,
+            pCommandBuffers: command_buffers,
+            signalSemaphoreCount: signal_semaphore_count,
+            pSignalSemaphores: signal_semaphores,
+        } = *submit;
+        // the values are only used for timeline semaphores, so binary semaphores get 0
+        let (wait_semaphore_values, signal_semaphore_values) =
+            if timeline_semaphore_submit_info.is_null() {
+                (&[][..], &[][..])
+            } else {
+                let timeline_semaphore_submit_info = &*timeline_semaphore_submit_info;
+                (
+                    util::to_slice(
+                        timeline_semaphore_submit_info.pWaitSemaphoreValues,
+                        timeline_semaphore_submit_info.waitSemaphoreValueCount as usize,
+                    ),
+                    util::to_slice(
+                        timeline_semaphore_submit_info.pSignalSemaphoreValues,
+                        timeline_semaphore_submit_info.signalSemaphoreValueCount as usize,
+                    ),
+                )
+            };
+        let get_semaphores = |semaphores: &[api::VkSemaphore], values: &[u64]| -> Vec<_> {
+            semaphores
+                .iter()
+                .enumerate()
+                .map(|(index, &semaphore)| {
+                    (
+                        SharedHandle::from(semaphore).unwrap(),
+                        values.get(index).copied().unwrap_or(0),
+                    )
+                })
+                .collect()
+        };
+        submissions.push(Submission {
+            wait_semaphores: get_semaphores(
+                util::to_slice(wait_semaphores, wait_semaphore_count as usize),
+                wait_semaphore_values,
+            ),
+            command_buffers: util::to_slice(command_buffers, command_buffer_count as usize)
+                .iter()
+                .map(|&command_buffer| SharedHandle::from(command_buffer).unwrap())
+                .collect(),
+            signal_semaphores: get_semaphores(
+                util::to_slice(signal_semaphores, signal_semaphore_count as usize),
+                signal_semaphore_values,
+            ),
+            ..Default::default()
+        });
+    }
+    let fence = SharedHandle::from(fence);
+    if fence.is_some() {
+        // the fence is signaled after everything submitted before it, and submissions complete
+        // in order, so it only needs to go on the last one
+        match submissions.last_mut() {
+            Some(submission) => submission.fence = fence,
+            None => submissions.push(Submission {
+                fence,
+                ..Default::default()
+            }),
+        }
+    }
+    match queue.submit(submissions) {
+        Ok(()) => api::VK_SUCCESS,
+        Err(error) => error,
+    }
 }
 
 #[allow(non_snake_case)]
-pub unsafe extern "system" fn vkQueueWaitIdle(_queue: api::VkQueue) -> api::VkResult {
-    unimplemented!()
+pub unsafe extern "system" fn vkQueueWaitIdle(queue: api::VkQueue) -> api::VkResult {
+    match SharedHandle::from(queue).unwrap().wait_idle() {
+        Ok(()) => api::VK_SUCCESS,
+        Err(error) => error,
+    }
 }
 
 #[allow(non_snake_case)]
-pub unsafe extern "system" fn vkDeviceWaitIdle(_device: api::VkDevice) -> api::VkResult {
-    unimplemented!()
+pub unsafe extern "system" fn vkDeviceWaitIdle(device: api::VkDevice) -> api::VkResult {
+    let device = SharedHandle::from(device).unwrap();
+    for queue in device.queues.iter().flatten() {
+        if let Err(error) = queue.wait_idle() {
+            return error;
+        }
+    }
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkAllocateMemory(
-    _device: api::VkDevice,
+    device: api::VkDevice,
     allocate_info: *const api::VkMemoryAllocateInfo,
     _allocator: *const api::VkAllocationCallbacks,
     memory: *mut api::VkDeviceMemory,
@@ -3454,22 +3654,23 @@ pub unsafe extern "system" fn vkAllocateMemory(
     if !memory_dedicated_allocate_info.is_null() {
         unimplemented!()
     }
-    match DeviceMemoryType::from_index(allocate_info.memoryTypeIndex).unwrap() {
-        DeviceMemoryType::Main => {
-            if allocate_info.allocationSize > isize::max_value() as u64 {
-                return api::VK_ERROR_OUT_OF_DEVICE_MEMORY;
-            }
-            match DeviceMemory::allocate_from_default_heap(DeviceMemoryLayout::calculate(
-                allocate_info.allocationSize as usize,
-                MIN_MEMORY_MAP_ALIGNMENT,
-            )) {
-                Ok(new_memory) => {
-                    *memory = OwnedHandle::<api::VkDeviceMemory>::new(new_memory).take();
-                    api::VK_SUCCESS
-                }
-                Err(_) => api::VK_ERROR_OUT_OF_DEVICE_MEMORY,
-            }
+    let memory_type = DeviceMemoryType::from_index(allocate_info.memoryTypeIndex).unwrap();
+    if allocate_info.allocationSize > isize::max_value() as u64 {
+        return api::VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+    match DeviceMemory::allocate(
+        &SharedHandle::from(device).unwrap().suballocator,
+        memory_type,
+        DeviceMemoryLayout::calculate(
+            allocate_info.allocationSize as usize,
+            MIN_MEMORY_MAP_ALIGNMENT,
+        ),
+    ) {
+        Ok(new_memory) => {
+            *memory = OwnedHandle::<api::VkDeviceMemory>::new(new_memory).take();
+            api::VK_SUCCESS
         }
+        Err(_) => api::VK_ERROR_OUT_OF_DEVICE_MEMORY,
     }
 }
 
@@ -3494,6 +3695,7 @@ pub unsafe extern "system" fn vkMapMemory(
     data: *mut *mut c_void,
 ) -> api::VkResult {
     let memory = SharedHandle::from(memory).unwrap();
+    assert!(memory.memory_type().is_host_visible());
     // remember to keep vkUnmapMemory up to date
     *data = memory.get().as_ptr().offset(offset as isize) as *mut c_void;
     api::VK_SUCCESS
@@ -3523,10 +3725,11 @@ pub unsafe extern "system" fn vkInvalidateMappedMemoryRanges(
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkGetDeviceMemoryCommitment(
     _device: api::VkDevice,
-    _memory: api::VkDeviceMemory,
-    _pCommittedMemoryInBytes: *mut api::VkDeviceSize,
+    memory: api::VkDeviceMemory,
+    committed_memory_in_bytes: *mut api::VkDeviceSize,
 ) {
-    unimplemented!()
+    let memory = SharedHandle::from(memory).unwrap();
+    *committed_memory_in_bytes = memory.committed_size() as api::VkDeviceSize;
 }
 
 #[allow(non_snake_case)]
@@ -3652,143 +3855,215 @@ pub unsafe extern "system" fn vkQueueBindSparse(
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCreateFence(
     _device: api::VkDevice,
-    _pCreateInfo: *const api::VkFenceCreateInfo,
-    _pAllocator: *const api::VkAllocationCallbacks,
-    _pFence: *mut api::VkFence,
+    create_info: *const api::VkFenceCreateInfo,
+    _allocator: *const api::VkAllocationCallbacks,
+    fence: *mut api::VkFence,
 ) -> api::VkResult {
-    unimplemented!()
+    parse_next_chain_const! {
+        create_info,
+        root = api::VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+    }
+    let create_info = &*create_info;
+    *fence = OwnedHandle::<api::VkFence>::new(Fence::new(
+        create_info.flags & api::VK_FENCE_CREATE_SIGNALED_BIT != 0,
+    ))
+    .take();
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkDestroyFence(
     _device: api::VkDevice,
-    _fence: api::VkFence,
-    _pAllocator: *const api::VkAllocationCallbacks,
+    fence: api::VkFence,
+    _allocator: *const api::VkAllocationCallbacks,
 ) {
-    unimplemented!()
+    OwnedHandle::from(fence);
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkResetFences(
     _device: api::VkDevice,
-    _fenceCount: u32,
-    _pFences: *const api::VkFence,
+    fence_count: u32,
+    fences: *const api::VkFence,
 ) -> api::VkResult {
-    unimplemented!()
+    for &fence in util::to_slice(fences, fence_count as usize) {
+        SharedHandle::from(fence).unwrap().reset();
+    }
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkGetFenceStatus(
     _device: api::VkDevice,
-    _fence: api::VkFence,
+    fence: api::VkFence,
 ) -> api::VkResult {
-    unimplemented!()
+    if SharedHandle::from(fence).unwrap().is_signaled() {
+        api::VK_SUCCESS
+    } else {
+        api::VK_NOT_READY
+    }
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkWaitForFences(
     _device: api::VkDevice,
-    _fenceCount: u32,
-    _pFences: *const api::VkFence,
-    _waitAll: api::VkBool32,
-    _timeout: u64,
+    fence_count: u32,
+    fences: *const api::VkFence,
+    wait_all: api::VkBool32,
+    timeout: u64,
 ) -> api::VkResult {
-    unimplemented!()
+    let deadline = sync::get_deadline(timeout);
+    let fences: Vec<_> = util::to_slice(fences, fence_count as usize)
+        .iter()
+        .map(|&fence| SharedHandle::from(fence).unwrap())
+        .collect();
+    let signaled = if wait_all != api::VK_FALSE {
+        fences.iter().all(|fence| fence.wait(deadline))
+    } else {
+        sync::wait_for_any(deadline, || fences.iter().any(|fence| fence.is_signaled()))
+    };
+    if signaled {
+        api::VK_SUCCESS
+    } else {
+        api::VK_TIMEOUT
+    }
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCreateSemaphore(
     _device: api::VkDevice,
-    _pCreateInfo: *const api::VkSemaphoreCreateInfo,
-    _pAllocator: *const api::VkAllocationCallbacks,
-    _pSemaphore: *mut api::VkSemaphore,
+    create_info: *const api::VkSemaphoreCreateInfo,
+    _allocator: *const api::VkAllocationCallbacks,
+    semaphore: *mut api::VkSemaphore,
 ) -> api::VkResult {
-    unimplemented!()
+    parse_next_chain_const! {
+        create_info,
+        root = api::VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+        semaphore_type_create_info: api::VkSemaphoreTypeCreateInfoKHR = api::VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR,
+    }
+    let (semaphore_type, initial_value) = if semaphore_type_create_info.is_null() {
+        (api::VK_SEMAPHORE_TYPE_BINARY_KHR, 0)
+    } else {
+        let semaphore_type_create_info = &*semaphore_type_create_info;
+        (
+            semaphore_type_create_info.semaphoreType,
+            semaphore_type_create_info.initialValue,
+        )
+    };
+    *semaphore =
+        OwnedHandle::<api::VkSemaphore>::new(Semaphore::new(semaphore_type, initial_value)).take();
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkDestroySemaphore(
     _device: api::VkDevice,
-    _semaphore: api::VkSemaphore,
-    _pAllocator: *const api::VkAllocationCallbacks,
+    semaphore: api::VkSemaphore,
+    _allocator: *const api::VkAllocationCallbacks,
 ) {
-    unimplemented!()
+    OwnedHandle::from(semaphore);
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCreateEvent(
     _device: api::VkDevice,
-    _pCreateInfo: *const api::VkEventCreateInfo,
-    _pAllocator: *const api::VkAllocationCallbacks,
-    _pEvent: *mut api::VkEvent,
+    create_info: *const api::VkEventCreateInfo,
+    _allocator: *const api::VkAllocationCallbacks,
+    event: *mut api::VkEvent,
 ) -> api::VkResult {
-    unimplemented!()
+    parse_next_chain_const! {
+        create_info,
+        root = api::VK_STRUCTURE_TYPE_EVENT_CREATE_INFO,
+    }
+    *event = OwnedHandle::<api::VkEvent>::new(Event::new()).take();
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkDestroyEvent(
     _device: api::VkDevice,
-    _event: api::VkEvent,
-    _pAllocator: *const api::VkAllocationCallbacks,
+    event: api::VkEvent,
+    _allocator: *const api::VkAllocationCallbacks,
 ) {
-    unimplemented!()
+    OwnedHandle::from(event);
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkGetEventStatus(
     _device: api::VkDevice,
-    _event: api::VkEvent,
+    event: api::VkEvent,
 ) -> api::VkResult {
-    unimplemented!()
+    if SharedHandle::from(event).unwrap().is_set() {
+        api::VK_EVENT_SET
+    } else {
+        api::VK_EVENT_RESET
+    }
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkSetEvent(
     _device: api::VkDevice,
-    _event: api::VkEvent,
+    event: api::VkEvent,
 ) -> api::VkResult {
-    unimplemented!()
+    SharedHandle::from(event).unwrap().set();
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkResetEvent(
     _device: api::VkDevice,
-    _event: api::VkEvent,
+    event: api::VkEvent,
 ) -> api::VkResult {
-    unimplemented!()
+    SharedHandle::from(event).unwrap().reset();
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCreateQueryPool(
     _device: api::VkDevice,
-    _pCreateInfo: *const api::VkQueryPoolCreateInfo,
-    _pAllocator: *const api::VkAllocationCallbacks,
-    _pQueryPool: *mut api::VkQueryPool,
+    create_info: *const api::VkQueryPoolCreateInfo,
+    _allocator: *const api::VkAllocationCallbacks,
+    query_pool: *mut api::VkQueryPool,
 ) -> api::VkResult {
-    unimplemented!()
+    parse_next_chain_const! {
+        create_info,
+        root = api::VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+    }
+    *query_pool = OwnedHandle::<api::VkQueryPool>::new(QueryPool::new(&*create_info)).take();
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkDestroyQueryPool(
     _device: api::VkDevice,
-    _queryPool: api::VkQueryPool,
-    _pAllocator: *const api::VkAllocationCallbacks,
+    query_pool: api::VkQueryPool,
+    _allocator: *const api::VkAllocationCallbacks,
 ) {
-    unimplemented!()
+    OwnedHandle::from(query_pool);
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkGetQueryPoolResults(
     _device: api::VkDevice,
-    _queryPool: api::VkQueryPool,
-    _firstQuery: u32,
-    _queryCount: u32,
-    _dataSize: usize,
-    _pData: *mut c_void,
-    _stride: api::VkDeviceSize,
-    _flags: api::VkQueryResultFlags,
+    query_pool: api::VkQueryPool,
+    first_query: u32,
+    query_count: u32,
+    _data_size: usize,
+    data: *mut c_void,
+    stride: api::VkDeviceSize,
+    flags: api::VkQueryResultFlags,
 ) -> api::VkResult {
-    unimplemented!()
+    let all_available = SharedHandle::from(query_pool).unwrap().get_results(
+        first_query..first_query + query_count,
+        data as *mut u8,
+        stride as usize,
+        flags,
+    );
+    if all_available {
+        api::VK_SUCCESS
+    } else {
+        api::VK_NOT_READY
+    }
 }
 
 #[allow(non_snake_case)]
@@ -3885,6 +4160,7 @@ pub unsafe extern "system" fn vkCreateImage(
             },
             swapchain_present_tiling: None,
         },
+        usage: create_info.usage,
         memory: None,
     })
     .take();
@@ -3903,11 +4179,29 @@ pub unsafe extern "system" fn vkDestroyImage(
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkGetImageSubresourceLayout(
     _device: api::VkDevice,
-    _image: api::VkImage,
-    _pSubresource: *const api::VkImageSubresource,
-    _pLayout: *mut api::VkSubresourceLayout,
-) {
-    unimplemented!()
+    image: api::VkImage,
+    subresource: *const api::VkImageSubresource,
+    layout: *mut api::VkSubresourceLayout,
+) {
+    let image = SharedHandle::from(image).unwrap();
+    let subresource = &*subresource;
+    assert_eq!(
+        image.properties.supported_tilings,
+        SupportedTilings::LinearOnly
+    );
+    assert_eq!(subresource.aspectMask, api::VK_IMAGE_ASPECT_COLOR_BIT);
+    let subresource_layout = image.properties.get_subresource_layout(
+        Tiling::Linear,
+        subresource.mipLevel,
+        subresource.arrayLayer,
+    );
+    *layout = api::VkSubresourceLayout {
+        offset: subresource_layout.offset as api::VkDeviceSize,
+        size: subresource_layout.size as api::VkDeviceSize,
+        rowPitch: subresource_layout.row_pitch as api::VkDeviceSize,
+        arrayPitch: subresource_layout.array_pitch as api::VkDeviceSize,
+        depthPitch: subresource_layout.depth_pitch as api::VkDeviceSize,
+    };
 }
 
 #[allow(non_snake_case)]
@@ -3978,40 +4272,67 @@ pub unsafe extern "system" fn vkDestroyShaderModule(
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCreatePipelineCache(
     _device: api::VkDevice,
-    _pCreateInfo: *const api::VkPipelineCacheCreateInfo,
-    _pAllocator: *const api::VkAllocationCallbacks,
-    _pPipelineCache: *mut api::VkPipelineCache,
+    create_info: *const api::VkPipelineCacheCreateInfo,
+    _allocator: *const api::VkAllocationCallbacks,
+    pipeline_cache: *mut api::VkPipelineCache,
 ) -> api::VkResult {
-    unimplemented!()
+    parse_next_chain_const! {
+        create_info,
+        root = api::VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+    }
+    let create_info = &*create_info;
+    let initial_data = util::to_slice(
+        create_info.pInitialData as *const u8,
+        create_info.initialDataSize,
+    );
+    *pipeline_cache =
+        OwnedHandle::<api::VkPipelineCache>::new(PipelineCache::new(initial_data)).take();
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkDestroyPipelineCache(
     _device: api::VkDevice,
-    _pipelineCache: api::VkPipelineCache,
-    _pAllocator: *const api::VkAllocationCallbacks,
+    pipeline_cache: api::VkPipelineCache,
+    _allocator: *const api::VkAllocationCallbacks,
 ) {
-    unimplemented!()
+    OwnedHandle::from(pipeline_cache);
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkGetPipelineCacheData(
     _device: api::VkDevice,
-    _pipelineCache: api::VkPipelineCache,
-    _pDataSize: *mut usize,
-    _pData: *mut c_void,
+    pipeline_cache: api::VkPipelineCache,
+    data_size: *mut usize,
+    data: *mut c_void,
 ) -> api::VkResult {
-    unimplemented!()
+    let pipeline_cache = SharedHandle::from(pipeline_cache).unwrap();
+    if data.is_null() {
+        *data_size = pipeline_cache.get_data(usize::max_value()).0.len();
+        return api::VK_SUCCESS;
+    }
+    let (cache_data, complete) = pipeline_cache.get_data(*data_size);
+    util::to_slice_mut(data as *mut u8, cache_data.len()).copy_from_slice(&cache_data);
+    *data_size = cache_data.len();
+    if complete {
+        api::VK_SUCCESS
+    } else {
+        api::VK_INCOMPLETE
+    }
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkMergePipelineCaches(
     _device: api::VkDevice,
-    _dstCache: api::VkPipelineCache,
-    _srcCacheCount: u32,
-    _pSrcCaches: *const api::VkPipelineCache,
+    destination_cache: api::VkPipelineCache,
+    source_cache_count: u32,
+    source_caches: *const api::VkPipelineCache,
 ) -> api::VkResult {
-    unimplemented!()
+    let destination_cache = SharedHandle::from(destination_cache).unwrap();
+    for &source_cache in util::to_slice(source_caches, source_cache_count as usize) {
+        destination_cache.merge(&SharedHandle::from(source_cache).unwrap());
+    }
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
@@ -4238,10 +4559,9 @@ pub unsafe extern "system" fn vkCreateDescriptorSetLayout(
         );
         *bindings_map_entry = Some(DescriptorLayout::from(binding));
     }
-    *set_layout = OwnedHandle::<api::VkDescriptorSetLayout>::new(DescriptorSetLayout {
-        bindings: bindings_map,
-    })
-    .take();
+    *set_layout =
+        OwnedHandle::<api::VkDescriptorSetLayout>::new(DescriptorSetLayout::new(bindings_map))
+            .take();
     api::VK_SUCCESS
 }
 
@@ -4265,7 +4585,8 @@ pub unsafe extern "system" fn vkCreateDescriptorPool(
         create_info,
         root = api::VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
     }
-    *descriptor_pool = OwnedHandle::<api::VkDescriptorPool>::new(DescriptorPool::new()).take();
+    *descriptor_pool =
+        OwnedHandle::<api::VkDescriptorPool>::new(DescriptorPool::new(&*create_info)).take();
     api::VK_SUCCESS
 }
 
@@ -4306,20 +4627,7 @@ pub unsafe extern "system" fn vkAllocateDescriptorSets(
         allocate_info.pSetLayouts,
         allocate_info.descriptorSetCount as usize,
     );
-    descriptor_pool.allocate(
-        descriptor_set_layouts
-            .iter()
-            .map(|descriptor_set_layout| DescriptorSet {
-                bindings: SharedHandle::from(*descriptor_set_layout)
-                    .unwrap()
-                    .bindings
-                    .iter()
-                    .map(|layout| layout.as_ref().map(Descriptor::from))
-                    .collect(),
-            }),
-        descriptor_sets,
-    );
-    api::VK_SUCCESS
+    descriptor_pool.allocate(descriptor_set_layouts, descriptor_sets)
 }
 
 #[allow(non_snake_case)]
@@ -4350,25 +4658,12 @@ pub unsafe extern "system" fn vkUpdateDescriptorSets(
             descriptor_write,
             root = api::VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
         }
-        let mut descriptor_set = MutHandle::from(descriptor_write.dstSet).unwrap();
-        let mut binding_index = descriptor_write.dstBinding as usize;
-        let mut elements = DescriptorWriteArg::from(descriptor_write);
-        let mut start_element = Some(descriptor_write.dstArrayElement as usize);
-        while elements.len() != 0 {
-            let binding = descriptor_set.bindings[binding_index].as_mut().unwrap();
-            binding_index += 1;
-            assert_eq!(binding.descriptor_type(), descriptor_write.descriptorType);
-            if binding.element_count() == 0 {
-                assert_eq!(start_element, None);
-                continue;
-            }
-            let start_element = start_element.take().unwrap_or(0);
-            let used_elements = elements
-                .len()
-                .min(binding.element_count().checked_sub(start_element).unwrap());
-            binding.write(start_element, elements.slice_to(..used_elements));
-            elements = elements.slice_from(used_elements..);
-        }
+        MutHandle::from(descriptor_write.dstSet).unwrap().write(
+            descriptor_write.descriptorType,
+            descriptor_write.dstBinding as usize,
+            descriptor_write.dstArrayElement as usize,
+            DescriptorWriteArg::from(descriptor_write),
+        );
     }
     for descriptor_copy in descriptor_copies {
         parse_next_chain_const! {
@@ -4382,20 +4677,25 @@ pub unsafe extern "system" fn vkUpdateDescriptorSets(
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCreateFramebuffer(
     _device: api::VkDevice,
-    _pCreateInfo: *const api::VkFramebufferCreateInfo,
-    _pAllocator: *const api::VkAllocationCallbacks,
-    _pFramebuffer: *mut api::VkFramebuffer,
+    create_info: *const api::VkFramebufferCreateInfo,
+    _allocator: *const api::VkAllocationCallbacks,
+    framebuffer: *mut api::VkFramebuffer,
 ) -> api::VkResult {
-    unimplemented!()
+    parse_next_chain_const! {
+        create_info,
+        root = api::VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
+    }
+    *framebuffer = OwnedHandle::<api::VkFramebuffer>::new(Framebuffer::new(&*create_info)).take();
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkDestroyFramebuffer(
     _device: api::VkDevice,
-    _framebuffer: api::VkFramebuffer,
-    _pAllocator: *const api::VkAllocationCallbacks,
+    framebuffer: api::VkFramebuffer,
+    _allocator: *const api::VkAllocationCallbacks,
 ) {
-    unimplemented!()
+    OwnedHandle::from(framebuffer);
 }
 
 #[allow(non_snake_case)]
@@ -4409,8 +4709,7 @@ pub unsafe extern "system" fn vkCreateRenderPass(
         create_info,
         root = api::VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
     }
-    // FIXME: finish implementing
-    *render_pass = OwnedHandle::<api::VkRenderPass>::new(RenderPass {}).take();
+    *render_pass = OwnedHandle::<api::VkRenderPass>::new(RenderPass::new(&*create_info)).take();
     api::VK_SUCCESS
 }
 
@@ -4426,549 +4725,903 @@ pub unsafe extern "system" fn vkDestroyRenderPass(
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkGetRenderAreaGranularity(
     _device: api::VkDevice,
-    _renderPass: api::VkRenderPass,
-    _pGranularity: *mut api::VkExtent2D,
-) {
-    unimplemented!()
+    _render_pass: api::VkRenderPass,
+    granularity: *mut api::VkExtent2D,
+) {
+    // tiles that are partly outside the render area are masked, so any render area is as fast
+    // as one aligned to the tiles
+    *granularity = api::VkExtent2D {
+        width: 1,
+        height: 1,
+    };
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCreateCommandPool(
     _device: api::VkDevice,
-    _pCreateInfo: *const api::VkCommandPoolCreateInfo,
-    _pAllocator: *const api::VkAllocationCallbacks,
-    _pCommandPool: *mut api::VkCommandPool,
+    create_info: *const api::VkCommandPoolCreateInfo,
+    _allocator: *const api::VkAllocationCallbacks,
+    command_pool: *mut api::VkCommandPool,
 ) -> api::VkResult {
-    unimplemented!()
+    parse_next_chain_const! {
+        create_info,
+        root = api::VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+    }
+    let create_info = &*create_info;
+    *command_pool = OwnedHandle::<api::VkCommandPool>::new(CommandPool::new(
+        create_info.flags,
+        create_info.queueFamilyIndex,
+    ))
+    .take();
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkDestroyCommandPool(
     _device: api::VkDevice,
-    _commandPool: api::VkCommandPool,
-    _pAllocator: *const api::VkAllocationCallbacks,
+    command_pool: api::VkCommandPool,
+    _allocator: *const api::VkAllocationCallbacks,
 ) {
-    unimplemented!()
+    OwnedHandle::from(command_pool);
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkResetCommandPool(
     _device: api::VkDevice,
-    _commandPool: api::VkCommandPool,
-    _flags: api::VkCommandPoolResetFlags,
+    command_pool: api::VkCommandPool,
+    flags: api::VkCommandPoolResetFlags,
 ) -> api::VkResult {
-    unimplemented!()
+    MutHandle::from(command_pool)
+        .unwrap()
+        .reset(flags & api::VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT != 0);
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkAllocateCommandBuffers(
     _device: api::VkDevice,
-    _pAllocateInfo: *const api::VkCommandBufferAllocateInfo,
-    _pCommandBuffers: *mut api::VkCommandBuffer,
+    allocate_info: *const api::VkCommandBufferAllocateInfo,
+    command_buffers: *mut api::VkCommandBuffer,
 ) -> api::VkResult {
-    unimplemented!()
+    parse_next_chain_const! {
+        allocate_info,
+        root = api::VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+    }
+    let allocate_info = &*allocate_info;
+    let command_buffers =
+        util::to_slice_mut(command_buffers, allocate_info.commandBufferCount as usize);
+    MutHandle::from(allocate_info.commandPool)
+        .unwrap()
+        .allocate(
+            SharedHandle::from(allocate_info.commandPool).unwrap(),
+            allocate_info.level,
+            command_buffers,
+        );
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkFreeCommandBuffers(
     _device: api::VkDevice,
-    _commandPool: api::VkCommandPool,
-    _commandBufferCount: u32,
-    _pCommandBuffers: *const api::VkCommandBuffer,
+    command_pool: api::VkCommandPool,
+    command_buffer_count: u32,
+    command_buffers: *const api::VkCommandBuffer,
 ) {
-    unimplemented!()
+    let command_buffers = util::to_slice(command_buffers, command_buffer_count as usize);
+    MutHandle::from(command_pool).unwrap().free(command_buffers);
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkBeginCommandBuffer(
-    _commandBuffer: api::VkCommandBuffer,
-    _pBeginInfo: *const api::VkCommandBufferBeginInfo,
+    command_buffer: api::VkCommandBuffer,
+    begin_info: *const api::VkCommandBufferBeginInfo,
 ) -> api::VkResult {
-    unimplemented!()
+    parse_next_chain_const! {
+        begin_info,
+        root = api::VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        device_group_begin_info: api::VkDeviceGroupCommandBufferBeginInfo = api::VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO,
+    }
+    if !device_group_begin_info.is_null() {
+        assert_eq!((*device_group_begin_info).deviceMask, 1);
+    }
+    let mut command_buffer = MutHandle::from(command_buffer).unwrap();
+    if command_buffer.level() == api::VK_COMMAND_BUFFER_LEVEL_SECONDARY {
+        let inheritance_info = (*begin_info).pInheritanceInfo;
+        parse_next_chain_const! {
+            inheritance_info,
+            root = api::VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+        }
+    }
+    command_buffer.begin();
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkEndCommandBuffer(
-    _commandBuffer: api::VkCommandBuffer,
+    command_buffer: api::VkCommandBuffer,
 ) -> api::VkResult {
-    unimplemented!()
+    MutHandle::from(command_buffer).unwrap().end();
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkResetCommandBuffer(
-    _commandBuffer: api::VkCommandBuffer,
-    _flags: api::VkCommandBufferResetFlags,
+    command_buffer: api::VkCommandBuffer,
+    flags: api::VkCommandBufferResetFlags,
 ) -> api::VkResult {
-    unimplemented!()
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .reset(flags & api::VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT != 0);
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdBindPipeline(
-    _commandBuffer: api::VkCommandBuffer,
-    _pipelineBindPoint: api::VkPipelineBindPoint,
-    _pipeline: api::VkPipeline,
+    command_buffer: api::VkCommandBuffer,
+    pipeline_bind_point: api::VkPipelineBindPoint,
+    pipeline: api::VkPipeline,
 ) {
-    unimplemented!()
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::BindPipeline {
+            pipeline_bind_point,
+            pipeline: SharedHandle::from(pipeline).unwrap(),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdSetViewport(
-    _commandBuffer: api::VkCommandBuffer,
-    _firstViewport: u32,
-    _viewportCount: u32,
-    _pViewports: *const api::VkViewport,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    first_viewport: u32,
+    viewport_count: u32,
+    viewports: *const api::VkViewport,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::SetViewport {
+            first_viewport,
+            viewports: util::to_slice(viewports, viewport_count as usize),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdSetScissor(
-    _commandBuffer: api::VkCommandBuffer,
-    _firstScissor: u32,
-    _scissorCount: u32,
-    _pScissors: *const api::VkRect2D,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    first_scissor: u32,
+    scissor_count: u32,
+    scissors: *const api::VkRect2D,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::SetScissor {
+            first_scissor,
+            scissors: util::to_slice(scissors, scissor_count as usize),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdSetLineWidth(
-    _commandBuffer: api::VkCommandBuffer,
-    _lineWidth: f32,
+    command_buffer: api::VkCommandBuffer,
+    line_width: f32,
 ) {
-    unimplemented!()
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::SetLineWidth { line_width });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdSetDepthBias(
-    _commandBuffer: api::VkCommandBuffer,
-    _depthBiasConstantFactor: f32,
-    _depthBiasClamp: f32,
-    _depthBiasSlopeFactor: f32,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    depth_bias_constant_factor: f32,
+    depth_bias_clamp: f32,
+    depth_bias_slope_factor: f32,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::SetDepthBias {
+            depth_bias_constant_factor,
+            depth_bias_clamp,
+            depth_bias_slope_factor,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdSetBlendConstants(
-    _commandBuffer: api::VkCommandBuffer,
-    _blendConstants: *const f32,
+    command_buffer: api::VkCommandBuffer,
+    blend_constants: *const f32,
 ) {
-    unimplemented!()
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::SetBlendConstants {
+            blend_constants: *(blend_constants as *const [f32; 4]),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdSetDepthBounds(
-    _commandBuffer: api::VkCommandBuffer,
-    _minDepthBounds: f32,
-    _maxDepthBounds: f32,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    min_depth_bounds: f32,
+    max_depth_bounds: f32,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::SetDepthBounds {
+            min_depth_bounds,
+            max_depth_bounds,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdSetStencilCompareMask(
-    _commandBuffer: api::VkCommandBuffer,
-    _faceMask: api::VkStencilFaceFlags,
-    _compareMask: u32,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    face_mask: api::VkStencilFaceFlags,
+    compare_mask: u32,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::SetStencilCompareMask {
+            face_mask,
+            compare_mask,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdSetStencilWriteMask(
-    _commandBuffer: api::VkCommandBuffer,
-    _faceMask: api::VkStencilFaceFlags,
-    _writeMask: u32,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    face_mask: api::VkStencilFaceFlags,
+    write_mask: u32,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::SetStencilWriteMask {
+            face_mask,
+            write_mask,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdSetStencilReference(
-    _commandBuffer: api::VkCommandBuffer,
-    _faceMask: api::VkStencilFaceFlags,
-    _reference: u32,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    face_mask: api::VkStencilFaceFlags,
+    reference: u32,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::SetStencilReference {
+            face_mask,
+            reference,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdBindDescriptorSets(
-    _commandBuffer: api::VkCommandBuffer,
-    _pipelineBindPoint: api::VkPipelineBindPoint,
-    _layout: api::VkPipelineLayout,
-    _firstSet: u32,
-    _descriptorSetCount: u32,
-    _pDescriptorSets: *const api::VkDescriptorSet,
-    _dynamicOffsetCount: u32,
-    _pDynamicOffsets: *const u32,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    pipeline_bind_point: api::VkPipelineBindPoint,
+    layout: api::VkPipelineLayout,
+    first_set: u32,
+    descriptor_set_count: u32,
+    descriptor_sets: *const api::VkDescriptorSet,
+    dynamic_offset_count: u32,
+    dynamic_offsets: *const u32,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::BindDescriptorSets {
+            pipeline_bind_point,
+            layout: SharedHandle::from(layout).unwrap(),
+            first_set,
+            descriptor_sets: util::to_slice(descriptor_sets, descriptor_set_count as usize),
+            dynamic_offsets: util::to_slice(dynamic_offsets, dynamic_offset_count as usize),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdBindIndexBuffer(
-    _commandBuffer: api::VkCommandBuffer,
-    _buffer: api::VkBuffer,
-    _offset: api::VkDeviceSize,
-    _indexType: api::VkIndexType,
+    command_buffer: api::VkCommandBuffer,
+    buffer: api::VkBuffer,
+    offset: api::VkDeviceSize,
+    index_type: api::VkIndexType,
 ) {
-    unimplemented!()
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::BindIndexBuffer {
+            buffer: SharedHandle::from(buffer).unwrap(),
+            offset,
+            index_type,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdBindVertexBuffers(
-    _commandBuffer: api::VkCommandBuffer,
-    _firstBinding: u32,
-    _bindingCount: u32,
-    _pBuffers: *const api::VkBuffer,
-    _pOffsets: *const api::VkDeviceSize,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    first_binding: u32,
+    binding_count: u32,
+    buffers: *const api::VkBuffer,
+    offsets: *const api::VkDeviceSize,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::BindVertexBuffers {
+            first_binding,
+            buffers: util::to_slice(buffers, binding_count as usize),
+            offsets: util::to_slice(offsets, binding_count as usize),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdDraw(
-    _commandBuffer: api::VkCommandBuffer,
-    _vertexCount: u32,
-    _instanceCount: u32,
-    _firstVertex: u32,
-    _firstInstance: u32,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    vertex_count: u32,
+    instance_count: u32,
+    first_vertex: u32,
+    first_instance: u32,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::Draw {
+            vertex_count,
+            instance_count,
+            first_vertex,
+            first_instance,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdDrawIndexed(
-    _commandBuffer: api::VkCommandBuffer,
-    _indexCount: u32,
-    _instanceCount: u32,
-    _firstIndex: u32,
-    _vertexOffset: i32,
-    _firstInstance: u32,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    index_count: u32,
+    instance_count: u32,
+    first_index: u32,
+    vertex_offset: i32,
+    first_instance: u32,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::DrawIndexed {
+            index_count,
+            instance_count,
+            first_index,
+            vertex_offset,
+            first_instance,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdDrawIndirect(
-    _commandBuffer: api::VkCommandBuffer,
-    _buffer: api::VkBuffer,
-    _offset: api::VkDeviceSize,
-    _drawCount: u32,
-    _stride: u32,
+    command_buffer: api::VkCommandBuffer,
+    buffer: api::VkBuffer,
+    offset: api::VkDeviceSize,
+    draw_count: u32,
+    stride: u32,
 ) {
-    unimplemented!()
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::DrawIndirect {
+            buffer: SharedHandle::from(buffer).unwrap(),
+            offset,
+            draw_count,
+            stride,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdDrawIndexedIndirect(
-    _commandBuffer: api::VkCommandBuffer,
-    _buffer: api::VkBuffer,
-    _offset: api::VkDeviceSize,
-    _drawCount: u32,
-    _stride: u32,
+    command_buffer: api::VkCommandBuffer,
+    buffer: api::VkBuffer,
+    offset: api::VkDeviceSize,
+    draw_count: u32,
+    stride: u32,
 ) {
-    unimplemented!()
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::DrawIndexedIndirect {
+            buffer: SharedHandle::from(buffer).unwrap(),
+            offset,
+            draw_count,
+            stride,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdDispatch(
-    _commandBuffer: api::VkCommandBuffer,
-    _groupCountX: u32,
-    _groupCountY: u32,
-    _groupCountZ: u32,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    group_count_x: u32,
+    group_count_y: u32,
+    group_count_z: u32,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::Dispatch {
+            base_group: [0; 3],
+            group_count: [group_count_x, group_count_y, group_count_z],
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdDispatchIndirect(
-    _commandBuffer: api::VkCommandBuffer,
-    _buffer: api::VkBuffer,
-    _offset: api::VkDeviceSize,
+    command_buffer: api::VkCommandBuffer,
+    buffer: api::VkBuffer,
+    offset: api::VkDeviceSize,
 ) {
-    unimplemented!()
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::DispatchIndirect {
+            buffer: SharedHandle::from(buffer).unwrap(),
+            offset,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdCopyBuffer(
-    _commandBuffer: api::VkCommandBuffer,
-    _srcBuffer: api::VkBuffer,
-    _dstBuffer: api::VkBuffer,
-    _regionCount: u32,
-    _pRegions: *const api::VkBufferCopy,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    src_buffer: api::VkBuffer,
+    dst_buffer: api::VkBuffer,
+    region_count: u32,
+    regions: *const api::VkBufferCopy,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::CopyBuffer {
+            src_buffer: SharedHandle::from(src_buffer).unwrap(),
+            dst_buffer: SharedHandle::from(dst_buffer).unwrap(),
+            regions: util::to_slice(regions, region_count as usize),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdCopyImage(
-    _commandBuffer: api::VkCommandBuffer,
-    _srcImage: api::VkImage,
-    _srcImageLayout: api::VkImageLayout,
-    _dstImage: api::VkImage,
-    _dstImageLayout: api::VkImageLayout,
-    _regionCount: u32,
-    _pRegions: *const api::VkImageCopy,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    src_image: api::VkImage,
+    src_image_layout: api::VkImageLayout,
+    dst_image: api::VkImage,
+    dst_image_layout: api::VkImageLayout,
+    region_count: u32,
+    regions: *const api::VkImageCopy,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::CopyImage {
+            src_image: SharedHandle::from(src_image).unwrap(),
+            src_image_layout,
+            dst_image: SharedHandle::from(dst_image).unwrap(),
+            dst_image_layout,
+            regions: util::to_slice(regions, region_count as usize),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdBlitImage(
-    _commandBuffer: api::VkCommandBuffer,
-    _srcImage: api::VkImage,
-    _srcImageLayout: api::VkImageLayout,
-    _dstImage: api::VkImage,
-    _dstImageLayout: api::VkImageLayout,
-    _regionCount: u32,
-    _pRegions: *const api::VkImageBlit,
-    _filter: api::VkFilter,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    src_image: api::VkImage,
+    src_image_layout: api::VkImageLayout,
+    dst_image: api::VkImage,
+    dst_image_layout: api::VkImageLayout,
+    region_count: u32,
+    regions: *const api::VkImageBlit,
+    filter: api::VkFilter,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::BlitImage {
+            src_image: SharedHandle::from(src_image).unwrap(),
+            src_image_layout,
+            dst_image: SharedHandle::from(dst_image).unwrap(),
+            dst_image_layout,
+            regions: util::to_slice(regions, region_count as usize),
+            filter,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdCopyBufferToImage(
-    _commandBuffer: api::VkCommandBuffer,
-    _srcBuffer: api::VkBuffer,
-    _dstImage: api::VkImage,
-    _dstImageLayout: api::VkImageLayout,
-    _regionCount: u32,
-    _pRegions: *const api::VkBufferImageCopy,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    src_buffer: api::VkBuffer,
+    dst_image: api::VkImage,
+    dst_image_layout: api::VkImageLayout,
+    region_count: u32,
+    regions: *const api::VkBufferImageCopy,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::CopyBufferToImage {
+            src_buffer: SharedHandle::from(src_buffer).unwrap(),
+            dst_image: SharedHandle::from(dst_image).unwrap(),
+            dst_image_layout,
+            regions: util::to_slice(regions, region_count as usize),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdCopyImageToBuffer(
-    _commandBuffer: api::VkCommandBuffer,
-    _srcImage: api::VkImage,
-    _srcImageLayout: api::VkImageLayout,
-    _dstBuffer: api::VkBuffer,
-    _regionCount: u32,
-    _pRegions: *const api::VkBufferImageCopy,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    src_image: api::VkImage,
+    src_image_layout: api::VkImageLayout,
+    dst_buffer: api::VkBuffer,
+    region_count: u32,
+    regions: *const api::VkBufferImageCopy,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::CopyImageToBuffer {
+            src_image: SharedHandle::from(src_image).unwrap(),
+            src_image_layout,
+            dst_buffer: SharedHandle::from(dst_buffer).unwrap(),
+            regions: util::to_slice(regions, region_count as usize),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdUpdateBuffer(
-    _commandBuffer: api::VkCommandBuffer,
-    _dstBuffer: api::VkBuffer,
-    _dstOffset: api::VkDeviceSize,
-    _dataSize: api::VkDeviceSize,
-    _pData: *const c_void,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    dst_buffer: api::VkBuffer,
+    dst_offset: api::VkDeviceSize,
+    data_size: api::VkDeviceSize,
+    data: *const c_void,
+) {
+    assert_eq!(data_size % 4, 0);
+    assert!(data_size <= 65536);
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::UpdateBuffer {
+            dst_buffer: SharedHandle::from(dst_buffer).unwrap(),
+            dst_offset,
+            data: util::to_slice(data as *const u8, data_size as usize),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdFillBuffer(
-    _commandBuffer: api::VkCommandBuffer,
-    _dstBuffer: api::VkBuffer,
-    _dstOffset: api::VkDeviceSize,
-    _size: api::VkDeviceSize,
-    _data: u32,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    dst_buffer: api::VkBuffer,
+    dst_offset: api::VkDeviceSize,
+    size: api::VkDeviceSize,
+    data: u32,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::FillBuffer {
+            dst_buffer: SharedHandle::from(dst_buffer).unwrap(),
+            dst_offset,
+            size,
+            data,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdClearColorImage(
-    _commandBuffer: api::VkCommandBuffer,
-    _image: api::VkImage,
-    _imageLayout: api::VkImageLayout,
-    _pColor: *const api::VkClearColorValue,
-    _rangeCount: u32,
-    _pRanges: *const api::VkImageSubresourceRange,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    image: api::VkImage,
+    image_layout: api::VkImageLayout,
+    color: *const api::VkClearColorValue,
+    range_count: u32,
+    ranges: *const api::VkImageSubresourceRange,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::ClearColorImage {
+            image: SharedHandle::from(image).unwrap(),
+            image_layout,
+            color: *color,
+            ranges: util::to_slice(ranges, range_count as usize),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdClearDepthStencilImage(
-    _commandBuffer: api::VkCommandBuffer,
-    _image: api::VkImage,
-    _imageLayout: api::VkImageLayout,
-    _pDepthStencil: *const api::VkClearDepthStencilValue,
-    _rangeCount: u32,
-    _pRanges: *const api::VkImageSubresourceRange,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    image: api::VkImage,
+    image_layout: api::VkImageLayout,
+    depth_stencil: *const api::VkClearDepthStencilValue,
+    range_count: u32,
+    ranges: *const api::VkImageSubresourceRange,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::ClearDepthStencilImage {
+            image: SharedHandle::from(image).unwrap(),
+            image_layout,
+            depth_stencil: *depth_stencil,
+            ranges: util::to_slice(ranges, range_count as usize),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdClearAttachments(
-    _commandBuffer: api::VkCommandBuffer,
-    _attachmentCount: u32,
-    _pAttachments: *const api::VkClearAttachment,
-    _rectCount: u32,
-    _pRects: *const api::VkClearRect,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    attachment_count: u32,
+    attachments: *const api::VkClearAttachment,
+    rect_count: u32,
+    rects: *const api::VkClearRect,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::ClearAttachments {
+            attachments: util::to_slice(attachments, attachment_count as usize),
+            rects: util::to_slice(rects, rect_count as usize),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdResolveImage(
-    _commandBuffer: api::VkCommandBuffer,
-    _srcImage: api::VkImage,
-    _srcImageLayout: api::VkImageLayout,
-    _dstImage: api::VkImage,
-    _dstImageLayout: api::VkImageLayout,
-    _regionCount: u32,
-    _pRegions: *const api::VkImageResolve,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    src_image: api::VkImage,
+    src_image_layout: api::VkImageLayout,
+    dst_image: api::VkImage,
+    dst_image_layout: api::VkImageLayout,
+    region_count: u32,
+    regions: *const api::VkImageResolve,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::ResolveImage {
+            src_image: SharedHandle::from(src_image).unwrap(),
+            src_image_layout,
+            dst_image: SharedHandle::from(dst_image).unwrap(),
+            dst_image_layout,
+            regions: util::to_slice(regions, region_count as usize),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdSetEvent(
-    _commandBuffer: api::VkCommandBuffer,
-    _event: api::VkEvent,
-    _stageMask: api::VkPipelineStageFlags,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    event: api::VkEvent,
+    stage_mask: api::VkPipelineStageFlags,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::SetEvent {
+            event: SharedHandle::from(event).unwrap(),
+            stage_mask,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdResetEvent(
-    _commandBuffer: api::VkCommandBuffer,
-    _event: api::VkEvent,
-    _stageMask: api::VkPipelineStageFlags,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    event: api::VkEvent,
+    stage_mask: api::VkPipelineStageFlags,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::ResetEvent {
+            event: SharedHandle::from(event).unwrap(),
+            stage_mask,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdWaitEvents(
-    _commandBuffer: api::VkCommandBuffer,
-    _eventCount: u32,
-    _pEvents: *const api::VkEvent,
-    _srcStageMask: api::VkPipelineStageFlags,
-    _dstStageMask: api::VkPipelineStageFlags,
-    _memoryBarrierCount: u32,
-    _pMemoryBarriers: *const api::VkMemoryBarrier,
-    _bufferMemoryBarrierCount: u32,
-    _pBufferMemoryBarriers: *const api::VkBufferMemoryBarrier,
-    _imageMemoryBarrierCount: u32,
-    _pImageMemoryBarriers: *const api::VkImageMemoryBarrier,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    event_count: u32,
+    events: *const api::VkEvent,
+    src_stage_mask: api::VkPipelineStageFlags,
+    dst_stage_mask: api::VkPipelineStageFlags,
+    memory_barrier_count: u32,
+    memory_barriers: *const api::VkMemoryBarrier,
+    buffer_memory_barrier_count: u32,
+    buffer_memory_barriers: *const api::VkBufferMemoryBarrier,
+    image_memory_barrier_count: u32,
+    image_memory_barriers: *const api::VkImageMemoryBarrier,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::WaitEvents {
+            events: util::to_slice(events, event_count as usize),
+            src_stage_mask,
+            dst_stage_mask,
+            memory_barriers: util::to_slice(memory_barriers, memory_barrier_count as usize),
+            buffer_memory_barriers: util::to_slice(
+                buffer_memory_barriers,
+                buffer_memory_barrier_count as usize,
+            ),
+            image_memory_barriers: util::to_slice(
+                image_memory_barriers,
+                image_memory_barrier_count as usize,
+            ),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdPipelineBarrier(
-    _commandBuffer: api::VkCommandBuffer,
-    _srcStageMask: api::VkPipelineStageFlags,
-    _dstStageMask: api::VkPipelineStageFlags,
-    _dependencyFlags: api::VkDependencyFlags,
-    _memoryBarrierCount: u32,
-    _pMemoryBarriers: *const api::VkMemoryBarrier,
-    _bufferMemoryBarrierCount: u32,
-    _pBufferMemoryBarriers: *const api::VkBufferMemoryBarrier,
-    _imageMemoryBarrierCount: u32,
-    _pImageMemoryBarriers: *const api::VkImageMemoryBarrier,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    src_stage_mask: api::VkPipelineStageFlags,
+    dst_stage_mask: api::VkPipelineStageFlags,
+    dependency_flags: api::VkDependencyFlags,
+    memory_barrier_count: u32,
+    memory_barriers: *const api::VkMemoryBarrier,
+    buffer_memory_barrier_count: u32,
+    buffer_memory_barriers: *const api::VkBufferMemoryBarrier,
+    image_memory_barrier_count: u32,
+    image_memory_barriers: *const api::VkImageMemoryBarrier,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::PipelineBarrier {
+            src_stage_mask,
+            dst_stage_mask,
+            dependency_flags,
+            memory_barriers: util::to_slice(memory_barriers, memory_barrier_count as usize),
+            buffer_memory_barriers: util::to_slice(
+                buffer_memory_barriers,
+                buffer_memory_barrier_count as usize,
+            ),
+            image_memory_barriers: util::to_slice(
+                image_memory_barriers,
+                image_memory_barrier_count as usize,
+            ),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdBeginQuery(
-    _commandBuffer: api::VkCommandBuffer,
-    _queryPool: api::VkQueryPool,
-    _query: u32,
-    _flags: api::VkQueryControlFlags,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    query_pool: api::VkQueryPool,
+    query: u32,
+    flags: api::VkQueryControlFlags,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::BeginQuery {
+            query_pool: SharedHandle::from(query_pool).unwrap(),
+            query,
+            flags,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdEndQuery(
-    _commandBuffer: api::VkCommandBuffer,
-    _queryPool: api::VkQueryPool,
-    _query: u32,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    query_pool: api::VkQueryPool,
+    query: u32,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::EndQuery {
+            query_pool: SharedHandle::from(query_pool).unwrap(),
+            query,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdResetQueryPool(
-    _commandBuffer: api::VkCommandBuffer,
-    _queryPool: api::VkQueryPool,
-    _firstQuery: u32,
-    _queryCount: u32,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    query_pool: api::VkQueryPool,
+    first_query: u32,
+    query_count: u32,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::ResetQueryPool {
+            query_pool: SharedHandle::from(query_pool).unwrap(),
+            first_query,
+            query_count,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdWriteTimestamp(
-    _commandBuffer: api::VkCommandBuffer,
-    _pipelineStage: api::VkPipelineStageFlagBits,
-    _queryPool: api::VkQueryPool,
-    _query: u32,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    pipeline_stage: api::VkPipelineStageFlagBits,
+    query_pool: api::VkQueryPool,
+    query: u32,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::WriteTimestamp {
+            pipeline_stage,
+            query_pool: SharedHandle::from(query_pool).unwrap(),
+            query,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdCopyQueryPoolResults(
-    _commandBuffer: api::VkCommandBuffer,
-    _queryPool: api::VkQueryPool,
-    _firstQuery: u32,
-    _queryCount: u32,
-    _dstBuffer: api::VkBuffer,
-    _dstOffset: api::VkDeviceSize,
-    _stride: api::VkDeviceSize,
-    _flags: api::VkQueryResultFlags,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    query_pool: api::VkQueryPool,
+    first_query: u32,
+    query_count: u32,
+    dst_buffer: api::VkBuffer,
+    dst_offset: api::VkDeviceSize,
+    stride: api::VkDeviceSize,
+    flags: api::VkQueryResultFlags,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::CopyQueryPoolResults {
+            query_pool: SharedHandle::from(query_pool).unwrap(),
+            first_query,
+            query_count,
+            dst_buffer: SharedHandle::from(dst_buffer).unwrap(),
+            dst_offset,
+            stride,
+            flags,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdPushConstants(
-    _commandBuffer: api::VkCommandBuffer,
-    _layout: api::VkPipelineLayout,
-    _stageFlags: api::VkShaderStageFlags,
-    _offset: u32,
-    _size: u32,
-    _pValues: *const c_void,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    layout: api::VkPipelineLayout,
+    stage_flags: api::VkShaderStageFlags,
+    offset: u32,
+    size: u32,
+    values: *const c_void,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::PushConstants {
+            layout: SharedHandle::from(layout).unwrap(),
+            stage_flags,
+            offset,
+            values: util::to_slice(values as *const u8, size as usize),
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdBeginRenderPass(
-    _commandBuffer: api::VkCommandBuffer,
-    _pRenderPassBegin: *const api::VkRenderPassBeginInfo,
-    _contents: api::VkSubpassContents,
+    command_buffer: api::VkCommandBuffer,
+    render_pass_begin: *const api::VkRenderPassBeginInfo,
+    contents: api::VkSubpassContents,
 ) {
-    unimplemented!()
+    parse_next_chain_const! {
+        render_pass_begin,
+        root = api::VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+        device_group_render_pass_begin_info: api::VkDeviceGroupRenderPassBeginInfo = api::VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO,
+    }
+    if !device_group_render_pass_begin_info.is_null() {
+        assert_eq!((*device_group_render_pass_begin_info).deviceMask, 1);
+    }
+    let render_pass_begin = &*render_pass_begin;
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::BeginRenderPass {
+            render_pass: SharedHandle::from(render_pass_begin.renderPass).unwrap(),
+            framebuffer: SharedHandle::from(render_pass_begin.framebuffer).unwrap(),
+            render_area: render_pass_begin.renderArea,
+            clear_values: util::to_slice(
+                render_pass_begin.pClearValues,
+                render_pass_begin.clearValueCount as usize,
+            ),
+            contents,
+        });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdNextSubpass(
-    _commandBuffer: api::VkCommandBuffer,
-    _contents: api::VkSubpassContents,
+    command_buffer: api::VkCommandBuffer,
+    contents: api::VkSubpassContents,
 ) {
-    unimplemented!()
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::NextSubpass { contents });
 }
 
 #[allow(non_snake_case)]
-pub unsafe extern "system" fn vkCmdEndRenderPass(_commandBuffer: api::VkCommandBuffer) {
-    unimplemented!()
+pub unsafe extern "system" fn vkCmdEndRenderPass(command_buffer: api::VkCommandBuffer) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::EndRenderPass {});
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdExecuteCommands(
-    _commandBuffer: api::VkCommandBuffer,
-    _commandBufferCount: u32,
-    _pCommandBuffers: *const api::VkCommandBuffer,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    command_buffer_count: u32,
+    command_buffers: *const api::VkCommandBuffer,
+) {
+    let command_buffers = util::to_slice(command_buffers, command_buffer_count as usize);
+    for &secondary_command_buffer in command_buffers {
+        assert_eq!(
+            SharedHandle::from(secondary_command_buffer)
+                .unwrap()
+                .level(),
+            api::VK_COMMAND_BUFFER_LEVEL_SECONDARY
+        );
+    }
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::ExecuteCommands { command_buffers });
 }
 
 #[allow(non_snake_case)]
@@ -5069,23 +5722,31 @@ pub unsafe extern "system" fn vkGetDeviceGroupPeerMemoryFeatures(
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdSetDeviceMask(
-    _commandBuffer: api::VkCommandBuffer,
-    _deviceMask: u32,
+    command_buffer: api::VkCommandBuffer,
+    device_mask: u32,
 ) {
-    unimplemented!()
+    assert_eq!(device_mask, 1);
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::SetDeviceMask { device_mask });
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCmdDispatchBase(
-    _commandBuffer: api::VkCommandBuffer,
-    _baseGroupX: u32,
-    _baseGroupY: u32,
-    _baseGroupZ: u32,
-    _groupCountX: u32,
-    _groupCountY: u32,
-    _groupCountZ: u32,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    base_group_x: u32,
+    base_group_y: u32,
+    base_group_z: u32,
+    group_count_x: u32,
+    group_count_y: u32,
+    group_count_z: u32,
+) {
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::Dispatch {
+            base_group: [base_group_x, base_group_y, base_group_z],
+            group_count: [group_count_x, group_count_y, group_count_z],
+        });
 }
 
 #[allow(non_snake_case)]
@@ -5146,7 +5807,7 @@ pub unsafe extern "system" fn vkGetImageMemoryRequirements2(
     memory_requirements.memoryRequirements = api::VkMemoryRequirements {
         size: layout.size as u64,
         alignment: layout.alignment as u64,
-        memoryTypeBits: DeviceMemoryType::Main.to_bits(),
+        memoryTypeBits: image.supported_memory_types().to_bits(),
         ..mem::zeroed() // for padding fields
     };
     if !dedicated_requirements.is_null() {
@@ -5179,7 +5840,7 @@ pub unsafe extern "system" fn vkGetBufferMemoryRequirements2(
     memory_requirements.memoryRequirements = api::VkMemoryRequirements {
         size: layout.size as u64,
         alignment: layout.alignment as u64,
-        memoryTypeBits: DeviceMemoryType::Main.to_bits(),
+        memoryTypeBits: DeviceMemoryTypes::non_lazy().to_bits(),
         ..mem::zeroed() // for padding fields
     };
     if !dedicated_requirements.is_null() {
@@ -5213,6 +5874,7 @@ pub unsafe extern "system" fn vkGetPhysicalDeviceFeatures2(
         physical_device_shader_draw_parameter_features: api::VkPhysicalDeviceShaderDrawParameterFeatures = api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETER_FEATURES,
         physical_device_protected_memory_features: api::VkPhysicalDeviceProtectedMemoryFeatures = api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES,
         physical_device_multiview_features: api::VkPhysicalDeviceMultiviewFeatures = api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES,
+        physical_device_timeline_semaphore_features: api::VkPhysicalDeviceTimelineSemaphoreFeaturesKHR = api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR,
     }
     let physical_device = SharedHandle::from(physical_device).unwrap();
     physical_device.features.export_feature_set(&mut *features);
@@ -5246,6 +5908,11 @@ pub unsafe extern "system" fn vkGetPhysicalDeviceFeatures2(
             .features
             .export_feature_set(&mut *physical_device_multiview_features);
     }
+    if !physical_device_timeline_semaphore_features.is_null() {
+        physical_device
+            .features
+            .export_feature_set(&mut *physical_device_timeline_semaphore_features);
+    }
 }
 
 #[allow(non_snake_case)]
@@ -5262,6 +5929,8 @@ pub unsafe extern "system" fn vkGetPhysicalDeviceProperties2(
         maintenance_3_properties: api::VkPhysicalDeviceMaintenance3Properties = api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES,
         protected_memory_properties: api::VkPhysicalDeviceProtectedMemoryProperties = api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES,
         subgroup_properties: api::VkPhysicalDeviceSubgroupProperties = api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES,
+        push_descriptor_properties: api::VkPhysicalDevicePushDescriptorPropertiesKHR = api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR,
+        timeline_semaphore_properties: api::VkPhysicalDeviceTimelineSemaphorePropertiesKHR = api::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES_KHR,
     }
     let properties = &mut *properties;
     let physical_device = SharedHandle::from(physical_device).unwrap();
@@ -5314,6 +5983,22 @@ pub unsafe extern "system" fn vkGetPhysicalDeviceProperties2(
             ..physical_device.subgroup_properties
         };
     }
+    if !push_descriptor_properties.is_null() {
+        let push_descriptor_properties = &mut *push_descriptor_properties;
+        *push_descriptor_properties = api::VkPhysicalDevicePushDescriptorPropertiesKHR {
+            sType: push_descriptor_properties.sType,
+            pNext: push_descriptor_properties.pNext,
+            ..physical_device.push_descriptor_properties
+        };
+    }
+    if !timeline_semaphore_properties.is_null() {
+        let timeline_semaphore_properties = &mut *timeline_semaphore_properties;
+        *timeline_semaphore_properties = api::VkPhysicalDeviceTimelineSemaphorePropertiesKHR {
+            sType: timeline_semaphore_properties.sType,
+            pNext: timeline_semaphore_properties.pNext,
+            ..physical_device.timeline_semaphore_properties
+        };
+    }
 }
 
 #[allow(non_snake_case)]
@@ -5405,10 +6090,11 @@ pub unsafe extern "system" fn vkGetPhysicalDeviceSparseImageFormatProperties2(
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkTrimCommandPool(
     _device: api::VkDevice,
-    _commandPool: api::VkCommandPool,
-    _flags: api::VkCommandPoolTrimFlags,
+    command_pool: api::VkCommandPool,
+    flags: api::VkCommandPoolTrimFlags,
 ) {
-    unimplemented!()
+    assert_eq!(flags, 0);
+    MutHandle::from(command_pool).unwrap().trim();
 }
 
 #[allow(non_snake_case)]
@@ -5450,30 +6136,62 @@ pub unsafe extern "system" fn vkDestroySamplerYcbcrConversion(
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCreateDescriptorUpdateTemplate(
     _device: api::VkDevice,
-    _pCreateInfo: *const api::VkDescriptorUpdateTemplateCreateInfo,
-    _pAllocator: *const api::VkAllocationCallbacks,
-    _pDescriptorUpdateTemplate: *mut api::VkDescriptorUpdateTemplate,
+    create_info: *const api::VkDescriptorUpdateTemplateCreateInfo,
+    _allocator: *const api::VkAllocationCallbacks,
+    descriptor_update_template: *mut api::VkDescriptorUpdateTemplate,
 ) -> api::VkResult {
-    unimplemented!()
+    parse_next_chain_const! {
+        create_info,
+        root = api::VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO,
+    }
+    let create_info = &*create_info;
+    let entries = util::to_slice(
+        create_info.pDescriptorUpdateEntries,
+        create_info.descriptorUpdateEntryCount as usize,
+    );
+    let descriptor_set_layout = match create_info.templateType {
+        api::VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET => {
+            SharedHandle::from(create_info.descriptorSetLayout).unwrap()
+        }
+        api::VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_PUSH_DESCRIPTORS_KHR => {
+            SharedHandle::from(create_info.pipelineLayout)
+                .unwrap()
+                .descriptor_set_layouts[create_info.set as usize]
+        }
+        template_type => unreachable!("invalid VkDescriptorUpdateTemplateType: {}", template_type),
+    };
+    *descriptor_update_template =
+        OwnedHandle::<api::VkDescriptorUpdateTemplate>::new(DescriptorUpdateTemplate::new(
+            entries,
+            &descriptor_set_layout,
+            create_info.pipelineBindPoint,
+        ))
+        .take();
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkDestroyDescriptorUpdateTemplate(
     _device: api::VkDevice,
-    _descriptorUpdateTemplate: api::VkDescriptorUpdateTemplate,
-    _pAllocator: *const api::VkAllocationCallbacks,
+    descriptor_update_template: api::VkDescriptorUpdateTemplate,
+    _allocator: *const api::VkAllocationCallbacks,
 ) {
-    unimplemented!()
+    OwnedHandle::from(descriptor_update_template);
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkUpdateDescriptorSetWithTemplate(
     _device: api::VkDevice,
-    _descriptorSet: api::VkDescriptorSet,
-    _descriptorUpdateTemplate: api::VkDescriptorUpdateTemplate,
-    _pData: *const c_void,
-) {
-    unimplemented!()
+    descriptor_set: api::VkDescriptorSet,
+    descriptor_update_template: api::VkDescriptorUpdateTemplate,
+    data: *const c_void,
+) {
+    SharedHandle::from(descriptor_update_template)
+        .unwrap()
+        .update(
+            &mut MutHandle::from(descriptor_set).unwrap(),
+            data as *const u8,
+        );
 }
 
 #[allow(non_snake_case)]
@@ -5528,12 +6246,15 @@ pub unsafe extern "system" fn vkDestroySurfaceKHR(
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkGetPhysicalDeviceSurfaceSupportKHR(
-    _physicalDevice: api::VkPhysicalDevice,
-    _queueFamilyIndex: u32,
+    _physical_device: api::VkPhysicalDevice,
+    queue_family_index: u32,
     _surface: api::VkSurfaceKHR,
-    _pSupported: *mut api::VkBool32,
+    supported: *mut api::VkBool32,
 ) -> api::VkResult {
-    unimplemented!()
+    assert!(queue_family_index < QUEUE_FAMILY_COUNT);
+    // presenting is done on the CPU, so every queue can present to every surface
+    *supported = api::VK_TRUE;
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
@@ -5655,31 +6376,119 @@ pub unsafe extern "system" fn vkDestroySwapchainKHR(
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkGetSwapchainImagesKHR(
     _device: api::VkDevice,
-    _swapchain: api::VkSwapchainKHR,
-    _pSwapchainImageCount: *mut u32,
-    _pSwapchainImages: *mut api::VkImage,
+    swapchain: api::VkSwapchainKHR,
+    swapchain_image_count: *mut u32,
+    swapchain_images: *mut api::VkImage,
 ) -> api::VkResult {
-    unimplemented!()
+    let swapchain = SharedHandle::from(swapchain).unwrap();
+    enumerate_helper(
+        swapchain_image_count,
+        swapchain_images,
+        swapchain.get_images(),
+        |a, b| *a = b,
+    )
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkAcquireNextImageKHR(
     _device: api::VkDevice,
-    _swapchain: api::VkSwapchainKHR,
-    _timeout: u64,
-    _semaphore: api::VkSemaphore,
-    _fence: api::VkFence,
-    _pImageIndex: *mut u32,
+    swapchain: api::VkSwapchainKHR,
+    timeout: u64,
+    semaphore: api::VkSemaphore,
+    fence: api::VkFence,
+    image_index: *mut u32,
 ) -> api::VkResult {
-    unimplemented!()
+    match SharedHandle::from(swapchain)
+        .unwrap()
+        .acquire_next_image(timeout)
+    {
+        Ok(v) => {
+            *image_index = v;
+            // the image is ready as soon as it is acquired, so the semaphore and fence can be
+            // signaled right away
+            if let Some(semaphore) = SharedHandle::from(semaphore) {
+                semaphore.signal(0);
+            }
+            if let Some(fence) = SharedHandle::from(fence) {
+                fence.signal();
+            }
+            api::VK_SUCCESS
+        }
+        Err(error) => error,
+    }
 }
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkQueuePresentKHR(
-    _queue: api::VkQueue,
-    _pPresentInfo: *const api::VkPresentInfoKHR,
+    queue: api::VkQueue,
+    present_info: *const api::VkPresentInfoKHR,
 ) -> api::VkResult {
-    unimplemented!()
+    parse_next_chain_const! {
+        present_info,
+        root = api::VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+        device_group_present_info: api::VkDeviceGroupPresentInfoKHR = api::VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR,
+    }
+    let present_info = &*present_info;
+    if !device_group_present_info.is_null() {
+        let device_group_present_info = &*device_group_present_info;
+        assert_eq!(
+            device_group_present_info.mode,
+            api::VK_DEVICE_GROUP_PRESENT_MODE_LOCAL_BIT_KHR
+        );
+    }
+    let swapchain_count = present_info.swapchainCount as usize;
+    let swapchains = util::to_slice(present_info.pSwapchains, swapchain_count);
+    let image_indices = util::to_slice(present_info.pImageIndices, swapchain_count);
+    let mut results = if present_info.pResults.is_null() {
+        None
+    } else {
+        Some(util::to_slice_mut(present_info.pResults, swapchain_count))
+    };
+    let mut retval = api::VK_SUCCESS;
+    let mut submissions = Vec::with_capacity(swapchain_count + 1);
+    let wait_semaphores = util::to_slice(
+        present_info.pWaitSemaphores,
+        present_info.waitSemaphoreCount as usize,
+    );
+    if !wait_semaphores.is_empty() {
+        // presents must wait on the semaphores, even the ones that fail
+        submissions.push(Submission {
+            wait_semaphores: wait_semaphores
+                .iter()
+                .map(|&semaphore| (SharedHandle::from(semaphore).unwrap(), 0))
+                .collect(),
+            ..Default::default()
+        });
+    }
+    for (index, (&swapchain, &image_index)) in swapchains.iter().zip(image_indices).enumerate() {
+        let swapchain = SharedHandle::from(swapchain).unwrap();
+        let result = match swapchain.get_status() {
+            Ok(()) => {
+                let queued_present = QueuedPresent {
+                    swapchain,
+                    image_index,
+                };
+                // the queue executes submissions in order, so this runs once the image is
+                // rendered
+                submissions.push(Submission {
+                    on_completion: Some(Box::new(move || queued_present.present())),
+                    ..Default::default()
+                });
+                api::VK_SUCCESS
+            }
+            Err(error) => error,
+        };
+        if let Some(results) = &mut results {
+            results[index] = result;
+        }
+        if retval == api::VK_SUCCESS {
+            retval = result;
+        }
+    }
+    if let Err(error) = SharedHandle::from(queue).unwrap().submit(submissions) {
+        return error;
+    }
+    retval
 }
 
 #[allow(non_snake_case)]
@@ -5711,11 +6520,24 @@ pub unsafe extern "system" fn vkGetPhysicalDevicePresentRectanglesKHR(
 
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkAcquireNextImage2KHR(
-    _device: api::VkDevice,
-    _pAcquireInfo: *const api::VkAcquireNextImageInfoKHR,
-    _pImageIndex: *mut u32,
+    device: api::VkDevice,
+    acquire_info: *const api::VkAcquireNextImageInfoKHR,
+    image_index: *mut u32,
 ) -> api::VkResult {
-    unimplemented!()
+    parse_next_chain_const! {
+        acquire_info,
+        root = api::VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR,
+    }
+    let acquire_info = &*acquire_info;
+    assert_eq!(acquire_info.deviceMask, 1);
+    vkAcquireNextImageKHR(
+        device,
+        acquire_info.swapchain,
+        acquire_info.timeout,
+        acquire_info.semaphore,
+        acquire_info.fence,
+        image_index,
+    )
 }
 
 #[allow(non_snake_case)]
@@ -5847,28 +6669,163 @@ pub unsafe extern "system" fn vkGetSemaphoreFdKHR(
 }
 
 #[allow(non_snake_case)]
-#[cfg(kazan_include_unused_vulkan_api)]
 pub unsafe extern "system" fn vkCmdPushDescriptorSetKHR(
-    _commandBuffer: api::VkCommandBuffer,
-    _pipelineBindPoint: api::VkPipelineBindPoint,
-    _layout: api::VkPipelineLayout,
-    _set: u32,
-    _descriptorWriteCount: u32,
-    _pDescriptorWrites: *const api::VkWriteDescriptorSet,
+    command_buffer: api::VkCommandBuffer,
+    pipeline_bind_point: api::VkPipelineBindPoint,
+    layout: api::VkPipelineLayout,
+    set: u32,
+    descriptor_write_count: u32,
+    descriptor_writes: *const api::VkWriteDescriptorSet,
 ) {
-    unimplemented!()
+    let layout = SharedHandle::from(layout).unwrap();
+    let mut push_descriptor_writes =
+        PushDescriptorWrites::new(&layout.descriptor_set_layouts[set as usize]);
+    for descriptor_write in util::to_slice(descriptor_writes, descriptor_write_count as usize) {
+        parse_next_chain_const! {
+            descriptor_write,
+            root = api::VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+        }
+        push_descriptor_writes.write(
+            descriptor_write.descriptorType,
+            descriptor_write.dstBinding as usize,
+            descriptor_write.dstArrayElement as usize,
+            DescriptorWriteArg::from(descriptor_write),
+        );
+    }
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::PushDescriptorSet {
+            pipeline_bind_point,
+            layout,
+            set,
+            runs: &push_descriptor_writes.runs,
+            elements: &push_descriptor_writes.elements,
+        });
 }
 
 #[allow(non_snake_case)]
-#[cfg(kazan_include_unused_vulkan_api)]
 pub unsafe extern "system" fn vkCmdPushDescriptorSetWithTemplateKHR(
-    _commandBuffer: api::VkCommandBuffer,
-    _descriptorUpdateTemplate: api::VkDescriptorUpdateTemplate,
-    _layout: api::VkPipelineLayout,
-    _set: u32,
-    _pData: *const c_void,
-) {
-    unimplemented!()
+    command_buffer: api::VkCommandBuffer,
+    descriptor_update_template: api::VkDescriptorUpdateTemplate,
+    layout: api::VkPipelineLayout,
+    set: u32,
+    data: *const c_void,
+) {
+    let descriptor_update_template = SharedHandle::from(descriptor_update_template).unwrap();
+    let layout = SharedHandle::from(layout).unwrap();
+    let mut push_descriptor_writes =
+        PushDescriptorWrites::new(&layout.descriptor_set_layouts[set as usize]);
+    push_descriptor_writes.write_with_template(&descriptor_update_template, data as *const u8);
+    MutHandle::from(command_buffer)
+        .unwrap()
+        .record(Command::PushDescriptorSet {
+            pipeline_bind_point: descriptor_update_template.pipeline_bind_point,
+            layout,
+            set,
+            runs: &push_descriptor_writes.runs,
+            elements: &push_descriptor_writes.elements,
+        });
+}
+#[allow(non_snake_case)]
+pub unsafe extern "system" fn vkGetSemaphoreCounterValueKHR(
+    _device: api::VkDevice,
+    semaphore: api::VkSemaphore,
+    value: *mut u64,
+) -> api::VkResult {
+    *value = SharedHandle::from(semaphore).unwrap().get_value();
+    api::VK_SUCCESS
+}
+
+#[allow(non_snake_case)]
+pub unsafe extern "system" fn vkWaitSemaphoresKHR(
+    _device: api::VkDevice,
+    wait_info: *const api::VkSemaphoreWaitInfoKHR,
+    timeout: u64,
+) -> api::VkResult {
+    parse_next_chain_const! {
+        wait_info,
+        root = api::VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR,
+    }
+    let wait_info = &*wait_info;
+    let deadline = sync::get_deadline(timeout);
+    let semaphore_count = wait_info.semaphoreCount as usize;
+    let semaphores: Vec<_> = util::to_slice(wait_info.pSemaphores, semaphore_count)
+        .iter()
+        .zip(util::to_slice(wait_info.pValues, semaphore_count))
+        .map(|(&semaphore, &value)| (SharedHandle::from(semaphore).unwrap(), value))
+        .collect();
+    let done = if wait_info.flags & api::VK_SEMAPHORE_WAIT_ANY_BIT_KHR != 0 {
+        sync::wait_for_any(deadline, || {
+            semaphores
+                .iter()
+                .any(|(semaphore, value)| semaphore.get_value() >= *value)
+        })
+    } else {
+        semaphores
+            .iter()
+            .all(|(semaphore, value)| semaphore.wait(*value, deadline))
+    };
+    if done {
+        api::VK_SUCCESS
+    } else {
+        api::VK_TIMEOUT
+    }
+}
+
+#[allow(non_snake_case)]
+pub unsafe extern "system" fn vkSignalSemaphoreKHR(
+    _device: api::VkDevice,
+    signal_info: *const api::VkSemaphoreSignalInfoKHR,
+) -> api::VkResult {
+    parse_next_chain_const! {
+        signal_info,
+        root = api::VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO_KHR,
+    }
+    let signal_info = &*signal_info;
+    SharedHandle::from(signal_info.semaphore)
+        .unwrap()
+        .signal(signal_info.value);
+    api::VK_SUCCESS
+}
+
+#[allow(non_snake_case)]
+pub unsafe extern "system" fn vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(
+    _physical_device: api::VkPhysicalDevice,
+    time_domain_count: *mut u32,
+    time_domains: *mut api::VkTimeDomainEXT,
+) -> api::VkResult {
+    enumerate_helper(
+        time_domain_count,
+        time_domains,
+        timestamp::get_calibrateable_time_domains(),
+        |l, r| *l = *r,
+    )
+}
+
+#[allow(non_snake_case)]
+pub unsafe extern "system" fn vkGetCalibratedTimestampsEXT(
+    _device: api::VkDevice,
+    timestamp_count: u32,
+    timestamp_infos: *const api::VkCalibratedTimestampInfoEXT,
+    timestamps: *mut u64,
+    max_deviation: *mut u64,
+) -> api::VkResult {
+    let timestamp_infos = util::to_slice(timestamp_infos, timestamp_count as usize);
+    let time_domains: Vec<api::VkTimeDomainEXT> = timestamp_infos
+        .iter()
+        .map(|timestamp_info| {
+            parse_next_chain_const! {
+                timestamp_info,
+                root = api::VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT,
+            }
+            timestamp_info.timeDomain
+        })
+        .collect();
+    *max_deviation = timestamp::get_calibrated_timestamps(
+        &time_domains,
+        util::to_slice_mut(timestamps, timestamp_count as usize),
+    );
+    api::VK_SUCCESS
 }
 
 #[allow(non_snake_case)]
@@ -6597,6 +7554,28 @@ pub unsafe extern "system" fn vkGetQueueCheckpointDataNV(
     unimplemented!()
 }
 
+#[allow(non_snake_case)]
+pub unsafe extern "system" fn vkCreateHeadlessSurfaceEXT(
+    _instance: api::VkInstance,
+    create_info: *const api::VkHeadlessSurfaceCreateInfoEXT,
+    _allocator: *const api::VkAllocationCallbacks,
+    surface: *mut api::VkSurfaceKHR,
+) -> api::VkResult {
+    parse_next_chain_const! {
+        create_info,
+        root = api::VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT,
+    }
+    let new_surface = Box::new(api::VkIcdSurfaceHeadless {
+        base: api::VkIcdSurfaceBase {
+            platform: api::VK_ICD_WSI_PLATFORM_HEADLESS,
+        },
+    });
+    *surface = api::VkSurfaceKHR::new(NonNull::new(
+        Box::into_raw(new_surface) as *mut api::VkIcdSurfaceBase
+    ));
+    api::VK_SUCCESS
+}
+
 #[cfg(target_os = "linux")]
 #[allow(non_snake_case)]
 pub unsafe extern "system" fn vkCreateXcbSurfaceKHR(
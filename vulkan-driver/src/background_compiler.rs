@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! threads that build optimized pipelines after `vkCreate*Pipelines` has already returned
+//! unoptimized ones
+
+use std::collections::VecDeque;
+use std::env;
+use std::fmt;
+use std::panic::{self, AssertUnwindSafe};
+use std::sync::{Arc, Condvar, Mutex};
+use std::thread;
+use sys_info;
+
+/// set to a nonzero value to enable tiered pipeline compilation
+pub const TIERED_COMPILATION_ENV_VAR: &str = "KAZAN_TIERED_COMPILATION";
+
+pub fn is_tiered_compilation_enabled() -> bool {
+    match env::var_os(TIERED_COMPILATION_ENV_VAR) {
+        Some(value) => !value.is_empty() && value != "0",
+        None => false,
+    }
+}
+
+type Job = Box<dyn FnOnce() + Send>;
+
+struct State {
+    jobs: VecDeque<Job>,
+    exiting: bool,
+}
+
+struct Shared {
+    state: Mutex<State>,
+    job_added: Condvar,
+}
+
+impl Shared {
+    fn thread_main(&self) {
+        let mut state = self.state.lock().unwrap();
+        loop {
+            if state.exiting {
+                return;
+            }
+            if let Some(job) = state.jobs.pop_front() {
+                drop(state);
+                // the unoptimized pipeline just stays in use if a job panics
+                let _ = panic::catch_unwind(AssertUnwindSafe(job));
+                state = self.state.lock().unwrap();
+            } else {
+                state = self.job_added.wait(state).unwrap();
+            }
+        }
+    }
+}
+
+pub struct BackgroundCompiler {
+    shared: Arc<Shared>,
+    threads: Vec<thread::JoinHandle<()>>,
+}
+
+impl fmt::Debug for BackgroundCompiler {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_struct("BackgroundCompiler")
+            .field("thread_count", &self.threads.len())
+            .finish()
+    }
+}
+
+impl BackgroundCompiler {
+    /// uses half the cores, leaving the rest for the application and the queues
+    pub fn new() -> Self {
+        let thread_count = (sys_info::cpu_num().unwrap_or(1) as usize / 2).max(1);
+        let shared = Arc::new(Shared {
+            state: Mutex::new(State {
+                jobs: VecDeque::new(),
+                exiting: false,
+            }),
+            job_added: Condvar::new(),
+        });
+        let threads = (0..thread_count)
+            .map(|thread_index| {
+                let shared = shared.clone();
+                thread::Builder::new()
+                    .name(format!("kazan background compiler {}", thread_index))
+                    .spawn(move || shared.thread_main())
+                    .unwrap()
+            })
+            .collect();
+        Self { shared, threads }
+    }
+    /// jobs run in the order they are added; jobs that haven't started when `self` is dropped
+    /// never run
+    pub fn add_job<F: FnOnce() + Send + 'static>(&self, job: F) {
+        let mut state = self.shared.state.lock().unwrap();
+        state.jobs.push_back(Box::new(job));
+        self.shared.job_added.notify_one();
+    }
+}
+
+impl Drop for BackgroundCompiler {
+    fn drop(&mut self) {
+        {
+            let mut state = self.shared.state.lock().unwrap();
+            state.exiting = true;
+            state.jobs.clear();
+            self.shared.job_added.notify_all();
+        }
+        for thread in self.threads.drain(..) {
+            thread.join().unwrap();
+        }
+    }
+}
@@ -0,0 +1,511 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! workloads for the driver benchmarks in `kazan-bench`.
+//!
+//! They go through the same entry points as applications, so running one times everything from
+//! `vkQueueSubmit` to its fence being signaled. Command buffers are recorded once when a workload
+//! is created, so recording isn't included.
+
+use crate::api;
+use crate::api_impl;
+use crate::device_memory::DeviceMemoryType;
+use crate::handle::Handle;
+use crate::pipeline::{get_generic_pipeline_options, get_shader_compiler_backend};
+use std::mem;
+use std::os::raw::c_char;
+use std::panic::{self, AssertUnwindSafe};
+use std::ptr::{null, null_mut};
+
+fn check(result: api::VkResult) {
+    assert_eq!(result, api::VK_SUCCESS);
+}
+
+pub struct BenchmarkDevice {
+    instance: api::VkInstance,
+    device: api::VkDevice,
+    queue: api::VkQueue,
+    command_pool: api::VkCommandPool,
+    fence: api::VkFence,
+}
+
+impl BenchmarkDevice {
+    pub fn new() -> Self {
+        unsafe {
+            let instance_extensions = [
+                b"VK_KHR_surface\0".as_ptr() as *const c_char,
+                b"VK_EXT_headless_surface\0".as_ptr() as *const c_char,
+            ];
+            let mut instance = Handle::null();
+            check(api_impl::vkCreateInstance(
+                &api::VkInstanceCreateInfo {
+                    sType: api::VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
+                    pNext: null(),
+                    flags: 0,
+                    pApplicationInfo: null(),
+                    enabledLayerCount: 0,
+                    ppEnabledLayerNames: null(),
+                    enabledExtensionCount: instance_extensions.len() as u32,
+                    ppEnabledExtensionNames: instance_extensions.as_ptr(),
+                },
+                null(),
+                &mut instance,
+            ));
+            let mut physical_device_count = 1;
+            let mut physical_device = Handle::null();
+            check(api_impl::vkEnumeratePhysicalDevices(
+                instance,
+                &mut physical_device_count,
+                &mut physical_device,
+            ));
+            let queue_priority = 1.0;
+            let device_extensions = [b"VK_KHR_swapchain\0".as_ptr() as *const c_char];
+            let mut device = Handle::null();
+            check(api_impl::vkCreateDevice(
+                physical_device,
+                &api::VkDeviceCreateInfo {
+                    sType: api::VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+                    pNext: null(),
+                    flags: 0,
+                    queueCreateInfoCount: 1,
+                    pQueueCreateInfos: &api::VkDeviceQueueCreateInfo {
+                        sType: api::VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+                        pNext: null(),
+                        flags: 0,
+                        queueFamilyIndex: 0,
+                        queueCount: 1,
+                        pQueuePriorities: &queue_priority,
+                    },
+                    enabledLayerCount: 0,
+                    ppEnabledLayerNames: null(),
+                    enabledExtensionCount: device_extensions.len() as u32,
+                    ppEnabledExtensionNames: device_extensions.as_ptr(),
+                    pEnabledFeatures: null(),
+                },
+                null(),
+                &mut device,
+            ));
+            let mut queue = Handle::null();
+            api_impl::vkGetDeviceQueue(device, 0, 0, &mut queue);
+            let mut command_pool = Handle::null();
+            check(api_impl::vkCreateCommandPool(
+                device,
+                &api::VkCommandPoolCreateInfo {
+                    sType: api::VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                    pNext: null(),
+                    flags: 0,
+                    queueFamilyIndex: 0,
+                },
+                null(),
+                &mut command_pool,
+            ));
+            let mut fence = Handle::null();
+            check(api_impl::vkCreateFence(
+                device,
+                &api::VkFenceCreateInfo {
+                    sType: api::VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+                    pNext: null(),
+                    flags: 0,
+                },
+                null(),
+                &mut fence,
+            ));
+            Self {
+                instance,
+                device,
+                queue,
+                command_pool,
+                fence,
+            }
+        }
+    }
+    unsafe fn create_buffer(&self, size: u64, usage: api::VkBufferUsageFlags) -> Buffer {
+        let mut buffer = Handle::null();
+        check(api_impl::vkCreateBuffer(
+            self.device,
+            &api::VkBufferCreateInfo {
+                sType: api::VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                pNext: null(),
+                flags: 0,
+                size,
+                usage,
+                sharingMode: api::VK_SHARING_MODE_EXCLUSIVE,
+                queueFamilyIndexCount: 0,
+                pQueueFamilyIndices: null(),
+            },
+            null(),
+            &mut buffer,
+        ));
+        let mut memory_requirements = mem::zeroed();
+        api_impl::vkGetBufferMemoryRequirements(self.device, buffer, &mut memory_requirements);
+        let mut memory = Handle::null();
+        check(api_impl::vkAllocateMemory(
+            self.device,
+            &api::VkMemoryAllocateInfo {
+                sType: api::VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+                pNext: null(),
+                allocationSize: memory_requirements.size,
+                memoryTypeIndex: DeviceMemoryType::Main as u32,
+            },
+            null(),
+            &mut memory,
+        ));
+        check(api_impl::vkBindBufferMemory(self.device, buffer, memory, 0));
+        Buffer { buffer, memory }
+    }
+    /// calls `record` to record the workload's command buffer
+    unsafe fn create_workload(
+        &self,
+        resources: WorkloadResources,
+        record: impl FnOnce(api::VkCommandBuffer),
+    ) -> Workload {
+        let mut command_buffer = Handle::null();
+        check(api_impl::vkAllocateCommandBuffers(
+            self.device,
+            &api::VkCommandBufferAllocateInfo {
+                sType: api::VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                pNext: null(),
+                commandPool: self.command_pool,
+                level: api::VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+                commandBufferCount: 1,
+            },
+            &mut command_buffer,
+        ));
+        check(api_impl::vkBeginCommandBuffer(
+            command_buffer,
+            &api::VkCommandBufferBeginInfo {
+                sType: api::VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                pNext: null(),
+                flags: 0,
+                pInheritanceInfo: null(),
+            },
+        ));
+        record(command_buffer);
+        check(api_impl::vkEndCommandBuffer(command_buffer));
+        Workload {
+            device: self,
+            command_buffer,
+            resources,
+        }
+    }
+    /// runs `workgroup_count` workgroups of the compute shader `spirv_code` that has no
+    /// descriptors or push constants, or returns `None` if it can't be compiled yet
+    pub fn create_dispatch(
+        &self,
+        spirv_code: &[u32],
+        entry_point_name: &str,
+        workgroup_count: u32,
+    ) -> Option<Workload> {
+        // the shader compiler panics on what it can't compile, which can't unwind out of
+        // `vkCreateComputePipelines`, so try it here first
+        let compiled = panic::catch_unwind(AssertUnwindSafe(|| {
+            shader_compiler::ComputePipeline::new(
+                &shader_compiler::ComputePipelineOptions {
+                    generic_options: get_generic_pipeline_options(0),
+                },
+                shader_compiler::ShaderStageCreateInfo {
+                    code: spirv_code,
+                    entry_point_name,
+                    specializations: &[],
+                },
+                shader_compiler::PipelineLayout {
+                    push_constants_size: 0,
+                    descriptor_sets: Vec::new(),
+                },
+                get_shader_compiler_backend(),
+            )
+        }));
+        if compiled.is_err() {
+            return None;
+        }
+        unsafe {
+            let mut shader_module = Handle::null();
+            check(api_impl::vkCreateShaderModule(
+                self.device,
+                &api::VkShaderModuleCreateInfo {
+                    sType: api::VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+                    pNext: null(),
+                    flags: 0,
+                    codeSize: spirv_code.len() * mem::size_of::<u32>(),
+                    pCode: spirv_code.as_ptr(),
+                },
+                null(),
+                &mut shader_module,
+            ));
+            let mut pipeline_layout = Handle::null();
+            check(api_impl::vkCreatePipelineLayout(
+                self.device,
+                &api::VkPipelineLayoutCreateInfo {
+                    sType: api::VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+                    pNext: null(),
+                    flags: 0,
+                    setLayoutCount: 0,
+                    pSetLayouts: null(),
+                    pushConstantRangeCount: 0,
+                    pPushConstantRanges: null(),
+                },
+                null(),
+                &mut pipeline_layout,
+            ));
+            let entry_point_name = format!("{}\0", entry_point_name);
+            let mut pipeline = Handle::null();
+            check(api_impl::vkCreateComputePipelines(
+                self.device,
+                Handle::null(),
+                1,
+                &api::VkComputePipelineCreateInfo {
+                    sType: api::VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+                    pNext: null(),
+                    flags: 0,
+                    stage: api::VkPipelineShaderStageCreateInfo {
+                        sType: api::VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+                        pNext: null(),
+                        flags: 0,
+                        stage: api::VK_SHADER_STAGE_COMPUTE_BIT,
+                        module: shader_module,
+                        pName: entry_point_name.as_ptr() as *const c_char,
+                        pSpecializationInfo: null(),
+                    },
+                    layout: pipeline_layout,
+                    basePipelineHandle: Handle::null(),
+                    basePipelineIndex: -1,
+                },
+                null(),
+                &mut pipeline,
+            ));
+            let resources = WorkloadResources {
+                pipeline: Some(ComputePipeline {
+                    shader_module,
+                    pipeline_layout,
+                    pipeline,
+                }),
+                ..WorkloadResources::default()
+            };
+            Some(self.create_workload(resources, |command_buffer| {
+                api_impl::vkCmdBindPipeline(
+                    command_buffer,
+                    api::VK_PIPELINE_BIND_POINT_COMPUTE,
+                    pipeline,
+                );
+                api_impl::vkCmdDispatch(command_buffer, workgroup_count, 1, 1);
+            }))
+        }
+    }
+    /// copies `size` bytes from one buffer to another
+    pub fn create_copy(&self, size: u64) -> Workload {
+        unsafe {
+            let source = self.create_buffer(size, api::VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+            let destination = self.create_buffer(size, api::VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+            let (source_buffer, destination_buffer) = (source.buffer, destination.buffer);
+            let resources = WorkloadResources {
+                buffers: vec![source, destination],
+                ..WorkloadResources::default()
+            };
+            self.create_workload(resources, |command_buffer| {
+                api_impl::vkCmdCopyBuffer(
+                    command_buffer,
+                    source_buffer,
+                    destination_buffer,
+                    1,
+                    &api::VkBufferCopy {
+                        srcOffset: 0,
+                        dstOffset: 0,
+                        size,
+                    },
+                );
+            })
+        }
+    }
+    /// a `VK_EXT_headless_surface` swapchain with `FIFO` presentation
+    pub fn create_swapchain(&self, width: u32, height: u32) -> BenchmarkSwapchain {
+        unsafe {
+            let mut surface = Handle::null();
+            check(api_impl::vkCreateHeadlessSurfaceEXT(
+                self.instance,
+                &api::VkHeadlessSurfaceCreateInfoEXT {
+                    sType: api::VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT,
+                    pNext: null(),
+                    flags: 0,
+                },
+                null(),
+                &mut surface,
+            ));
+            let mut swapchain = Handle::null();
+            check(api_impl::vkCreateSwapchainKHR(
+                self.device,
+                &api::VkSwapchainCreateInfoKHR {
+                    sType: api::VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
+                    pNext: null(),
+                    flags: 0,
+                    surface,
+                    minImageCount: 2,
+                    imageFormat: api::VK_FORMAT_B8G8R8A8_UNORM,
+                    imageColorSpace: api::VK_COLOR_SPACE_SRGB_NONLINEAR_KHR,
+                    imageExtent: api::VkExtent2D { width, height },
+                    imageArrayLayers: 1,
+                    imageUsage: api::VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+                    imageSharingMode: api::VK_SHARING_MODE_EXCLUSIVE,
+                    queueFamilyIndexCount: 0,
+                    pQueueFamilyIndices: null(),
+                    preTransform: api::VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR,
+                    compositeAlpha: api::VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
+                    presentMode: api::VK_PRESENT_MODE_FIFO_KHR,
+                    clipped: api::VK_TRUE,
+                    oldSwapchain: Handle::null(),
+                },
+                null(),
+                &mut swapchain,
+            ));
+            BenchmarkSwapchain {
+                device: self,
+                surface,
+                swapchain,
+            }
+        }
+    }
+}
+
+impl Default for BenchmarkDevice {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl Drop for BenchmarkDevice {
+    fn drop(&mut self) {
+        unsafe {
+            check(api_impl::vkDeviceWaitIdle(self.device));
+            api_impl::vkDestroyFence(self.device, self.fence, null());
+            api_impl::vkDestroyCommandPool(self.device, self.command_pool, null());
+            api_impl::vkDestroyDevice(self.device, null());
+            api_impl::vkDestroyInstance(self.instance, null());
+        }
+    }
+}
+
+struct Buffer {
+    buffer: api::VkBuffer,
+    memory: api::VkDeviceMemory,
+}
+
+struct ComputePipeline {
+    shader_module: api::VkShaderModule,
+    pipeline_layout: api::VkPipelineLayout,
+    pipeline: api::VkPipeline,
+}
+
+/// what a workload's command buffer uses, destroyed along with it
+#[derive(Default)]
+struct WorkloadResources {
+    buffers: Vec<Buffer>,
+    pipeline: Option<ComputePipeline>,
+}
+
+/// a command buffer that's submitted every time the workload is run
+pub struct Workload<'a> {
+    device: &'a BenchmarkDevice,
+    command_buffer: api::VkCommandBuffer,
+    resources: WorkloadResources,
+}
+
+impl Workload<'_> {
+    /// returns once the work is done
+    pub fn run(&self) {
+        let device = self.device;
+        unsafe {
+            check(api_impl::vkQueueSubmit(
+                device.queue,
+                1,
+                &api::VkSubmitInfo {
+                    sType: api::VK_STRUCTURE_TYPE_SUBMIT_INFO,
+                    pNext: null(),
+                    waitSemaphoreCount: 0,
+                    pWaitSemaphores: null(),
+                    pWaitDstStageMask: null(),
+                    commandBufferCount: 1,
+                    pCommandBuffers: &self.command_buffer,
+                    signalSemaphoreCount: 0,
+                    pSignalSemaphores: null(),
+                },
+                device.fence,
+            ));
+            check(api_impl::vkWaitForFences(
+                device.device,
+                1,
+                &device.fence,
+                api::VK_TRUE,
+                u64::max_value(),
+            ));
+            check(api_impl::vkResetFences(device.device, 1, &device.fence));
+        }
+    }
+}
+
+impl Drop for Workload<'_> {
+    fn drop(&mut self) {
+        let device = self.device.device;
+        unsafe {
+            api_impl::vkFreeCommandBuffers(
+                device,
+                self.device.command_pool,
+                1,
+                &self.command_buffer,
+            );
+            for buffer in self.resources.buffers.drain(..) {
+                api_impl::vkDestroyBuffer(device, buffer.buffer, null());
+                api_impl::vkFreeMemory(device, buffer.memory, null());
+            }
+            if let Some(pipeline) = self.resources.pipeline.take() {
+                api_impl::vkDestroyPipeline(device, pipeline.pipeline, null());
+                api_impl::vkDestroyPipelineLayout(device, pipeline.pipeline_layout, null());
+                api_impl::vkDestroyShaderModule(device, pipeline.shader_module, null());
+            }
+        }
+    }
+}
+
+pub struct BenchmarkSwapchain<'a> {
+    device: &'a BenchmarkDevice,
+    surface: api::VkSurfaceKHR,
+    swapchain: api::VkSwapchainKHR,
+}
+
+impl BenchmarkSwapchain<'_> {
+    /// acquires the next image and presents it without rendering to it
+    pub fn present(&self) {
+        unsafe {
+            let mut image_index = 0;
+            check(api_impl::vkAcquireNextImageKHR(
+                self.device.device,
+                self.swapchain,
+                u64::max_value(),
+                Handle::null(),
+                Handle::null(),
+                &mut image_index,
+            ));
+            check(api_impl::vkQueuePresentKHR(
+                self.device.queue,
+                &api::VkPresentInfoKHR {
+                    sType: api::VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+                    pNext: null(),
+                    waitSemaphoreCount: 0,
+                    pWaitSemaphores: null(),
+                    swapchainCount: 1,
+                    pSwapchains: &self.swapchain,
+                    pImageIndices: &image_index,
+                    pResults: null_mut(),
+                },
+            ));
+        }
+    }
+}
+
+impl Drop for BenchmarkSwapchain<'_> {
+    fn drop(&mut self) {
+        unsafe {
+            check(api_impl::vkQueueWaitIdle(self.device.queue));
+            api_impl::vkDestroySwapchainKHR(self.device.device, self.swapchain, null());
+            api_impl::vkDestroySurfaceKHR(self.device.instance, self.surface, null());
+        }
+    }
+}
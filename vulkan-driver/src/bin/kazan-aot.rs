@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! compiles every `.spv` file in a directory to pipeline cache data, so pipelines don't have to
+//! be compiled on every machine that runs them.
+//!
+//! usage: `kazan-aot [--entry-point <name>] [--push-constants-size <bytes>]
+//! [--descriptor-set <bindings>]... <spirv-directory> <output-file>`
+//!
+//! every shader is compiled with the same pipeline layout, given by `--push-constants-size` and
+//! a `--descriptor-set` for each descriptor set in order. It has to match the layout the
+//! pipelines are created with, or the cached code isn't used. See
+//! `aot::parse_descriptor_set_layout` for the format of `<bindings>`; for example,
+//! `--descriptor-set uniform-buffer,,storage-buffer*4` has a uniform buffer at binding 0 and 4
+//! storage buffers at binding 2.
+//!
+//! files that can't be read or compiled are reported and left out of the output; the exit
+//! status is nonzero if there were any.
+
+use kazan_driver::aot::{self, ComputeShader};
+use std::env;
+use std::fs;
+use std::io;
+use std::path::{Path, PathBuf};
+use std::process;
+
+const USAGE: &str = "usage: kazan-aot [--entry-point <name>] [--push-constants-size <bytes>] \
+                     [--descriptor-set <bindings>]... <spirv-directory> <output-file>";
+
+/// sorted, so the output doesn't depend on the directory order
+fn find_spirv_files(directory: &Path, files: &mut Vec<PathBuf>) -> io::Result<()> {
+    let mut entries = fs::read_dir(directory)?.collect::<io::Result<Vec<_>>>()?;
+    entries.sort_by_key(|entry| entry.file_name());
+    for entry in entries {
+        let path = entry.path();
+        if entry.file_type()?.is_dir() {
+            find_spirv_files(&path, files)?;
+        } else if path
+            .extension()
+            .map_or(false, |extension| extension == "spv")
+        {
+            files.push(path);
+        }
+    }
+    Ok(())
+}
+
+fn report(message: &str) {
+    eprintln!("kazan-aot: {}", message);
+}
+
+fn fail(message: &str) -> ! {
+    report(message);
+    process::exit(1)
+}
+
+fn main() {
+    let mut entry_point_name = String::from("main");
+    let mut pipeline_layout = shader_compiler::PipelineLayout {
+        push_constants_size: 0,
+        descriptor_sets: Vec::new(),
+    };
+    let mut paths = Vec::new();
+    let mut args = env::args_os().skip(1);
+    while let Some(arg) = args.next() {
+        if arg == "--entry-point" {
+            entry_point_name = args
+                .next()
+                .and_then(|v| v.into_string().ok())
+                .unwrap_or_else(|| fail(USAGE));
+        } else if arg == "--push-constants-size" {
+            pipeline_layout.push_constants_size = args
+                .next()
+                .and_then(|v| v.into_string().ok())
+                .and_then(|v| v.parse().ok())
+                .unwrap_or_else(|| fail(USAGE));
+        } else if arg == "--descriptor-set" {
+            let bindings = args
+                .next()
+                .and_then(|v| v.into_string().ok())
+                .unwrap_or_else(|| fail(USAGE));
+            pipeline_layout.descriptor_sets.push(
+                aot::parse_descriptor_set_layout(&bindings).unwrap_or_else(|error| fail(&error)),
+            );
+        } else {
+            paths.push(PathBuf::from(arg));
+        }
+    }
+    let (spirv_directory, output_file) = match &*paths {
+        [spirv_directory, output_file] => (spirv_directory, output_file),
+        _ => fail(USAGE),
+    };
+    let mut spirv_files = Vec::new();
+    if let Err(error) = find_spirv_files(spirv_directory, &mut spirv_files) {
+        fail(&format!("{}: {}", spirv_directory.display(), error));
+    }
+    let mut failure_count = 0;
+    let mut shader_paths = Vec::new();
+    let mut shaders = Vec::new();
+    for path in &spirv_files {
+        let code = fs::read(path)
+            .map_err(|error| error.to_string())
+            .and_then(|bytes| aot::get_spirv_words(&bytes));
+        match code {
+            Ok(code) => {
+                shader_paths.push(path);
+                shaders.push(ComputeShader {
+                    code,
+                    entry_point_name: entry_point_name.clone(),
+                    pipeline_layout: pipeline_layout.clone(),
+                });
+            }
+            Err(error) => {
+                report(&format!("{}: {}", path.display(), error));
+                failure_count += 1;
+            }
+        }
+    }
+    let (pipeline_cache_data, compile_failures) = aot::compile_compute_shaders(&shaders);
+    for (index, error) in &compile_failures {
+        report(&format!("{}: {}", shader_paths[*index].display(), error));
+    }
+    failure_count += compile_failures.len();
+    if let Err(error) = fs::write(output_file, pipeline_cache_data) {
+        fail(&format!("{}: {}", output_file.display(), error));
+    }
+    if failure_count != 0 {
+        fail(&format!(
+            "{} of {} files failed",
+            failure_count,
+            spirv_files.len()
+        ));
+    }
+}
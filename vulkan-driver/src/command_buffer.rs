@@ -0,0 +1,1748 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! recorded command buffers
+//!
+//! Commands are encoded into a flat byte stream: a `u32` opcode followed by the command's
+//! fields, each aligned to its natural alignment, and variable-length arrays stored inline
+//! after their length. The stream lives in chunks handed out by the `CommandPool` the
+//! command buffer was allocated from; chunks are recycled when command buffers are reset.
+
+use crate::api;
+use crate::compute;
+use crate::constants::QUEUE_FAMILY_COUNT;
+use crate::dependency_graph::{DependencyGraph, MemoryAccess};
+use crate::descriptor_set::{BoundDescriptorSets, DescriptorElement, PushDescriptorRun};
+use crate::device_memory::DeviceMemoryAllocation;
+use crate::handle::{DispatchableHandle, Handle, NondispatchableHandle, OwnedHandle, SharedHandle};
+use crate::pipeline::{Pipeline, PipelineLayout};
+use crate::query::{PipelineStatistic, PipelineStatistics, PIPELINE_STATISTIC_COUNT};
+use crate::queue::ExecutionContext;
+use crate::rasterizer::{
+    self, Draw, DrawVertices, FragmentStatistics, RenderPassInstance, VertexBuffers,
+};
+use crate::timestamp;
+use crate::transfer;
+use std::alloc;
+use std::fmt;
+use std::mem;
+use std::ops::Range;
+use std::ptr::{self, NonNull};
+use std::slice;
+use std::sync::Mutex;
+
+/// size of the chunks commands are recorded into; commands that don't fit in a whole chunk
+/// get one of their own, which isn't recycled
+const CHUNK_SIZE: usize = 64 * 1024;
+const CHUNK_ALIGNMENT: usize = 64;
+/// alignment of the start of each command; also the maximum alignment of command fields
+const COMMAND_ALIGNMENT: usize = 8;
+
+fn align_up(value: usize, alignment: usize) -> usize {
+    (value + alignment - 1) & !(alignment - 1)
+}
+
+struct Chunk {
+    memory: NonNull<u8>,
+    size: usize,
+    used: usize,
+}
+
+// only accessed through &mut or while the owning command buffer is externally synchronized
+unsafe impl Send for Chunk {}
+
+impl Chunk {
+    fn layout(size: usize) -> alloc::Layout {
+        alloc::Layout::from_size_align(size, CHUNK_ALIGNMENT).unwrap()
+    }
+    fn new(size: usize) -> Self {
+        let layout = Self::layout(size);
+        let memory = unsafe { alloc::alloc(layout) };
+        Self {
+            memory: NonNull::new(memory).unwrap_or_else(|| alloc::handle_alloc_error(layout)),
+            size,
+            used: 0,
+        }
+    }
+    fn bytes(&self) -> &[u8] {
+        unsafe { slice::from_raw_parts(self.memory.as_ptr(), self.used) }
+    }
+}
+
+impl Drop for Chunk {
+    fn drop(&mut self) {
+        unsafe { alloc::dealloc(self.memory.as_ptr(), Self::layout(self.size)) }
+    }
+}
+
+/// types that can be stored in the command stream by copying their bytes
+pub unsafe trait Pod: Copy + 'static {}
+
+macro_rules! impl_pod {
+    ($($t:ty,)*) => {
+        $(unsafe impl Pod for $t {})*
+    };
+}
+
+impl_pod! {
+    u8,
+    u32,
+    i32,
+    u64,
+    usize,
+    f32,
+    [f32; 4],
+    [u32; 3],
+    api::VkBufferCopy,
+    api::VkBufferImageCopy,
+    api::VkBufferMemoryBarrier,
+    api::VkClearAttachment,
+    api::VkClearColorValue,
+    api::VkClearDepthStencilValue,
+    api::VkClearRect,
+    api::VkClearValue,
+    api::VkImageBlit,
+    api::VkImageCopy,
+    api::VkImageMemoryBarrier,
+    api::VkImageResolve,
+    api::VkImageSubresourceRange,
+    api::VkMemoryBarrier,
+    api::VkRect2D,
+    api::VkViewport,
+    DescriptorElement,
+    PushDescriptorRun,
+}
+
+unsafe impl<T: Handle + 'static> Pod for SharedHandle<T> where T::Value: 'static {}
+
+unsafe impl<T: 'static> Pod for DispatchableHandle<T> {}
+
+unsafe impl<T: 'static> Pod for NondispatchableHandle<T> {}
+
+struct Encoder {
+    /// null when only measuring the encoded size
+    base: *mut u8,
+    position: usize,
+}
+
+impl Encoder {
+    fn write<T: Pod>(&mut self, values: &[T]) {
+        assert!(mem::align_of::<T>() <= COMMAND_ALIGNMENT);
+        self.position = align_up(self.position, mem::align_of::<T>());
+        if !self.base.is_null() {
+            unsafe {
+                ptr::copy_nonoverlapping(
+                    values.as_ptr(),
+                    self.base.add(self.position) as *mut T,
+                    values.len(),
+                );
+            }
+        }
+        self.position += mem::size_of::<T>() * values.len();
+    }
+}
+
+struct Decoder<'a> {
+    bytes: &'a [u8],
+    position: usize,
+}
+
+impl<'a> Decoder<'a> {
+    unsafe fn read<T: Pod>(&mut self, len: usize) -> &'a [T] {
+        self.position = align_up(self.position, mem::align_of::<T>());
+        let size = mem::size_of::<T>() * len;
+        assert!(self.position + size <= self.bytes.len());
+        let start = self.bytes.as_ptr().add(self.position) as *const T;
+        self.position += size;
+        slice::from_raw_parts(start, len)
+    }
+}
+
+trait CommandField<'a>: Sized {
+    fn encode(&self, encoder: &mut Encoder);
+    unsafe fn decode(decoder: &mut Decoder<'a>) -> Self;
+}
+
+impl<'a, T: Pod> CommandField<'a> for T {
+    fn encode(&self, encoder: &mut Encoder) {
+        encoder.write(slice::from_ref(self));
+    }
+    unsafe fn decode(decoder: &mut Decoder<'a>) -> Self {
+        decoder.read(1)[0]
+    }
+}
+
+impl<'a, T: Pod> CommandField<'a> for &'a [T] {
+    fn encode(&self, encoder: &mut Encoder) {
+        encoder.write(&[self.len()]);
+        encoder.write(self);
+    }
+    unsafe fn decode(decoder: &mut Decoder<'a>) -> Self {
+        let len = decoder.read::<usize>(1)[0];
+        decoder.read(len)
+    }
+}
+
+macro_rules! commands {
+    ($($name:ident {$($field:ident: $field_type:ty,)*},)*) => {
+        #[derive(Copy, Clone)]
+        pub enum Command<'a> {
+            $($name {$($field: $field_type,)*},)*
+        }
+
+        #[repr(u32)]
+        #[allow(dead_code)]
+        enum Opcode {
+            $($name,)*
+        }
+
+        impl<'a> Command<'a> {
+            pub fn name(&self) -> &'static str {
+                match self {
+                    $(Command::$name {..} => stringify!($name),)*
+                }
+            }
+            fn encode(&self, encoder: &mut Encoder) {
+                match *self {
+                    $(Command::$name {$($field,)*} => {
+                        encoder.write(&[Opcode::$name as u32]);
+                        $(CommandField::encode(&$field, encoder);)*
+                    })*
+                }
+            }
+            unsafe fn decode(decoder: &mut Decoder<'a>) -> Self {
+                let opcode = decoder.read::<u32>(1)[0];
+                $(if opcode == Opcode::$name as u32 {
+                    return Command::$name {$($field: CommandField::decode(decoder),)*};
+                })*
+                unreachable!("invalid opcode: {}", opcode)
+            }
+        }
+    };
+}
+
+commands! {
+    BindPipeline {
+        pipeline_bind_point: api::VkPipelineBindPoint,
+        pipeline: SharedHandle<api::VkPipeline>,
+    },
+    SetViewport {
+        first_viewport: u32,
+        viewports: &'a [api::VkViewport],
+    },
+    SetScissor {
+        first_scissor: u32,
+        scissors: &'a [api::VkRect2D],
+    },
+    SetLineWidth {
+        line_width: f32,
+    },
+    SetDepthBias {
+        depth_bias_constant_factor: f32,
+        depth_bias_clamp: f32,
+        depth_bias_slope_factor: f32,
+    },
+    SetBlendConstants {
+        blend_constants: [f32; 4],
+    },
+    SetDepthBounds {
+        min_depth_bounds: f32,
+        max_depth_bounds: f32,
+    },
+    SetStencilCompareMask {
+        face_mask: api::VkStencilFaceFlags,
+        compare_mask: u32,
+    },
+    SetStencilWriteMask {
+        face_mask: api::VkStencilFaceFlags,
+        write_mask: u32,
+    },
+    SetStencilReference {
+        face_mask: api::VkStencilFaceFlags,
+        reference: u32,
+    },
+    BindDescriptorSets {
+        pipeline_bind_point: api::VkPipelineBindPoint,
+        layout: SharedHandle<api::VkPipelineLayout>,
+        first_set: u32,
+        descriptor_sets: &'a [api::VkDescriptorSet],
+        dynamic_offsets: &'a [u32],
+    },
+    PushDescriptorSet {
+        pipeline_bind_point: api::VkPipelineBindPoint,
+        layout: SharedHandle<api::VkPipelineLayout>,
+        set: u32,
+        runs: &'a [PushDescriptorRun],
+        elements: &'a [DescriptorElement],
+    },
+    BindIndexBuffer {
+        buffer: SharedHandle<api::VkBuffer>,
+        offset: api::VkDeviceSize,
+        index_type: api::VkIndexType,
+    },
+    BindVertexBuffers {
+        first_binding: u32,
+        buffers: &'a [api::VkBuffer],
+        offsets: &'a [api::VkDeviceSize],
+    },
+    Draw {
+        vertex_count: u32,
+        instance_count: u32,
+        first_vertex: u32,
+        first_instance: u32,
+    },
+    DrawIndexed {
+        index_count: u32,
+        instance_count: u32,
+        first_index: u32,
+        vertex_offset: i32,
+        first_instance: u32,
+    },
+    DrawIndirect {
+        buffer: SharedHandle<api::VkBuffer>,
+        offset: api::VkDeviceSize,
+        draw_count: u32,
+        stride: u32,
+    },
+    DrawIndexedIndirect {
+        buffer: SharedHandle<api::VkBuffer>,
+        offset: api::VkDeviceSize,
+        draw_count: u32,
+        stride: u32,
+    },
+    Dispatch {
+        base_group: [u32; 3],
+        group_count: [u32; 3],
+    },
+    DispatchIndirect {
+        buffer: SharedHandle<api::VkBuffer>,
+        offset: api::VkDeviceSize,
+    },
+    CopyBuffer {
+        src_buffer: SharedHandle<api::VkBuffer>,
+        dst_buffer: SharedHandle<api::VkBuffer>,
+        regions: &'a [api::VkBufferCopy],
+    },
+    CopyImage {
+        src_image: SharedHandle<api::VkImage>,
+        src_image_layout: api::VkImageLayout,
+        dst_image: SharedHandle<api::VkImage>,
+        dst_image_layout: api::VkImageLayout,
+        regions: &'a [api::VkImageCopy],
+    },
+    BlitImage {
+        src_image: SharedHandle<api::VkImage>,
+        src_image_layout: api::VkImageLayout,
+        dst_image: SharedHandle<api::VkImage>,
+        dst_image_layout: api::VkImageLayout,
+        regions: &'a [api::VkImageBlit],
+        filter: api::VkFilter,
+    },
+    CopyBufferToImage {
+        src_buffer: SharedHandle<api::VkBuffer>,
+        dst_image: SharedHandle<api::VkImage>,
+        dst_image_layout: api::VkImageLayout,
+        regions: &'a [api::VkBufferImageCopy],
+    },
+    CopyImageToBuffer {
+        src_image: SharedHandle<api::VkImage>,
+        src_image_layout: api::VkImageLayout,
+        dst_buffer: SharedHandle<api::VkBuffer>,
+        regions: &'a [api::VkBufferImageCopy],
+    },
+    UpdateBuffer {
+        dst_buffer: SharedHandle<api::VkBuffer>,
+        dst_offset: api::VkDeviceSize,
+        data: &'a [u8],
+    },
+    FillBuffer {
+        dst_buffer: SharedHandle<api::VkBuffer>,
+        dst_offset: api::VkDeviceSize,
+        size: api::VkDeviceSize,
+        data: u32,
+    },
+    ClearColorImage {
+        image: SharedHandle<api::VkImage>,
+        image_layout: api::VkImageLayout,
+        color: api::VkClearColorValue,
+        ranges: &'a [api::VkImageSubresourceRange],
+    },
+    ClearDepthStencilImage {
+        image: SharedHandle<api::VkImage>,
+        image_layout: api::VkImageLayout,
+        depth_stencil: api::VkClearDepthStencilValue,
+        ranges: &'a [api::VkImageSubresourceRange],
+    },
+    ClearAttachments {
+        attachments: &'a [api::VkClearAttachment],
+        rects: &'a [api::VkClearRect],
+    },
+    ResolveImage {
+        src_image: SharedHandle<api::VkImage>,
+        src_image_layout: api::VkImageLayout,
+        dst_image: SharedHandle<api::VkImage>,
+        dst_image_layout: api::VkImageLayout,
+        regions: &'a [api::VkImageResolve],
+    },
+    SetEvent {
+        event: SharedHandle<api::VkEvent>,
+        stage_mask: api::VkPipelineStageFlags,
+    },
+    ResetEvent {
+        event: SharedHandle<api::VkEvent>,
+        stage_mask: api::VkPipelineStageFlags,
+    },
+    WaitEvents {
+        events: &'a [api::VkEvent],
+        src_stage_mask: api::VkPipelineStageFlags,
+        dst_stage_mask: api::VkPipelineStageFlags,
+        memory_barriers: &'a [api::VkMemoryBarrier],
+        buffer_memory_barriers: &'a [api::VkBufferMemoryBarrier],
+        image_memory_barriers: &'a [api::VkImageMemoryBarrier],
+    },
+    PipelineBarrier {
+        src_stage_mask: api::VkPipelineStageFlags,
+        dst_stage_mask: api::VkPipelineStageFlags,
+        dependency_flags: api::VkDependencyFlags,
+        memory_barriers: &'a [api::VkMemoryBarrier],
+        buffer_memory_barriers: &'a [api::VkBufferMemoryBarrier],
+        image_memory_barriers: &'a [api::VkImageMemoryBarrier],
+    },
+    BeginQuery {
+        query_pool: SharedHandle<api::VkQueryPool>,
+        query: u32,
+        flags: api::VkQueryControlFlags,
+    },
+    EndQuery {
+        query_pool: SharedHandle<api::VkQueryPool>,
+        query: u32,
+    },
+    ResetQueryPool {
+        query_pool: SharedHandle<api::VkQueryPool>,
+        first_query: u32,
+        query_count: u32,
+    },
+    WriteTimestamp {
+        pipeline_stage: api::VkPipelineStageFlagBits,
+        query_pool: SharedHandle<api::VkQueryPool>,
+        query: u32,
+    },
+    CopyQueryPoolResults {
+        query_pool: SharedHandle<api::VkQueryPool>,
+        first_query: u32,
+        query_count: u32,
+        dst_buffer: SharedHandle<api::VkBuffer>,
+        dst_offset: api::VkDeviceSize,
+        stride: api::VkDeviceSize,
+        flags: api::VkQueryResultFlags,
+    },
+    PushConstants {
+        layout: SharedHandle<api::VkPipelineLayout>,
+        stage_flags: api::VkShaderStageFlags,
+        offset: u32,
+        values: &'a [u8],
+    },
+    BeginRenderPass {
+        render_pass: SharedHandle<api::VkRenderPass>,
+        framebuffer: SharedHandle<api::VkFramebuffer>,
+        render_area: api::VkRect2D,
+        clear_values: &'a [api::VkClearValue],
+        contents: api::VkSubpassContents,
+    },
+    NextSubpass {
+        contents: api::VkSubpassContents,
+    },
+    EndRenderPass {},
+    ExecuteCommands {
+        command_buffers: &'a [api::VkCommandBuffer],
+    },
+    SetDeviceMask {
+        device_mask: u32,
+    },
+}
+
+pub struct Commands<'a> {
+    chunks: slice::Iter<'a, Chunk>,
+    decoder: Decoder<'a>,
+}
+
+impl<'a> Iterator for Commands<'a> {
+    type Item = Command<'a>;
+    fn next(&mut self) -> Option<Command<'a>> {
+        while self.decoder.position >= self.decoder.bytes.len() {
+            self.decoder = Decoder {
+                bytes: self.chunks.next()?.bytes(),
+                position: 0,
+            };
+        }
+        let retval = unsafe { Command::decode(&mut self.decoder) };
+        self.decoder.position = align_up(self.decoder.position, COMMAND_ALIGNMENT);
+        Some(retval)
+    }
+}
+
+/// reads the indexes of an indexed draw and adds `vertex_offset` to them
+unsafe fn get_indexes(
+    index_buffer: (SharedHandle<api::VkBuffer>, usize, api::VkIndexType),
+    first_index: u32,
+    index_count: u32,
+    vertex_offset: i32,
+    primitive_restart: bool,
+) -> DrawVertices {
+    let (buffer, offset, index_type) = index_buffer;
+    let memory = get_buffer_pointer(&buffer, offset);
+    let range = first_index as usize..first_index as usize + index_count as usize;
+    let (indexes, restart_index): (Vec<u32>, u32) = match index_type {
+        api::VK_INDEX_TYPE_UINT16 => (
+            slice::from_raw_parts(memory as *const u16, range.end)[range]
+                .iter()
+                .map(|&index| u32::from(index))
+                .collect(),
+            0xFFFF,
+        ),
+        api::VK_INDEX_TYPE_UINT32 => (
+            slice::from_raw_parts(memory as *const u32, range.end)[range].to_vec(),
+            0xFFFF_FFFF,
+        ),
+        _ => unreachable!("invalid index type {}", index_type),
+    };
+    DrawVertices::Indexed(
+        indexes
+            .into_iter()
+            .map(|index| {
+                if primitive_restart && index == restart_index {
+                    rasterizer::PRIMITIVE_RESTART
+                } else {
+                    (index as i32).wrapping_add(vertex_offset) as u32
+                }
+            })
+            .collect(),
+    )
+}
+
+unsafe fn get_buffer_pointer(buffer: &SharedHandle<api::VkBuffer>, offset: usize) -> *const u8 {
+    let memory = buffer.memory.as_ref().unwrap();
+    memory
+        .device_memory
+        .get()
+        .as_ptr()
+        .add(memory.offset + offset)
+}
+
+/// the memory from `offset` to `offset + size` in `buffer`, where `size` can be
+/// `VK_WHOLE_SIZE`
+unsafe fn get_buffer_access(
+    buffer: &SharedHandle<api::VkBuffer>,
+    offset: api::VkDeviceSize,
+    size: api::VkDeviceSize,
+    is_write: bool,
+) -> MemoryAccess {
+    let size = if size == api::VK_WHOLE_SIZE as api::VkDeviceSize {
+        buffer.size - offset as usize
+    } else {
+        size as usize
+    };
+    MemoryAccess::new(get_buffer_pointer(buffer, offset as usize), size, is_write)
+}
+
+/// the memory holding `layer_count` array layers of one mip level of `image`, where
+/// `layer_count` can be `VK_REMAINING_ARRAY_LAYERS`
+unsafe fn get_image_access(
+    image: &SharedHandle<api::VkImage>,
+    image_layout: api::VkImageLayout,
+    mip_level: u32,
+    base_array_layer: u32,
+    layer_count: u32,
+    is_write: bool,
+) -> MemoryAccess {
+    let properties = &image.properties;
+    let layer_count = if layer_count == api::VK_REMAINING_ARRAY_LAYERS as u32 {
+        properties.array_layers - base_array_layer
+    } else {
+        layer_count
+    };
+    let range = properties.get_subresources_range(
+        properties.get_tiling(image_layout),
+        mip_level,
+        base_array_layer,
+        layer_count,
+    );
+    let memory = image.memory.as_ref().unwrap();
+    MemoryAccess::new(
+        memory
+            .device_memory
+            .get()
+            .as_ptr()
+            .add(memory.offset + range.start),
+        range.len(),
+        is_write,
+    )
+}
+
+unsafe fn get_image_layers_access(
+    image: &SharedHandle<api::VkImage>,
+    image_layout: api::VkImageLayout,
+    subresource: &api::VkImageSubresourceLayers,
+    is_write: bool,
+) -> MemoryAccess {
+    get_image_access(
+        image,
+        image_layout,
+        subresource.mipLevel,
+        subresource.baseArrayLayer,
+        subresource.layerCount,
+        is_write,
+    )
+}
+
+/// the memory a transfer command reads and writes
+unsafe fn get_transfer_accesses(command: &Command) -> Vec<MemoryAccess> {
+    let mut retval = Vec::new();
+    match *command {
+        Command::CopyBuffer {
+            src_buffer,
+            dst_buffer,
+            regions,
+        } => {
+            for region in regions {
+                retval.push(get_buffer_access(
+                    &src_buffer,
+                    region.srcOffset,
+                    region.size,
+                    false,
+                ));
+                retval.push(get_buffer_access(
+                    &dst_buffer,
+                    region.dstOffset,
+                    region.size,
+                    true,
+                ));
+            }
+        }
+        Command::CopyImage {
+            src_image,
+            src_image_layout,
+            dst_image,
+            dst_image_layout,
+            regions,
+        } => {
+            for region in regions {
+                retval.push(get_image_layers_access(
+                    &src_image,
+                    src_image_layout,
+                    &region.srcSubresource,
+                    false,
+                ));
+                retval.push(get_image_layers_access(
+                    &dst_image,
+                    dst_image_layout,
+                    &region.dstSubresource,
+                    true,
+                ));
+            }
+        }
+        Command::BlitImage {
+            src_image,
+            src_image_layout,
+            dst_image,
+            dst_image_layout,
+            regions,
+            ..
+        } => {
+            for region in regions {
+                retval.push(get_image_layers_access(
+                    &src_image,
+                    src_image_layout,
+                    &region.srcSubresource,
+                    false,
+                ));
+                retval.push(get_image_layers_access(
+                    &dst_image,
+                    dst_image_layout,
+                    &region.dstSubresource,
+                    true,
+                ));
+            }
+        }
+        // where the rows end in the buffer depends on the row length and image height, so
+        // everything after the offset is counted
+        Command::CopyBufferToImage {
+            src_buffer,
+            dst_image,
+            dst_image_layout,
+            regions,
+        } => {
+            for region in regions {
+                retval.push(get_buffer_access(
+                    &src_buffer,
+                    region.bufferOffset,
+                    api::VK_WHOLE_SIZE as api::VkDeviceSize,
+                    false,
+                ));
+                retval.push(get_image_layers_access(
+                    &dst_image,
+                    dst_image_layout,
+                    &region.imageSubresource,
+                    true,
+                ));
+            }
+        }
+        Command::CopyImageToBuffer {
+            src_image,
+            src_image_layout,
+            dst_buffer,
+            regions,
+        } => {
+            for region in regions {
+                retval.push(get_image_layers_access(
+                    &src_image,
+                    src_image_layout,
+                    &region.imageSubresource,
+                    false,
+                ));
+                retval.push(get_buffer_access(
+                    &dst_buffer,
+                    region.bufferOffset,
+                    api::VK_WHOLE_SIZE as api::VkDeviceSize,
+                    true,
+                ));
+            }
+        }
+        Command::UpdateBuffer {
+            dst_buffer,
+            dst_offset,
+            data,
+        } => retval.push(get_buffer_access(
+            &dst_buffer,
+            dst_offset,
+            data.len() as api::VkDeviceSize,
+            true,
+        )),
+        Command::FillBuffer {
+            dst_buffer,
+            dst_offset,
+            size,
+            ..
+        } => retval.push(get_buffer_access(&dst_buffer, dst_offset, size, true)),
+        Command::ClearColorImage {
+            image,
+            image_layout,
+            ranges,
+            ..
+        }
+        | Command::ClearDepthStencilImage {
+            image,
+            image_layout,
+            ranges,
+            ..
+        } => {
+            for range in ranges {
+                let level_count = if range.levelCount == api::VK_REMAINING_MIP_LEVELS as u32 {
+                    image.properties.mip_levels - range.baseMipLevel
+                } else {
+                    range.levelCount
+                };
+                for mip_level in range.baseMipLevel..range.baseMipLevel + level_count {
+                    retval.push(get_image_access(
+                        &image,
+                        image_layout,
+                        mip_level,
+                        range.baseArrayLayer,
+                        range.layerCount,
+                        true,
+                    ));
+                }
+            }
+        }
+        Command::ResolveImage {
+            src_image,
+            src_image_layout,
+            dst_image,
+            dst_image_layout,
+            regions,
+        } => {
+            for region in regions {
+                retval.push(get_image_layers_access(
+                    &src_image,
+                    src_image_layout,
+                    &region.srcSubresource,
+                    false,
+                ));
+                retval.push(get_image_layers_access(
+                    &dst_image,
+                    dst_image_layout,
+                    &region.dstSubresource,
+                    true,
+                ));
+            }
+        }
+        _ => unreachable!("not a transfer command: {}", command.name()),
+    }
+    retval
+}
+
+unsafe fn execute_transfer(context: &ExecutionContext, command: Command) {
+    kazan_trace::trace_scope!(command.name());
+    match command {
+        Command::CopyBuffer {
+            src_buffer,
+            dst_buffer,
+            regions,
+        } => transfer::copy_buffer(context, &src_buffer, &dst_buffer, regions),
+        Command::CopyImage {
+            src_image,
+            src_image_layout,
+            dst_image,
+            dst_image_layout,
+            regions,
+        } => transfer::copy_image(
+            context,
+            &src_image,
+            src_image_layout,
+            &dst_image,
+            dst_image_layout,
+            regions,
+        ),
+        Command::BlitImage {
+            src_image,
+            src_image_layout,
+            dst_image,
+            dst_image_layout,
+            regions,
+            filter,
+        } => transfer::blit_image(
+            context,
+            &src_image,
+            src_image_layout,
+            &dst_image,
+            dst_image_layout,
+            regions,
+            filter,
+        ),
+        Command::CopyBufferToImage {
+            src_buffer,
+            dst_image,
+            dst_image_layout,
+            regions,
+        } => transfer::copy_buffer_to_image(
+            context,
+            &src_buffer,
+            &dst_image,
+            dst_image_layout,
+            regions,
+        ),
+        Command::CopyImageToBuffer {
+            src_image,
+            src_image_layout,
+            dst_buffer,
+            regions,
+        } => transfer::copy_image_to_buffer(
+            context,
+            &src_image,
+            src_image_layout,
+            &dst_buffer,
+            regions,
+        ),
+        Command::UpdateBuffer {
+            dst_buffer,
+            dst_offset,
+            data,
+        } => transfer::update_buffer(&dst_buffer, dst_offset, data),
+        Command::FillBuffer {
+            dst_buffer,
+            dst_offset,
+            size,
+            data,
+        } => transfer::fill_buffer(context, &dst_buffer, dst_offset, size, data),
+        Command::ClearColorImage {
+            image,
+            image_layout,
+            color,
+            ranges,
+        } => transfer::clear_color_image(context, &image, image_layout, &color, ranges),
+        Command::ClearDepthStencilImage {
+            image,
+            image_layout,
+            depth_stencil,
+            ranges,
+        } => transfer::clear_depth_stencil_image(
+            context,
+            &image,
+            image_layout,
+            &depth_stencil,
+            ranges,
+        ),
+        Command::ResolveImage {
+            src_image,
+            src_image_layout,
+            dst_image,
+            dst_image_layout,
+            regions,
+        } => transfer::resolve_image(
+            context,
+            &src_image,
+            src_image_layout,
+            &dst_image,
+            dst_image_layout,
+            regions,
+        ),
+        _ => unreachable!("not a transfer command: {}", command.name()),
+    }
+}
+
+/// whether `command` has to wait for the dispatches and transfers before it to finish. those
+/// and the commands that only set state don't.
+fn waits_for_graph(command: &Command) -> bool {
+    match command {
+        Command::BindPipeline { .. }
+        | Command::SetViewport { .. }
+        | Command::SetScissor { .. }
+        | Command::SetBlendConstants { .. }
+        | Command::SetLineWidth { .. }
+        | Command::SetDepthBias { .. }
+        | Command::SetDepthBounds { .. }
+        | Command::SetStencilCompareMask { .. }
+        | Command::SetStencilWriteMask { .. }
+        | Command::SetStencilReference { .. }
+        | Command::BindIndexBuffer { .. }
+        | Command::BindVertexBuffers { .. }
+        | Command::BindDescriptorSets { .. }
+        | Command::PushDescriptorSet { .. }
+        | Command::PushConstants { .. }
+        | Command::Dispatch { .. }
+        | Command::DispatchIndirect { .. }
+        | Command::PipelineBarrier { .. }
+        | Command::SetDeviceMask { .. }
+        | Command::CopyBuffer { .. }
+        | Command::CopyImage { .. }
+        | Command::BlitImage { .. }
+        | Command::CopyBufferToImage { .. }
+        | Command::CopyImageToBuffer { .. }
+        | Command::UpdateBuffer { .. }
+        | Command::FillBuffer { .. }
+        | Command::ClearColorImage { .. }
+        | Command::ClearDepthStencilImage { .. }
+        | Command::ResolveImage { .. } => false,
+        _ => true,
+    }
+}
+
+/// why a command couldn't be executed. The queue reports it by losing the device, since
+/// there's no other way to fail a submission that has already been accepted.
+#[derive(Debug)]
+pub struct ExecutionError {
+    pub command_name: &'static str,
+    pub reason: &'static str,
+}
+
+impl fmt::Display for ExecutionError {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        write!(f, "can't execute {}: {}", self.command_name, self.reason)
+    }
+}
+
+/// a query that has begun and not ended yet
+struct ActiveQuery {
+    query_pool: SharedHandle<api::VkQueryPool>,
+    query: u32,
+    /// the pipeline statistics when the query began
+    begin_statistics: PipelineStatistics,
+    /// what the fragments of the draws in the render pass instances that ended while the query
+    /// was active did
+    fragment_statistics: FragmentStatistics,
+    /// the first draw in the current render pass instance that the query counts
+    first_draw: usize,
+}
+
+impl ActiveQuery {
+    fn finish(&self, mut statistics: PipelineStatistics) {
+        statistics[PipelineStatistic::FragmentShaderInvocations as usize] +=
+            self.fragment_statistics.fragment_shader_invocations;
+        self.query_pool.end_query(
+            self.query,
+            &statistics,
+            self.fragment_statistics.samples_passed,
+        );
+    }
+}
+
+/// a query that ended inside a render pass instance, so its results aren't known until the
+/// tiles are rasterized when the render pass instance ends
+struct EndingQuery {
+    query: ActiveQuery,
+    /// the pipeline statistics counted while the query was active
+    statistics: PipelineStatistics,
+    /// the end of the draws in the render pass instance that the query counts
+    end_draw: usize,
+}
+
+/// the state commands leave for the commands after them
+#[derive(Default)]
+struct ExecutionState {
+    graphics_pipeline: Option<SharedHandle<api::VkPipeline>>,
+    compute_pipeline: Option<SharedHandle<api::VkPipeline>>,
+    viewport: Option<api::VkViewport>,
+    scissor: Option<api::VkRect2D>,
+    blend_constants: [f32; 4],
+    /// this and the depth and stencil state after it aren't used by the rasterizer yet
+    #[allow(dead_code)]
+    line_width: f32,
+    /// the constant factor, clamp and slope factor
+    #[allow(dead_code)]
+    depth_bias: [f32; 3],
+    /// the minimum and maximum
+    #[allow(dead_code)]
+    depth_bounds: [f32; 2],
+    /// the front and back face values of the stencil state
+    #[allow(dead_code)]
+    stencil_compare_masks: [u32; 2],
+    #[allow(dead_code)]
+    stencil_write_masks: [u32; 2],
+    #[allow(dead_code)]
+    stencil_references: [u32; 2],
+    vertex_buffers: Vec<*const u8>,
+    index_buffer: Option<(SharedHandle<api::VkBuffer>, usize, api::VkIndexType)>,
+    graphics_descriptor_sets: BoundDescriptorSets,
+    compute_descriptor_sets: BoundDescriptorSets,
+    /// shared by all the stages, and as words so shaders can load them aligned
+    push_constants: Vec<u32>,
+    render_pass_instance: Option<RenderPassInstance>,
+    active_queries: Vec<ActiveQuery>,
+    ending_queries: Vec<EndingQuery>,
+}
+
+/// sets the values in `values` of the faces in `face_mask`
+fn set_stencil_faces(values: &mut [u32; 2], face_mask: api::VkStencilFaceFlags, value: u32) {
+    if (face_mask & api::VK_STENCIL_FACE_FRONT_BIT) != 0 {
+        values[0] = value;
+    }
+    if (face_mask & api::VK_STENCIL_FACE_BACK_BIT) != 0 {
+        values[1] = value;
+    }
+}
+
+impl ExecutionState {
+    fn descriptor_sets_mut(
+        &mut self,
+        pipeline_bind_point: api::VkPipelineBindPoint,
+    ) -> &mut BoundDescriptorSets {
+        match pipeline_bind_point {
+            api::VK_PIPELINE_BIND_POINT_GRAPHICS => &mut self.graphics_descriptor_sets,
+            api::VK_PIPELINE_BIND_POINT_COMPUTE => &mut self.compute_descriptor_sets,
+            _ => unreachable!("invalid VkPipelineBindPoint: {}", pipeline_bind_point),
+        }
+    }
+    /// `get_group_count` is called once the dispatch's dependencies have finished, and
+    /// returns the base group and the group count
+    fn dispatch<'a>(
+        &self,
+        context: &ExecutionContext,
+        graph: &mut DependencyGraph<'a>,
+        stages: api::VkPipelineStageFlags,
+        mut accesses: Vec<MemoryAccess>,
+        get_group_count: impl Fn() -> ([u32; 3], [u32; 3]) + 'a,
+    ) {
+        let pipeline = self.compute_pipeline.expect("no compute pipeline bound");
+        let pipeline = match &*pipeline {
+            Pipeline::Compute(pipeline) => pipeline.get_compiled(),
+            Pipeline::Graphics(_) => unreachable!(),
+        };
+        accesses.extend(self.compute_descriptor_sets.get_memory_accesses());
+        let resources = compute::ShaderResources {
+            descriptor_sets: self.compute_descriptor_sets.get_shader_descriptor_sets(),
+            push_constants: self.push_constants.clone(),
+        };
+        graph.add(context, stages, accesses, move |context| {
+            let (base_group, group_count) = get_group_count();
+            compute::dispatch(context, &pipeline, &resources, base_group, group_count);
+        });
+    }
+    /// `offset` and the length of `values` are multiples of 4, as required by
+    /// vkCmdPushConstants
+    fn push_constants(&mut self, layout: &PipelineLayout, offset: usize, values: &[u8]) {
+        // shaders can read all of the layout's push constants, even the ones never pushed
+        let len = (offset + values.len()).max(layout.push_constants_size) / 4;
+        if self.push_constants.len() < len {
+            self.push_constants.resize(len, 0);
+        }
+        let words = &mut self.push_constants[offset / 4..][..values.len() / 4];
+        for (word, bytes) in words.iter_mut().zip(values.chunks_exact(4)) {
+            *word = u32::from_ne_bytes([bytes[0], bytes[1], bytes[2], bytes[3]]);
+        }
+    }
+    fn begin_query(
+        &mut self,
+        context: &ExecutionContext,
+        query_pool: SharedHandle<api::VkQueryPool>,
+        query: u32,
+    ) {
+        self.active_queries.push(ActiveQuery {
+            query_pool,
+            query,
+            begin_statistics: context.get_pipeline_statistics(),
+            fragment_statistics: FragmentStatistics::default(),
+            first_draw: self
+                .render_pass_instance
+                .as_ref()
+                .map_or(0, RenderPassInstance::draw_count),
+        });
+    }
+    fn end_query(
+        &mut self,
+        context: &ExecutionContext,
+        query_pool: SharedHandle<api::VkQueryPool>,
+        query: u32,
+    ) {
+        let index = self
+            .active_queries
+            .iter()
+            .position(|active_query| {
+                active_query.query_pool.into_nonnull() == query_pool.into_nonnull()
+                    && active_query.query == query
+            })
+            .expect("query not active");
+        let active_query = self.active_queries.swap_remove(index);
+        let end_statistics = context.get_pipeline_statistics();
+        let mut statistics = [0; PIPELINE_STATISTIC_COUNT];
+        for (index, statistic) in statistics.iter_mut().enumerate() {
+            *statistic = end_statistics[index].wrapping_sub(active_query.begin_statistics[index]);
+        }
+        match &self.render_pass_instance {
+            Some(render_pass_instance) => self.ending_queries.push(EndingQuery {
+                query: active_query,
+                statistics,
+                end_draw: render_pass_instance.draw_count(),
+            }),
+            None => active_query.finish(statistics),
+        }
+    }
+    fn end_render_pass(&mut self, context: &ExecutionContext) {
+        let draw_statistics = self
+            .render_pass_instance
+            .take()
+            .expect("not in a render pass")
+            .end(context);
+        let sum = |draws: Range<usize>| {
+            let mut retval = FragmentStatistics::default();
+            for &statistics in &draw_statistics[draws] {
+                retval.add(statistics);
+            }
+            retval
+        };
+        for mut ending_query in self.ending_queries.drain(..) {
+            let query = &mut ending_query.query;
+            query
+                .fragment_statistics
+                .add(sum(query.first_draw..ending_query.end_draw));
+            query.finish(ending_query.statistics);
+        }
+        for query in &mut self.active_queries {
+            query
+                .fragment_statistics
+                .add(sum(query.first_draw..draw_statistics.len()));
+            query.first_draw = 0;
+        }
+    }
+    unsafe fn bind_vertex_buffers(
+        &mut self,
+        first_binding: u32,
+        buffers: &[api::VkBuffer],
+        offsets: &[api::VkDeviceSize],
+    ) {
+        let first_binding = first_binding as usize;
+        if self.vertex_buffers.len() < first_binding + buffers.len() {
+            self.vertex_buffers
+                .resize(first_binding + buffers.len(), ptr::null());
+        }
+        for (binding, (&buffer, &offset)) in buffers.iter().zip(offsets).enumerate() {
+            self.vertex_buffers[first_binding + binding] =
+                get_buffer_pointer(&SharedHandle::from(buffer).unwrap(), offset as usize);
+        }
+    }
+    /// `get_vertices` is passed whether primitive restart is enabled
+    unsafe fn draw(
+        &mut self,
+        context: &ExecutionContext,
+        command_name: &'static str,
+        get_vertices: impl FnOnce(bool) -> DrawVertices,
+        instances: Range<u32>,
+    ) -> Result<(), ExecutionError> {
+        let pipeline = self.graphics_pipeline.expect("no graphics pipeline bound");
+        let pipeline = match &*pipeline {
+            Pipeline::Graphics(pipeline) => pipeline,
+            Pipeline::Compute(_) => unreachable!(),
+        };
+        let state = &pipeline.fixed_function_state;
+        if state.rasterizer_discard || instances.start == instances.end {
+            // FIXME: run the vertex shader for its side effects
+            return Ok(());
+        }
+        let shaders = pipeline.get_shaders().ok_or(ExecutionError {
+            command_name,
+            reason: "the shader compiler can't compile vertex and fragment shaders yet",
+        })?;
+        let vertex_buffers = VertexBuffers(self.vertex_buffers.clone());
+        let draw = Draw {
+            state,
+            shaders: &shaders,
+            viewport: state.viewport.or(self.viewport).expect("no viewport set"),
+            scissor: state.scissor.or(self.scissor).expect("no scissor set"),
+            blend_constants: state.blend_constants.unwrap_or(self.blend_constants),
+            vertex_buffers: &vertex_buffers,
+            vertices: get_vertices(state.primitive_restart),
+            instances,
+        };
+        // FIXME: pass the bound descriptor sets and push constants to the shaders
+        self.render_pass_instance
+            .as_mut()
+            .expect("draw outside of a render pass")
+            .draw(context, draw);
+        Ok(())
+    }
+    unsafe fn draw_indirect(
+        &mut self,
+        context: &ExecutionContext,
+        buffer: SharedHandle<api::VkBuffer>,
+        offset: api::VkDeviceSize,
+        draw_count: u32,
+        stride: u32,
+    ) -> Result<(), ExecutionError> {
+        for draw_index in 0..draw_count as usize {
+            let command =
+                *(get_buffer_pointer(&buffer, offset as usize + draw_index * stride as usize)
+                    as *const api::VkDrawIndirectCommand);
+            self.draw(
+                context,
+                "DrawIndirect",
+                |_| DrawVertices::Sequential {
+                    first_vertex: command.firstVertex,
+                    vertex_count: command.vertexCount,
+                },
+                command.firstInstance..command.firstInstance + command.instanceCount,
+            )?;
+        }
+        Ok(())
+    }
+    unsafe fn draw_indexed_indirect(
+        &mut self,
+        context: &ExecutionContext,
+        buffer: SharedHandle<api::VkBuffer>,
+        offset: api::VkDeviceSize,
+        draw_count: u32,
+        stride: u32,
+    ) -> Result<(), ExecutionError> {
+        let index_buffer = self.index_buffer.expect("no index buffer bound");
+        for draw_index in 0..draw_count as usize {
+            let command =
+                *(get_buffer_pointer(&buffer, offset as usize + draw_index * stride as usize)
+                    as *const api::VkDrawIndexedIndirectCommand);
+            self.draw(
+                context,
+                "DrawIndexedIndirect",
+                |primitive_restart| {
+                    get_indexes(
+                        index_buffer,
+                        command.firstIndex,
+                        command.indexCount,
+                        command.vertexOffset,
+                        primitive_restart,
+                    )
+                },
+                command.firstInstance..command.firstInstance + command.instanceCount,
+            )?;
+        }
+        Ok(())
+    }
+}
+
+#[derive(Copy, Clone, Eq, PartialEq, Debug)]
+enum CommandBufferState {
+    Initial,
+    Recording,
+    Executable,
+}
+
+pub struct CommandBuffer {
+    pool: SharedHandle<api::VkCommandPool>,
+    level: api::VkCommandBufferLevel,
+    state: CommandBufferState,
+    chunks: Vec<Chunk>,
+}
+
+impl CommandBuffer {
+    pub fn level(&self) -> api::VkCommandBufferLevel {
+        self.level
+    }
+    fn take_chunks(&mut self) -> Vec<Chunk> {
+        self.state = CommandBufferState::Initial;
+        mem::replace(&mut self.chunks, Vec::new())
+    }
+    pub fn reset(&mut self, release_resources: bool) {
+        assert!(self.pool.reset_command_buffer_allowed);
+        let chunks = self.take_chunks();
+        if !release_resources {
+            self.pool.recycle_chunks(chunks);
+        }
+    }
+    pub fn begin(&mut self) {
+        if self.state != CommandBufferState::Initial {
+            self.reset(false);
+        }
+        self.state = CommandBufferState::Recording;
+    }
+    pub fn end(&mut self) {
+        assert_eq!(self.state, CommandBufferState::Recording);
+        self.state = CommandBufferState::Executable;
+    }
+    pub fn record(&mut self, command: Command) {
+        assert_eq!(self.state, CommandBufferState::Recording);
+        let mut encoder = Encoder {
+            base: ptr::null_mut(),
+            position: 0,
+        };
+        command.encode(&mut encoder);
+        let size = align_up(encoder.position, COMMAND_ALIGNMENT);
+        encoder = Encoder {
+            base: self.allocate(size),
+            position: 0,
+        };
+        command.encode(&mut encoder);
+    }
+    fn allocate(&mut self, size: usize) -> *mut u8 {
+        if let Some(chunk) = self.chunks.last_mut() {
+            if chunk.size - chunk.used >= size {
+                let retval = unsafe { chunk.memory.as_ptr().add(chunk.used) };
+                chunk.used += size;
+                return retval;
+            }
+        }
+        let mut chunk = self.pool.allocate_chunk(size);
+        chunk.used = size;
+        let retval = chunk.memory.as_ptr();
+        self.chunks.push(chunk);
+        retval
+    }
+    pub fn commands(&self) -> Commands {
+        Commands {
+            chunks: self.chunks.iter(),
+            decoder: Decoder {
+                bytes: &[],
+                position: 0,
+            },
+        }
+    }
+    pub fn execute(&self, context: &ExecutionContext) -> Result<(), ExecutionError> {
+        self.execute_with_state(context, &mut ExecutionState::default())
+    }
+    /// dispatches and transfers go through a `DependencyGraph`, so they can overlap with the
+    /// ones they don't depend on. Everything else waits for the graph and runs in order.
+    fn execute_with_state(
+        &self,
+        context: &ExecutionContext,
+        state: &mut ExecutionState,
+    ) -> Result<(), ExecutionError> {
+        assert_eq!(self.state, CommandBufferState::Executable);
+        let mut graph = DependencyGraph::new();
+        for command in self.commands() {
+            // dispatches and transfers are traced again when the graph runs them
+            kazan_trace::trace_scope!(command.name());
+            if waits_for_graph(&command) {
+                graph.run(context);
+            }
+            match command {
+                Command::BindPipeline {
+                    pipeline_bind_point: api::VK_PIPELINE_BIND_POINT_GRAPHICS,
+                    pipeline,
+                } => state.graphics_pipeline = Some(pipeline),
+                Command::BindPipeline {
+                    pipeline_bind_point: api::VK_PIPELINE_BIND_POINT_COMPUTE,
+                    pipeline,
+                } => state.compute_pipeline = Some(pipeline),
+                Command::SetViewport {
+                    first_viewport,
+                    viewports,
+                } => {
+                    assert_eq!(first_viewport, 0);
+                    state.viewport = Some(viewports[0]);
+                }
+                Command::SetScissor {
+                    first_scissor,
+                    scissors,
+                } => {
+                    assert_eq!(first_scissor, 0);
+                    state.scissor = Some(scissors[0]);
+                }
+                Command::SetBlendConstants { blend_constants } => {
+                    state.blend_constants = blend_constants
+                }
+                Command::SetLineWidth { line_width } => state.line_width = line_width,
+                Command::SetDepthBias {
+                    depth_bias_constant_factor,
+                    depth_bias_clamp,
+                    depth_bias_slope_factor,
+                } => {
+                    state.depth_bias = [
+                        depth_bias_constant_factor,
+                        depth_bias_clamp,
+                        depth_bias_slope_factor,
+                    ]
+                }
+                Command::SetDepthBounds {
+                    min_depth_bounds,
+                    max_depth_bounds,
+                } => state.depth_bounds = [min_depth_bounds, max_depth_bounds],
+                Command::SetStencilCompareMask {
+                    face_mask,
+                    compare_mask,
+                } => set_stencil_faces(&mut state.stencil_compare_masks, face_mask, compare_mask),
+                Command::SetStencilWriteMask {
+                    face_mask,
+                    write_mask,
+                } => set_stencil_faces(&mut state.stencil_write_masks, face_mask, write_mask),
+                Command::SetStencilReference {
+                    face_mask,
+                    reference,
+                } => set_stencil_faces(&mut state.stencil_references, face_mask, reference),
+                Command::BindIndexBuffer {
+                    buffer,
+                    offset,
+                    index_type,
+                } => state.index_buffer = Some((buffer, offset as usize, index_type)),
+                Command::BindVertexBuffers {
+                    first_binding,
+                    buffers,
+                    offsets,
+                } => unsafe { state.bind_vertex_buffers(first_binding, buffers, offsets) },
+                Command::BindDescriptorSets {
+                    pipeline_bind_point,
+                    layout,
+                    first_set,
+                    descriptor_sets,
+                    dynamic_offsets,
+                } => unsafe {
+                    state.descriptor_sets_mut(pipeline_bind_point).bind(
+                        &layout,
+                        first_set as usize,
+                        descriptor_sets,
+                        dynamic_offsets,
+                    )
+                },
+                Command::PushDescriptorSet {
+                    pipeline_bind_point,
+                    layout,
+                    set,
+                    runs,
+                    elements,
+                } => state.descriptor_sets_mut(pipeline_bind_point).push(
+                    &layout,
+                    set as usize,
+                    runs,
+                    elements,
+                ),
+                Command::PushConstants {
+                    layout,
+                    stage_flags: _,
+                    offset,
+                    values,
+                } => state.push_constants(&layout, offset as usize, values),
+                Command::Draw {
+                    vertex_count,
+                    instance_count,
+                    first_vertex,
+                    first_instance,
+                } => unsafe {
+                    state.draw(
+                        context,
+                        "Draw",
+                        |_| DrawVertices::Sequential {
+                            first_vertex,
+                            vertex_count,
+                        },
+                        first_instance..first_instance + instance_count,
+                    )?
+                },
+                Command::DrawIndexed {
+                    index_count,
+                    instance_count,
+                    first_index,
+                    vertex_offset,
+                    first_instance,
+                } => unsafe {
+                    let index_buffer = state.index_buffer.expect("no index buffer bound");
+                    state.draw(
+                        context,
+                        "DrawIndexed",
+                        |primitive_restart| {
+                            get_indexes(
+                                index_buffer,
+                                first_index,
+                                index_count,
+                                vertex_offset,
+                                primitive_restart,
+                            )
+                        },
+                        first_instance..first_instance + instance_count,
+                    )?
+                },
+                Command::DrawIndirect {
+                    buffer,
+                    offset,
+                    draw_count,
+                    stride,
+                } => unsafe { state.draw_indirect(context, buffer, offset, draw_count, stride)? },
+                Command::DrawIndexedIndirect {
+                    buffer,
+                    offset,
+                    draw_count,
+                    stride,
+                } => unsafe {
+                    state.draw_indexed_indirect(context, buffer, offset, draw_count, stride)?
+                },
+                Command::Dispatch {
+                    base_group,
+                    group_count,
+                } => state.dispatch(
+                    context,
+                    &mut graph,
+                    api::VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                    Vec::new(),
+                    move || (base_group, group_count),
+                ),
+                Command::DispatchIndirect { buffer, offset } => {
+                    let access = unsafe {
+                        get_buffer_access(
+                            &buffer,
+                            offset,
+                            mem::size_of::<api::VkDispatchIndirectCommand>() as api::VkDeviceSize,
+                            false,
+                        )
+                    };
+                    state.dispatch(
+                        context,
+                        &mut graph,
+                        api::VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT
+                            | api::VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                        vec![access],
+                        move || {
+                            let command = unsafe {
+                                *(get_buffer_pointer(&buffer, offset as usize)
+                                    as *const api::VkDispatchIndirectCommand)
+                            };
+                            ([0; 3], [command.x, command.y, command.z])
+                        },
+                    );
+                }
+                Command::BeginRenderPass {
+                    render_pass,
+                    framebuffer,
+                    render_area,
+                    clear_values,
+                    contents: _,
+                } => {
+                    assert!(state.render_pass_instance.is_none());
+                    state.render_pass_instance = Some(RenderPassInstance::new(
+                        render_pass,
+                        framebuffer,
+                        render_area,
+                        clear_values,
+                    ));
+                }
+                Command::NextSubpass { contents: _ } => state
+                    .render_pass_instance
+                    .as_mut()
+                    .expect("not in a render pass")
+                    .next_subpass(),
+                Command::EndRenderPass {} => state.end_render_pass(context),
+                Command::ClearAttachments { attachments, rects } => state
+                    .render_pass_instance
+                    .as_mut()
+                    .expect("not in a render pass")
+                    .clear_attachments(attachments, rects),
+                Command::PipelineBarrier {
+                    src_stage_mask,
+                    dst_stage_mask,
+                    ..
+                } => {
+                    // layout transitions don't change memory here, so only the stage masks
+                    // matter
+                    graph.barrier(src_stage_mask, dst_stage_mask)
+                }
+                Command::SetDeviceMask { .. } => {}
+                Command::SetEvent {
+                    event,
+                    stage_mask: _,
+                } => event.set(),
+                Command::ResetEvent {
+                    event,
+                    stage_mask: _,
+                } => event.reset(),
+                Command::WaitEvents { events, .. } => {
+                    // commands before this one have already finished, so only events set
+                    // from the host or another queue can still be pending
+                    for &event in events {
+                        unsafe { SharedHandle::from(event) }.unwrap().wait();
+                    }
+                }
+                Command::BeginQuery {
+                    query_pool,
+                    query,
+                    flags: _,
+                } => state.begin_query(context, query_pool, query),
+                Command::EndQuery { query_pool, query } => {
+                    state.end_query(context, query_pool, query)
+                }
+                Command::ResetQueryPool {
+                    query_pool,
+                    first_query,
+                    query_count,
+                } => query_pool.reset(first_query..first_query + query_count),
+                Command::WriteTimestamp {
+                    pipeline_stage: _,
+                    query_pool,
+                    query,
+                } => {
+                    // the commands before this one have already finished, except for the
+                    // tiles of a render pass instance that hasn't ended yet
+                    query_pool.write_timestamp(query, timestamp::get_timestamp())
+                }
+                Command::CopyQueryPoolResults {
+                    query_pool,
+                    first_query,
+                    query_count,
+                    dst_buffer,
+                    dst_offset,
+                    stride,
+                    flags,
+                } => unsafe {
+                    query_pool.get_results(
+                        first_query..first_query + query_count,
+                        get_buffer_pointer(&dst_buffer, dst_offset as usize) as *mut u8,
+                        stride as usize,
+                        flags,
+                    );
+                },
+                Command::CopyBuffer { .. }
+                | Command::CopyImage { .. }
+                | Command::BlitImage { .. }
+                | Command::CopyBufferToImage { .. }
+                | Command::CopyImageToBuffer { .. }
+                | Command::UpdateBuffer { .. }
+                | Command::FillBuffer { .. }
+                | Command::ClearColorImage { .. }
+                | Command::ClearDepthStencilImage { .. }
+                | Command::ResolveImage { .. } => graph.add(
+                    context,
+                    api::VK_PIPELINE_STAGE_TRANSFER_BIT,
+                    unsafe { get_transfer_accesses(&command) },
+                    move |context| unsafe { execute_transfer(context, command) },
+                ),
+                Command::ExecuteCommands { command_buffers } => {
+                    for &command_buffer in command_buffers {
+                        // secondary command buffers don't inherit any state other than the
+                        // render pass they continue and the queries waiting for it to end
+                        let mut secondary_state = ExecutionState {
+                            render_pass_instance: state.render_pass_instance.take(),
+                            ending_queries: mem::replace(&mut state.ending_queries, Vec::new()),
+                            ..ExecutionState::default()
+                        };
+                        unsafe { SharedHandle::from(command_buffer) }
+                            .unwrap()
+                            .execute_with_state(context, &mut secondary_state)?;
+                        state.render_pass_instance = secondary_state.render_pass_instance;
+                        state.ending_queries = secondary_state.ending_queries;
+                    }
+                }
+                _ => unimplemented!("executing {}", command.name()),
+            }
+        }
+        graph.run(context);
+        Ok(())
+    }
+}
+
+pub struct CommandPool {
+    reset_command_buffer_allowed: bool,
+    free_chunks: Mutex<Vec<Chunk>>,
+    command_buffers: Vec<OwnedHandle<api::VkCommandBuffer>>,
+}
+
+impl CommandPool {
+    pub fn new(flags: api::VkCommandPoolCreateFlags, queue_family_index: u32) -> Self {
+        assert_eq!(flags & api::VK_COMMAND_POOL_CREATE_PROTECTED_BIT, 0);
+        assert!(queue_family_index < QUEUE_FAMILY_COUNT);
+        Self {
+            reset_command_buffer_allowed: flags
+                & api::VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT
+                != 0,
+            free_chunks: Mutex::new(Vec::new()),
+            command_buffers: Vec::new(),
+        }
+    }
+    fn allocate_chunk(&self, min_size: usize) -> Chunk {
+        if min_size <= CHUNK_SIZE {
+            if let Some(chunk) = self.free_chunks.lock().unwrap().pop() {
+                return chunk;
+            }
+        }
+        Chunk::new(min_size.max(CHUNK_SIZE))
+    }
+    fn recycle_chunks<I: IntoIterator<Item = Chunk>>(&self, chunks: I) {
+        let mut free_chunks = self.free_chunks.lock().unwrap();
+        for mut chunk in chunks {
+            if chunk.size == CHUNK_SIZE {
+                chunk.used = 0;
+                free_chunks.push(chunk);
+            }
+        }
+    }
+    pub unsafe fn allocate(
+        &mut self,
+        pool: SharedHandle<api::VkCommandPool>,
+        level: api::VkCommandBufferLevel,
+        output_command_buffers: &mut [api::VkCommandBuffer],
+    ) {
+        let start_index = self.command_buffers.len();
+        self.command_buffers
+            .extend(output_command_buffers.iter().map(|_| {
+                OwnedHandle::new(CommandBuffer {
+                    pool,
+                    level,
+                    state: CommandBufferState::Initial,
+                    chunks: Vec::new(),
+                })
+            }));
+        for (output_command_buffer, command_buffer) in output_command_buffers
+            .iter_mut()
+            .zip(self.command_buffers[start_index..].iter())
+        {
+            *output_command_buffer = command_buffer.get_handle();
+        }
+    }
+    pub unsafe fn free(&mut self, command_buffers: &[api::VkCommandBuffer]) {
+        let mut freed_chunks = Vec::new();
+        let mut index = 0;
+        while index < self.command_buffers.len() {
+            if command_buffers.contains(&self.command_buffers[index].get_handle()) {
+                let mut command_buffer = self.command_buffers.swap_remove(index);
+                freed_chunks.extend(command_buffer.take_chunks());
+            } else {
+                index += 1;
+            }
+        }
+        self.recycle_chunks(freed_chunks);
+    }
+    pub fn reset(&mut self, release_resources: bool) {
+        let mut freed_chunks = Vec::new();
+        for command_buffer in &mut self.command_buffers {
+            freed_chunks.extend(command_buffer.take_chunks());
+        }
+        if release_resources {
+            self.trim();
+        } else {
+            self.recycle_chunks(freed_chunks);
+        }
+    }
+    pub fn trim(&mut self) {
+        self.free_chunks.lock().unwrap().clear();
+    }
+}
@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! compute dispatch.
+//!
+//! The workgroups are split into batches of consecutive workgroups, each run by one worker.
+//! Every worker keeps its workgroup memory and fibers from one workgroup to the next, so
+//! starting a workgroup doesn't allocate. The calls of the entry point for a workgroup run one
+//! after the other, unless the shader has barriers: then each call gets a fiber, and the fibers
+//! are resumed in turn until they all finish, each suspending at every barrier. Where there are
+//! no fibers, each call gets a thread instead, and the threads wait for each other at every
+//! barrier.
+
+use crate::descriptor_set::ShaderDescriptorSets;
+#[cfg(all(target_arch = "x86_64", target_os = "linux"))]
+use crate::fiber::{Fiber, FiberHandle};
+use crate::query::PipelineStatistic;
+use crate::queue::ExecutionContext;
+use shader_compiler::{
+    ComputeDispatchInfo, ComputePipeline, ComputeShaderEntrypoint, ComputeShaderInvocation,
+};
+use std::alloc::{self, Layout};
+use std::cell::RefCell;
+use std::ffi::c_void;
+use std::panic::{self, AssertUnwindSafe};
+use std::ptr;
+#[cfg(not(all(target_arch = "x86_64", target_os = "linux")))]
+use std::sync::Barrier;
+#[cfg(not(all(target_arch = "x86_64", target_os = "linux")))]
+use std::thread;
+
+/// a cache line, so the workgroup memory of different workers is never in the same one
+const WORKGROUP_MEMORY_ALIGNMENT: usize = 64;
+
+/// batches have at least this many invocations, so the overhead of scheduling them is spread
+/// over a lot of small workgroups
+const MIN_BATCH_INVOCATION_COUNT: usize = 1024;
+
+/// the descriptor sets and push constants passed to a dispatch's shader, taken when the
+/// dispatch is recorded since later commands can bind others before it runs
+#[derive(Debug)]
+pub struct ShaderResources {
+    pub descriptor_sets: ShaderDescriptorSets,
+    pub push_constants: Vec<u32>,
+}
+
+// the descriptors point into objects the application isn't allowed to change while the
+// submission is pending
+unsafe impl Sync for ShaderResources {}
+
+/// only grows, so it's allocated about once per worker
+struct WorkgroupMemory {
+    memory: *mut u8,
+    layout: Layout,
+}
+
+impl WorkgroupMemory {
+    fn new() -> Self {
+        Self {
+            memory: ptr::null_mut(),
+            layout: Layout::from_size_align(0, WORKGROUP_MEMORY_ALIGNMENT).unwrap(),
+        }
+    }
+    /// the contents are left over from the last workgroup
+    fn get(&mut self, size: usize) -> *mut u8 {
+        if size > self.layout.size() {
+            let size = (size + WORKGROUP_MEMORY_ALIGNMENT - 1) & !(WORKGROUP_MEMORY_ALIGNMENT - 1);
+            let layout = Layout::from_size_align(size, WORKGROUP_MEMORY_ALIGNMENT).unwrap();
+            unsafe {
+                if !self.memory.is_null() {
+                    alloc::dealloc(self.memory, self.layout);
+                }
+                self.memory = alloc::alloc(layout);
+            }
+            if self.memory.is_null() {
+                alloc::handle_alloc_error(layout);
+            }
+            self.layout = layout;
+        }
+        self.memory
+    }
+}
+
+impl Drop for WorkgroupMemory {
+    fn drop(&mut self) {
+        if !self.memory.is_null() {
+            unsafe { alloc::dealloc(self.memory, self.layout) }
+        }
+    }
+}
+
+struct WorkerState {
+    workgroup_memory: WorkgroupMemory,
+    #[cfg(all(target_arch = "x86_64", target_os = "linux"))]
+    fibers: Vec<Fiber>,
+}
+
+thread_local! {
+    static WORKER_STATE: RefCell<WorkerState> = RefCell::new(WorkerState {
+        workgroup_memory: WorkgroupMemory::new(),
+        #[cfg(all(target_arch = "x86_64", target_os = "linux"))]
+        fibers: Vec::new(),
+    });
+}
+
+/// used when there's only one call for the workgroup, so every invocation it runs is already at
+/// the barrier
+unsafe extern "C" fn single_call_barrier(_barrier_context: *mut c_void) {}
+
+#[cfg(all(target_arch = "x86_64", target_os = "linux"))]
+unsafe extern "C" fn fiber_barrier(barrier_context: *mut c_void) {
+    FiberHandle::from_raw(barrier_context).suspend();
+}
+
+#[cfg(all(target_arch = "x86_64", target_os = "linux"))]
+fn run_calls_on_fibers(
+    fibers: &mut Vec<Fiber>,
+    call_count: usize,
+    call: &dyn Fn(u32, FiberHandle),
+) {
+    while fibers.len() < call_count {
+        fibers.push(Fiber::new());
+    }
+    let fibers = &mut fibers[..call_count];
+    let body = |fiber: FiberHandle, call_index: usize| call(call_index as u32, fiber);
+    for (call_index, fiber) in fibers.iter_mut().enumerate() {
+        unsafe { fiber.start(&body, call_index) };
+    }
+    let result = panic::catch_unwind(AssertUnwindSafe(|| {
+        let mut running_count = call_count;
+        while running_count != 0 {
+            for fiber in fibers.iter_mut() {
+                if !fiber.is_finished() {
+                    fiber.resume();
+                    if fiber.is_finished() {
+                        running_count -= 1;
+                    }
+                }
+            }
+        }
+    }));
+    if let Err(payload) = result {
+        // the other fibers are stopped wherever they were
+        for fiber in fibers.iter_mut() {
+            fiber.abandon();
+        }
+        panic::resume_unwind(payload);
+    }
+}
+
+#[cfg(not(all(target_arch = "x86_64", target_os = "linux")))]
+unsafe extern "C" fn thread_barrier(barrier_context: *mut c_void) {
+    (*(barrier_context as *const Barrier)).wait();
+}
+
+/// much slower than fibers, since every workgroup starts a thread for each call
+#[cfg(not(all(target_arch = "x86_64", target_os = "linux")))]
+fn run_calls_on_threads(call_count: usize, call: &dyn Fn(u32, *mut c_void)) {
+    struct SharedCall<'a>(&'a dyn Fn(u32, *mut c_void));
+    // the calls only share what the invocations of a workgroup share anyway
+    unsafe impl Sync for SharedCall<'_> {}
+    let call = SharedCall(call);
+    let barrier = Barrier::new(call_count);
+    thread::scope(|scope| {
+        for call_index in 0..call_count {
+            let (call, barrier) = (&call, &barrier);
+            scope.spawn(move || (call.0)(call_index as u32, barrier as *const _ as *mut c_void));
+        }
+    });
+}
+
+unsafe fn run_workgroup(
+    worker_state: &mut WorkerState,
+    entrypoint: ComputeShaderEntrypoint,
+    dispatch_info: &ComputeDispatchInfo,
+    resources: &ShaderResources,
+    workgroup_id: [u32; 3],
+) {
+    let workgroup_memory = worker_state
+        .workgroup_memory
+        .get(dispatch_info.workgroup_memory_size);
+    let call_count = dispatch_info.get_call_count();
+    let get_invocation =
+        |call_index: u32,
+         barrier: unsafe extern "C" fn(*mut c_void),
+         barrier_context: *mut c_void| ComputeShaderInvocation {
+            workgroup_id,
+            first_local_invocation_index: call_index * dispatch_info.lane_count,
+            workgroup_memory,
+            descriptor_sets: resources.descriptor_sets.sets.as_ptr(),
+            push_constants: resources.push_constants.as_ptr() as *const u8,
+            barrier,
+            barrier_context,
+        };
+    if call_count == 1 || !dispatch_info.has_control_barriers {
+        for call_index in 0..call_count as u32 {
+            entrypoint(&get_invocation(
+                call_index,
+                single_call_barrier,
+                ptr::null_mut(),
+            ));
+        }
+        return;
+    }
+    #[cfg(all(target_arch = "x86_64", target_os = "linux"))]
+    run_calls_on_fibers(
+        &mut worker_state.fibers,
+        call_count,
+        &|call_index, fiber| {
+            entrypoint(&get_invocation(call_index, fiber_barrier, fiber.into_raw()))
+        },
+    );
+    #[cfg(not(all(target_arch = "x86_64", target_os = "linux")))]
+    run_calls_on_threads(call_count, &|call_index, barrier_context| {
+        entrypoint(&get_invocation(call_index, thread_barrier, barrier_context))
+    });
+}
+
+pub fn dispatch(
+    context: &ExecutionContext,
+    pipeline: &ComputePipeline,
+    resources: &ShaderResources,
+    base_group: [u32; 3],
+    group_count: [u32; 3],
+) {
+    kazan_trace::trace_scope!("compute::dispatch");
+    let dispatch_info = *pipeline.dispatch_info();
+    let entrypoint = pipeline.get_entrypoint();
+    let invocation_count = dispatch_info.get_invocation_count().max(1);
+    let min_batch_size = (MIN_BATCH_INVOCATION_COUNT + invocation_count - 1) / invocation_count;
+    context.dispatch_workgroups(group_count, min_batch_size, &|workgroup_ids| {
+        WORKER_STATE.with(|worker_state| {
+            let worker_state = &mut *worker_state.borrow_mut();
+            let mut group_count = 0;
+            for workgroup_id in workgroup_ids {
+                let workgroup_id = [
+                    base_group[0] + workgroup_id[0],
+                    base_group[1] + workgroup_id[1],
+                    base_group[2] + workgroup_id[2],
+                ];
+                unsafe {
+                    run_workgroup(
+                        worker_state,
+                        entrypoint,
+                        &dispatch_info,
+                        resources,
+                        workgroup_id,
+                    )
+                }
+                group_count += 1;
+            }
+            context.add_pipeline_statistic(
+                PipelineStatistic::ComputeShaderInvocations,
+                group_count * invocation_count as u64,
+            );
+        })
+    });
+}
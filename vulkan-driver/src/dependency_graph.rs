@@ -0,0 +1,484 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! which of a command buffer's dispatches and transfers have to wait for which, so the ones
+//! that don't depend on each other run at the same time, even on opposite sides of a barrier.
+//!
+//! A later command waits for an earlier one only when a chain of barriers orders the earlier
+//! command's stages before the later command's stages, and they access overlapping memory with
+//! at least one of them writing. Memory is always coherent here, so nothing else a barrier
+//! could be for is observable. The buffer and image ranges in a barrier can't narrow this
+//! down, since its execution dependency covers every command in its stage masks, so the ranges
+//! come from the commands themselves.
+
+use crate::api;
+use crate::queue::ExecutionContext;
+use std::mem;
+use std::ops::Range;
+use std::sync::atomic::{AtomicUsize, Ordering};
+
+/// more commands than this are run before adding another, to bound the time spent finding
+/// dependencies
+const MAX_JOB_COUNT: usize = 256;
+
+const ALL_STAGES: api::VkPipelineStageFlags = !0;
+
+/// the stages of the graphics pipeline, in order
+const GRAPHICS_STAGES: &[api::VkPipelineStageFlagBits] = &[
+    api::VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+    api::VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+    api::VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+    api::VK_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT,
+    api::VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT,
+    api::VK_PIPELINE_STAGE_GEOMETRY_SHADER_BIT,
+    api::VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
+    api::VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+    api::VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+    api::VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+];
+
+fn all_graphics_stages() -> api::VkPipelineStageFlags {
+    GRAPHICS_STAGES
+        .iter()
+        .fold(0, |stages, &stage| stages | stage)
+}
+
+/// the stages in a barrier's first synchronization scope, which includes the stages
+/// logically earlier than the ones in `stage_mask`
+fn expand_src_stage_mask(stage_mask: api::VkPipelineStageFlags) -> api::VkPipelineStageFlags {
+    if stage_mask
+        & (api::VK_PIPELINE_STAGE_ALL_COMMANDS_BIT | api::VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT)
+        != 0
+    {
+        return ALL_STAGES;
+    }
+    let mut retval = stage_mask;
+    if stage_mask & api::VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT != 0 {
+        retval |= all_graphics_stages();
+    }
+    if let Some(last) = GRAPHICS_STAGES
+        .iter()
+        .rposition(|&stage| retval & stage != 0)
+    {
+        retval |= GRAPHICS_STAGES[..last]
+            .iter()
+            .fold(0, |stages, &stage| stages | stage);
+    }
+    if stage_mask & api::VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT != 0 {
+        retval |= api::VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+    }
+    retval
+}
+
+/// the stages in a barrier's second synchronization scope, which includes the stages
+/// logically later than the ones in `stage_mask`
+fn expand_dst_stage_mask(stage_mask: api::VkPipelineStageFlags) -> api::VkPipelineStageFlags {
+    if stage_mask
+        & (api::VK_PIPELINE_STAGE_ALL_COMMANDS_BIT | api::VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT)
+        != 0
+    {
+        return ALL_STAGES;
+    }
+    let mut retval = stage_mask;
+    if stage_mask & api::VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT != 0 {
+        retval |= all_graphics_stages();
+    }
+    if let Some(first) = GRAPHICS_STAGES
+        .iter()
+        .position(|&stage| retval & stage != 0)
+    {
+        retval |= GRAPHICS_STAGES[first..]
+            .iter()
+            .fold(0, |stages, &stage| stages | stage);
+    }
+    if stage_mask & api::VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT != 0 {
+        retval |= api::VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+    }
+    retval
+}
+
+/// a range of memory a command reads or writes
+#[derive(Clone, Debug)]
+pub struct MemoryAccess {
+    pub range: Range<usize>,
+    pub is_write: bool,
+}
+
+impl MemoryAccess {
+    pub fn new(pointer: *const u8, size: usize, is_write: bool) -> Self {
+        let start = pointer as usize;
+        Self {
+            range: start..start + size,
+            is_write,
+        }
+    }
+    fn conflicts_with(&self, other: &MemoryAccess) -> bool {
+        (self.is_write || other.is_write)
+            && self.range.start < other.range.end
+            && other.range.start < self.range.end
+    }
+}
+
+struct Job<'a> {
+    run: Box<dyn Fn(&ExecutionContext) + 'a>,
+    stages: api::VkPipelineStageFlags,
+    accesses: Vec<MemoryAccess>,
+    /// the stages of the commands after the barriers since this job was added that this job
+    /// has to finish before
+    ordered_before_stages: api::VkPipelineStageFlags,
+    successors: Vec<usize>,
+    predecessor_count: usize,
+}
+
+struct RunningJob<'a> {
+    run: Box<dyn Fn(&ExecutionContext) + 'a>,
+    successors: Vec<usize>,
+    remaining_predecessor_count: AtomicUsize,
+}
+
+// jobs only use command buffers and objects the application isn't allowed to change while the
+// submission is pending
+unsafe impl Sync for RunningJob<'_> {}
+
+/// runs `index`, then the jobs it was the last predecessor of. Jobs are started by the job that
+/// finishes their last dependency rather than waited for, so no worker blocks on a dependency.
+fn run_job(context: &ExecutionContext, jobs: &[RunningJob], index: usize) {
+    let job = &jobs[index];
+    (job.run)(context);
+    let ready: Vec<usize> = job
+        .successors
+        .iter()
+        .cloned()
+        .filter(|&successor| {
+            jobs[successor]
+                .remaining_predecessor_count
+                .fetch_sub(1, Ordering::AcqRel)
+                == 1
+        })
+        .collect();
+    context.parallel_for(ready.len(), 1, &|range| {
+        for &successor in &ready[range] {
+            run_job(context, jobs, successor);
+        }
+    });
+}
+
+#[derive(Default)]
+pub struct DependencyGraph<'a> {
+    jobs: Vec<Job<'a>>,
+}
+
+impl<'a> DependencyGraph<'a> {
+    pub fn new() -> Self {
+        Self::default()
+    }
+    /// adds a command that executes in `stages` and only accesses the memory in `accesses`.
+    /// It doesn't run before `run` is called.
+    pub fn add<F: Fn(&ExecutionContext) + 'a>(
+        &mut self,
+        context: &ExecutionContext,
+        stages: api::VkPipelineStageFlags,
+        accesses: Vec<MemoryAccess>,
+        run: F,
+    ) {
+        if self.jobs.len() >= MAX_JOB_COUNT {
+            self.run(context);
+        }
+        self.push(stages, accesses, Box::new(run));
+    }
+    /// adds a job after the jobs it has to wait for
+    fn push(
+        &mut self,
+        stages: api::VkPipelineStageFlags,
+        accesses: Vec<MemoryAccess>,
+        run: Box<dyn Fn(&ExecutionContext) + 'a>,
+    ) {
+        let index = self.jobs.len();
+        let mut predecessor_count = 0;
+        for job in &mut self.jobs {
+            if job.ordered_before_stages & stages != 0
+                && job.accesses.iter().any(|job_access| {
+                    accesses
+                        .iter()
+                        .any(|access| access.conflicts_with(job_access))
+                })
+            {
+                job.successors.push(index);
+                predecessor_count += 1;
+            }
+        }
+        self.jobs.push(Job {
+            run,
+            stages,
+            accesses,
+            ordered_before_stages: 0,
+            successors: Vec::new(),
+            predecessor_count,
+        });
+    }
+    /// records an execution dependency from the commands added so far to the commands added
+    /// after, including the ones it forms a chain with
+    pub fn barrier(
+        &mut self,
+        src_stage_mask: api::VkPipelineStageFlags,
+        dst_stage_mask: api::VkPipelineStageFlags,
+    ) {
+        let src_stages = expand_src_stage_mask(src_stage_mask);
+        let dst_stages = expand_dst_stage_mask(dst_stage_mask);
+        for job in &mut self.jobs {
+            if (job.stages | job.ordered_before_stages) & src_stages != 0 {
+                job.ordered_before_stages |= dst_stages;
+            }
+        }
+    }
+    /// runs all the commands added so far, returning once they have all finished
+    pub fn run(&mut self, context: &ExecutionContext) {
+        kazan_trace::trace_scope!("DependencyGraph::run");
+        let roots: Vec<usize> = (0..self.jobs.len())
+            .filter(|&index| self.jobs[index].predecessor_count == 0)
+            .collect();
+        let jobs: Vec<RunningJob> = mem::replace(&mut self.jobs, Vec::new())
+            .into_iter()
+            .map(|job| RunningJob {
+                run: job.run,
+                successors: job.successors,
+                remaining_predecessor_count: AtomicUsize::new(job.predecessor_count),
+            })
+            .collect();
+        context.parallel_for(roots.len(), 1, &|range| {
+            for &root in &roots[range] {
+                run_job(context, &jobs, root);
+            }
+        });
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::image::{ImageMultisampleCount, ImageProperties, SupportedTilings, Tiling};
+
+    const COMPUTE: api::VkPipelineStageFlags = api::VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+    const TRANSFER: api::VkPipelineStageFlags = api::VK_PIPELINE_STAGE_TRANSFER_BIT;
+
+    fn read(range: Range<usize>) -> Vec<MemoryAccess> {
+        vec![MemoryAccess {
+            range,
+            is_write: false,
+        }]
+    }
+
+    fn write(range: Range<usize>) -> Vec<MemoryAccess> {
+        vec![MemoryAccess {
+            range,
+            is_write: true,
+        }]
+    }
+
+    /// whether the second command waits for the first, with `barriers` between them
+    fn waits_for(
+        (first_stages, first_accesses): (api::VkPipelineStageFlags, Vec<MemoryAccess>),
+        barriers: &[(api::VkPipelineStageFlags, api::VkPipelineStageFlags)],
+        (second_stages, second_accesses): (api::VkPipelineStageFlags, Vec<MemoryAccess>),
+    ) -> bool {
+        let mut graph = DependencyGraph::new();
+        graph.push(first_stages, first_accesses, Box::new(|_| {}));
+        for &(src_stage_mask, dst_stage_mask) in barriers {
+            graph.barrier(src_stage_mask, dst_stage_mask);
+        }
+        graph.push(second_stages, second_accesses, Box::new(|_| {}));
+        let waits = graph.jobs[0].successors == [1];
+        assert_eq!(graph.jobs[1].predecessor_count, waits as usize);
+        waits
+    }
+
+    #[test]
+    fn test_hazards() {
+        let barrier = &[(COMPUTE, COMPUTE)];
+        // read after write
+        assert!(waits_for(
+            (COMPUTE, write(0..16)),
+            barrier,
+            (COMPUTE, read(0..16))
+        ));
+        // write after write
+        assert!(waits_for(
+            (COMPUTE, write(0..16)),
+            barrier,
+            (COMPUTE, write(0..16))
+        ));
+        // write after read
+        assert!(waits_for(
+            (COMPUTE, read(0..16)),
+            barrier,
+            (COMPUTE, write(0..16))
+        ));
+        // read after read
+        assert!(!waits_for(
+            (COMPUTE, read(0..16)),
+            barrier,
+            (COMPUTE, read(0..16))
+        ));
+        // any of the accesses can conflict
+        assert!(waits_for(
+            (COMPUTE, [read(0..16), write(32..48)].concat()),
+            barrier,
+            (COMPUTE, [read(16..32), read(40..44)].concat())
+        ));
+    }
+
+    #[test]
+    fn test_ranges() {
+        let barrier = &[(COMPUTE, COMPUTE)];
+        let waits_for_range = |second: Range<usize>| {
+            waits_for((COMPUTE, write(16..32)), barrier, (COMPUTE, read(second)))
+        };
+        assert!(!waits_for_range(0..16));
+        assert!(!waits_for_range(32..48));
+        assert!(waits_for_range(0..17));
+        assert!(waits_for_range(31..48));
+        assert!(waits_for_range(20..24));
+        assert!(waits_for_range(0..48));
+    }
+
+    #[test]
+    fn test_subresources() {
+        // not a multiple of the tile size, so the mip levels don't all take whole tiles
+        let properties = ImageProperties {
+            supported_tilings: SupportedTilings::Any,
+            format: api::VK_FORMAT_R8G8B8A8_UNORM,
+            extents: api::VkExtent3D {
+                width: 13,
+                height: 9,
+                depth: 1,
+            },
+            array_layers: 3,
+            mip_levels: 4,
+            multisample_count: ImageMultisampleCount::Count1,
+            swapchain_present_tiling: None,
+        };
+        let get_range = |(mip_level, base_array_layer, layer_count)| {
+            properties.get_subresources_range(
+                Tiling::Tiled,
+                mip_level,
+                base_array_layer,
+                layer_count,
+            )
+        };
+        let waits_for_subresources = |first, second| {
+            waits_for(
+                (TRANSFER, write(get_range(first))),
+                &[(TRANSFER, TRANSFER)],
+                (TRANSFER, read(get_range(second))),
+            )
+        };
+        assert!(waits_for_subresources((1, 1, 1), (1, 1, 1)));
+        assert!(!waits_for_subresources((1, 0, 1), (1, 1, 1)));
+        assert!(!waits_for_subresources((1, 1, 1), (1, 2, 1)));
+        assert!(waits_for_subresources((1, 0, 3), (1, 1, 1)));
+        assert!(waits_for_subresources((3, 1, 2), (3, 2, 1)));
+        for mip_level in 0..3 {
+            assert!(!waits_for_subresources(
+                (mip_level, 0, 3),
+                (mip_level + 1, 0, 3)
+            ));
+            assert!(!waits_for_subresources(
+                (mip_level + 1, 0, 1),
+                (mip_level, 2, 1)
+            ));
+        }
+    }
+
+    #[test]
+    fn test_stage_masks() {
+        let waits_for_barrier = |barrier, second_stages| {
+            waits_for(
+                (COMPUTE, write(0..16)),
+                &[barrier],
+                (second_stages, read(0..16)),
+            )
+        };
+        assert!(!waits_for(
+            (COMPUTE, write(0..16)),
+            &[],
+            (COMPUTE, read(0..16))
+        ));
+        assert!(waits_for_barrier((COMPUTE, TRANSFER), TRANSFER));
+        assert!(!waits_for_barrier((COMPUTE, TRANSFER), COMPUTE));
+        assert!(!waits_for_barrier((TRANSFER, COMPUTE), COMPUTE));
+        let all_commands = api::VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        assert!(waits_for_barrier((all_commands, all_commands), COMPUTE));
+        let top_of_pipe = api::VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        let bottom_of_pipe = api::VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+        assert!(waits_for_barrier((bottom_of_pipe, COMPUTE), COMPUTE));
+        assert!(waits_for_barrier((COMPUTE, top_of_pipe), COMPUTE));
+        assert!(!waits_for_barrier((top_of_pipe, COMPUTE), COMPUTE));
+        assert!(!waits_for_barrier((COMPUTE, bottom_of_pipe), COMPUTE));
+        // compute shaders are after indirect draw parameters are read
+        let draw_indirect = api::VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+        assert!(waits_for_barrier((COMPUTE, draw_indirect), COMPUTE));
+        assert!(!waits_for_barrier((draw_indirect, COMPUTE), COMPUTE));
+        let fragment_shader = api::VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        assert!(!waits_for_barrier((fragment_shader, COMPUTE), COMPUTE));
+        assert!(!waits_for_barrier((COMPUTE, fragment_shader), COMPUTE));
+    }
+
+    #[test]
+    fn test_barrier_chains() {
+        let waits_for_barriers =
+            |barriers: &[_]| waits_for((COMPUTE, write(0..16)), barriers, (COMPUTE, read(0..16)));
+        assert!(waits_for_barriers(&[
+            (COMPUTE, TRANSFER),
+            (TRANSFER, COMPUTE)
+        ]));
+        assert!(waits_for_barriers(&[
+            (COMPUTE, TRANSFER),
+            (TRANSFER, TRANSFER),
+            (TRANSFER, COMPUTE)
+        ]));
+        // the chain is broken
+        assert!(!waits_for_barriers(&[
+            (COMPUTE, TRANSFER),
+            (api::VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, COMPUTE)
+        ]));
+        // in the wrong order
+        assert!(!waits_for_barriers(&[
+            (TRANSFER, COMPUTE),
+            (COMPUTE, TRANSFER)
+        ]));
+        // a barrier before both commands orders neither
+        let mut graph = DependencyGraph::new();
+        graph.barrier(COMPUTE, COMPUTE);
+        graph.push(COMPUTE, write(0..16), Box::new(|_| {}));
+        graph.push(COMPUTE, read(0..16), Box::new(|_| {}));
+        assert_eq!(graph.jobs[1].predecessor_count, 0);
+    }
+
+    #[test]
+    fn test_expand_stage_masks() {
+        let vertex_shader = api::VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+        let fragment_shader = api::VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        let late_fragment_tests = api::VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+        let draw_indirect = api::VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+        let color_attachment_output = api::VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        let src_stages = expand_src_stage_mask(fragment_shader);
+        assert_ne!(src_stages & vertex_shader, 0);
+        assert_ne!(src_stages & draw_indirect, 0);
+        assert_eq!(src_stages & late_fragment_tests, 0);
+        assert_eq!(src_stages & COMPUTE, 0);
+        let dst_stages = expand_dst_stage_mask(vertex_shader);
+        assert_ne!(dst_stages & color_attachment_output, 0);
+        assert_eq!(dst_stages & draw_indirect, 0);
+        assert_eq!(dst_stages & COMPUTE, 0);
+        let all_graphics = api::VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT;
+        for &stages in &[
+            expand_src_stage_mask(all_graphics),
+            expand_dst_stage_mask(all_graphics),
+        ] {
+            assert_eq!(stages & all_graphics_stages(), all_graphics_stages());
+            assert_eq!(stages & (COMPUTE | TRANSFER), 0);
+        }
+        assert_eq!(expand_src_stage_mask(TRANSFER), TRANSFER);
+        assert_eq!(expand_dst_stage_mask(TRANSFER), TRANSFER);
+    }
+}
@@ -3,11 +3,18 @@
 
 use crate::api;
 use crate::buffer::BufferSlice;
-use crate::handle::OwnedHandle;
-use crate::handle::SharedHandle;
+use crate::dependency_graph::MemoryAccess;
+use crate::device_memory::DeviceMemoryAllocation;
+use crate::handle::{Handle, SharedHandle};
 use crate::image;
+use crate::pipeline::PipelineLayout;
 use crate::util;
+use shader_compiler::ShaderDescriptorSet;
+use std::ffi::c_void;
+use std::mem;
 use std::ops;
+use std::ptr::{self, null_mut, NonNull};
+use std::slice;
 
 #[derive(Debug)]
 pub enum DescriptorLayout {
@@ -49,7 +56,6 @@ pub enum DescriptorLayout {
 }
 
 impl DescriptorLayout {
-    #[allow(dead_code)]
     pub fn count(&self) -> usize {
         match *self {
             DescriptorLayout::Sampler { count, .. } => count,
@@ -65,7 +71,6 @@ impl DescriptorLayout {
             DescriptorLayout::InputAttachment { count } => count,
         }
     }
-    #[allow(dead_code)]
     pub fn immutable_samplers(&self) -> Option<&[SharedHandle<api::VkSampler>]> {
         match self {
             DescriptorLayout::Sampler {
@@ -104,6 +109,16 @@ impl DescriptorLayout {
             DescriptorLayout::InputAttachment { .. } => api::VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT,
         }
     }
+    /// whether shaders can write through descriptors of this type
+    pub fn is_writable(&self) -> bool {
+        match self {
+            DescriptorLayout::StorageImage { .. }
+            | DescriptorLayout::StorageTexelBuffer { .. }
+            | DescriptorLayout::StorageBuffer { .. }
+            | DescriptorLayout::StorageBufferDynamic { .. } => true,
+            _ => false,
+        }
+    }
     pub unsafe fn from(v: &api::VkDescriptorSetLayoutBinding) -> Self {
         let get_immutable_samplers = || {
             if v.pImmutableSamplers.is_null() {
@@ -169,103 +184,260 @@ impl DescriptorLayout {
 #[derive(Debug)]
 pub struct DescriptorSetLayout {
     pub bindings: Vec<Option<DescriptorLayout>>,
+    /// the index in `DescriptorSet::elements` of the first element of each binding
+    pub binding_offsets: Vec<usize>,
+    pub element_count: usize,
+    /// for each dynamic uniform or storage buffer binding, the index of the dynamic offset for
+    /// its first element in the offsets passed when binding a set with this layout
+    pub dynamic_offset_indexes: Vec<Option<usize>>,
+    pub dynamic_offset_count: usize,
+}
+
+impl DescriptorSetLayout {
+    pub fn new(bindings: Vec<Option<DescriptorLayout>>) -> Self {
+        let mut element_count = 0;
+        let binding_offsets = bindings
+            .iter()
+            .map(|binding| {
+                let offset = element_count;
+                element_count += binding.as_ref().map_or(0, DescriptorLayout::count);
+                offset
+            })
+            .collect();
+        let mut dynamic_offset_count = 0;
+        let dynamic_offset_indexes = bindings
+            .iter()
+            .map(|binding| match binding {
+                Some(DescriptorLayout::UniformBufferDynamic { count })
+                | Some(DescriptorLayout::StorageBufferDynamic { count }) => {
+                    let index = dynamic_offset_count;
+                    dynamic_offset_count += count;
+                    Some(index)
+                }
+                _ => None,
+            })
+            .collect();
+        Self {
+            bindings,
+            binding_offsets,
+            element_count,
+            dynamic_offset_indexes,
+            dynamic_offset_count,
+        }
+    }
+    /// sets `elements`, which start at the element with index `element_index`, to what they are
+    /// in a newly allocated set
+    fn initialize_elements(&self, element_index: usize, elements: &mut [DescriptorElement]) {
+        for element in elements.iter_mut() {
+            *element = DescriptorElement::EMPTY;
+        }
+        for (binding, &offset) in self.bindings.iter().zip(&self.binding_offsets) {
+            if let Some(immutable_samplers) = binding.as_ref().and_then(|v| v.immutable_samplers())
+            {
+                for (index, &sampler) in immutable_samplers.iter().enumerate() {
+                    if let Some(element) = (offset + index)
+                        .checked_sub(element_index)
+                        .and_then(|index| elements.get_mut(index))
+                    {
+                        element.sampler = Some(sampler);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// one element of a descriptor, in the layout compiled shaders read descriptors in, so binding
+/// a descriptor set doesn't need any translation
+#[repr(C)]
+#[derive(Copy, Clone, Debug)]
+pub struct DescriptorElement {
+    /// the first byte of the range for buffer descriptors, or the first byte of the image's
+    /// memory for image descriptors
+    pub pointer: *mut u8,
+    /// the size of the range in bytes for buffer descriptors
+    pub size: usize,
+    pub image_view: Option<SharedHandle<api::VkImageView>>,
+    pub sampler: Option<SharedHandle<api::VkSampler>>,
+    pub tiling: image::Tiling,
+}
+
+impl DescriptorElement {
+    const EMPTY: Self = Self {
+        pointer: null_mut(),
+        size: 0,
+        image_view: None,
+        sampler: None,
+        tiling: image::Tiling::Linear,
+    };
+    unsafe fn set_image(&mut self, v: &api::VkDescriptorImageInfo) {
+        let image_view = SharedHandle::from(v.imageView).unwrap();
+        let memory = image_view.image.memory.as_ref().unwrap();
+        self.pointer = memory.device_memory.get().as_ptr().add(memory.offset);
+        self.tiling = image_view.image.properties.get_tiling(v.imageLayout);
+        self.image_view = Some(image_view);
+    }
+    unsafe fn set_buffer(&mut self, v: &api::VkDescriptorBufferInfo) {
+        let buffer_slice = BufferSlice::from(v);
+        let memory = buffer_slice.buffer.memory.as_ref().unwrap();
+        self.pointer = memory
+            .device_memory
+            .get()
+            .as_ptr()
+            .add(memory.offset + buffer_slice.offset);
+        self.size = buffer_slice.size;
+    }
 }
 
+/// a descriptor set's elements and the sets themselves all live in their pool, so resetting
+/// the pool doesn't need to visit each set.
+///
+/// Freed sets, when the pool allows them, are reused by later allocations from the same pool.
 #[derive(Debug)]
 pub struct DescriptorPool {
-    descriptor_sets: Vec<OwnedHandle<api::VkDescriptorSet>>,
+    /// the elements of every descriptor set allocated from this pool
+    elements: Box<[DescriptorElement]>,
+    /// the end of the elements that have been allocated since the pool was reset
+    used_element_count: usize,
+    /// ranges of `elements` below `used_element_count` that belong to freed sets
+    free_element_ranges: Vec<ops::Range<usize>>,
+    /// never grows past its initial capacity, so `VkDescriptorSet`s can point into it
+    descriptor_sets: Vec<DescriptorSet>,
+    free_descriptor_set_indexes: Vec<usize>,
 }
 
 impl DescriptorPool {
-    pub fn new() -> Self {
+    pub unsafe fn new(create_info: &api::VkDescriptorPoolCreateInfo) -> Self {
+        let pool_sizes = util::to_slice(create_info.pPoolSizes, create_info.poolSizeCount as usize);
+        let element_count = pool_sizes
+            .iter()
+            .map(|pool_size| pool_size.descriptorCount as usize)
+            .sum();
         Self {
-            descriptor_sets: Vec::new(),
+            elements: vec![DescriptorElement::EMPTY; element_count].into_boxed_slice(),
+            used_element_count: 0,
+            free_element_ranges: Vec::new(),
+            descriptor_sets: Vec::with_capacity(create_info.maxSets as usize),
+            free_descriptor_set_indexes: Vec::new(),
         }
     }
     pub fn reset(&mut self) {
-        self.descriptor_sets.clear()
+        self.used_element_count = 0;
+        self.free_element_ranges.clear();
+        self.descriptor_sets.clear();
+        self.free_descriptor_set_indexes.clear();
+    }
+    fn allocate_elements(&mut self, count: usize) -> Result<usize, api::VkResult> {
+        if count <= self.elements.len() - self.used_element_count {
+            let start = self.used_element_count;
+            self.used_element_count += count;
+            return Ok(start);
+        }
+        if let Some(index) = self
+            .free_element_ranges
+            .iter()
+            .position(|range| range.len() >= count)
+        {
+            let range = &mut self.free_element_ranges[index];
+            let start = range.start;
+            range.start += count;
+            if range.start == range.end {
+                self.free_element_ranges.swap_remove(index);
+            }
+            return Ok(start);
+        }
+        let free_element_count = self.elements.len() - self.used_element_count
+            + self
+                .free_element_ranges
+                .iter()
+                .map(ops::Range::len)
+                .sum::<usize>();
+        if free_element_count >= count {
+            Err(api::VK_ERROR_FRAGMENTED_POOL)
+        } else {
+            Err(api::VK_ERROR_OUT_OF_POOL_MEMORY)
+        }
     }
-    pub unsafe fn allocate<I: IntoIterator<Item = DescriptorSet>>(
+    fn free_elements(&mut self, range: ops::Range<usize>) {
+        if range.end == self.used_element_count {
+            self.used_element_count = range.start;
+        } else if range.start != range.end {
+            self.free_element_ranges.push(range);
+        }
+    }
+    unsafe fn allocate_one(
         &mut self,
-        descriptor_sets: I,
-        output_descriptor_sets: &mut [api::VkDescriptorSet],
-    ) {
-        let start_index = self.descriptor_sets.len();
-        self.descriptor_sets
-            .extend(descriptor_sets.into_iter().map(OwnedHandle::new));
-        assert_eq!(
-            self.descriptor_sets[start_index..].len(),
-            output_descriptor_sets.len()
-        );
-        for (output_descriptor_set, descriptor_set) in output_descriptor_sets
-            .iter_mut()
-            .zip(self.descriptor_sets[start_index..].iter())
+        layout: SharedHandle<api::VkDescriptorSetLayout>,
+    ) -> Result<api::VkDescriptorSet, api::VkResult> {
+        if self.free_descriptor_set_indexes.is_empty()
+            && self.descriptor_sets.len() == self.descriptor_sets.capacity()
         {
-            *output_descriptor_set = descriptor_set.get_handle();
+            return Err(api::VK_ERROR_OUT_OF_POOL_MEMORY);
         }
+        let element_start = self.allocate_elements(layout.element_count)?;
+        let elements = &mut self.elements[element_start..][..layout.element_count];
+        layout.initialize_elements(0, elements);
+        let descriptor_set = DescriptorSet {
+            layout,
+            elements: NonNull::new_unchecked(elements.as_mut_ptr()),
+            element_start,
+            element_count: layout.element_count,
+        };
+        let descriptor_set = match self.free_descriptor_set_indexes.pop() {
+            Some(index) => {
+                self.descriptor_sets[index] = descriptor_set;
+                &mut self.descriptor_sets[index]
+            }
+            None => {
+                self.descriptor_sets.push(descriptor_set);
+                self.descriptor_sets.last_mut().unwrap()
+            }
+        };
+        Ok(api::VkDescriptorSet::new(Some(NonNull::from(
+            descriptor_set,
+        ))))
     }
-    pub unsafe fn free(&mut self, descriptor_sets: &[api::VkDescriptorSet]) {
-        self.descriptor_sets
-            .retain(|descriptor_set| !descriptor_sets.contains(&descriptor_set.get_handle()))
+    pub unsafe fn allocate(
+        &mut self,
+        layouts: &[api::VkDescriptorSetLayout],
+        output_descriptor_sets: &mut [api::VkDescriptorSet],
+    ) -> api::VkResult {
+        assert_eq!(layouts.len(), output_descriptor_sets.len());
+        for index in 0..layouts.len() {
+            match self.allocate_one(SharedHandle::from(layouts[index]).unwrap()) {
+                Ok(descriptor_set) => output_descriptor_sets[index] = descriptor_set,
+                Err(result) => {
+                    self.free(&output_descriptor_sets[..index]);
+                    for output_descriptor_set in output_descriptor_sets.iter_mut() {
+                        *output_descriptor_set = Handle::null();
+                    }
+                    return result;
+                }
+            }
+        }
+        api::VK_SUCCESS
     }
-}
-
-#[derive(Debug)]
-pub struct DescriptorImage(SharedHandle<api::VkImageView>, image::Tiling);
-
-impl DescriptorImage {
-    pub unsafe fn from(v: &api::VkDescriptorImageInfo) -> Self {
-        let image_view = SharedHandle::from(v.imageView).unwrap();
-        let tiling = image_view.image.properties.get_tiling(v.imageLayout);
-        DescriptorImage(image_view, tiling)
+    pub unsafe fn free(&mut self, descriptor_sets: &[api::VkDescriptorSet]) {
+        for &descriptor_set in descriptor_sets {
+            let descriptor_set = match descriptor_set.get() {
+                Some(descriptor_set) => descriptor_set,
+                None => continue,
+            };
+            let index = (descriptor_set.as_ptr() as usize - self.descriptor_sets.as_ptr() as usize)
+                / mem::size_of::<DescriptorSet>();
+            let descriptor_set = &self.descriptor_sets[index];
+            let elements =
+                descriptor_set.element_start..descriptor_set.element_start + descriptor_set.len();
+            self.free_elements(elements);
+            if index + 1 == self.descriptor_sets.len() {
+                self.descriptor_sets.pop();
+            } else {
+                self.free_descriptor_set_indexes.push(index);
+            }
+        }
     }
 }
 
-#[derive(Debug)]
-pub struct DescriptorCombinedImageSampler {
-    image: Option<DescriptorImage>,
-    sampler: Option<SharedHandle<api::VkSampler>>,
-}
-
-#[derive(Debug)]
-pub enum Descriptor {
-    Sampler {
-        elements: Vec<Option<SharedHandle<api::VkSampler>>>,
-        immutable_samplers: bool,
-    },
-    CombinedImageSampler {
-        elements: Vec<DescriptorCombinedImageSampler>,
-        immutable_samplers: bool,
-    },
-    SampledImage {
-        elements: Vec<Option<DescriptorImage>>,
-    },
-    StorageImage {
-        elements: Vec<Option<DescriptorImage>>,
-    },
-    UniformTexelBuffer {
-        elements: Vec<Option<SharedHandle<api::VkBufferView>>>,
-    },
-    StorageTexelBuffer {
-        elements: Vec<Option<SharedHandle<api::VkBufferView>>>,
-    },
-    UniformBuffer {
-        elements: Vec<Option<BufferSlice>>,
-    },
-    StorageBuffer {
-        elements: Vec<Option<BufferSlice>>,
-    },
-    UniformBufferDynamic {
-        elements: Vec<Option<BufferSlice>>,
-    },
-    StorageBufferDynamic {
-        elements: Vec<Option<BufferSlice>>,
-    },
-    InputAttachment {
-        elements: Vec<Option<DescriptorImage>>,
-    },
-}
-
 #[derive(Copy, Clone)]
 pub enum DescriptorWriteArg<'a> {
     Image(&'a [api::VkDescriptorImageInfo]),
@@ -333,6 +505,22 @@ impl<'a> DescriptorWriteArg<'a> {
             DescriptorWriteArg::TexelBuffer(v) => DescriptorWriteArg::TexelBuffer(&v[range]),
         }
     }
+    /// the first descriptor and the distance between descriptors in bytes
+    pub fn as_raw(self) -> (*const u8, usize) {
+        match self {
+            DescriptorWriteArg::Image(v) => (
+                v.as_ptr() as *const u8,
+                mem::size_of::<api::VkDescriptorImageInfo>(),
+            ),
+            DescriptorWriteArg::Buffer(v) => (
+                v.as_ptr() as *const u8,
+                mem::size_of::<api::VkDescriptorBufferInfo>(),
+            ),
+            DescriptorWriteArg::TexelBuffer(v) => {
+                (v.as_ptr() as *const u8, mem::size_of::<api::VkBufferView>())
+            }
+        }
+    }
     pub fn image(self) -> Option<&'a [api::VkDescriptorImageInfo]> {
         match self {
             DescriptorWriteArg::Image(v) => Some(v),
@@ -353,202 +541,507 @@ impl<'a> DescriptorWriteArg<'a> {
     }
 }
 
-fn descriptor_write_helper<Element, T, F: FnMut(&mut Element, &T)>(
-    start_element: usize,
-    elements: &mut [Element],
-    args: &[T],
-    mut f: F,
-) {
-    for (element, arg) in elements[start_element..][..args.len()]
-        .iter_mut()
-        .zip(args.iter())
-    {
-        f(element, arg);
+#[derive(Debug)]
+pub struct DescriptorSet {
+    pub layout: SharedHandle<api::VkDescriptorSetLayout>,
+    /// the elements, in the pool the set was allocated from
+    elements: NonNull<DescriptorElement>,
+    /// the index of the first element in the pool
+    element_start: usize,
+    /// copied from `layout`, since the layout can be destroyed before the set
+    element_count: usize,
+}
+
+impl DescriptorSet {
+    fn len(&self) -> usize {
+        self.element_count
+    }
+    /// the address compiled shaders read the set's descriptors from
+    pub fn elements(&self) -> &[DescriptorElement] {
+        unsafe { slice::from_raw_parts(self.elements.as_ptr(), self.len()) }
+    }
+    fn elements_mut(&mut self) -> &mut [DescriptorElement] {
+        unsafe { slice::from_raw_parts_mut(self.elements.as_ptr(), self.len()) }
+    }
+    /// `data` points to the first descriptor of `run`
+    unsafe fn write_run(&mut self, run: DescriptorRun, data: *const u8, stride: usize) {
+        let elements = &mut self.elements_mut()[run.element_index..][..run.element_count];
+        run.writer.write(elements, data, stride);
+    }
+    /// writes the descriptors in `arg`, continuing on to the next bindings if there are more
+    /// than fit in `binding_index`
+    pub unsafe fn write(
+        &mut self,
+        descriptor_type: api::VkDescriptorType,
+        binding_index: usize,
+        start_element: usize,
+        arg: DescriptorWriteArg,
+    ) {
+        let (data, stride) = arg.as_raw();
+        let layout = self.layout;
+        layout.for_each_run(
+            descriptor_type,
+            binding_index,
+            start_element,
+            arg.len(),
+            |run| self.write_run(run, data.add(run.first_descriptor * stride), stride),
+        );
     }
 }
 
-impl Descriptor {
-    pub fn element_count(&self) -> usize {
+/// how the descriptors in a run are written, worked out from the binding ahead of time
+#[derive(Copy, Clone, Debug)]
+enum ElementWriter {
+    /// writes to samplers that are immutable are ignored
+    Nothing,
+    Sampler,
+    CombinedImageSampler,
+    Image,
+    Buffer,
+    TexelBuffer,
+}
+
+unsafe fn read_descriptor<T>(data: *const u8, stride: usize, index: usize) -> T {
+    // update templates don't require their data to be aligned
+    ptr::read_unaligned(data.add(index * stride) as *const T)
+}
+
+impl ElementWriter {
+    fn new(binding: &DescriptorLayout) -> Self {
+        let has_immutable_samplers = binding.immutable_samplers().is_some();
+        match binding {
+            DescriptorLayout::Sampler { .. } if has_immutable_samplers => ElementWriter::Nothing,
+            DescriptorLayout::Sampler { .. } => ElementWriter::Sampler,
+            DescriptorLayout::CombinedImageSampler { .. } if has_immutable_samplers => {
+                ElementWriter::Image
+            }
+            DescriptorLayout::CombinedImageSampler { .. } => ElementWriter::CombinedImageSampler,
+            DescriptorLayout::SampledImage { .. }
+            | DescriptorLayout::StorageImage { .. }
+            | DescriptorLayout::InputAttachment { .. } => ElementWriter::Image,
+            DescriptorLayout::UniformTexelBuffer { .. }
+            | DescriptorLayout::StorageTexelBuffer { .. } => ElementWriter::TexelBuffer,
+            DescriptorLayout::UniformBuffer { .. }
+            | DescriptorLayout::StorageBuffer { .. }
+            | DescriptorLayout::UniformBufferDynamic { .. }
+            | DescriptorLayout::StorageBufferDynamic { .. } => ElementWriter::Buffer,
+        }
+    }
+    /// `data` points to one `VkDescriptorImageInfo`, `VkDescriptorBufferInfo` or `VkBufferView`
+    /// per element, depending on `self`, each `stride` bytes after the last
+    unsafe fn write(self, elements: &mut [DescriptorElement], data: *const u8, stride: usize) {
         match self {
-            Descriptor::Sampler { elements, .. } => elements.len(),
-            Descriptor::CombinedImageSampler { elements, .. } => elements.len(),
-            Descriptor::SampledImage { elements, .. } => elements.len(),
-            Descriptor::StorageImage { elements, .. } => elements.len(),
-            Descriptor::UniformTexelBuffer { elements, .. } => elements.len(),
-            Descriptor::StorageTexelBuffer { elements, .. } => elements.len(),
-            Descriptor::UniformBuffer { elements, .. } => elements.len(),
-            Descriptor::StorageBuffer { elements, .. } => elements.len(),
-            Descriptor::UniformBufferDynamic { elements, .. } => elements.len(),
-            Descriptor::StorageBufferDynamic { elements, .. } => elements.len(),
-            Descriptor::InputAttachment { elements, .. } => elements.len(),
-        }
-    }
-    pub fn from(layout: &DescriptorLayout) -> Self {
-        match layout {
-            DescriptorLayout::Sampler {
-                count,
-                immutable_samplers,
-            } => {
-                let mut elements: Vec<_> = (0..*count).map(|_| None).collect();
-                let immutable_samplers = if let Some(immutable_samplers) = immutable_samplers {
-                    assert_eq!(immutable_samplers.len(), *count);
-                    for (element, sampler) in elements.iter_mut().zip(immutable_samplers.iter()) {
-                        *element = Some(*sampler);
-                    }
-                    true
-                } else {
-                    false
-                };
-                Descriptor::Sampler {
-                    elements,
-                    immutable_samplers,
+            ElementWriter::Nothing => {}
+            ElementWriter::Sampler => {
+                for (index, element) in elements.iter_mut().enumerate() {
+                    let info: api::VkDescriptorImageInfo = read_descriptor(data, stride, index);
+                    element.sampler = Some(SharedHandle::from(info.sampler).unwrap());
                 }
             }
-            DescriptorLayout::CombinedImageSampler {
-                count,
-                immutable_samplers,
-            } => {
-                let mut elements: Vec<_> = (0..*count)
-                    .map(|_| DescriptorCombinedImageSampler {
-                        image: None,
-                        sampler: None,
-                    })
-                    .collect();
-                let immutable_samplers = if let Some(immutable_samplers) = immutable_samplers {
-                    assert_eq!(immutable_samplers.len(), *count);
-                    for (element, sampler) in elements.iter_mut().zip(immutable_samplers.iter()) {
-                        element.sampler = Some(*sampler);
-                    }
-                    true
-                } else {
-                    false
-                };
-                Descriptor::CombinedImageSampler {
-                    elements,
-                    immutable_samplers,
+            ElementWriter::CombinedImageSampler => {
+                for (index, element) in elements.iter_mut().enumerate() {
+                    let info: api::VkDescriptorImageInfo = read_descriptor(data, stride, index);
+                    element.sampler = Some(SharedHandle::from(info.sampler).unwrap());
+                    element.set_image(&info);
                 }
             }
-            DescriptorLayout::SampledImage { count } => Descriptor::SampledImage {
-                elements: (0..*count).map(|_| None).collect(),
-            },
-            DescriptorLayout::StorageImage { count } => Descriptor::StorageImage {
-                elements: (0..*count).map(|_| None).collect(),
-            },
-            DescriptorLayout::UniformTexelBuffer { count } => Descriptor::UniformTexelBuffer {
-                elements: (0..*count).map(|_| None).collect(),
-            },
-            DescriptorLayout::StorageTexelBuffer { count } => Descriptor::StorageTexelBuffer {
-                elements: (0..*count).map(|_| None).collect(),
-            },
-            DescriptorLayout::UniformBuffer { count } => Descriptor::UniformBuffer {
-                elements: (0..*count).map(|_| None).collect(),
-            },
-            DescriptorLayout::StorageBuffer { count } => Descriptor::StorageBuffer {
-                elements: (0..*count).map(|_| None).collect(),
-            },
-            DescriptorLayout::UniformBufferDynamic { count } => Descriptor::UniformBufferDynamic {
-                elements: (0..*count).map(|_| None).collect(),
-            },
-            DescriptorLayout::StorageBufferDynamic { count } => Descriptor::StorageBufferDynamic {
-                elements: (0..*count).map(|_| None).collect(),
-            },
-            DescriptorLayout::InputAttachment { count } => Descriptor::InputAttachment {
-                elements: (0..*count).map(|_| None).collect(),
-            },
+            ElementWriter::Image => {
+                for (index, element) in elements.iter_mut().enumerate() {
+                    let info: api::VkDescriptorImageInfo = read_descriptor(data, stride, index);
+                    element.set_image(&info);
+                }
+            }
+            ElementWriter::Buffer => {
+                for (index, element) in elements.iter_mut().enumerate() {
+                    let info: api::VkDescriptorBufferInfo = read_descriptor(data, stride, index);
+                    element.set_buffer(&info);
+                }
+            }
+            ElementWriter::TexelBuffer => unimplemented!(),
         }
     }
-    pub unsafe fn write(&mut self, start_element: usize, arg: DescriptorWriteArg) {
-        assert_eq!(arg.len() + start_element, self.element_count());
-        match self {
-            Descriptor::Sampler {
-                elements,
-                immutable_samplers,
-            } => descriptor_write_helper(
-                start_element,
-                elements,
-                arg.image().unwrap(),
-                |_element, _arg| assert!(!*immutable_samplers),
-            ),
-            Descriptor::CombinedImageSampler {
-                elements,
-                immutable_samplers,
-            } => descriptor_write_helper(
-                start_element,
-                elements,
-                arg.image().unwrap(),
-                |element, arg| {
-                    if !*immutable_samplers {
-                        element.sampler = Some(SharedHandle::from(arg.sampler).unwrap());
-                    }
-                    element.image = Some(DescriptorImage::from(arg));
-                },
-            ),
-            Descriptor::SampledImage { elements } => descriptor_write_helper(
-                start_element,
-                elements,
-                arg.image().unwrap(),
-                |element, arg| {
-                    *element = Some(DescriptorImage::from(arg));
-                },
-            ),
-            Descriptor::StorageImage { elements } => descriptor_write_helper(
-                start_element,
-                elements,
-                arg.image().unwrap(),
-                |element, arg| {
-                    *element = Some(DescriptorImage::from(arg));
-                },
-            ),
-            Descriptor::UniformTexelBuffer { elements } => unimplemented!(),
-            Descriptor::StorageTexelBuffer { elements } => unimplemented!(),
-            Descriptor::UniformBuffer { elements } => descriptor_write_helper(
-                start_element,
-                elements,
-                arg.buffer().unwrap(),
-                |element, arg| *element = Some(BufferSlice::from(arg)),
-            ),
-            Descriptor::StorageBuffer { elements } => descriptor_write_helper(
-                start_element,
-                elements,
-                arg.buffer().unwrap(),
-                |element, arg| *element = Some(BufferSlice::from(arg)),
-            ),
-            Descriptor::UniformBufferDynamic { elements } => unimplemented!(),
-            Descriptor::StorageBufferDynamic { elements } => unimplemented!(),
-            Descriptor::InputAttachment { elements } => descriptor_write_helper(
-                start_element,
-                elements,
-                arg.image().unwrap(),
-                |element, arg| {
-                    *element = Some(DescriptorImage::from(arg));
+}
+
+/// a write to consecutive elements of one binding
+#[derive(Copy, Clone, Debug)]
+struct DescriptorRun {
+    writer: ElementWriter,
+    /// the index in `DescriptorSet::elements` of the first element written
+    element_index: usize,
+    element_count: usize,
+    /// the index of the run's first descriptor in the write
+    first_descriptor: usize,
+}
+
+impl DescriptorSetLayout {
+    /// splits a write of `descriptor_count` descriptors into runs that each fit in one binding,
+    /// continuing on to the next bindings like the spec requires
+    fn for_each_run<F: FnMut(DescriptorRun)>(
+        &self,
+        descriptor_type: api::VkDescriptorType,
+        mut binding_index: usize,
+        start_element: usize,
+        descriptor_count: usize,
+        mut f: F,
+    ) {
+        let mut start_element = Some(start_element);
+        let mut first_descriptor = 0;
+        while first_descriptor < descriptor_count {
+            let binding = self.bindings[binding_index].as_ref().unwrap();
+            let binding_offset = self.binding_offsets[binding_index];
+            binding_index += 1;
+            assert_eq!(binding.descriptor_type(), descriptor_type);
+            if binding.count() == 0 {
+                assert_eq!(start_element, None);
+                continue;
+            }
+            let start_element = start_element.take().unwrap_or(0);
+            let element_count = (descriptor_count - first_descriptor)
+                .min(binding.count().checked_sub(start_element).unwrap());
+            f(DescriptorRun {
+                writer: ElementWriter::new(binding),
+                element_index: binding_offset + start_element,
+                element_count,
+                first_descriptor,
+            });
+            first_descriptor += element_count;
+        }
+    }
+}
+
+#[derive(Copy, Clone, Debug)]
+struct DescriptorUpdateTemplateRun {
+    run: DescriptorRun,
+    /// where the run's first descriptor is in the update data
+    offset: usize,
+    stride: usize,
+}
+
+/// the entries of a `VkDescriptorUpdateTemplate`, already split into runs that each fit in one
+/// binding, so updating only has to walk the runs
+#[derive(Debug)]
+pub struct DescriptorUpdateTemplate {
+    runs: Vec<DescriptorUpdateTemplateRun>,
+    /// only used for templates for push descriptors
+    pub pipeline_bind_point: api::VkPipelineBindPoint,
+}
+
+impl DescriptorUpdateTemplate {
+    pub unsafe fn new(
+        entries: &[api::VkDescriptorUpdateTemplateEntry],
+        layout: &DescriptorSetLayout,
+        pipeline_bind_point: api::VkPipelineBindPoint,
+    ) -> Self {
+        let mut runs = Vec::with_capacity(entries.len());
+        for entry in entries {
+            layout.for_each_run(
+                entry.descriptorType,
+                entry.dstBinding as usize,
+                entry.dstArrayElement as usize,
+                entry.descriptorCount as usize,
+                |run| {
+                    runs.push(DescriptorUpdateTemplateRun {
+                        run,
+                        offset: entry.offset + run.first_descriptor * entry.stride,
+                        stride: entry.stride,
+                    })
                 },
-            ),
+            );
+        }
+        Self {
+            runs,
+            pipeline_bind_point,
         }
     }
-    pub fn descriptor_type(&self) -> api::VkDescriptorType {
-        match self {
-            Descriptor::Sampler { .. } => api::VK_DESCRIPTOR_TYPE_SAMPLER,
-            Descriptor::CombinedImageSampler { .. } => {
-                api::VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER
-            }
-            Descriptor::SampledImage { .. } => api::VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
-            Descriptor::StorageImage { .. } => api::VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
-            Descriptor::UniformTexelBuffer { .. } => api::VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER,
-            Descriptor::StorageTexelBuffer { .. } => api::VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER,
-            Descriptor::UniformBuffer { .. } => api::VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
-            Descriptor::StorageBuffer { .. } => api::VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
-            Descriptor::UniformBufferDynamic { .. } => {
-                api::VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC
+    pub unsafe fn update(&self, descriptor_set: &mut DescriptorSet, data: *const u8) {
+        for run in &self.runs {
+            descriptor_set.write_run(run.run, data.add(run.offset), run.stride);
+        }
+    }
+}
+
+/// the elements written by one run of a push
+#[repr(C)]
+#[derive(Copy, Clone, Debug)]
+pub struct PushDescriptorRun {
+    /// the index in the set of the first element written
+    pub element_index: usize,
+    pub element_count: usize,
+}
+
+/// the descriptors written by one `vkCmdPushDescriptorSetKHR` or
+/// `vkCmdPushDescriptorSetWithTemplateKHR`, already resolved to elements so they can be
+/// recorded straight into the command buffer
+#[derive(Debug)]
+pub struct PushDescriptorWrites<'a> {
+    layout: &'a DescriptorSetLayout,
+    pub runs: Vec<PushDescriptorRun>,
+    /// the elements of all the runs, one run after the other
+    pub elements: Vec<DescriptorElement>,
+}
+
+impl<'a> PushDescriptorWrites<'a> {
+    pub fn new(layout: &'a DescriptorSetLayout) -> Self {
+        Self {
+            layout,
+            runs: Vec::new(),
+            elements: Vec::new(),
+        }
+    }
+    unsafe fn write_run(&mut self, run: DescriptorRun, data: *const u8, stride: usize) {
+        let start = self.elements.len();
+        self.elements
+            .resize(start + run.element_count, DescriptorElement::EMPTY);
+        let elements = &mut self.elements[start..];
+        // these replace whole elements of the push descriptor set, so they need the immutable
+        // samplers too
+        self.layout.initialize_elements(run.element_index, elements);
+        run.writer.write(elements, data, stride);
+        self.runs.push(PushDescriptorRun {
+            element_index: run.element_index,
+            element_count: run.element_count,
+        });
+    }
+    /// like `DescriptorSet::write`
+    pub unsafe fn write(
+        &mut self,
+        descriptor_type: api::VkDescriptorType,
+        binding_index: usize,
+        start_element: usize,
+        arg: DescriptorWriteArg,
+    ) {
+        let (data, stride) = arg.as_raw();
+        let layout = self.layout;
+        layout.for_each_run(
+            descriptor_type,
+            binding_index,
+            start_element,
+            arg.len(),
+            |run| self.write_run(run, data.add(run.first_descriptor * stride), stride),
+        );
+    }
+    /// like `DescriptorUpdateTemplate::update`
+    pub unsafe fn write_with_template(
+        &mut self,
+        descriptor_update_template: &DescriptorUpdateTemplate,
+        data: *const u8,
+    ) {
+        for run in &descriptor_update_template.runs {
+            self.write_run(run.run, data.add(run.offset), run.stride);
+        }
+    }
+}
+
+#[derive(Copy, Clone, Debug)]
+enum BoundElements {
+    Unbound,
+    DescriptorSet(SharedHandle<api::VkDescriptorSet>),
+    /// the elements are in `BoundDescriptorSets::push_elements`
+    Push,
+}
+
+#[derive(Debug)]
+struct BoundDescriptorSet {
+    /// from the pipeline layout the set was bound with, since the set's own layout can be
+    /// destroyed before the set is used
+    layout: Option<SharedHandle<api::VkDescriptorSetLayout>>,
+    elements: BoundElements,
+    dynamic_offsets: Vec<u32>,
+}
+
+impl Default for BoundDescriptorSet {
+    fn default() -> Self {
+        Self {
+            layout: None,
+            elements: BoundElements::Unbound,
+            dynamic_offsets: Vec::new(),
+        }
+    }
+}
+
+/// the descriptor sets bound to one pipeline bind point while a command buffer executes.
+///
+/// Bound sets are read in place from their pools, with the dynamic offsets kept alongside and
+/// only added when a descriptor is read, so binding a set with dynamic buffers doesn't copy
+/// it. The push descriptor set has no pool, so its elements are kept here and updated by each
+/// push, leaving the elements that a push doesn't write as they were.
+#[derive(Debug, Default)]
+pub struct BoundDescriptorSets {
+    sets: Vec<BoundDescriptorSet>,
+    push_layout: Option<SharedHandle<api::VkDescriptorSetLayout>>,
+    push_elements: Vec<DescriptorElement>,
+}
+
+impl BoundDescriptorSets {
+    fn get_set_mut(&mut self, set_index: usize) -> &mut BoundDescriptorSet {
+        if self.sets.len() <= set_index {
+            self.sets.resize_with(set_index + 1, Default::default);
+        }
+        &mut self.sets[set_index]
+    }
+    pub unsafe fn bind(
+        &mut self,
+        layout: &PipelineLayout,
+        first_set: usize,
+        descriptor_sets: &[api::VkDescriptorSet],
+        mut dynamic_offsets: &[u32],
+    ) {
+        for (index, &descriptor_set) in descriptor_sets.iter().enumerate() {
+            let set_index = first_set + index;
+            let set_layout = layout.descriptor_set_layouts[set_index];
+            let (set_dynamic_offsets, rest) =
+                dynamic_offsets.split_at(set_layout.dynamic_offset_count);
+            dynamic_offsets = rest;
+            let bound_set = self.get_set_mut(set_index);
+            bound_set.layout = Some(set_layout);
+            bound_set.elements =
+                BoundElements::DescriptorSet(SharedHandle::from(descriptor_set).unwrap());
+            bound_set.dynamic_offsets.clear();
+            bound_set
+                .dynamic_offsets
+                .extend_from_slice(set_dynamic_offsets);
+        }
+        assert!(dynamic_offsets.is_empty(), "too many dynamic offsets");
+    }
+    /// `runs` and `elements` are from `PushDescriptorWrites`
+    pub fn push(
+        &mut self,
+        layout: &PipelineLayout,
+        set_index: usize,
+        runs: &[PushDescriptorRun],
+        mut elements: &[DescriptorElement],
+    ) {
+        let set_layout = layout.descriptor_set_layouts[set_index];
+        let same_layout = self
+            .push_layout
+            .map_or(false, |push_layout| ptr::eq(&*push_layout, &*set_layout));
+        if !same_layout {
+            self.push_elements
+                .resize(set_layout.element_count, DescriptorElement::EMPTY);
+            set_layout.initialize_elements(0, &mut self.push_elements);
+            self.push_layout = Some(set_layout);
+        }
+        for run in runs {
+            let (run_elements, rest) = elements.split_at(run.element_count);
+            elements = rest;
+            self.push_elements[run.element_index..][..run.element_count]
+                .copy_from_slice(run_elements);
+        }
+        let bound_set = self.get_set_mut(set_index);
+        bound_set.layout = Some(set_layout);
+        bound_set.elements = BoundElements::Push;
+        // push descriptor sets can't have dynamic buffers
+        bound_set.dynamic_offsets.clear();
+    }
+    /// the descriptor as seen by shaders, with the dynamic offset applied for dynamic buffers
+    pub fn get(
+        &self,
+        set_index: usize,
+        binding_index: usize,
+        array_element: usize,
+    ) -> DescriptorElement {
+        let bound_set = &self.sets[set_index];
+        let layout = bound_set.layout.expect("descriptor set not bound");
+        let element_index = layout.binding_offsets[binding_index] + array_element;
+        let mut element = match bound_set.elements {
+            BoundElements::Unbound => unreachable!(),
+            BoundElements::DescriptorSet(descriptor_set) => {
+                descriptor_set.elements()[element_index]
             }
-            Descriptor::StorageBufferDynamic { .. } => {
-                api::VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC
+            BoundElements::Push => self.push_elements[element_index],
+        };
+        if let Some(dynamic_offset_index) = layout.dynamic_offset_indexes[binding_index] {
+            let dynamic_offset = bound_set.dynamic_offsets[dynamic_offset_index + array_element];
+            element.pointer = element.pointer.wrapping_add(dynamic_offset as usize);
+        }
+        element
+    }
+    /// the memory that shaders can access through the bound sets
+    pub fn get_memory_accesses(&self) -> Vec<MemoryAccess> {
+        let mut retval = Vec::new();
+        for (set_index, bound_set) in self.sets.iter().enumerate() {
+            let layout = match bound_set.layout {
+                Some(layout) => layout,
+                None => continue,
+            };
+            for (binding_index, binding) in layout.bindings.iter().enumerate() {
+                let binding = match binding {
+                    Some(binding) => binding,
+                    None => continue,
+                };
+                for array_element in 0..binding.count() {
+                    let element = self.get(set_index, binding_index, array_element);
+                    if element.pointer.is_null() {
+                        continue;
+                    }
+                    let size = match element.image_view {
+                        Some(image_view) => {
+                            image_view
+                                .image
+                                .properties
+                                .computed_properties()
+                                .memory_layout
+                                .size
+                        }
+                        None => element.size,
+                    };
+                    retval.push(MemoryAccess::new(
+                        element.pointer,
+                        size,
+                        binding.is_writable(),
+                    ));
+                }
             }
-            Descriptor::InputAttachment { .. } => api::VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT,
+        }
+        retval
+    }
+    /// the bound sets as passed to shaders. The push descriptors and the dynamic offsets are
+    /// copied, since later commands can change them in place; the other descriptors are read
+    /// in place from their pools.
+    pub fn get_shader_descriptor_sets(&self) -> ShaderDescriptorSets {
+        let push_elements = self.push_elements.clone();
+        let dynamic_offsets: Vec<u32> = self
+            .sets
+            .iter()
+            .flat_map(|bound_set| bound_set.dynamic_offsets.iter().cloned())
+            .collect();
+        let mut dynamic_offsets_index = 0;
+        let sets = self
+            .sets
+            .iter()
+            .map(|bound_set| {
+                let descriptors = match bound_set.elements {
+                    BoundElements::Unbound => ptr::null(),
+                    BoundElements::DescriptorSet(descriptor_set) => {
+                        descriptor_set.elements().as_ptr() as *const c_void
+                    }
+                    BoundElements::Push => push_elements.as_ptr() as *const c_void,
+                };
+                let set_dynamic_offsets = if bound_set.dynamic_offsets.is_empty() {
+                    ptr::null()
+                } else {
+                    dynamic_offsets[dynamic_offsets_index..].as_ptr()
+                };
+                dynamic_offsets_index += bound_set.dynamic_offsets.len();
+                ShaderDescriptorSet {
+                    descriptors,
+                    dynamic_offsets: set_dynamic_offsets,
+                }
+            })
+            .collect();
+        ShaderDescriptorSets {
+            sets,
+            _push_elements: push_elements,
+            _dynamic_offsets: dynamic_offsets,
         }
     }
 }
 
+/// the descriptor sets a dispatch or draw was recorded with, as passed to its shaders
 #[derive(Debug)]
-pub struct DescriptorSet {
-    pub bindings: Vec<Option<Descriptor>>,
+pub struct ShaderDescriptorSets {
+    pub sets: Vec<ShaderDescriptorSet>,
+    /// pointed to by `sets`
+    _push_elements: Vec<DescriptorElement>,
+    _dynamic_offsets: Vec<u32>,
 }
@@ -1,16 +1,24 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 // See Notices.txt for copyright information
 use crate::api;
+use crate::suballocator::{Suballocation, Suballocator};
 use enum_map::{enum_map, Enum, EnumMap};
 use std::alloc;
 use std::fmt::{self, Debug, Display};
 use std::ops::{Deref, DerefMut};
 use std::ptr::NonNull;
+use std::sync::Arc;
 
+/// Vulkan requires memory types whose flags are a subset of another type's flags to come first
 #[derive(Copy, Clone, Eq, PartialEq, Hash, Debug, Enum)]
 #[repr(u32)]
 pub enum DeviceMemoryType {
-    Main = 0,
+    /// not host cached, for buffers the host fills once and the device reads once; writes into
+    /// it should go through `copy_non_temporal` so they don't evict the caches
+    Streaming = 0,
+    Main = 1,
+    /// only committed as the pages are first touched, for transient attachments
+    LazilyAllocated = 2,
 }
 
 impl DeviceMemoryType {
@@ -24,19 +32,33 @@ impl DeviceMemoryType {
     }
     pub fn heap(self) -> DeviceMemoryHeap {
         match self {
-            DeviceMemoryType::Main => DeviceMemoryHeap::Main,
+            DeviceMemoryType::Streaming
+            | DeviceMemoryType::Main
+            | DeviceMemoryType::LazilyAllocated => DeviceMemoryHeap::Main,
         }
     }
     pub fn flags(self) -> api::VkMemoryPropertyFlags {
         match self {
+            DeviceMemoryType::Streaming => {
+                api::VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+                    | api::VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+                    | api::VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+            }
             DeviceMemoryType::Main => {
                 api::VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
                     | api::VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
                     | api::VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
                     | api::VK_MEMORY_PROPERTY_HOST_CACHED_BIT
             }
+            DeviceMemoryType::LazilyAllocated => {
+                api::VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+                    | api::VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT
+            }
         }
     }
+    pub fn is_host_visible(self) -> bool {
+        self.flags() & api::VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT != 0
+    }
     pub fn to_bits(self) -> u32 {
         1 << (self as u32)
     }
@@ -52,7 +74,12 @@ impl Default for DeviceMemoryTypes {
 }
 
 impl DeviceMemoryTypes {
-    #[allow(dead_code)]
+    /// every type except `LazilyAllocated`, which Vulkan only allows for transient attachments
+    pub fn non_lazy() -> Self {
+        DeviceMemoryTypes(EnumMap::from(|memory_type| {
+            memory_type != DeviceMemoryType::LazilyAllocated
+        }))
+    }
     pub fn to_bits(self) -> u32 {
         let mut retval = 0;
         for (enumerant, value) in self.iter() {
@@ -186,6 +213,10 @@ pub trait DeviceMemoryAllocation: 'static + Send + Sync + Debug {
     fn size(&self) -> usize {
         self.layout().size
     }
+    /// the number of bytes actually backed by physical memory
+    fn committed_size(&self) -> usize {
+        self.size()
+    }
 }
 
 #[derive(Debug)]
@@ -240,34 +271,199 @@ impl Drop for DefaultDeviceMemoryAllocation {
     }
 }
 
+/// anonymous mapping with no swap reserved, so pages only use memory once they are touched
+#[cfg(unix)]
+#[derive(Debug)]
+pub struct LazyDeviceMemoryAllocation {
+    memory: NonNull<u8>,
+    layout: DeviceMemoryLayout,
+    mapping_size: usize,
+}
+
+#[cfg(unix)]
+fn get_page_size() -> usize {
+    unsafe { libc::sysconf(libc::_SC_PAGESIZE) as usize }
+}
+
+#[cfg(unix)]
+impl LazyDeviceMemoryAllocation {
+    /// returns `None` if `layout` needs more than page alignment or the mapping failed
+    pub fn new(layout: DeviceMemoryLayout) -> Option<Self> {
+        let page_size = get_page_size();
+        if layout.alignment > page_size {
+            return None;
+        }
+        let mapping_size = layout.size.checked_add(page_size - 1)? & !(page_size - 1);
+        unsafe {
+            let mapping = libc::mmap(
+                std::ptr::null_mut(),
+                mapping_size,
+                libc::PROT_READ | libc::PROT_WRITE,
+                libc::MAP_PRIVATE | libc::MAP_ANONYMOUS | libc::MAP_NORESERVE,
+                -1,
+                0,
+            );
+            if mapping == libc::MAP_FAILED {
+                return None;
+            }
+            Some(Self {
+                memory: NonNull::new_unchecked(mapping as *mut u8),
+                layout,
+                mapping_size,
+            })
+        }
+    }
+}
+
+#[cfg(unix)]
+unsafe impl Send for LazyDeviceMemoryAllocation {}
+
+#[cfg(unix)]
+unsafe impl Sync for LazyDeviceMemoryAllocation {}
+
+#[cfg(unix)]
+impl DeviceMemoryAllocation for LazyDeviceMemoryAllocation {
+    unsafe fn get(&self) -> NonNull<u8> {
+        self.memory
+    }
+    fn layout(&self) -> DeviceMemoryLayout {
+        self.layout
+    }
+    #[cfg(target_os = "linux")]
+    fn committed_size(&self) -> usize {
+        let page_size = get_page_size();
+        let mut residency = vec![0u8; self.mapping_size / page_size];
+        let result = unsafe {
+            libc::mincore(
+                self.memory.as_ptr() as *mut _,
+                self.mapping_size,
+                residency.as_mut_ptr(),
+            )
+        };
+        if result != 0 {
+            return self.size();
+        }
+        let resident_page_count = residency.iter().filter(|&&v| v & 1 != 0).count();
+        self.size().min(resident_page_count * page_size)
+    }
+}
+
+#[cfg(unix)]
+impl Drop for LazyDeviceMemoryAllocation {
+    fn drop(&mut self) {
+        unsafe {
+            libc::munmap(self.memory.as_ptr() as *mut _, self.mapping_size);
+        }
+    }
+}
+
+/// copies `size` bytes with stores that bypass the caches, for data that won't be read again
+/// soon
+pub unsafe fn copy_non_temporal(dest: *mut u8, src: *const u8, size: usize) {
+    #[cfg(target_arch = "x86_64")]
+    {
+        use std::arch::x86_64::{__m128i, _mm_loadu_si128, _mm_sfence, _mm_stream_si128};
+        const VECTOR_SIZE: usize = 16;
+        // the stores have to be aligned, so copy the unaligned head normally
+        let head_size = dest.align_offset(VECTOR_SIZE).min(size);
+        std::ptr::copy_nonoverlapping(src, dest, head_size);
+        let mut offset = head_size;
+        while size - offset >= VECTOR_SIZE {
+            let value = _mm_loadu_si128(src.add(offset) as *const __m128i);
+            _mm_stream_si128(dest.add(offset) as *mut __m128i, value);
+            offset += VECTOR_SIZE;
+        }
+        std::ptr::copy_nonoverlapping(src.add(offset), dest.add(offset), size - offset);
+        // non-temporal stores are weakly ordered
+        _mm_sfence();
+    }
+    #[cfg(not(target_arch = "x86_64"))]
+    std::ptr::copy_nonoverlapping(src, dest, size);
+}
+
 #[derive(Debug)]
-pub enum DeviceMemory {
+enum DeviceMemoryBacking {
     Default(DefaultDeviceMemoryAllocation),
-    #[allow(dead_code)]
+    Suballocated(Suballocation),
+    #[cfg(unix)]
+    Lazy(LazyDeviceMemoryAllocation),
     Special(Box<dyn DeviceMemoryAllocation>),
 }
 
+#[derive(Debug)]
+pub struct DeviceMemory {
+    memory_type: DeviceMemoryType,
+    backing: DeviceMemoryBacking,
+}
+
 impl DeviceMemory {
     pub fn allocate_from_default_heap(
+        memory_type: DeviceMemoryType,
         layout: DeviceMemoryLayout,
     ) -> Result<Self, DefaultDeviceMemoryAllocationFailure> {
-        Ok(DeviceMemory::Default(DefaultDeviceMemoryAllocation::new(
-            layout,
-        )?))
+        Ok(DeviceMemory {
+            memory_type,
+            backing: DeviceMemoryBacking::Default(DefaultDeviceMemoryAllocation::new(layout)?),
+        })
+    }
+    /// lazily-allocated memory gets its own mapping, so `committed_size` can tell how much of
+    /// it was touched; everything else is suballocated, except allocations too big for
+    /// `suballocator`, which fall back to the default heap
+    pub fn allocate(
+        suballocator: &Arc<Suballocator>,
+        memory_type: DeviceMemoryType,
+        layout: DeviceMemoryLayout,
+    ) -> Result<Self, DefaultDeviceMemoryAllocationFailure> {
+        let backing = match memory_type {
+            #[cfg(unix)]
+            DeviceMemoryType::LazilyAllocated => {
+                LazyDeviceMemoryAllocation::new(layout).map(DeviceMemoryBacking::Lazy)
+            }
+            _ => {
+                Suballocator::allocate(suballocator, layout).map(DeviceMemoryBacking::Suballocated)
+            }
+        };
+        match backing {
+            Some(backing) => Ok(DeviceMemory {
+                memory_type,
+                backing,
+            }),
+            None => Self::allocate_from_default_heap(memory_type, layout),
+        }
+    }
+    /// for memory that has to come from somewhere else, like memory shared with the window
+    /// system
+    pub fn from_special(
+        memory_type: DeviceMemoryType,
+        memory: Box<dyn DeviceMemoryAllocation>,
+    ) -> Self {
+        DeviceMemory {
+            memory_type,
+            backing: DeviceMemoryBacking::Special(memory),
+        }
+    }
+    pub fn memory_type(&self) -> DeviceMemoryType {
+        self.memory_type
+    }
+    fn allocation(&self) -> &dyn DeviceMemoryAllocation {
+        match &self.backing {
+            DeviceMemoryBacking::Default(memory) => memory,
+            DeviceMemoryBacking::Suballocated(memory) => memory,
+            #[cfg(unix)]
+            DeviceMemoryBacking::Lazy(memory) => memory,
+            DeviceMemoryBacking::Special(memory) => memory.as_ref(),
+        }
     }
 }
 
 impl DeviceMemoryAllocation for DeviceMemory {
     unsafe fn get(&self) -> NonNull<u8> {
-        match self {
-            DeviceMemory::Default(memory) => memory.get(),
-            DeviceMemory::Special(memory) => memory.as_ref().get(),
-        }
+        self.allocation().get()
     }
     fn layout(&self) -> DeviceMemoryLayout {
-        match self {
-            DeviceMemory::Default(memory) => memory.layout(),
-            DeviceMemory::Special(memory) => memory.as_ref().layout(),
-        }
+        self.allocation().layout()
+    }
+    fn committed_size(&self) -> usize {
+        self.allocation().committed_size()
     }
 }
@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! stackful coroutines, so the invocations of a compute workgroup can each run up to a barrier
+//! in turn on one worker thread. Switching only saves the callee-saved registers, which is a
+//! lot cheaper than blocking OS threads.
+
+use libc;
+use std::any::Any;
+use std::arch::global_asm;
+use std::ffi::c_void;
+use std::marker::PhantomData;
+use std::panic::{self, AssertUnwindSafe};
+use std::ptr::{self, NonNull};
+
+/// enough for shader code, which doesn't recurse; only the pages touched use memory
+const STACK_SIZE: usize = 64 * 1024;
+
+// kazan_fiber_switch(save_sp: *mut *mut u8, load_sp: *mut u8): pushes the callee-saved
+// registers, stores the stack pointer in `*save_sp`, then pops the registers saved on the
+// stack at `load_sp` and returns to whatever called `kazan_fiber_switch` there.
+//
+// kazan_fiber_start is returned to by the first switch to a new fiber, with the fiber state
+// in r12 and `fiber_main` in r13.
+global_asm!(
+    ".pushsection .text.kazan_fiber_switch,\"ax\",@progbits",
+    ".globl kazan_fiber_switch",
+    ".type kazan_fiber_switch,@function",
+    ".p2align 4",
+    "kazan_fiber_switch:",
+    "push rbp",
+    "push rbx",
+    "push r12",
+    "push r13",
+    "push r14",
+    "push r15",
+    "mov [rdi], rsp",
+    "mov rsp, rsi",
+    "pop r15",
+    "pop r14",
+    "pop r13",
+    "pop r12",
+    "pop rbx",
+    "pop rbp",
+    "ret",
+    ".size kazan_fiber_switch, . - kazan_fiber_switch",
+    ".globl kazan_fiber_start",
+    ".type kazan_fiber_start,@function",
+    ".p2align 4",
+    "kazan_fiber_start:",
+    "mov rdi, r12",
+    "call r13",
+    "ud2",
+    ".size kazan_fiber_start, . - kazan_fiber_start",
+    ".popsection",
+);
+
+extern "C" {
+    fn kazan_fiber_switch(save_sp: *mut *mut u8, load_sp: *mut u8);
+    fn kazan_fiber_start();
+}
+
+struct Stack {
+    /// the lowest page is a guard page
+    mapping: NonNull<u8>,
+    mapping_size: usize,
+}
+
+impl Stack {
+    fn new() -> Self {
+        let page_size = unsafe { libc::sysconf(libc::_SC_PAGESIZE) as usize };
+        let mapping_size = STACK_SIZE + page_size;
+        unsafe {
+            let mapping = libc::mmap(
+                ptr::null_mut(),
+                mapping_size,
+                libc::PROT_READ | libc::PROT_WRITE,
+                libc::MAP_PRIVATE | libc::MAP_ANONYMOUS | libc::MAP_NORESERVE,
+                -1,
+                0,
+            );
+            assert_ne!(mapping, libc::MAP_FAILED, "can't allocate fiber stack");
+            assert_eq!(libc::mprotect(mapping, page_size, libc::PROT_NONE), 0);
+            Self {
+                mapping: NonNull::new_unchecked(mapping as *mut u8),
+                mapping_size,
+            }
+        }
+    }
+    /// page aligned
+    fn top(&self) -> *mut u8 {
+        unsafe { self.mapping.as_ptr().add(self.mapping_size) }
+    }
+}
+
+impl Drop for Stack {
+    fn drop(&mut self) {
+        unsafe {
+            libc::munmap(self.mapping.as_ptr() as *mut _, self.mapping_size);
+        }
+    }
+}
+
+pub type FiberBody<'a> = dyn Fn(FiberHandle, usize) + 'a;
+
+/// accessed through raw pointers by the fiber and whoever resumes it, so it is boxed to keep
+/// its address fixed
+struct State {
+    sp: *mut u8,
+    resumer_sp: *mut u8,
+    /// the lifetime is erased; `Fiber::start` requires the body to outlive the run
+    body: Option<*const FiberBody<'static>>,
+    argument: usize,
+    finished: bool,
+    panic: Option<Box<dyn Any + Send>>,
+}
+
+/// identifies the running fiber to the code it's running
+#[derive(Copy, Clone, Debug)]
+pub struct FiberHandle(*mut State);
+
+impl FiberHandle {
+    pub fn into_raw(self) -> *mut c_void {
+        self.0 as *mut _
+    }
+    pub unsafe fn from_raw(v: *mut c_void) -> Self {
+        FiberHandle(v as *mut State)
+    }
+    /// switches back to the thread that resumed the fiber, returning when it's resumed again.
+    /// must be called from the fiber `self` identifies.
+    pub unsafe fn suspend(self) {
+        kazan_fiber_switch(&mut (*self.0).sp, (*self.0).resumer_sp);
+    }
+}
+
+extern "C" fn fiber_main(state: *mut State) -> ! {
+    unsafe {
+        let body = &*(*state).body.take().unwrap();
+        // unwinding can't continue past the start of the fiber's stack
+        if let Err(payload) = panic::catch_unwind(AssertUnwindSafe(|| {
+            body(FiberHandle(state), (*state).argument)
+        })) {
+            (*state).panic = Some(payload);
+        }
+        (*state).finished = true;
+        let mut unused_sp = ptr::null_mut();
+        kazan_fiber_switch(&mut unused_sp, (*state).resumer_sp);
+    }
+    unreachable!("finished fiber resumed")
+}
+
+/// a stack and the state of what's running on it; reused by starting it again once finished
+pub struct Fiber {
+    stack: Stack,
+    state: Box<State>,
+    _not_send: PhantomData<*mut ()>,
+}
+
+impl Fiber {
+    pub fn new() -> Self {
+        Self {
+            stack: Stack::new(),
+            state: Box::new(State {
+                sp: ptr::null_mut(),
+                resumer_sp: ptr::null_mut(),
+                body: None,
+                argument: 0,
+                finished: true,
+                panic: None,
+            }),
+            _not_send: PhantomData,
+        }
+    }
+    pub fn is_finished(&self) -> bool {
+        self.state.finished
+    }
+    /// sets up the fiber to call `body` with `argument` when next resumed. `body` has to stay
+    /// valid until the fiber finishes or is abandoned.
+    pub unsafe fn start(&mut self, body: &FiberBody, argument: usize) {
+        assert!(self.state.finished, "fiber is still running");
+        let state: *mut State = &mut *self.state;
+        // popped by kazan_fiber_switch: r15, r14, r13, r12, rbx, rbp, return address; the
+        // stack pointer is 16-byte aligned after the return, as kazan_fiber_start's call needs
+        let sp = (self.stack.top() as *mut usize).sub(7);
+        sp.write(0);
+        sp.add(1).write(0);
+        sp.add(2).write(fiber_main as usize);
+        sp.add(3).write(state as usize);
+        sp.add(4).write(0);
+        // a null frame pointer ends backtraces
+        sp.add(5).write(0);
+        sp.add(6).write(kazan_fiber_start as usize);
+        (*state).sp = sp as *mut u8;
+        (*state).body = Some(std::mem::transmute::<
+            *const FiberBody,
+            *const FiberBody<'static>,
+        >(body));
+        (*state).argument = argument;
+        (*state).finished = false;
+    }
+    /// lets the fiber be started again without finishing what it was running; nothing on its
+    /// stack is dropped
+    pub fn abandon(&mut self) {
+        self.state.body = None;
+        self.state.finished = true;
+    }
+    /// runs the fiber until it suspends or finishes; a panic in the fiber is resumed here
+    pub fn resume(&mut self) {
+        assert!(!self.state.finished, "fiber isn't started");
+        let state: *mut State = &mut *self.state;
+        unsafe {
+            kazan_fiber_switch(&mut (*state).resumer_sp, (*state).sp);
+            if let Some(payload) = (*state).panic.take() {
+                panic::resume_unwind(payload);
+            }
+        }
+    }
+}
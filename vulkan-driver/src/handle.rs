@@ -1,16 +1,24 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 // See Notices.txt for copyright information
 use crate::api;
-use crate::api_impl::{Device, Instance, PhysicalDevice, Queue};
+use crate::api_impl::{Device, Instance, PhysicalDevice};
 use crate::buffer::{Buffer, BufferView};
-use crate::descriptor_set::{DescriptorPool, DescriptorSet, DescriptorSetLayout};
+use crate::command_buffer::CommandBuffer;
+use crate::descriptor_set::{
+    DescriptorPool, DescriptorSet, DescriptorSetLayout, DescriptorUpdateTemplate,
+};
 use crate::device_memory::DeviceMemory;
 use crate::image::{Image, ImageView};
 use crate::pipeline::{Pipeline, PipelineLayout};
-use crate::render_pass::RenderPass;
+use crate::pipeline_cache::PipelineCache;
+use crate::query::QueryPool;
+use crate::queue::Queue;
+use crate::render_pass::{Framebuffer, RenderPass};
 use crate::sampler::Sampler;
 use crate::sampler::SamplerYcbcrConversion;
 use crate::shader_module::ShaderModule;
+use crate::slab;
+use crate::sync::{Event, Fence, Semaphore};
 use std::fmt;
 use std::marker::PhantomData;
 use std::mem;
@@ -59,6 +67,22 @@ pub trait HandleAllocFree: Handle {
     }
 }
 
+/// allocates the values behind `$handle`s from a per-type slab pool
+macro_rules! impl_slab_handle_alloc_free {
+    ($handle:ident, $value:ty) => {
+        impl_slab_allocated!($value);
+
+        impl HandleAllocFree for $handle {
+            unsafe fn allocate<T: Into<Self::Value>>(v: T) -> Self {
+                Self::new(Some(slab::allocate(v.into())))
+            }
+            unsafe fn free(self) {
+                slab::free(self.get().unwrap());
+            }
+        }
+    };
+}
+
 pub trait Handle: Copy + Eq + fmt::Debug {
     type Value;
     fn get(&self) -> Option<NonNull<Self::Value>>;
@@ -312,115 +336,100 @@ pub type VkQueue = DispatchableHandle<Queue>;
 
 impl HandleAllocFree for VkQueue {}
 
-pub struct CommandBuffer {}
-
 pub type VkCommandBuffer = DispatchableHandle<CommandBuffer>;
 
 impl HandleAllocFree for VkCommandBuffer {}
 
-pub struct Semaphore {}
-
 pub type VkSemaphore = NondispatchableHandle<Semaphore>;
 
-impl HandleAllocFree for VkSemaphore {}
-
-pub struct Fence {}
+impl_slab_handle_alloc_free!(VkSemaphore, Semaphore);
 
 pub type VkFence = NondispatchableHandle<Fence>;
 
-impl HandleAllocFree for VkFence {}
+impl_slab_handle_alloc_free!(VkFence, Fence);
 
 pub type VkDeviceMemory = NondispatchableHandle<DeviceMemory>;
 
-impl HandleAllocFree for VkDeviceMemory {}
+impl_slab_handle_alloc_free!(VkDeviceMemory, DeviceMemory);
 
 pub type VkBuffer = NondispatchableHandle<Buffer>;
 
-impl HandleAllocFree for VkBuffer {}
+impl_slab_handle_alloc_free!(VkBuffer, Buffer);
 
 pub type VkImage = NondispatchableHandle<Image>;
 
-impl HandleAllocFree for VkImage {}
-
-pub struct Event {}
+impl_slab_handle_alloc_free!(VkImage, Image);
 
 pub type VkEvent = NondispatchableHandle<Event>;
 
-impl HandleAllocFree for VkEvent {}
-
-pub struct QueryPool {}
+impl_slab_handle_alloc_free!(VkEvent, Event);
 
 pub type VkQueryPool = NondispatchableHandle<QueryPool>;
 
-impl HandleAllocFree for VkQueryPool {}
+impl_slab_handle_alloc_free!(VkQueryPool, QueryPool);
 
 pub type VkBufferView = NondispatchableHandle<BufferView>;
 
-impl HandleAllocFree for VkBufferView {}
+impl_slab_handle_alloc_free!(VkBufferView, BufferView);
 
 pub type VkImageView = NondispatchableHandle<ImageView>;
 
-impl HandleAllocFree for VkImageView {}
+impl_slab_handle_alloc_free!(VkImageView, ImageView);
 
 pub type VkShaderModule = NondispatchableHandle<ShaderModule>;
 
-impl HandleAllocFree for VkShaderModule {}
-
-pub struct PipelineCache {}
+impl_slab_handle_alloc_free!(VkShaderModule, ShaderModule);
 
 pub type VkPipelineCache = NondispatchableHandle<PipelineCache>;
 
-impl HandleAllocFree for VkPipelineCache {}
+impl_slab_handle_alloc_free!(VkPipelineCache, PipelineCache);
 
 pub type VkPipelineLayout = NondispatchableHandle<PipelineLayout>;
 
-impl HandleAllocFree for VkPipelineLayout {}
+impl_slab_handle_alloc_free!(VkPipelineLayout, PipelineLayout);
 
 pub type VkRenderPass = NondispatchableHandle<RenderPass>;
 
-impl HandleAllocFree for VkRenderPass {}
+impl_slab_handle_alloc_free!(VkRenderPass, RenderPass);
 
 pub type VkPipeline = NondispatchableHandle<Pipeline>;
 
-impl HandleAllocFree for VkPipeline {}
+impl_slab_handle_alloc_free!(VkPipeline, Pipeline);
 
 pub type VkDescriptorSetLayout = NondispatchableHandle<DescriptorSetLayout>;
 
-impl HandleAllocFree for VkDescriptorSetLayout {}
+impl_slab_handle_alloc_free!(VkDescriptorSetLayout, DescriptorSetLayout);
 
 pub type VkSampler = NondispatchableHandle<Sampler>;
 
-impl HandleAllocFree for VkSampler {}
+impl_slab_handle_alloc_free!(VkSampler, Sampler);
 
 pub type VkDescriptorPool = NondispatchableHandle<DescriptorPool>;
 
-impl HandleAllocFree for VkDescriptorPool {}
+impl_slab_handle_alloc_free!(VkDescriptorPool, DescriptorPool);
 
 pub type VkDescriptorSet = NondispatchableHandle<DescriptorSet>;
 
-impl HandleAllocFree for VkDescriptorSet {}
-
-pub struct Framebuffer {}
+// HandleAllocFree specifically not implemented for VkDescriptorSet, since descriptor sets are
+// allocated from their pool
 
 pub type VkFramebuffer = NondispatchableHandle<Framebuffer>;
 
-impl HandleAllocFree for VkFramebuffer {}
+impl_slab_handle_alloc_free!(VkFramebuffer, Framebuffer);
 
 pub struct CommandPool {}
 
 pub type VkCommandPool = NondispatchableHandle<CommandPool>;
 
-impl HandleAllocFree for VkCommandPool {}
+impl_slab_handle_alloc_free!(VkCommandPool, CommandPool);
 
 pub type VkSamplerYcbcrConversion = NondispatchableHandle<SamplerYcbcrConversion>;
 
-impl HandleAllocFree for VkSamplerYcbcrConversion {}
-
-pub struct DescriptorUpdateTemplate {}
+impl_slab_handle_alloc_free!(VkSamplerYcbcrConversion, SamplerYcbcrConversion);
 
 pub type VkDescriptorUpdateTemplate = NondispatchableHandle<DescriptorUpdateTemplate>;
 
-impl HandleAllocFree for VkDescriptorUpdateTemplate {}
+impl_slab_handle_alloc_free!(VkDescriptorUpdateTemplate, DescriptorUpdateTemplate);
 
 pub type VkSurfaceKHR = NondispatchableHandle<api::VkIcdSurfaceBase>;
 
@@ -428,34 +437,34 @@ pub type VkSurfaceKHR = NondispatchableHandle<api::VkIcdSurfaceBase>;
 
 pub type VkSwapchainKHR = NondispatchableHandle<Box<Swapchain>>;
 
-impl HandleAllocFree for VkSwapchainKHR {}
+impl_slab_handle_alloc_free!(VkSwapchainKHR, Box<Swapchain>);
 
 pub struct DisplayKHR {}
 
 pub type VkDisplayKHR = NondispatchableHandle<DisplayKHR>;
 
-impl HandleAllocFree for VkDisplayKHR {}
+impl_slab_handle_alloc_free!(VkDisplayKHR, DisplayKHR);
 
 pub struct DisplayModeKHR {}
 
 pub type VkDisplayModeKHR = NondispatchableHandle<DisplayModeKHR>;
 
-impl HandleAllocFree for VkDisplayModeKHR {}
+impl_slab_handle_alloc_free!(VkDisplayModeKHR, DisplayModeKHR);
 
 pub struct DebugReportCallbackEXT {}
 
 pub type VkDebugReportCallbackEXT = NondispatchableHandle<DebugReportCallbackEXT>;
 
-impl HandleAllocFree for VkDebugReportCallbackEXT {}
+impl_slab_handle_alloc_free!(VkDebugReportCallbackEXT, DebugReportCallbackEXT);
 
 pub struct DebugUtilsMessengerEXT {}
 
 pub type VkDebugUtilsMessengerEXT = NondispatchableHandle<DebugUtilsMessengerEXT>;
 
-impl HandleAllocFree for VkDebugUtilsMessengerEXT {}
+impl_slab_handle_alloc_free!(VkDebugUtilsMessengerEXT, DebugUtilsMessengerEXT);
 
 pub struct ValidationCacheEXT {}
 
 pub type VkValidationCacheEXT = NondispatchableHandle<ValidationCacheEXT>;
 
-impl HandleAllocFree for VkValidationCacheEXT {}
+impl_slab_handle_alloc_free!(VkValidationCacheEXT, ValidationCacheEXT);
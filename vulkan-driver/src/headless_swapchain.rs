@@ -0,0 +1,494 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! `VK_EXT_headless_surface` swapchains, for rendering without a window system.
+//!
+//! When `KAZAN_HEADLESS_OUTPUT_FILE` is set, the swapchain images are stored in that file, so
+//! another process (like a video encoder) can map it and read the presented frames without
+//! copying them. The file starts with an `OutputHeader`, followed by the images, each in linear
+//! tiling with rows `row_pitch` bytes apart. All the fields are in native byte order.
+//!
+//! To read the newest frame, the consumer reads `last_presented_image`, then that image's
+//! sequence number. If the sequence number is odd, the application is rendering to the image
+//! again, so it has to start over. Otherwise it copies the image, then checks that the
+//! sequence number hasn't changed in the meantime.
+//!
+//! Every new swapchain replaces the file by renaming a new one over it, so mappings of the old
+//! file stay valid; consumers can tell it was replaced when the file they have open no longer
+//! has any links.
+
+use crate::api;
+use crate::device_memory::{
+    DeviceMemory, DeviceMemoryAllocation, DeviceMemoryLayout, DeviceMemoryType,
+};
+use crate::handle::{Handle, OwnedHandle, SharedHandle};
+use crate::image::{
+    Image, ImageMemory, ImageMultisampleCount, ImageProperties, SupportedTilings, Tiling,
+};
+use crate::swapchain::{
+    get_swapchain_image_count, SurfaceImplementation, SurfacePlatform, Swapchain,
+    MAX_SWAPCHAIN_IMAGE_COUNT,
+};
+use std::borrow::Cow;
+use std::collections::VecDeque;
+use std::env;
+use std::fmt;
+use std::io;
+use std::mem;
+use std::path::PathBuf;
+use std::ptr::NonNull;
+use std::sync::atomic::{self, AtomicU32, AtomicU64, Ordering};
+use std::sync::{Arc, Condvar, Mutex};
+use std::time::{Duration, Instant};
+
+/// the file to store the swapchain images in; they are only kept in memory when it isn't set
+pub const HEADLESS_OUTPUT_FILE_ENV_VAR: &str = "KAZAN_HEADLESS_OUTPUT_FILE";
+
+pub const OUTPUT_FILE_MAGIC: [u8; 8] = *b"KAZANHL\0";
+
+/// increment when the layout of the output file changes
+pub const OUTPUT_FILE_VERSION: u32 = 1;
+
+/// images are page-aligned, so consumers can map them separately
+const OUTPUT_FILE_IMAGE_ALIGNMENT: usize = 4096;
+
+/// the largest extent headless swapchains support
+const MAX_IMAGE_EXTENT: u32 = 4096;
+
+/// `OutputHeader::status` while the swapchain exists
+pub const OUTPUT_STATUS_ACTIVE: u32 = 1;
+/// `OutputHeader::status` once the swapchain was destroyed
+pub const OUTPUT_STATUS_DESTROYED: u32 = 2;
+
+#[repr(C)]
+pub struct OutputHeader {
+    pub magic: [u8; 8],
+    pub version: u32,
+    /// zero while the swapchain is being set up, then one of the `OUTPUT_STATUS_*` constants
+    pub status: AtomicU32,
+    pub image_count: u32,
+    /// the swapchain's `VkFormat`
+    pub format: u32,
+    pub width: u32,
+    pub height: u32,
+    pub row_pitch: u64,
+    /// the offset of the first image from the start of the file
+    pub image_offset: u64,
+    /// the distance between the starts of consecutive images
+    pub image_stride: u64,
+    /// the count of frames ever presented
+    pub presented_frame_count: AtomicU64,
+    pub last_presented_image: AtomicU32,
+    pub padding: u32,
+    /// odd while the application is rendering to the image
+    pub image_sequences: [AtomicU64; MAX_SWAPCHAIN_IMAGE_COUNT as usize],
+}
+
+fn get_output_file_path() -> Option<PathBuf> {
+    let path = env::var_os(HEADLESS_OUTPUT_FILE_ENV_VAR)?;
+    if path.is_empty() {
+        None
+    } else {
+        Some(path.into())
+    }
+}
+
+/// a shared mapping of the whole output file
+struct OutputFile {
+    memory: NonNull<u8>,
+    size: usize,
+}
+
+// the header is only accessed through atomics once the file is set up, and the images are
+// synchronized by the application
+unsafe impl Send for OutputFile {}
+
+unsafe impl Sync for OutputFile {}
+
+impl OutputFile {
+    /// the file at `path` is only replaced once the new file is mapped
+    #[cfg(unix)]
+    fn create(path: PathBuf, size: usize) -> io::Result<Self> {
+        use std::fs::{self, OpenOptions};
+        use std::os::unix::io::AsRawFd;
+        use std::process;
+        use std::ptr::null_mut;
+        let mut temp_path = path.clone().into_os_string();
+        temp_path.push(format!(".{}.tmp", process::id()));
+        let temp_path = PathBuf::from(temp_path);
+        let result = (|| unsafe {
+            let file = OpenOptions::new()
+                .read(true)
+                .write(true)
+                .create(true)
+                .truncate(true)
+                .open(&temp_path)?;
+            file.set_len(size as u64)?;
+            let memory = libc::mmap(
+                null_mut(),
+                size,
+                libc::PROT_READ | libc::PROT_WRITE,
+                libc::MAP_SHARED,
+                file.as_raw_fd(),
+                0,
+            );
+            if memory == libc::MAP_FAILED {
+                return Err(io::Error::last_os_error());
+            }
+            let output_file = OutputFile {
+                memory: NonNull::new_unchecked(memory as *mut u8),
+                size,
+            };
+            fs::rename(&temp_path, &path)?;
+            Ok(output_file)
+        })();
+        if result.is_err() {
+            let _ = fs::remove_file(&temp_path);
+        }
+        result
+    }
+    #[cfg(not(unix))]
+    fn create(_path: PathBuf, _size: usize) -> io::Result<Self> {
+        Err(io::Error::new(
+            io::ErrorKind::Other,
+            "headless output files are only supported on unix",
+        ))
+    }
+    fn header(&self) -> &OutputHeader {
+        #[allow(clippy::cast_ptr_alignment)]
+        unsafe {
+            &*(self.memory.as_ptr() as *const OutputHeader)
+        }
+    }
+}
+
+impl Drop for OutputFile {
+    #[cfg(unix)]
+    fn drop(&mut self) {
+        unsafe {
+            libc::munmap(self.memory.as_ptr() as *mut _, self.size);
+        }
+    }
+    #[cfg(not(unix))]
+    fn drop(&mut self) {
+        unreachable!()
+    }
+}
+
+/// an image's part of the output file
+struct OutputImageMemory {
+    output_file: Arc<OutputFile>,
+    offset: usize,
+    layout: DeviceMemoryLayout,
+}
+
+impl fmt::Debug for OutputImageMemory {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_struct("OutputImageMemory")
+            .field("offset", &self.offset)
+            .field("layout", &self.layout)
+            .finish()
+    }
+}
+
+impl DeviceMemoryAllocation for OutputImageMemory {
+    unsafe fn get(&self) -> NonNull<u8> {
+        NonNull::new_unchecked(self.output_file.memory.as_ptr().add(self.offset))
+    }
+    fn layout(&self) -> DeviceMemoryLayout {
+        self.layout
+    }
+}
+
+struct SwapchainImage {
+    image: OwnedHandle<api::VkImage>,
+    /// dropped after `image`, since `image` refers to it
+    #[allow(dead_code)]
+    device_memory: OwnedHandle<api::VkDeviceMemory>,
+}
+
+pub struct HeadlessSwapchain {
+    images: Vec<SwapchainImage>,
+    output_file: Option<Arc<OutputFile>>,
+    available_images: Mutex<VecDeque<u32>>,
+    image_available: Condvar,
+}
+
+impl fmt::Debug for HeadlessSwapchain {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_struct("HeadlessSwapchain")
+            .field("image_count", &self.images.len())
+            .field("has_output_file", &self.output_file.is_some())
+            .finish()
+    }
+}
+
+impl HeadlessSwapchain {
+    pub unsafe fn new(
+        create_info: &api::VkSwapchainCreateInfoKHR,
+        _device_group_create_info: Option<&api::VkDeviceGroupSwapchainCreateInfoKHR>,
+    ) -> Result<Self, api::VkResult> {
+        assert!(PRESENT_MODES.contains(&create_info.presentMode));
+        assert!(SURFACE_FORMATS
+            .iter()
+            .any(|surface_format| surface_format.format == create_info.imageFormat));
+        assert_eq!(create_info.imageArrayLayers, 1);
+        let extent = create_info.imageExtent;
+        assert!(extent.width >= 1 && extent.width <= MAX_IMAGE_EXTENT);
+        assert!(extent.height >= 1 && extent.height <= MAX_IMAGE_EXTENT);
+        let image_properties = ImageProperties {
+            // kept linear, so the consumer can read the images without converting them
+            supported_tilings: SupportedTilings::LinearOnly,
+            format: create_info.imageFormat,
+            extents: api::VkExtent3D {
+                width: extent.width,
+                height: extent.height,
+                depth: 1,
+            },
+            array_layers: 1,
+            mip_levels: 1,
+            multisample_count: ImageMultisampleCount::Count1,
+            swapchain_present_tiling: Some(Tiling::Linear),
+        };
+        let memory_layout = image_properties.computed_properties().memory_layout;
+        let image_count =
+            get_swapchain_image_count(create_info.minImageCount, MAX_SWAPCHAIN_IMAGE_COUNT);
+        let image_offset = round_up(mem::size_of::<OutputHeader>(), OUTPUT_FILE_IMAGE_ALIGNMENT);
+        let image_stride = round_up(memory_layout.size, OUTPUT_FILE_IMAGE_ALIGNMENT);
+        let output_file = match get_output_file_path() {
+            Some(path) => Some(Arc::new(
+                OutputFile::create(path, image_offset + image_stride * image_count as usize)
+                    .map_err(|_| api::VK_ERROR_INITIALIZATION_FAILED)?,
+            )),
+            None => None,
+        };
+        let mut images = Vec::with_capacity(image_count as usize);
+        for image_index in 0..image_count as usize {
+            let device_memory = match &output_file {
+                Some(output_file) => DeviceMemory::from_special(
+                    DeviceMemoryType::Main,
+                    Box::new(OutputImageMemory {
+                        output_file: output_file.clone(),
+                        offset: image_offset + image_stride * image_index,
+                        layout: memory_layout,
+                    }),
+                ),
+                None => {
+                    DeviceMemory::allocate_from_default_heap(DeviceMemoryType::Main, memory_layout)
+                        .map_err(|_| api::VK_ERROR_OUT_OF_HOST_MEMORY)?
+                }
+            };
+            let device_memory = OwnedHandle::<api::VkDeviceMemory>::new(device_memory);
+            let image = OwnedHandle::<api::VkImage>::new(Image {
+                properties: image_properties,
+                usage: create_info.imageUsage,
+                memory: Some(ImageMemory {
+                    device_memory: SharedHandle::from(device_memory.get_handle()).unwrap(),
+                    offset: 0,
+                }),
+            });
+            images.push(SwapchainImage {
+                image,
+                device_memory,
+            });
+        }
+        if let Some(output_file) = &output_file {
+            #[allow(clippy::cast_ptr_alignment)]
+            let header = &mut *(output_file.memory.as_ptr() as *mut OutputHeader);
+            header.magic = OUTPUT_FILE_MAGIC;
+            header.version = OUTPUT_FILE_VERSION;
+            header.image_count = image_count;
+            header.format = create_info.imageFormat as u32;
+            header.width = extent.width;
+            header.height = extent.height;
+            header.row_pitch = image_properties
+                .get_subresource_layout(Tiling::Linear, 0, 0)
+                .row_pitch as u64;
+            header.image_offset = image_offset as u64;
+            header.image_stride = image_stride as u64;
+            header.status.store(OUTPUT_STATUS_ACTIVE, Ordering::Release);
+        }
+        Ok(Self {
+            images,
+            output_file,
+            available_images: Mutex::new((0..image_count).collect()),
+            image_available: Condvar::new(),
+        })
+    }
+}
+
+fn round_up(value: usize, alignment: usize) -> usize {
+    (value + alignment - 1) / alignment * alignment
+}
+
+impl Swapchain for HeadlessSwapchain {
+    unsafe fn get_images(&self) -> Vec<api::VkImage> {
+        self.images
+            .iter()
+            .map(|image| image.image.get_handle())
+            .collect()
+    }
+    unsafe fn acquire_next_image(&self, timeout: u64) -> Result<u32, api::VkResult> {
+        let deadline = if timeout == u64::max_value() {
+            None
+        } else {
+            Some(Instant::now() + Duration::from_nanos(timeout))
+        };
+        let mut available_images = self.available_images.lock().unwrap();
+        let image_index = loop {
+            if let Some(image_index) = available_images.pop_front() {
+                break image_index;
+            }
+            // images come back as soon as the queue presents them
+            available_images = match deadline {
+                None => self.image_available.wait(available_images).unwrap(),
+                Some(deadline) => {
+                    let now = Instant::now();
+                    if now >= deadline {
+                        return Err(if timeout == 0 {
+                            api::VK_NOT_READY
+                        } else {
+                            api::VK_TIMEOUT
+                        });
+                    }
+                    self.image_available
+                        .wait_timeout(available_images, deadline - now)
+                        .unwrap()
+                        .0
+                }
+            };
+        };
+        if let Some(output_file) = &self.output_file {
+            // the oldest image is handed out first, so the newest frame stays readable for as
+            // long as possible
+            output_file.header().image_sequences[image_index as usize]
+                .fetch_add(1, Ordering::Relaxed);
+            // keeps the rendering from becoming visible before the sequence number
+            atomic::fence(Ordering::Release);
+        }
+        Ok(image_index)
+    }
+    /// there's nothing to wait for, so presenting is done right on the queue's thread
+    unsafe fn present(&self, image_index: u32) {
+        if let Some(output_file) = &self.output_file {
+            let header = output_file.header();
+            header.image_sequences[image_index as usize].fetch_add(1, Ordering::Release);
+            header
+                .last_presented_image
+                .store(image_index, Ordering::Release);
+            header.presented_frame_count.fetch_add(1, Ordering::Release);
+        }
+        self.available_images.lock().unwrap().push_back(image_index);
+        self.image_available.notify_all();
+    }
+    fn get_status(&self) -> Result<(), api::VkResult> {
+        Ok(())
+    }
+}
+
+impl Drop for HeadlessSwapchain {
+    fn drop(&mut self) {
+        if let Some(output_file) = &self.output_file {
+            output_file
+                .header()
+                .status
+                .store(OUTPUT_STATUS_DESTROYED, Ordering::Release);
+        }
+    }
+}
+
+const SURFACE_FORMATS: &[api::VkSurfaceFormatKHR] = &[
+    api::VkSurfaceFormatKHR {
+        format: api::VK_FORMAT_B8G8R8A8_SRGB,
+        colorSpace: api::VK_COLOR_SPACE_SRGB_NONLINEAR_KHR,
+    },
+    api::VkSurfaceFormatKHR {
+        format: api::VK_FORMAT_B8G8R8A8_UNORM,
+        colorSpace: api::VK_COLOR_SPACE_SRGB_NONLINEAR_KHR,
+    },
+    api::VkSurfaceFormatKHR {
+        format: api::VK_FORMAT_R8G8B8A8_SRGB,
+        colorSpace: api::VK_COLOR_SPACE_SRGB_NONLINEAR_KHR,
+    },
+    api::VkSurfaceFormatKHR {
+        format: api::VK_FORMAT_R8G8B8A8_UNORM,
+        colorSpace: api::VK_COLOR_SPACE_SRGB_NONLINEAR_KHR,
+    },
+];
+
+/// nothing is ever shown, so all of them just make the image available again right away
+const PRESENT_MODES: &[api::VkPresentModeKHR] = &[
+    api::VK_PRESENT_MODE_FIFO_KHR,
+    api::VK_PRESENT_MODE_MAILBOX_KHR,
+    api::VK_PRESENT_MODE_IMMEDIATE_KHR,
+];
+
+#[derive(Debug)]
+pub struct HeadlessSurfaceImplementation;
+
+impl SurfaceImplementation for HeadlessSurfaceImplementation {
+    fn get_platform(&self) -> SurfacePlatform {
+        SurfacePlatform::VK_ICD_WSI_PLATFORM_HEADLESS
+    }
+    unsafe fn get_surface_formats(
+        &self,
+        _surface: api::VkSurfaceKHR,
+    ) -> Result<Cow<'static, [api::VkSurfaceFormatKHR]>, api::VkResult> {
+        Ok(Cow::Borrowed(SURFACE_FORMATS))
+    }
+    unsafe fn get_present_modes(
+        &self,
+        _surface: api::VkSurfaceKHR,
+    ) -> Result<Cow<'static, [api::VkPresentModeKHR]>, api::VkResult> {
+        Ok(Cow::Borrowed(PRESENT_MODES))
+    }
+    unsafe fn get_capabilities(
+        &self,
+        _surface: api::VkSurfaceKHR,
+    ) -> Result<api::VkSurfaceCapabilitiesKHR, api::VkResult> {
+        Ok(api::VkSurfaceCapabilitiesKHR {
+            minImageCount: 2,
+            maxImageCount: MAX_SWAPCHAIN_IMAGE_COUNT,
+            // the extent is picked by the swapchain
+            currentExtent: api::VkExtent2D {
+                width: !0,
+                height: !0,
+            },
+            minImageExtent: api::VkExtent2D {
+                width: 1,
+                height: 1,
+            },
+            maxImageExtent: api::VkExtent2D {
+                width: MAX_IMAGE_EXTENT,
+                height: MAX_IMAGE_EXTENT,
+            },
+            maxImageArrayLayers: 1,
+            supportedTransforms: api::VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR,
+            currentTransform: api::VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR,
+            supportedCompositeAlpha: api::VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
+            supportedUsageFlags: api::VK_IMAGE_USAGE_TRANSFER_SRC_BIT
+                | api::VK_IMAGE_USAGE_TRANSFER_DST_BIT
+                | api::VK_IMAGE_USAGE_SAMPLED_BIT
+                | api::VK_IMAGE_USAGE_STORAGE_BIT
+                | api::VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT
+                | api::VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT,
+        })
+    }
+    unsafe fn build(
+        &self,
+        create_info: &api::VkSwapchainCreateInfoKHR,
+        device_group_create_info: Option<&api::VkDeviceGroupSwapchainCreateInfoKHR>,
+    ) -> Result<Box<Swapchain>, api::VkResult> {
+        Ok(Box::new(HeadlessSwapchain::new(
+            create_info,
+            device_group_create_info,
+        )?))
+    }
+    unsafe fn destroy_surface(&self, surface: NonNull<api::VkIcdSurfaceBase>) {
+        #[allow(clippy::cast_ptr_alignment)]
+        Box::from_raw(surface.as_ptr() as *mut api::VkIcdSurfaceHeadless);
+    }
+    fn duplicate(&self) -> Box<dyn SurfaceImplementation> {
+        Box::new(Self {})
+    }
+}
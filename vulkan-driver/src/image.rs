@@ -3,10 +3,11 @@
 #![allow(clippy::unneeded_field_pattern)]
 use crate::api;
 use crate::constants::IMAGE_ALIGNMENT;
-use crate::device_memory::DeviceMemoryLayout;
+use crate::device_memory::{DeviceMemoryLayout, DeviceMemoryType, DeviceMemoryTypes};
 use crate::handle::SharedHandle;
 use std::error;
 use std::fmt;
+use std::ops::Range;
 
 #[derive(Copy, Clone, Eq, PartialEq, Hash, Debug)]
 pub enum SupportedTilings {
@@ -14,19 +15,65 @@ pub enum SupportedTilings {
     LinearOnly,
 }
 
+#[repr(u32)]
 #[derive(Copy, Clone, Eq, PartialEq, Hash, Debug)]
 pub enum Tiling {
     Linear,
-    #[allow(dead_code)]
+    /// pixels are grouped into `TILE_SIZE` by `TILE_SIZE` tiles, each stored contiguously in
+    /// row-major order, and the tiles are stored in row-major order
     Tiled,
 }
 
+/// width and height of a tile in pixels; a tile of 4-byte pixels fills one 64-byte cache line
+pub const TILE_SIZE: u32 = 4;
+
+impl Tiling {
+    /// offset of a pixel relative to the start of its depth slice; `row_pitch` is the distance
+    /// between rows of tiles for `Tiling::Tiled`
+    pub fn get_offset_in_slice(
+        self,
+        pixel_size_in_bytes: usize,
+        row_pitch: usize,
+        x: usize,
+        y: usize,
+    ) -> usize {
+        match self {
+            Tiling::Linear => y * row_pitch + x * pixel_size_in_bytes,
+            Tiling::Tiled => {
+                let tile_size = TILE_SIZE as usize;
+                let tile_size_in_bytes = pixel_size_in_bytes * tile_size * tile_size;
+                let tile_offset =
+                    (y / tile_size) * row_pitch + (x / tile_size) * tile_size_in_bytes;
+                let offset_in_tile = (y % tile_size) * tile_size + x % tile_size;
+                tile_offset + offset_in_tile * pixel_size_in_bytes
+            }
+        }
+    }
+    /// how many pixels of a row, starting at `x`, are next to each other in memory, up to
+    /// `max_count`
+    pub fn get_contiguous_pixel_count(self, x: usize, max_count: usize) -> usize {
+        match self {
+            Tiling::Linear => max_count,
+            Tiling::Tiled => max_count.min(TILE_SIZE as usize - x % TILE_SIZE as usize),
+        }
+    }
+}
+
 #[derive(Copy, Clone, Eq, PartialEq, Hash, Debug)]
 pub enum ImageMultisampleCount {
     Count1,
     Count4,
 }
 
+impl ImageMultisampleCount {
+    pub fn get(self) -> usize {
+        match self {
+            ImageMultisampleCount::Count1 => 1,
+            ImageMultisampleCount::Count4 => 4,
+        }
+    }
+}
+
 #[derive(Copy, Clone, Debug)]
 pub struct ImageProperties {
     pub supported_tilings: SupportedTilings,
@@ -44,6 +91,36 @@ pub struct ImageComputedProperties {
     pub memory_layout: DeviceMemoryLayout,
 }
 
+/// where a single mip level of a single array layer is in memory, relative to the start of
+/// the image. For `Tiling::Tiled`, `row_pitch` is the distance between rows of tiles.
+#[derive(Copy, Clone, Debug)]
+pub struct SubresourceLayout {
+    pub offset: usize,
+    pub size: usize,
+    pub row_pitch: usize,
+    pub depth_pitch: usize,
+    pub array_pitch: usize,
+}
+
+fn get_pixel_size_in_bytes(format: api::VkFormat) -> Option<usize> {
+    match format {
+        api::VK_FORMAT_R8G8B8A8_UNORM
+        | api::VK_FORMAT_R8G8B8A8_SRGB
+        | api::VK_FORMAT_B8G8R8A8_UNORM
+        | api::VK_FORMAT_B8G8R8A8_SRGB
+        | api::VK_FORMAT_D32_SFLOAT => Some(4),
+        _ => None,
+    }
+}
+
+fn get_mip_level_size(size: u32, mip_level: u32) -> u32 {
+    (size >> mip_level).max(1)
+}
+
+fn round_up(value: usize, multiple: usize) -> usize {
+    (value + multiple - 1) / multiple * multiple
+}
+
 impl ImageProperties {
     pub fn get_tiling(&self, image_layout: api::VkImageLayout) -> Tiling {
         if image_layout == api::VK_IMAGE_LAYOUT_PRESENT_SRC_KHR {
@@ -55,35 +132,123 @@ impl ImageProperties {
             }
         }
     }
-    pub fn computed_properties(&self) -> ImageComputedProperties {
-        match *self {
-            Self {
-                supported_tilings: SupportedTilings::Any,
-                format: api::VK_FORMAT_R8G8B8A8_UNORM,
-                extents,
-                array_layers,
-                mip_levels: 1,
-                multisample_count: ImageMultisampleCount::Count1,
-                swapchain_present_tiling: _,
-            } => {
-                let pixel_size_in_bytes = 4;
-                ImageComputedProperties {
-                    pixel_size_in_bytes,
-                    memory_layout: DeviceMemoryLayout::calculate(
-                        pixel_size_in_bytes
-                            .checked_mul(extents.width as usize)
-                            .unwrap()
-                            .checked_mul(extents.height as usize)
-                            .unwrap()
-                            .checked_mul(extents.depth as usize)
-                            .unwrap()
-                            .checked_mul(array_layers as usize)
-                            .unwrap(),
-                        IMAGE_ALIGNMENT,
-                    ),
+    /// the samples of a pixel are stored next to each other, so this includes all of them
+    pub fn get_pixel_size_in_bytes(&self) -> usize {
+        match get_pixel_size_in_bytes(self.format) {
+            Some(pixel_size_in_bytes) => pixel_size_in_bytes * self.multisample_count.get(),
+            None => unimplemented!("ImageProperties::get_pixel_size_in_bytes({:?})", self),
+        }
+    }
+    pub fn get_mip_level_extents(&self, mip_level: u32) -> api::VkExtent3D {
+        assert!(mip_level < self.mip_levels);
+        api::VkExtent3D {
+            width: get_mip_level_size(self.extents.width, mip_level),
+            height: get_mip_level_size(self.extents.height, mip_level),
+            depth: get_mip_level_size(self.extents.depth, mip_level),
+        }
+    }
+    /// mip levels are stored one after another, each holding every array layer, and each
+    /// starting at a multiple of `IMAGE_ALIGNMENT`
+    pub fn get_subresource_layout(
+        &self,
+        tiling: Tiling,
+        mip_level: u32,
+        array_layer: u32,
+    ) -> SubresourceLayout {
+        assert!(array_layer < self.array_layers);
+        let pixel_size_in_bytes = self.get_pixel_size_in_bytes();
+        let array_layers = self.array_layers as usize;
+        let mut offset = 0;
+        for current_mip_level in 0..=mip_level {
+            let extents = self.get_mip_level_extents(current_mip_level);
+            let (row_pitch, row_count) = match tiling {
+                Tiling::Linear => (
+                    pixel_size_in_bytes
+                        .checked_mul(extents.width as usize)
+                        .unwrap(),
+                    extents.height as usize,
+                ),
+                Tiling::Tiled => {
+                    let tile_size = TILE_SIZE as usize;
+                    let tile_size_in_bytes = pixel_size_in_bytes * tile_size * tile_size;
+                    let tiles_per_row = round_up(extents.width as usize, tile_size) / tile_size;
+                    let tile_row_count = round_up(extents.height as usize, tile_size) / tile_size;
+                    (
+                        tile_size_in_bytes.checked_mul(tiles_per_row).unwrap(),
+                        tile_row_count,
+                    )
                 }
+            };
+            let depth_pitch = row_pitch.checked_mul(row_count).unwrap();
+            let size = depth_pitch.checked_mul(extents.depth as usize).unwrap();
+            let array_pitch = round_up(size, IMAGE_ALIGNMENT);
+            if current_mip_level == mip_level {
+                return SubresourceLayout {
+                    offset: offset + array_pitch * array_layer as usize,
+                    size,
+                    row_pitch,
+                    depth_pitch,
+                    array_pitch,
+                };
             }
-            _ => unimplemented!("ImageProperties::computed_properties({:?})", self),
+            offset = array_pitch
+                .checked_mul(array_layers)
+                .and_then(|v| v.checked_add(offset))
+                .unwrap();
+        }
+        unreachable!()
+    }
+    /// the memory holding `layer_count` array layers of one mip level, relative to the start
+    /// of the image
+    pub fn get_subresources_range(
+        &self,
+        tiling: Tiling,
+        mip_level: u32,
+        base_array_layer: u32,
+        layer_count: u32,
+    ) -> Range<usize> {
+        let first = self.get_subresource_layout(tiling, mip_level, base_array_layer);
+        let last =
+            self.get_subresource_layout(tiling, mip_level, base_array_layer + layer_count - 1);
+        first.offset..last.offset + last.size
+    }
+    /// the offset of the first byte of a pixel, relative to the start of the image
+    #[allow(dead_code)]
+    pub fn get_pixel_offset(
+        &self,
+        tiling: Tiling,
+        mip_level: u32,
+        array_layer: u32,
+        x: u32,
+        y: u32,
+        z: u32,
+    ) -> usize {
+        let extents = self.get_mip_level_extents(mip_level);
+        assert!(x < extents.width && y < extents.height && z < extents.depth);
+        let layout = self.get_subresource_layout(tiling, mip_level, array_layer);
+        let offset_in_slice = tiling.get_offset_in_slice(
+            self.get_pixel_size_in_bytes(),
+            layout.row_pitch,
+            x as usize,
+            y as usize,
+        );
+        layout.offset + z as usize * layout.depth_pitch + offset_in_slice
+    }
+    fn get_memory_size(&self, tiling: Tiling) -> usize {
+        let last_mip_level = self.mip_levels - 1;
+        let last_array_layer = self.array_layers - 1;
+        let layout = self.get_subresource_layout(tiling, last_mip_level, last_array_layer);
+        layout.offset + layout.array_pitch
+    }
+    pub fn computed_properties(&self) -> ImageComputedProperties {
+        let pixel_size_in_bytes = self.get_pixel_size_in_bytes();
+        let size = match self.supported_tilings {
+            SupportedTilings::LinearOnly => self.get_memory_size(Tiling::Linear),
+            SupportedTilings::Any => self.get_memory_size(Tiling::Tiled),
+        };
+        ImageComputedProperties {
+            pixel_size_in_bytes,
+            memory_layout: DeviceMemoryLayout::calculate(size, IMAGE_ALIGNMENT),
         }
     }
 }
@@ -97,9 +262,20 @@ pub struct ImageMemory {
 #[derive(Debug)]
 pub struct Image {
     pub properties: ImageProperties,
+    pub usage: api::VkImageUsageFlags,
     pub memory: Option<ImageMemory>,
 }
 
+impl Image {
+    pub fn supported_memory_types(&self) -> DeviceMemoryTypes {
+        let mut retval = DeviceMemoryTypes::non_lazy();
+        if self.usage & api::VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT != 0 {
+            retval[DeviceMemoryType::LazilyAllocated] = true;
+        }
+        retval
+    }
+}
+
 #[derive(Copy, Clone, Eq, PartialEq, Hash, Debug)]
 pub enum ImageViewType {
     Type1D,
@@ -204,3 +380,184 @@ pub struct ImageView {
     pub component_mapping: ComponentMapping,
     pub subresource_range: api::VkImageSubresourceRange,
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::collections::HashSet;
+
+    /// 4-byte pixels, so a tile is 64 bytes
+    const TILE_SIZE_IN_BYTES: usize = 64;
+
+    fn get_tiled_properties(
+        width: u32,
+        height: u32,
+        array_layers: u32,
+        mip_levels: u32,
+    ) -> ImageProperties {
+        ImageProperties {
+            supported_tilings: SupportedTilings::Any,
+            format: api::VK_FORMAT_R8G8B8A8_UNORM,
+            extents: api::VkExtent3D {
+                width,
+                height,
+                depth: 1,
+            },
+            array_layers,
+            mip_levels,
+            multisample_count: ImageMultisampleCount::Count1,
+            swapchain_present_tiling: None,
+        }
+    }
+
+    /// where `(x, y)` is relative to the start of a subresource that's `x_tile_count` tiles
+    /// wide
+    fn get_expected_offset(x_tile_count: usize, x: u32, y: u32) -> usize {
+        let (x, y) = (x as usize, y as usize);
+        let tile_index = y / 4 * x_tile_count + x / 4;
+        let index_in_tile = y % 4 * 4 + x % 4;
+        tile_index * TILE_SIZE_IN_BYTES + index_in_tile * 4
+    }
+
+    #[test]
+    fn test_tiled_pixel_offsets() {
+        // the extents and tile counts: when the extents aren't multiples of the tile size,
+        // the last column and row of tiles are only partly used
+        let cases = [
+            ((13, 9), (4, 3)),
+            ((16, 8), (4, 2)),
+            ((5, 4), (2, 1)),
+            ((1, 1), (1, 1)),
+        ];
+        for &((width, height), (x_tile_count, y_tile_count)) in &cases {
+            let properties = get_tiled_properties(width, height, 1, 1);
+            let layout = properties.get_subresource_layout(Tiling::Tiled, 0, 0);
+            assert_eq!(layout.offset, 0);
+            assert_eq!(layout.row_pitch, x_tile_count * TILE_SIZE_IN_BYTES);
+            assert_eq!(layout.depth_pitch, y_tile_count * layout.row_pitch);
+            assert_eq!(layout.size, layout.depth_pitch);
+            let mut offsets = HashSet::new();
+            for y in 0..height {
+                for x in 0..width {
+                    let offset = properties.get_pixel_offset(Tiling::Tiled, 0, 0, x, y, 0);
+                    assert_eq!(
+                        offset,
+                        get_expected_offset(x_tile_count, x, y),
+                        "{}x{} ({}, {})",
+                        width,
+                        height,
+                        x,
+                        y
+                    );
+                    assert!(offset + 4 <= layout.size);
+                    assert!(offsets.insert(offset));
+                }
+            }
+            let computed_properties = properties.computed_properties();
+            assert_eq!(computed_properties.pixel_size_in_bytes, 4);
+            assert_eq!(
+                computed_properties.memory_layout.size,
+                round_up(layout.size, IMAGE_ALIGNMENT)
+            );
+        }
+    }
+
+    #[test]
+    fn test_tiled_mip_tail() {
+        let properties = get_tiled_properties(13, 9, 1, 4);
+        // the extents and tile counts of each mip level, down to 1x1, which still takes up a
+        // whole tile
+        let expected = [
+            ((13, 9), (4, 3)),
+            ((6, 4), (2, 1)),
+            ((3, 2), (1, 1)),
+            ((1, 1), (1, 1)),
+        ];
+        let mut offset = 0;
+        for (mip_level, &((width, height), (x_tile_count, y_tile_count))) in
+            expected.iter().enumerate()
+        {
+            let mip_level = mip_level as u32;
+            let extents = properties.get_mip_level_extents(mip_level);
+            assert_eq!(
+                (extents.width, extents.height, extents.depth),
+                (width, height, 1)
+            );
+            let layout = properties.get_subresource_layout(Tiling::Tiled, mip_level, 0);
+            assert_eq!(layout.offset, offset, "mip level {}", mip_level);
+            assert_eq!(layout.offset % IMAGE_ALIGNMENT, 0);
+            assert_eq!(layout.row_pitch, x_tile_count * TILE_SIZE_IN_BYTES);
+            assert_eq!(
+                layout.size,
+                x_tile_count * y_tile_count * TILE_SIZE_IN_BYTES
+            );
+            for &(x, y) in &[
+                (0, 0),
+                (width - 1, 0),
+                (0, height - 1),
+                (width - 1, height - 1),
+            ] {
+                assert_eq!(
+                    properties.get_pixel_offset(Tiling::Tiled, mip_level, 0, x, y, 0),
+                    offset + get_expected_offset(x_tile_count, x, y),
+                    "mip level {} ({}, {})",
+                    mip_level,
+                    x,
+                    y
+                );
+            }
+            offset += round_up(layout.size, IMAGE_ALIGNMENT);
+        }
+        assert_eq!(properties.computed_properties().memory_layout.size, offset);
+    }
+
+    #[test]
+    fn test_tiled_array_layers() {
+        let properties = get_tiled_properties(13, 9, 3, 4);
+        // each mip level holds every layer, so the subresources are back to back in mip level
+        // then layer order
+        let mut end = 0;
+        for mip_level in 0..4 {
+            let extents = properties.get_mip_level_extents(mip_level);
+            for layer in 0..3 {
+                let layout = properties.get_subresource_layout(Tiling::Tiled, mip_level, layer);
+                assert_eq!(
+                    layout.offset, end,
+                    "mip level {} layer {}",
+                    mip_level, layer
+                );
+                assert_eq!(layout.array_pitch, round_up(layout.size, IMAGE_ALIGNMENT));
+                let last_pixel_offset = properties.get_pixel_offset(
+                    Tiling::Tiled,
+                    mip_level,
+                    layer,
+                    extents.width - 1,
+                    extents.height - 1,
+                    0,
+                );
+                assert_eq!(
+                    properties.get_pixel_offset(Tiling::Tiled, mip_level, layer, 0, 0, 0),
+                    layout.offset
+                );
+                assert!(last_pixel_offset + 4 <= layout.offset + layout.size);
+                end = layout.offset + layout.array_pitch;
+            }
+            let second = properties.get_subresource_layout(Tiling::Tiled, mip_level, 1);
+            let third = properties.get_subresource_layout(Tiling::Tiled, mip_level, 2);
+            assert_eq!(
+                properties.get_subresources_range(Tiling::Tiled, mip_level, 1, 2),
+                second.offset..third.offset + third.size
+            );
+        }
+        assert_eq!(properties.computed_properties().memory_layout.size, end);
+        // past the 3 layers of the 4x3-tile mip level 0, then 2 layers of the 2x1-tile mip
+        // level 1
+        assert_eq!(
+            properties
+                .get_subresource_layout(Tiling::Tiled, 1, 2)
+                .offset,
+            3 * round_up(12 * TILE_SIZE_IN_BYTES, IMAGE_ALIGNMENT)
+                + 2 * round_up(2 * TILE_SIZE_IN_BYTES, IMAGE_ALIGNMENT)
+        );
+    }
+}
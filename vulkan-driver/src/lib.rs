@@ -3,29 +3,51 @@
 #![allow(clippy::new_ret_no_self)]
 #[macro_use]
 mod util;
+#[macro_use]
+mod slab;
+pub mod aot;
 mod api;
 mod api_impl;
+mod background_compiler;
+#[cfg(feature = "benchmark")]
+pub mod benchmark;
 mod buffer;
+mod command_buffer;
+mod compute;
+mod dependency_graph;
 mod descriptor_set;
 mod device_memory;
+#[cfg(all(target_arch = "x86_64", target_os = "linux"))]
+mod fiber;
 mod handle;
+mod headless_swapchain;
 mod image;
 mod pipeline;
+mod pipeline_cache;
+mod query;
+mod queue;
+mod rasterizer;
 mod render_pass;
 mod sampler;
 mod shader_module;
 #[cfg(target_os = "linux")]
 mod shm;
+mod suballocator;
 mod swapchain;
+mod sync;
+mod timestamp;
+mod transfer;
 #[cfg(target_os = "linux")]
 mod xcb_swapchain;
 #[cfg(target_os = "linux")]
 mod xlib_swapchain;
+mod worker_pool;
 use std::ffi::CStr;
 use std::os::raw::c_char;
 
 mod constants {
     pub const KAZAN_DEVICE_NAME: &str = "Kazan Software Renderer";
+    pub const KAZAN_DEVICE_ID: u32 = 1;
     pub const MIN_MEMORY_MAP_ALIGNMENT: usize = 128; // must be at least 64 and a power of 2 according to Vulkan spec
     pub const QUEUE_FAMILY_COUNT: u32 = 1;
     pub const QUEUE_COUNTS: [u32; QUEUE_FAMILY_COUNT as usize] = [1];
@@ -2,15 +2,19 @@
 // See Notices.txt for copyright information
 
 use crate::api;
-use crate::handle::{OwnedHandle, SharedHandle};
+use crate::handle::{Handle, OwnedHandle, SharedHandle};
+use crate::pipeline_cache::{CachedPipeline, PipelineCache, PipelineCacheKey};
+use crate::rasterizer::{FixedFunctionState, GraphicsShaders};
 use crate::util;
 use shader_compiler;
 use shader_compiler_backend;
 use std::collections::HashMap;
+use std::env;
 use std::ffi::CStr;
 use std::fmt;
 use std::iter;
 use std::ops::Deref;
+use std::sync::{Arc, Mutex};
 
 pub fn get_shader_compiler_backend() -> impl shader_compiler_backend::Compiler {
     shader_compiler_backend_llvm_7::LLVM_7_SHADER_COMPILER
@@ -26,19 +30,40 @@ pub struct PipelineLayout {
 
 pub trait GenericPipeline: fmt::Debug + Sync + 'static {}
 
-pub trait GenericPipelineSized: GenericPipeline + Sized {
+pub trait GenericPipelineSized: GenericPipeline + Clone + Send + Sized {
     type PipelineCreateInfo;
+    /// `create_pipelines` only creates one pipeline for all the create infos with the same key;
+    /// `None` means `create_info` is never deduplicated
+    unsafe fn get_key(create_info: &Self::PipelineCreateInfo) -> Option<PipelineCacheKey>;
+    /// fails with what `vkCreate*Pipelines` returns
     unsafe fn create(
         device: SharedHandle<api::VkDevice>,
         pipeline_cache: Option<SharedHandle<api::VkPipelineCache>>,
         create_info: &Self::PipelineCreateInfo,
-    ) -> Self;
+    ) -> Result<Self, api::VkResult>;
     fn to_pipeline(self) -> Pipeline;
 }
 
-#[derive(Debug)]
+/// cloning shares the compiled code
+#[derive(Clone, Debug)]
 pub struct ComputePipeline {
-    pipeline: shader_compiler::ComputePipeline,
+    /// with tiered compilation, replaced by the optimized build once that finishes
+    compiled: Arc<Mutex<Arc<shader_compiler::ComputePipeline>>>,
+}
+
+impl From<shader_compiler::ComputePipeline> for ComputePipeline {
+    fn from(compiled: shader_compiler::ComputePipeline) -> Self {
+        Self {
+            compiled: Arc::new(Mutex::new(Arc::new(compiled))),
+        }
+    }
+}
+
+impl ComputePipeline {
+    /// the most optimized code available so far; keeps working after it's been replaced
+    pub fn get_compiled(&self) -> Arc<shader_compiler::ComputePipeline> {
+        self.compiled.lock().unwrap().clone()
+    }
 }
 
 impl GenericPipeline for ComputePipeline {}
@@ -107,7 +132,25 @@ macro_rules! get_shader_stages {
     };
 }
 
-fn get_generic_pipeline_options(
+/// the number of invocations each call of a compiled shader runs, one per SIMD lane; must be a
+/// power of 2, `1` compiles scalar shaders
+pub const SHADER_LANE_COUNT_ENV_VAR: &str = "KAZAN_SHADER_LANE_COUNT";
+
+const MAX_SHADER_LANE_COUNT: u32 = 64;
+
+/// scalar unless `SHADER_LANE_COUNT_ENV_VAR` says otherwise, since divergent control flow
+/// isn't masked yet
+fn get_shader_lane_count() -> u32 {
+    env::var(SHADER_LANE_COUNT_ENV_VAR)
+        .ok()
+        .and_then(|value| value.parse().ok())
+        .filter(|&lane_count: &u32| {
+            lane_count.is_power_of_two() && lane_count <= MAX_SHADER_LANE_COUNT
+        })
+        .unwrap_or(1)
+}
+
+pub fn get_generic_pipeline_options(
     flags: api::VkPipelineCreateFlags,
 ) -> shader_compiler::GenericPipelineOptions {
     shader_compiler::GenericPipelineOptions {
@@ -116,16 +159,37 @@ fn get_generic_pipeline_options(
         } else {
             shader_compiler_backend::OptimizationMode::Normal
         },
+        lane_count: get_shader_lane_count(),
     }
 }
 
-impl GenericPipelineSized for ComputePipeline {
-    type PipelineCreateInfo = api::VkComputePipelineCreateInfo;
-    unsafe fn create(
-        _device: SharedHandle<api::VkDevice>,
-        _pipeline_cache: Option<SharedHandle<api::VkPipelineCache>>,
+/// the pipeline layout is included, since the generated code reads descriptors and push
+/// constants at offsets given by the layout
+pub fn get_compute_pipeline_key(
+    compute_stage: &shader_compiler::ShaderStageCreateInfo,
+    pipeline_layout: &shader_compiler::PipelineLayout,
+    options: &shader_compiler::ComputePipelineOptions,
+) -> PipelineCacheKey {
+    PipelineCacheKey::new(&(
+        "compute",
+        compute_stage,
+        pipeline_layout,
+        options,
+        get_shader_compiler_backend().name(),
+    ))
+}
+
+impl ComputePipeline {
+    /// calls `f` with the inputs to the shader compiler and the key they hash to
+    unsafe fn with_compile_inputs<R>(
         create_info: &api::VkComputePipelineCreateInfo,
-    ) -> Self {
+        f: impl FnOnce(
+            shader_compiler::ShaderStageCreateInfo,
+            shader_compiler::PipelineLayout,
+            shader_compiler::ComputePipelineOptions,
+            PipelineCacheKey,
+        ) -> R,
+    ) -> R {
         parse_next_chain_const! {
             create_info,
             root = api::VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
@@ -141,34 +205,323 @@ impl GenericPipelineSized for ComputePipeline {
             .unwrap()
             .shader_compiler_pipeline_layout
             .clone();
+        let options = shader_compiler::ComputePipelineOptions {
+            generic_options: get_generic_pipeline_options(create_info.flags),
+        };
+        let key = get_compute_pipeline_key(&compute_stage, &pipeline_layout, &options);
+        f(compute_stage, pipeline_layout, options, key)
+    }
+}
+
+/// owned copy of a `shader_compiler::ShaderStageCreateInfo`, so it can be compiled after the
+/// application destroys the `VkShaderModule`
+#[derive(Debug)]
+struct OwnedShaderStage {
+    code: Vec<u32>,
+    entry_point_name: String,
+    specializations: Vec<(u32, Vec<u8>)>,
+}
+
+impl OwnedShaderStage {
+    fn new(stage: shader_compiler::ShaderStageCreateInfo) -> Self {
         Self {
-            pipeline: shader_compiler::ComputePipeline::new(
-                &shader_compiler::ComputePipelineOptions {
-                    generic_options: get_generic_pipeline_options(create_info.flags),
-                },
+            code: stage.code.into(),
+            entry_point_name: stage.entry_point_name.into(),
+            specializations: stage
+                .specializations
+                .iter()
+                .map(|specialization| (specialization.id, specialization.bytes.into()))
+                .collect(),
+        }
+    }
+    fn with_stage<R>(&self, f: impl FnOnce(shader_compiler::ShaderStageCreateInfo) -> R) -> R {
+        let specializations: Vec<_> = self
+            .specializations
+            .iter()
+            .map(|(id, bytes)| shader_compiler::Specialization { id: *id, bytes })
+            .collect();
+        f(shader_compiler::ShaderStageCreateInfo {
+            code: &self.code,
+            entry_point_name: &self.entry_point_name,
+            specializations: &specializations,
+        })
+    }
+}
+
+/// uses the shader module's unspecialized form from `pipeline_cache`, if there is one
+fn new_compute_pipeline(
+    options: &shader_compiler::ComputePipelineOptions,
+    compute_stage: shader_compiler::ShaderStageCreateInfo,
+    pipeline_layout: shader_compiler::PipelineLayout,
+    pipeline_cache: Option<&PipelineCache>,
+) -> shader_compiler::ComputePipeline {
+    match PipelineCache::get_unspecialized_module(pipeline_cache, compute_stage.code) {
+        Some(unspecialized_module) => {
+            shader_compiler::ComputePipeline::new_from_unspecialized_module(
+                options,
                 compute_stage,
+                &unspecialized_module,
                 pipeline_layout,
                 get_shader_compiler_backend(),
-            ),
+            )
         }
+        None => shader_compiler::ComputePipeline::new(
+            options,
+            compute_stage,
+            pipeline_layout,
+            get_shader_compiler_backend(),
+        ),
+    }
+}
+
+pub fn compile_compute_pipeline(
+    options: &shader_compiler::ComputePipelineOptions,
+    compute_stage: shader_compiler::ShaderStageCreateInfo,
+    pipeline_layout: shader_compiler::PipelineLayout,
+    cache_key: PipelineCacheKey,
+    pipeline_cache: Option<&PipelineCache>,
+) -> shader_compiler::ComputePipeline {
+    let pipeline = new_compute_pipeline(options, compute_stage, pipeline_layout, pipeline_cache);
+    if let Some(object_code) = pipeline.object_code() {
+        PipelineCache::insert(
+            pipeline_cache,
+            cache_key,
+            &CachedPipeline {
+                object_code: object_code.clone(),
+                dispatch_info: *pipeline.dispatch_info(),
+            },
+        );
+    }
+    pipeline
+}
+
+impl GenericPipelineSized for ComputePipeline {
+    type PipelineCreateInfo = api::VkComputePipelineCreateInfo;
+    unsafe fn get_key(create_info: &api::VkComputePipelineCreateInfo) -> Option<PipelineCacheKey> {
+        Some(Self::with_compile_inputs(create_info, |_, _, _, key| key))
+    }
+    /// with tiered compilation, a pipeline that isn't cached is first compiled without
+    /// optimizations, and the optimized build replaces it when it finishes
+    unsafe fn create(
+        device: SharedHandle<api::VkDevice>,
+        pipeline_cache: Option<SharedHandle<api::VkPipelineCache>>,
+        create_info: &api::VkComputePipelineCreateInfo,
+    ) -> Result<Self, api::VkResult> {
+        let pipeline_cache = pipeline_cache.as_ref().map(|v| &**v);
+        Ok(Self::with_compile_inputs(
+            create_info,
+            |compute_stage, pipeline_layout, options, cache_key| {
+                if let Some(cached) = PipelineCache::get(pipeline_cache, cache_key) {
+                    // fall back to compiling if the cached code can't be loaded
+                    if let Ok(pipeline) = shader_compiler::ComputePipeline::load(
+                        cached.object_code,
+                        cached.dispatch_info,
+                        get_shader_compiler_backend(),
+                    ) {
+                        return Self::from(pipeline);
+                    }
+                }
+                let background_compiler = match &device.background_compiler {
+                    Some(background_compiler)
+                        if options.generic_options.optimization_mode
+                            != shader_compiler_backend::OptimizationMode::NoOptimizations =>
+                    {
+                        background_compiler
+                    }
+                    _ => {
+                        return Self::from(compile_compute_pipeline(
+                            &options,
+                            compute_stage,
+                            pipeline_layout,
+                            cache_key,
+                            pipeline_cache,
+                        ));
+                    }
+                };
+                let mut unoptimized_options = options.clone();
+                unoptimized_options.generic_options.optimization_mode =
+                    shader_compiler_backend::OptimizationMode::NoOptimizations;
+                let retval = Self::from(new_compute_pipeline(
+                    &unoptimized_options,
+                    compute_stage,
+                    pipeline_layout.clone(),
+                    pipeline_cache,
+                ));
+                let compiled = Arc::downgrade(&retval.compiled);
+                let compute_stage = OwnedShaderStage::new(compute_stage);
+                let pipeline_cache = pipeline_cache.cloned();
+                background_compiler.add_job(move || {
+                    if compiled.upgrade().is_none() {
+                        // already destroyed
+                        return;
+                    }
+                    let pipeline = compute_stage.with_stage(|compute_stage| {
+                        compile_compute_pipeline(
+                            &options,
+                            compute_stage,
+                            pipeline_layout,
+                            cache_key,
+                            pipeline_cache.as_ref(),
+                        )
+                    });
+                    if let Some(compiled) = compiled.upgrade() {
+                        *compiled.lock().unwrap() = Arc::new(pipeline);
+                    }
+                });
+                retval
+            },
+        ))
     }
     fn to_pipeline(self) -> Pipeline {
         Pipeline::Compute(self)
     }
 }
 
-#[derive(Debug)]
-pub struct GraphicsPipeline {}
+/// cloning shares the state and the shader stages
+#[derive(Clone, Debug)]
+pub struct GraphicsPipeline {
+    pub fixed_function_state: Arc<FixedFunctionState>,
+    /// kept until the shader compiler can compile vertex and fragment shaders
+    #[allow(dead_code)]
+    vertex_stage: Arc<OwnedShaderStage>,
+    #[allow(dead_code)]
+    fragment_stage: Option<Arc<OwnedShaderStage>>,
+}
+
+impl GraphicsPipeline {
+    /// `None` until the shader compiler can compile vertex and fragment shaders
+    pub fn get_shaders(&self) -> Option<Arc<dyn GraphicsShaders>> {
+        None
+    }
+}
+
+/// `None` if `dynamic_state` is in `dynamic_states`
+fn get_static_state<T>(
+    dynamic_states: &[api::VkDynamicState],
+    dynamic_state: api::VkDynamicState,
+    get: impl FnOnce() -> T,
+) -> Option<T> {
+    if dynamic_states.contains(&dynamic_state) {
+        None
+    } else {
+        Some(get())
+    }
+}
+
+unsafe fn get_fixed_function_state(
+    create_info: &api::VkGraphicsPipelineCreateInfo,
+) -> FixedFunctionState {
+    let render_pass = SharedHandle::from(create_info.renderPass).unwrap();
+    let subpass = &render_pass.subpasses[create_info.subpass as usize];
+    let dynamic_states = match create_info.pDynamicState.as_ref() {
+        Some(dynamic_state) => util::to_slice(
+            dynamic_state.pDynamicStates,
+            dynamic_state.dynamicStateCount as usize,
+        ),
+        None => &[],
+    };
+    let input_assembly_state = &*create_info.pInputAssemblyState;
+    assert!(create_info.pTessellationState.is_null());
+    let rasterization_state = &*create_info.pRasterizationState;
+    parse_next_chain_const! {
+        rasterization_state,
+        root = api::VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO,
+    }
+    assert_eq!(rasterization_state.polygonMode, api::VK_POLYGON_MODE_FILL);
+    // FIXME: implement depth bias
+    let rasterizer_discard = rasterization_state.rasterizerDiscardEnable != api::VK_FALSE;
+    // the viewport, multisample, depth/stencil, and color blend states are ignored when
+    // rasterization is disabled
+    let viewport_state = if rasterizer_discard {
+        None
+    } else {
+        create_info.pViewportState.as_ref()
+    };
+    if let Some(viewport_state) = viewport_state {
+        assert_eq!(viewport_state.viewportCount, 1);
+        assert_eq!(viewport_state.scissorCount, 1);
+    }
+    if let Some(multisample_state) = create_info.pMultisampleState.as_ref() {
+        if !rasterizer_discard {
+            assert_eq!(
+                multisample_state.rasterizationSamples,
+                api::VK_SAMPLE_COUNT_1_BIT
+            );
+        }
+    }
+    let depth_stencil_state = if rasterizer_discard || subpass.depth_stencil_attachment.is_none() {
+        None
+    } else {
+        create_info.pDepthStencilState.as_ref()
+    };
+    if let Some(depth_stencil_state) = depth_stencil_state {
+        assert_eq!(depth_stencil_state.depthBoundsTestEnable, api::VK_FALSE);
+        assert_eq!(depth_stencil_state.stencilTestEnable, api::VK_FALSE);
+    }
+    let color_blend_state = if rasterizer_discard || subpass.color_attachments.is_empty() {
+        None
+    } else {
+        create_info.pColorBlendState.as_ref()
+    };
+    let color_blend_attachments = match color_blend_state {
+        Some(color_blend_state) => {
+            assert_eq!(color_blend_state.logicOpEnable, api::VK_FALSE);
+            util::to_slice(
+                color_blend_state.pAttachments,
+                color_blend_state.attachmentCount as usize,
+            )
+            .to_vec()
+        }
+        None => Vec::new(),
+    };
+    FixedFunctionState {
+        topology: input_assembly_state.topology,
+        primitive_restart: input_assembly_state.primitiveRestartEnable != api::VK_FALSE,
+        rasterizer_discard,
+        depth_clamp: rasterization_state.depthClampEnable != api::VK_FALSE,
+        cull_mode: rasterization_state.cullMode,
+        front_face: rasterization_state.frontFace,
+        depth_compare_op: depth_stencil_state
+            .filter(|state| state.depthTestEnable != api::VK_FALSE)
+            .map(|state| state.depthCompareOp),
+        depth_write: depth_stencil_state.map_or(false, |state| {
+            state.depthTestEnable != api::VK_FALSE && state.depthWriteEnable != api::VK_FALSE
+        }),
+        color_blend_attachments,
+        viewport: viewport_state.and_then(|viewport_state| {
+            get_static_state(dynamic_states, api::VK_DYNAMIC_STATE_VIEWPORT, || {
+                *viewport_state.pViewports
+            })
+        }),
+        scissor: viewport_state.and_then(|viewport_state| {
+            get_static_state(dynamic_states, api::VK_DYNAMIC_STATE_SCISSOR, || {
+                *viewport_state.pScissors
+            })
+        }),
+        blend_constants: color_blend_state.and_then(|color_blend_state| {
+            get_static_state(
+                dynamic_states,
+                api::VK_DYNAMIC_STATE_BLEND_CONSTANTS,
+                || color_blend_state.blendConstants,
+            )
+        }),
+    }
+}
 
 impl GenericPipeline for GraphicsPipeline {}
 
 impl GenericPipelineSized for GraphicsPipeline {
     type PipelineCreateInfo = api::VkGraphicsPipelineCreateInfo;
+    unsafe fn get_key(
+        _create_info: &api::VkGraphicsPipelineCreateInfo,
+    ) -> Option<PipelineCacheKey> {
+        None
+    }
     unsafe fn create(
         _device: SharedHandle<api::VkDevice>,
         _pipeline_cache: Option<SharedHandle<api::VkPipelineCache>>,
         create_info: &api::VkGraphicsPipelineCreateInfo,
-    ) -> Self {
+    ) -> Result<Self, api::VkResult> {
         parse_next_chain_const! {
             create_info,
             root = api::VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
@@ -179,7 +532,16 @@ impl GenericPipelineSized for GraphicsPipeline {
             #[optional]
             fragment_stage = VK_SHADER_STAGE_FRAGMENT_BIT,
         }
-        unimplemented!()
+        let fixed_function_state = get_fixed_function_state(create_info);
+        if !fixed_function_state.is_supported() {
+            return Err(api::VK_ERROR_FEATURE_NOT_PRESENT);
+        }
+        // FIXME: the vertex input state needs to be compiled into the vertex shader
+        Ok(Self {
+            fixed_function_state: Arc::new(fixed_function_state),
+            vertex_stage: Arc::new(OwnedShaderStage::new(vertex_stage)),
+            fragment_stage: fragment_stage.map(|stage| Arc::new(OwnedShaderStage::new(stage))),
+        })
     }
     fn to_pipeline(self) -> Pipeline {
         Pipeline::Graphics(self)
@@ -202,6 +564,17 @@ impl Deref for Pipeline {
     }
 }
 
+/// the create infos only point to data that the application must keep valid and unmodified
+/// until `create_pipelines` returns
+struct CreatePipelinesInputs<'a, T: GenericPipelineSized> {
+    device: SharedHandle<api::VkDevice>,
+    pipeline_cache: Option<SharedHandle<api::VkPipelineCache>>,
+    unique_create_infos: Vec<&'a T::PipelineCreateInfo>,
+}
+
+unsafe impl<'a, T: GenericPipelineSized> Sync for CreatePipelinesInputs<'a, T> {}
+
+/// creates the pipelines in parallel on the device's `WorkerPool`
 pub unsafe fn create_pipelines<T: GenericPipelineSized>(
     device: SharedHandle<api::VkDevice>,
     pipeline_cache: Option<SharedHandle<api::VkPipelineCache>>,
@@ -209,11 +582,57 @@ pub unsafe fn create_pipelines<T: GenericPipelineSized>(
     pipelines: &mut [api::VkPipeline],
 ) -> api::VkResult {
     assert_eq!(create_infos.len(), pipelines.len());
-    for (pipeline, create_info) in pipelines.iter_mut().zip(create_infos.iter()) {
-        *pipeline = OwnedHandle::<api::VkPipeline>::new(
-            T::create(device, pipeline_cache, create_info).to_pipeline(),
-        )
-        .take();
+    let mut inputs = CreatePipelinesInputs::<T> {
+        device,
+        pipeline_cache,
+        unique_create_infos: Vec::new(),
+    };
+    // identical create infos share the index of the first one in unique_create_infos
+    let mut unique_indexes = HashMap::new();
+    let create_info_unique_indexes: Vec<usize> = create_infos
+        .iter()
+        .map(|create_info| {
+            let next_unique_index = inputs.unique_create_infos.len();
+            let unique_index = match T::get_key(create_info) {
+                Some(key) => *unique_indexes.entry(key).or_insert(next_unique_index),
+                None => next_unique_index,
+            };
+            if unique_index == next_unique_index {
+                inputs.unique_create_infos.push(create_info);
+            }
+            unique_index
+        })
+        .collect();
+    let unique_count = inputs.unique_create_infos.len();
+    let created_pipelines: Vec<Mutex<Option<Result<T, api::VkResult>>>> =
+        (0..unique_count).map(|_| Mutex::new(None)).collect();
+    device.worker_pool.parallel_for(unique_count, 1, &|range| {
+        let inputs = &inputs;
+        for unique_index in range {
+            let pipeline = T::create(
+                inputs.device,
+                inputs.pipeline_cache,
+                inputs.unique_create_infos[unique_index],
+            );
+            *created_pipelines[unique_index].lock().unwrap() = Some(pipeline);
+        }
+    });
+    let created_pipelines: Vec<Result<T, api::VkResult>> = created_pipelines
+        .into_iter()
+        .map(|pipeline| pipeline.into_inner().unwrap().unwrap())
+        .collect();
+    // the pipelines that failed are null, and the others are still created
+    let mut result = api::VK_SUCCESS;
+    for (pipeline, &unique_index) in pipelines.iter_mut().zip(&create_info_unique_indexes) {
+        *pipeline = match &created_pipelines[unique_index] {
+            Ok(created_pipeline) => {
+                OwnedHandle::<api::VkPipeline>::new(created_pipeline.clone().to_pipeline()).take()
+            }
+            Err(error) => {
+                result = *error;
+                Handle::null()
+            }
+        };
     }
-    api::VK_SUCCESS
+    result
 }
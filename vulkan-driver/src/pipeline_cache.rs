@@ -0,0 +1,548 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! compiled shader cache, serialized through `vkGetPipelineCacheData`.
+//!
+//! When `KAZAN_PIPELINE_CACHE_DIR` is set, every entry is also mirrored into that directory,
+//! one file per entry, so warm starts skip compilation even when the application doesn't
+//! save its pipeline caches (or doesn't create any).
+//!
+//! When `KAZAN_PIPELINE_CACHE_FILE` is set, that file is memory-mapped and used as a read-only
+//! cache shared by every `VkPipelineCache`. It has the same format as `vkGetPipelineCacheData`,
+//! so the output of `kazan-aot` can be used either way. Only the entry offsets are read up
+//! front; entries are decoded from the mapping when they're looked up, which copies their
+//! object code out of it once.
+//!
+//! Each `VkPipelineCache` also keeps the shader modules it has seen in their decoded,
+//! unspecialized form, so pipelines created with new specializations of a module don't decode
+//! it again. That form is rebuilt from the SPIR-V, so it's only kept in memory.
+
+use crate::api;
+use crate::api_impl::PhysicalDevice;
+use crate::constants::KAZAN_DEVICE_ID;
+use once_cell::sync::OnceCell;
+use shader_compiler::{CompiledFunctionKey, ComputeDispatchInfo, UnspecializedShaderModule};
+use shader_compiler_backend::ObjectCode;
+use std::collections::HashMap;
+use std::env;
+use std::fs;
+use std::hash::{Hash, Hasher};
+use std::mem;
+use std::path::{Path, PathBuf};
+use std::process;
+#[cfg(unix)]
+use std::ptr;
+#[cfg(unix)]
+use std::slice;
+use std::sync::{Arc, Mutex};
+
+pub const PIPELINE_CACHE_DIR_ENV_VAR: &str = "KAZAN_PIPELINE_CACHE_DIR";
+
+pub const PIPELINE_CACHE_FILE_ENV_VAR: &str = "KAZAN_PIPELINE_CACHE_FILE";
+
+/// included in the pipeline cache UUID; increment when the format of the entries or how their
+/// keys are computed changes
+pub const PIPELINE_CACHE_FORMAT_VERSION: u32 = 4;
+
+const HEADER_SIZE: usize = mem::size_of::<api::VkPipelineCacheHeaderVersionOne>();
+
+/// every `CompiledFunctionKey`, indexed by how it is serialized
+const FUNCTION_KEYS: &[CompiledFunctionKey] = &[CompiledFunctionKey::ComputeShaderEntrypoint];
+
+fn function_key_index(key: CompiledFunctionKey) -> u32 {
+    match key {
+        CompiledFunctionKey::ComputeShaderEntrypoint => 0,
+    }
+}
+
+/// 128-bit FNV-1a, used instead of `DefaultHasher` since the keys have to be stable across
+/// processes
+struct KeyHasher(u128);
+
+impl KeyHasher {
+    const OFFSET_BASIS: u128 = 0x6c62_272e_07bb_0142_62b8_2175_6295_c58d;
+    const PRIME: u128 = 0x0000_0000_0100_0000_0000_0000_0000_013b;
+}
+
+impl Hasher for KeyHasher {
+    fn write(&mut self, bytes: &[u8]) {
+        for &byte in bytes {
+            self.0 ^= u128::from(byte);
+            self.0 = self.0.wrapping_mul(Self::PRIME);
+        }
+    }
+    fn finish(&self) -> u64 {
+        self.0 as u64
+    }
+}
+
+#[derive(Copy, Clone, Eq, PartialEq, Hash, Debug)]
+pub struct PipelineCacheKey(u128);
+
+impl PipelineCacheKey {
+    /// `inputs` must include everything that affects the generated code
+    pub fn new<T: Hash + ?Sized>(inputs: &T) -> Self {
+        let mut hasher = KeyHasher(KeyHasher::OFFSET_BASIS);
+        inputs.hash(&mut hasher);
+        PipelineCacheKey(hasher.0)
+    }
+}
+
+/// a compiled compute pipeline
+#[derive(Clone, Debug)]
+pub struct CachedPipeline {
+    pub object_code: ObjectCode<CompiledFunctionKey>,
+    pub dispatch_info: ComputeDispatchInfo,
+}
+
+type Entry = (PipelineCacheKey, CachedPipeline);
+
+fn write_u32(output: &mut Vec<u8>, v: u32) {
+    output.extend_from_slice(&v.to_le_bytes());
+}
+
+fn write_bytes(output: &mut Vec<u8>, bytes: &[u8]) {
+    write_u32(output, bytes.len() as u32);
+    output.extend_from_slice(bytes);
+}
+
+struct Reader<'a> {
+    bytes: &'a [u8],
+}
+
+impl<'a> Reader<'a> {
+    fn read_array(&mut self, len: usize) -> Option<&'a [u8]> {
+        if len > self.bytes.len() {
+            return None;
+        }
+        let (retval, rest) = self.bytes.split_at(len);
+        self.bytes = rest;
+        Some(retval)
+    }
+    fn read_u32(&mut self) -> Option<u32> {
+        let mut bytes = [0; 4];
+        bytes.copy_from_slice(self.read_array(4)?);
+        Some(u32::from_le_bytes(bytes))
+    }
+    fn read_u128(&mut self) -> Option<u128> {
+        let mut bytes = [0; 16];
+        bytes.copy_from_slice(self.read_array(16)?);
+        Some(u128::from_le_bytes(bytes))
+    }
+    fn read_bytes(&mut self) -> Option<&'a [u8]> {
+        let len = self.read_u32()? as usize;
+        self.read_array(len)
+    }
+    fn read_string(&mut self) -> Option<String> {
+        String::from_utf8(self.read_bytes()?.into()).ok()
+    }
+}
+
+fn write_header(output: &mut Vec<u8>) {
+    write_u32(output, HEADER_SIZE as u32);
+    write_u32(output, api::VK_PIPELINE_CACHE_HEADER_VERSION_ONE);
+    write_u32(output, api::VK_VENDOR_ID_KAZAN);
+    write_u32(output, KAZAN_DEVICE_ID);
+    output.extend_from_slice(PhysicalDevice::get_pipeline_cache_uuid().as_bytes());
+}
+
+fn read_header(reader: &mut Reader) -> Option<()> {
+    let mut expected_header = Vec::with_capacity(HEADER_SIZE);
+    write_header(&mut expected_header);
+    if reader.read_array(HEADER_SIZE)? == &*expected_header {
+        Some(())
+    } else {
+        None
+    }
+}
+
+fn write_entry(output: &mut Vec<u8>, key: PipelineCacheKey, pipeline: &CachedPipeline) {
+    let CachedPipeline {
+        object_code,
+        dispatch_info,
+    } = pipeline;
+    output.extend_from_slice(&key.0.to_le_bytes());
+    for &size in &dispatch_info.workgroup_size {
+        write_u32(output, size);
+    }
+    write_u32(output, dispatch_info.lane_count);
+    write_u32(output, dispatch_info.workgroup_memory_size as u32);
+    write_u32(output, dispatch_info.has_control_barriers as u32);
+    write_bytes(output, object_code.target.as_bytes());
+    write_u32(output, object_code.symbols.len() as u32);
+    for (&function_key, symbol) in &object_code.symbols {
+        write_u32(output, function_key_index(function_key));
+        write_bytes(output, symbol.as_bytes());
+    }
+    write_bytes(output, &object_code.bytes);
+}
+
+fn read_entry_key(reader: &mut Reader) -> Option<PipelineCacheKey> {
+    Some(PipelineCacheKey(reader.read_u128()?))
+}
+
+/// reads what follows the key
+fn read_entry_pipeline(reader: &mut Reader) -> Option<CachedPipeline> {
+    let workgroup_size = [reader.read_u32()?, reader.read_u32()?, reader.read_u32()?];
+    let dispatch_info = ComputeDispatchInfo {
+        workgroup_size,
+        lane_count: reader.read_u32()?,
+        workgroup_memory_size: reader.read_u32()? as usize,
+        has_control_barriers: reader.read_u32()? != 0,
+    };
+    let target = reader.read_string()?;
+    let symbol_count = reader.read_u32()?;
+    let mut symbols = HashMap::new();
+    for _ in 0..symbol_count {
+        let function_key = *FUNCTION_KEYS.get(reader.read_u32()? as usize)?;
+        symbols.insert(function_key, reader.read_string()?);
+    }
+    let bytes = reader.read_bytes()?.into();
+    Some(CachedPipeline {
+        object_code: ObjectCode {
+            bytes,
+            symbols,
+            target,
+        },
+        dispatch_info,
+    })
+}
+
+/// same as `read_entry_pipeline`, without copying anything
+fn skip_entry_pipeline(reader: &mut Reader) -> Option<()> {
+    // workgroup_size, lane_count, workgroup_memory_size and has_control_barriers
+    reader.read_array(6 * 4)?;
+    reader.read_bytes()?;
+    let symbol_count = reader.read_u32()?;
+    for _ in 0..symbol_count {
+        FUNCTION_KEYS.get(reader.read_u32()? as usize)?;
+        reader.read_bytes()?;
+    }
+    reader.read_bytes()?;
+    Some(())
+}
+
+fn read_entry(reader: &mut Reader) -> Option<Entry> {
+    Some((read_entry_key(reader)?, read_entry_pipeline(reader)?))
+}
+
+/// reads the entries following the header; returns `None` if any of `bytes` is invalid
+fn read_entries(bytes: &[u8]) -> Option<Vec<Entry>> {
+    let mut reader = Reader { bytes };
+    read_header(&mut reader)?;
+    let entry_count = reader.read_u32()?;
+    let mut entries = Vec::new();
+    for _ in 0..entry_count {
+        entries.push(read_entry(&mut reader)?);
+    }
+    if reader.bytes.is_empty() {
+        Some(entries)
+    } else {
+        None
+    }
+}
+
+/// the offset of each entry's pipeline, following its key; `None` if any of `bytes` is invalid
+fn read_entry_offsets(bytes: &[u8]) -> Option<HashMap<PipelineCacheKey, usize>> {
+    let mut reader = Reader { bytes };
+    read_header(&mut reader)?;
+    let entry_count = reader.read_u32()?;
+    let mut entry_offsets = HashMap::new();
+    for _ in 0..entry_count {
+        let key = read_entry_key(&mut reader)?;
+        entry_offsets.insert(key, bytes.len() - reader.bytes.len());
+        skip_entry_pipeline(&mut reader)?;
+    }
+    if reader.bytes.is_empty() {
+        Some(entry_offsets)
+    } else {
+        None
+    }
+}
+
+/// a read-only mapping of a whole file
+#[cfg(unix)]
+struct FileMapping {
+    memory: *const u8,
+    size: usize,
+}
+
+/// never written to
+#[cfg(unix)]
+unsafe impl Send for FileMapping {}
+#[cfg(unix)]
+unsafe impl Sync for FileMapping {}
+
+#[cfg(unix)]
+impl FileMapping {
+    fn new(path: &Path) -> Option<Self> {
+        use std::os::unix::io::AsRawFd;
+        let file = fs::File::open(path).ok()?;
+        let size = file.metadata().ok()?.len() as usize;
+        if size == 0 {
+            // mmap rejects empty mappings
+            return Some(Self {
+                memory: ptr::null(),
+                size,
+            });
+        }
+        unsafe {
+            let memory = libc::mmap(
+                ptr::null_mut(),
+                size,
+                libc::PROT_READ,
+                libc::MAP_PRIVATE,
+                file.as_raw_fd(),
+                0,
+            );
+            if memory == libc::MAP_FAILED {
+                return None;
+            }
+            Some(Self {
+                memory: memory as *const u8,
+                size,
+            })
+        }
+    }
+    fn as_bytes(&self) -> &[u8] {
+        if self.size == 0 {
+            &[]
+        } else {
+            unsafe { slice::from_raw_parts(self.memory, self.size) }
+        }
+    }
+}
+
+#[cfg(unix)]
+impl Drop for FileMapping {
+    fn drop(&mut self) {
+        if self.size != 0 {
+            unsafe {
+                libc::munmap(self.memory as *mut _, self.size);
+            }
+        }
+    }
+}
+
+#[cfg(not(unix))]
+struct FileMapping(Vec<u8>);
+
+#[cfg(not(unix))]
+impl FileMapping {
+    fn new(path: &Path) -> Option<Self> {
+        fs::read(path).ok().map(FileMapping)
+    }
+    fn as_bytes(&self) -> &[u8] {
+        &self.0
+    }
+}
+
+/// the contents of `KAZAN_PIPELINE_CACHE_FILE`
+struct PreloadedPipelineCache {
+    mapping: FileMapping,
+    entry_offsets: HashMap<PipelineCacheKey, usize>,
+}
+
+impl PreloadedPipelineCache {
+    /// `None` if `KAZAN_PIPELINE_CACHE_FILE` isn't set or the file isn't valid for this version
+    /// of kazan
+    fn get() -> Option<&'static Self> {
+        static PRELOADED_PIPELINE_CACHE: OnceCell<Option<PreloadedPipelineCache>> = OnceCell::new();
+        PRELOADED_PIPELINE_CACHE
+            .get_or_init(|| {
+                let path = env::var_os(PIPELINE_CACHE_FILE_ENV_VAR)?;
+                if path.is_empty() {
+                    return None;
+                }
+                let mapping = FileMapping::new(Path::new(&path))?;
+                let entry_offsets = read_entry_offsets(mapping.as_bytes())?;
+                Some(Self {
+                    mapping,
+                    entry_offsets,
+                })
+            })
+            .as_ref()
+    }
+    fn load(&self, key: PipelineCacheKey) -> Option<CachedPipeline> {
+        let offset = *self.entry_offsets.get(&key)?;
+        read_entry_pipeline(&mut Reader {
+            bytes: &self.mapping.as_bytes()[offset..],
+        })
+    }
+}
+
+fn get_mirror_directory() -> Option<PathBuf> {
+    let directory = env::var_os(PIPELINE_CACHE_DIR_ENV_VAR)?;
+    if directory.is_empty() {
+        None
+    } else {
+        Some(directory.into())
+    }
+}
+
+fn get_mirror_file_name(key: PipelineCacheKey) -> String {
+    format!("{:032x}.kazan-pipeline", key.0)
+}
+
+/// mirror files hold the same header and entry list as `vkGetPipelineCacheData`, with a single
+/// entry
+fn load_from_mirror(key: PipelineCacheKey) -> Option<CachedPipeline> {
+    let path = get_mirror_directory()?.join(get_mirror_file_name(key));
+    let bytes = fs::read(path).ok()?;
+    let mut entries = read_entries(&bytes)?;
+    match entries.pop() {
+        Some((entry_key, pipeline)) if entries.is_empty() && entry_key == key => Some(pipeline),
+        _ => None,
+    }
+}
+
+fn store_to_mirror(key: PipelineCacheKey, pipeline: &CachedPipeline) {
+    let directory = match get_mirror_directory() {
+        Some(directory) => directory,
+        None => return,
+    };
+    let mut bytes = Vec::new();
+    write_header(&mut bytes);
+    write_u32(&mut bytes, 1);
+    write_entry(&mut bytes, key, pipeline);
+    let file_name = get_mirror_file_name(key);
+    // write to a temporary file then rename, so other processes never see a partial file
+    let temp_path = directory.join(format!("{}.{}.tmp", file_name, process::id()));
+    let result = fs::create_dir_all(&directory)
+        .and_then(|_| fs::write(&temp_path, &bytes))
+        .and_then(|_| fs::rename(&temp_path, directory.join(file_name)));
+    if result.is_err() {
+        // the mirror is only an optimization, so errors are otherwise ignored
+        let _ = fs::remove_file(&temp_path);
+    }
+}
+
+/// clones share the same entries, so pipelines optimized in the background can still be
+/// added after the application destroys the `VkPipelineCache`
+#[derive(Clone, Debug)]
+pub struct PipelineCache {
+    entries: Arc<Mutex<HashMap<PipelineCacheKey, CachedPipeline>>>,
+    /// keyed by the SPIR-V only
+    unspecialized_modules: Arc<Mutex<HashMap<PipelineCacheKey, Arc<UnspecializedShaderModule>>>>,
+}
+
+impl PipelineCache {
+    /// `initial_data` is ignored when it wasn't produced by this version of kazan
+    pub fn new(initial_data: &[u8]) -> Self {
+        Self {
+            entries: Arc::new(Mutex::new(
+                read_entries(initial_data)
+                    .unwrap_or_default()
+                    .into_iter()
+                    .collect(),
+            )),
+            unspecialized_modules: Arc::new(Mutex::new(HashMap::new())),
+        }
+    }
+    /// looks in `pipeline_cache`, if any, then in `KAZAN_PIPELINE_CACHE_FILE`, then in the
+    /// mirror directory
+    pub fn get(pipeline_cache: Option<&Self>, key: PipelineCacheKey) -> Option<CachedPipeline> {
+        if let Some(pipeline_cache) = pipeline_cache {
+            if let Some(pipeline) = pipeline_cache.entries.lock().unwrap().get(&key) {
+                return Some(pipeline.clone());
+            }
+        }
+        // not added to `pipeline_cache`, since the file is always there to load it from again
+        if let Some(pipeline) = PreloadedPipelineCache::get().and_then(|v| v.load(key)) {
+            return Some(pipeline);
+        }
+        let pipeline = load_from_mirror(key)?;
+        if let Some(pipeline_cache) = pipeline_cache {
+            pipeline_cache
+                .entries
+                .lock()
+                .unwrap()
+                .insert(key, pipeline.clone());
+        }
+        Some(pipeline)
+    }
+    pub fn insert(pipeline_cache: Option<&Self>, key: PipelineCacheKey, pipeline: &CachedPipeline) {
+        store_to_mirror(key, pipeline);
+        if let Some(pipeline_cache) = pipeline_cache {
+            pipeline_cache
+                .entries
+                .lock()
+                .unwrap()
+                .insert(key, pipeline.clone());
+        }
+    }
+    /// the decoded form of `code`, decoding it the first time it's seen; `None` if there's no
+    /// `pipeline_cache` to keep it in
+    pub fn get_unspecialized_module(
+        pipeline_cache: Option<&Self>,
+        code: &[u32],
+    ) -> Option<Arc<UnspecializedShaderModule>> {
+        let pipeline_cache = pipeline_cache?;
+        let key = PipelineCacheKey::new(&("unspecialized module", code));
+        if let Some(module) = pipeline_cache
+            .unspecialized_modules
+            .lock()
+            .unwrap()
+            .get(&key)
+        {
+            return Some(module.clone());
+        }
+        // decoded without holding the lock, so other modules can be looked up meanwhile
+        let module = Arc::new(UnspecializedShaderModule::new(code));
+        Some(
+            pipeline_cache
+                .unspecialized_modules
+                .lock()
+                .unwrap()
+                .entry(key)
+                .or_insert(module)
+                .clone(),
+        )
+    }
+    pub fn merge(&self, source: &Self) {
+        let source_entries: Vec<_> = source
+            .entries
+            .lock()
+            .unwrap()
+            .iter()
+            .map(|(&key, pipeline)| (key, pipeline.clone()))
+            .collect();
+        self.entries.lock().unwrap().extend(source_entries);
+        let source_modules: Vec<_> = source
+            .unspecialized_modules
+            .lock()
+            .unwrap()
+            .iter()
+            .map(|(&key, module)| (key, module.clone()))
+            .collect();
+        self.unspecialized_modules
+            .lock()
+            .unwrap()
+            .extend(source_modules);
+    }
+    /// returns the serialized cache, keeping only as many whole entries as fit in `max_size`
+    /// bytes, and whether everything fit
+    pub fn get_data(&self, max_size: usize) -> (Vec<u8>, bool) {
+        let entries = self.entries.lock().unwrap();
+        let mut data = Vec::new();
+        write_header(&mut data);
+        write_u32(&mut data, 0);
+        if data.len() > max_size {
+            return (Vec::new(), false);
+        }
+        let mut entry_count = 0u32;
+        let mut complete = true;
+        for (&key, pipeline) in entries.iter() {
+            let entry_start = data.len();
+            write_entry(&mut data, key, pipeline);
+            if data.len() > max_size {
+                data.truncate(entry_start);
+                complete = false;
+            } else {
+                entry_count += 1;
+            }
+        }
+        data[HEADER_SIZE..][..mem::size_of::<u32>()].copy_from_slice(&entry_count.to_le_bytes());
+        (data, complete)
+    }
+}
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! query pools and the pipeline statistics they count.
+//!
+//! Every worker counts pipeline statistics in its own cache line, which only it writes, so
+//! counting doesn't need atomic read-modify-writes; a query takes the difference of the totals
+//! when it begins and ends.
+
+use crate::api;
+use crate::sync::Event;
+use crate::worker_pool;
+use std::ops::Range;
+use std::ptr;
+use std::sync::atomic::{AtomicU64, Ordering};
+
+/// in the order of `VkQueryPipelineStatisticFlagBits`
+#[derive(Copy, Clone, Eq, PartialEq, Debug)]
+pub enum PipelineStatistic {
+    InputAssemblyVertices,
+    InputAssemblyPrimitives,
+    VertexShaderInvocations,
+    GeometryShaderInvocations,
+    GeometryShaderPrimitives,
+    ClippingInvocations,
+    ClippingPrimitives,
+    FragmentShaderInvocations,
+    TessellationControlShaderPatches,
+    TessellationEvaluationShaderInvocations,
+    ComputeShaderInvocations,
+}
+
+pub const PIPELINE_STATISTIC_COUNT: usize = 11;
+
+impl PipelineStatistic {
+    fn from_index(index: usize) -> Self {
+        use self::PipelineStatistic::*;
+        [
+            InputAssemblyVertices,
+            InputAssemblyPrimitives,
+            VertexShaderInvocations,
+            GeometryShaderInvocations,
+            GeometryShaderPrimitives,
+            ClippingInvocations,
+            ClippingPrimitives,
+            FragmentShaderInvocations,
+            TessellationControlShaderPatches,
+            TessellationEvaluationShaderInvocations,
+            ComputeShaderInvocations,
+        ][index]
+    }
+}
+
+pub type PipelineStatistics = [u64; PIPELINE_STATISTIC_COUNT];
+
+/// a cache line, so no two threads' counters share one
+#[repr(align(64))]
+#[derive(Default)]
+struct ThreadCounters([AtomicU64; PIPELINE_STATISTIC_COUNT]);
+
+pub struct PipelineStatisticCounters {
+    workers: Box<[ThreadCounters]>,
+    /// for the queue thread, which only counts once per command
+    other_threads: ThreadCounters,
+}
+
+impl PipelineStatisticCounters {
+    pub fn new(worker_count: usize) -> Self {
+        Self {
+            workers: (0..worker_count)
+                .map(|_| ThreadCounters::default())
+                .collect(),
+            other_threads: ThreadCounters::default(),
+        }
+    }
+    pub fn add(&self, statistic: PipelineStatistic, count: u64) {
+        let index = statistic as usize;
+        match worker_pool::current_worker_index().and_then(|worker| self.workers.get(worker)) {
+            Some(counters) => {
+                // only this worker writes its counters
+                let counter = &counters.0[index];
+                counter.store(
+                    counter.load(Ordering::Relaxed).wrapping_add(count),
+                    Ordering::Relaxed,
+                );
+            }
+            None => {
+                self.other_threads.0[index].fetch_add(count, Ordering::Relaxed);
+            }
+        }
+    }
+    /// only includes the counts of work that has finished
+    pub fn get_totals(&self) -> PipelineStatistics {
+        let mut retval: PipelineStatistics = [0; PIPELINE_STATISTIC_COUNT];
+        for counters in self.workers.iter().chain(Some(&self.other_threads)) {
+            for (total, counter) in retval.iter_mut().zip(&counters.0) {
+                *total = total.wrapping_add(counter.load(Ordering::Relaxed));
+            }
+        }
+        retval
+    }
+}
+
+pub struct QueryPool {
+    query_type: api::VkQueryType,
+    /// for pipeline statistics queries, the statistics counted, in the order they're returned
+    statistics: Vec<PipelineStatistic>,
+    /// per query
+    value_count: usize,
+    values: Box<[AtomicU64]>,
+    availability: Box<[Event]>,
+}
+
+impl QueryPool {
+    pub fn new(create_info: &api::VkQueryPoolCreateInfo) -> Self {
+        let statistics: Vec<PipelineStatistic> = match create_info.queryType {
+            api::VK_QUERY_TYPE_PIPELINE_STATISTICS => (0..PIPELINE_STATISTIC_COUNT)
+                .filter(|&index| create_info.pipelineStatistics & (1 << index) != 0)
+                .map(PipelineStatistic::from_index)
+                .collect(),
+            api::VK_QUERY_TYPE_OCCLUSION | api::VK_QUERY_TYPE_TIMESTAMP => Vec::new(),
+            _ => unreachable!("invalid VkQueryType: {}", create_info.queryType),
+        };
+        let value_count = statistics.len().max(1);
+        let query_count = create_info.queryCount as usize;
+        Self {
+            query_type: create_info.queryType,
+            statistics,
+            value_count,
+            values: (0..query_count * value_count)
+                .map(|_| AtomicU64::new(0))
+                .collect(),
+            availability: (0..query_count).map(|_| Event::new()).collect(),
+        }
+    }
+    fn query_values(&self, query: u32) -> &[AtomicU64] {
+        let start = query as usize * self.value_count;
+        &self.values[start..start + self.value_count]
+    }
+    fn make_available(&self, query: u32, values: impl IntoIterator<Item = u64>) {
+        for (value, result) in values.into_iter().zip(self.query_values(query)) {
+            result.store(value, Ordering::Relaxed);
+        }
+        self.availability[query as usize].set();
+    }
+    pub fn reset(&self, queries: Range<u32>) {
+        for query in queries {
+            for value in self.query_values(query) {
+                value.store(0, Ordering::Relaxed);
+            }
+            self.availability[query as usize].reset();
+        }
+    }
+    pub fn write_timestamp(&self, query: u32, timestamp: u64) {
+        assert_eq!(self.query_type, api::VK_QUERY_TYPE_TIMESTAMP);
+        self.make_available(query, Some(timestamp));
+    }
+    /// `statistics` and `samples_passed` are what happened between the query's begin and end
+    pub fn end_query(&self, query: u32, statistics: &PipelineStatistics, samples_passed: u64) {
+        match self.query_type {
+            api::VK_QUERY_TYPE_OCCLUSION => self.make_available(query, Some(samples_passed)),
+            api::VK_QUERY_TYPE_PIPELINE_STATISTICS => self.make_available(
+                query,
+                self.statistics
+                    .iter()
+                    .map(|&statistic| statistics[statistic as usize]),
+            ),
+            _ => unreachable!("query type can't be begun: {}", self.query_type),
+        }
+    }
+    /// writes the results of `queries` `stride` bytes apart starting at `data`, returning
+    /// whether they were all available
+    pub unsafe fn get_results(
+        &self,
+        queries: Range<u32>,
+        data: *mut u8,
+        stride: usize,
+        flags: api::VkQueryResultFlags,
+    ) -> bool {
+        let value_size = if flags & api::VK_QUERY_RESULT_64_BIT != 0 {
+            8
+        } else {
+            4
+        };
+        let write = |output: *mut u8, value: u64| {
+            if value_size == 8 {
+                ptr::write_unaligned(output as *mut u64, value);
+            } else {
+                ptr::write_unaligned(output as *mut u32, value as u32);
+            }
+        };
+        let mut all_available = true;
+        for (index, query) in queries.enumerate() {
+            let availability = &self.availability[query as usize];
+            if flags & api::VK_QUERY_RESULT_WAIT_BIT != 0 {
+                availability.wait();
+            }
+            let available = availability.is_set();
+            all_available &= available;
+            let output = data.add(index * stride);
+            // results are 0 until they're available, which is a valid partial result
+            if available || flags & api::VK_QUERY_RESULT_PARTIAL_BIT != 0 {
+                for (value_index, value) in self.query_values(query).iter().enumerate() {
+                    write(
+                        output.add(value_index * value_size),
+                        value.load(Ordering::Relaxed),
+                    );
+                }
+            }
+            if flags & api::VK_QUERY_RESULT_WITH_AVAILABILITY_BIT != 0 {
+                write(output.add(self.value_count * value_size), available as u64);
+            }
+        }
+        all_available
+    }
+}
@@ -0,0 +1,315 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! queue submission and command-buffer execution
+
+use crate::api;
+use crate::command_buffer::ExecutionError;
+use crate::handle::SharedHandle;
+use crate::query::{PipelineStatistic, PipelineStatisticCounters, PipelineStatistics};
+use crate::worker_pool::WorkerPool;
+use std::collections::VecDeque;
+use std::fmt;
+use std::ops::Range;
+use std::panic::{self, AssertUnwindSafe};
+use std::sync::{Arc, Condvar, Mutex};
+use std::thread;
+
+/// how many chunks to split work into per worker, so there is something left to steal when
+/// some chunks take longer than others
+const CHUNKS_PER_WORKER: usize = 4;
+
+/// state shared by all the commands executed in a submission
+pub struct ExecutionContext<'a> {
+    worker_pool: &'a WorkerPool,
+    pipeline_statistics: PipelineStatisticCounters,
+}
+
+impl<'a> ExecutionContext<'a> {
+    pub fn new(worker_pool: &'a WorkerPool) -> Self {
+        Self {
+            worker_pool,
+            pipeline_statistics: PipelineStatisticCounters::new(worker_pool.worker_count()),
+        }
+    }
+    #[allow(dead_code)]
+    pub fn worker_pool(&self) -> &'a WorkerPool {
+        self.worker_pool
+    }
+    /// cheap enough to call once per batch of work on a worker
+    pub fn add_pipeline_statistic(&self, statistic: PipelineStatistic, count: u64) {
+        self.pipeline_statistics.add(statistic, count);
+    }
+    /// the pipeline statistics counted by all the commands that have finished
+    pub fn get_pipeline_statistics(&self) -> PipelineStatistics {
+        self.pipeline_statistics.get_totals()
+    }
+    fn chunk_size(&self, len: usize) -> usize {
+        (len / (self.worker_pool.worker_count() * CHUNKS_PER_WORKER)).max(1)
+    }
+    /// runs `body` over `0..len` in parallel, without splitting it into chunks smaller than
+    /// `min_chunk_size`
+    pub fn parallel_for(
+        &self,
+        len: usize,
+        min_chunk_size: usize,
+        body: &(dyn Fn(Range<usize>) + Sync),
+    ) {
+        self.worker_pool
+            .parallel_for(len, self.chunk_size(len).max(min_chunk_size), body);
+    }
+    /// calls `body` with batches of the workgroup ids in `group_counts`, in parallel. batches
+    /// have at least `min_batch_size` workgroups, except when there are fewer than that left.
+    pub fn dispatch_workgroups(
+        &self,
+        group_counts: [u32; 3],
+        min_batch_size: usize,
+        body: &(dyn Fn(WorkgroupIds) + Sync),
+    ) {
+        let [x_count, y_count, z_count] = group_counts;
+        let len = x_count as usize * y_count as usize * z_count as usize;
+        self.parallel_for(len, min_batch_size, &|range| {
+            let x_count = x_count as usize;
+            let y_count = y_count as usize;
+            let start = range.start;
+            body(WorkgroupIds {
+                group_counts,
+                next: [
+                    (start % x_count) as u32,
+                    (start / x_count % y_count) as u32,
+                    (start / x_count / y_count) as u32,
+                ],
+                remaining: range.len(),
+            })
+        });
+    }
+    /// calls `body` once for each `tile_size` by `tile_size` tile covering `area`, in parallel.
+    /// tiles on the right and bottom edges are clipped to `area`.
+    #[allow(dead_code)]
+    pub fn for_each_tile(
+        &self,
+        area: api::VkRect2D,
+        tile_size: u32,
+        body: &(dyn Fn(api::VkRect2D) + Sync),
+    ) {
+        assert_ne!(tile_size, 0);
+        let x_tile_count = (area.extent.width + tile_size - 1) / tile_size;
+        let y_tile_count = (area.extent.height + tile_size - 1) / tile_size;
+        let len = x_tile_count as usize * y_tile_count as usize;
+        self.worker_pool
+            .parallel_for(len, self.chunk_size(len), &|range| {
+                for index in range {
+                    let x = (index % x_tile_count as usize) as u32 * tile_size;
+                    let y = (index / x_tile_count as usize) as u32 * tile_size;
+                    body(api::VkRect2D {
+                        offset: api::VkOffset2D {
+                            x: area.offset.x + x as i32,
+                            y: area.offset.y + y as i32,
+                        },
+                        extent: api::VkExtent2D {
+                            width: tile_size.min(area.extent.width - x),
+                            height: tile_size.min(area.extent.height - y),
+                        },
+                    });
+                }
+            });
+    }
+}
+
+/// consecutive workgroup ids, with x varying fastest
+pub struct WorkgroupIds {
+    group_counts: [u32; 3],
+    next: [u32; 3],
+    remaining: usize,
+}
+
+impl Iterator for WorkgroupIds {
+    type Item = [u32; 3];
+    fn next(&mut self) -> Option<[u32; 3]> {
+        if self.remaining == 0 {
+            return None;
+        }
+        self.remaining -= 1;
+        let retval = self.next;
+        self.next[0] += 1;
+        if self.next[0] == self.group_counts[0] {
+            self.next[0] = 0;
+            self.next[1] += 1;
+            if self.next[1] == self.group_counts[1] {
+                self.next[1] = 0;
+                self.next[2] += 1;
+            }
+        }
+        Some(retval)
+    }
+}
+
+#[derive(Default)]
+pub struct Submission {
+    /// waited for before the command buffers start executing, each with the value to wait for
+    /// if it's a timeline semaphore
+    pub wait_semaphores: Vec<(SharedHandle<api::VkSemaphore>, u64)>,
+    pub command_buffers: Vec<SharedHandle<api::VkCommandBuffer>>,
+    /// run after the command buffers finish executing
+    pub on_completion: Option<Box<dyn FnOnce() + Send>>,
+    /// signaled after `on_completion`, each with the value to signal if it's a timeline
+    /// semaphore
+    pub signal_semaphores: Vec<(SharedHandle<api::VkSemaphore>, u64)>,
+    pub fence: Option<SharedHandle<api::VkFence>>,
+}
+
+// the application is required to keep the command buffers alive and not record into them
+// while the submission is pending
+unsafe impl Send for Submission {}
+
+impl Submission {
+    fn execute(&mut self, context: &ExecutionContext) -> Result<(), ExecutionError> {
+        kazan_trace::trace_scope!("Submission::execute");
+        for &(semaphore, value) in &self.wait_semaphores {
+            semaphore.wait_on_queue(value);
+        }
+        for command_buffer in &self.command_buffers {
+            command_buffer.execute(context)?;
+        }
+        if let Some(on_completion) = self.on_completion.take() {
+            on_completion();
+        }
+        Ok(())
+    }
+    /// also done for submissions that failed or were dropped when the device was lost, so
+    /// nothing waits for them forever
+    fn signal(&self) {
+        for &(semaphore, value) in &self.signal_semaphores {
+            semaphore.signal(value);
+        }
+        if let Some(fence) = self.fence {
+            fence.signal();
+        }
+    }
+}
+
+struct QueueState {
+    submissions: VecDeque<Submission>,
+    busy: bool,
+    lost: bool,
+    exiting: bool,
+}
+
+struct QueueShared {
+    state: Mutex<QueueState>,
+    submitted: Condvar,
+    idle: Condvar,
+}
+
+impl QueueShared {
+    fn thread_main(&self, worker_pool: &WorkerPool) {
+        let context = ExecutionContext::new(worker_pool);
+        let mut state = self.state.lock().unwrap();
+        loop {
+            if let Some(mut submission) = state.submissions.pop_front() {
+                state.busy = true;
+                drop(state);
+                let succeeded =
+                    match panic::catch_unwind(AssertUnwindSafe(|| submission.execute(&context))) {
+                        Ok(Ok(())) => true,
+                        Ok(Err(error)) => {
+                            eprintln!("kazan: {}; the device is lost", error);
+                            false
+                        }
+                        Err(_) => false,
+                    };
+                submission.signal();
+                state = self.state.lock().unwrap();
+                state.busy = false;
+                if !succeeded {
+                    state.lost = true;
+                    for submission in state.submissions.drain(..) {
+                        submission.signal();
+                    }
+                }
+                if state.submissions.is_empty() {
+                    self.idle.notify_all();
+                }
+            } else if state.exiting {
+                return;
+            } else {
+                state = self.submitted.wait(state).unwrap();
+            }
+        }
+    }
+}
+
+/// submissions are executed in order on a thread owned by the `Queue`, which splits the
+/// work in each command across the device's `WorkerPool`
+pub struct Queue {
+    shared: Arc<QueueShared>,
+    thread: Option<thread::JoinHandle<()>>,
+}
+
+impl fmt::Debug for Queue {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_struct("Queue").finish()
+    }
+}
+
+impl Queue {
+    pub fn new(worker_pool: Arc<WorkerPool>) -> Self {
+        let shared = Arc::new(QueueShared {
+            state: Mutex::new(QueueState {
+                submissions: VecDeque::new(),
+                busy: false,
+                lost: false,
+                exiting: false,
+            }),
+            submitted: Condvar::new(),
+            idle: Condvar::new(),
+        });
+        let thread = {
+            let shared = shared.clone();
+            thread::Builder::new()
+                .name("kazan queue".into())
+                .spawn(move || shared.thread_main(&worker_pool))
+                .unwrap()
+        };
+        Self {
+            shared,
+            thread: Some(thread),
+        }
+    }
+    pub fn submit<I: IntoIterator<Item = Submission>>(
+        &self,
+        submissions: I,
+    ) -> Result<(), api::VkResult> {
+        let mut state = self.shared.state.lock().unwrap();
+        if state.lost {
+            return Err(api::VK_ERROR_DEVICE_LOST);
+        }
+        state.submissions.extend(submissions);
+        self.shared.submitted.notify_one();
+        Ok(())
+    }
+    pub fn wait_idle(&self) -> Result<(), api::VkResult> {
+        let mut state = self.shared.state.lock().unwrap();
+        while state.busy || !state.submissions.is_empty() {
+            state = self.shared.idle.wait(state).unwrap();
+        }
+        if state.lost {
+            Err(api::VK_ERROR_DEVICE_LOST)
+        } else {
+            Ok(())
+        }
+    }
+}
+
+impl Drop for Queue {
+    fn drop(&mut self) {
+        {
+            let mut state = self.shared.state.lock().unwrap();
+            state.exiting = true;
+            self.shared.submitted.notify_one();
+        }
+        if let Some(thread) = self.thread.take() {
+            thread.join().unwrap();
+        }
+    }
+}
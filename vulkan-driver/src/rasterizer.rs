@@ -0,0 +1,2025 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! sort-middle binning rasterizer
+//!
+//! Each draw in a render pass is shaded and binned as soon as it's executed: its triangles are
+//! clipped, set up, and added to the bin of every tile they touch. When the render pass ends,
+//! each tile is rasterized by a single worker: the tile's part of every attachment is loaded
+//! into tile buffers small enough to stay in L2, the bins of every subpass are run against them
+//! in order, then they're stored back. So the attachments go through memory once per render
+//! pass, no matter how many draws touch them.
+
+use crate::api;
+use crate::device_memory::DeviceMemoryAllocation;
+use crate::handle::SharedHandle;
+use crate::image::{Image, Tiling};
+use crate::query::PipelineStatistic;
+use crate::queue::ExecutionContext;
+use crate::render_pass::Subpass;
+use crate::transfer::ColorFormat;
+use std::fmt;
+use std::mem;
+use std::ops::Range;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::Arc;
+
+pub const MAX_COLOR_ATTACHMENTS: usize = 4;
+
+/// the tile buffers of all the attachments together are kept under this many bytes, so they
+/// stay in L2
+const TILE_BUFFERS_SIZE_BUDGET: usize = 256 * 1024;
+const MIN_TILE_SIZE: u32 = 16;
+const MAX_TILE_SIZE: u32 = 128;
+
+/// vertex positions are snapped to 1/256 of a pixel
+const SUBPIXEL_BITS: u32 = 8;
+const SUBPIXEL_SCALE: f32 = (1 << SUBPIXEL_BITS) as f32;
+const HALF_PIXEL: i64 = 1 << (SUBPIXEL_BITS - 1);
+
+/// triangles are clipped to this multiple of the clip volume in x and y, which keeps the
+/// fixed-point edge functions from overflowing
+const GUARD_BAND: f32 = 64.0;
+/// the smallest clip-space w that isn't clipped, so nothing gets divided by zero
+const MIN_CLIP_W: f32 = 1e-6;
+
+/// the state of a graphics pipeline that isn't in its shaders
+#[derive(Clone, Debug)]
+pub struct FixedFunctionState {
+    pub topology: api::VkPrimitiveTopology,
+    pub primitive_restart: bool,
+    pub rasterizer_discard: bool,
+    pub depth_clamp: bool,
+    pub cull_mode: api::VkCullModeFlags,
+    pub front_face: api::VkFrontFace,
+    /// `None` when depth testing is disabled
+    pub depth_compare_op: Option<api::VkCompareOp>,
+    pub depth_write: bool,
+    pub color_blend_attachments: Vec<api::VkPipelineColorBlendAttachmentState>,
+    /// `None` when set with `vkCmdSetViewport`
+    pub viewport: Option<api::VkViewport>,
+    /// `None` when set with `vkCmdSetScissor`
+    pub scissor: Option<api::VkRect2D>,
+    /// `None` when set with `vkCmdSetBlendConstants`
+    pub blend_constants: Option<[f32; 4]>,
+}
+
+impl FixedFunctionState {
+    /// whether every draw with this state can be rasterized, so pipelines that can't be drawn
+    /// are rejected when they're created
+    pub fn is_supported(&self) -> bool {
+        if self.rasterizer_discard {
+            return true;
+        }
+        is_triangle_topology(self.topology)
+            && self.color_blend_attachments.iter().all(|attachment| {
+                attachment.blendEnable == api::VK_FALSE
+                    || (is_blend_factor_supported(attachment.srcColorBlendFactor)
+                        && is_blend_factor_supported(attachment.dstColorBlendFactor)
+                        && is_blend_factor_supported(attachment.srcAlphaBlendFactor)
+                        && is_blend_factor_supported(attachment.dstAlphaBlendFactor)
+                        && is_blend_op_supported(attachment.colorBlendOp)
+                        && is_blend_op_supported(attachment.alphaBlendOp))
+            })
+    }
+}
+
+/// the start of each bound vertex buffer, plus its bind offset; null if nothing is bound
+pub struct VertexBuffers(pub Vec<*const u8>);
+
+// the application keeps the buffers alive until the command buffer finishes executing
+unsafe impl Send for VertexBuffers {}
+unsafe impl Sync for VertexBuffers {}
+
+pub struct VertexInput<'a> {
+    pub vertex_index: u32,
+    pub instance_index: u32,
+    pub vertex_buffers: &'a VertexBuffers,
+}
+
+pub struct FragmentInput<'a> {
+    /// interpolated with perspective correction
+    pub varyings: &'a [f32],
+    /// the pixel center, the depth, and the interpolated 1/w
+    pub frag_coord: [f32; 4],
+    pub front_facing: bool,
+}
+
+/// the compiled vertex and fragment stages of a graphics pipeline
+pub trait GraphicsShaders: fmt::Debug + Sync + Send + 'static {
+    /// the number of `f32`s each vertex passes to the fragment stage
+    fn varying_count(&self) -> usize;
+    /// writes `varying_count` varyings and returns the clip-space position
+    unsafe fn shade_vertex(&self, input: &VertexInput, varyings: &mut [f32]) -> [f32; 4];
+    /// writes a color for each color attachment of the subpass; returns `false` if the
+    /// fragment is discarded
+    unsafe fn shade_fragment(&self, input: &FragmentInput, colors: &mut [[f32; 4]]) -> bool;
+}
+
+/// which vertices a draw reads
+pub enum DrawVertices {
+    Sequential {
+        first_vertex: u32,
+        vertex_count: u32,
+    },
+    /// `vertex_offset` already added; primitive restarts are `PRIMITIVE_RESTART`
+    Indexed(Vec<u32>),
+}
+
+pub const PRIMITIVE_RESTART: u32 = !0;
+
+pub struct Draw<'a> {
+    pub state: &'a Arc<FixedFunctionState>,
+    pub shaders: &'a Arc<dyn GraphicsShaders>,
+    pub viewport: api::VkViewport,
+    pub scissor: api::VkRect2D,
+    pub blend_constants: [f32; 4],
+    pub vertex_buffers: &'a VertexBuffers,
+    pub vertices: DrawVertices,
+    pub instances: Range<u32>,
+}
+
+/// half-open pixel rectangle
+#[derive(Copy, Clone, Debug)]
+struct Rect {
+    x0: i32,
+    y0: i32,
+    x1: i32,
+    y1: i32,
+}
+
+impl Rect {
+    fn from(rect: api::VkRect2D) -> Self {
+        Rect {
+            x0: rect.offset.x,
+            y0: rect.offset.y,
+            x1: rect.offset.x + rect.extent.width as i32,
+            y1: rect.offset.y + rect.extent.height as i32,
+        }
+    }
+    fn intersect(self, other: Rect) -> Rect {
+        Rect {
+            x0: self.x0.max(other.x0),
+            y0: self.y0.max(other.y0),
+            x1: self.x1.min(other.x1),
+            y1: self.y1.min(other.y1),
+        }
+    }
+    fn is_empty(self) -> bool {
+        self.x0 >= self.x1 || self.y0 >= self.y1
+    }
+}
+
+#[derive(Copy, Clone, Debug)]
+struct ClipPlane {
+    coefficients: [f32; 4],
+    offset: f32,
+}
+
+impl ClipPlane {
+    fn distance(&self, position: &[f32; 4]) -> f32 {
+        let c = &self.coefficients;
+        c[0] * position[0]
+            + c[1] * position[1]
+            + c[2] * position[2]
+            + c[3] * position[3]
+            + self.offset
+    }
+}
+
+fn get_clip_planes(depth_clamp: bool) -> Vec<ClipPlane> {
+    let plane = |coefficients, offset| ClipPlane {
+        coefficients,
+        offset,
+    };
+    let mut retval = vec![
+        plane([0.0, 0.0, 0.0, 1.0], -MIN_CLIP_W),
+        plane([-1.0, 0.0, 0.0, GUARD_BAND], 0.0),
+        plane([1.0, 0.0, 0.0, GUARD_BAND], 0.0),
+        plane([0.0, -1.0, 0.0, GUARD_BAND], 0.0),
+        plane([0.0, 1.0, 0.0, GUARD_BAND], 0.0),
+    ];
+    if !depth_clamp {
+        retval.push(plane([0.0, 0.0, 1.0, 0.0], 0.0));
+        retval.push(plane([0.0, 0.0, -1.0, 1.0], 0.0));
+    }
+    retval
+}
+
+#[derive(Copy, Clone, Debug)]
+struct ClipVertex {
+    position: [f32; 4],
+    /// index of the first varying in `BinnedDraw::varyings`
+    varying_offset: usize,
+}
+
+#[derive(Copy, Clone, Debug)]
+struct ScreenVertex {
+    /// in 1/256 pixels
+    x: i64,
+    y: i64,
+    z: f32,
+    inv_w: f32,
+    varying_offset: usize,
+}
+
+#[derive(Copy, Clone, Debug)]
+struct Triangle {
+    /// wound so the edge functions are positive inside
+    vertices: [ScreenVertex; 3],
+    front_facing: bool,
+    bounds: Rect,
+}
+
+struct BinnedDraw {
+    /// the index of the draw in the render pass instance
+    draw_index: usize,
+    state: Arc<FixedFunctionState>,
+    shaders: Arc<dyn GraphicsShaders>,
+    varying_count: usize,
+    /// clipped to the render area
+    scissor: Rect,
+    blend_constants: [f32; 4],
+    depth_range: [f32; 2],
+    triangles: Vec<Triangle>,
+    varyings: Vec<f32>,
+}
+
+impl BinnedDraw {
+    /// appends the vertex where the edge from `a` to `b` crosses the plane that `a` is
+    /// `distance_a` in front of
+    fn clip_edge(
+        &mut self,
+        a: ClipVertex,
+        distance_a: f32,
+        b: ClipVertex,
+        distance_b: f32,
+    ) -> ClipVertex {
+        let t = distance_a / (distance_a - distance_b);
+        let mut position = [0.0; 4];
+        for i in 0..4 {
+            position[i] = a.position[i] + (b.position[i] - a.position[i]) * t;
+        }
+        let varying_offset = self.varyings.len();
+        for i in 0..self.varying_count {
+            let va = self.varyings[a.varying_offset + i];
+            let vb = self.varyings[b.varying_offset + i];
+            self.varyings.push(va + (vb - va) * t);
+        }
+        ClipVertex {
+            position,
+            varying_offset,
+        }
+    }
+    /// Sutherland-Hodgman clipping; returns `false` if nothing is left
+    fn clip_polygon(&mut self, planes: &[ClipPlane], polygon: &mut Vec<ClipVertex>) -> bool {
+        let mut clipped = Vec::with_capacity(polygon.len() + 1);
+        for plane in planes {
+            clipped.clear();
+            for i in 0..polygon.len() {
+                let a = polygon[i];
+                let b = polygon[(i + 1) % polygon.len()];
+                let distance_a = plane.distance(&a.position);
+                let distance_b = plane.distance(&b.position);
+                if distance_a >= 0.0 {
+                    clipped.push(a);
+                }
+                if (distance_a >= 0.0) != (distance_b >= 0.0) {
+                    clipped.push(self.clip_edge(a, distance_a, b, distance_b));
+                }
+            }
+            std::mem::swap(polygon, &mut clipped);
+            if polygon.len() < 3 {
+                return false;
+            }
+        }
+        true
+    }
+    fn to_screen(&self, viewport: &api::VkViewport, vertex: &ClipVertex) -> ScreenVertex {
+        let inv_w = 1.0 / vertex.position[3];
+        let x = vertex.position[0] * inv_w;
+        let y = vertex.position[1] * inv_w;
+        let z = vertex.position[2] * inv_w;
+        let x = viewport.x + (x + 1.0) * 0.5 * viewport.width;
+        let y = viewport.y + (y + 1.0) * 0.5 * viewport.height;
+        ScreenVertex {
+            x: (x * SUBPIXEL_SCALE).round() as i64,
+            y: (y * SUBPIXEL_SCALE).round() as i64,
+            z: viewport.minDepth + z * (viewport.maxDepth - viewport.minDepth),
+            inv_w,
+            varying_offset: vertex.varying_offset,
+        }
+    }
+    /// culls and snaps the triangle, then adds it to the list; returns its index
+    fn add_triangle(&mut self, vertices: [ScreenVertex; 3]) -> Option<usize> {
+        let [v0, v1, v2] = vertices;
+        let twice_area = (v1.x - v0.x) * (v2.y - v0.y) - (v1.y - v0.y) * (v2.x - v0.x);
+        if twice_area == 0 {
+            return None;
+        }
+        // framebuffer y points down, so positive areas here are clockwise on screen
+        let front_facing =
+            (twice_area < 0) == (self.state.front_face == api::VK_FRONT_FACE_COUNTER_CLOCKWISE);
+        let cull_bit = if front_facing {
+            api::VK_CULL_MODE_FRONT_BIT
+        } else {
+            api::VK_CULL_MODE_BACK_BIT
+        };
+        if self.state.cull_mode & cull_bit != 0 {
+            return None;
+        }
+        let vertices = if twice_area > 0 {
+            [v0, v1, v2]
+        } else {
+            [v0, v2, v1]
+        };
+        let min_x = v0.x.min(v1.x).min(v2.x);
+        let max_x = v0.x.max(v1.x).max(v2.x);
+        let min_y = v0.y.min(v1.y).min(v2.y);
+        let max_y = v0.y.max(v1.y).max(v2.y);
+        // the pixels whose centers are in the bounding box
+        let bounds = Rect {
+            x0: ((min_x - HALF_PIXEL + (1 << SUBPIXEL_BITS) - 1) >> SUBPIXEL_BITS) as i32,
+            y0: ((min_y - HALF_PIXEL + (1 << SUBPIXEL_BITS) - 1) >> SUBPIXEL_BITS) as i32,
+            x1: (((max_x - HALF_PIXEL) >> SUBPIXEL_BITS) + 1) as i32,
+            y1: (((max_y - HALF_PIXEL) >> SUBPIXEL_BITS) + 1) as i32,
+        }
+        .intersect(self.scissor);
+        if bounds.is_empty() {
+            return None;
+        }
+        self.triangles.push(Triangle {
+            vertices,
+            front_facing,
+            bounds,
+        });
+        Some(self.triangles.len() - 1)
+    }
+}
+
+fn is_triangle_topology(topology: api::VkPrimitiveTopology) -> bool {
+    match topology {
+        api::VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST
+        | api::VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP
+        | api::VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN => true,
+        _ => false,
+    }
+}
+
+/// the triangles of `topology` made from `vertex_count` vertices, as indexes into the vertices
+fn assemble_triangles(
+    topology: api::VkPrimitiveTopology,
+    vertex_count: usize,
+    mut output: impl FnMut([usize; 3]),
+) {
+    match topology {
+        api::VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST => {
+            for i in 0..vertex_count / 3 {
+                output([i * 3, i * 3 + 1, i * 3 + 2]);
+            }
+        }
+        api::VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP => {
+            for i in 0..vertex_count.saturating_sub(2) {
+                if i % 2 == 0 {
+                    output([i, i + 1, i + 2]);
+                } else {
+                    output([i + 1, i, i + 2]);
+                }
+            }
+        }
+        api::VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN => {
+            for i in 0..vertex_count.saturating_sub(2) {
+                output([i + 1, i + 2, 0]);
+            }
+        }
+        _ => unreachable!("unsupported primitive topology {}", topology),
+    }
+}
+
+struct BinnedClear {
+    /// the render pass attachment index, the aspects, and the value
+    attachments: Vec<(u32, api::VkImageAspectFlags, api::VkClearValue)>,
+    rects: Vec<Rect>,
+}
+
+enum BinnedCommand {
+    Draw(BinnedDraw),
+    Clear(BinnedClear),
+}
+
+struct SubpassBins {
+    commands: Vec<BinnedCommand>,
+    /// for each tile, the command and primitive (triangle or clear rect) indexes that touch
+    /// it, in order
+    bins: Vec<Vec<(u32, u32)>>,
+}
+
+/// where an attachment's pixels are
+struct AttachmentSurface {
+    memory: *mut u8,
+    tiling: Tiling,
+    pixel_size_in_bytes: usize,
+    row_pitch: usize,
+}
+
+impl AttachmentSurface {
+    unsafe fn new(image: &Image, layout: api::VkImageLayout, mip_level: u32, layer: u32) -> Self {
+        let tiling = image.properties.get_tiling(layout);
+        let subresource_layout = image
+            .properties
+            .get_subresource_layout(tiling, mip_level, layer);
+        let memory = image.memory.as_ref().unwrap();
+        Self {
+            memory: memory
+                .device_memory
+                .get()
+                .as_ptr()
+                .add(memory.offset + subresource_layout.offset),
+            tiling,
+            pixel_size_in_bytes: image.properties.get_pixel_size_in_bytes(),
+            row_pitch: subresource_layout.row_pitch,
+        }
+    }
+    unsafe fn get_pixel(&self, x: i32, y: i32) -> *mut u8 {
+        self.memory.add(self.tiling.get_offset_in_slice(
+            self.pixel_size_in_bytes,
+            self.row_pitch,
+            x as usize,
+            y as usize,
+        ))
+    }
+}
+
+enum TileBuffer {
+    Color(Vec<[f32; 4]>),
+    Depth(Vec<f32>),
+    Unused,
+}
+
+fn is_depth_format(format: api::VkFormat) -> bool {
+    match format {
+        api::VK_FORMAT_D32_SFLOAT => true,
+        api::VK_FORMAT_D16_UNORM
+        | api::VK_FORMAT_X8_D24_UNORM_PACK32
+        | api::VK_FORMAT_S8_UINT
+        | api::VK_FORMAT_D16_UNORM_S8_UINT
+        | api::VK_FORMAT_D24_UNORM_S8_UINT
+        | api::VK_FORMAT_D32_SFLOAT_S8_UINT => {
+            unimplemented!("depth/stencil attachment format {}", format)
+        }
+        _ => false,
+    }
+}
+
+fn compare(op: api::VkCompareOp, reference: f32, value: f32) -> bool {
+    match op {
+        api::VK_COMPARE_OP_NEVER => false,
+        api::VK_COMPARE_OP_LESS => reference < value,
+        api::VK_COMPARE_OP_EQUAL => reference == value,
+        api::VK_COMPARE_OP_LESS_OR_EQUAL => reference <= value,
+        api::VK_COMPARE_OP_GREATER => reference > value,
+        api::VK_COMPARE_OP_NOT_EQUAL => reference != value,
+        api::VK_COMPARE_OP_GREATER_OR_EQUAL => reference >= value,
+        api::VK_COMPARE_OP_ALWAYS => true,
+        _ => unreachable!("invalid compare op {}", op),
+    }
+}
+
+/// the dual-source factors aren't supported
+fn is_blend_factor_supported(factor: api::VkBlendFactor) -> bool {
+    match factor {
+        api::VK_BLEND_FACTOR_ZERO
+        | api::VK_BLEND_FACTOR_ONE
+        | api::VK_BLEND_FACTOR_SRC_COLOR
+        | api::VK_BLEND_FACTOR_ONE_MINUS_SRC_COLOR
+        | api::VK_BLEND_FACTOR_DST_COLOR
+        | api::VK_BLEND_FACTOR_ONE_MINUS_DST_COLOR
+        | api::VK_BLEND_FACTOR_SRC_ALPHA
+        | api::VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA
+        | api::VK_BLEND_FACTOR_DST_ALPHA
+        | api::VK_BLEND_FACTOR_ONE_MINUS_DST_ALPHA
+        | api::VK_BLEND_FACTOR_CONSTANT_COLOR
+        | api::VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_COLOR
+        | api::VK_BLEND_FACTOR_CONSTANT_ALPHA
+        | api::VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA
+        | api::VK_BLEND_FACTOR_SRC_ALPHA_SATURATE => true,
+        _ => false,
+    }
+}
+
+fn get_blend_factor(
+    factor: api::VkBlendFactor,
+    src: [f32; 4],
+    dst: [f32; 4],
+    constants: [f32; 4],
+) -> [f32; 4] {
+    let splat = |v: f32| [v; 4];
+    let one_minus = |v: [f32; 4]| [1.0 - v[0], 1.0 - v[1], 1.0 - v[2], 1.0 - v[3]];
+    match factor {
+        api::VK_BLEND_FACTOR_ZERO => splat(0.0),
+        api::VK_BLEND_FACTOR_ONE => splat(1.0),
+        api::VK_BLEND_FACTOR_SRC_COLOR => src,
+        api::VK_BLEND_FACTOR_ONE_MINUS_SRC_COLOR => one_minus(src),
+        api::VK_BLEND_FACTOR_DST_COLOR => dst,
+        api::VK_BLEND_FACTOR_ONE_MINUS_DST_COLOR => one_minus(dst),
+        api::VK_BLEND_FACTOR_SRC_ALPHA => splat(src[3]),
+        api::VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA => splat(1.0 - src[3]),
+        api::VK_BLEND_FACTOR_DST_ALPHA => splat(dst[3]),
+        api::VK_BLEND_FACTOR_ONE_MINUS_DST_ALPHA => splat(1.0 - dst[3]),
+        api::VK_BLEND_FACTOR_CONSTANT_COLOR => constants,
+        api::VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_COLOR => one_minus(constants),
+        api::VK_BLEND_FACTOR_CONSTANT_ALPHA => splat(constants[3]),
+        api::VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA => splat(1.0 - constants[3]),
+        api::VK_BLEND_FACTOR_SRC_ALPHA_SATURATE => {
+            let f = src[3].min(1.0 - dst[3]);
+            [f, f, f, 1.0]
+        }
+        _ => unreachable!("unsupported blend factor {}", factor),
+    }
+}
+
+/// the advanced blend ops aren't supported
+fn is_blend_op_supported(op: api::VkBlendOp) -> bool {
+    match op {
+        api::VK_BLEND_OP_ADD
+        | api::VK_BLEND_OP_SUBTRACT
+        | api::VK_BLEND_OP_REVERSE_SUBTRACT
+        | api::VK_BLEND_OP_MIN
+        | api::VK_BLEND_OP_MAX => true,
+        _ => false,
+    }
+}
+
+fn blend_channel(op: api::VkBlendOp, src: f32, src_factor: f32, dst: f32, dst_factor: f32) -> f32 {
+    match op {
+        api::VK_BLEND_OP_ADD => src * src_factor + dst * dst_factor,
+        api::VK_BLEND_OP_SUBTRACT => src * src_factor - dst * dst_factor,
+        api::VK_BLEND_OP_REVERSE_SUBTRACT => dst * dst_factor - src * src_factor,
+        api::VK_BLEND_OP_MIN => src.min(dst),
+        api::VK_BLEND_OP_MAX => src.max(dst),
+        _ => unreachable!("unsupported blend op {}", op),
+    }
+}
+
+/// all the color attachment formats are normalized, so the inputs are clamped to `[0, 1]`
+fn blend(
+    state: &api::VkPipelineColorBlendAttachmentState,
+    src: [f32; 4],
+    dst: [f32; 4],
+    constants: [f32; 4],
+) -> [f32; 4] {
+    let mut result = src;
+    if state.blendEnable != api::VK_FALSE {
+        let clamp = |v: [f32; 4]| {
+            let mut v = v;
+            for channel in &mut v {
+                *channel = channel.max(0.0).min(1.0);
+            }
+            v
+        };
+        let (src, dst, constants) = (clamp(src), clamp(dst), clamp(constants));
+        let src_color_factor = get_blend_factor(state.srcColorBlendFactor, src, dst, constants);
+        let dst_color_factor = get_blend_factor(state.dstColorBlendFactor, src, dst, constants);
+        let src_alpha_factor = get_blend_factor(state.srcAlphaBlendFactor, src, dst, constants);
+        let dst_alpha_factor = get_blend_factor(state.dstAlphaBlendFactor, src, dst, constants);
+        for channel in 0..3 {
+            result[channel] = blend_channel(
+                state.colorBlendOp,
+                src[channel],
+                src_color_factor[channel],
+                dst[channel],
+                dst_color_factor[channel],
+            );
+        }
+        result[3] = blend_channel(
+            state.alphaBlendOp,
+            src[3],
+            src_alpha_factor[3],
+            dst[3],
+            dst_alpha_factor[3],
+        );
+    }
+    for channel in 0..4 {
+        if state.colorWriteMask & (api::VK_COLOR_COMPONENT_R_BIT << channel) == 0 {
+            result[channel] = dst[channel];
+        }
+    }
+    result
+}
+
+/// what the fragments of a draw did, for occlusion and pipeline statistics queries
+#[derive(Copy, Clone, Debug, Default)]
+pub struct FragmentStatistics {
+    pub fragment_shader_invocations: u64,
+    pub samples_passed: u64,
+}
+
+impl FragmentStatistics {
+    pub fn add(&mut self, other: FragmentStatistics) {
+        self.fragment_shader_invocations += other.fragment_shader_invocations;
+        self.samples_passed += other.samples_passed;
+    }
+}
+
+#[derive(Default)]
+struct DrawStatistics {
+    fragment_shader_invocations: AtomicU64,
+    samples_passed: AtomicU64,
+}
+
+/// the tile buffers of one tile, with pixels in row-major order
+struct Tile {
+    rect: Rect,
+    buffers: Vec<TileBuffer>,
+    /// of the draw being rasterized, added to the draw's `DrawStatistics` when the tile
+    /// moves on to another draw
+    statistics: FragmentStatistics,
+}
+
+impl Tile {
+    fn index(&self, x: i32, y: i32) -> usize {
+        (y - self.rect.y0) as usize * (self.rect.x1 - self.rect.x0) as usize
+            + (x - self.rect.x0) as usize
+    }
+}
+
+/// the draws and clears of a render pass instance, binned but not rasterized yet
+pub struct RenderPassInstance {
+    render_pass: SharedHandle<api::VkRenderPass>,
+    framebuffer: SharedHandle<api::VkFramebuffer>,
+    /// clipped to the framebuffer
+    render_area: api::VkRect2D,
+    clear_values: Vec<api::VkClearValue>,
+    tile_size: u32,
+    x_tile_count: u32,
+    tile_count: usize,
+    subpasses: Vec<SubpassBins>,
+    draw_count: usize,
+}
+
+// the application keeps everything the recorded commands use alive until they finish
+// executing
+unsafe impl Send for RenderPassInstance {}
+unsafe impl Sync for RenderPassInstance {}
+
+impl RenderPassInstance {
+    pub fn new(
+        render_pass: SharedHandle<api::VkRenderPass>,
+        framebuffer: SharedHandle<api::VkFramebuffer>,
+        render_area: api::VkRect2D,
+        clear_values: &[api::VkClearValue],
+    ) -> Self {
+        assert!(framebuffer.layers >= 1);
+        let render_area = Rect::from(render_area).intersect(Rect {
+            x0: 0,
+            y0: 0,
+            x1: framebuffer.width as i32,
+            y1: framebuffer.height as i32,
+        });
+        let render_area = api::VkRect2D {
+            offset: api::VkOffset2D {
+                x: render_area.x0,
+                y: render_area.y0,
+            },
+            extent: api::VkExtent2D {
+                width: (render_area.x1 - render_area.x0).max(0) as u32,
+                height: (render_area.y1 - render_area.y0).max(0) as u32,
+            },
+        };
+        let bytes_per_pixel: usize = render_pass
+            .attachments
+            .iter()
+            .map(|attachment| {
+                assert_eq!(attachment.samples, api::VK_SAMPLE_COUNT_1_BIT);
+                if is_depth_format(attachment.format) {
+                    4
+                } else {
+                    16
+                }
+            })
+            .sum();
+        let mut tile_size = MAX_TILE_SIZE;
+        while tile_size > MIN_TILE_SIZE
+            && (tile_size * tile_size) as usize * bytes_per_pixel > TILE_BUFFERS_SIZE_BUDGET
+        {
+            tile_size /= 2;
+        }
+        let x_tile_count = (render_area.extent.width + tile_size - 1) / tile_size;
+        let y_tile_count = (render_area.extent.height + tile_size - 1) / tile_size;
+        let mut retval = Self {
+            render_pass,
+            framebuffer,
+            render_area,
+            clear_values: clear_values.to_vec(),
+            tile_size,
+            x_tile_count,
+            tile_count: x_tile_count as usize * y_tile_count as usize,
+            subpasses: Vec::new(),
+            draw_count: 0,
+        };
+        retval.next_subpass();
+        retval
+    }
+    pub fn next_subpass(&mut self) {
+        assert!(self.subpasses.len() < self.render_pass.subpasses.len());
+        self.subpasses.push(SubpassBins {
+            commands: Vec::new(),
+            bins: vec![Vec::new(); self.tile_count],
+        });
+    }
+    /// how many draws there have been so far, which is the index of the next draw
+    pub fn draw_count(&self) -> usize {
+        self.draw_count
+    }
+    fn current_subpass(&self) -> &Subpass {
+        &self.render_pass.subpasses[self.subpasses.len() - 1]
+    }
+    fn render_area_rect(&self) -> Rect {
+        Rect::from(self.render_area)
+    }
+    /// adds `primitive_index` to the bins of the tiles `bounds` touches; `bounds` must be
+    /// inside the render area
+    fn bin(&mut self, bounds: Rect, command_index: usize, primitive_index: usize) {
+        let tile_size = self.tile_size as i32;
+        let origin = self.render_area.offset;
+        let x_tiles =
+            (bounds.x0 - origin.x) / tile_size..(bounds.x1 - 1 - origin.x) / tile_size + 1;
+        let y_tiles =
+            (bounds.y0 - origin.y) / tile_size..(bounds.y1 - 1 - origin.y) / tile_size + 1;
+        let x_tile_count = self.x_tile_count as usize;
+        let bins = &mut self.subpasses.last_mut().unwrap().bins;
+        for y_tile in y_tiles {
+            for x_tile in x_tiles.clone() {
+                bins[y_tile as usize * x_tile_count + x_tile as usize]
+                    .push((command_index as u32, primitive_index as u32));
+            }
+        }
+    }
+    fn push_command(&mut self, command: BinnedCommand) -> usize {
+        let commands = &mut self.subpasses.last_mut().unwrap().commands;
+        commands.push(command);
+        commands.len() - 1
+    }
+    /// runs the vertex shader on every vertex, then clips, sets up, and bins the triangles in
+    /// primitive order
+    pub unsafe fn draw(&mut self, context: &ExecutionContext, draw: Draw) {
+        let draw_index = self.draw_count;
+        self.draw_count += 1;
+        if draw.state.rasterizer_discard {
+            return;
+        }
+        let state = draw.state;
+        let varying_count = draw.shaders.varying_count();
+        let mut binned_draw = BinnedDraw {
+            draw_index,
+            state: state.clone(),
+            shaders: draw.shaders.clone(),
+            varying_count,
+            scissor: Rect::from(draw.scissor).intersect(self.render_area_rect()),
+            blend_constants: draw.blend_constants,
+            depth_range: [
+                draw.viewport.minDepth.min(draw.viewport.maxDepth),
+                draw.viewport.minDepth.max(draw.viewport.maxDepth),
+            ],
+            triangles: Vec::new(),
+            varyings: Vec::new(),
+        };
+        if binned_draw.scissor.is_empty() {
+            return;
+        }
+        let viewport = draw.viewport;
+        let vertex_indexes: Vec<u32> = match draw.vertices {
+            DrawVertices::Sequential {
+                first_vertex,
+                vertex_count,
+            } => (first_vertex..first_vertex + vertex_count).collect(),
+            DrawVertices::Indexed(indexes) => indexes,
+        };
+        let vertex_count = vertex_indexes
+            .iter()
+            .filter(|&&vertex_index| vertex_index != PRIMITIVE_RESTART)
+            .count() as u64
+            * draw.instances.len() as u64;
+        context.add_pipeline_statistic(PipelineStatistic::InputAssemblyVertices, vertex_count);
+        context.add_pipeline_statistic(PipelineStatistic::VertexShaderInvocations, vertex_count);
+        let mut primitive_count = 0;
+        let mut clipped_primitive_count = 0;
+        let planes = get_clip_planes(state.depth_clamp);
+        let command_index = self.subpasses.last().unwrap().commands.len();
+        let mut positions = vec![[0.0f32; 4]; vertex_indexes.len()];
+        for instance_index in draw.instances.clone() {
+            // each instance's vertices are shaded straight into the varyings the
+            // triangles refer to
+            let first_varying = binned_draw.varyings.len();
+            binned_draw
+                .varyings
+                .resize(first_varying + vertex_indexes.len() * varying_count, 0.0);
+            {
+                struct Outputs(*mut [f32; 4], *mut f32);
+                unsafe impl Sync for Outputs {}
+                let outputs = Outputs(
+                    positions.as_mut_ptr(),
+                    binned_draw.varyings.as_mut_ptr().add(first_varying),
+                );
+                let vertex_indexes = &vertex_indexes;
+                let shaders = &*draw.shaders;
+                let vertex_buffers = draw.vertex_buffers;
+                context.parallel_for(vertex_indexes.len(), 64, &|range| {
+                    let outputs = &outputs;
+                    for index in range {
+                        let vertex_index = vertex_indexes[index];
+                        if vertex_index == PRIMITIVE_RESTART {
+                            continue;
+                        }
+                        // every vertex is written by only one task
+                        let varyings = std::slice::from_raw_parts_mut(
+                            outputs.1.add(index * varying_count),
+                            varying_count,
+                        );
+                        *outputs.0.add(index) = shaders.shade_vertex(
+                            &VertexInput {
+                                vertex_index,
+                                instance_index,
+                                vertex_buffers,
+                            },
+                            varyings,
+                        );
+                    }
+                });
+            }
+            let mut strips = Vec::new();
+            if state.primitive_restart {
+                let mut start = 0;
+                for (index, &vertex_index) in vertex_indexes.iter().enumerate() {
+                    if vertex_index == PRIMITIVE_RESTART {
+                        strips.push(start..index);
+                        start = index + 1;
+                    }
+                }
+                strips.push(start..vertex_indexes.len());
+            } else {
+                strips.push(0..vertex_indexes.len());
+            }
+            let mut triangles = Vec::new();
+            for strip in strips {
+                assemble_triangles(state.topology, strip.len(), |triangle| {
+                    triangles.push([
+                        strip.start + triangle[0],
+                        strip.start + triangle[1],
+                        strip.start + triangle[2],
+                    ])
+                });
+            }
+            primitive_count += triangles.len() as u64;
+            let mut polygon = Vec::new();
+            for triangle in triangles {
+                polygon.clear();
+                polygon.extend(triangle.iter().map(|&index| ClipVertex {
+                    position: positions[index],
+                    varying_offset: first_varying + index * varying_count,
+                }));
+                let inside = polygon.iter().all(|vertex| {
+                    planes
+                        .iter()
+                        .all(|plane| plane.distance(&vertex.position) >= 0.0)
+                });
+                if !inside && !binned_draw.clip_polygon(&planes, &mut polygon) {
+                    continue;
+                }
+                clipped_primitive_count += polygon.len() as u64 - 2;
+                let screen_vertices: Vec<ScreenVertex> = polygon
+                    .iter()
+                    .map(|vertex| binned_draw.to_screen(&viewport, vertex))
+                    .collect();
+                for i in 1..screen_vertices.len() - 1 {
+                    let vertices = [
+                        screen_vertices[0],
+                        screen_vertices[i],
+                        screen_vertices[i + 1],
+                    ];
+                    if let Some(triangle_index) = binned_draw.add_triangle(vertices) {
+                        let bounds = binned_draw.triangles[triangle_index].bounds;
+                        self.bin(bounds, command_index, triangle_index);
+                    }
+                }
+            }
+        }
+        context.add_pipeline_statistic(PipelineStatistic::InputAssemblyPrimitives, primitive_count);
+        context.add_pipeline_statistic(PipelineStatistic::ClippingInvocations, primitive_count);
+        context.add_pipeline_statistic(
+            PipelineStatistic::ClippingPrimitives,
+            clipped_primitive_count,
+        );
+        if !binned_draw.triangles.is_empty() {
+            self.push_command(BinnedCommand::Draw(binned_draw));
+        }
+    }
+    pub fn clear_attachments(
+        &mut self,
+        attachments: &[api::VkClearAttachment],
+        rects: &[api::VkClearRect],
+    ) {
+        let subpass = self.current_subpass();
+        let attachments = attachments
+            .iter()
+            .filter_map(|attachment| {
+                let index = if attachment.aspectMask & api::VK_IMAGE_ASPECT_COLOR_BIT != 0 {
+                    subpass.color_attachments[attachment.colorAttachment as usize]
+                } else {
+                    subpass.depth_stencil_attachment
+                };
+                Some((index?, attachment.aspectMask, attachment.clearValue))
+            })
+            .collect();
+        let render_area = self.render_area_rect();
+        let rects: Vec<Rect> = rects
+            .iter()
+            .map(|rect| {
+                // layered rendering isn't supported, so only the first layer is ever rendered
+                assert_eq!(rect.baseArrayLayer, 0);
+                Rect::from(rect.rect).intersect(render_area)
+            })
+            .collect();
+        let command_index = self.subpasses.last().unwrap().commands.len();
+        for (rect_index, &rect) in rects.iter().enumerate() {
+            if !rect.is_empty() {
+                self.bin(rect, command_index, rect_index);
+            }
+        }
+        self.push_command(BinnedCommand::Clear(BinnedClear { attachments, rects }));
+    }
+    /// rasterizes every tile, in parallel, returning what the fragments of each draw did. those
+    /// aren't in the pipeline statistics of `context`, since queries count them per draw.
+    pub fn end(self, context: &ExecutionContext) -> Vec<FragmentStatistics> {
+        kazan_trace::trace_scope!("RenderPassInstance::end");
+        assert_eq!(self.subpasses.len(), self.render_pass.subpasses.len());
+        let draw_statistics: Vec<DrawStatistics> = (0..self.draw_count)
+            .map(|_| DrawStatistics::default())
+            .collect();
+        let this = &self;
+        let draw_statistics_ref = &draw_statistics;
+        context.for_each_tile(self.render_area, self.tile_size, &|rect| unsafe {
+            this.rasterize_tile(Rect::from(rect), draw_statistics_ref)
+        });
+        draw_statistics
+            .into_iter()
+            .map(|statistics| FragmentStatistics {
+                fragment_shader_invocations: statistics.fragment_shader_invocations.into_inner(),
+                samples_passed: statistics.samples_passed.into_inner(),
+            })
+            .collect()
+    }
+    fn tile_index(&self, rect: Rect) -> usize {
+        let tile_size = self.tile_size as i32;
+        let x_tile = (rect.x0 - self.render_area.offset.x) / tile_size;
+        let y_tile = (rect.y0 - self.render_area.offset.y) / tile_size;
+        y_tile as usize * self.x_tile_count as usize + x_tile as usize
+    }
+    unsafe fn rasterize_tile(&self, rect: Rect, draw_statistics: &[DrawStatistics]) {
+        kazan_trace::trace_scope!("rasterize_tile");
+        let tile_index = self.tile_index(rect);
+        let mut tile = self.load_tile(rect);
+        let mut current_draw_index = None;
+        let flush_statistics = |tile: &mut Tile, draw_index: Option<usize>| {
+            if let Some(draw_index) = draw_index {
+                let statistics = mem::replace(&mut tile.statistics, Default::default());
+                let draw_statistics = &draw_statistics[draw_index];
+                draw_statistics
+                    .fragment_shader_invocations
+                    .fetch_add(statistics.fragment_shader_invocations, Ordering::Relaxed);
+                draw_statistics
+                    .samples_passed
+                    .fetch_add(statistics.samples_passed, Ordering::Relaxed);
+            }
+        };
+        for (subpass_index, subpass_bins) in self.subpasses.iter().enumerate() {
+            let subpass = &self.render_pass.subpasses[subpass_index];
+            for &(command_index, primitive_index) in &subpass_bins.bins[tile_index] {
+                match &subpass_bins.commands[command_index as usize] {
+                    BinnedCommand::Draw(draw) => {
+                        if current_draw_index != Some(draw.draw_index) {
+                            flush_statistics(&mut tile, current_draw_index);
+                            current_draw_index = Some(draw.draw_index);
+                        }
+                        rasterize_triangle(
+                            draw,
+                            &draw.triangles[primitive_index as usize],
+                            subpass,
+                            &mut tile,
+                        )
+                    }
+                    BinnedCommand::Clear(clear) => {
+                        clear_tile(clear, clear.rects[primitive_index as usize], &mut tile)
+                    }
+                }
+            }
+        }
+        flush_statistics(&mut tile, current_draw_index);
+        self.store_tile(&tile);
+    }
+    unsafe fn get_attachment_surface(
+        &self,
+        attachment_index: usize,
+        layout: api::VkImageLayout,
+    ) -> AttachmentSurface {
+        let view = &self.framebuffer.attachments[attachment_index];
+        AttachmentSurface::new(
+            &view.image,
+            layout,
+            view.subresource_range.baseMipLevel,
+            view.subresource_range.baseArrayLayer,
+        )
+    }
+    unsafe fn load_tile(&self, rect: Rect) -> Tile {
+        let pixel_count = ((rect.x1 - rect.x0) * (rect.y1 - rect.y0)) as usize;
+        let mut tile = Tile {
+            rect,
+            buffers: Vec::with_capacity(self.render_pass.attachments.len()),
+            statistics: FragmentStatistics::default(),
+        };
+        for (attachment_index, attachment) in self.render_pass.attachments.iter().enumerate() {
+            let load = attachment.loadOp == api::VK_ATTACHMENT_LOAD_OP_LOAD;
+            let clear_value = self.clear_values.get(attachment_index);
+            let load_op_clear = attachment.loadOp == api::VK_ATTACHMENT_LOAD_OP_CLEAR;
+            let format = self.framebuffer.attachments[attachment_index].format;
+            let buffer = if is_depth_format(format) {
+                let clear_depth = match clear_value {
+                    Some(clear_value) if load_op_clear => clear_value.depthStencil.depth,
+                    _ => 0.0,
+                };
+                let mut buffer = vec![clear_depth; pixel_count];
+                if load {
+                    let surface =
+                        self.get_attachment_surface(attachment_index, attachment.initialLayout);
+                    for y in rect.y0..rect.y1 {
+                        for x in rect.x0..rect.x1 {
+                            buffer[tile.index(x, y)] = *(surface.get_pixel(x, y) as *const f32);
+                        }
+                    }
+                }
+                TileBuffer::Depth(buffer)
+            } else if format == api::VK_FORMAT_UNDEFINED {
+                TileBuffer::Unused
+            } else {
+                let color_format = ColorFormat::new(format);
+                let clear_color = match clear_value {
+                    Some(clear_value) if load_op_clear => clear_value.color.float32,
+                    _ => [0.0; 4],
+                };
+                let mut buffer = vec![clear_color; pixel_count];
+                if load {
+                    let surface =
+                        self.get_attachment_surface(attachment_index, attachment.initialLayout);
+                    for y in rect.y0..rect.y1 {
+                        for x in rect.x0..rect.x1 {
+                            buffer[tile.index(x, y)] =
+                                color_format.decode(*(surface.get_pixel(x, y) as *const [u8; 4]));
+                        }
+                    }
+                }
+                TileBuffer::Color(buffer)
+            };
+            tile.buffers.push(buffer);
+        }
+        tile
+    }
+    /// the attachments are stored in their `finalLayout`, which takes care of the layout
+    /// transition at the end of the render pass
+    unsafe fn store_tile(&self, tile: &Tile) {
+        let rect = tile.rect;
+        for (attachment_index, attachment) in self.render_pass.attachments.iter().enumerate() {
+            if attachment.storeOp != api::VK_ATTACHMENT_STORE_OP_STORE {
+                continue;
+            }
+            let format = self.framebuffer.attachments[attachment_index].format;
+            let surface = self.get_attachment_surface(attachment_index, attachment.finalLayout);
+            match &tile.buffers[attachment_index] {
+                TileBuffer::Color(buffer) => {
+                    let color_format = ColorFormat::new(format);
+                    for y in rect.y0..rect.y1 {
+                        for x in rect.x0..rect.x1 {
+                            *(surface.get_pixel(x, y) as *mut [u8; 4]) =
+                                color_format.encode(buffer[tile.index(x, y)]);
+                        }
+                    }
+                }
+                TileBuffer::Depth(buffer) => {
+                    for y in rect.y0..rect.y1 {
+                        for x in rect.x0..rect.x1 {
+                            *(surface.get_pixel(x, y) as *mut f32) = buffer[tile.index(x, y)];
+                        }
+                    }
+                }
+                TileBuffer::Unused => {}
+            }
+        }
+    }
+}
+
+fn clear_tile(clear: &BinnedClear, rect: Rect, tile: &mut Tile) {
+    let rect = rect.intersect(tile.rect);
+    for &(attachment_index, aspect_mask, clear_value) in &clear.attachments {
+        for y in rect.y0..rect.y1 {
+            for x in rect.x0..rect.x1 {
+                let index = tile.index(x, y);
+                match &mut tile.buffers[attachment_index as usize] {
+                    TileBuffer::Color(buffer) => {
+                        buffer[index] = unsafe { clear_value.color.float32 }
+                    }
+                    TileBuffer::Depth(buffer) => {
+                        if aspect_mask & api::VK_IMAGE_ASPECT_DEPTH_BIT != 0 {
+                            buffer[index] = unsafe { clear_value.depthStencil.depth };
+                        }
+                    }
+                    TileBuffer::Unused => {}
+                }
+            }
+        }
+    }
+}
+
+/// whether `(dx, dy)` is the direction of a top or left edge, which own the pixel centers
+/// exactly on them
+fn is_top_left_edge(dx: i64, dy: i64) -> bool {
+    dy < 0 || (dy == 0 && dx > 0)
+}
+
+unsafe fn rasterize_triangle(
+    draw: &BinnedDraw,
+    triangle: &Triangle,
+    subpass: &Subpass,
+    tile: &mut Tile,
+) {
+    let bounds = triangle.bounds.intersect(tile.rect);
+    if bounds.is_empty() {
+        return;
+    }
+    let state = &*draw.state;
+    let vertices = &triangle.vertices;
+    // edge i is opposite vertex i, so its edge function is proportional to vertex i's
+    // barycentric coordinate
+    let mut edge_values = [0i64; 3];
+    let mut x_steps = [0i64; 3];
+    let mut y_steps = [0i64; 3];
+    let mut biases = [0i64; 3];
+    let start_x = (i64::from(bounds.x0) << SUBPIXEL_BITS) + HALF_PIXEL;
+    let start_y = (i64::from(bounds.y0) << SUBPIXEL_BITS) + HALF_PIXEL;
+    for i in 0..3 {
+        let a = &vertices[(i + 1) % 3];
+        let b = &vertices[(i + 2) % 3];
+        let dx = b.x - a.x;
+        let dy = b.y - a.y;
+        biases[i] = if is_top_left_edge(dx, dy) { 0 } else { -1 };
+        edge_values[i] = dx * (start_y - a.y) - dy * (start_x - a.x) + biases[i];
+        x_steps[i] = -dy << SUBPIXEL_BITS;
+        y_steps[i] = dx << SUBPIXEL_BITS;
+    }
+    let twice_area = (edge_values[0] - biases[0] + edge_values[1] - biases[1] + edge_values[2]
+        - biases[2]) as f32;
+    let inv_twice_area = 1.0 / twice_area;
+    let depth_attachment = subpass
+        .depth_stencil_attachment
+        .filter(|_| state.depth_compare_op.is_some() || state.depth_write);
+    let color_count = subpass.color_attachments.len();
+    let mut varyings = vec![0.0f32; draw.varying_count];
+    let mut colors = [[0.0f32; 4]; MAX_COLOR_ATTACHMENTS];
+    for y in bounds.y0..bounds.y1 {
+        let mut values = edge_values;
+        for x in bounds.x0..bounds.x1 {
+            if values[0] >= 0 && values[1] >= 0 && values[2] >= 0 {
+                let mut weights = [0.0f32; 3];
+                for i in 0..3 {
+                    weights[i] = (values[i] - biases[i]) as f32 * inv_twice_area;
+                }
+                shade_pixel(
+                    draw,
+                    triangle,
+                    weights,
+                    x,
+                    y,
+                    depth_attachment,
+                    subpass,
+                    &mut varyings,
+                    &mut colors[..color_count],
+                    tile,
+                );
+            }
+            for i in 0..3 {
+                values[i] += x_steps[i];
+            }
+        }
+        for i in 0..3 {
+            edge_values[i] += y_steps[i];
+        }
+    }
+}
+
+#[allow(clippy::too_many_arguments)]
+unsafe fn shade_pixel(
+    draw: &BinnedDraw,
+    triangle: &Triangle,
+    weights: [f32; 3],
+    x: i32,
+    y: i32,
+    depth_attachment: Option<u32>,
+    subpass: &Subpass,
+    varyings: &mut [f32],
+    colors: &mut [[f32; 4]],
+    tile: &mut Tile,
+) {
+    let state = &*draw.state;
+    let vertices = &triangle.vertices;
+    let index = tile.index(x, y);
+    // FIXME: implement depth bias
+    let mut depth =
+        weights[0] * vertices[0].z + weights[1] * vertices[1].z + weights[2] * vertices[2].z;
+    if state.depth_clamp {
+        depth = depth.max(draw.depth_range[0]).min(draw.depth_range[1]);
+    }
+    // fragment shaders can't write the depth, so it is tested before shading them
+    if let (Some(depth_attachment), Some(compare_op)) = (depth_attachment, state.depth_compare_op) {
+        if let TileBuffer::Depth(buffer) = &tile.buffers[depth_attachment as usize] {
+            if !compare(compare_op, depth, buffer[index]) {
+                return;
+            }
+        }
+    }
+    tile.statistics.fragment_shader_invocations += 1;
+    let inv_w = weights[0] * vertices[0].inv_w
+        + weights[1] * vertices[1].inv_w
+        + weights[2] * vertices[2].inv_w;
+    let w = 1.0 / inv_w;
+    let perspective_weights = [
+        weights[0] * vertices[0].inv_w * w,
+        weights[1] * vertices[1].inv_w * w,
+        weights[2] * vertices[2].inv_w * w,
+    ];
+    for (i, varying) in varyings.iter_mut().enumerate() {
+        *varying = perspective_weights[0] * draw.varyings[vertices[0].varying_offset + i]
+            + perspective_weights[1] * draw.varyings[vertices[1].varying_offset + i]
+            + perspective_weights[2] * draw.varyings[vertices[2].varying_offset + i];
+    }
+    let input = FragmentInput {
+        varyings,
+        frag_coord: [x as f32 + 0.5, y as f32 + 0.5, depth, inv_w],
+        front_facing: triangle.front_facing,
+    };
+    if !draw.shaders.shade_fragment(&input, colors) {
+        return;
+    }
+    tile.statistics.samples_passed += 1;
+    if let Some(depth_attachment) = depth_attachment {
+        if state.depth_write {
+            if let TileBuffer::Depth(buffer) = &mut tile.buffers[depth_attachment as usize] {
+                buffer[index] = depth;
+            }
+        }
+    }
+    for (color_index, &attachment_index) in subpass.color_attachments.iter().enumerate() {
+        let attachment_index = match attachment_index {
+            Some(attachment_index) => attachment_index,
+            None => continue,
+        };
+        if let TileBuffer::Color(buffer) = &mut tile.buffers[attachment_index as usize] {
+            buffer[index] = blend(
+                &state.color_blend_attachments[color_index],
+                colors[color_index],
+                buffer[index],
+                draw.blend_constants,
+            );
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::device_memory::{DeviceMemory, DeviceMemoryType};
+    use crate::handle::OwnedHandle;
+    use crate::image::{
+        ComponentMapping, ImageMemory, ImageMultisampleCount, ImageProperties, ImageView,
+        ImageViewType, SupportedTilings,
+    };
+    use crate::render_pass::{Framebuffer, RenderPass};
+    use crate::worker_pool::WorkerPool;
+
+    /// big enough for several tiles in each direction
+    const WIDTH: u32 = 160;
+    const HEIGHT: u32 = 80;
+
+    const RED: [f32; 4] = [1.0, 0.0, 0.0, 1.0];
+    const GREEN: [f32; 4] = [0.0, 1.0, 0.0, 1.0];
+    const BLUE: [f32; 4] = [0.0, 0.0, 1.0, 1.0];
+
+    #[derive(Copy, Clone, Debug)]
+    struct TestVertex {
+        /// x and y in pixels, then the clip-space z
+        position: [f32; 3],
+        color: [f32; 4],
+    }
+
+    fn vertex(x: f32, y: f32, z: f32, color: [f32; 4]) -> TestVertex {
+        TestVertex {
+            position: [x, y, z],
+            color,
+        }
+    }
+
+    /// two triangles covering `x0..x1` by `y0..y1`
+    fn quad(
+        (x0, y0): (f32, f32),
+        (x1, y1): (f32, f32),
+        get_vertex: impl Fn(f32, f32) -> TestVertex,
+    ) -> Vec<TestVertex> {
+        [(x0, y0), (x1, y0), (x1, y1), (x0, y0), (x1, y1), (x0, y1)]
+            .iter()
+            .map(|&(x, y)| get_vertex(x, y))
+            .collect()
+    }
+
+    /// passes the color of each vertex through to the first color attachment
+    #[derive(Debug)]
+    struct TestShaders {
+        vertices: Vec<TestVertex>,
+    }
+
+    impl GraphicsShaders for TestShaders {
+        fn varying_count(&self) -> usize {
+            4
+        }
+        unsafe fn shade_vertex(&self, input: &VertexInput, varyings: &mut [f32]) -> [f32; 4] {
+            let vertex = &self.vertices[input.vertex_index as usize];
+            varyings.copy_from_slice(&vertex.color);
+            let [x, y, z] = vertex.position;
+            [
+                x / WIDTH as f32 * 2.0 - 1.0,
+                y / HEIGHT as f32 * 2.0 - 1.0,
+                z,
+                1.0,
+            ]
+        }
+        unsafe fn shade_fragment(&self, input: &FragmentInput, colors: &mut [[f32; 4]]) -> bool {
+            colors[0].copy_from_slice(input.varyings);
+            true
+        }
+    }
+
+    fn get_full_rect() -> api::VkRect2D {
+        api::VkRect2D {
+            offset: api::VkOffset2D { x: 0, y: 0 },
+            extent: api::VkExtent2D {
+                width: WIDTH,
+                height: HEIGHT,
+            },
+        }
+    }
+
+    /// an `R8G8B8A8_UNORM` color attachment cleared to transparent black, then optionally a
+    /// `D32_SFLOAT` depth attachment cleared to 1
+    struct Target {
+        // the fields are dropped in order, so nothing is freed while it's still used
+        framebuffer: OwnedHandle<api::VkFramebuffer>,
+        render_pass: OwnedHandle<api::VkRenderPass>,
+        _views: Vec<OwnedHandle<api::VkImageView>>,
+        images: Vec<OwnedHandle<api::VkImage>>,
+        _memories: Vec<OwnedHandle<api::VkDeviceMemory>>,
+    }
+
+    impl Target {
+        fn new(has_depth: bool) -> Self {
+            let mut formats = vec![api::VK_FORMAT_R8G8B8A8_UNORM];
+            if has_depth {
+                formats.push(api::VK_FORMAT_D32_SFLOAT);
+            }
+            let mut memories = Vec::new();
+            let mut images = Vec::new();
+            let mut views = Vec::new();
+            let mut attachments = Vec::new();
+            for &format in &formats {
+                let properties = ImageProperties {
+                    supported_tilings: SupportedTilings::Any,
+                    format,
+                    extents: api::VkExtent3D {
+                        width: WIDTH,
+                        height: HEIGHT,
+                        depth: 1,
+                    },
+                    array_layers: 1,
+                    mip_levels: 1,
+                    multisample_count: ImageMultisampleCount::Count1,
+                    swapchain_present_tiling: None,
+                };
+                let memory = OwnedHandle::<api::VkDeviceMemory>::new(
+                    DeviceMemory::allocate_from_default_heap(
+                        DeviceMemoryType::Main,
+                        properties.computed_properties().memory_layout,
+                    )
+                    .unwrap(),
+                );
+                let image = OwnedHandle::<api::VkImage>::new(Image {
+                    properties,
+                    usage: 0,
+                    memory: Some(ImageMemory {
+                        device_memory: unsafe { SharedHandle::from(memory.get_handle()).unwrap() },
+                        offset: 0,
+                    }),
+                });
+                let (aspect_mask, final_layout) = if is_depth_format(format) {
+                    (
+                        api::VK_IMAGE_ASPECT_DEPTH_BIT,
+                        api::VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                    )
+                } else {
+                    (
+                        api::VK_IMAGE_ASPECT_COLOR_BIT,
+                        api::VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                    )
+                };
+                let view = OwnedHandle::<api::VkImageView>::new(ImageView {
+                    image: unsafe { SharedHandle::from(image.get_handle()).unwrap() },
+                    view_type: ImageViewType::Type2D,
+                    format,
+                    component_mapping: ComponentMapping::IDENTITY,
+                    subresource_range: api::VkImageSubresourceRange {
+                        aspectMask: aspect_mask,
+                        baseMipLevel: 0,
+                        levelCount: 1,
+                        baseArrayLayer: 0,
+                        layerCount: 1,
+                    },
+                });
+                attachments.push(api::VkAttachmentDescription {
+                    flags: 0,
+                    format,
+                    samples: api::VK_SAMPLE_COUNT_1_BIT,
+                    loadOp: api::VK_ATTACHMENT_LOAD_OP_CLEAR,
+                    storeOp: api::VK_ATTACHMENT_STORE_OP_STORE,
+                    stencilLoadOp: api::VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+                    stencilStoreOp: api::VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                    initialLayout: api::VK_IMAGE_LAYOUT_UNDEFINED,
+                    finalLayout: final_layout,
+                });
+                memories.push(memory);
+                images.push(image);
+                views.push(view);
+            }
+            let render_pass = OwnedHandle::<api::VkRenderPass>::new(RenderPass {
+                attachments,
+                subpasses: vec![Subpass {
+                    input_attachments: Vec::new(),
+                    color_attachments: vec![Some(0)],
+                    resolve_attachments: Vec::new(),
+                    depth_stencil_attachment: if has_depth { Some(1) } else { None },
+                }],
+            });
+            let framebuffer = OwnedHandle::<api::VkFramebuffer>::new(Framebuffer {
+                attachments: views
+                    .iter()
+                    .map(|view| unsafe { SharedHandle::from(view.get_handle()).unwrap() })
+                    .collect(),
+                width: WIDTH,
+                height: HEIGHT,
+                layers: 1,
+            });
+            Self {
+                framebuffer,
+                render_pass,
+                _views: views,
+                images,
+                _memories: memories,
+            }
+        }
+        fn begin(&self) -> RenderPassInstance {
+            let clear_values = [
+                api::VkClearValue {
+                    color: api::VkClearColorValue { float32: [0.0; 4] },
+                },
+                api::VkClearValue {
+                    depthStencil: api::VkClearDepthStencilValue {
+                        depth: 1.0,
+                        stencil: 0,
+                    },
+                },
+            ];
+            unsafe {
+                RenderPassInstance::new(
+                    SharedHandle::from(self.render_pass.get_handle()).unwrap(),
+                    SharedHandle::from(self.framebuffer.get_handle()).unwrap(),
+                    get_full_rect(),
+                    &clear_values[..self.images.len()],
+                )
+            }
+        }
+        /// where the render pass stored the pixel at `(x, y)` of attachment `attachment_index`
+        fn get_pixel(&self, attachment_index: usize, x: u32, y: u32) -> *const u8 {
+            let image = &self.images[attachment_index];
+            let final_layout = self.render_pass.attachments[attachment_index].finalLayout;
+            let offset = image.properties.get_pixel_offset(
+                image.properties.get_tiling(final_layout),
+                0,
+                0,
+                x,
+                y,
+                0,
+            );
+            let memory = image.memory.as_ref().unwrap();
+            unsafe {
+                memory
+                    .device_memory
+                    .get()
+                    .as_ptr()
+                    .add(memory.offset + offset)
+            }
+        }
+        fn get_color(&self, x: u32, y: u32) -> [u8; 4] {
+            unsafe { *(self.get_pixel(0, x, y) as *const [u8; 4]) }
+        }
+        fn get_depth(&self, x: u32, y: u32) -> f32 {
+            unsafe { *(self.get_pixel(1, x, y) as *const f32) }
+        }
+    }
+
+    /// a triangle list with depth testing and blending disabled
+    fn get_state() -> FixedFunctionState {
+        FixedFunctionState {
+            topology: api::VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+            primitive_restart: false,
+            rasterizer_discard: false,
+            depth_clamp: false,
+            cull_mode: api::VK_CULL_MODE_NONE,
+            front_face: api::VK_FRONT_FACE_COUNTER_CLOCKWISE,
+            depth_compare_op: None,
+            depth_write: false,
+            color_blend_attachments: vec![get_blend_state(
+                api::VK_FALSE,
+                (api::VK_BLEND_FACTOR_ONE, api::VK_BLEND_FACTOR_ZERO),
+                api::VK_BLEND_OP_ADD,
+            )],
+            viewport: None,
+            scissor: None,
+            blend_constants: None,
+        }
+    }
+
+    /// blends color and alpha the same way
+    fn get_blend_state(
+        blend_enable: api::VkBool32,
+        (src_factor, dst_factor): (api::VkBlendFactor, api::VkBlendFactor),
+        op: api::VkBlendOp,
+    ) -> api::VkPipelineColorBlendAttachmentState {
+        api::VkPipelineColorBlendAttachmentState {
+            blendEnable: blend_enable,
+            srcColorBlendFactor: src_factor,
+            dstColorBlendFactor: dst_factor,
+            colorBlendOp: op,
+            srcAlphaBlendFactor: src_factor,
+            dstAlphaBlendFactor: dst_factor,
+            alphaBlendOp: op,
+            colorWriteMask: api::VK_COLOR_COMPONENT_R_BIT
+                | api::VK_COLOR_COMPONENT_G_BIT
+                | api::VK_COLOR_COMPONENT_B_BIT
+                | api::VK_COLOR_COMPONENT_A_BIT,
+        }
+    }
+
+    fn draw(
+        context: &ExecutionContext,
+        instance: &mut RenderPassInstance,
+        state: FixedFunctionState,
+        vertices: Vec<TestVertex>,
+    ) {
+        assert!(state.is_supported());
+        let vertex_count = vertices.len() as u32;
+        let state = Arc::new(state);
+        let shaders: Arc<dyn GraphicsShaders> = Arc::new(TestShaders { vertices });
+        unsafe {
+            instance.draw(
+                context,
+                Draw {
+                    state: &state,
+                    shaders: &shaders,
+                    viewport: api::VkViewport {
+                        x: 0.0,
+                        y: 0.0,
+                        width: WIDTH as f32,
+                        height: HEIGHT as f32,
+                        minDepth: 0.0,
+                        maxDepth: 1.0,
+                    },
+                    scissor: get_full_rect(),
+                    blend_constants: state.blend_constants.unwrap_or([0.0; 4]),
+                    vertex_buffers: &VertexBuffers(Vec::new()),
+                    vertices: DrawVertices::Sequential {
+                        first_vertex: 0,
+                        vertex_count,
+                    },
+                    instances: 0..1,
+                },
+            );
+        }
+    }
+
+    /// runs `draws` in one render pass instance, returning what each draw's fragments did
+    fn render(
+        target: &Target,
+        draws: Vec<(FixedFunctionState, Vec<TestVertex>)>,
+    ) -> Vec<FragmentStatistics> {
+        let worker_pool = WorkerPool::new(4);
+        let context = ExecutionContext::new(&worker_pool);
+        let mut instance = target.begin();
+        for (state, vertices) in draws {
+            draw(&context, &mut instance, state, vertices);
+        }
+        instance.end(&context)
+    }
+
+    fn to_unorm8(value: f32) -> u8 {
+        (value.max(0.0).min(1.0) * 255.0).round() as u8
+    }
+
+    #[test]
+    fn test_is_supported() {
+        assert!(get_state().is_supported());
+        for &topology in &[
+            api::VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP,
+            api::VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN,
+        ] {
+            let mut state = get_state();
+            state.topology = topology;
+            assert!(state.is_supported());
+        }
+        for &topology in &[
+            api::VK_PRIMITIVE_TOPOLOGY_POINT_LIST,
+            api::VK_PRIMITIVE_TOPOLOGY_LINE_LIST,
+            api::VK_PRIMITIVE_TOPOLOGY_LINE_STRIP,
+        ] {
+            let mut state = get_state();
+            state.topology = topology;
+            assert!(!state.is_supported());
+            // nothing is rasterized, so it doesn't matter what it would have looked like
+            state.rasterizer_discard = true;
+            assert!(state.is_supported());
+        }
+        let get_blend_state_support = |blend_enable, factors, op| {
+            let mut state = get_state();
+            state.color_blend_attachments = vec![
+                get_state().color_blend_attachments[0],
+                get_blend_state(blend_enable, factors, op),
+            ];
+            state.is_supported()
+        };
+        let one_minus_src_alpha = (
+            api::VK_BLEND_FACTOR_SRC_ALPHA,
+            api::VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
+        );
+        let src1_color = (api::VK_BLEND_FACTOR_SRC1_COLOR, api::VK_BLEND_FACTOR_ZERO);
+        let multiply = api::VK_BLEND_OP_MULTIPLY_EXT;
+        assert!(get_blend_state_support(
+            api::VK_TRUE,
+            one_minus_src_alpha,
+            api::VK_BLEND_OP_MAX
+        ));
+        assert!(!get_blend_state_support(
+            api::VK_TRUE,
+            src1_color,
+            api::VK_BLEND_OP_ADD
+        ));
+        assert!(!get_blend_state_support(
+            api::VK_TRUE,
+            one_minus_src_alpha,
+            multiply
+        ));
+        // the factors and ops of attachments that don't blend are never used
+        assert!(get_blend_state_support(api::VK_FALSE, src1_color, multiply));
+    }
+
+    #[test]
+    fn test_binning() {
+        let target = Target::new(true);
+        let worker_pool = WorkerPool::new(4);
+        let context = ExecutionContext::new(&worker_pool);
+        let mut instance = target.begin();
+        // 16-byte color and 4-byte depth tiles fit in the budget at 64x64, giving 3x2 tiles
+        assert_eq!(instance.tile_size, 64);
+        assert_eq!(instance.x_tile_count, 3);
+        assert_eq!(instance.tile_count, 6);
+        // the corner of four tiles
+        draw(
+            &context,
+            &mut instance,
+            get_state(),
+            vec![
+                vertex(40.0, 40.0, 0.5, RED),
+                vertex(90.0, 40.0, 0.5, RED),
+                vertex(40.0, 70.0, 0.5, RED),
+            ],
+        );
+        // inside the bottom right tile
+        draw(
+            &context,
+            &mut instance,
+            get_state(),
+            vec![
+                vertex(140.0, 70.0, 0.5, GREEN),
+                vertex(150.0, 70.0, 0.5, GREEN),
+                vertex(140.0, 78.0, 0.5, GREEN),
+            ],
+        );
+        // off screen, so it isn't in any bin
+        draw(
+            &context,
+            &mut instance,
+            get_state(),
+            vec![
+                vertex(-40.0, 10.0, 0.5, BLUE),
+                vertex(-10.0, 10.0, 0.5, BLUE),
+                vertex(-40.0, 30.0, 0.5, BLUE),
+            ],
+        );
+        assert_eq!(instance.draw_count(), 3);
+        assert_eq!(
+            instance.subpasses[0].bins,
+            vec![
+                vec![(0, 0)],
+                vec![(0, 0)],
+                vec![],
+                vec![(0, 0)],
+                vec![(0, 0)],
+                vec![(1, 0)]
+            ]
+        );
+        let statistics = instance.end(&context);
+        assert_eq!(statistics.len(), 3);
+        assert_eq!(statistics[2].fragment_shader_invocations, 0);
+        let red = [255, 0, 0, 255];
+        // in each of the four tiles
+        assert_eq!(target.get_color(41, 41), red);
+        assert_eq!(target.get_color(70, 41), red);
+        assert_eq!(target.get_color(41, 68), red);
+        // binned by its bounding box, but not covered
+        assert_eq!(target.get_color(65, 65), [0; 4]);
+        assert_eq!(target.get_color(60, 60), [0; 4]);
+        assert_eq!(target.get_color(141, 71), [0, 255, 0, 255]);
+        assert_eq!(target.get_color(100, 10), [0; 4]);
+        assert_eq!(target.get_color(0, 20), [0; 4]);
+    }
+
+    #[test]
+    fn test_top_left_fill_rule() {
+        let target = Target::new(false);
+        let mut state = get_state();
+        state.color_blend_attachments[0] = get_blend_state(
+            api::VK_TRUE,
+            (api::VK_BLEND_FACTOR_ONE, api::VK_BLEND_FACTOR_ONE),
+            api::VK_BLEND_OP_ADD,
+        );
+        // every edge goes through pixel centers, and each square is split along a different
+        // diagonal, so a pixel on an edge is added in twice if both triangles own it
+        let color = [0.25, 0.0, 0.0, 0.0];
+        let mut vertices = quad((8.5, 8.5), (16.5, 16.5), |x, y| vertex(x, y, 0.5, color));
+        vertices.extend(quad((28.5, 20.5), (20.5, 28.5), |x, y| {
+            vertex(x, y, 0.5, color)
+        }));
+        let statistics = render(&target, vec![(state, vertices)]);
+        // the top and left edges own the pixels on them; the bottom and right edges don't
+        let is_covered = |x: u32, y: u32| {
+            ((8..16).contains(&x) && (8..16).contains(&y))
+                || ((20..28).contains(&x) && (20..28).contains(&y))
+        };
+        for y in 0..32 {
+            for x in 0..32 {
+                let expected = if is_covered(x, y) { 64 } else { 0 };
+                assert_eq!(target.get_color(x, y)[0], expected, "({}, {})", x, y);
+            }
+        }
+        assert_eq!(statistics[0].fragment_shader_invocations, 2 * 8 * 8);
+        assert_eq!(statistics[0].samples_passed, 2 * 8 * 8);
+    }
+
+    #[test]
+    fn test_guard_band_clipping() {
+        let target = Target::new(false);
+        // the red channel is x / WIDTH everywhere, so it shows whether the clipped vertices'
+        // varyings were interpolated right
+        let big_vertex = |x: f32, y: f32| vertex(x, y, 0.5, [x / WIDTH as f32, 0.0, 1.0, 1.0]);
+        let worker_pool = WorkerPool::new(4);
+        let context = ExecutionContext::new(&worker_pool);
+        let mut instance = target.begin();
+        draw(
+            &context,
+            &mut instance,
+            get_state(),
+            vec![
+                big_vertex(-1e5, -1e5),
+                big_vertex(3e5, -1e5),
+                big_vertex(-1e5, 3e5),
+            ],
+        );
+        let statistics = instance.end(&context);
+        // without clipping, the fixed-point edge functions would overflow
+        assert!(
+            context.get_pipeline_statistics()[PipelineStatistic::ClippingPrimitives as usize] > 1
+        );
+        assert_eq!(
+            statistics[0].fragment_shader_invocations,
+            u64::from(WIDTH * HEIGHT)
+        );
+        for y in 0..HEIGHT {
+            for x in 0..WIDTH {
+                let color = target.get_color(x, y);
+                let expected_red = to_unorm8((x as f32 + 0.5) / WIDTH as f32);
+                assert!(
+                    (i32::from(color[0]) - i32::from(expected_red)).abs() <= 1,
+                    "({}, {}): {:?}",
+                    x,
+                    y,
+                    color
+                );
+                assert_eq!(color[1..], [0, 255, 255]);
+            }
+        }
+    }
+
+    #[test]
+    fn test_depth_clipping() {
+        for &depth_clamp in &[false, true] {
+            let target = Target::new(false);
+            let mut state = get_state();
+            state.depth_clamp = depth_clamp;
+            // z goes from -0.5 on the left to 1.5 on the right, so only the middle half is
+            // between the near and far planes
+            let vertices = quad((0.0, 0.0), (WIDTH as f32, HEIGHT as f32), |x, y| {
+                vertex(x, y, x / 80.0 - 0.5, [x / WIDTH as f32, 0.0, 0.0, 1.0])
+            });
+            render(&target, vec![(state, vertices)]);
+            for y in 0..HEIGHT {
+                for x in 0..WIDTH {
+                    let color = target.get_color(x, y);
+                    if !depth_clamp && (x < 40 || x >= 120) {
+                        assert_eq!(color, [0; 4], "({}, {})", x, y);
+                        continue;
+                    }
+                    let expected_red = to_unorm8((x as f32 + 0.5) / WIDTH as f32);
+                    assert!(
+                        (i32::from(color[0]) - i32::from(expected_red)).abs() <= 1,
+                        "({}, {}): {:?}",
+                        x,
+                        y,
+                        color
+                    );
+                    assert_eq!(color[1..], [0, 0, 255]);
+                }
+            }
+        }
+    }
+
+    #[test]
+    fn test_depth() {
+        let target = Target::new(true);
+        let mut depth_state = get_state();
+        depth_state.depth_compare_op = Some(api::VK_COMPARE_OP_LESS);
+        depth_state.depth_write = true;
+        let near = 0.25;
+        let far = 0.75;
+        let statistics = render(
+            &target,
+            vec![
+                // near then far on the left, far then near on the right
+                (
+                    depth_state.clone(),
+                    quad((0.0, 0.0), (80.0, 40.0), |x, y| vertex(x, y, near, RED)),
+                ),
+                (
+                    depth_state.clone(),
+                    quad((0.0, 0.0), (80.0, 40.0), |x, y| vertex(x, y, far, GREEN)),
+                ),
+                (
+                    depth_state.clone(),
+                    quad((80.0, 0.0), (160.0, 40.0), |x, y| vertex(x, y, far, GREEN)),
+                ),
+                (
+                    depth_state.clone(),
+                    quad((80.0, 0.0), (160.0, 40.0), |x, y| vertex(x, y, near, RED)),
+                ),
+                // without depth testing or writes, it's drawn over everything, and leaves the
+                // depth alone
+                (
+                    get_state(),
+                    quad((0.0, 20.0), (160.0, 60.0), |x, y| vertex(x, y, 0.9, BLUE)),
+                ),
+            ],
+        );
+        let area = 80 * 40;
+        // the depth is tested before the fragment shader runs
+        assert_eq!(statistics[0].fragment_shader_invocations, area);
+        assert_eq!(statistics[1].fragment_shader_invocations, 0);
+        assert_eq!(statistics[2].fragment_shader_invocations, area);
+        assert_eq!(statistics[3].fragment_shader_invocations, area);
+        assert_eq!(statistics[3].samples_passed, area);
+        assert_eq!(statistics[4].fragment_shader_invocations, 160 * 40);
+        for y in 0..HEIGHT {
+            for x in 0..WIDTH {
+                let (expected_color, expected_depth) = if y >= 20 && y < 60 {
+                    ([0, 0, 255, 255], if y < 40 { near } else { 1.0 })
+                } else if y < 40 {
+                    ([255, 0, 0, 255], near)
+                } else {
+                    ([0; 4], 1.0)
+                };
+                assert_eq!(target.get_color(x, y), expected_color, "({}, {})", x, y);
+                let depth = target.get_depth(x, y);
+                assert!(
+                    (depth - expected_depth).abs() < 1e-6,
+                    "({}, {}): {}",
+                    x,
+                    y,
+                    depth
+                );
+            }
+        }
+    }
+
+    #[test]
+    fn test_blending() {
+        let target = Target::new(false);
+        let mut clear_state = get_state();
+        clear_state.color_blend_attachments[0].colorWriteMask =
+            api::VK_COLOR_COMPONENT_B_BIT | api::VK_COLOR_COMPONENT_A_BIT;
+        let mut alpha_state = get_state();
+        alpha_state.color_blend_attachments[0] = get_blend_state(
+            api::VK_TRUE,
+            (
+                api::VK_BLEND_FACTOR_SRC_ALPHA,
+                api::VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
+            ),
+            api::VK_BLEND_OP_ADD,
+        );
+        let mut subtract_state = get_state();
+        subtract_state.color_blend_attachments[0] = get_blend_state(
+            api::VK_TRUE,
+            (api::VK_BLEND_FACTOR_ONE, api::VK_BLEND_FACTOR_ONE),
+            api::VK_BLEND_OP_REVERSE_SUBTRACT,
+        );
+        let mut constant_state = get_state();
+        constant_state.color_blend_attachments[0] = get_blend_state(
+            api::VK_TRUE,
+            (
+                api::VK_BLEND_FACTOR_CONSTANT_COLOR,
+                api::VK_BLEND_FACTOR_ZERO,
+            ),
+            api::VK_BLEND_OP_ADD,
+        );
+        constant_state.blend_constants = Some([0.5, 0.25, 1.0, 1.0]);
+        let mut min_state = get_state();
+        min_state.color_blend_attachments[0] = get_blend_state(
+            api::VK_TRUE,
+            (api::VK_BLEND_FACTOR_ZERO, api::VK_BLEND_FACTOR_ZERO),
+            api::VK_BLEND_OP_MIN,
+        );
+        let mut mask_state = get_state();
+        mask_state.color_blend_attachments[0].colorWriteMask =
+            api::VK_COLOR_COMPONENT_R_BIT | api::VK_COLOR_COMPONENT_A_BIT;
+        let column = |x: f32, color: [f32; 4]| {
+            quad((x, 0.0), (x + 10.0, HEIGHT as f32), move |x, y| {
+                vertex(x, y, 0.5, color)
+            })
+        };
+        // everything is drawn over opaque blue, which only touches blue and alpha
+        render(
+            &target,
+            vec![
+                (
+                    clear_state,
+                    quad((0.0, 0.0), (WIDTH as f32, HEIGHT as f32), |x, y| {
+                        vertex(x, y, 0.5, [1.0, 1.0, 1.0, 1.0])
+                    }),
+                ),
+                (alpha_state, column(0.0, [1.0, 0.0, 0.0, 0.25])),
+                (subtract_state, column(10.0, [0.0, 0.0, 0.25, 0.5])),
+                (constant_state, column(20.0, [1.0, 1.0, 0.5, 1.0])),
+                (min_state, column(30.0, [0.5, 0.5, 0.5, 0.5])),
+                (mask_state, column(40.0, [1.0, 1.0, 0.0, 0.5])),
+            ],
+        );
+        let expected = [
+            // (1, 0, 0, 0.25) * 0.25 + (0, 0, 1, 1) * 0.75
+            [64, 0, 191, 207],
+            // (0, 0, 1, 1) - (0, 0, 0.25, 0.5)
+            [0, 0, 191, 128],
+            // (1, 1, 0.5, 1) * (0.5, 0.25, 1, 1)
+            [128, 64, 128, 255],
+            // the factors are ignored
+            [0, 0, 128, 128],
+            // only red and alpha are written
+            [255, 0, 255, 128],
+            // nothing drew here
+            [0, 0, 255, 255],
+        ];
+        for (column_index, expected) in expected.iter().enumerate() {
+            for &(x, y) in &[(0, 0), (9, HEIGHT - 1)] {
+                let x = column_index as u32 * 10 + x;
+                assert_eq!(target.get_color(x, y), *expected, "({}, {})", x, y);
+            }
+        }
+    }
+}
@@ -1,5 +1,110 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 // See Notices.txt for copyright information
 
+use crate::api;
+use crate::handle::SharedHandle;
+use crate::util;
+
+fn get_attachment_index(reference: &api::VkAttachmentReference) -> Option<u32> {
+    if reference.attachment == api::VK_ATTACHMENT_UNUSED as u32 {
+        None
+    } else {
+        Some(reference.attachment)
+    }
+}
+
+unsafe fn get_attachment_indexes(
+    references: *const api::VkAttachmentReference,
+    count: u32,
+) -> Vec<Option<u32>> {
+    util::to_slice(references, count as usize)
+        .iter()
+        .map(get_attachment_index)
+        .collect()
+}
+
+#[derive(Debug)]
+pub struct Subpass {
+    pub input_attachments: Vec<Option<u32>>,
+    pub color_attachments: Vec<Option<u32>>,
+    /// either empty or the same length as `color_attachments`
+    pub resolve_attachments: Vec<Option<u32>>,
+    pub depth_stencil_attachment: Option<u32>,
+}
+
 #[derive(Debug)]
-pub struct RenderPass {}
+pub struct RenderPass {
+    pub attachments: Vec<api::VkAttachmentDescription>,
+    pub subpasses: Vec<Subpass>,
+}
+
+impl RenderPass {
+    /// subpass dependencies are ignored, since subpasses are executed in order
+    pub unsafe fn new(create_info: &api::VkRenderPassCreateInfo) -> Self {
+        let attachments = util::to_slice(
+            create_info.pAttachments,
+            create_info.attachmentCount as usize,
+        )
+        .to_vec();
+        let subpasses = util::to_slice(create_info.pSubpasses, create_info.subpassCount as usize)
+            .iter()
+            .map(|subpass| {
+                assert_eq!(
+                    subpass.pipelineBindPoint,
+                    api::VK_PIPELINE_BIND_POINT_GRAPHICS
+                );
+                let color_attachments =
+                    get_attachment_indexes(subpass.pColorAttachments, subpass.colorAttachmentCount);
+                let resolve_attachments = if subpass.pResolveAttachments.is_null() {
+                    Vec::new()
+                } else {
+                    get_attachment_indexes(
+                        subpass.pResolveAttachments,
+                        subpass.colorAttachmentCount,
+                    )
+                };
+                Subpass {
+                    input_attachments: get_attachment_indexes(
+                        subpass.pInputAttachments,
+                        subpass.inputAttachmentCount,
+                    ),
+                    color_attachments,
+                    resolve_attachments,
+                    depth_stencil_attachment: subpass
+                        .pDepthStencilAttachment
+                        .as_ref()
+                        .and_then(get_attachment_index),
+                }
+            })
+            .collect();
+        Self {
+            attachments,
+            subpasses,
+        }
+    }
+}
+
+#[derive(Debug)]
+pub struct Framebuffer {
+    pub attachments: Vec<SharedHandle<api::VkImageView>>,
+    pub width: u32,
+    pub height: u32,
+    pub layers: u32,
+}
+
+impl Framebuffer {
+    pub unsafe fn new(create_info: &api::VkFramebufferCreateInfo) -> Self {
+        Self {
+            attachments: util::to_slice(
+                create_info.pAttachments,
+                create_info.attachmentCount as usize,
+            )
+            .iter()
+            .map(|&attachment| SharedHandle::from(attachment).unwrap())
+            .collect(),
+            width: create_info.width,
+            height: create_info.height,
+            layers: create_info.layers,
+        }
+    }
+}
@@ -8,9 +8,9 @@ use std::ops::Deref;
 use std::ops::DerefMut;
 use std::os::raw::c_int;
 use std::ptr::null_mut;
+use std::ptr::NonNull;
 
 #[derive(Debug)]
-#[allow(dead_code)]
 pub struct SharedMemorySegment {
     id: c_int,
     size: usize,
@@ -21,7 +21,6 @@ unsafe impl Send for SharedMemorySegment {}
 unsafe impl Sync for SharedMemorySegment {}
 
 impl SharedMemorySegment {
-    #[allow(dead_code)]
     pub unsafe fn new(id: c_int, size: usize) -> Self {
         assert_ne!(size, 0);
         assert_ne!(id, -1);
@@ -37,11 +36,12 @@ impl SharedMemorySegment {
             id => Ok(Self::new(id, size)),
         }
     }
-    #[allow(dead_code)]
     pub fn create(size: usize) -> Result<Self, errno::Errno> {
         unsafe { Self::create_with_flags(size, libc::IPC_CREAT | libc::IPC_EXCL | 0o666) }
     }
-    #[allow(dead_code)]
+    pub fn id(&self) -> c_int {
+        self.id
+    }
     pub fn map(&self) -> Result<MappedSharedMemorySegment, errno::Errno> {
         unsafe {
             let memory = libc::shmat(self.id, null_mut(), 0);
@@ -75,6 +75,9 @@ impl MappedSharedMemorySegment {
     unsafe fn get(&self) -> *mut [u8] {
         util::to_slice_mut(self.memory, self.size)
     }
+    pub fn as_non_null(&self) -> NonNull<u8> {
+        unsafe { NonNull::new_unchecked(self.memory) }
+    }
 }
 
 unsafe impl Send for MappedSharedMemorySegment {}
@@ -0,0 +1,388 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! per-type slab pools for the values behind non-dispatchable handles, so creating and
+//! destroying views, samplers and descriptor sets doesn't go through the system allocator.
+//!
+//! Each thread keeps its own list of free slots, so allocating and freeing usually doesn't
+//! touch any shared state. Slots freed on a thread other than the one that allocated them just
+//! go into the freeing thread's list. When a thread's list gets too long, or the thread exits,
+//! a batch of its free slots is moved to the type's shared list, which is a lock-free stack of
+//! batches that's only ever popped all at once, so it doesn't suffer from the ABA problem.
+//!
+//! Slabs are never returned to the system allocator.
+
+use std::cell::Cell;
+use std::mem::{self, MaybeUninit};
+use std::ptr::{self, null_mut, NonNull};
+use std::sync::atomic::{AtomicPtr, Ordering};
+
+/// the size of the slabs allocated for types that are smaller than a slot per slab
+const SLAB_SIZE: usize = 16 << 10; // 16KiB
+const MIN_SLOTS_PER_SLAB: usize = 16;
+/// the number of slots moved at once from a thread's list to the shared list
+const BATCH_SIZE: usize = 128;
+
+/// `value` must be first, so a pointer to `value` is a pointer to the slot
+#[repr(C)]
+struct Slot<T> {
+    value: MaybeUninit<T>,
+    /// the next slot in the same batch; only used while the slot is free
+    next: *mut Slot<T>,
+    /// the first slot of the next batch in the shared list; only used in the first slot of a
+    /// batch
+    next_batch: *mut Slot<T>,
+}
+
+/// the shared part of the pool for one type
+pub struct SlabPool<T> {
+    /// stack of batches of free slots
+    batches: AtomicPtr<Slot<T>>,
+}
+
+// slots on the free lists don't hold values, so they can be moved between threads
+unsafe impl<T> Sync for SlabPool<T> {}
+
+impl<T> SlabPool<T> {
+    pub const fn new() -> Self {
+        Self {
+            batches: AtomicPtr::new(null_mut()),
+        }
+    }
+    /// `first` through `last` must be free batches, linked through `next_batch`
+    unsafe fn push_batches(&self, first: *mut Slot<T>, last: *mut Slot<T>) {
+        let mut head = self.batches.load(Ordering::Relaxed);
+        loop {
+            (*last).next_batch = head;
+            match self.batches.compare_exchange_weak(
+                head,
+                first,
+                Ordering::Release,
+                Ordering::Relaxed,
+            ) {
+                Ok(_) => break,
+                Err(new_head) => head = new_head,
+            }
+        }
+    }
+    /// pops one batch. All the batches are taken then the rest are pushed back, since popping
+    /// just one can't be done safely without a lock.
+    fn pop_batch(&self) -> *mut Slot<T> {
+        let first = self.batches.swap(null_mut(), Ordering::Acquire);
+        unsafe {
+            if !first.is_null() && !(*first).next_batch.is_null() {
+                let rest = (*first).next_batch;
+                let mut last = rest;
+                while !(*last).next_batch.is_null() {
+                    last = (*last).next_batch;
+                }
+                self.push_batches(rest, last);
+            }
+        }
+        first
+    }
+}
+
+/// one thread's free slots for one type
+pub struct ThreadSlabCache<T: 'static> {
+    pool: &'static SlabPool<T>,
+    first: Cell<*mut Slot<T>>,
+    free_slot_count: Cell<usize>,
+}
+
+impl<T> ThreadSlabCache<T> {
+    pub fn new(pool: &'static SlabPool<T>) -> Self {
+        Self {
+            pool,
+            first: Cell::new(null_mut()),
+            free_slot_count: Cell::new(0),
+        }
+    }
+    unsafe fn push(&self, slot: *mut Slot<T>) {
+        (*slot).next = self.first.get();
+        self.first.set(slot);
+        self.free_slot_count.set(self.free_slot_count.get() + 1);
+        if self.free_slot_count.get() >= BATCH_SIZE * 2 {
+            // keep some free slots, so alternating between allocating and freeing doesn't move
+            // a batch back and forth
+            let batch = self.first.get();
+            let mut last = batch;
+            for _ in 1..BATCH_SIZE {
+                last = (*last).next;
+            }
+            self.first.set((*last).next);
+            (*last).next = null_mut();
+            self.free_slot_count
+                .set(self.free_slot_count.get() - BATCH_SIZE);
+            self.pool.push_batches(batch, batch);
+        }
+    }
+    fn pop(&self) -> *mut Slot<T> {
+        if self.first.get().is_null() {
+            let batch = self.pool.pop_batch();
+            if batch.is_null() {
+                let (first, slot_count) = allocate_slab();
+                self.first.set(first);
+                self.free_slot_count.set(slot_count);
+            } else {
+                // batches pushed while threads exit can be shorter, the count is only used to
+                // decide when to give a batch back, so it doesn't need to be exact
+                self.first.set(batch);
+                self.free_slot_count.set(BATCH_SIZE);
+            }
+        }
+        let slot = self.first.get();
+        unsafe {
+            self.first.set((*slot).next);
+        }
+        self.free_slot_count
+            .set(self.free_slot_count.get().saturating_sub(1));
+        slot
+    }
+}
+
+impl<T> Drop for ThreadSlabCache<T> {
+    fn drop(&mut self) {
+        let first = self.first.replace(null_mut());
+        if !first.is_null() {
+            unsafe { self.pool.push_batches(first, first) }
+        }
+    }
+}
+
+/// returns the first slot of the new slab, with all the slots linked through `next`, and the
+/// slot count
+fn allocate_slab<T>() -> (*mut Slot<T>, usize) {
+    let slot_count = (SLAB_SIZE / mem::size_of::<Slot<T>>()).max(MIN_SLOTS_PER_SLAB);
+    let slots: &mut [Slot<T>] = Box::leak(
+        (0..slot_count)
+            .map(|_| Slot {
+                value: MaybeUninit::uninit(),
+                next: null_mut(),
+                next_batch: null_mut(),
+            })
+            .collect::<Vec<_>>()
+            .into_boxed_slice(),
+    );
+    for index in 1..slot_count {
+        slots[index - 1].next = &mut slots[index];
+    }
+    (&mut slots[0], slot_count)
+}
+
+/// a type with its own `SlabPool`, implemented using `impl_slab_allocated!`
+pub trait SlabAllocated: Sized + 'static {
+    fn pool() -> &'static SlabPool<Self>;
+    /// returns `None` if the current thread's cache was already destroyed, which can happen
+    /// while the thread is exiting
+    fn with_thread_cache<R, F: FnOnce(&ThreadSlabCache<Self>) -> R>(f: F) -> Option<R>;
+}
+
+macro_rules! impl_slab_allocated {
+    ($($value:ty),* $(,)?) => {
+        $(
+            impl $crate::slab::SlabAllocated for $value {
+                fn pool() -> &'static $crate::slab::SlabPool<$value> {
+                    static POOL: $crate::slab::SlabPool<$value> = $crate::slab::SlabPool::new();
+                    &POOL
+                }
+                fn with_thread_cache<
+                    R,
+                    F: FnOnce(&$crate::slab::ThreadSlabCache<$value>) -> R,
+                >(
+                    f: F,
+                ) -> Option<R> {
+                    thread_local! {
+                        static CACHE: $crate::slab::ThreadSlabCache<$value> =
+                            $crate::slab::ThreadSlabCache::new(
+                                <$value as $crate::slab::SlabAllocated>::pool(),
+                            );
+                    }
+                    CACHE.try_with(f).ok()
+                }
+            }
+        )*
+    };
+}
+
+pub fn allocate<T: SlabAllocated>(value: T) -> NonNull<T> {
+    let slot = T::with_thread_cache(ThreadSlabCache::pop).unwrap_or_else(|| {
+        // the thread is exiting, so give the rest of a new slab to the shared list
+        let (first, _) = allocate_slab::<T>();
+        unsafe {
+            let rest = (*first).next;
+            if !rest.is_null() {
+                T::pool().push_batches(rest, rest);
+            }
+        }
+        first
+    });
+    unsafe {
+        ptr::write((*slot).value.as_mut_ptr(), value);
+        NonNull::new_unchecked(slot as *mut T)
+    }
+}
+
+/// # Safety
+///
+/// `value` must have been returned by `allocate` and not freed since
+pub unsafe fn free<T: SlabAllocated>(value: NonNull<T>) {
+    let slot = value.as_ptr() as *mut Slot<T>;
+    ptr::drop_in_place(value.as_ptr());
+    if T::with_thread_cache(|cache| cache.push(slot)).is_none() {
+        (*slot).next = null_mut();
+        T::pool().push_batches(slot, slot);
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::sync::atomic::{AtomicBool, AtomicUsize};
+    use std::thread;
+
+    struct Value(usize);
+
+    /// big enough that a slab only has `MIN_SLOTS_PER_SLAB` slots
+    struct LargeValue([usize; 1024]);
+
+    static DROPPED_COUNT: AtomicUsize = AtomicUsize::new(0);
+
+    struct DropCounter;
+
+    impl Drop for DropCounter {
+        fn drop(&mut self) {
+            DROPPED_COUNT.fetch_add(1, Ordering::Relaxed);
+        }
+    }
+
+    /// every test uses its own types, so the tests don't share pools
+    struct SameThreadValue(Value);
+    struct OtherThreadValue(DropCounter);
+    struct SpilledValue(LargeValue);
+    struct ThreadExitValue(Value);
+
+    impl_slab_allocated!(
+        SameThreadValue,
+        OtherThreadValue,
+        SpilledValue,
+        ThreadExitValue,
+    );
+
+    /// the number of slots in the batch starting at `batch`
+    unsafe fn batch_len<T>(batch: *mut Slot<T>) -> usize {
+        let mut len = 0;
+        let mut slot = batch;
+        while !slot.is_null() {
+            len += 1;
+            slot = (*slot).next;
+        }
+        len
+    }
+
+    #[test]
+    fn test_same_thread() {
+        let values: Vec<_> = (0..1000)
+            .map(|index| allocate(SameThreadValue(Value(index))))
+            .collect();
+        for (index, value) in values.iter().enumerate() {
+            assert_eq!(unsafe { (value.as_ref().0).0 }, index);
+        }
+        let mut addresses: Vec<_> = values.iter().map(|value| value.as_ptr()).collect();
+        addresses.sort();
+        addresses.dedup();
+        assert_eq!(addresses.len(), values.len());
+        for &value in &values {
+            unsafe { free(value) };
+        }
+        let value = allocate(SameThreadValue(Value(1000)));
+        assert!(values.contains(&value));
+        unsafe { free(value) };
+    }
+
+    #[test]
+    fn test_free_on_other_thread() {
+        let value = allocate(OtherThreadValue(DropCounter));
+        let address = value.as_ptr() as usize;
+        thread::spawn(move || unsafe {
+            free(NonNull::new_unchecked(address as *mut OtherThreadValue));
+        })
+        .join()
+        .unwrap();
+        assert_eq!(DROPPED_COUNT.load(Ordering::Relaxed), 1);
+        // the freeing thread's list only had that slot, and was given to the shared list when
+        // the thread exited
+        let batch = OtherThreadValue::pool().pop_batch();
+        assert_eq!(batch as usize, address);
+        assert_eq!(unsafe { batch_len(batch) }, 1);
+    }
+
+    #[test]
+    fn test_batch_spill() {
+        thread::spawn(|| {
+            let pool = SpilledValue::pool();
+            let values: Vec<_> = (0..BATCH_SIZE * 2)
+                .map(|index| allocate(SpilledValue(LargeValue([index; 1024]))))
+                .collect();
+            for (index, value) in values.iter().enumerate() {
+                assert_eq!(unsafe { (value.as_ref().0).0[1023] }, index);
+            }
+            let get_free_slot_count =
+                || SpilledValue::with_thread_cache(|cache| cache.free_slot_count.get()).unwrap();
+            assert_eq!(get_free_slot_count(), 0);
+            for &value in &values[1..] {
+                unsafe { free(value) };
+            }
+            assert_eq!(get_free_slot_count(), BATCH_SIZE * 2 - 1);
+            assert!(pool.batches.load(Ordering::Relaxed).is_null());
+            unsafe { free(values[0]) };
+            assert_eq!(get_free_slot_count(), BATCH_SIZE);
+            let batch = pool.pop_batch();
+            assert!(!batch.is_null());
+            unsafe {
+                assert!((*batch).next_batch.is_null());
+                assert_eq!(batch_len(batch), BATCH_SIZE);
+                // the most recently freed slots are the ones given away
+                assert_eq!(batch as usize, values[0].as_ptr() as usize);
+                pool.push_batches(batch, batch);
+            }
+        })
+        .join()
+        .unwrap();
+    }
+
+    #[test]
+    fn test_allocate_in_thread_exit() {
+        static CACHE_DESTROYED: AtomicBool = AtomicBool::new(false);
+        static READ_VALUE: AtomicUsize = AtomicUsize::new(0);
+        struct AllocateOnDrop;
+        impl Drop for AllocateOnDrop {
+            fn drop(&mut self) {
+                let cache_destroyed = ThreadExitValue::with_thread_cache(|_| ()).is_none();
+                CACHE_DESTROYED.store(cache_destroyed, Ordering::Relaxed);
+                let value = allocate(ThreadExitValue(Value(5)));
+                READ_VALUE.store(unsafe { (value.as_ref().0).0 }, Ordering::Relaxed);
+                unsafe { free(value) };
+            }
+        }
+        thread_local! {
+            static ALLOCATE_ON_DROP: AllocateOnDrop = AllocateOnDrop;
+        }
+        thread::spawn(|| {
+            // registered first, so it's destroyed after the thread's slab cache
+            ALLOCATE_ON_DROP.with(|_| ());
+            let value = allocate(ThreadExitValue(Value(0)));
+            unsafe { free(value) };
+        })
+        .join()
+        .unwrap();
+        assert_eq!(READ_VALUE.load(Ordering::Relaxed), 5);
+        if CACHE_DESTROYED.load(Ordering::Relaxed) {
+            // the rest of the slab allocated for it and the freed slot went to the shared list
+            assert!(!ThreadExitValue::pool()
+                .batches
+                .load(Ordering::Relaxed)
+                .is_null());
+        }
+    }
+}
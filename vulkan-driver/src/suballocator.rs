@@ -0,0 +1,347 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! buddy allocator that serves device memory out of large regions, so small allocations don't
+//! each need their own call into the system allocator
+
+use crate::device_memory::{DeviceMemoryAllocation, DeviceMemoryLayout};
+use std::collections::BTreeSet;
+use std::env;
+use std::fmt;
+use std::ptr::NonNull;
+use std::sync::{Arc, Mutex};
+
+/// set to a nonzero value to ask the kernel to back regions with transparent huge pages
+pub const HUGE_PAGES_ENV_VAR: &str = "KAZAN_DEVICE_MEMORY_HUGE_PAGES";
+
+/// regions are also aligned to their size, so every block is aligned to its size
+pub const REGION_SIZE: usize = 64 << 20; // 64MiB
+const MIN_BLOCK_SIZE: usize = 256;
+const MAX_ORDER: usize = (REGION_SIZE / MIN_BLOCK_SIZE).trailing_zeros() as usize;
+
+fn block_size(order: usize) -> usize {
+    MIN_BLOCK_SIZE << order
+}
+
+fn get_order(layout: DeviceMemoryLayout) -> Option<usize> {
+    let size = layout
+        .size
+        .max(layout.alignment)
+        .max(MIN_BLOCK_SIZE)
+        .checked_next_power_of_two()?;
+    let order = (size / MIN_BLOCK_SIZE).trailing_zeros() as usize;
+    if order <= MAX_ORDER {
+        Some(order)
+    } else {
+        None
+    }
+}
+
+fn use_huge_pages() -> bool {
+    match env::var_os(HUGE_PAGES_ENV_VAR) {
+        Some(value) => !value.is_empty() && value != "0",
+        None => false,
+    }
+}
+
+/// `REGION_SIZE` bytes aligned to `REGION_SIZE`
+struct RegionMemory(NonNull<u8>);
+
+impl RegionMemory {
+    #[cfg(unix)]
+    fn new(huge_pages: bool) -> Option<Self> {
+        use std::ptr::null_mut;
+        unsafe {
+            // over-allocate then trim, since mmap only guarantees page alignment
+            let mapping_size = REGION_SIZE * 2;
+            let mapping = libc::mmap(
+                null_mut(),
+                mapping_size,
+                libc::PROT_READ | libc::PROT_WRITE,
+                libc::MAP_PRIVATE | libc::MAP_ANONYMOUS | libc::MAP_NORESERVE,
+                -1,
+                0,
+            );
+            if mapping == libc::MAP_FAILED {
+                return None;
+            }
+            let mapping = mapping as usize;
+            let start = (mapping + REGION_SIZE - 1) & !(REGION_SIZE - 1);
+            let end = start + REGION_SIZE;
+            if start != mapping {
+                libc::munmap(mapping as *mut _, start - mapping);
+            }
+            if end != mapping + mapping_size {
+                libc::munmap(end as *mut _, mapping + mapping_size - end);
+            }
+            #[cfg(target_os = "linux")]
+            {
+                if huge_pages {
+                    // only a hint, so errors are ignored
+                    libc::madvise(start as *mut _, REGION_SIZE, libc::MADV_HUGEPAGE);
+                }
+            }
+            #[cfg(not(target_os = "linux"))]
+            let _ = huge_pages;
+            Some(RegionMemory(NonNull::new_unchecked(start as *mut u8)))
+        }
+    }
+    #[cfg(not(unix))]
+    fn new(_huge_pages: bool) -> Option<Self> {
+        unsafe { NonNull::new(std::alloc::alloc(Self::layout())).map(RegionMemory) }
+    }
+    #[cfg(not(unix))]
+    fn layout() -> std::alloc::Layout {
+        std::alloc::Layout::from_size_align(REGION_SIZE, REGION_SIZE).unwrap()
+    }
+}
+
+impl Drop for RegionMemory {
+    #[cfg(unix)]
+    fn drop(&mut self) {
+        unsafe {
+            libc::munmap(self.0.as_ptr() as *mut _, REGION_SIZE);
+        }
+    }
+    #[cfg(not(unix))]
+    fn drop(&mut self) {
+        unsafe {
+            std::alloc::dealloc(self.0.as_ptr(), Self::layout());
+        }
+    }
+}
+
+struct Region {
+    memory: RegionMemory,
+    /// offsets of the free blocks of each order
+    free_blocks: Vec<BTreeSet<usize>>,
+    free_size: usize,
+}
+
+impl Region {
+    fn new(huge_pages: bool) -> Option<Self> {
+        let mut free_blocks = vec![BTreeSet::new(); MAX_ORDER + 1];
+        free_blocks[MAX_ORDER].insert(0);
+        Some(Region {
+            memory: RegionMemory::new(huge_pages)?,
+            free_blocks,
+            free_size: REGION_SIZE,
+        })
+    }
+    fn contains(&self, memory: NonNull<u8>) -> bool {
+        let start = self.memory.0.as_ptr() as usize;
+        (start..start + REGION_SIZE).contains(&(memory.as_ptr() as usize))
+    }
+    fn allocate(&mut self, order: usize) -> Option<NonNull<u8>> {
+        let free_order = (order..=MAX_ORDER).find(|&v| !self.free_blocks[v].is_empty())?;
+        // lowest address first, to keep the allocations packed together
+        let offset = *self.free_blocks[free_order].iter().next().unwrap();
+        self.free_blocks[free_order].remove(&offset);
+        for split_order in (order..free_order).rev() {
+            self.free_blocks[split_order].insert(offset + block_size(split_order));
+        }
+        self.free_size -= block_size(order);
+        unsafe { Some(NonNull::new_unchecked(self.memory.0.as_ptr().add(offset))) }
+    }
+    fn free(&mut self, memory: NonNull<u8>, mut order: usize) {
+        self.free_size += block_size(order);
+        let mut offset = memory.as_ptr() as usize - self.memory.0.as_ptr() as usize;
+        while order < MAX_ORDER && self.free_blocks[order].remove(&(offset ^ block_size(order))) {
+            offset &= !block_size(order);
+            order += 1;
+        }
+        self.free_blocks[order].insert(offset);
+    }
+    fn is_empty(&self) -> bool {
+        self.free_size == REGION_SIZE
+    }
+}
+
+// the regions are only accessed with the lock held
+unsafe impl Send for Region {}
+
+pub struct Suballocator {
+    regions: Mutex<Vec<Region>>,
+    huge_pages: bool,
+}
+
+impl fmt::Debug for Suballocator {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_struct("Suballocator")
+            .field("region_count", &self.regions.lock().unwrap().len())
+            .field("huge_pages", &self.huge_pages)
+            .finish()
+    }
+}
+
+impl Suballocator {
+    pub fn new() -> Self {
+        Self {
+            regions: Mutex::new(Vec::new()),
+            huge_pages: use_huge_pages(),
+        }
+    }
+    /// returns `None` if `layout` doesn't fit in a region or there wasn't enough memory
+    pub fn allocate(this: &Arc<Self>, layout: DeviceMemoryLayout) -> Option<Suballocation> {
+        let order = get_order(layout)?;
+        let mut regions = this.regions.lock().unwrap();
+        let mut memory = regions
+            .iter_mut()
+            .filter_map(|region| region.allocate(order))
+            .next();
+        if memory.is_none() {
+            let mut region = Region::new(this.huge_pages)?;
+            memory = region.allocate(order);
+            regions.push(region);
+        }
+        Some(Suballocation {
+            suballocator: this.clone(),
+            memory: memory.unwrap(),
+            order,
+            layout,
+        })
+    }
+    fn free(&self, memory: NonNull<u8>, order: usize) {
+        let mut regions = self.regions.lock().unwrap();
+        let region_index = regions
+            .iter()
+            .position(|region| region.contains(memory))
+            .unwrap();
+        regions[region_index].free(memory, order);
+        // keep one empty region around, so allocating and freeing in a loop doesn't keep
+        // mapping and unmapping regions
+        if regions[region_index].is_empty()
+            && regions
+                .iter()
+                .enumerate()
+                .any(|(index, region)| index != region_index && region.is_empty())
+        {
+            regions.swap_remove(region_index);
+        }
+    }
+}
+
+#[derive(Debug)]
+pub struct Suballocation {
+    suballocator: Arc<Suballocator>,
+    memory: NonNull<u8>,
+    order: usize,
+    layout: DeviceMemoryLayout,
+}
+
+unsafe impl Send for Suballocation {}
+
+unsafe impl Sync for Suballocation {}
+
+impl DeviceMemoryAllocation for Suballocation {
+    unsafe fn get(&self) -> NonNull<u8> {
+        self.memory
+    }
+    fn layout(&self) -> DeviceMemoryLayout {
+        self.layout
+    }
+}
+
+impl Drop for Suballocation {
+    fn drop(&mut self) {
+        self.suballocator.free(self.memory, self.order);
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn layout(size: usize, alignment: usize) -> DeviceMemoryLayout {
+        DeviceMemoryLayout::calculate(size, alignment)
+    }
+
+    fn offset(region: &Region, memory: NonNull<u8>) -> usize {
+        memory.as_ptr() as usize - region.memory.0.as_ptr() as usize
+    }
+
+    fn free_offsets(region: &Region, order: usize) -> Vec<usize> {
+        region.free_blocks[order].iter().cloned().collect()
+    }
+
+    #[test]
+    fn test_get_order() {
+        assert_eq!(get_order(layout(1, 1)), Some(0));
+        assert_eq!(get_order(layout(MIN_BLOCK_SIZE, 1)), Some(0));
+        assert_eq!(get_order(layout(MIN_BLOCK_SIZE + 1, 1)), Some(1));
+        assert_eq!(get_order(layout(1, 4096)), Some(4));
+        assert_eq!(get_order(layout(REGION_SIZE, 1)), Some(MAX_ORDER));
+        assert_eq!(get_order(layout(REGION_SIZE + 1, 1)), None);
+    }
+
+    #[test]
+    fn test_split() {
+        let mut region = Region::new(false).unwrap();
+        let memory = region.allocate(0).unwrap();
+        assert_eq!(offset(&region, memory), 0);
+        // the region is split in half down to the smallest block, keeping the upper halves
+        for order in 0..MAX_ORDER {
+            assert_eq!(free_offsets(&region, order), [block_size(order)]);
+        }
+        assert!(region.free_blocks[MAX_ORDER].is_empty());
+        assert_eq!(region.free_size, REGION_SIZE - MIN_BLOCK_SIZE);
+        let memory = region.allocate(0).unwrap();
+        assert_eq!(offset(&region, memory), MIN_BLOCK_SIZE);
+        assert!(region.free_blocks[0].is_empty());
+        let memory = region.allocate(2).unwrap();
+        assert_eq!(offset(&region, memory), block_size(2));
+    }
+
+    #[test]
+    fn test_coalesce() {
+        let mut region = Region::new(false).unwrap();
+        let first = region.allocate(0).unwrap();
+        let second = region.allocate(0).unwrap();
+        let third = region.allocate(1).unwrap();
+        region.free(second, 0);
+        // the buddy of `second` is still allocated
+        assert_eq!(free_offsets(&region, 0), [MIN_BLOCK_SIZE]);
+        region.free(first, 0);
+        assert!(region.free_blocks[0].is_empty());
+        assert_eq!(free_offsets(&region, 1), [0]);
+        assert!(!region.is_empty());
+        region.free(third, 1);
+        for order in 0..MAX_ORDER {
+            assert!(region.free_blocks[order].is_empty());
+        }
+        assert_eq!(free_offsets(&region, MAX_ORDER), [0]);
+        assert!(region.is_empty());
+    }
+
+    #[test]
+    fn test_alignment() {
+        let suballocator = Arc::new(Suballocator::new());
+        let _small = Suballocator::allocate(&suballocator, layout(1, 1)).unwrap();
+        for &alignment in &[1, 16, 256, 4096, 1 << 16, 1 << 20] {
+            let allocation = Suballocator::allocate(&suballocator, layout(100, alignment)).unwrap();
+            let address = unsafe { allocation.get() }.as_ptr() as usize;
+            assert_eq!(address % alignment, 0, "alignment: {}", alignment);
+            assert_eq!(allocation.size(), layout(100, alignment).size);
+        }
+    }
+
+    #[test]
+    fn test_out_of_space() {
+        let mut region = Region::new(false).unwrap();
+        let whole = region.allocate(MAX_ORDER).unwrap();
+        assert_eq!(offset(&region, whole), 0);
+        assert!(region.allocate(0).is_none());
+        region.free(whole, MAX_ORDER);
+        assert!(region.allocate(0).is_some());
+        let suballocator = Arc::new(Suballocator::new());
+        assert!(Suballocator::allocate(&suballocator, layout(REGION_SIZE + 1, 1)).is_none());
+        // a full region makes the next allocation use a new region
+        let first = Suballocator::allocate(&suballocator, layout(REGION_SIZE, 1)).unwrap();
+        let second = Suballocator::allocate(&suballocator, layout(1, 1)).unwrap();
+        assert_eq!(suballocator.regions.lock().unwrap().len(), 2);
+        // only one empty region is kept
+        drop(first);
+        drop(second);
+        assert_eq!(suballocator.regions.lock().unwrap().len(), 1);
+    }
+}
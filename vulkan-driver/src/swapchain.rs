@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 // See Notices.txt for copyright information
 use crate::api;
+use crate::handle::SharedHandle;
+use crate::headless_swapchain::HeadlessSurfaceImplementation;
 #[cfg(target_os = "linux")]
 use crate::xcb_swapchain::XcbSurfaceImplementation;
 #[cfg(target_os = "linux")]
@@ -8,9 +10,32 @@ use crate::xlib_swapchain::XlibSurfaceImplementation;
 use enum_map::Enum;
 use std::any::Any;
 use std::borrow::Cow;
+use std::env;
 use std::error::Error;
 use std::fmt::{self, Debug};
 use std::ptr::NonNull;
+use std::sync::atomic::{AtomicBool, AtomicUsize, Ordering};
+use std::sync::{Arc, Mutex};
+use std::thread;
+use std::time::Duration;
+
+pub const MAX_SWAPCHAIN_IMAGE_COUNT: u32 = 16;
+
+/// the number of images to create in each swapchain, if the application asks for fewer
+pub const SWAPCHAIN_IMAGE_COUNT_ENV_VAR: &str = "KAZAN_SWAPCHAIN_IMAGE_COUNT";
+
+/// enough for the application to render a frame while one is shown and another is being
+/// presented
+const DEFAULT_SWAPCHAIN_IMAGE_COUNT: u32 = 3;
+
+/// returns how many images to create when the application asks for `min_image_count`
+pub fn get_swapchain_image_count(min_image_count: u32, max_image_count: u32) -> u32 {
+    let image_count = env::var(SWAPCHAIN_IMAGE_COUNT_ENV_VAR)
+        .ok()
+        .and_then(|value| value.parse().ok())
+        .unwrap_or(DEFAULT_SWAPCHAIN_IMAGE_COUNT);
+    image_count.max(min_image_count).min(max_image_count)
+}
 
 #[derive(Copy, Clone, Eq, PartialEq, Hash, Debug, Enum)]
 #[allow(non_camel_case_types)]
@@ -23,6 +48,7 @@ pub enum SurfacePlatform {
     VK_ICD_WSI_PLATFORM_MACOS,
     VK_ICD_WSI_PLATFORM_IOS,
     VK_ICD_WSI_PLATFORM_DISPLAY,
+    VK_ICD_WSI_PLATFORM_HEADLESS,
 }
 
 #[derive(Debug)]
@@ -47,19 +73,27 @@ impl SurfacePlatform {
             api::VK_ICD_WSI_PLATFORM_MACOS => Ok(SurfacePlatform::VK_ICD_WSI_PLATFORM_MACOS),
             api::VK_ICD_WSI_PLATFORM_IOS => Ok(SurfacePlatform::VK_ICD_WSI_PLATFORM_IOS),
             api::VK_ICD_WSI_PLATFORM_DISPLAY => Ok(SurfacePlatform::VK_ICD_WSI_PLATFORM_DISPLAY),
+            api::VK_ICD_WSI_PLATFORM_HEADLESS => Ok(SurfacePlatform::VK_ICD_WSI_PLATFORM_HEADLESS),
             platform => Err(UnknownSurfacePlatform(platform)),
         }
     }
     pub fn get_surface_implementation(self) -> Cow<'static, dyn SurfaceImplementation> {
+        const HEADLESS_SURFACE_IMPLEMENTATION: HeadlessSurfaceImplementation =
+            HeadlessSurfaceImplementation;
         #[cfg(target_os = "linux")]
         const XCB_SURFACE_IMPLEMENTATION: XcbSurfaceImplementation = XcbSurfaceImplementation;
         #[cfg(target_os = "linux")]
         const XLIB_SURFACE_IMPLEMENTATION: XlibSurfaceImplementation = XlibSurfaceImplementation;
         match self {
+            SurfacePlatform::VK_ICD_WSI_PLATFORM_HEADLESS => {
+                Cow::Borrowed(&HEADLESS_SURFACE_IMPLEMENTATION)
+            }
             #[cfg(target_os = "linux")]
             SurfacePlatform::VK_ICD_WSI_PLATFORM_XCB => Cow::Borrowed(&XCB_SURFACE_IMPLEMENTATION),
             #[cfg(target_os = "linux")]
-            SurfacePlatform::VK_ICD_WSI_PLATFORM_XLIB => Cow::Borrowed(&XLIB_SURFACE_IMPLEMENTATION),
+            SurfacePlatform::VK_ICD_WSI_PLATFORM_XLIB => {
+                Cow::Borrowed(&XLIB_SURFACE_IMPLEMENTATION)
+            }
             _ => Cow::Owned(FallbackSurfaceImplementation(self).duplicate()),
         }
     }
@@ -76,11 +110,188 @@ impl From<SurfacePlatform> for api::VkIcdWsiPlatform {
             SurfacePlatform::VK_ICD_WSI_PLATFORM_MACOS => api::VK_ICD_WSI_PLATFORM_MACOS,
             SurfacePlatform::VK_ICD_WSI_PLATFORM_IOS => api::VK_ICD_WSI_PLATFORM_IOS,
             SurfacePlatform::VK_ICD_WSI_PLATFORM_DISPLAY => api::VK_ICD_WSI_PLATFORM_DISPLAY,
+            SurfacePlatform::VK_ICD_WSI_PLATFORM_HEADLESS => api::VK_ICD_WSI_PLATFORM_HEADLESS,
+        }
+    }
+}
+
+pub trait Swapchain: Any + Sync + Send + Debug {
+    /// the images are owned by the swapchain
+    unsafe fn get_images(&self) -> Vec<api::VkImage>;
+    /// returns `VK_NOT_READY` or `VK_TIMEOUT` if none of the images can be acquired
+    unsafe fn acquire_next_image(&self, timeout: u64) -> Result<u32, api::VkResult>;
+    /// called on the queue's thread once all the rendering to the image is done. The image
+    /// must have been acquired.
+    unsafe fn present(&self, image_index: u32);
+    /// errors from presenting earlier images
+    fn get_status(&self) -> Result<(), api::VkResult>;
+}
+
+/// an image that is presented once the queue finishes the work submitted before it
+pub struct QueuedPresent {
+    pub swapchain: SharedHandle<api::VkSwapchainKHR>,
+    pub image_index: u32,
+}
+
+// the application has to keep the swapchain alive until the present is done
+unsafe impl Send for QueuedPresent {}
+
+impl QueuedPresent {
+    pub unsafe fn present(self) {
+        self.swapchain.present(self.image_index)
+    }
+}
+
+/// the part of a swapchain the present thread uses
+pub trait SwapchainPresenter: Sync + Send + 'static {
+    unsafe fn present(&self, image_index: u32) -> Result<(), api::VkResult>;
+    /// called while there are no images waiting to be presented; returns whether it should be
+    /// called again soon, rather than only after the next image is queued
+    unsafe fn poll(&self) -> Result<bool, api::VkResult>;
+}
+
+/// single-producer single-consumer queue of image indices
+struct ImageRing {
+    slots: Box<[AtomicUsize]>,
+    /// the count of image indices ever popped
+    head: AtomicUsize,
+    /// the count of image indices ever pushed
+    tail: AtomicUsize,
+}
+
+impl ImageRing {
+    fn new(capacity: usize) -> Self {
+        Self {
+            slots: (0..capacity).map(|_| AtomicUsize::new(0)).collect(),
+            head: AtomicUsize::new(0),
+            tail: AtomicUsize::new(0),
+        }
+    }
+    fn push(&self, image_index: u32) -> bool {
+        let tail = self.tail.load(Ordering::Relaxed);
+        if tail.wrapping_sub(self.head.load(Ordering::Acquire)) == self.slots.len() {
+            return false;
+        }
+        self.slots[tail % self.slots.len()].store(image_index as usize, Ordering::Relaxed);
+        self.tail.store(tail.wrapping_add(1), Ordering::Release);
+        true
+    }
+    fn pop(&self) -> Option<u32> {
+        let head = self.head.load(Ordering::Relaxed);
+        if head == self.tail.load(Ordering::Acquire) {
+            return None;
+        }
+        let image_index = self.slots[head % self.slots.len()].load(Ordering::Relaxed) as u32;
+        self.head.store(head.wrapping_add(1), Ordering::Release);
+        Some(image_index)
+    }
+}
+
+/// how long to wait between calls to `SwapchainPresenter::poll` when it asks to be called again
+/// soon
+const POLL_INTERVAL_MILLIS: u64 = 1;
+
+struct PresentThreadShared {
+    ready_images: ImageRing,
+    /// the first error from presenting
+    error: Mutex<Option<api::VkResult>>,
+    exiting: AtomicBool,
+}
+
+/// presents images on a thread of its own, so the queue can go on to render the next frame
+/// while the window system is busy with the previous one
+pub struct PresentThread {
+    shared: Arc<PresentThreadShared>,
+    thread: Option<thread::JoinHandle<()>>,
+}
+
+impl fmt::Debug for PresentThread {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_struct("PresentThread").finish()
+    }
+}
+
+impl PresentThread {
+    /// `image_count` is the most images that can be waiting to be presented at once
+    pub fn new<P: SwapchainPresenter>(presenter: Arc<P>, image_count: u32) -> Self {
+        let shared = Arc::new(PresentThreadShared {
+            ready_images: ImageRing::new(image_count as usize),
+            error: Mutex::new(None),
+            exiting: AtomicBool::new(false),
+        });
+        let thread = {
+            let shared = shared.clone();
+            thread::Builder::new()
+                .name("kazan present".into())
+                .spawn(move || unsafe { shared.thread_main(&*presenter) })
+                .unwrap()
+        };
+        Self {
+            shared,
+            thread: Some(thread),
+        }
+    }
+    /// must only be called from one thread at a time
+    pub fn queue_present(&self, image_index: u32) {
+        assert!(
+            self.shared.ready_images.push(image_index),
+            "presenting more images than the swapchain has"
+        );
+        self.thread.as_ref().unwrap().thread().unpark();
+    }
+    pub fn get_status(&self) -> Result<(), api::VkResult> {
+        match *self.shared.error.lock().unwrap() {
+            Some(error) => Err(error),
+            None => Ok(()),
+        }
+    }
+}
+
+impl PresentThreadShared {
+    unsafe fn thread_main(&self, presenter: &dyn SwapchainPresenter) {
+        let mut failed = false;
+        loop {
+            let result = if let Some(image_index) = self.ready_images.pop() {
+                kazan_trace::trace_scope!("SwapchainPresenter::present");
+                presenter.present(image_index)
+            } else if self.exiting.load(Ordering::Acquire) {
+                return;
+            } else if failed {
+                // the application has to recreate the swapchain, so there is nothing to poll
+                // for anymore
+                thread::park();
+                Ok(())
+            } else {
+                match presenter.poll() {
+                    Ok(true) => {
+                        thread::park_timeout(Duration::from_millis(POLL_INTERVAL_MILLIS));
+                        Ok(())
+                    }
+                    Ok(false) => {
+                        thread::park();
+                        Ok(())
+                    }
+                    Err(error) => Err(error),
+                }
+            };
+            if let Err(error) = result {
+                failed = true;
+                self.error.lock().unwrap().get_or_insert(error);
+            }
         }
     }
 }
 
-pub trait Swapchain: Any + Sync + Send + Debug {}
+impl Drop for PresentThread {
+    /// presents the images that are still queued first
+    fn drop(&mut self) {
+        self.shared.exiting.store(true, Ordering::Release);
+        if let Some(thread) = self.thread.take() {
+            thread.thread().unpark();
+            thread.join().unwrap();
+        }
+    }
+}
 
 pub trait SurfaceImplementation: Any + Sync + Send + Debug {
     fn get_platform(&self) -> SurfacePlatform;
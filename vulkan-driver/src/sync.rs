@@ -0,0 +1,285 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! fences, semaphores and events.
+//!
+//! Each one is just atomics: waiting blocks in the kernel on a futex word rather than holding a
+//! lock, and signaling only makes a system call when something is blocked. A futex can only
+//! watch one address, so waits for any one of several objects block on `ANY_WAIT_QUEUE`
+//! instead, which every signal notifies too.
+
+use crate::api;
+use std::sync::atomic::{AtomicBool, AtomicU32, AtomicU64, Ordering};
+use std::time::{Duration, Instant};
+
+#[cfg(target_os = "linux")]
+mod futex {
+    use libc;
+    use std::ptr::null;
+    use std::sync::atomic::AtomicU32;
+    use std::time::Duration;
+
+    /// blocks while `word` is `expected`, for at most `timeout`. Can return early for no
+    /// reason.
+    pub fn wait(word: &AtomicU32, expected: u32, timeout: Option<Duration>) {
+        let timeout = timeout.map(|timeout| libc::timespec {
+            tv_sec: timeout.as_secs().min(libc::time_t::max_value() as u64) as libc::time_t,
+            tv_nsec: timeout.subsec_nanos() as libc::c_long,
+        });
+        unsafe {
+            libc::syscall(
+                libc::SYS_futex,
+                word as *const AtomicU32,
+                libc::FUTEX_WAIT | libc::FUTEX_PRIVATE_FLAG,
+                expected,
+                timeout
+                    .as_ref()
+                    .map_or(null(), |timeout| timeout as *const libc::timespec),
+            );
+        }
+    }
+
+    pub fn wake_all(word: &AtomicU32) {
+        unsafe {
+            libc::syscall(
+                libc::SYS_futex,
+                word as *const AtomicU32,
+                libc::FUTEX_WAKE | libc::FUTEX_PRIVATE_FLAG,
+                libc::c_int::max_value(),
+            );
+        }
+    }
+}
+
+/// emulates futexes with one condition variable shared by every word
+#[cfg(not(target_os = "linux"))]
+mod futex {
+    use once_cell::sync::Lazy;
+    use std::sync::atomic::{AtomicU32, Ordering};
+    use std::sync::{Condvar, Mutex};
+    use std::time::Duration;
+
+    static STATE: Lazy<(Mutex<()>, Condvar)> = Lazy::new(|| (Mutex::new(()), Condvar::new()));
+
+    pub fn wait(word: &AtomicU32, expected: u32, timeout: Option<Duration>) {
+        let (mutex, condition_variable) = &*STATE;
+        let guard = mutex.lock().unwrap();
+        if word.load(Ordering::SeqCst) == expected {
+            match timeout {
+                Some(timeout) => drop(condition_variable.wait_timeout(guard, timeout).unwrap()),
+                None => drop(condition_variable.wait(guard).unwrap()),
+            }
+        }
+    }
+
+    pub fn wake_all(_word: &AtomicU32) {
+        let (mutex, condition_variable) = &*STATE;
+        drop(mutex.lock().unwrap());
+        condition_variable.notify_all();
+    }
+}
+
+/// what threads waiting for a change to a sync object block on
+#[derive(Debug)]
+struct WaitQueue {
+    /// the futex word, changed by every notification that has a waiter to wake
+    generation: AtomicU32,
+    waiter_count: AtomicU32,
+}
+
+impl WaitQueue {
+    const fn new() -> Self {
+        Self {
+            generation: AtomicU32::new(0),
+            waiter_count: AtomicU32::new(0),
+        }
+    }
+    /// the change waiters check for must be stored with `SeqCst` before calling `notify`, so
+    /// a waiter either sees it or is counted here
+    fn notify(&self) {
+        if self.waiter_count.load(Ordering::SeqCst) != 0 {
+            self.generation.fetch_add(1, Ordering::SeqCst);
+            futex::wake_all(&self.generation);
+        }
+    }
+    /// blocks until `done` returns true, returning false if `deadline` passes first
+    fn wait_until<F: FnMut() -> bool>(&self, deadline: Option<Instant>, mut done: F) -> bool {
+        if done() {
+            return true;
+        }
+        self.waiter_count.fetch_add(1, Ordering::SeqCst);
+        let retval = loop {
+            let generation = self.generation.load(Ordering::SeqCst);
+            if done() {
+                break true;
+            }
+            let timeout = match deadline {
+                Some(deadline) => {
+                    let now = Instant::now();
+                    if now >= deadline {
+                        break false;
+                    }
+                    Some(deadline - now)
+                }
+                None => None,
+            };
+            futex::wait(&self.generation, generation, timeout);
+        };
+        self.waiter_count.fetch_sub(1, Ordering::SeqCst);
+        retval
+    }
+}
+
+static ANY_WAIT_QUEUE: WaitQueue = WaitQueue::new();
+
+/// converts a Vulkan timeout in nanoseconds; `None` waits forever
+pub fn get_deadline(timeout: u64) -> Option<Instant> {
+    if timeout == u64::max_value() {
+        None
+    } else {
+        Instant::now().checked_add(Duration::from_nanos(timeout))
+    }
+}
+
+/// blocks until `done` returns true, returning false if `deadline` passes first. `done` is
+/// checked again whenever any fence, semaphore or event is signaled.
+pub fn wait_for_any<F: FnMut() -> bool>(deadline: Option<Instant>, done: F) -> bool {
+    ANY_WAIT_QUEUE.wait_until(deadline, done)
+}
+
+#[derive(Debug)]
+struct Flag {
+    value: AtomicBool,
+    wait_queue: WaitQueue,
+}
+
+impl Flag {
+    fn new(value: bool) -> Self {
+        Self {
+            value: AtomicBool::new(value),
+            wait_queue: WaitQueue::new(),
+        }
+    }
+    fn get(&self) -> bool {
+        self.value.load(Ordering::SeqCst)
+    }
+    fn set(&self) {
+        self.value.store(true, Ordering::SeqCst);
+        self.wait_queue.notify();
+        ANY_WAIT_QUEUE.notify();
+    }
+    fn reset(&self) {
+        self.value.store(false, Ordering::SeqCst);
+    }
+    fn wait(&self, deadline: Option<Instant>) -> bool {
+        self.wait_queue.wait_until(deadline, || self.get())
+    }
+}
+
+#[derive(Debug)]
+pub struct Fence {
+    signaled: Flag,
+}
+
+impl Fence {
+    pub fn new(signaled: bool) -> Self {
+        Self {
+            signaled: Flag::new(signaled),
+        }
+    }
+    pub fn is_signaled(&self) -> bool {
+        self.signaled.get()
+    }
+    pub fn signal(&self) {
+        self.signaled.set();
+    }
+    pub fn reset(&self) {
+        self.signaled.reset();
+    }
+    /// returns false if `deadline` passes before the fence is signaled
+    pub fn wait(&self, deadline: Option<Instant>) -> bool {
+        self.signaled.wait(deadline)
+    }
+}
+
+/// a binary semaphore is a timeline semaphore that only goes between 0 and 1, and back to 0
+/// when waited on
+#[derive(Debug)]
+pub struct Semaphore {
+    is_timeline: bool,
+    value: AtomicU64,
+    wait_queue: WaitQueue,
+}
+
+impl Semaphore {
+    pub fn new(semaphore_type: api::VkSemaphoreTypeKHR, initial_value: u64) -> Self {
+        let is_timeline = match semaphore_type {
+            api::VK_SEMAPHORE_TYPE_BINARY_KHR => false,
+            api::VK_SEMAPHORE_TYPE_TIMELINE_KHR => true,
+            _ => unreachable!("invalid VkSemaphoreTypeKHR: {}", semaphore_type),
+        };
+        Self {
+            is_timeline,
+            value: AtomicU64::new(if is_timeline { initial_value } else { 0 }),
+            wait_queue: WaitQueue::new(),
+        }
+    }
+    pub fn is_timeline(&self) -> bool {
+        self.is_timeline
+    }
+    pub fn get_value(&self) -> u64 {
+        self.value.load(Ordering::SeqCst)
+    }
+    /// `value` is ignored for binary semaphores
+    pub fn signal(&self, value: u64) {
+        self.value
+            .store(if self.is_timeline { value } else { 1 }, Ordering::SeqCst);
+        self.wait_queue.notify();
+        ANY_WAIT_QUEUE.notify();
+    }
+    /// waits for a timeline semaphore to reach `value`; returns false if `deadline` passes
+    /// first
+    pub fn wait(&self, value: u64, deadline: Option<Instant>) -> bool {
+        assert!(self.is_timeline);
+        self.wait_queue
+            .wait_until(deadline, || self.get_value() >= value)
+    }
+    /// waits like a queue submission does: binary semaphores are waited for and unsignaled,
+    /// and `value` is ignored for them
+    pub fn wait_on_queue(&self, value: u64) {
+        if self.is_timeline {
+            self.wait(value, None);
+        } else {
+            self.wait_queue.wait_until(None, || {
+                self.value
+                    .compare_exchange(1, 0, Ordering::SeqCst, Ordering::SeqCst)
+                    .is_ok()
+            });
+        }
+    }
+}
+
+#[derive(Debug)]
+pub struct Event {
+    set: Flag,
+}
+
+impl Event {
+    pub fn new() -> Self {
+        Self {
+            set: Flag::new(false),
+        }
+    }
+    pub fn is_set(&self) -> bool {
+        self.set.get()
+    }
+    pub fn set(&self) {
+        self.set.set();
+    }
+    pub fn reset(&self) {
+        self.set.reset();
+    }
+    pub fn wait(&self) {
+        self.set.wait(None);
+    }
+}
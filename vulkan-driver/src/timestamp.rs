@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! the device clock, which timestamp queries and `VK_EXT_calibrated_timestamps` read.
+//!
+//! When the CPU's time-stamp counter runs at a constant rate, that's used, since reading it
+//! doesn't need a system call; its rate is measured against `CLOCK_MONOTONIC` the first time
+//! it's needed. Otherwise the device clock is `CLOCK_MONOTONIC` itself, in nanoseconds.
+
+use crate::api;
+use once_cell::sync::Lazy;
+use std::time::{Duration, Instant};
+
+/// how long the time-stamp counter's rate is measured for
+const CALIBRATION_DURATION: Duration = Duration::from_millis(5);
+
+struct Clock {
+    use_tsc: bool,
+    /// in nanoseconds per tick
+    period: f64,
+}
+
+#[cfg(target_arch = "x86_64")]
+fn has_invariant_tsc() -> bool {
+    use std::arch::x86_64::__cpuid;
+    unsafe {
+        // the invariant TSC bit is in EDX of leaf 0x8000_0007
+        __cpuid(0x8000_0000).eax >= 0x8000_0007 && __cpuid(0x8000_0007).edx & (1 << 8) != 0
+    }
+}
+
+#[cfg(target_arch = "x86_64")]
+fn read_tsc() -> u64 {
+    unsafe { std::arch::x86_64::_rdtsc() }
+}
+
+#[cfg(not(target_arch = "x86_64"))]
+fn has_invariant_tsc() -> bool {
+    false
+}
+
+#[cfg(not(target_arch = "x86_64"))]
+fn read_tsc() -> u64 {
+    unreachable!()
+}
+
+#[cfg(unix)]
+fn read_clock(clock_id: libc::clockid_t) -> u64 {
+    let mut time = libc::timespec {
+        tv_sec: 0,
+        tv_nsec: 0,
+    };
+    unsafe {
+        libc::clock_gettime(clock_id, &mut time);
+    }
+    time.tv_sec as u64 * 1_000_000_000 + time.tv_nsec as u64
+}
+
+#[cfg(unix)]
+fn read_monotonic_clock() -> u64 {
+    read_clock(libc::CLOCK_MONOTONIC)
+}
+
+/// there's no `CLOCK_MONOTONIC` to match, so this only needs to be monotonic
+#[cfg(not(unix))]
+fn read_monotonic_clock() -> u64 {
+    static START: Lazy<Instant> = Lazy::new(Instant::now);
+    START.elapsed().as_nanos() as u64
+}
+
+impl Clock {
+    fn new() -> Self {
+        if !has_invariant_tsc() {
+            return Self {
+                use_tsc: false,
+                period: 1.0,
+            };
+        }
+        let start_time = read_monotonic_clock();
+        let start_ticks = read_tsc();
+        let deadline = Instant::now() + CALIBRATION_DURATION;
+        while Instant::now() < deadline {}
+        let end_time = read_monotonic_clock();
+        let end_ticks = read_tsc();
+        Self {
+            use_tsc: true,
+            period: (end_time - start_time) as f64 / (end_ticks - start_ticks) as f64,
+        }
+    }
+}
+
+static CLOCK: Lazy<Clock> = Lazy::new(Clock::new);
+
+/// the current device time, in ticks of `get_period` nanoseconds
+pub fn get_timestamp() -> u64 {
+    if CLOCK.use_tsc {
+        read_tsc()
+    } else {
+        read_monotonic_clock()
+    }
+}
+
+/// the length of a tick of `get_timestamp`, in nanoseconds
+pub fn get_period() -> f32 {
+    CLOCK.period as f32
+}
+
+pub fn get_calibrateable_time_domains() -> &'static [api::VkTimeDomainEXT] {
+    &[
+        api::VK_TIME_DOMAIN_DEVICE_EXT,
+        #[cfg(unix)]
+        api::VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT,
+        #[cfg(target_os = "linux")]
+        api::VK_TIME_DOMAIN_CLOCK_MONOTONIC_RAW_EXT,
+    ]
+}
+
+/// reads each clock in `time_domains` as close together as possible, returning the most
+/// time that can have passed between any two of the reads, in nanoseconds
+pub fn get_calibrated_timestamps(
+    time_domains: &[api::VkTimeDomainEXT],
+    timestamps: &mut [u64],
+) -> u64 {
+    let start = get_timestamp();
+    for (&time_domain, timestamp) in time_domains.iter().zip(timestamps) {
+        *timestamp = match time_domain {
+            api::VK_TIME_DOMAIN_DEVICE_EXT => get_timestamp(),
+            #[cfg(unix)]
+            api::VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT => read_clock(libc::CLOCK_MONOTONIC),
+            #[cfg(target_os = "linux")]
+            api::VK_TIME_DOMAIN_CLOCK_MONOTONIC_RAW_EXT => read_clock(libc::CLOCK_MONOTONIC_RAW),
+            _ => unreachable!("time domain not calibrateable: {}", time_domain),
+        };
+    }
+    let end = get_timestamp();
+    (((end - start) as f64 * CLOCK.period).ceil() as u64).max(1)
+}
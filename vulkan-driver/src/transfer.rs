@@ -0,0 +1,1612 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! transfer commands: buffer and image copies, fills, clears, blits and resolves
+//!
+//! Images are processed in bands of `TILE_SIZE` rows spread across the worker pool; the
+//! inner loops are the kernels in `kernels`, which use SSE2 or AVX2 on x86_64, chosen at
+//! runtime, NEON on aarch64, and plain loops elsewhere.
+
+use crate::api;
+use crate::buffer::Buffer;
+use crate::device_memory::{copy_non_temporal, DeviceMemoryAllocation, DeviceMemoryType};
+use crate::image::{Image, ImageMultisampleCount, Tiling, TILE_SIZE};
+use crate::queue::ExecutionContext;
+use std::ptr;
+
+/// splitting work into smaller tasks than this costs more in scheduling than it gains
+const MIN_BYTES_PER_TASK: usize = 64 * 1024;
+
+mod kernels {
+    //! Each kernel lets `simd` do as many whole vectors as it can, then finishes the rest
+    //! itself. All pointers may be unaligned.
+
+    /// sets `count` 4-byte values starting at `dest`
+    pub unsafe fn fill_u32(dest: *mut u8, count: usize, value: u32) {
+        for index in simd::fill_u32(dest, count, value)..count {
+            (dest as *mut u32).add(index).write_unaligned(value);
+        }
+    }
+
+    /// copies `tile_count` tiles of 4-byte pixels, taken from 4 rows `src_row_pitch` apart,
+    /// into consecutive tiles at `dest`
+    pub unsafe fn linear_to_tiled(
+        dest: *mut u8,
+        src: *const u8,
+        src_row_pitch: usize,
+        tile_count: usize,
+    ) {
+        for tile in simd::linear_to_tiled(dest, src, src_row_pitch, tile_count)..tile_count {
+            for row in 0..4 {
+                std::ptr::copy_nonoverlapping(
+                    src.add(row * src_row_pitch + tile * 16),
+                    dest.add(tile * 64 + row * 16),
+                    16,
+                );
+            }
+        }
+    }
+
+    /// the inverse of `linear_to_tiled`
+    pub unsafe fn tiled_to_linear(
+        dest: *mut u8,
+        dest_row_pitch: usize,
+        src: *const u8,
+        tile_count: usize,
+    ) {
+        for tile in simd::tiled_to_linear(dest, dest_row_pitch, src, tile_count)..tile_count {
+            for row in 0..4 {
+                std::ptr::copy_nonoverlapping(
+                    src.add(tile * 64 + row * 16),
+                    dest.add(row * dest_row_pitch + tile * 16),
+                    16,
+                );
+            }
+        }
+    }
+
+    /// swaps the first and third bytes of each 4-byte pixel, converting between RGBA and BGRA
+    pub unsafe fn swap_red_blue(dest: *mut u8, src: *const u8, pixel_count: usize) {
+        for index in simd::swap_red_blue(dest, src, pixel_count)..pixel_count {
+            let pixel = (src as *const u32).add(index).read_unaligned();
+            let pixel = (pixel & 0xFF00_FF00) | (pixel >> 16 & 0xFF) | (pixel & 0xFF) << 16;
+            (dest as *mut u32).add(index).write_unaligned(pixel);
+        }
+    }
+
+    /// averages the 4 samples of each pixel of 4 8-bit channels, rounding to nearest
+    pub unsafe fn resolve_4x(dest: *mut u8, src: *const u8, pixel_count: usize) {
+        for index in simd::resolve_4x(dest, src, pixel_count)..pixel_count {
+            for channel in 0..4 {
+                let sum: u32 = (0..4)
+                    .map(|sample| u32::from(*src.add(index * 16 + sample * 4 + channel)))
+                    .sum();
+                *dest.add(index * 4 + channel) = ((sum + 2) / 4) as u8;
+            }
+        }
+    }
+
+    /// the versions of the kernels' vector loops for one instruction set, for testing each
+    /// one the host can run rather than just the one picked at runtime
+    #[cfg(test)]
+    pub struct SimdPath {
+        pub name: &'static str,
+        pub fill_u32: unsafe fn(*mut u8, usize, u32) -> usize,
+        pub linear_to_tiled: unsafe fn(*mut u8, *const u8, usize, usize) -> usize,
+        pub tiled_to_linear: unsafe fn(*mut u8, usize, *const u8, usize) -> usize,
+        pub swap_red_blue: unsafe fn(*mut u8, *const u8, usize) -> usize,
+        pub resolve_4x: unsafe fn(*mut u8, *const u8, usize) -> usize,
+    }
+
+    #[cfg(target_arch = "x86_64")]
+    mod simd {
+        use std::arch::x86_64::*;
+
+        fn has_avx2() -> bool {
+            is_x86_feature_detected!("avx2")
+        }
+
+        pub unsafe fn fill_u32(dest: *mut u8, count: usize, value: u32) -> usize {
+            if has_avx2() {
+                fill_u32_avx2(dest, count, value)
+            } else {
+                fill_u32_sse2(dest, count, value)
+            }
+        }
+
+        #[target_feature(enable = "avx2")]
+        unsafe fn fill_u32_avx2(dest: *mut u8, count: usize, value: u32) -> usize {
+            let vector = _mm256_set1_epi32(value as i32);
+            let mut index = 0;
+            while count - index >= 8 {
+                _mm256_storeu_si256(dest.add(index * 4) as *mut __m256i, vector);
+                index += 8;
+            }
+            index
+        }
+
+        unsafe fn fill_u32_sse2(dest: *mut u8, count: usize, value: u32) -> usize {
+            let vector = _mm_set1_epi32(value as i32);
+            let mut index = 0;
+            while count - index >= 4 {
+                _mm_storeu_si128(dest.add(index * 4) as *mut __m128i, vector);
+                index += 4;
+            }
+            index
+        }
+
+        pub unsafe fn linear_to_tiled(
+            dest: *mut u8,
+            src: *const u8,
+            src_row_pitch: usize,
+            tile_count: usize,
+        ) -> usize {
+            if has_avx2() {
+                linear_to_tiled_avx2(dest, src, src_row_pitch, tile_count)
+            } else {
+                linear_to_tiled_sse2(dest, src, src_row_pitch, tile_count)
+            }
+        }
+
+        /// two tiles at a time: each row load covers both, then the 128-bit halves are
+        /// regrouped by tile
+        #[target_feature(enable = "avx2")]
+        unsafe fn linear_to_tiled_avx2(
+            dest: *mut u8,
+            src: *const u8,
+            src_row_pitch: usize,
+            tile_count: usize,
+        ) -> usize {
+            let mut tile = 0;
+            while tile_count - tile >= 2 {
+                // closures don't inherit `target_feature`, so this is written out
+                let src = src.add(tile * 16);
+                let row0 = _mm256_loadu_si256(src as *const __m256i);
+                let row1 = _mm256_loadu_si256(src.add(src_row_pitch) as *const __m256i);
+                let row2 = _mm256_loadu_si256(src.add(src_row_pitch * 2) as *const __m256i);
+                let row3 = _mm256_loadu_si256(src.add(src_row_pitch * 3) as *const __m256i);
+                let dest = dest.add(tile * 64) as *mut __m256i;
+                _mm256_storeu_si256(dest, _mm256_permute2x128_si256(row0, row1, 0x20));
+                _mm256_storeu_si256(dest.add(1), _mm256_permute2x128_si256(row2, row3, 0x20));
+                _mm256_storeu_si256(dest.add(2), _mm256_permute2x128_si256(row0, row1, 0x31));
+                _mm256_storeu_si256(dest.add(3), _mm256_permute2x128_si256(row2, row3, 0x31));
+                tile += 2;
+            }
+            tile
+        }
+
+        unsafe fn linear_to_tiled_sse2(
+            dest: *mut u8,
+            src: *const u8,
+            src_row_pitch: usize,
+            tile_count: usize,
+        ) -> usize {
+            for tile in 0..tile_count {
+                for row in 0..4 {
+                    let value =
+                        _mm_loadu_si128(src.add(row * src_row_pitch + tile * 16) as *const __m128i);
+                    _mm_storeu_si128(dest.add(tile * 64 + row * 16) as *mut __m128i, value);
+                }
+            }
+            tile_count
+        }
+
+        pub unsafe fn tiled_to_linear(
+            dest: *mut u8,
+            dest_row_pitch: usize,
+            src: *const u8,
+            tile_count: usize,
+        ) -> usize {
+            if has_avx2() {
+                tiled_to_linear_avx2(dest, dest_row_pitch, src, tile_count)
+            } else {
+                tiled_to_linear_sse2(dest, dest_row_pitch, src, tile_count)
+            }
+        }
+
+        #[target_feature(enable = "avx2")]
+        unsafe fn tiled_to_linear_avx2(
+            dest: *mut u8,
+            dest_row_pitch: usize,
+            src: *const u8,
+            tile_count: usize,
+        ) -> usize {
+            let mut tile = 0;
+            while tile_count - tile >= 2 {
+                let src = src.add(tile * 64) as *const __m256i;
+                let tile0_rows01 = _mm256_loadu_si256(src);
+                let tile0_rows23 = _mm256_loadu_si256(src.add(1));
+                let tile1_rows01 = _mm256_loadu_si256(src.add(2));
+                let tile1_rows23 = _mm256_loadu_si256(src.add(3));
+                let dest = dest.add(tile * 16);
+                let row0 = _mm256_permute2x128_si256(tile0_rows01, tile1_rows01, 0x20);
+                let row1 = _mm256_permute2x128_si256(tile0_rows01, tile1_rows01, 0x31);
+                let row2 = _mm256_permute2x128_si256(tile0_rows23, tile1_rows23, 0x20);
+                let row3 = _mm256_permute2x128_si256(tile0_rows23, tile1_rows23, 0x31);
+                _mm256_storeu_si256(dest as *mut __m256i, row0);
+                _mm256_storeu_si256(dest.add(dest_row_pitch) as *mut __m256i, row1);
+                _mm256_storeu_si256(dest.add(dest_row_pitch * 2) as *mut __m256i, row2);
+                _mm256_storeu_si256(dest.add(dest_row_pitch * 3) as *mut __m256i, row3);
+                tile += 2;
+            }
+            tile
+        }
+
+        unsafe fn tiled_to_linear_sse2(
+            dest: *mut u8,
+            dest_row_pitch: usize,
+            src: *const u8,
+            tile_count: usize,
+        ) -> usize {
+            for tile in 0..tile_count {
+                for row in 0..4 {
+                    let value = _mm_loadu_si128(src.add(tile * 64 + row * 16) as *const __m128i);
+                    _mm_storeu_si128(
+                        dest.add(row * dest_row_pitch + tile * 16) as *mut __m128i,
+                        value,
+                    );
+                }
+            }
+            tile_count
+        }
+
+        pub unsafe fn swap_red_blue(dest: *mut u8, src: *const u8, pixel_count: usize) -> usize {
+            if has_avx2() {
+                swap_red_blue_avx2(dest, src, pixel_count)
+            } else {
+                swap_red_blue_sse2(dest, src, pixel_count)
+            }
+        }
+
+        #[target_feature(enable = "avx2")]
+        unsafe fn swap_red_blue_avx2(dest: *mut u8, src: *const u8, pixel_count: usize) -> usize {
+            let green_alpha_mask = _mm256_set1_epi32(0xFF00_FF00u32 as i32);
+            let low_byte_mask = _mm256_set1_epi32(0xFF);
+            let mut index = 0;
+            while pixel_count - index >= 8 {
+                let pixels = _mm256_loadu_si256(src.add(index * 4) as *const __m256i);
+                let green_alpha = _mm256_and_si256(pixels, green_alpha_mask);
+                let blue = _mm256_and_si256(_mm256_srli_epi32(pixels, 16), low_byte_mask);
+                let red = _mm256_slli_epi32(_mm256_and_si256(pixels, low_byte_mask), 16);
+                let pixels = _mm256_or_si256(green_alpha, _mm256_or_si256(blue, red));
+                _mm256_storeu_si256(dest.add(index * 4) as *mut __m256i, pixels);
+                index += 8;
+            }
+            index
+        }
+
+        unsafe fn swap_red_blue_sse2(dest: *mut u8, src: *const u8, pixel_count: usize) -> usize {
+            let green_alpha_mask = _mm_set1_epi32(0xFF00_FF00u32 as i32);
+            let low_byte_mask = _mm_set1_epi32(0xFF);
+            let mut index = 0;
+            while pixel_count - index >= 4 {
+                let pixels = _mm_loadu_si128(src.add(index * 4) as *const __m128i);
+                let green_alpha = _mm_and_si128(pixels, green_alpha_mask);
+                let blue = _mm_and_si128(_mm_srli_epi32(pixels, 16), low_byte_mask);
+                let red = _mm_slli_epi32(_mm_and_si128(pixels, low_byte_mask), 16);
+                let pixels = _mm_or_si128(green_alpha, _mm_or_si128(blue, red));
+                _mm_storeu_si128(dest.add(index * 4) as *mut __m128i, pixels);
+                index += 4;
+            }
+            index
+        }
+
+        pub unsafe fn resolve_4x(dest: *mut u8, src: *const u8, pixel_count: usize) -> usize {
+            if has_avx2() {
+                resolve_4x_avx2(dest, src, pixel_count)
+            } else {
+                resolve_4x_sse2(dest, src, pixel_count)
+            }
+        }
+
+        /// the same as `resolve_4x_sse2`, with one pixel in each 128-bit lane
+        #[target_feature(enable = "avx2")]
+        unsafe fn resolve_4x_avx2(dest: *mut u8, src: *const u8, pixel_count: usize) -> usize {
+            let zero = _mm256_setzero_si256();
+            let rounding = _mm256_set1_epi16(2);
+            let mut index = 0;
+            while pixel_count - index >= 2 {
+                let samples = _mm256_loadu_si256(src.add(index * 16) as *const __m256i);
+                let sums = _mm256_add_epi16(
+                    _mm256_unpacklo_epi8(samples, zero),
+                    _mm256_unpackhi_epi8(samples, zero),
+                );
+                let sums = _mm256_add_epi16(sums, _mm256_srli_si256(sums, 8));
+                let averages = _mm256_srli_epi16(_mm256_add_epi16(sums, rounding), 2);
+                let averages = _mm256_packus_epi16(averages, averages);
+                let dest = dest.add(index * 4) as *mut i32;
+                dest.write_unaligned(_mm256_extract_epi32(averages, 0));
+                dest.add(1)
+                    .write_unaligned(_mm256_extract_epi32(averages, 4));
+                index += 2;
+            }
+            index
+        }
+
+        /// widens the 4 samples to 16 bits then adds them pairwise
+        unsafe fn resolve_4x_sse2(dest: *mut u8, src: *const u8, pixel_count: usize) -> usize {
+            let zero = _mm_setzero_si128();
+            let rounding = _mm_set1_epi16(2);
+            for index in 0..pixel_count {
+                let samples = _mm_loadu_si128(src.add(index * 16) as *const __m128i);
+                let sums = _mm_add_epi16(
+                    _mm_unpacklo_epi8(samples, zero),
+                    _mm_unpackhi_epi8(samples, zero),
+                );
+                let sums = _mm_add_epi16(sums, _mm_srli_si128(sums, 8));
+                let averages = _mm_srli_epi16(_mm_add_epi16(sums, rounding), 2);
+                let averages = _mm_packus_epi16(averages, averages);
+                (dest.add(index * 4) as *mut i32).write_unaligned(_mm_cvtsi128_si32(averages));
+            }
+            pixel_count
+        }
+
+        #[cfg(test)]
+        pub fn get_test_paths() -> Vec<super::SimdPath> {
+            let mut paths = vec![super::SimdPath {
+                name: "sse2",
+                fill_u32: fill_u32_sse2,
+                linear_to_tiled: linear_to_tiled_sse2,
+                tiled_to_linear: tiled_to_linear_sse2,
+                swap_red_blue: swap_red_blue_sse2,
+                resolve_4x: resolve_4x_sse2,
+            }];
+            if has_avx2() {
+                paths.push(super::SimdPath {
+                    name: "avx2",
+                    fill_u32: fill_u32_avx2,
+                    linear_to_tiled: linear_to_tiled_avx2,
+                    tiled_to_linear: tiled_to_linear_avx2,
+                    swap_red_blue: swap_red_blue_avx2,
+                    resolve_4x: resolve_4x_avx2,
+                });
+            }
+            paths
+        }
+    }
+
+    /// NEON is part of the base aarch64 targets, so it's enabled at compile time rather than
+    /// detected at runtime like AVX2
+    #[cfg(all(target_arch = "aarch64", target_feature = "neon"))]
+    mod simd {
+        use std::arch::aarch64::*;
+
+        pub unsafe fn fill_u32(dest: *mut u8, count: usize, value: u32) -> usize {
+            let vector = vreinterpretq_u8_u32(vdupq_n_u32(value));
+            let mut index = 0;
+            while count - index >= 4 {
+                vst1q_u8(dest.add(index * 4), vector);
+                index += 4;
+            }
+            index
+        }
+
+        pub unsafe fn linear_to_tiled(
+            dest: *mut u8,
+            src: *const u8,
+            src_row_pitch: usize,
+            tile_count: usize,
+        ) -> usize {
+            for tile in 0..tile_count {
+                for row in 0..4 {
+                    let value = vld1q_u8(src.add(row * src_row_pitch + tile * 16));
+                    vst1q_u8(dest.add(tile * 64 + row * 16), value);
+                }
+            }
+            tile_count
+        }
+
+        pub unsafe fn tiled_to_linear(
+            dest: *mut u8,
+            dest_row_pitch: usize,
+            src: *const u8,
+            tile_count: usize,
+        ) -> usize {
+            for tile in 0..tile_count {
+                for row in 0..4 {
+                    let value = vld1q_u8(src.add(tile * 64 + row * 16));
+                    vst1q_u8(dest.add(row * dest_row_pitch + tile * 16), value);
+                }
+            }
+            tile_count
+        }
+
+        /// the interleaved loads and stores split the pixels into a vector per channel
+        pub unsafe fn swap_red_blue(dest: *mut u8, src: *const u8, pixel_count: usize) -> usize {
+            let mut index = 0;
+            while pixel_count - index >= 16 {
+                let channels = vld4q_u8(src.add(index * 4));
+                vst4q_u8(
+                    dest.add(index * 4),
+                    uint8x16x4_t(channels.2, channels.1, channels.0, channels.3),
+                );
+                index += 16;
+            }
+            index
+        }
+
+        /// 4 pixels at a time: the interleaved load gives a vector per sample, which are
+        /// widened and added, then `vrshrn_n_u16` rounds while dividing by 4
+        pub unsafe fn resolve_4x(dest: *mut u8, src: *const u8, pixel_count: usize) -> usize {
+            let mut index = 0;
+            while pixel_count - index >= 4 {
+                let samples = vld4q_u32(src.add(index * 16) as *const u32);
+                let sample0 = vreinterpretq_u8_u32(samples.0);
+                let sample1 = vreinterpretq_u8_u32(samples.1);
+                let sample2 = vreinterpretq_u8_u32(samples.2);
+                let sample3 = vreinterpretq_u8_u32(samples.3);
+                let low_sums = vaddq_u16(
+                    vaddl_u8(vget_low_u8(sample0), vget_low_u8(sample1)),
+                    vaddl_u8(vget_low_u8(sample2), vget_low_u8(sample3)),
+                );
+                let high_sums = vaddq_u16(
+                    vaddl_high_u8(sample0, sample1),
+                    vaddl_high_u8(sample2, sample3),
+                );
+                let averages =
+                    vcombine_u8(vrshrn_n_u16::<2>(low_sums), vrshrn_n_u16::<2>(high_sums));
+                vst1q_u8(dest.add(index * 4), averages);
+                index += 4;
+            }
+            index
+        }
+
+        #[cfg(test)]
+        pub fn get_test_paths() -> Vec<super::SimdPath> {
+            vec![super::SimdPath {
+                name: "neon",
+                fill_u32,
+                linear_to_tiled,
+                tiled_to_linear,
+                swap_red_blue,
+                resolve_4x,
+            }]
+        }
+    }
+
+    /// LLVM auto-vectorizes the loops in the callers for other architectures
+    #[cfg(not(any(
+        target_arch = "x86_64",
+        all(target_arch = "aarch64", target_feature = "neon")
+    )))]
+    mod simd {
+        pub unsafe fn fill_u32(_dest: *mut u8, _count: usize, _value: u32) -> usize {
+            0
+        }
+        pub unsafe fn linear_to_tiled(
+            _dest: *mut u8,
+            _src: *const u8,
+            _src_row_pitch: usize,
+            _tile_count: usize,
+        ) -> usize {
+            0
+        }
+        pub unsafe fn tiled_to_linear(
+            _dest: *mut u8,
+            _dest_row_pitch: usize,
+            _src: *const u8,
+            _tile_count: usize,
+        ) -> usize {
+            0
+        }
+        pub unsafe fn swap_red_blue(_dest: *mut u8, _src: *const u8, _pixel_count: usize) -> usize {
+            0
+        }
+        pub unsafe fn resolve_4x(_dest: *mut u8, _src: *const u8, _pixel_count: usize) -> usize {
+            0
+        }
+
+        #[cfg(test)]
+        pub fn get_test_paths() -> Vec<super::SimdPath> {
+            vec![super::SimdPath {
+                name: "none",
+                fill_u32,
+                linear_to_tiled,
+                tiled_to_linear,
+                swap_red_blue,
+                resolve_4x,
+            }]
+        }
+    }
+
+    #[cfg(test)]
+    mod tests {
+        use super::*;
+        use crate::device_memory::copy_non_temporal;
+
+        /// what the bytes around and not yet written by a kernel are set to
+        const GUARD: u8 = 0xA5;
+        const GUARD_SIZE: usize = 64;
+
+        /// every remainder after whole vectors of up to 16 pixels or tiles, with every
+        /// alignment of 4-byte pixels, as element counts and how far the buffers are off of
+        /// alignment
+        fn get_cases() -> impl Iterator<Item = (usize, usize)> {
+            (0..=37).flat_map(|count| (0..4).map(move |misalignment| (count, misalignment)))
+        }
+
+        /// not random, just different enough from one byte to the next to catch misplaced ones
+        fn get_test_bytes(size: usize, seed: usize) -> Vec<u8> {
+            let mut state = 0x9E37_79B9u32 ^ seed as u32;
+            (0..size)
+                .map(|_| {
+                    state ^= state << 13;
+                    state ^= state >> 17;
+                    state ^= state << 5;
+                    (state >> 24) as u8
+                })
+                .collect()
+        }
+
+        /// `size` bytes starting `misalignment` bytes past a 32-byte boundary, between
+        /// `GUARD` bytes so writes past either end are caught
+        struct GuardedBuffer {
+            bytes: Vec<u8>,
+            start: usize,
+            size: usize,
+        }
+
+        impl GuardedBuffer {
+            fn new(size: usize, misalignment: usize) -> Self {
+                let bytes = vec![GUARD; GUARD_SIZE * 2 + 64 + size];
+                let start =
+                    GUARD_SIZE + bytes[GUARD_SIZE..].as_ptr().align_offset(32) + misalignment;
+                Self { bytes, start, size }
+            }
+            fn with_contents(contents: &[u8], misalignment: usize) -> Self {
+                let mut retval = Self::new(contents.len(), misalignment);
+                retval.bytes[retval.start..][..contents.len()].copy_from_slice(contents);
+                retval
+            }
+            fn as_mut_ptr(&mut self) -> *mut u8 {
+                self.bytes[self.start..].as_mut_ptr()
+            }
+            fn check(&self, expected: &[u8], context: &str) {
+                let (before, rest) = self.bytes.split_at(self.start);
+                let (contents, after) = rest.split_at(self.size);
+                assert_eq!(contents, expected, "{}", context);
+                assert!(
+                    before.iter().chain(after).all(|&byte| byte == GUARD),
+                    "{}: wrote outside of the buffer",
+                    context
+                );
+            }
+        }
+
+        /// the first `element_count` elements of `size` bytes from `all`, with the rest left
+        /// as `GUARD`
+        fn get_prefix(all: &[u8], element_count: usize, element_size: usize) -> Vec<u8> {
+            let mut retval = vec![GUARD; all.len()];
+            let size = element_count * element_size;
+            retval[..size].copy_from_slice(&all[..size]);
+            retval
+        }
+
+        #[test]
+        fn test_fill_u32() {
+            for (count, misalignment) in get_cases() {
+                let value = 0x0403_0201 * (count as u32 + 1);
+                let expected = value.to_ne_bytes().repeat(count);
+                for path in simd::get_test_paths() {
+                    let mut dest = GuardedBuffer::new(count * 4, misalignment);
+                    let done = unsafe { (path.fill_u32)(dest.as_mut_ptr(), count, value) };
+                    assert!(done <= count);
+                    let context = format!("{}: {} values at +{}", path.name, count, misalignment);
+                    dest.check(&get_prefix(&expected, done, 4), &context);
+                }
+                let mut dest = GuardedBuffer::new(count * 4, misalignment);
+                unsafe { fill_u32(dest.as_mut_ptr(), count, value) };
+                dest.check(&expected, &format!("{} values at +{}", count, misalignment));
+            }
+        }
+
+        #[test]
+        fn test_linear_to_tiled() {
+            for (tile_count, misalignment) in get_cases() {
+                // not a multiple of the vector size, so only the first row is aligned
+                let src_row_pitch = tile_count * 16 + 4;
+                let src = get_test_bytes(src_row_pitch * 4, tile_count);
+                let get_expected = |done: usize| {
+                    let mut expected = vec![GUARD; tile_count * 64];
+                    for tile in 0..done {
+                        for row in 0..4 {
+                            expected[tile * 64 + row * 16..][..16]
+                                .copy_from_slice(&src[row * src_row_pitch + tile * 16..][..16]);
+                        }
+                    }
+                    expected
+                };
+                let mut src = GuardedBuffer::with_contents(&src, 3 - misalignment);
+                for path in simd::get_test_paths() {
+                    let mut dest = GuardedBuffer::new(tile_count * 64, misalignment);
+                    let done = unsafe {
+                        (path.linear_to_tiled)(
+                            dest.as_mut_ptr(),
+                            src.as_mut_ptr(),
+                            src_row_pitch,
+                            tile_count,
+                        )
+                    };
+                    assert!(done <= tile_count);
+                    let context =
+                        format!("{}: {} tiles at +{}", path.name, tile_count, misalignment);
+                    dest.check(&get_expected(done), &context);
+                }
+                let mut dest = GuardedBuffer::new(tile_count * 64, misalignment);
+                unsafe {
+                    linear_to_tiled(
+                        dest.as_mut_ptr(),
+                        src.as_mut_ptr(),
+                        src_row_pitch,
+                        tile_count,
+                    )
+                };
+                let context = format!("{} tiles at +{}", tile_count, misalignment);
+                dest.check(&get_expected(tile_count), &context);
+            }
+        }
+
+        #[test]
+        fn test_tiled_to_linear() {
+            for (tile_count, misalignment) in get_cases() {
+                // the bytes between rows have to be left alone
+                let dest_row_pitch = tile_count * 16 + 4;
+                let dest_size = dest_row_pitch * 3 + tile_count * 16;
+                let src = get_test_bytes(tile_count * 64, tile_count);
+                let get_expected = |done: usize| {
+                    let mut expected = vec![GUARD; dest_size];
+                    for tile in 0..done {
+                        for row in 0..4 {
+                            expected[row * dest_row_pitch + tile * 16..][..16]
+                                .copy_from_slice(&src[tile * 64 + row * 16..][..16]);
+                        }
+                    }
+                    expected
+                };
+                let mut src = GuardedBuffer::with_contents(&src, 3 - misalignment);
+                for path in simd::get_test_paths() {
+                    let mut dest = GuardedBuffer::new(dest_size, misalignment);
+                    let done = unsafe {
+                        (path.tiled_to_linear)(
+                            dest.as_mut_ptr(),
+                            dest_row_pitch,
+                            src.as_mut_ptr(),
+                            tile_count,
+                        )
+                    };
+                    assert!(done <= tile_count);
+                    let context =
+                        format!("{}: {} tiles at +{}", path.name, tile_count, misalignment);
+                    dest.check(&get_expected(done), &context);
+                }
+                let mut dest = GuardedBuffer::new(dest_size, misalignment);
+                unsafe {
+                    tiled_to_linear(
+                        dest.as_mut_ptr(),
+                        dest_row_pitch,
+                        src.as_mut_ptr(),
+                        tile_count,
+                    )
+                };
+                let context = format!("{} tiles at +{}", tile_count, misalignment);
+                dest.check(&get_expected(tile_count), &context);
+            }
+        }
+
+        #[test]
+        fn test_swap_red_blue() {
+            for (pixel_count, misalignment) in get_cases() {
+                let src = get_test_bytes(pixel_count * 4, pixel_count);
+                let expected: Vec<u8> = src
+                    .chunks(4)
+                    .flat_map(|pixel| vec![pixel[2], pixel[1], pixel[0], pixel[3]])
+                    .collect();
+                let mut src = GuardedBuffer::with_contents(&src, 3 - misalignment);
+                for path in simd::get_test_paths() {
+                    let mut dest = GuardedBuffer::new(pixel_count * 4, misalignment);
+                    let done = unsafe {
+                        (path.swap_red_blue)(dest.as_mut_ptr(), src.as_mut_ptr(), pixel_count)
+                    };
+                    assert!(done <= pixel_count);
+                    let context =
+                        format!("{}: {} pixels at +{}", path.name, pixel_count, misalignment);
+                    dest.check(&get_prefix(&expected, done, 4), &context);
+                }
+                let mut dest = GuardedBuffer::new(pixel_count * 4, misalignment);
+                unsafe { swap_red_blue(dest.as_mut_ptr(), src.as_mut_ptr(), pixel_count) };
+                let context = format!("{} pixels at +{}", pixel_count, misalignment);
+                dest.check(&expected, &context);
+            }
+        }
+
+        fn check_resolve_4x(src: &[u8], misalignment: usize) {
+            let pixel_count = src.len() / 16;
+            let expected: Vec<u8> = src
+                .chunks(16)
+                .flat_map(|samples| {
+                    (0..4).map(move |channel| {
+                        let sum: u32 = (0..4)
+                            .map(|sample| u32::from(samples[sample * 4 + channel]))
+                            .sum();
+                        ((sum + 2) / 4) as u8
+                    })
+                })
+                .collect();
+            let mut src = GuardedBuffer::with_contents(src, 3 - misalignment);
+            for path in simd::get_test_paths() {
+                let mut dest = GuardedBuffer::new(pixel_count * 4, misalignment);
+                let done =
+                    unsafe { (path.resolve_4x)(dest.as_mut_ptr(), src.as_mut_ptr(), pixel_count) };
+                assert!(done <= pixel_count);
+                let context = format!("{}: {} pixels at +{}", path.name, pixel_count, misalignment);
+                dest.check(&get_prefix(&expected, done, 4), &context);
+            }
+            let mut dest = GuardedBuffer::new(pixel_count * 4, misalignment);
+            unsafe { resolve_4x(dest.as_mut_ptr(), src.as_mut_ptr(), pixel_count) };
+            dest.check(
+                &expected,
+                &format!("{} pixels at +{}", pixel_count, misalignment),
+            );
+        }
+
+        #[test]
+        fn test_resolve_4x() {
+            for (pixel_count, misalignment) in get_cases() {
+                check_resolve_4x(&get_test_bytes(pixel_count * 16, pixel_count), misalignment);
+            }
+        }
+
+        /// halves round up, and the sums of the largest samples don't overflow
+        #[test]
+        fn test_resolve_4x_rounding() {
+            let sample_sets: &[[u8; 4]] = &[
+                [0, 0, 0, 1],
+                [0, 0, 1, 1],
+                [0, 1, 1, 1],
+                [1, 1, 1, 1],
+                [254, 255, 255, 255],
+                [255, 255, 255, 255],
+                [0, 0, 0, 255],
+                [0, 0, 255, 255],
+                [127, 128, 128, 128],
+            ];
+            // each channel gets a different set, and each pixel a different rotation of them
+            let mut src = Vec::new();
+            for pixel in 0..sample_sets.len() {
+                for sample in 0..4 {
+                    for channel in 0..4 {
+                        src.push(sample_sets[(pixel + channel) % sample_sets.len()][sample]);
+                    }
+                }
+            }
+            for misalignment in 0..4 {
+                check_resolve_4x(&src, misalignment);
+            }
+        }
+
+        #[test]
+        fn test_copy_non_temporal() {
+            // the stores are 16-byte aligned, so every alignment of the head is tried
+            for size in 0..=70 {
+                for misalignment in 0..16 {
+                    let src = get_test_bytes(size, size);
+                    let mut src = GuardedBuffer::with_contents(&src, 15 - misalignment);
+                    let mut dest = GuardedBuffer::new(size, misalignment);
+                    unsafe { copy_non_temporal(dest.as_mut_ptr(), src.as_mut_ptr(), size) };
+                    dest.check(
+                        &get_test_bytes(size, size),
+                        &format!("{} bytes at +{}", size, misalignment),
+                    );
+                }
+            }
+        }
+    }
+}
+
+unsafe fn get_buffer_memory(buffer: &Buffer) -> (*mut u8, bool) {
+    let memory = buffer.memory.as_ref().unwrap();
+    (
+        memory.device_memory.get().as_ptr().add(memory.offset),
+        memory.device_memory.memory_type() == DeviceMemoryType::Streaming,
+    )
+}
+
+unsafe fn get_image_memory(image: &Image) -> (*mut u8, bool) {
+    let memory = image.memory.as_ref().unwrap();
+    (
+        memory.device_memory.get().as_ptr().add(memory.offset),
+        memory.device_memory.memory_type() == DeviceMemoryType::Streaming,
+    )
+}
+
+/// copies with non-temporal stores when `dest` is in streaming memory
+unsafe fn copy_bytes(dest: *mut u8, src: *const u8, size: usize, streaming: bool) {
+    if streaming {
+        copy_non_temporal(dest, src, size);
+    } else {
+        ptr::copy_nonoverlapping(src, dest, size);
+    }
+}
+
+/// calls `body` on consecutive pieces of `0..size`, in parallel
+fn for_each_byte_range(
+    context: &ExecutionContext,
+    size: usize,
+    body: &(dyn Fn(usize, usize) + Sync),
+) {
+    let piece_count = (size + MIN_BYTES_PER_TASK - 1) / MIN_BYTES_PER_TASK;
+    context.parallel_for(piece_count, 1, &|pieces| {
+        let start = pieces.start * MIN_BYTES_PER_TASK;
+        let end = size.min(pieces.end * MIN_BYTES_PER_TASK);
+        body(start, end - start);
+    });
+}
+
+/// a mip level and array layer of an image, or the part of a buffer that is copied to or
+/// from one
+#[derive(Copy, Clone)]
+struct Surface {
+    memory: *mut u8,
+    streaming: bool,
+    tiling: Tiling,
+    pixel_size_in_bytes: usize,
+    row_pitch: usize,
+    depth_pitch: usize,
+}
+
+// the application keeps the memory alive and unaliased until the command finishes
+unsafe impl Send for Surface {}
+unsafe impl Sync for Surface {}
+
+impl Surface {
+    unsafe fn for_image(
+        image: &Image,
+        image_layout: api::VkImageLayout,
+        mip_level: u32,
+        array_layer: u32,
+    ) -> Self {
+        let tiling = image.properties.get_tiling(image_layout);
+        let layout = image
+            .properties
+            .get_subresource_layout(tiling, mip_level, array_layer);
+        let (memory, streaming) = get_image_memory(image);
+        Self {
+            memory: memory.add(layout.offset),
+            streaming,
+            tiling,
+            pixel_size_in_bytes: image.properties.get_pixel_size_in_bytes(),
+            row_pitch: layout.row_pitch,
+            depth_pitch: layout.depth_pitch,
+        }
+    }
+    /// `layer` counts from `region.imageSubresource.baseArrayLayer`
+    unsafe fn for_buffer(
+        buffer: &Buffer,
+        region: &api::VkBufferImageCopy,
+        pixel_size_in_bytes: usize,
+        layer: u32,
+    ) -> Self {
+        let row_length = match region.bufferRowLength {
+            0 => region.imageExtent.width,
+            row_length => row_length,
+        } as usize;
+        let image_height = match region.bufferImageHeight {
+            0 => region.imageExtent.height,
+            image_height => image_height,
+        } as usize;
+        let row_pitch = row_length * pixel_size_in_bytes;
+        let depth_pitch = row_pitch * image_height;
+        let layer_pitch = depth_pitch * region.imageExtent.depth as usize;
+        let (memory, streaming) = get_buffer_memory(buffer);
+        Self {
+            memory: memory.add(region.bufferOffset as usize + layer_pitch * layer as usize),
+            streaming,
+            tiling: Tiling::Linear,
+            pixel_size_in_bytes,
+            row_pitch,
+            depth_pitch,
+        }
+    }
+    unsafe fn get_pixel(&self, x: usize, y: usize, z: usize) -> *mut u8 {
+        let offset_in_slice =
+            self.tiling
+                .get_offset_in_slice(self.pixel_size_in_bytes, self.row_pitch, x, y);
+        self.memory.add(z * self.depth_pitch + offset_in_slice)
+    }
+}
+
+fn to_offset(offset: api::VkOffset3D) -> [usize; 3] {
+    assert!(offset.x >= 0 && offset.y >= 0 && offset.z >= 0);
+    [offset.x as usize, offset.y as usize, offset.z as usize]
+}
+
+fn to_extent(extent: api::VkExtent3D) -> [usize; 3] {
+    [
+        extent.width as usize,
+        extent.height as usize,
+        extent.depth as usize,
+    ]
+}
+
+/// what is done to each run of pixels by `transfer_pixels`
+#[derive(Copy, Clone, Eq, PartialEq)]
+enum PixelKernel {
+    Copy,
+    SwapRedBlue,
+    Resolve4x,
+}
+
+impl PixelKernel {
+    unsafe fn run(self, dest: &Surface, dest_pixel: *mut u8, src_pixel: *const u8, count: usize) {
+        match self {
+            PixelKernel::Copy => copy_bytes(
+                dest_pixel,
+                src_pixel,
+                count * dest.pixel_size_in_bytes,
+                dest.streaming,
+            ),
+            PixelKernel::SwapRedBlue => kernels::swap_red_blue(dest_pixel, src_pixel, count),
+            PixelKernel::Resolve4x => kernels::resolve_4x(dest_pixel, src_pixel, count),
+        }
+    }
+}
+
+/// runs `kernel` over `columns` of a row, split into runs that are contiguous in both
+/// surfaces
+unsafe fn transfer_row(
+    kernel: PixelKernel,
+    dest: &Surface,
+    [dest_x, dest_y, dest_z]: [usize; 3],
+    src: &Surface,
+    [src_x, src_y, src_z]: [usize; 3],
+    columns: std::ops::Range<usize>,
+) {
+    let mut x = columns.start;
+    while x < columns.end {
+        let count = dest
+            .tiling
+            .get_contiguous_pixel_count(dest_x + x, columns.end - x);
+        let count = src.tiling.get_contiguous_pixel_count(src_x + x, count);
+        kernel.run(
+            dest,
+            dest.get_pixel(dest_x + x, dest_y, dest_z),
+            src.get_pixel(src_x + x, src_y, src_z),
+            count,
+        );
+        x += count;
+    }
+}
+
+/// copies a band of `TILE_SIZE` rows aligned to the tiles of whichever surface is tiled,
+/// using the tiling conversion kernels for the whole tiles
+unsafe fn copy_tile_band(
+    dest: &Surface,
+    [dest_x, dest_y, dest_z]: [usize; 3],
+    src: &Surface,
+    [src_x, src_y, src_z]: [usize; 3],
+    width: usize,
+) -> bool {
+    let tile_size = TILE_SIZE as usize;
+    if dest.pixel_size_in_bytes != 4 || dest.streaming || dest.tiling == src.tiling {
+        return false;
+    }
+    let (tiled_x, tiled_y) = match dest.tiling {
+        Tiling::Tiled => (dest_x, dest_y),
+        Tiling::Linear => (src_x, src_y),
+    };
+    if tiled_y % tile_size != 0 {
+        return false;
+    }
+    let head = ((tile_size - tiled_x % tile_size) % tile_size).min(width);
+    let tile_count = (width - head) / tile_size;
+    for row in 0..tile_size {
+        transfer_row(
+            PixelKernel::Copy,
+            dest,
+            [dest_x, dest_y + row, dest_z],
+            src,
+            [src_x, src_y + row, src_z],
+            0..head,
+        );
+        transfer_row(
+            PixelKernel::Copy,
+            dest,
+            [dest_x, dest_y + row, dest_z],
+            src,
+            [src_x, src_y + row, src_z],
+            head + tile_count * tile_size..width,
+        );
+    }
+    let dest_pixel = dest.get_pixel(dest_x + head, dest_y, dest_z);
+    let src_pixel = src.get_pixel(src_x + head, src_y, src_z);
+    match dest.tiling {
+        Tiling::Tiled => kernels::linear_to_tiled(dest_pixel, src_pixel, src.row_pitch, tile_count),
+        Tiling::Linear => {
+            kernels::tiled_to_linear(dest_pixel, dest.row_pitch, src_pixel, tile_count)
+        }
+    }
+    true
+}
+
+/// runs `kernel` over the `extent` box of pixels, in parallel
+fn transfer_pixels(
+    context: &ExecutionContext,
+    kernel: PixelKernel,
+    dest: Surface,
+    dest_offset: [usize; 3],
+    src: Surface,
+    src_offset: [usize; 3],
+    extent: [usize; 3],
+) {
+    let [width, height, depth] = extent;
+    let tile_size = TILE_SIZE as usize;
+    // align the bands to the tiles, so whole tiles can go through the tiling conversion
+    // kernels and each tile is only written by one task
+    let band_alignment = match (dest.tiling, src.tiling) {
+        (Tiling::Linear, Tiling::Tiled) => src_offset[1] % tile_size,
+        _ => dest_offset[1] % tile_size,
+    };
+    let bands_per_slice = (band_alignment + height + tile_size - 1) / tile_size;
+    let band_size_in_bytes = width * tile_size * dest.pixel_size_in_bytes;
+    context.parallel_for(
+        bands_per_slice * depth,
+        MIN_BYTES_PER_TASK / band_size_in_bytes.max(1),
+        &|bands| unsafe {
+            for band in bands {
+                let z = band / bands_per_slice;
+                let band_in_slice = band % bands_per_slice;
+                let rows = (band_in_slice * tile_size).max(band_alignment) - band_alignment
+                    ..((band_in_slice + 1) * tile_size - band_alignment).min(height);
+                let offsets =
+                    |offset: [usize; 3], y: usize| [offset[0], offset[1] + y, offset[2] + z];
+                if kernel == PixelKernel::Copy
+                    && rows.end - rows.start == tile_size
+                    && copy_tile_band(
+                        &dest,
+                        offsets(dest_offset, rows.start),
+                        &src,
+                        offsets(src_offset, rows.start),
+                        width,
+                    )
+                {
+                    continue;
+                }
+                for y in rows {
+                    transfer_row(
+                        kernel,
+                        &dest,
+                        offsets(dest_offset, y),
+                        &src,
+                        offsets(src_offset, y),
+                        0..width,
+                    );
+                }
+            }
+        },
+    );
+}
+
+/// the formats transfers and attachments can convert between
+#[derive(Copy, Clone, Eq, PartialEq, Debug)]
+pub struct ColorFormat {
+    blue_first: bool,
+    srgb: bool,
+}
+
+impl ColorFormat {
+    pub fn new(format: api::VkFormat) -> Self {
+        match format {
+            api::VK_FORMAT_R8G8B8A8_UNORM => ColorFormat {
+                blue_first: false,
+                srgb: false,
+            },
+            api::VK_FORMAT_R8G8B8A8_SRGB => ColorFormat {
+                blue_first: false,
+                srgb: true,
+            },
+            api::VK_FORMAT_B8G8R8A8_UNORM => ColorFormat {
+                blue_first: true,
+                srgb: false,
+            },
+            api::VK_FORMAT_B8G8R8A8_SRGB => ColorFormat {
+                blue_first: true,
+                srgb: true,
+            },
+            _ => unimplemented!("color format {}", format),
+        }
+    }
+    /// returns RGBA, with sRGB converted to linear
+    pub fn decode(self, pixel: [u8; 4]) -> [f32; 4] {
+        let mut retval = [0.0; 4];
+        for (channel, value) in retval.iter_mut().enumerate() {
+            *value = f32::from(pixel[channel]) / 255.0;
+            if self.srgb && channel != 3 {
+                *value = if *value <= 0.04045 {
+                    *value / 12.92
+                } else {
+                    ((*value + 0.055) / 1.055).powf(2.4)
+                };
+            }
+        }
+        if self.blue_first {
+            retval.swap(0, 2);
+        }
+        retval
+    }
+    pub fn encode(self, mut color: [f32; 4]) -> [u8; 4] {
+        if self.blue_first {
+            color.swap(0, 2);
+        }
+        let mut retval = [0; 4];
+        for (channel, value) in retval.iter_mut().enumerate() {
+            let mut color = color[channel].max(0.0).min(1.0);
+            if self.srgb && channel != 3 {
+                color = if color <= 0.003_130_8 {
+                    color * 12.92
+                } else {
+                    1.055 * color.powf(1.0 / 2.4) - 0.055
+                };
+            }
+            *value = (color * 255.0).round() as u8;
+        }
+        retval
+    }
+}
+
+unsafe fn get_buffer_range(
+    buffer: &Buffer,
+    offset: api::VkDeviceSize,
+    size: api::VkDeviceSize,
+) -> (*mut u8, bool) {
+    assert!(offset.checked_add(size).unwrap() <= buffer.size as u64);
+    let (memory, streaming) = get_buffer_memory(buffer);
+    (memory.add(offset as usize), streaming)
+}
+
+pub unsafe fn copy_buffer(
+    context: &ExecutionContext,
+    src_buffer: &Buffer,
+    dst_buffer: &Buffer,
+    regions: &[api::VkBufferCopy],
+) {
+    for region in regions {
+        let (src, _) = get_buffer_range(src_buffer, region.srcOffset, region.size);
+        let (dest, streaming) = get_buffer_range(dst_buffer, region.dstOffset, region.size);
+        let (src, dest) = (src as usize, dest as usize);
+        for_each_byte_range(context, region.size as usize, &|offset, size| {
+            copy_bytes(
+                (dest + offset) as *mut u8,
+                (src + offset) as *const u8,
+                size,
+                streaming,
+            )
+        });
+    }
+}
+
+pub unsafe fn update_buffer(dst_buffer: &Buffer, dst_offset: api::VkDeviceSize, data: &[u8]) {
+    let (dest, streaming) = get_buffer_range(dst_buffer, dst_offset, data.len() as u64);
+    copy_bytes(dest, data.as_ptr(), data.len(), streaming);
+}
+
+pub unsafe fn fill_buffer(
+    context: &ExecutionContext,
+    dst_buffer: &Buffer,
+    dst_offset: api::VkDeviceSize,
+    size: api::VkDeviceSize,
+    data: u32,
+) {
+    let size = if size == api::VK_WHOLE_SIZE as api::VkDeviceSize {
+        (dst_buffer.size as u64 - dst_offset) & !3
+    } else {
+        size
+    };
+    let (dest, _) = get_buffer_range(dst_buffer, dst_offset, size);
+    let dest = dest as usize;
+    for_each_byte_range(context, size as usize, &|offset, size| {
+        kernels::fill_u32((dest + offset) as *mut u8, size / 4, data)
+    });
+}
+
+pub unsafe fn copy_image(
+    context: &ExecutionContext,
+    src_image: &Image,
+    src_image_layout: api::VkImageLayout,
+    dst_image: &Image,
+    dst_image_layout: api::VkImageLayout,
+    regions: &[api::VkImageCopy],
+) {
+    for region in regions {
+        assert_eq!(
+            src_image.properties.get_pixel_size_in_bytes(),
+            dst_image.properties.get_pixel_size_in_bytes()
+        );
+        assert_eq!(
+            region.srcSubresource.layerCount,
+            region.dstSubresource.layerCount
+        );
+        for layer in 0..region.srcSubresource.layerCount {
+            transfer_pixels(
+                context,
+                PixelKernel::Copy,
+                Surface::for_image(
+                    dst_image,
+                    dst_image_layout,
+                    region.dstSubresource.mipLevel,
+                    region.dstSubresource.baseArrayLayer + layer,
+                ),
+                to_offset(region.dstOffset),
+                Surface::for_image(
+                    src_image,
+                    src_image_layout,
+                    region.srcSubresource.mipLevel,
+                    region.srcSubresource.baseArrayLayer + layer,
+                ),
+                to_offset(region.srcOffset),
+                to_extent(region.extent),
+            );
+        }
+    }
+}
+
+pub unsafe fn copy_buffer_to_image(
+    context: &ExecutionContext,
+    src_buffer: &Buffer,
+    dst_image: &Image,
+    dst_image_layout: api::VkImageLayout,
+    regions: &[api::VkBufferImageCopy],
+) {
+    assert_eq!(
+        dst_image.properties.multisample_count,
+        ImageMultisampleCount::Count1
+    );
+    let pixel_size_in_bytes = dst_image.properties.get_pixel_size_in_bytes();
+    for region in regions {
+        let subresource = &region.imageSubresource;
+        for layer in 0..subresource.layerCount {
+            transfer_pixels(
+                context,
+                PixelKernel::Copy,
+                Surface::for_image(
+                    dst_image,
+                    dst_image_layout,
+                    subresource.mipLevel,
+                    subresource.baseArrayLayer + layer,
+                ),
+                to_offset(region.imageOffset),
+                Surface::for_buffer(src_buffer, region, pixel_size_in_bytes, layer),
+                [0; 3],
+                to_extent(region.imageExtent),
+            );
+        }
+    }
+}
+
+pub unsafe fn copy_image_to_buffer(
+    context: &ExecutionContext,
+    src_image: &Image,
+    src_image_layout: api::VkImageLayout,
+    dst_buffer: &Buffer,
+    regions: &[api::VkBufferImageCopy],
+) {
+    assert_eq!(
+        src_image.properties.multisample_count,
+        ImageMultisampleCount::Count1
+    );
+    let pixel_size_in_bytes = src_image.properties.get_pixel_size_in_bytes();
+    for region in regions {
+        let subresource = &region.imageSubresource;
+        for layer in 0..subresource.layerCount {
+            transfer_pixels(
+                context,
+                PixelKernel::Copy,
+                Surface::for_buffer(dst_buffer, region, pixel_size_in_bytes, layer),
+                [0; 3],
+                Surface::for_image(
+                    src_image,
+                    src_image_layout,
+                    subresource.mipLevel,
+                    subresource.baseArrayLayer + layer,
+                ),
+                to_offset(region.imageOffset),
+                to_extent(region.imageExtent),
+            );
+        }
+    }
+}
+
+/// the mip levels and array layers in `range`
+fn get_subresources(
+    image: &Image,
+    range: &api::VkImageSubresourceRange,
+) -> impl Iterator<Item = (u32, u32)> {
+    let level_count = if range.levelCount == api::VK_REMAINING_MIP_LEVELS as u32 {
+        image.properties.mip_levels - range.baseMipLevel
+    } else {
+        range.levelCount
+    };
+    let layer_count = if range.layerCount == api::VK_REMAINING_ARRAY_LAYERS as u32 {
+        image.properties.array_layers - range.baseArrayLayer
+    } else {
+        range.layerCount
+    };
+    let (base_mip_level, base_array_layer) = (range.baseMipLevel, range.baseArrayLayer);
+    (base_mip_level..base_mip_level + level_count).flat_map(move |mip_level| {
+        (base_array_layer..base_array_layer + layer_count)
+            .map(move |array_layer| (mip_level, array_layer))
+    })
+}
+
+pub unsafe fn clear_color_image(
+    context: &ExecutionContext,
+    image: &Image,
+    image_layout: api::VkImageLayout,
+    color: &api::VkClearColorValue,
+    ranges: &[api::VkImageSubresourceRange],
+) {
+    let pixel = ColorFormat::new(image.properties.format).encode(color.float32);
+    fill_subresources(
+        context,
+        image,
+        image_layout,
+        ranges,
+        api::VK_IMAGE_ASPECT_COLOR_BIT,
+        u32::from_ne_bytes(pixel),
+    );
+}
+
+pub unsafe fn clear_depth_stencil_image(
+    context: &ExecutionContext,
+    image: &Image,
+    image_layout: api::VkImageLayout,
+    depth_stencil: &api::VkClearDepthStencilValue,
+    ranges: &[api::VkImageSubresourceRange],
+) {
+    // the only depth/stencil format images can be created with
+    assert_eq!(image.properties.format, api::VK_FORMAT_D32_SFLOAT);
+    fill_subresources(
+        context,
+        image,
+        image_layout,
+        ranges,
+        api::VK_IMAGE_ASPECT_DEPTH_BIT,
+        depth_stencil.depth.to_bits(),
+    );
+}
+
+/// sets every 4-byte pixel of the subresources in `ranges` to `value`
+unsafe fn fill_subresources(
+    context: &ExecutionContext,
+    image: &Image,
+    image_layout: api::VkImageLayout,
+    ranges: &[api::VkImageSubresourceRange],
+    aspect_mask: api::VkImageAspectFlags,
+    value: u32,
+) {
+    let tiling = image.properties.get_tiling(image_layout);
+    let (memory, _) = get_image_memory(image);
+    for range in ranges {
+        assert_eq!(range.aspectMask, aspect_mask);
+        for (mip_level, array_layer) in get_subresources(image, range) {
+            // every sample gets the same value, and the padding in partial tiles can be
+            // overwritten too, so the whole subresource is filled at once
+            let layout = image
+                .properties
+                .get_subresource_layout(tiling, mip_level, array_layer);
+            let dest = memory.add(layout.offset) as usize;
+            for_each_byte_range(context, layout.size, &|offset, size| {
+                kernels::fill_u32((dest + offset) as *mut u8, size / 4, value)
+            });
+        }
+    }
+}
+
+pub unsafe fn resolve_image(
+    context: &ExecutionContext,
+    src_image: &Image,
+    src_image_layout: api::VkImageLayout,
+    dst_image: &Image,
+    dst_image_layout: api::VkImageLayout,
+    regions: &[api::VkImageResolve],
+) {
+    assert_eq!(
+        src_image.properties.multisample_count,
+        ImageMultisampleCount::Count4
+    );
+    assert_eq!(
+        dst_image.properties.multisample_count,
+        ImageMultisampleCount::Count1
+    );
+    assert_eq!(dst_image.properties.get_pixel_size_in_bytes(), 4);
+    for region in regions {
+        for layer in 0..region.srcSubresource.layerCount {
+            transfer_pixels(
+                context,
+                PixelKernel::Resolve4x,
+                Surface::for_image(
+                    dst_image,
+                    dst_image_layout,
+                    region.dstSubresource.mipLevel,
+                    region.dstSubresource.baseArrayLayer + layer,
+                ),
+                to_offset(region.dstOffset),
+                Surface::for_image(
+                    src_image,
+                    src_image_layout,
+                    region.srcSubresource.mipLevel,
+                    region.srcSubresource.baseArrayLayer + layer,
+                ),
+                to_offset(region.srcOffset),
+                to_extent(region.extent),
+            );
+        }
+    }
+}
+
+/// blits that don't scale or flip are copies, possibly with red and blue swapped
+fn get_unscaled_blit(
+    region: &api::VkImageBlit,
+    src_format: ColorFormat,
+    dest_format: ColorFormat,
+) -> Option<(PixelKernel, [usize; 3], [usize; 3], [usize; 3])> {
+    let [src_start, src_end] = region.srcOffsets;
+    let [dest_start, dest_end] = region.dstOffsets;
+    let get_size = |start: api::VkOffset3D, end: api::VkOffset3D| {
+        if end.x >= start.x && end.y >= start.y && end.z >= start.z {
+            Some([
+                (end.x - start.x) as usize,
+                (end.y - start.y) as usize,
+                (end.z - start.z) as usize,
+            ])
+        } else {
+            None
+        }
+    };
+    let extent = get_size(src_start, src_end)?;
+    if get_size(dest_start, dest_end)? != extent || src_format.srgb != dest_format.srgb {
+        return None;
+    }
+    let kernel = if src_format == dest_format {
+        PixelKernel::Copy
+    } else {
+        PixelKernel::SwapRedBlue
+    };
+    Some((kernel, to_offset(dest_start), to_offset(src_start), extent))
+}
+
+/// maps destination pixel centers to source coordinates along one axis
+#[derive(Clone)]
+struct BlitAxis {
+    dest_range: std::ops::Range<i32>,
+    dest_start: f32,
+    src_start: f32,
+    scale: f32,
+    src_size: u32,
+}
+
+impl BlitAxis {
+    fn new(src: [i32; 2], dest: [i32; 2], src_size: u32) -> Self {
+        Self {
+            dest_range: dest[0].min(dest[1])..dest[0].max(dest[1]),
+            dest_start: dest[0] as f32,
+            src_start: src[0] as f32,
+            scale: (src[1] - src[0]) as f32 / (dest[1] - dest[0]) as f32,
+            src_size,
+        }
+    }
+    fn get_src_coordinate(&self, dest: i32) -> f32 {
+        self.src_start + (dest as f32 + 0.5 - self.dest_start) * self.scale
+    }
+    fn clamp(&self, v: f32) -> usize {
+        (v.max(0.0) as usize).min(self.src_size as usize - 1)
+    }
+    fn get_nearest(&self, dest: i32) -> usize {
+        self.clamp(self.get_src_coordinate(dest).floor())
+    }
+    /// the two source pixels to interpolate between and the weight of the second
+    fn get_linear(&self, dest: i32) -> (usize, usize, f32) {
+        let v = self.get_src_coordinate(dest) - 0.5;
+        let floor = v.floor();
+        (self.clamp(floor), self.clamp(floor + 1.0), v - floor)
+    }
+}
+
+fn lerp(a: [f32; 4], b: [f32; 4], t: f32) -> [f32; 4] {
+    let mut retval = a;
+    for (channel, value) in retval.iter_mut().enumerate() {
+        *value += (b[channel] - a[channel]) * t;
+    }
+    retval
+}
+
+pub unsafe fn blit_image(
+    context: &ExecutionContext,
+    src_image: &Image,
+    src_image_layout: api::VkImageLayout,
+    dst_image: &Image,
+    dst_image_layout: api::VkImageLayout,
+    regions: &[api::VkImageBlit],
+    filter: api::VkFilter,
+) {
+    let src_format = ColorFormat::new(src_image.properties.format);
+    let dest_format = ColorFormat::new(dst_image.properties.format);
+    for region in regions {
+        let unscaled_blit = get_unscaled_blit(region, src_format, dest_format);
+        let src_extents = src_image
+            .properties
+            .get_mip_level_extents(region.srcSubresource.mipLevel);
+        let [src_start, src_end] = region.srcOffsets;
+        let [dest_start, dest_end] = region.dstOffsets;
+        let axes = [
+            BlitAxis::new(
+                [src_start.x, src_end.x],
+                [dest_start.x, dest_end.x],
+                src_extents.width,
+            ),
+            BlitAxis::new(
+                [src_start.y, src_end.y],
+                [dest_start.y, dest_end.y],
+                src_extents.height,
+            ),
+            BlitAxis::new(
+                [src_start.z, src_end.z],
+                [dest_start.z, dest_end.z],
+                src_extents.depth,
+            ),
+        ];
+        for layer in 0..region.srcSubresource.layerCount {
+            let dest = Surface::for_image(
+                dst_image,
+                dst_image_layout,
+                region.dstSubresource.mipLevel,
+                region.dstSubresource.baseArrayLayer + layer,
+            );
+            let src = Surface::for_image(
+                src_image,
+                src_image_layout,
+                region.srcSubresource.mipLevel,
+                region.srcSubresource.baseArrayLayer + layer,
+            );
+            if let Some((kernel, dest_offset, src_offset, extent)) = unscaled_blit {
+                transfer_pixels(context, kernel, dest, dest_offset, src, src_offset, extent);
+                continue;
+            }
+            let read = |x: usize, y: usize, z: usize| {
+                src_format.decode(ptr::read_unaligned(src.get_pixel(x, y, z) as *const [u8; 4]))
+            };
+            let [x_axis, y_axis, z_axis] = &axes;
+            let height = y_axis.dest_range.len();
+            let row_count = height * z_axis.dest_range.len();
+            context.parallel_for(row_count, 1, &|rows| {
+                for row in rows {
+                    let dest_y = y_axis.dest_range.start + (row % height) as i32;
+                    let dest_z = z_axis.dest_range.start + (row / height) as i32;
+                    // 3D blits only filter within each slice
+                    let src_z = z_axis.get_nearest(dest_z);
+                    for dest_x in x_axis.dest_range.clone() {
+                        let color = if filter == api::VK_FILTER_LINEAR {
+                            let (x0, x1, x_weight) = x_axis.get_linear(dest_x);
+                            let (y0, y1, y_weight) = y_axis.get_linear(dest_y);
+                            lerp(
+                                lerp(read(x0, y0, src_z), read(x1, y0, src_z), x_weight),
+                                lerp(read(x0, y1, src_z), read(x1, y1, src_z), x_weight),
+                                y_weight,
+                            )
+                        } else {
+                            read(
+                                x_axis.get_nearest(dest_x),
+                                y_axis.get_nearest(dest_y),
+                                src_z,
+                            )
+                        };
+                        ptr::write_unaligned(
+                            dest.get_pixel(dest_x as usize, dest_y as usize, dest_z as usize)
+                                as *mut [u8; 4],
+                            dest_format.encode(color),
+                        );
+                    }
+                }
+            });
+        }
+    }
+}
@@ -0,0 +1,242 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// See Notices.txt for copyright information
+
+//! work-stealing thread pool that command-buffer execution is split across
+
+use std::cell::Cell;
+use std::collections::VecDeque;
+use std::fmt;
+use std::ops::Range;
+use std::panic::{self, AssertUnwindSafe};
+use std::sync::atomic::{AtomicBool, AtomicUsize, Ordering};
+use std::sync::{Arc, Condvar, Mutex};
+use std::thread;
+use sys_info;
+
+thread_local! {
+    static CURRENT_WORKER_INDEX: Cell<Option<usize>> = Cell::new(None);
+}
+
+/// the index of the worker the current thread is, if it's one of a `WorkerPool`'s workers
+pub fn current_worker_index() -> Option<usize> {
+    CURRENT_WORKER_INDEX.with(Cell::get)
+}
+
+struct Batch {
+    /// the lifetime is erased; `WorkerPool::parallel_for` doesn't return until every `Task`
+    /// referencing this `Batch` has finished running
+    body: *const (dyn Fn(Range<usize>) + Sync + 'static),
+    remaining_task_count: Mutex<usize>,
+    done: Condvar,
+    panicked: AtomicBool,
+}
+
+unsafe impl Send for Batch {}
+unsafe impl Sync for Batch {}
+
+struct Task {
+    batch: Arc<Batch>,
+    range: Range<usize>,
+}
+
+impl Task {
+    fn run(self) {
+        let Task { batch, range } = self;
+        let body = unsafe { &*batch.body };
+        if panic::catch_unwind(AssertUnwindSafe(|| body(range))).is_err() {
+            batch.panicked.store(true, Ordering::Relaxed);
+        }
+        let mut remaining_task_count = batch.remaining_task_count.lock().unwrap();
+        *remaining_task_count -= 1;
+        if *remaining_task_count == 0 {
+            batch.done.notify_all();
+        }
+    }
+}
+
+struct Shared {
+    task_queues: Vec<Mutex<VecDeque<Task>>>,
+    /// incremented before a task is pushed and decremented after it is popped, so it is never
+    /// less than the number of tasks actually in `task_queues`
+    queued_task_count: AtomicUsize,
+    sleep_lock: Mutex<()>,
+    wake: Condvar,
+    exiting: AtomicBool,
+}
+
+impl Shared {
+    /// pops from the front of `home`'s queue, otherwise steals from the back of the other queues
+    fn pop_task(&self, home: usize) -> Option<Task> {
+        let queue_count = self.task_queues.len();
+        for offset in 0..queue_count {
+            let mut task_queue = self.task_queues[(home + offset) % queue_count]
+                .lock()
+                .unwrap();
+            let task = if offset == 0 {
+                task_queue.pop_front()
+            } else {
+                task_queue.pop_back()
+            };
+            if let Some(task) = task {
+                self.queued_task_count.fetch_sub(1, Ordering::SeqCst);
+                return Some(task);
+            }
+        }
+        None
+    }
+    fn worker_main(&self, worker_index: usize) {
+        CURRENT_WORKER_INDEX.with(|v| v.set(Some(worker_index)));
+        loop {
+            if let Some(task) = self.pop_task(worker_index) {
+                task.run();
+                continue;
+            }
+            let sleep_lock = self.sleep_lock.lock().unwrap();
+            if self.exiting.load(Ordering::SeqCst) {
+                return;
+            }
+            if self.queued_task_count.load(Ordering::SeqCst) != 0 {
+                continue;
+            }
+            drop(self.wake.wait(sleep_lock).unwrap());
+        }
+    }
+}
+
+pub struct WorkerPool {
+    shared: Arc<Shared>,
+    threads: Vec<thread::JoinHandle<()>>,
+    next_home: AtomicUsize,
+}
+
+impl fmt::Debug for WorkerPool {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_struct("WorkerPool")
+            .field("worker_count", &self.worker_count())
+            .finish()
+    }
+}
+
+impl WorkerPool {
+    pub fn new(worker_count: usize) -> Self {
+        let worker_count = worker_count.max(1);
+        let shared = Arc::new(Shared {
+            task_queues: (0..worker_count)
+                .map(|_| Mutex::new(VecDeque::new()))
+                .collect(),
+            queued_task_count: AtomicUsize::new(0),
+            sleep_lock: Mutex::new(()),
+            wake: Condvar::new(),
+            exiting: AtomicBool::new(false),
+        });
+        let threads = (0..worker_count)
+            .map(|worker_index| {
+                let shared = shared.clone();
+                thread::Builder::new()
+                    .name(format!("kazan worker {}", worker_index))
+                    .spawn(move || shared.worker_main(worker_index))
+                    .unwrap()
+            })
+            .collect();
+        Self {
+            shared,
+            threads,
+            next_home: AtomicUsize::new(0),
+        }
+    }
+    /// one worker per core
+    pub fn with_default_worker_count() -> Self {
+        Self::new(sys_info::cpu_num().map(|v| v as usize).unwrap_or(1))
+    }
+    pub fn worker_count(&self) -> usize {
+        self.shared.task_queues.len()
+    }
+    /// runs `body` over `0..len` split into chunks of `chunk_size`.
+    ///
+    /// Chunks are dealt out to the workers in contiguous runs; idle workers steal from the
+    /// other end of busy workers' queues. The calling thread helps execute tasks until the
+    /// whole range is done, so it is fine to call `parallel_for` from inside `body`.
+    /// A panic in `body` is propagated to the caller after all chunks have finished.
+    pub fn parallel_for(
+        &self,
+        len: usize,
+        chunk_size: usize,
+        body: &(dyn Fn(Range<usize>) + Sync),
+    ) {
+        assert_ne!(chunk_size, 0);
+        if len == 0 {
+            return;
+        }
+        let chunk_count = (len - 1) / chunk_size + 1;
+        if chunk_count == 1 {
+            body(0..len);
+            return;
+        }
+        let body: *const (dyn Fn(Range<usize>) + Sync + '_) = body;
+        let batch = Arc::new(Batch {
+            body: unsafe {
+                // lifetime erased; see `Batch::body`
+                #[allow(clippy::transmute_ptr_to_ptr)]
+                std::mem::transmute::<
+                    *const (dyn Fn(Range<usize>) + Sync + '_),
+                    *const (dyn Fn(Range<usize>) + Sync + 'static),
+                >(body)
+            },
+            remaining_task_count: Mutex::new(chunk_count),
+            done: Condvar::new(),
+            panicked: AtomicBool::new(false),
+        });
+        let queue_count = self.worker_count();
+        let home = self.next_home.fetch_add(1, Ordering::Relaxed) % queue_count;
+        self.shared
+            .queued_task_count
+            .fetch_add(chunk_count, Ordering::SeqCst);
+        for queue_offset in 0..queue_count {
+            let chunks = (chunk_count * queue_offset / queue_count)
+                ..(chunk_count * (queue_offset + 1) / queue_count);
+            if chunks.start == chunks.end {
+                continue;
+            }
+            let mut task_queue = self.shared.task_queues[(home + queue_offset) % queue_count]
+                .lock()
+                .unwrap();
+            for chunk in chunks {
+                let start = chunk * chunk_size;
+                task_queue.push_back(Task {
+                    batch: batch.clone(),
+                    range: start..len.min(start + chunk_size),
+                });
+            }
+        }
+        {
+            let _sleep_lock = self.shared.sleep_lock.lock().unwrap();
+            self.shared.wake.notify_all();
+        }
+        while *batch.remaining_task_count.lock().unwrap() != 0 {
+            match self.shared.pop_task(home) {
+                Some(task) => task.run(),
+                None => break,
+            }
+        }
+        let mut remaining_task_count = batch.remaining_task_count.lock().unwrap();
+        while *remaining_task_count != 0 {
+            remaining_task_count = batch.done.wait(remaining_task_count).unwrap();
+        }
+        if batch.panicked.load(Ordering::Relaxed) {
+            panic!("WorkerPool::parallel_for: task panicked");
+        }
+    }
+}
+
+impl Drop for WorkerPool {
+    fn drop(&mut self) {
+        {
+            let _sleep_lock = self.shared.sleep_lock.lock().unwrap();
+            self.shared.exiting.store(true, Ordering::SeqCst);
+            self.shared.wake.notify_all();
+        }
+        for thread in self.threads.drain(..) {
+            thread.join().unwrap();
+        }
+    }
+}
@@ -1,22 +1,220 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 // See Notices.txt for copyright information
 use crate::api;
-use crate::handle::Handle;
-use crate::image::{ImageMultisampleCount, ImageProperties, SupportedTilings, Tiling};
-use crate::swapchain::{SurfaceImplementation, SurfacePlatform, Swapchain};
+use crate::device_memory::{
+    DeviceMemory, DeviceMemoryAllocation, DeviceMemoryLayout, DeviceMemoryType,
+};
+use crate::handle::{Handle, OwnedHandle, SharedHandle};
+use crate::image::{
+    Image, ImageMemory, ImageMultisampleCount, ImageProperties, SupportedTilings, Tiling,
+};
+use crate::shm::{MappedSharedMemorySegment, SharedMemorySegment};
+use crate::swapchain::{
+    get_swapchain_image_count, PresentThread, SurfaceImplementation, SurfacePlatform, Swapchain,
+    SwapchainPresenter, MAX_SWAPCHAIN_IMAGE_COUNT,
+};
+use crate::util;
 use libc;
 use std::borrow::Cow;
+use std::collections::VecDeque;
+use std::fmt;
 use std::mem;
 use std::ops::{Deref, DerefMut};
 use std::os::raw::c_char;
+use std::ptr::null;
 use std::ptr::null_mut;
 use std::ptr::NonNull;
+use std::sync::{Arc, Condvar, Mutex};
+use std::thread;
+use std::time::{Duration, Instant};
 use xcb;
 
+/// how often `acquire_next_image` checks whether the server has read an image
+const PRESENT_SYNC_POLL_INTERVAL: Duration = Duration::from_micros(100);
+
+/// swapchain image memory that the X server has attached as well, so presenting doesn't have to
+/// send the pixels through the X connection
 #[derive(Debug)]
-pub struct XcbSwapchain {}
+struct SharedImageMemory {
+    memory: MappedSharedMemorySegment,
+    layout: DeviceMemoryLayout,
+}
+
+impl SharedImageMemory {
+    /// returns `None` if the X server couldn't attach the segment, like when it's on another
+    /// machine
+    unsafe fn new(
+        connection: *mut xcb::ffi::xcb_connection_t,
+        layout: DeviceMemoryLayout,
+    ) -> Option<(Self, ShmSeg)> {
+        let segment = SharedMemorySegment::create(layout.size).ok()?;
+        let memory = segment.map().ok()?;
+        let shm_seg = xcb::ffi::xcb_generate_id(connection);
+        let error = xcb::ffi::xcb_request_check(
+            connection,
+            xcb::ffi::shm::xcb_shm_attach_checked(connection, shm_seg, segment.id() as u32, 0),
+        );
+        if !error.is_null() {
+            libc::free(error as *mut libc::c_void);
+            return None;
+        }
+        // both sides have the segment attached now, so dropping it just marks it to be
+        // removed once they detach
+        mem::drop(segment);
+        Some((
+            SharedImageMemory { memory, layout },
+            create_shm_seg(shm_seg, connection),
+        ))
+    }
+}
+
+impl DeviceMemoryAllocation for SharedImageMemory {
+    unsafe fn get(&self) -> NonNull<u8> {
+        self.memory.as_non_null()
+    }
+    fn layout(&self) -> DeviceMemoryLayout {
+        self.layout
+    }
+}
+
+struct SwapchainImage {
+    image: OwnedHandle<api::VkImage>,
+    /// dropped after `image`, since `image` refers to it
+    device_memory: OwnedHandle<api::VkDeviceMemory>,
+    /// what gets presented when the server supports the Present extension
+    pixmap: Option<Pixmap>,
+    /// whether `pixmap` uses `shm_seg` as its storage, so it doesn't have to be written before
+    /// presenting it
+    pixmap_is_shared: bool,
+    shm_seg: Option<ShmSeg>,
+}
+
+/// receives the Present extension events for a window, without going through the
+/// application's event queue
+struct PresentEventQueue {
+    connection: *mut xcb::ffi::xcb_connection_t,
+    window: xcb::ffi::xcb_window_t,
+    event_id: xcb::ffi::present::xcb_present_event_t,
+    special_event: *mut xcb::ffi::xcb_special_event_t,
+}
 
-impl Swapchain for XcbSwapchain {}
+impl PresentEventQueue {
+    unsafe fn new(
+        connection: *mut xcb::ffi::xcb_connection_t,
+        window: xcb::ffi::xcb_window_t,
+    ) -> Self {
+        let event_id = xcb::ffi::xcb_generate_id(connection);
+        xcb::ffi::present::xcb_present_select_input(
+            connection,
+            event_id,
+            window,
+            xcb::ffi::present::XCB_PRESENT_EVENT_MASK_CONFIGURE_NOTIFY
+                | xcb::ffi::present::XCB_PRESENT_EVENT_MASK_COMPLETE_NOTIFY
+                | xcb::ffi::present::XCB_PRESENT_EVENT_MASK_IDLE_NOTIFY,
+        );
+        let special_event = xcb::ffi::xcb_register_for_special_xge(
+            connection,
+            &mut xcb::ffi::present::xcb_present_id,
+            event_id,
+            null_mut(),
+        );
+        PresentEventQueue {
+            connection,
+            window,
+            event_id,
+            special_event,
+        }
+    }
+    unsafe fn poll(&self) -> Option<ReplyObject<xcb::ffi::xcb_generic_event_t>> {
+        ReplyObject::from(xcb::ffi::xcb_poll_for_special_event(
+            self.connection,
+            self.special_event,
+        ))
+    }
+    /// returns `None` if the connection failed
+    unsafe fn wait(&self) -> Option<ReplyObject<xcb::ffi::xcb_generic_event_t>> {
+        ReplyObject::from(xcb::ffi::xcb_wait_for_special_event(
+            self.connection,
+            self.special_event,
+        ))
+    }
+}
+
+impl Drop for PresentEventQueue {
+    fn drop(&mut self) {
+        unsafe {
+            xcb::ffi::present::xcb_present_select_input(
+                self.connection,
+                self.event_id,
+                self.window,
+                0,
+            );
+            xcb::ffi::xcb_unregister_for_special_event(self.connection, self.special_event);
+        }
+    }
+}
+
+struct XcbSwapchainState {
+    /// least recently presented first
+    available_images: VecDeque<u32>,
+    /// with the Present extension, the count of images presented that the server hasn't sent
+    /// an IdleNotify for yet
+    presents_pending: usize,
+    /// without the Present extension, for images that are attached to the X server, the round
+    /// trip sent after presenting them last
+    present_syncs: Vec<Option<xcb::ffi::xcb_get_input_focus_cookie_t>>,
+    present_serial: u32,
+    /// the latest msc reported by the server; `None` until the first CompleteNotify, since an
+    /// msc can be 0
+    last_complete_msc: Option<u64>,
+    /// the msc the last FIFO present was queued for
+    last_target_msc: u64,
+    out_of_date: bool,
+    /// set when presenting failed, so `vkAcquireNextImageKHR` doesn't wait for images that
+    /// won't come back
+    error: Option<api::VkResult>,
+}
+
+/// the part of an `XcbSwapchain` that is shared with its present thread
+struct XcbSwapchainShared {
+    connection: *mut xcb::ffi::xcb_connection_t,
+    window: xcb::ffi::xcb_window_t,
+    gc: Gc,
+    window_depth: u8,
+    extent: api::VkExtent2D,
+    row_pitch: usize,
+    present_mode: api::VkPresentModeKHR,
+    images: Vec<SwapchainImage>,
+    present_events: Option<PresentEventQueue>,
+    state: Mutex<XcbSwapchainState>,
+    image_available: Condvar,
+}
+
+// xcb connections can be used from any thread
+unsafe impl Send for XcbSwapchainShared {}
+unsafe impl Sync for XcbSwapchainShared {}
+
+pub struct XcbSwapchain {
+    present_thread: PresentThread,
+    shared: Arc<XcbSwapchainShared>,
+}
+
+impl fmt::Debug for XcbSwapchain {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        let shared = &*self.shared;
+        f.debug_struct("XcbSwapchain")
+            .field("window", &shared.window)
+            .field("extent", &shared.extent)
+            .field("present_mode", &shared.present_mode)
+            .field("image_count", &shared.images.len())
+            .field(
+                "shm",
+                &shared.images.iter().all(|image| image.shm_seg.is_some()),
+            )
+            .field("present_extension", &shared.present_events.is_some())
+            .finish()
+    }
+}
 
 struct ReplyObject<T>(NonNull<T>);
 
@@ -57,7 +255,6 @@ struct ServerObject<Id: 'static + Copy> {
 }
 
 impl<Id: 'static + Copy> ServerObject<Id> {
-    #[allow(dead_code)]
     fn get(&self) -> Id {
         self.id
     }
@@ -86,7 +283,6 @@ unsafe fn create_gc(
 
 type Pixmap = ServerObject<xcb::ffi::xcb_pixmap_t>;
 
-#[allow(dead_code)]
 unsafe fn create_pixmap(
     id: xcb::ffi::xcb_pixmap_t,
     connection: *mut xcb::ffi::xcb_connection_t,
@@ -100,7 +296,6 @@ unsafe fn create_pixmap(
 
 type ShmSeg = ServerObject<xcb::ffi::shm::xcb_shm_seg_t>;
 
-#[allow(dead_code)]
 unsafe fn create_shm_seg(
     id: xcb::ffi::shm::xcb_shm_seg_t,
     connection: *mut xcb::ffi::xcb_connection_t,
@@ -133,12 +328,11 @@ unsafe fn query_extension(
     xcb::ffi::xcb_query_extension(connection, len, extension_name.as_ptr() as *const c_char)
 }
 
-pub const MAX_SWAPCHAIN_IMAGE_COUNT: u32 = 16;
-
 #[allow(dead_code)]
 struct SwapchainSetupFirstStage {
     gc: Gc,
     shm_supported: bool,
+    present_supported: bool,
     window_depth: u8,
     surface_format_group: SurfaceFormatGroup,
     present_modes: &'static [api::VkPresentModeKHR],
@@ -147,6 +341,7 @@ struct SwapchainSetupFirstStage {
     image_pixel_size: usize,
     scanline_alignment: usize,
     shm_version: Option<xcb::ffi::shm::xcb_shm_query_version_cookie_t>,
+    present_version: Option<xcb::ffi::present::xcb_present_query_version_cookie_t>,
     image_properties: ImageProperties,
 }
 
@@ -158,6 +353,7 @@ impl SwapchainSetupFirstStage {
     ) -> Result<Self, SwapchainSetupError> {
         #![allow(clippy::cast_lossless)]
         let has_mit_shm = query_extension(connection, "MIT-SHM");
+        let has_present = query_extension(connection, "Present");
         let geometry = xcb::ffi::xcb_get_geometry(connection, window);
         let window_attributes = xcb::ffi::xcb_get_window_attributes(connection, window);
         let tree = xcb::ffi::xcb_query_tree(connection, window);
@@ -181,6 +377,19 @@ impl SwapchainSetupFirstStage {
         } else {
             None
         };
+        let has_present = ReplyObject::from(xcb::ffi::xcb_query_extension_reply(
+            connection,
+            has_present,
+            null_mut(),
+        ));
+        let present_supported = has_present.map(|v| v.present != 0).unwrap_or(false);
+        let present_version = if is_full_setup && present_supported {
+            Some(xcb::ffi::present::xcb_present_query_version(
+                connection, 1, 0,
+            ))
+        } else {
+            None
+        };
         let geometry = ReplyObject::from(xcb::ffi::xcb_get_geometry_reply(
             connection,
             geometry,
@@ -293,16 +502,27 @@ impl SwapchainSetupFirstStage {
             32 => 4,
             _ => unreachable!("invalid pixmap format scanline_pad"),
         };
-        const PRESENT_MODES: &[api::VkPresentModeKHR] = &[
-            api::VK_PRESENT_MODE_FIFO_KHR, // FIXME: properly implement FIFO present mode using X11 Present extension
-            api::VK_PRESENT_MODE_IMMEDIATE_KHR,
-        ];
+        let present_modes: &[api::VkPresentModeKHR] = if present_supported {
+            &[
+                api::VK_PRESENT_MODE_FIFO_KHR,
+                api::VK_PRESENT_MODE_MAILBOX_KHR,
+                api::VK_PRESENT_MODE_IMMEDIATE_KHR,
+            ]
+        } else {
+            &[
+                // without the Present extension there is no way to wait for vblank, so FIFO
+                // presents immediately, like IMMEDIATE
+                api::VK_PRESENT_MODE_FIFO_KHR,
+                api::VK_PRESENT_MODE_IMMEDIATE_KHR,
+            ]
+        };
         Ok(Self {
             gc,
             shm_supported,
+            present_supported,
             window_depth,
             surface_format_group,
-            present_modes: PRESENT_MODES,
+            present_modes,
             capabilities: api::VkSurfaceCapabilitiesKHR {
                 minImageCount: 2,
                 maxImageCount: MAX_SWAPCHAIN_IMAGE_COUNT,
@@ -324,8 +544,10 @@ impl SwapchainSetupFirstStage {
             image_pixel_size,
             scanline_alignment,
             shm_version,
+            present_version,
             image_properties: ImageProperties {
-                supported_tilings: SupportedTilings::Any,
+                // kept linear, so the X server can read the images without converting them
+                supported_tilings: SupportedTilings::LinearOnly,
                 format: api::VK_FORMAT_UNDEFINED,
                 extents: api::VkExtent3D {
                     width: image_extent.width,
@@ -343,10 +565,531 @@ impl SwapchainSetupFirstStage {
 
 impl XcbSwapchain {
     pub unsafe fn new(
-        _create_info: &api::VkSwapchainCreateInfoKHR,
+        surface: &api::VkIcdSurfaceXcb,
+        create_info: &api::VkSwapchainCreateInfoKHR,
         _device_group_create_info: Option<&api::VkDeviceGroupSwapchainCreateInfoKHR>,
     ) -> Result<Self, api::VkResult> {
-        unimplemented!()
+        let connection = surface.connection;
+        let window = surface.window;
+        let SwapchainSetupFirstStage {
+            gc,
+            shm_supported,
+            present_supported,
+            window_depth,
+            present_modes,
+            capabilities,
+            image_pixel_size,
+            shm_version,
+            present_version,
+            mut image_properties,
+            ..
+        } = SwapchainSetupFirstStage::new(connection, window, true).map_err(|v| match v {
+            SwapchainSetupError::BadSurface => api::VK_ERROR_SURFACE_LOST_KHR,
+            SwapchainSetupError::NoSupport => api::VK_ERROR_INITIALIZATION_FAILED,
+        })?;
+        let shm_version = shm_version.and_then(|shm_version| {
+            ReplyObject::from(xcb::ffi::shm::xcb_shm_query_version_reply(
+                connection,
+                shm_version,
+                null_mut(),
+            ))
+        });
+        let shm_supported = shm_supported && shm_version.is_some();
+        let shared_pixmaps = shm_version
+            .map(|v| {
+                v.shared_pixmaps != 0
+                    && u32::from(v.pixmap_format) == xcb::ffi::XCB_IMAGE_FORMAT_Z_PIXMAP as u32
+            })
+            .unwrap_or(false);
+        let present_supported = present_supported
+            && present_version
+                .and_then(|present_version| {
+                    ReplyObject::from(xcb::ffi::present::xcb_present_query_version_reply(
+                        connection,
+                        present_version,
+                        null_mut(),
+                    ))
+                })
+                .is_some();
+        assert!(present_modes.contains(&create_info.presentMode));
+        if create_info.imageExtent.width != capabilities.currentExtent.width
+            || create_info.imageExtent.height != capabilities.currentExtent.height
+        {
+            return Err(api::VK_ERROR_OUT_OF_DATE_KHR);
+        }
+        let extent = capabilities.currentExtent;
+        image_properties.format = create_info.imageFormat;
+        image_properties.array_layers = create_info.imageArrayLayers;
+        assert_eq!(image_properties.array_layers, 1);
+        if image_properties.get_pixel_size_in_bytes() != image_pixel_size {
+            return Err(api::VK_ERROR_INITIALIZATION_FAILED);
+        }
+        let memory_layout = image_properties.computed_properties().memory_layout;
+        let image_count =
+            get_swapchain_image_count(create_info.minImageCount, capabilities.maxImageCount);
+        let mut images = Vec::with_capacity(image_count as usize);
+        for _ in 0..image_count {
+            let shared_memory = if shm_supported {
+                SharedImageMemory::new(connection, memory_layout)
+            } else {
+                None
+            };
+            let (device_memory, shm_seg) = match shared_memory {
+                Some((memory, shm_seg)) => (
+                    DeviceMemory::from_special(DeviceMemoryType::Main, Box::new(memory)),
+                    Some(shm_seg),
+                ),
+                None => (
+                    DeviceMemory::allocate_from_default_heap(DeviceMemoryType::Main, memory_layout)
+                        .map_err(|_| api::VK_ERROR_OUT_OF_HOST_MEMORY)?,
+                    None,
+                ),
+            };
+            let device_memory = OwnedHandle::<api::VkDeviceMemory>::new(device_memory);
+            let image = OwnedHandle::<api::VkImage>::new(Image {
+                properties: image_properties,
+                usage: create_info.imageUsage,
+                memory: Some(ImageMemory {
+                    device_memory: SharedHandle::from(device_memory.get_handle()).unwrap(),
+                    offset: 0,
+                }),
+            });
+            let pixmap_is_shared = present_supported && shared_pixmaps && shm_seg.is_some();
+            let pixmap = if present_supported {
+                let pixmap = xcb::ffi::xcb_generate_id(connection);
+                match shm_seg {
+                    Some(ref shm_seg) if pixmap_is_shared => {
+                        xcb::ffi::shm::xcb_shm_create_pixmap(
+                            connection,
+                            pixmap,
+                            window,
+                            extent.width as u16,
+                            extent.height as u16,
+                            window_depth,
+                            shm_seg.get(),
+                            0,
+                        );
+                    }
+                    _ => {
+                        xcb::ffi::xcb_create_pixmap(
+                            connection,
+                            window_depth,
+                            pixmap,
+                            window,
+                            extent.width as u16,
+                            extent.height as u16,
+                        );
+                    }
+                }
+                Some(create_pixmap(pixmap, connection))
+            } else {
+                None
+            };
+            images.push(SwapchainImage {
+                image,
+                device_memory,
+                pixmap,
+                pixmap_is_shared,
+                shm_seg,
+            });
+        }
+        let row_pitch = image_properties
+            .get_subresource_layout(Tiling::Linear, 0, 0)
+            .row_pitch;
+        let present_events = if present_supported {
+            Some(PresentEventQueue::new(connection, window))
+        } else {
+            None
+        };
+        let shared = XcbSwapchainShared {
+            connection,
+            window,
+            gc,
+            window_depth,
+            extent,
+            row_pitch,
+            present_mode: create_info.presentMode,
+            images,
+            present_events,
+            state: Mutex::new(XcbSwapchainState {
+                available_images: (0..image_count).collect(),
+                presents_pending: 0,
+                present_syncs: vec![None; image_count as usize],
+                present_serial: 0,
+                last_complete_msc: None,
+                last_target_msc: 0,
+                out_of_date: false,
+                error: None,
+            }),
+            image_available: Condvar::new(),
+        };
+        if let Some(present_events) = &shared.present_events {
+            // FIFO presents are queued for consecutive mscs starting after the current one,
+            // so find out what it is
+            xcb::ffi::present::xcb_present_notify_msc(connection, window, 0, 0, 0, 0);
+            xcb::ffi::xcb_flush(connection);
+            let mut state = shared.state.lock().unwrap();
+            while state.last_complete_msc.is_none() {
+                let event = present_events
+                    .wait()
+                    .ok_or(api::VK_ERROR_SURFACE_LOST_KHR)?;
+                shared.handle_present_event(&mut state, &event);
+            }
+        }
+        let shared = Arc::new(shared);
+        Ok(XcbSwapchain {
+            present_thread: PresentThread::new(shared.clone(), image_count),
+            shared,
+        })
+    }
+}
+
+impl XcbSwapchainShared {
+    unsafe fn handle_present_event(
+        &self,
+        state: &mut XcbSwapchainState,
+        event: &xcb::ffi::xcb_generic_event_t,
+    ) {
+        #![allow(clippy::cast_ptr_alignment)]
+        let event = event as *const xcb::ffi::xcb_generic_event_t;
+        let event_type =
+            u32::from((*(event as *const xcb::ffi::present::xcb_present_generic_event_t)).evtype);
+        if event_type == xcb::ffi::present::XCB_PRESENT_CONFIGURE_NOTIFY as u32 {
+            let event = &*(event as *const xcb::ffi::present::xcb_present_configure_notify_event_t);
+            if u32::from(event.width) != self.extent.width
+                || u32::from(event.height) != self.extent.height
+            {
+                state.out_of_date = true;
+            }
+        } else if event_type == xcb::ffi::present::XCB_PRESENT_COMPLETE_NOTIFY as u32 {
+            let event = &*(event as *const xcb::ffi::present::xcb_present_complete_notify_event_t);
+            state.last_complete_msc = Some(
+                state
+                    .last_complete_msc
+                    .map_or(event.msc, |msc| msc.max(event.msc)),
+            );
+        } else if event_type == xcb::ffi::present::XCB_PRESENT_IDLE_NOTIFY as u32 {
+            let event = &*(event as *const xcb::ffi::present::xcb_present_idle_notify_event_t);
+            let image_index = self.images.iter().position(|image| {
+                image.pixmap.as_ref().map(|pixmap| pixmap.get()) == Some(event.pixmap)
+            });
+            if let Some(image_index) = image_index {
+                state.available_images.push_back(image_index as u32);
+                state.presents_pending -= 1;
+                self.image_available.notify_all();
+            }
+        }
+    }
+    unsafe fn handle_present_events(
+        &self,
+        state: &mut XcbSwapchainState,
+        present_events: &PresentEventQueue,
+    ) -> Result<(), api::VkResult> {
+        while let Some(event) = present_events.poll() {
+            self.handle_present_event(state, &event);
+        }
+        if xcb::ffi::xcb_connection_has_error(self.connection) != 0 {
+            return Err(self.fail(state, api::VK_ERROR_SURFACE_LOST_KHR));
+        }
+        Ok(())
+    }
+    /// wakes up `acquire_next_image`, so it can return `error`
+    fn fail(&self, state: &mut XcbSwapchainState, error: api::VkResult) -> api::VkResult {
+        state.error.get_or_insert(error);
+        self.image_available.notify_all();
+        error
+    }
+    unsafe fn acquire_next_image(&self, timeout: u64) -> Result<u32, api::VkResult> {
+        let deadline = if timeout == u64::max_value() {
+            None
+        } else {
+            Some(Instant::now() + Duration::from_nanos(timeout))
+        };
+        let mut state = self.state.lock().unwrap();
+        let image_index = loop {
+            if let Some(error) = state.error {
+                return Err(error);
+            }
+            if state.out_of_date {
+                return Err(api::VK_ERROR_OUT_OF_DATE_KHR);
+            }
+            if let Some(image_index) = state.available_images.pop_front() {
+                break image_index;
+            }
+            // images come back when the present thread is done with them
+            state = match deadline {
+                None => self.image_available.wait(state).unwrap(),
+                Some(deadline) => {
+                    let now = Instant::now();
+                    if now >= deadline {
+                        return Err(if timeout == 0 {
+                            api::VK_NOT_READY
+                        } else {
+                            api::VK_TIMEOUT
+                        });
+                    }
+                    self.image_available
+                        .wait_timeout(state, deadline - now)
+                        .unwrap()
+                        .0
+                }
+            };
+        };
+        // the lock isn't held while waiting for the server, so presents aren't blocked by it
+        let present_sync = state.present_syncs[image_index as usize].take();
+        drop(state);
+        if let Some(present_sync) = present_sync {
+            // xcb can't wait for a reply with a timeout, so this polls until the server gets
+            // through the put requests before the round trip
+            loop {
+                let mut reply = null_mut();
+                let mut error = null_mut();
+                if xcb::ffi::xcb_poll_for_reply(
+                    self.connection,
+                    present_sync.sequence,
+                    &mut reply,
+                    &mut error,
+                ) != 0
+                {
+                    libc::free(reply);
+                    libc::free(error as *mut libc::c_void);
+                    break;
+                }
+                if xcb::ffi::xcb_connection_has_error(self.connection) != 0 {
+                    let mut state = self.state.lock().unwrap();
+                    return Err(self.fail(&mut state, api::VK_ERROR_SURFACE_LOST_KHR));
+                }
+                let now = Instant::now();
+                match deadline {
+                    Some(deadline) if now >= deadline => {
+                        let mut state = self.state.lock().unwrap();
+                        state.present_syncs[image_index as usize] = Some(present_sync);
+                        state.available_images.push_front(image_index);
+                        self.image_available.notify_one();
+                        return Err(if timeout == 0 {
+                            api::VK_NOT_READY
+                        } else {
+                            api::VK_TIMEOUT
+                        });
+                    }
+                    Some(deadline) => {
+                        thread::sleep((deadline - now).min(PRESENT_SYNC_POLL_INTERVAL))
+                    }
+                    None => thread::sleep(PRESENT_SYNC_POLL_INTERVAL),
+                }
+            }
+        }
+        Ok(image_index)
+    }
+    unsafe fn present_pixmap(
+        &self,
+        present_events: &PresentEventQueue,
+        image: &SwapchainImage,
+    ) -> Result<(), api::VkResult> {
+        let pixmap = image.pixmap.as_ref().unwrap().get();
+        if !image.pixmap_is_shared {
+            // the pixmap only has to be complete by the time the server handles the
+            // PresentPixmap request after this
+            match image.shm_seg {
+                Some(ref shm_seg) => self.shm_put_image(pixmap, shm_seg),
+                None => self.put_image(pixmap, image),
+            }
+        }
+        let mut state = self.state.lock().unwrap();
+        self.handle_present_events(&mut state, present_events)?;
+        let (options, target_msc) = match self.present_mode {
+            api::VK_PRESENT_MODE_IMMEDIATE_KHR => (xcb::ffi::present::XCB_PRESENT_OPTION_ASYNC, 0),
+            // the server replaces a present that is still waiting for the next vblank, so the
+            // newest image is always the one shown
+            api::VK_PRESENT_MODE_MAILBOX_KHR => (xcb::ffi::present::XCB_PRESENT_OPTION_NONE, 0),
+            _ => {
+                let last_complete_msc = state.last_complete_msc.unwrap_or(0);
+                let target_msc = state.last_target_msc.max(last_complete_msc) + 1;
+                state.last_target_msc = target_msc;
+                (xcb::ffi::present::XCB_PRESENT_OPTION_NONE, target_msc)
+            }
+        };
+        state.present_serial = state.present_serial.wrapping_add(1);
+        xcb::ffi::present::xcb_present_pixmap(
+            self.connection,
+            self.window,
+            pixmap,
+            state.present_serial,
+            0,
+            0,
+            0,
+            0,
+            0,
+            0,
+            0,
+            options as u32,
+            target_msc,
+            0,
+            0,
+            0,
+            null(),
+        );
+        xcb::ffi::xcb_flush(self.connection);
+        // the image is available again once the server sends the IdleNotify for it
+        state.presents_pending += 1;
+        if state.out_of_date {
+            Err(api::VK_ERROR_OUT_OF_DATE_KHR)
+        } else {
+            Ok(())
+        }
+    }
+    unsafe fn shm_put_image(&self, drawable: xcb::ffi::xcb_drawable_t, shm_seg: &ShmSeg) {
+        xcb::ffi::shm::xcb_shm_put_image(
+            self.connection,
+            drawable,
+            self.gc.get(),
+            self.extent.width as u16,
+            self.extent.height as u16,
+            0,
+            0,
+            self.extent.width as u16,
+            self.extent.height as u16,
+            0,
+            0,
+            self.window_depth,
+            xcb::ffi::XCB_IMAGE_FORMAT_Z_PIXMAP as u8,
+            0,
+            shm_seg.get(),
+            0,
+        );
+    }
+    /// for images that aren't attached to the X server.
+    ///
+    /// The image is split into as few `PutImage` requests as the maximum request length allows;
+    /// requests that cover whole rows are sent straight from the image memory.
+    unsafe fn put_image(&self, drawable: xcb::ffi::xcb_drawable_t, image: &SwapchainImage) {
+        #![allow(clippy::cast_lossless)]
+        const PUT_IMAGE_REQUEST_HEADER_SIZE: usize = 24;
+        let maximum_request_size =
+            xcb::ffi::xcb_get_maximum_request_length(self.connection) as usize * 4;
+        let maximum_data_size = maximum_request_size - PUT_IMAGE_REQUEST_HEADER_SIZE;
+        let width = self.extent.width as usize;
+        let height = self.extent.height as usize;
+        let pixel_size = self.row_pitch / width;
+        let chunk_width = width.min(maximum_data_size / pixel_size);
+        let chunk_height = (maximum_data_size / (chunk_width * pixel_size)).min(height);
+        let memory = image.device_memory.get().as_ptr() as *const u8;
+        let mut chunk_data = Vec::new();
+        for y in (0..height).step_by(chunk_height) {
+            let chunk_height = chunk_height.min(height - y);
+            for x in (0..width).step_by(chunk_width) {
+                let chunk_width = chunk_width.min(width - x);
+                let chunk_row_size = chunk_width * pixel_size;
+                let data = if chunk_width == width {
+                    memory.add(y * self.row_pitch)
+                } else {
+                    chunk_data.clear();
+                    for row in y..y + chunk_height {
+                        chunk_data.extend_from_slice(util::to_slice(
+                            memory.add(row * self.row_pitch + x * pixel_size),
+                            chunk_row_size,
+                        ));
+                    }
+                    chunk_data.as_ptr()
+                };
+                xcb::ffi::xcb_put_image(
+                    self.connection,
+                    xcb::ffi::XCB_IMAGE_FORMAT_Z_PIXMAP as u8,
+                    drawable,
+                    self.gc.get(),
+                    chunk_width as u16,
+                    chunk_height as u16,
+                    x as i16,
+                    y as i16,
+                    0,
+                    self.window_depth,
+                    (chunk_row_size * chunk_height) as u32,
+                    data,
+                );
+            }
+        }
+    }
+}
+
+impl SwapchainPresenter for XcbSwapchainShared {
+    unsafe fn present(&self, image_index: u32) -> Result<(), api::VkResult> {
+        let image = &self.images[image_index as usize];
+        if let Some(present_events) = &self.present_events {
+            return self.present_pixmap(present_events, image);
+        }
+        let present_sync = match image.shm_seg {
+            Some(ref shm_seg) => {
+                self.shm_put_image(self.window, shm_seg);
+                // the server reads the image while handling ShmPutImage, so once this round
+                // trip is answered the image can be written again
+                Some(xcb::ffi::xcb_get_input_focus(self.connection))
+            }
+            None => {
+                self.put_image(self.window, image);
+                None
+            }
+        };
+        xcb::ffi::xcb_flush(self.connection);
+        let mut state = self.state.lock().unwrap();
+        state.present_syncs[image_index as usize] = present_sync;
+        state.available_images.push_back(image_index);
+        self.image_available.notify_all();
+        if xcb::ffi::xcb_connection_has_error(self.connection) != 0 {
+            Err(self.fail(&mut state, api::VK_ERROR_SURFACE_LOST_KHR))
+        } else {
+            Ok(())
+        }
+    }
+    unsafe fn poll(&self) -> Result<bool, api::VkResult> {
+        let present_events = match &self.present_events {
+            Some(present_events) => present_events,
+            None => return Ok(false),
+        };
+        let mut state = self.state.lock().unwrap();
+        self.handle_present_events(&mut state, present_events)?;
+        // keep polling until every image comes back
+        Ok(state.presents_pending != 0)
+    }
+}
+
+impl Swapchain for XcbSwapchain {
+    unsafe fn get_images(&self) -> Vec<api::VkImage> {
+        self.shared
+            .images
+            .iter()
+            .map(|image| image.image.get_handle())
+            .collect()
+    }
+    unsafe fn acquire_next_image(&self, timeout: u64) -> Result<u32, api::VkResult> {
+        self.shared.acquire_next_image(timeout)
+    }
+    unsafe fn present(&self, image_index: u32) {
+        self.present_thread.queue_present(image_index);
+    }
+    fn get_status(&self) -> Result<(), api::VkResult> {
+        self.present_thread.get_status()?;
+        if self.shared.state.lock().unwrap().out_of_date {
+            Err(api::VK_ERROR_OUT_OF_DATE_KHR)
+        } else {
+            Ok(())
+        }
+    }
+}
+
+impl Drop for XcbSwapchainShared {
+    fn drop(&mut self) {
+        // collect the outstanding replies, so xcb doesn't keep them around
+        for present_sync in self.state.get_mut().unwrap().present_syncs.drain(..) {
+            if let Some(present_sync) = present_sync {
+                unsafe {
+                    ReplyObject::from(xcb::ffi::xcb_get_input_focus_reply(
+                        self.connection,
+                        present_sync,
+                        null_mut(),
+                    ));
+                }
+            }
+        }
     }
 }
 
@@ -438,6 +1181,7 @@ impl SurfaceImplementation for XcbSurfaceImplementation {
         device_group_create_info: Option<&api::VkDeviceGroupSwapchainCreateInfoKHR>,
     ) -> Result<Box<Swapchain>, api::VkResult> {
         Ok(Box::new(XcbSwapchain::new(
+            self.get_surface(create_info.surface),
             create_info,
             device_group_create_info,
         )?))
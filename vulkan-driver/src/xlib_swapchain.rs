@@ -72,7 +72,9 @@ impl SurfaceImplementation for XlibSurfaceImplementation {
         device_group_create_info: Option<&api::VkDeviceGroupSwapchainCreateInfoKHR>,
     ) -> Result<Box<Swapchain>, api::VkResult> {
         // We can just create an XCB swapchain, since the xlib surface is build on top of XCB.
+        let xcb_surface = self.surface_to_xcb(self.get_surface(create_info.surface));
         Ok(Box::new(XcbSwapchain::new(
+            &xcb_surface,
             create_info,
             device_group_create_info,
         )?))